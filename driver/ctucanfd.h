@@ -33,9 +33,53 @@
 #include <linux/netdevice.h>
 #include <linux/can/dev.h>
 #include <linux/list.h>
+#include <linux/mutex.h>
+#include <linux/ptp_clock_kernel.h>
+
+#include "ctucanfd_filter.h"
 
 enum ctu_can_fd_can_registers;
 
+#define CTUCANFD_MAX_TXBUFS 8
+
+#define CTUCANFD_INT_COUNT 16
+#define CTUCANFD_IRQ_LAT_BUCKETS 16
+
+/* First core version (major * 10 + minor) which latches TIMESTAMP_HIGH */
+#define CTUCANFD_VER_TS_HIGH_LATCH 25
+
+struct dentry;
+
+/* Frame held in TXT buffer, used by length-aware TX scheduling */
+struct ctucan_txb_slot {
+	canid_t can_id;
+	u32 seq;	/* insertion order */
+	u32 time_ns;	/* estimated time frame occupies the bus */
+};
+
+/* IRQ-to-service latency statistics of one interrupt source. Bucket 0 holds latencies below
+ * 128 ns, bucket i > 0 latencies in [2^(i+6), 2^(i+7)) ns, the last bucket everything above.
+ */
+struct ctucan_irq_lat {
+	u32 last_ts;	/* last processed INT_TS value */
+	u32 max_ns;
+	u64 sum_ns;
+	u64 count;
+	u32 hist[CTUCANFD_IRQ_LAT_BUCKETS];
+};
+
+/* Settings applied on interface open, configured through sysfs while interface is down */
+struct ctucan_open_cfg {
+	u32 ssp_autocal; /* frames measuring transceiver delay for SSP, 0 - no calibration */
+	u32 tx_sched; /* 1 - length-aware TXT buffer scheduling */
+	u32 rx_drop_oldest; /* 1 - RX FIFO discards oldest frames on overflow */
+	u32 rx_dma; /* log2 of RX DMA ring slots, 0 - frames are read from RX_DATA */
+	u32 rx_dma_batch; /* frames moved by RX DMA per interrupt */
+	u32 tx_fifo; /* 1 - all frames are transmitted via TXT FIFO */
+	u32 irq_lat; /* 1 - IRQ-to-service latency is measured */
+	u32 ts_freq; /* frequency of timestamp input in Hz, 0 - same as core clock */
+};
+
 struct ctucan_priv {
 	struct can_priv can; /* must be first member! */
 
@@ -48,17 +92,82 @@ struct ctucan_priv {
 	unsigned int txb_head;
 	unsigned int txb_tail;
 	u32 txb_prio;
-	unsigned int ntxbufs;
+	unsigned int ntxbufs; /* TXT buffers used for frames from the TX queue */
+	unsigned int txb_count; /* synthesized TXT buffers */
 	spinlock_t tx_lock; /* spinlock to serialize allocation and processing of TX buffers */
 
+	/* Length-aware TX scheduling, valid when CTUCANFD_FLAG_TX_SCHED is set */
+	unsigned long txb_used; /* bitmap of TXT buffers holding a not yet processed frame */
+	u32 txb_seq; /* sequence number of next inserted frame */
+	struct ctucan_txb_slot txb_slot[CTUCANFD_MAX_TXBUFS];
+
+	/* TX completion FIFO, replaces TX_STATUS scan when synthesized (not used with TXT FIFO) */
+	bool tx_cpl_sup; /* TX completion FIFO is synthesized */
+	bool tx_cpl_verify; /* records were lost, check them against TX_STATUS till TX is idle */
+	unsigned long txb_cpl_done; /* bitmap of TXT buffers with popped but not processed record */
+	u8 txb_cpl_st[CTUCANFD_MAX_TXBUFS]; /* final state from the record */
+
 	struct napi_struct napi;
 	struct device *dev;
 	struct clk *can_clk;
 
 	int irq_flags;
 	unsigned long drv_flags;
+	struct ctucan_open_cfg cfg;
 
 	u32 rxfrm_first_word;
+	u32 rxfrm_id_word;
+
+	/* RX acceptance filters, configured through sysfs while interface is down */
+	struct ctucan_filter rx_filter;
+	u8 rx_filter_mask_sup; /* bit i set if mask filter i (A = 0) is synthesized */
+	bool rx_filter_range_sup;
+	bool rx_skip_sup; /* RX frame header peek and RXSKIP command are synthesized */
+	unsigned long rx_filter_dropped; /* frames rejected by software filter */
+
+	/* Priority RX buffer, frames of filters routed by rx_prio_route are read before RX FIFO */
+	bool rx_prio_sup; /* Priority RX buffer is synthesized */
+	u32 rx_prio_route; /* RXP_CTRL routing bits, configured through sysfs while down */
+
+	u32 rx_drop_ctr; /* last seen value of RX_DROP_CTR */
+
+	/* RX DMA ring, valid when CTUCANFD_FLAG_RX_DMA is set */
+	bool rx_dma_sup; /* RX DMA is synthesized */
+	__le32 *rx_dma_ring;
+	dma_addr_t rx_dma_addr;
+	unsigned int rx_dma_slots; /* power of 2 */
+	unsigned int rx_dma_cons; /* next slot to be read by driver */
+
+	/* TXT FIFO, valid when CTUCANFD_FLAG_TX_FIFO is set */
+	unsigned int tx_fifo_depth; /* 0 if TXT FIFO is not synthesized */
+	unsigned int tx_fifo_th; /* TXBHCI is masked while more frames are pending */
+	unsigned int txf_head; /* number of inserted frames */
+	unsigned int txf_tail; /* number of processed frames */
+
+	/* Cyclic transmission, configured through sysfs while interface is down */
+	bool tx_cyc_sup; /* cyclic transmission from TXT buffers is synthesized */
+	u32 tx_cyc_period_us; /* 0 if cyclic transmission is disabled */
+	struct canfd_frame tx_cyc_frame;
+
+	/* IRQ latency measurement, valid when CTUCANFD_FLAG_IRQ_LAT is set */
+	bool irq_lat_sup; /* interrupt timestamps are synthesized */
+	struct ctucan_irq_lat irq_lat[CTUCANFD_INT_COUNT];
+	struct dentry *debugfs_dir;
+
+	bool bus_stat_sup; /* bus statistics counters are synthesized */
+	struct mutex bus_stat_lock; /* serializes snapshot and readout of bus statistics */
+
+	/* Internal timestamp generator, counts nanoseconds when ts_inc_nom is non-zero */
+	bool ts_gen_sup; /* timestamp generator is synthesized */
+	bool ts_high_latch; /* read of TIMESTAMP_LOW latches TIMESTAMP_HIGH */
+	u32 ts_inc_nom; /* TS_INC for nominal rate, 8.24 fixed point ns per clock cycle */
+	u32 ts_inc; /* current TS_INC including PHC frequency adjustment */
+	spinlock_t ptp_lock; /* serializes access to timestamp registers */
+	struct ptp_clock *ptp_clock;
+	struct ptp_clock_info ptp_info;
+
+	/* Calibrated secondary sample point position, -1 if not calibrated */
+	int ssp_pos;
 
 	struct list_head peers_on_pdev;
 };
@@ -86,6 +195,8 @@ int ctucan_probe_common(struct device *dev, void __iomem *addr,
 			void (*set_drvdata_fnc)(struct device *dev,
 						struct net_device *ndev));
 
+void ctucan_ptp_unregister(struct net_device *ndev);
+
 int ctucan_suspend(struct device *dev) __maybe_unused;
 int ctucan_resume(struct device *dev) __maybe_unused;
 
@@ -28,19 +28,27 @@
  ******************************************************************************/
 
 #include <linux/clk.h>
+#include <linux/ctype.h>
+#include <linux/debugfs.h>
+#include <linux/dma-mapping.h>
 #include <linux/errno.h>
 #include <linux/init.h>
 #include <linux/bitfield.h>
 #include <linux/interrupt.h>
 #include <linux/io.h>
 #include <linux/kernel.h>
+#include <linux/math64.h>
 #include <linux/module.h>
+#include <linux/rtnetlink.h>
+#include <linux/seq_file.h>
 #include <linux/skbuff.h>
+#include <linux/slab.h>
 #include <linux/string.h>
 #include <linux/types.h>
 #include <linux/can/error.h>
 #include <linux/can/led.h>
 #include <linux/pm_runtime.h>
+#include <linux/ethtool.h>
 #include <linux/version.h>
 
 #include "ctucanfd.h"
@@ -60,8 +68,28 @@
 #define can_fd_len2dlc can_len2dlc
 #endif
 
+#if LINUX_VERSION_CODE < KERNEL_VERSION(6, 2, 0)
+static u64 adjust_by_scaled_ppm(u64 base, long scaled_ppm)
+{
+	bool negative = scaled_ppm < 0;
+	u64 diff;
+
+	if (negative)
+		scaled_ppm = -scaled_ppm;
+	diff = div64_u64(base * (u64)scaled_ppm, 1000000ULL << 16);
+
+	return negative ? base - diff : base + diff;
+}
+#endif
+
 #define CTUCANFD_ID 0xCAFD
 
+/* Secondary sample point position saturates at 8 bits in bus sampling */
+#define CTUCANFD_SSP_POS_MAX		255
+#define CTUCANFD_TRV_DELAY_HIST_SIZE	(REG_TRV_DELAY_TRV_DELAY_VALUE + 1)
+/* Calibration runs in ndo_open under rtnl_lock, each frame may take up to 20 ms */
+#define CTUCANFD_SSP_AUTOCAL_MAX	16
+
 /* TX buffer rotation:
  * - when a buffer transitions to empty state, rotate order and priorities
  * - if more buffers seem to transition at the same time, rotate by the number of buffers
@@ -72,6 +100,69 @@
 
 #define CTUCANFD_FLAG_RX_FFW_BUFFERED	1
 
+/* Length-aware TX scheduling (tx_sched=1):
+ * - any free TXT buffer is filled, there is no strict head/tail order, so a freed buffer is
+ *   re-used immediately regardless of its position
+ * - priorities are re-assigned on every insertion and completion: shortest frame first. Short
+ *   frames free their buffers quickly while longer ones keep the bus busy, which gives the CPU
+ *   time to refill freed buffers before the bus goes idle.
+ * - a frame is eligible only if no older frame with the same CAN ID is pending, so frames with
+ *   the same CAN ID are sent in order
+ * - a frame overtaken by more than 2 * ntxbufs newer frames is sent oldest first (no starvation)
+ */
+#define CTUCANFD_FLAG_TX_SCHED		2
+
+/* RX FIFO discards oldest frames on overflow (rx_drop_oldest=1). Discarded frames are counted
+ * by RX_DROP_CTR and accounted as RX overflow errors in ctucan_rx_poll().
+ */
+#define CTUCANFD_FLAG_RX_DROP_OLD	3
+
+/* Frames are moved from RX FIFO by RX DMA (rx_dma > 0) to a ring of 128 byte slots in coherent
+ * memory. Driver processes slots from rx_dma_cons up to RX_DMA_STATUS[RDPROD] and hands them
+ * back to the controller by writing RX_DMA_CONS. DMAI is used instead of RBNEI and it is handled
+ * the same way (masked until NAPI completes).
+ */
+#define CTUCANFD_FLAG_RX_DMA		4
+
+#define CTUCANFD_RX_DMA_SLOT_WORDS	32
+#define CTUCANFD_RX_DMA_RS_MAX		12
+#define CTUCANFD_RX_DMA_BATCH_DEF	8
+/* DMAI timeout, so that frames below the batch size do not wait in the ring for long */
+#define CTUCANFD_RX_DMA_TMO_US		500
+
+/* TXT FIFO mode (tx_fifo=1), TXT FIFO takes place of the last TXT buffer:
+ * - all frames are inserted to TXT FIFO, the remaining TXT buffers are not used
+ * - txf_head/txf_tail count inserted/processed frames, echo skb index is the counter modulo
+ *   FIFO depth
+ * - frames leaving the FIFO are processed in batches: TXBHCI is masked while more than TFTH
+ *   frames are pending, TFTI is raised when FIFO drains to TFTH (or is flushed)
+ * - failed or aborted transmission flushes the FIFO and all pending frames are dropped. Frames
+ *   transmitted just before the failure and not processed yet are reported as dropped too.
+ */
+#define CTUCANFD_FLAG_TX_FIFO		5
+
+#define CTUCANFD_TX_FIFO_MAX_DEPTH	64
+
+/* IRQ latency measurement (irq_lat=1). The controller latches lower 32 bits of timestamp when
+ * an interrupt becomes pending. ISR reads current timestamp after INT_STAT and INT_TS of each
+ * pending interrupt. A source is accounted once per pending period (INT_TS differs from the
+ * last processed value), so re-reading INT_STAT in the ISR loop does not count it twice.
+ */
+#define CTUCANFD_FLAG_IRQ_LAT		6
+
+/* Cyclic transmission (tx_cyclic sysfs attribute). The last TXT buffer transmits the configured
+ * frame with the configured period and it is excluded from ntxbufs, i.e. from TX queue. The
+ * buffer returns to Ready after each transmission without interrupt, it raises TXBHCI only when
+ * it ends in TX failed or Aborted, which stops cyclic transmission till the next open. The
+ * stopped buffer is left in TX failed / Aborted, it must not become Empty since STATUS[TXNF]
+ * would then report free TXT buffer which is not part of TX queue.
+ * The cyclic buffer has the highest priority, queue buffers use priorities below it, so that
+ * queued traffic does not delay cyclic slots. Not available when TXT FIFO is synthesized, since
+ * the last TXT buffer is then the TXT FIFO which is never cyclic.
+ */
+#define CTUCANFD_FLAG_TX_CYC		7
+#define CTUCANFD_TX_CYC_PRIO		7
+
 #define CTUCAN_STATE_TO_TEXT_ENTRY(st) \
 		[st] = #st
 
@@ -168,6 +259,8 @@ static void ctucan_write_txt_buf(struct ctucan_priv *priv, enum ctu_can_fd_can_r
 
 #define CTU_CAN_FD_TXTNF(priv) (!!FIELD_GET(REG_STATUS_TXNF, ctucan_read32(priv, CTUCANFD_STATUS)))
 #define CTU_CAN_FD_ENABLED(priv) (!!FIELD_GET(REG_MODE_ENA, ctucan_read32(priv, CTUCANFD_MODE)))
+#define CTU_CAN_FD_TXFNF(priv) \
+		(!FIELD_GET(REG_TX_FIFO_CTRL_TFFULL, ctucan_read32(priv, CTUCANFD_TX_FIFO_CTRL)))
 
 /**
  * ctucan_state_to_str() - Converts CAN controller state code to corresponding text
@@ -184,27 +277,100 @@ static const char *ctucan_state_to_str(enum can_state state)
 	return txt ? txt : "UNKNOWN";
 }
 
+/**
+ * ctucan_ts_read() - Reads 64-bit timestamp of the core
+ * @priv:	Pointer to private data
+ *
+ * On cores which latch TIMESTAMP_HIGH on read of TIMESTAMP_LOW, low word is read first.
+ * On older cores, high word is read twice, to detect carry from low word between reads.
+ *
+ * Return: Current timestamp
+ */
+static u64 ctucan_ts_read(struct ctucan_priv *priv)
+{
+	u32 hi, lo;
+
+	if (priv->ts_high_latch) {
+		lo = ctucan_read32(priv, CTUCANFD_TIMESTAMP_LOW);
+		hi = ctucan_read32(priv, CTUCANFD_TIMESTAMP_HIGH);
+	} else {
+		do {
+			hi = ctucan_read32(priv, CTUCANFD_TIMESTAMP_HIGH);
+			lo = ctucan_read32(priv, CTUCANFD_TIMESTAMP_LOW);
+		} while (hi != ctucan_read32(priv, CTUCANFD_TIMESTAMP_HIGH));
+	}
+
+	return ((u64)hi << 32) | lo;
+}
+
+/**
+ * ctucan_ts_write() - Sets or steps timestamp generator
+ * @priv:	Pointer to private data
+ * @val:	New timestamp value, or signed offset when @step is true
+ * @step:	True - add @val to timestamp, False - load @val to timestamp
+ *
+ * Caller must hold ptp_lock, or have exclusive access to the device.
+ */
+static void ctucan_ts_write(struct ctucan_priv *priv, u64 val, bool step)
+{
+	ctucan_write32(priv, CTUCANFD_TS_STEP_LOW, lower_32_bits(val));
+	ctucan_write32(priv, CTUCANFD_TS_STEP_HIGH, upper_32_bits(val));
+	ctucan_write32(priv, CTUCANFD_COMMAND, step ? REG_COMMAND_TSSTEP : REG_COMMAND_TSSET);
+}
+
+/**
+ * ctucan_ts_freq() - Gets frequency of timestamp of the core
+ * @priv:	Pointer to private data
+ *
+ * Return: Timestamp frequency in Hz
+ */
+static u32 ctucan_ts_freq(struct ctucan_priv *priv)
+{
+	if (priv->ts_inc_nom)
+		return NSEC_PER_SEC;
+
+	return priv->cfg.ts_freq ? priv->cfg.ts_freq : priv->can.clock.freq;
+}
+
 /**
  * ctucan_reset() - Issues software reset request to CTU CAN FD
  * @ndev:	Pointer to net_device structure
  *
+ * Software reset also clears the timestamp generator. When it counts nanoseconds, its rate and
+ * time are restored after the reset, time spent in reset is compensated from the system clock.
+ *
  * Return: 0 for success, -%ETIMEDOUT if CAN controller does not leave reset
  */
 static int ctucan_reset(struct net_device *ndev)
 {
 	int i = 100;
 	struct ctucan_priv *priv = netdev_priv(ndev);
+	unsigned long flags;
+	u64 ts = 0, t0 = 0;
 
 	ctucan_netdev_dbg(ndev, "%s\n", __func__);
 
+	spin_lock_irqsave(&priv->ptp_lock, flags);
+	if (priv->ts_inc_nom) {
+		ts = ctucan_ts_read(priv);
+		t0 = ktime_get_ns();
+	}
 	ctucan_write32(priv, CTUCANFD_MODE, REG_MODE_RST);
+	spin_unlock_irqrestore(&priv->ptp_lock, flags);
 	clear_bit(CTUCANFD_FLAG_RX_FFW_BUFFERED, &priv->drv_flags);
 
 	do {
 		u16 device_id = FIELD_GET(REG_DEVICE_ID_DEVICE_ID, ctucan_read32(priv, CTUCANFD_DEVICE_ID));
 
-		if (device_id == 0xCAFD)
+		if (device_id == 0xCAFD) {
+			if (priv->ts_inc_nom) {
+				spin_lock_irqsave(&priv->ptp_lock, flags);
+				ctucan_write32(priv, CTUCANFD_TS_INC, priv->ts_inc);
+				ctucan_ts_write(priv, ts + ktime_get_ns() - t0, false);
+				spin_unlock_irqrestore(&priv->ptp_lock, flags);
+			}
 			return 0;
+		}
 		if (!i--) {
 			netdev_warn(ndev, "device did not leave reset\n");
 			return -ETIMEDOUT;
@@ -325,7 +491,13 @@ static int ctucan_set_secondary_sample_point(struct net_device *ndev)
 	}
 
 	/* Use SSP for bit-rates above 1 Mbits/s */
-	if (dbt->bitrate > 1000000) {
+	if (dbt->bitrate > 1000000 && priv->ssp_pos >= 0) {
+
+		/* Calibrated position -> Use it directly without measured delay */
+		ssp_cfg = FIELD_PREP(REG_TRV_DELAY_SSP_OFFSET, priv->ssp_pos);
+		ssp_cfg |= FIELD_PREP(REG_TRV_DELAY_SSP_SRC, 0x2);
+
+	} else if (dbt->bitrate > 1000000) {
 
 		/* Calculate SSP in minimal time quanta */
 		ssp_offset = (priv->can.clock.freq / 1000) * dbt->sample_point / dbt->bitrate;
@@ -387,6 +559,50 @@ static void ctucan_set_mode(struct ctucan_priv *priv, const struct can_ctrlmode
 	ctucan_write32(priv, CTUCANFD_MODE, mode_reg);
 }
 
+/**
+ * ctucan_set_rx_filter() - Programs compiled RX acceptance filters to the core
+ * @priv:	Pointer to CTU CAN FD's private data
+ *
+ * Filters which are not synthesized are skipped. Acceptance filter mode is enabled only when
+ * the filter set requires hardware filtering.
+ */
+static void ctucan_set_rx_filter(struct ctucan_priv *priv)
+{
+	static const enum ctu_can_fd_can_registers mask_regs[CTUCANFD_FILTER_MASK_COUNT] = {
+		CTUCANFD_FILTER_A_MASK, CTUCANFD_FILTER_B_MASK, CTUCANFD_FILTER_C_MASK
+	};
+	static const enum ctu_can_fd_can_registers val_regs[CTUCANFD_FILTER_MASK_COUNT] = {
+		CTUCANFD_FILTER_A_VAL, CTUCANFD_FILTER_B_VAL, CTUCANFD_FILTER_C_VAL
+	};
+	const struct ctucan_filter *f = &priv->rx_filter;
+	u32 ctrl = 0;
+	u32 mode_reg;
+	int i;
+
+	/* Each filter has its nibble of accepted frame types in FILTER_CONTROL */
+	for (i = 0; i < CTUCANFD_FILTER_MASK_COUNT; i++) {
+		if (!(priv->rx_filter_mask_sup & BIT(i)))
+			continue;
+		ctucan_write32(priv, mask_regs[i], f->hw_mask[i].mask);
+		ctucan_write32(priv, val_regs[i], f->hw_mask[i].low);
+		ctrl |= f->hw_mask[i].ctrl << (4 * i);
+	}
+
+	if (priv->rx_filter_range_sup) {
+		ctucan_write32(priv, CTUCANFD_FILTER_RAN_LOW, f->hw_range.low);
+		ctucan_write32(priv, CTUCANFD_FILTER_RAN_HIGH, f->hw_range.high);
+		ctrl |= f->hw_range.ctrl << (4 * CTUCANFD_FILTER_MASK_COUNT);
+	}
+
+	ctucan_write32(priv, CTUCANFD_FILTER_CONTROL, ctrl);
+
+	mode_reg = ctucan_read32(priv, CTUCANFD_MODE);
+	mode_reg = f->hw_ena ? (mode_reg | REG_MODE_AFM) : (mode_reg & ~REG_MODE_AFM);
+	ctucan_write32(priv, CTUCANFD_MODE, mode_reg);
+}
+
+static void ctucan_tx_cyc_start(struct net_device *ndev);
+
 /**
  * ctucan_chip_start() - This routine starts the driver
  * @ndev:	Pointer to net_device structure
@@ -403,6 +619,7 @@ static int ctucan_chip_start(struct net_device *ndev)
 	struct ctucan_priv *priv = netdev_priv(ndev);
 	u32 int_ena, int_msk;
 	u32 mode_reg;
+	u32 rx_settings;
 	int err;
 	struct can_ctrlmode mode;
 
@@ -411,8 +628,60 @@ static int ctucan_chip_start(struct net_device *ndev)
 	priv->txb_prio = 0x01234567;
 	priv->txb_head = 0;
 	priv->txb_tail = 0;
+	priv->txb_used = 0;
+	priv->txb_seq = 0;
+	priv->txb_cpl_done = 0;
+	priv->tx_cpl_verify = false;
 	ctucan_write32(priv, CTUCANFD_TX_PRIORITY, priv->txb_prio);
 
+	/* TXT FIFO threshold at half of the FIFO, so that it is refilled before it drains */
+	priv->txf_head = 0;
+	priv->txf_tail = 0;
+	if (priv->cfg.tx_fifo && priv->tx_fifo_depth) {
+		set_bit(CTUCANFD_FLAG_TX_FIFO, &priv->drv_flags);
+		priv->tx_fifo_th = priv->tx_fifo_depth / 2;
+		ctucan_write32(priv, CTUCANFD_TX_FIFO_CTRL,
+			       FIELD_PREP(REG_TX_FIFO_CTRL_TFTH, priv->tx_fifo_th));
+	} else {
+		clear_bit(CTUCANFD_FLAG_TX_FIFO, &priv->drv_flags);
+	}
+
+	if (priv->cfg.tx_sched && !test_bit(CTUCANFD_FLAG_TX_FIFO, &priv->drv_flags))
+		set_bit(CTUCANFD_FLAG_TX_SCHED, &priv->drv_flags);
+	else
+		clear_bit(CTUCANFD_FLAG_TX_SCHED, &priv->drv_flags);
+
+	priv->ntxbufs = priv->txb_count;
+	clear_bit(CTUCANFD_FLAG_TX_CYC, &priv->drv_flags);
+
+	/* RX FIFO overflow policy, frames are timestamped in SOF for hardware RX timestamps */
+	rx_settings = priv->ts_inc_nom ? REG_RX_STATUS_RTSOP : 0;
+	if (priv->cfg.rx_drop_oldest) {
+		set_bit(CTUCANFD_FLAG_RX_DROP_OLD, &priv->drv_flags);
+		rx_settings |= REG_RX_STATUS_ROVP;
+	} else {
+		clear_bit(CTUCANFD_FLAG_RX_DROP_OLD, &priv->drv_flags);
+	}
+	ctucan_write32(priv, CTUCANFD_RX_STATUS, rx_settings);
+	ctucan_write32(priv, CTUCANFD_COMMAND, REG_COMMAND_RXDCRST);
+	priv->rx_drop_ctr = 0;
+
+	/* RX DMA ring, controller is after reset so RDPROD = 0 */
+	if (priv->rx_dma_ring) {
+		u32 tmo = DIV_ROUND_UP(priv->can.clock.freq / 1000000 * CTUCANFD_RX_DMA_TMO_US, 256);
+
+		set_bit(CTUCANFD_FLAG_RX_DMA, &priv->drv_flags);
+		priv->rx_dma_cons = 0;
+		ctucan_write32(priv, CTUCANFD_RX_DMA_BASE, lower_32_bits(priv->rx_dma_addr));
+		ctucan_write32(priv, CTUCANFD_RX_DMA_CONS, 0);
+		ctucan_write32(priv, CTUCANFD_RX_DMA_CTRL, REG_RX_DMA_CTRL_RDENA |
+			       FIELD_PREP(REG_RX_DMA_CTRL_RDRS, ilog2(priv->rx_dma_slots)) |
+			       FIELD_PREP(REG_RX_DMA_CTRL_RDBATCH, priv->cfg.rx_dma_batch) |
+			       FIELD_PREP(REG_RX_DMA_CTRL_RDTMO, clamp(tmo, 1U, 0xffffU)));
+	} else {
+		clear_bit(CTUCANFD_FLAG_RX_DMA, &priv->drv_flags);
+	}
+
 	/* Configure bit-rates and ssp */
 	err = ctucan_set_bittiming(ndev);
 	if (err < 0)
@@ -431,12 +700,28 @@ static int ctucan_chip_start(struct net_device *ndev)
 	mode.mask = 0xFFFFFFFF;
 	ctucan_set_mode(priv, &mode);
 
+	ctucan_set_rx_filter(priv);
+
+	/* Route frames accepted by selected filters to Priority RX buffer */
+	if (priv->rx_prio_sup)
+		ctucan_write32(priv, CTUCANFD_RXP_CTRL, priv->rx_prio_route);
+
 	/* Configure interrupts */
-	int_ena = REG_INT_STAT_RBNEI |
-		  REG_INT_STAT_TXBHCI |
+	int_ena = REG_INT_STAT_TXBHCI |
 		  REG_INT_STAT_EWLI |
 		  REG_INT_STAT_FCSI;
 
+	if (test_bit(CTUCANFD_FLAG_RX_DMA, &priv->drv_flags))
+		int_ena |= REG_INT_STAT_DMAI;
+	else
+		int_ena |= REG_INT_STAT_RBNEI;
+
+	if (test_bit(CTUCANFD_FLAG_TX_FIFO, &priv->drv_flags))
+		int_ena |= REG_INT_STAT_TFTI;
+
+	if (priv->rx_prio_route)
+		int_ena |= REG_INT_STAT_RPNEI;
+
 	/* Bus error reporting -> Allow Error/Arb.lost interrupts */
 	if (priv->can.ctrlmode & CAN_CTRLMODE_BERR_REPORTING) {
 		int_ena |= REG_INT_STAT_ALI |
@@ -457,6 +742,9 @@ static int ctucan_chip_start(struct net_device *ndev)
 	mode_reg |= REG_MODE_ENA;
 	ctucan_write32(priv, CTUCANFD_MODE, mode_reg);
 
+	if (priv->tx_cyc_period_us)
+		ctucan_tx_cyc_start(ndev);
+
 	return 0;
 }
 
@@ -522,6 +810,10 @@ static bool ctucan_is_txt_buf_writable(struct ctucan_priv *priv, u8 buf)
 {
 	enum ctucan_txtb_status buf_status;
 
+	/* TXT FIFO accepts frames in any state until it is full */
+	if (test_bit(CTUCANFD_FLAG_TX_FIFO, &priv->drv_flags) && buf == priv->ntxbufs - 1)
+		return CTU_CAN_FD_TXFNF(priv);
+
 	buf_status = ctucan_get_tx_status(priv, buf);
 	if (buf_status == TXT_RDY || buf_status == TXT_TRAN || buf_status == TXT_ABTP || buf_status == TXT_NOT_EXIST)
 		return false;
@@ -611,6 +903,372 @@ static void ctucan_give_txtb_cmd(struct ctucan_priv *priv, enum ctucan_txtb_comm
 	ctucan_write32(priv, CTUCANFD_TX_COMMAND, tx_cmd);
 }
 
+/**
+ * ctucan_write_txb_prio() - Writes priorities of TXT buffers
+ * @priv:	Pointer to private data
+ * @prio:	TX_PRIORITY value of TX queue buffers
+ *
+ * While cyclic transmission runs, priority of the cyclic TXT buffer is kept at
+ * CTUCANFD_TX_CYC_PRIO regardless of @prio.
+ */
+static void ctucan_write_txb_prio(struct ctucan_priv *priv, u32 prio)
+{
+	if (test_bit(CTUCANFD_FLAG_TX_CYC, &priv->drv_flags)) {
+		prio &= GENMASK(priv->ntxbufs * 4 - 1, 0);
+		prio |= CTUCANFD_TX_CYC_PRIO << (priv->ntxbufs * 4);
+	}
+	priv->txb_prio = prio;
+	ctucan_write32(priv, CTUCANFD_TX_PRIORITY, prio);
+}
+
+/**
+ * ctucan_tx_cyc_start() - Starts cyclic transmission from the last TXT buffer
+ * @ndev:	Pointer to net_device structure
+ *
+ * Called from ctucan_chip_start(), the TXT buffer is empty after reset. Period is converted to
+ * timestamp units, see CTUCANFD_FLAG_TX_CYC.
+ */
+static void ctucan_tx_cyc_start(struct net_device *ndev)
+{
+	struct ctucan_priv *priv = netdev_priv(ndev);
+	u8 buf = priv->txb_count - 1;
+	u64 period;
+
+	if (test_bit(CTUCANFD_FLAG_TX_FIFO, &priv->drv_flags)) {
+		netdev_warn(ndev, "cyclic transmission not available in TXT FIFO mode\n");
+		return;
+	}
+
+	if (!ctucan_insert_frame(priv, &priv->tx_cyc_frame, buf, false)) {
+		netdev_warn(ndev, "cyclic frame not inserted to TXB#%u\n", buf);
+		return;
+	}
+
+	period = div_u64((u64)priv->tx_cyc_period_us * ctucan_ts_freq(priv), USEC_PER_SEC);
+	ctucan_write32(priv, CTUCANFD_TXT_CYC_SEL, FIELD_PREP(REG_TXT_CYC_SEL_TCSEL, buf));
+	ctucan_write32(priv, CTUCANFD_TXT_CYC_PERIOD, clamp_t(u64, period, 1, U32_MAX));
+
+	set_bit(CTUCANFD_FLAG_TX_CYC, &priv->drv_flags);
+	priv->ntxbufs--;
+
+	/* Queue buffers keep their order one level below the cyclic buffer */
+	ctucan_write_txb_prio(priv, priv->txb_prio >> 4);
+	ctucan_give_txtb_cmd(priv, TXT_CMD_SET_READY, buf);
+}
+
+/**
+ * ctucan_tx_cyc_complete() - Checks whether cyclic transmission ended
+ * @ndev:	Pointer to net_device structure
+ *
+ * Cyclic TXT buffer raises TXBHCI only when it ends in TX failed (retransmit limit, bus-off) or
+ * Aborted. Such buffer is left in its state (see CTUCANFD_FLAG_TX_CYC) and the transmission is
+ * not resumed till the next open.
+ *
+ * Return: True if the cyclic TXT buffer was processed
+ */
+static bool ctucan_tx_cyc_complete(struct net_device *ndev)
+{
+	struct ctucan_priv *priv = netdev_priv(ndev);
+	u8 buf = priv->txb_count - 1;
+	enum ctucan_txtb_status status;
+
+	if (!test_bit(CTUCANFD_FLAG_TX_CYC, &priv->drv_flags))
+		return false;
+
+	status = ctucan_get_tx_status(priv, buf);
+	if (status != TXT_ERR && status != TXT_ABT)
+		return false;
+
+	netdev_warn(ndev, "cyclic transmission stopped, TXB#%u status 0x%x\n", buf, status);
+	ndev->stats.tx_dropped++;
+	clear_bit(CTUCANFD_FLAG_TX_CYC, &priv->drv_flags);
+
+	return true;
+}
+
+/**
+ * ctucan_ssp_calibrate() - Calibrates secondary sample point from measured transceiver delay
+ * @ndev:	Pointer to net_device structure
+ *
+ * Sends ssp_autocal CAN FD frames with bit-rate shift in self-test mode (no ACK needed) and
+ * records transceiver delay measured by the core in each successfully transmitted frame.
+ * Secondary sample point is then placed at median of measured delays plus position of sample
+ * point within data bit. Median is used since it ignores outliers caused by bus disturbances.
+ * When CAN_CTRLMODE_LOOPBACK is set, measurement runs in internal loopback.
+ *
+ * Core must be in reset state when called and is left in reset state on return. Result is
+ * stored to priv->ssp_pos and applied by ctucan_set_secondary_sample_point().
+ *
+ * Return: 0 on success (also when calibration is not needed), negative error code otherwise
+ */
+static int ctucan_ssp_calibrate(struct net_device *ndev)
+{
+	struct ctucan_priv *priv = netdev_priv(ndev);
+	struct can_bittiming *dbt = &priv->can.data_bittiming;
+	struct canfd_frame cf = { .can_id = CAN_SFF_MASK, .flags = CANFD_BRS, .len = 8 };
+	struct can_ctrlmode mode;
+	enum ctucan_txtb_status status = TXT_NOT_EXIST;
+	unsigned int i, cnt = 0, acc = 0;
+	u32 trv_min = U32_MAX, trv_max = 0, sum = 0, median;
+	u32 mode_reg, trv_delay;
+	u32 *hist;
+	int err, t;
+
+	priv->ssp_pos = -1;
+
+	if (!priv->cfg.ssp_autocal || !(priv->can.ctrlmode & CAN_CTRLMODE_FD) ||
+	    dbt->bitrate <= 1000000)
+		return 0;
+
+	hist = kcalloc(CTUCANFD_TRV_DELAY_HIST_SIZE, sizeof(*hist), GFP_KERNEL);
+	if (!hist)
+		return -ENOMEM;
+
+	err = ctucan_set_bittiming(ndev);
+	if (err < 0)
+		goto out;
+	err = ctucan_set_data_bittiming(ndev);
+	if (err < 0)
+		goto out;
+	/* Default SSP, data phase of measurement frames must pass at the target bit-rate */
+	err = ctucan_set_secondary_sample_point(ndev);
+	if (err < 0)
+		goto out;
+
+	mode.flags = priv->can.ctrlmode;
+	mode.mask = 0xFFFFFFFF;
+	ctucan_set_mode(priv, &mode);
+
+	/* Self-test mode, limit retransmissions so that broken bus does not block us forever */
+	mode_reg = ctucan_read32(priv, CTUCANFD_MODE);
+	mode_reg |= REG_MODE_STM | REG_MODE_RTRLE | FIELD_PREP(REG_MODE_RTRTH, 3);
+	ctucan_write32(priv, CTUCANFD_MODE, mode_reg);
+	ctucan_write32(priv, CTUCANFD_MODE, mode_reg | REG_MODE_ENA);
+
+	for (i = 0; i < priv->cfg.ssp_autocal; i++) {
+		cf.data[0] = i;
+		ctucan_give_txtb_cmd(priv, TXT_CMD_SET_EMPTY, 0);
+		if (!ctucan_insert_frame(priv, &cf, 0, true)) {
+			err = -EIO;
+			break;
+		}
+		ctucan_give_txtb_cmd(priv, TXT_CMD_SET_READY, 0);
+
+		/* Integration (11 recessive bits) + frame + retransmissions fit to 10 ms easily */
+		for (t = 0; t < 100; t++) {
+			status = ctucan_get_tx_status(priv, 0);
+			if (status != TXT_RDY && status != TXT_TRAN && status != TXT_ABTP)
+				break;
+			usleep_range(100, 200);
+		}
+
+		if (status != TXT_TOK) {
+			netdev_warn(ndev, "SSP calibration frame %u failed, TXB status: %u\n",
+				    i, status);
+			err = -EIO;
+			break;
+		}
+
+		trv_delay = FIELD_GET(REG_TRV_DELAY_TRV_DELAY_VALUE,
+				      ctucan_read32(priv, CTUCANFD_TRV_DELAY));
+		hist[trv_delay]++;
+		sum += trv_delay;
+		trv_min = min(trv_min, trv_delay);
+		trv_max = max(trv_max, trv_delay);
+		cnt++;
+	}
+
+	/* Leave core in reset state, it is configured from scratch by ctucan_chip_start */
+	t = ctucan_reset(ndev);
+	if (t < 0) {
+		err = t;
+		goto out;
+	}
+
+	if (!cnt)
+		goto out;
+
+	for (median = 0; median < CTUCANFD_TRV_DELAY_HIST_SIZE; median++) {
+		acc += hist[median];
+		if (acc * 2 >= cnt)
+			break;
+	}
+
+	priv->ssp_pos = median + dbt->brp * (1 + dbt->prop_seg + dbt->phase_seg1);
+	if (priv->ssp_pos > CTUCANFD_SSP_POS_MAX) {
+		netdev_warn(ndev, "SSP position saturated to %d\n", CTUCANFD_SSP_POS_MAX);
+		priv->ssp_pos = CTUCANFD_SSP_POS_MAX;
+	}
+
+	netdev_info(ndev, "SSP calibration: %u/%u frames, TRV delay min %u, max %u, mean %u, median %u -> SSP at %d cycles\n",
+		    cnt, priv->cfg.ssp_autocal, trv_min, trv_max, sum / cnt, median, priv->ssp_pos);
+	for (i = trv_min; i <= trv_max; i++)
+		if (hist[i])
+			netdev_dbg(ndev, "TRV delay %3u: %u\n", i, hist[i]);
+
+	/* Spread larger than phase 2 can not be covered by single SSP position */
+	if (trv_max - trv_min > dbt->brp * dbt->phase_seg2)
+		netdev_warn(ndev, "TRV delay spread (%u cycles) exceeds data phase 2, SSP may be unreliable\n",
+			    trv_max - trv_min);
+
+	err = 0;
+out:
+	kfree(hist);
+	return err;
+}
+
+/**
+ * ctucan_frame_time() - Estimates time which frame occupies the bus
+ * @priv:	Pointer to private data
+ * @cf:		Pointer to CAN frame
+ * @isfdf:	True - CAN FD Frame, False - CAN 2.0 Frame
+ *
+ * Stuff bits (apart from fixed stuff bits of CAN FD) are not counted. The estimate is used
+ * only to order frames by their length.
+ *
+ * Return: Estimated time in nanoseconds, including intermission
+ */
+static u32 ctucan_frame_time(struct ctucan_priv *priv, const struct canfd_frame *cf, bool isfdf)
+{
+	u32 nbt_ns = NSEC_PER_SEC / max(priv->can.bittiming.bitrate, 1U);
+	u32 dbt_ns = nbt_ns;
+	bool ide = !!(cf->can_id & CAN_EFF_FLAG);
+	u32 len = (cf->can_id & CAN_RTR_FLAG) ? 0 : cf->len;
+	u32 nbits, dbits = 0;
+
+	if (!isfdf) {
+		/* SOF, ID, RTR/SRR, IDE, (ID ext, RTR, r1), r0, DLC, data, CRC, CRC delimiter,
+		 * ACK, ACK delimiter, EOF, intermission
+		 */
+		nbits = (ide ? 67 : 47) + 8 * len;
+	} else {
+		/* SOF .. BRS and CRC delimiter .. intermission in nominal bit-rate */
+		nbits = (ide ? 36 : 17) + 13;
+
+		/* ESI, DLC, data, stuff count, CRC with fixed stuff bits */
+		dbits = 5 + 8 * len + 5 + (len > 16 ? 21 + 6 : 17 + 5);
+
+		if (cf->flags & CANFD_BRS && priv->can.data_bittiming.bitrate)
+			dbt_ns = NSEC_PER_SEC / priv->can.data_bittiming.bitrate;
+	}
+
+	return nbits * nbt_ns + dbits * dbt_ns;
+}
+
+/**
+ * ctucan_txsched_set_prio() - Assigns TXT buffer priorities in length-aware TX scheduling
+ * @priv:	Pointer to private data
+ *
+ * See CTUCANFD_FLAG_TX_SCHED for the policy. Each pending buffer gets unique priority, so the
+ * order is fully determined by the driver. Must be called with tx_lock held.
+ */
+static void ctucan_txsched_set_prio(struct ctucan_priv *priv)
+{
+	unsigned long pending = priv->txb_used;
+	u32 prio_reg = 0;
+	u32 prio = test_bit(CTUCANFD_FLAG_TX_CYC, &priv->drv_flags) ? CTUCANFD_TX_CYC_PRIO - 1 : 7;
+	unsigned int i, j;
+
+	while (pending) {
+		struct ctucan_txb_slot *best = NULL;
+		unsigned int best_id = 0;
+		bool best_starving = false;
+
+		for_each_set_bit(i, &pending, priv->ntxbufs) {
+			struct ctucan_txb_slot *slot = &priv->txb_slot[i];
+			bool starving;
+
+			/* Older frame with the same CAN ID must be sent first */
+			for_each_set_bit(j, &pending, priv->ntxbufs) {
+				if (priv->txb_slot[j].can_id == slot->can_id &&
+				    (s32)(priv->txb_slot[j].seq - slot->seq) < 0)
+					break;
+			}
+			if (j < priv->ntxbufs)
+				continue;
+
+			starving = priv->txb_seq - slot->seq > 2 * priv->ntxbufs;
+
+			if (!best ||
+			    (starving && !best_starving) ||
+			    (starving == best_starving && starving &&
+			     (s32)(slot->seq - best->seq) < 0) ||
+			    (starving == best_starving && !starving &&
+			     (slot->time_ns < best->time_ns ||
+			      (slot->time_ns == best->time_ns &&
+			       (s32)(slot->seq - best->seq) < 0)))) {
+				best = slot;
+				best_id = i;
+				best_starving = starving;
+			}
+		}
+
+		/* The oldest pending frame is always eligible, so best is always found */
+		prio_reg |= prio << (best_id * 4);
+		prio--;
+		clear_bit(best_id, &pending);
+	}
+
+	ctucan_write_txb_prio(priv, prio_reg);
+}
+
+static bool ctucan_tx_fifo_complete(struct net_device *ndev);
+
+/**
+ * ctucan_tx_fifo_xmit() - Inserts frame to TXT FIFO
+ * @skb:	sk_buff pointer that contains data to be Txed
+ * @ndev:	Pointer to net_device structure
+ *
+ * Return: %NETDEV_TX_OK on success, %NETDEV_TX_BUSY when TXT FIFO is full
+ */
+static netdev_tx_t ctucan_tx_fifo_xmit(struct sk_buff *skb, struct net_device *ndev)
+{
+	struct ctucan_priv *priv = netdev_priv(ndev);
+	struct net_device_stats *stats = &ndev->stats;
+	struct canfd_frame *cf = (struct canfd_frame *)skb->data;
+	u8 fifo_id = priv->ntxbufs - 1;
+	enum ctucan_txtb_status txtb_status;
+	unsigned long flags;
+
+	spin_lock_irqsave(&priv->tx_lock, flags);
+
+	/* Frames flushed by a failure must be dropped before FIFO leaves Failed/Aborted state,
+	 * otherwise they would be accounted as transmitted.
+	 */
+	txtb_status = ctucan_get_tx_status(priv, fifo_id);
+	if (txtb_status == TXT_ERR || txtb_status == TXT_ABT)
+		ctucan_tx_fifo_complete(ndev);
+
+	if (!ctucan_insert_frame(priv, cf, fifo_id, can_is_canfd_skb(skb))) {
+		netif_stop_queue(ndev);
+		spin_unlock_irqrestore(&priv->tx_lock, flags);
+		netdev_err(ndev, "BUG!, TXT FIFO full when queue awake!\n");
+		return NETDEV_TX_BUSY;
+	}
+
+#if LINUX_VERSION_CODE >= KERNEL_VERSION(5, 12, 0)
+	can_put_echo_skb(skb, ndev, priv->txf_head % priv->tx_fifo_depth, 0);
+#else /* < 5.12.0 */
+	can_put_echo_skb(skb, ndev, priv->txf_head % priv->tx_fifo_depth);
+#endif /* < 5.12.0 */
+
+	if (!(cf->can_id & CAN_RTR_FLAG))
+		stats->tx_bytes += cf->len;
+
+	ctucan_give_txtb_cmd(priv, TXT_CMD_SET_READY, fifo_id);
+	priv->txf_head++;
+
+	if (priv->txf_head - priv->txf_tail > priv->tx_fifo_th)
+		ctucan_write32(priv, CTUCANFD_INT_MASK_SET, REG_INT_STAT_TXBHCI);
+
+	if (!CTU_CAN_FD_TXFNF(priv))
+		netif_stop_queue(ndev);
+
+	spin_unlock_irqrestore(&priv->tx_lock, flags);
+
+	return NETDEV_TX_OK;
+}
+
 /**
  * ctucan_start_xmit() - Starts the transmission
  * @skb:	sk_buff pointer that contains data to be Txed
@@ -630,17 +1288,27 @@ static netdev_tx_t ctucan_start_xmit(struct sk_buff *skb, struct net_device *nde
 	u32 txtb_id;
 	bool ok;
 	unsigned long flags;
+	bool sched = test_bit(CTUCANFD_FLAG_TX_SCHED, &priv->drv_flags);
 
 	if (can_dropped_invalid_skb(ndev, skb))
 		return NETDEV_TX_OK;
 
+	if (test_bit(CTUCANFD_FLAG_TX_FIFO, &priv->drv_flags))
+		return ctucan_tx_fifo_xmit(skb, ndev);
+
 	if (unlikely(!CTU_CAN_FD_TXTNF(priv))) {
 		netif_stop_queue(ndev);
 		netdev_err(ndev, "BUG!, no TXB free when queue awake!\n");
 		return NETDEV_TX_BUSY;
 	}
 
-	txtb_id = priv->txb_head % priv->ntxbufs;
+	/* Buffer is released in ctucan_tx_interrupt before it is marked empty, so TXNF implies
+	 * a free bit in txb_used.
+	 */
+	if (sched)
+		txtb_id = find_first_zero_bit(&priv->txb_used, priv->ntxbufs);
+	else
+		txtb_id = priv->txb_head % priv->ntxbufs;
 	ctucan_netdev_dbg(ndev, "%s: using TXB#%u\n", __func__, txtb_id);
 	ok = ctucan_insert_frame(priv, cf, txtb_id, can_is_canfd_skb(skb));
 
@@ -649,9 +1317,11 @@ static netdev_tx_t ctucan_start_xmit(struct sk_buff *skb, struct net_device *nde
 		kfree_skb(skb);
 		ndev->stats.tx_dropped++;
 		/* Try next TX buffer */
-		spin_lock_irqsave(&priv->tx_lock, flags);
-		priv->txb_head++;
-		spin_unlock_irqrestore(&priv->tx_lock, flags);
+		if (!sched) {
+			spin_lock_irqsave(&priv->tx_lock, flags);
+			priv->txb_head++;
+			spin_unlock_irqrestore(&priv->tx_lock, flags);
+		}
 		return NETDEV_TX_OK;
 	}
 
@@ -665,6 +1335,14 @@ static netdev_tx_t ctucan_start_xmit(struct sk_buff *skb, struct net_device *nde
 		stats->tx_bytes += cf->len;
 
 	spin_lock_irqsave(&priv->tx_lock, flags);
+	if (sched) {
+		priv->txb_slot[txtb_id].can_id = cf->can_id;
+		priv->txb_slot[txtb_id].seq = priv->txb_seq++;
+		priv->txb_slot[txtb_id].time_ns = ctucan_frame_time(priv, cf,
+								    can_is_canfd_skb(skb));
+		set_bit(txtb_id, &priv->txb_used);
+		ctucan_txsched_set_prio(priv);
+	}
 	ctucan_give_txtb_cmd(priv, TXT_CMD_SET_READY, txtb_id);
 	priv->txb_head++;
 
@@ -678,38 +1356,66 @@ static netdev_tx_t ctucan_start_xmit(struct sk_buff *skb, struct net_device *nde
 }
 
 /**
- * ctucan_read_rx_frame() - Reads frame from RX FIFO
- * @priv:	Pointer to CTU CAN FD's private data
- * @cf:		Pointer to CAN frame struct
- * @ffw:	Previously read frame format word
+ * ctucan_rx_frame_id() - Decodes CAN ID with EFF/RTR flags of received frame
+ * @ffw:	Frame format word
+ * @idw:	Identifier word
  *
- * Note: Frame format word must be read separately and provided in 'ffw'.
+ * Return: CAN ID in SocketCAN format
  */
-static void ctucan_read_rx_frame(struct ctucan_priv *priv, struct canfd_frame *cf, u32 ffw)
+static canid_t ctucan_rx_frame_id(u32 ffw, u32 idw)
 {
-	u32 idw;
-	unsigned int i;
-	unsigned int wc;
-	unsigned int len;
+	canid_t can_id;
 
-	idw = ctucan_read32(priv, CTUCANFD_RX_DATA);
 	if (FIELD_GET(REG_FRAME_FORMAT_W_IDE, ffw))
-		cf->can_id = (idw & CAN_EFF_MASK) | CAN_EFF_FLAG;
+		can_id = (idw & CAN_EFF_MASK) | CAN_EFF_FLAG;
 	else
-		cf->can_id = (idw >> 18) & CAN_SFF_MASK;
+		can_id = (idw >> 18) & CAN_SFF_MASK;
+
+	if (!FIELD_GET(REG_FRAME_FORMAT_W_FDF, ffw) && FIELD_GET(REG_FRAME_FORMAT_W_RTR, ffw))
+		can_id |= CAN_RTR_FLAG;
+
+	return can_id;
+}
+
+/**
+ * ctucan_rx_frame_wc() - Number of data words of received frame
+ * @ffw:	Frame format word
+ *
+ * Return: RWCNT without identifier, timestamp and end of frame timestamp words
+ */
+static unsigned int ctucan_rx_frame_wc(u32 ffw)
+{
+	unsigned int rwcnt = FIELD_GET(REG_FRAME_FORMAT_W_RWCNT, ffw);
+	unsigned int hdr = FIELD_GET(REG_FRAME_FORMAT_W_ETS, ffw) ? 5 : 3;
+
+	return rwcnt > hdr ? rwcnt - hdr : 0;
+}
+
+/**
+ * ctucan_rx_frame_hdr() - Fills CAN frame ID, flags and length from received frame
+ * @cf:		Pointer to CAN frame struct
+ * @ffw:	Frame format word
+ * @idw:	Identifier word
+ *
+ * Return: Number of data bytes to be copied from the frame data words
+ */
+static unsigned int ctucan_rx_frame_hdr(struct canfd_frame *cf, u32 ffw, u32 idw)
+{
+	unsigned int wc;
+	unsigned int len;
+
+	cf->can_id = ctucan_rx_frame_id(ffw, idw);
 
-	/* BRS, ESI, RTR Flags */
+	/* BRS, ESI Flags */
 	cf->flags = 0;
 	if (FIELD_GET(REG_FRAME_FORMAT_W_FDF, ffw)) {
 		if (FIELD_GET(REG_FRAME_FORMAT_W_BRS, ffw))
 			cf->flags |= CANFD_BRS;
 		if (FIELD_GET(REG_FRAME_FORMAT_W_ESI_RSV, ffw))
 			cf->flags |= CANFD_ESI;
-	} else if (FIELD_GET(REG_FRAME_FORMAT_W_RTR, ffw)) {
-		cf->can_id |= CAN_RTR_FLAG;
 	}
 
-	wc = FIELD_GET(REG_FRAME_FORMAT_W_RWCNT, ffw) - 3;
+	wc = ctucan_rx_frame_wc(ffw);
 
 	/* DLC */
 	if (FIELD_GET(REG_FRAME_FORMAT_W_DLC, ffw) <= 8) {
@@ -724,19 +1430,65 @@ static void ctucan_read_rx_frame(struct ctucan_priv *priv, struct canfd_frame *c
 	if (unlikely(len > wc * 4))
 		len = wc * 4;
 
-	/* Timestamp - Read and throw away */
-	ctucan_read32(priv, CTUCANFD_RX_DATA);
-	ctucan_read32(priv, CTUCANFD_RX_DATA);
+	return len;
+}
+
+/**
+ * ctucan_read_rx_frame() - Reads frame from RX FIFO
+ * @priv:	Pointer to CTU CAN FD's private data
+ * @cf:		Pointer to CAN frame struct
+ * @ffw:	Previously read frame format word
+ * @idw:	Previously read identifier word
+ * @reg:	Data register of the FIFO, RX_DATA or RXP_DATA
+ *
+ * Note: Frame format and identifier words must be read separately and provided in 'ffw'
+ *       and 'idw'.
+ *
+ * Return: Timestamp of the frame
+ */
+static u64 ctucan_read_rx_frame(struct ctucan_priv *priv, struct canfd_frame *cf, u32 ffw,
+				u32 idw, enum ctu_can_fd_can_registers reg)
+{
+	unsigned int i;
+	unsigned int wc = ctucan_rx_frame_wc(ffw);
+	unsigned int len = ctucan_rx_frame_hdr(cf, ffw, idw);
+	u64 ts;
+
+	/* Timestamp */
+	ts = ctucan_read32(priv, reg);
+	ts |= (u64)ctucan_read32(priv, reg) << 32;
 
 	/* Data */
 	for (i = 0; i < len; i += 4) {
-		u32 data = ctucan_read32(priv, CTUCANFD_RX_DATA);
+		u32 data = ctucan_read32(priv, reg);
 		*(__le32 *)(cf->data + i) = cpu_to_le32(data);
 	}
 	while (unlikely(i < wc * 4)) {
-		ctucan_read32(priv, CTUCANFD_RX_DATA);
+		ctucan_read32(priv, reg);
 		i += 4;
 	}
+
+	/* End of frame timestamp - Read and throw away */
+	if (FIELD_GET(REG_FRAME_FORMAT_W_ETS, ffw)) {
+		ctucan_read32(priv, reg);
+		ctucan_read32(priv, reg);
+	}
+
+	return ts;
+}
+
+/**
+ * ctucan_rx_hwtstamp() - Attaches hardware timestamp to received frame
+ * @priv:	Pointer to CTU CAN FD's private data
+ * @skb:	Received frame
+ * @ts:		Timestamp of the frame, captured in SOF
+ *
+ * Timestamp is passed only when the timestamp generator counts nanoseconds of the PHC.
+ */
+static void ctucan_rx_hwtstamp(struct ctucan_priv *priv, struct sk_buff *skb, u64 ts)
+{
+	if (priv->ts_inc_nom)
+		skb_hwtstamps(skb)->hwtstamp = ns_to_ktime(ts);
 }
 
 /**
@@ -745,8 +1497,9 @@ static void ctucan_read_rx_frame(struct ctucan_priv *priv, struct canfd_frame *c
  *
  * This function is invoked from the CAN isr(poll) to process the Rx frames. It does minimal
  * processing and invokes "netif_receive_skb" to complete further processing.
- * Return: 1 when frame is passed to the network layer, 0 when the first frame word is read but
- *	   system is out of free SKBs temporally and left code to resolve SKB allocation later,
+ * Return: 1 when frame is passed to the network layer or dropped by software filter, 0 when
+ *	   the first frame words are read but system is out of free SKBs temporally and left code
+ *	   to resolve SKB allocation later,
  *         -%EAGAIN in a case of empty Rx FIFO.
  */
 static int ctucan_rx(struct net_device *ndev)
@@ -755,17 +1508,32 @@ static int ctucan_rx(struct net_device *ndev)
 	struct net_device_stats *stats = &ndev->stats;
 	struct canfd_frame *cf;
 	struct sk_buff *skb;
-	u32 ffw;
+	unsigned int i;
+	u32 ffw, idw;
+	u64 ts;
 
 	if (test_bit(CTUCANFD_FLAG_RX_FFW_BUFFERED, &priv->drv_flags)) {
 		ffw = priv->rxfrm_first_word;
+		idw = priv->rxfrm_id_word;
 		clear_bit(CTUCANFD_FLAG_RX_FFW_BUFFERED, &priv->drv_flags);
 	} else {
 		ffw = ctucan_read32(priv, CTUCANFD_RX_DATA);
+		if (!FIELD_GET(REG_FRAME_FORMAT_W_RWCNT, ffw))
+			return -EAGAIN;
+		idw = ctucan_read32(priv, CTUCANFD_RX_DATA);
 	}
 
-	if (!FIELD_GET(REG_FRAME_FORMAT_W_RWCNT, ffw))
-		return -EAGAIN;
+	/* Hardware filters accept superset of configured rules, drop the rest */
+	if (priv->rx_filter.sw_ena &&
+	    !ctucan_filter_match(&priv->rx_filter, ctucan_rx_frame_id(ffw, idw))) {
+		if (priv->rx_skip_sup)
+			ctucan_write32(priv, CTUCANFD_COMMAND, REG_COMMAND_RXSKIP);
+		else
+			for (i = 1; i < FIELD_GET(REG_FRAME_FORMAT_W_RWCNT, ffw); i++)
+				ctucan_read32(priv, CTUCANFD_RX_DATA);
+		priv->rx_filter_dropped++;
+		return 1;
+	}
 
 	if (FIELD_GET(REG_FRAME_FORMAT_W_FDF, ffw))
 		skb = alloc_canfd_skb(ndev, &cf);
@@ -774,11 +1542,68 @@ static int ctucan_rx(struct net_device *ndev)
 
 	if (unlikely(!skb)) {
 		priv->rxfrm_first_word = ffw;
+		priv->rxfrm_id_word = idw;
 		set_bit(CTUCANFD_FLAG_RX_FFW_BUFFERED, &priv->drv_flags);
 		return 0;
 	}
 
-	ctucan_read_rx_frame(priv, cf, ffw);
+	ts = ctucan_read_rx_frame(priv, cf, ffw, idw, CTUCANFD_RX_DATA);
+	ctucan_rx_hwtstamp(priv, skb, ts);
+
+	stats->rx_bytes += cf->len;
+	stats->rx_packets++;
+	netif_receive_skb(skb);
+
+	return 1;
+}
+
+/**
+ * ctucan_rx_dma() - Passes frame from RX DMA ring slot to the network layer
+ * @ndev:	Pointer to net_device structure
+ * @slot:	Ring slot holding the frame in RX_DATA format
+ *
+ * Return: 1 when frame is passed to the network layer or dropped, 0 when system is out of
+ *	   free SKBs and slot must be processed later.
+ */
+static int ctucan_rx_dma(struct net_device *ndev, const __le32 *slot)
+{
+	struct ctucan_priv *priv = netdev_priv(ndev);
+	struct net_device_stats *stats = &ndev->stats;
+	struct canfd_frame *cf;
+	struct sk_buff *skb;
+	unsigned int len;
+	u32 ffw, idw;
+	u64 ts;
+
+	ffw = le32_to_cpu(slot[0]);
+	idw = le32_to_cpu(slot[1]);
+
+	/* Frame length is checked by RX buffer, ring slot is never shorter than a frame */
+	if (unlikely(FIELD_GET(REG_FRAME_FORMAT_W_RWCNT, ffw) < 3)) {
+		stats->rx_errors++;
+		return 1;
+	}
+
+	if (priv->rx_filter.sw_ena &&
+	    !ctucan_filter_match(&priv->rx_filter, ctucan_rx_frame_id(ffw, idw))) {
+		priv->rx_filter_dropped++;
+		return 1;
+	}
+
+	if (FIELD_GET(REG_FRAME_FORMAT_W_FDF, ffw))
+		skb = alloc_canfd_skb(ndev, &cf);
+	else
+		skb = alloc_can_skb(ndev, (struct can_frame **)&cf);
+
+	if (unlikely(!skb))
+		return 0;
+
+	/* Data words follow identifier and two timestamp words, bytes are in bus order */
+	len = ctucan_rx_frame_hdr(cf, ffw, idw);
+	memcpy(cf->data, &slot[4], round_up(len, 4));
+
+	ts = le32_to_cpu(slot[2]) | (u64)le32_to_cpu(slot[3]) << 32;
+	ctucan_rx_hwtstamp(priv, skb, ts);
 
 	stats->rx_bytes += cf->len;
 	stats->rx_packets++;
@@ -787,6 +1612,71 @@ static int ctucan_rx(struct net_device *ndev)
 	return 1;
 }
 
+/**
+ * ctucan_rx_dma_pending() - Checks whether RX DMA ring holds frames not processed by driver
+ * @priv:	Pointer to CTU CAN FD's private data
+ *
+ * Return: True if RX DMA produced slots beyond consumer index
+ */
+static bool ctucan_rx_dma_pending(struct ctucan_priv *priv)
+{
+	u32 status = ctucan_read32(priv, CTUCANFD_RX_DMA_STATUS);
+
+	return (FIELD_GET(REG_RX_DMA_STATUS_RDPROD, status) & (priv->rx_dma_slots - 1)) !=
+		priv->rx_dma_cons;
+}
+
+/**
+ * ctucan_rx_dma_poll() - Processes frames moved to RX DMA ring
+ * @ndev:	Pointer to net_device structure
+ * @quota:	Max number of frames to be processed
+ * @empty:	Set to true when all slots produced by RX DMA were processed
+ *
+ * Return: Number of processed slots
+ */
+static int ctucan_rx_dma_poll(struct net_device *ndev, int quota, bool *empty)
+{
+	struct ctucan_priv *priv = netdev_priv(ndev);
+	unsigned int mask = priv->rx_dma_slots - 1;
+	unsigned int cons = priv->rx_dma_cons;
+	unsigned int prod;
+	int work_done = 0;
+	u32 status;
+
+	status = ctucan_read32(priv, CTUCANFD_RX_DMA_STATUS);
+	prod = FIELD_GET(REG_RX_DMA_STATUS_RDPROD, status) & mask;
+
+	/* Slot contents must not be read before the producer index */
+	dma_rmb();
+
+	while (cons != prod && work_done < quota) {
+		if (!ctucan_rx_dma(ndev, priv->rx_dma_ring + cons * CTUCANFD_RX_DMA_SLOT_WORDS))
+			break;
+		cons = (cons + 1) & mask;
+		work_done++;
+	}
+
+	if (cons != priv->rx_dma_cons) {
+		priv->rx_dma_cons = cons;
+		ctucan_write32(priv, CTUCANFD_RX_DMA_CONS, cons);
+	}
+	*empty = (cons == prod);
+
+	/* RX DMA stops on bus error, the frame it was moving is lost. Once the ring is drained,
+	 * disable RX DMA and read the rest of RX FIFO via RX_DATA.
+	 */
+	if (unlikely(FIELD_GET(REG_RX_DMA_STATUS_RDBERR, status)) && *empty) {
+		netdev_err(ndev, "rx_dma: bus error, falling back to RX_DATA reads\n");
+		ndev->stats.rx_errors++;
+		ctucan_write32(priv, CTUCANFD_RX_DMA_CTRL, 0);
+		clear_bit(CTUCANFD_FLAG_RX_DMA, &priv->drv_flags);
+		ctucan_write32(priv, CTUCANFD_INT_ENA_CLR, REG_INT_STAT_DMAI);
+		ctucan_write32(priv, CTUCANFD_INT_ENA_SET, REG_INT_STAT_RBNEI);
+	}
+
+	return work_done;
+}
+
 /**
  * ctucan_read_fault_state() - Reads CTU CAN FDs fault confinement state.
  * @priv:	Pointer to private data
@@ -952,6 +1842,99 @@ static void ctucan_err_interrupt(struct net_device *ndev, u32 isr)
 	}
 }
 
+/**
+ * ctucan_rx_overflow() - Report frames lost due to RX FIFO overflow
+ * @ndev:	net_device pointer
+ * @count:	Number of lost frames
+ */
+static void ctucan_rx_overflow(struct net_device *ndev, u32 count)
+{
+	struct net_device_stats *stats = &ndev->stats;
+	struct can_frame *cf;
+	struct sk_buff *skb;
+
+	stats->rx_over_errors += count;
+	stats->rx_errors += count;
+	skb = alloc_can_err_skb(ndev, &cf);
+	if (skb) {
+		cf->can_id |= CAN_ERR_CRTL;
+		cf->data[1] |= CAN_ERR_CRTL_RX_OVERFLOW;
+		stats->rx_packets++;
+		stats->rx_bytes += cf->can_dlc;
+		netif_rx(skb);
+	}
+}
+
+/**
+ * ctucan_rx_prio_poll() - Processes frames from Priority RX buffer
+ * @ndev:	Pointer to net_device structure
+ * @quota:	Max number of frames to be processed
+ * @empty:	Set to false when frames are left in Priority RX buffer
+ *
+ * Priority RX buffer holds frames accepted by filters routed by rx_prio_route, it is drained
+ * before RX FIFO so these frames are not delayed by bulk traffic. A frame which can not get
+ * SKB is dropped, keeping it would block the buffer the same way as the bulk traffic.
+ *
+ * Return: Number of processed frames
+ */
+static int ctucan_rx_prio_poll(struct net_device *ndev, int quota, bool *empty)
+{
+	struct ctucan_priv *priv = netdev_priv(ndev);
+	struct net_device_stats *stats = &ndev->stats;
+	struct canfd_frame *cf;
+	struct sk_buff *skb;
+	int work_done = 0;
+	unsigned int i;
+	u32 status;
+	u32 ffw, idw;
+	u64 ts;
+
+	status = ctucan_read32(priv, CTUCANFD_RXP_STATUS);
+	while (FIELD_GET(REG_RXP_STATUS_RXPFRC, status) && work_done < quota) {
+		ffw = ctucan_read32(priv, CTUCANFD_RXP_DATA);
+		idw = ctucan_read32(priv, CTUCANFD_RXP_DATA);
+		work_done++;
+
+		if (priv->rx_filter.sw_ena &&
+		    !ctucan_filter_match(&priv->rx_filter, ctucan_rx_frame_id(ffw, idw))) {
+			priv->rx_filter_dropped++;
+			skb = NULL;
+		} else if (FIELD_GET(REG_FRAME_FORMAT_W_FDF, ffw)) {
+			skb = alloc_canfd_skb(ndev, &cf);
+			if (!skb)
+				stats->rx_dropped++;
+		} else {
+			skb = alloc_can_skb(ndev, (struct can_frame **)&cf);
+			if (!skb)
+				stats->rx_dropped++;
+		}
+
+		if (skb) {
+			ts = ctucan_read_rx_frame(priv, cf, ffw, idw, CTUCANFD_RXP_DATA);
+			ctucan_rx_hwtstamp(priv, skb, ts);
+			stats->rx_bytes += cf->len;
+			stats->rx_packets++;
+			netif_receive_skb(skb);
+		} else {
+			for (i = 1; i < FIELD_GET(REG_FRAME_FORMAT_W_RWCNT, ffw); i++)
+				ctucan_read32(priv, CTUCANFD_RXP_DATA);
+		}
+
+		status = ctucan_read32(priv, CTUCANFD_RXP_STATUS);
+	}
+
+	if (FIELD_GET(REG_RXP_STATUS_RXPDOR, status)) {
+		netdev_info(ndev, "rx_poll: priority rx buffer overflow\n");
+		ctucan_rx_overflow(ndev, 1);
+		ctucan_write32(priv, CTUCANFD_RXP_CTRL, priv->rx_prio_route | REG_RXP_CTRL_RPCDO);
+	}
+
+	if (FIELD_GET(REG_RXP_STATUS_RXPFRC, status))
+		*empty = false;
+
+	return work_done;
+}
+
 /**
  * ctucan_rx_poll() - Poll routine for rx packets (NAPI)
  * @napi:	NAPI structure pointer
@@ -968,48 +1951,76 @@ static int ctucan_rx_poll(struct napi_struct *napi, int quota)
 	int work_done = 0;
 	u32 status;
 	u32 framecnt;
+	u32 dropctr;
+	u32 irq_src = REG_INT_STAT_RBNEI;
+	bool empty = true;
+	bool prio_empty = true;
 	int res = 1;
 
-	framecnt = FIELD_GET(REG_RX_STATUS_RXFRC, ctucan_read32(priv, CTUCANFD_RX_STATUS));
-	while (framecnt && work_done < quota && res > 0) {
-		res = ctucan_rx(ndev);
-		work_done++;
+	if (test_bit(CTUCANFD_FLAG_RX_DMA, &priv->drv_flags)) {
+		irq_src = REG_INT_STAT_DMAI;
+		work_done = ctucan_rx_dma_poll(ndev, quota, &empty);
+	}
+
+	/* Also after RX DMA fell back to RX_DATA reads */
+	if (!test_bit(CTUCANFD_FLAG_RX_DMA, &priv->drv_flags)) {
+		if (priv->rx_prio_route)
+			work_done = ctucan_rx_prio_poll(ndev, quota, &prio_empty);
+
 		framecnt = FIELD_GET(REG_RX_STATUS_RXFRC, ctucan_read32(priv, CTUCANFD_RX_STATUS));
+		while (framecnt && work_done < quota && res > 0) {
+			res = ctucan_rx(ndev);
+			work_done++;
+			framecnt = FIELD_GET(REG_RX_STATUS_RXFRC,
+					     ctucan_read32(priv, CTUCANFD_RX_STATUS));
+		}
+		empty = !framecnt && res != 0;
+	} else if (priv->rx_prio_route && work_done < quota) {
+		work_done += ctucan_rx_prio_poll(ndev, quota - work_done, &prio_empty);
+	}
+
+	if (priv->rx_prio_route) {
+		irq_src |= REG_INT_STAT_RPNEI;
+		empty = empty && prio_empty;
 	}
 
 	/* Check for RX FIFO Overflow */
 	status = ctucan_read32(priv, CTUCANFD_STATUS);
 	if (FIELD_GET(REG_STATUS_DOR, status)) {
-		struct net_device_stats *stats = &ndev->stats;
-		struct can_frame *cf;
-		struct sk_buff *skb;
-
 		netdev_info(ndev, "rx_poll: rx fifo overflow\n");
-		stats->rx_over_errors++;
-		stats->rx_errors++;
-		skb = alloc_can_err_skb(ndev, &cf);
-		if (skb) {
-			cf->can_id |= CAN_ERR_CRTL;
-			cf->data[1] |= CAN_ERR_CRTL_RX_OVERFLOW;
-			stats->rx_packets++;
-			stats->rx_bytes += cf->can_dlc;
-			netif_rx(skb);
-		}
+		ctucan_rx_overflow(ndev, 1);
 
 		/* Clear Data Overrun */
 		ctucan_write32(priv, CTUCANFD_COMMAND, REG_COMMAND_CDO);
 	}
 
+	/* Oldest frames discarded by RX FIFO to make room for received ones */
+	if (test_bit(CTUCANFD_FLAG_RX_DROP_OLD, &priv->drv_flags)) {
+		dropctr = ctucan_read32(priv, CTUCANFD_RX_DROP_CTR);
+		if (dropctr != priv->rx_drop_ctr) {
+			ctucan_netdev_dbg(ndev, "rx_poll: %u oldest frames dropped\n",
+					  dropctr - priv->rx_drop_ctr);
+			ctucan_rx_overflow(ndev, dropctr - priv->rx_drop_ctr);
+			priv->rx_drop_ctr = dropctr;
+		}
+	}
+
 	if (work_done)
 		can_led_event(ndev, CAN_LED_EVENT_RX);
 
-	if (!framecnt && res != 0) {
+	if (empty) {
 		if (napi_complete_done(napi, work_done)) {
-			/* Clear and enable RBNEI. It is level-triggered, so
+			/* Clear and enable RBNEI (or DMAI). RBNEI is level-triggered, so
 			 * there is no race condition.
 			 */
-			ctucan_write32(priv, CTUCANFD_INT_STAT, REG_INT_STAT_RBNEI);
-			ctucan_write32(priv, CTUCANFD_INT_MASK_CLR, REG_INT_STAT_RBNEI);
+			ctucan_write32(priv, CTUCANFD_INT_STAT, irq_src);
+			ctucan_write32(priv, CTUCANFD_INT_MASK_CLR, irq_src);
+
+			/* DMAI is not, frames moved meanwhile would wait for the next batch */
+			if ((irq_src & REG_INT_STAT_DMAI) && ctucan_rx_dma_pending(priv)) {
+				ctucan_write32(priv, CTUCANFD_INT_MASK_SET, irq_src);
+				napi_schedule(napi);
+			}
 		}
 	}
 
@@ -1027,79 +2038,347 @@ static void ctucan_rotate_txb_prio(struct net_device *ndev)
 
 	prio = (prio << 4) | ((prio >> ((priv->ntxbufs - 1) * 4)) & 0xF);
 	ctucan_netdev_dbg(ndev, "%s: from 0x%08x to 0x%08x\n", __func__, priv->txb_prio, prio);
-	priv->txb_prio = prio;
-	ctucan_write32(priv, CTUCANFD_TX_PRIORITY, prio);
+	ctucan_write_txb_prio(priv, prio);
 }
 
 /**
- * ctucan_tx_interrupt() - Tx done Isr
+ * ctucan_txsched_complete() - Processes finished TXT buffers in length-aware TX scheduling
  * @ndev:	net_device pointer
+ *
+ * Unlike FIFO mode, buffers may finish in any order, so all used buffers are checked. Must be
+ * called with tx_lock held.
+ *
+ * Return: True if at least one buffer was processed
  */
-static void ctucan_tx_interrupt(struct net_device *ndev)
+static bool ctucan_txsched_complete(struct net_device *ndev)
 {
 	struct ctucan_priv *priv = netdev_priv(ndev);
 	struct net_device_stats *stats = &ndev->stats;
-	bool first = true;
-	bool some_buffers_processed;
-	unsigned long flags;
+	u32 tx_status = ctucan_read32(priv, CTUCANFD_TX_STATUS);
 	enum ctucan_txtb_status txtb_status;
-	u32 txtb_id;
-
-	/*  read tx_status
-	 *  if txb[n].finished (bit 2)
-	 *	if ok -> echo
-	 *	if error / aborted -> ?? (find how to handle oneshot mode)
-	 *	txb_tail++
-	 */
-	do {
-		spin_lock_irqsave(&priv->tx_lock, flags);
+	unsigned long used = priv->txb_used;
+	bool processed = false;
+	unsigned int i;
 
-		some_buffers_processed = false;
-		while ((int)(priv->txb_head - priv->txb_tail) > 0) {
-			txtb_id = priv->txb_tail % priv->ntxbufs;
-			txtb_status = ctucan_get_tx_status(priv, txtb_id);
+	for_each_set_bit(i, &used, priv->ntxbufs) {
+		txtb_status = (tx_status >> (i * 4)) & 0xf;
 
-			ctucan_netdev_dbg(ndev, "TXI: TXB#%u: status 0x%x\n", txtb_id, txtb_status);
+		ctucan_netdev_dbg(ndev, "TXI: TXB#%u: status 0x%x\n", i, txtb_status);
 
-			switch (txtb_status) {
-			case TXT_TOK:
-				ctucan_netdev_dbg(ndev, "TXT_OK\n");
+		switch (txtb_status) {
+		case TXT_TOK:
 #if LINUX_VERSION_CODE >= KERNEL_VERSION(5, 12, 0)
-				can_get_echo_skb(ndev, txtb_id, NULL);
+			can_get_echo_skb(ndev, i, NULL);
 #else /* < 5.12.0 */
-				can_get_echo_skb(ndev, txtb_id);
+			can_get_echo_skb(ndev, i);
 #endif /* < 5.12.0 */
-				stats->tx_packets++;
-				break;
-			case TXT_ERR:
-				/* This indicated that retransmit limit has been reached. Obviously
-				 * we should not echo the frame, but also not indicate any kind of
-				 * error. If desired, it was already reported (possible multiple
-				 * times) on each arbitration lost.
-				 */
-				netdev_warn(ndev, "TXB in Error state\n");
+			stats->tx_packets++;
+			break;
+		case TXT_ERR:
+		case TXT_ABT:
+			/* See ctucan_tx_interrupt for the reasoning */
+			netdev_warn(ndev, "TXB in %s state\n",
+				    txtb_status == TXT_ERR ? "Error" : "Aborted");
 #if LINUX_VERSION_CODE >= KERNEL_VERSION(5, 12, 0)
-				can_free_echo_skb(ndev, txtb_id, NULL);
+			can_free_echo_skb(ndev, i, NULL);
 #else /* < 5.12.0 */
-				can_free_echo_skb(ndev, txtb_id);
+			can_free_echo_skb(ndev, i);
 #endif /* < 5.12.0 */
-				stats->tx_dropped++;
-				break;
-			case TXT_ABT:
-				/* Same as for TXT_ERR, only with different cause. We *could*
-				 * re-queue the frame, but multiqueue/abort is not supported yet
-				 * anyway.
-				 */
-				netdev_warn(ndev, "TXB in Aborted state\n");
+			stats->tx_dropped++;
+			break;
+		default:
+			/* Not finished yet */
+			continue;
+		}
+
+		/* Release the buffer before it is marked as empty, see ctucan_start_xmit */
+		clear_bit(i, &priv->txb_used);
+		priv->txb_tail++;
+		processed = true;
+		ctucan_give_txtb_cmd(priv, TXT_CMD_SET_EMPTY, i);
+	}
+
+	if (processed)
+		ctucan_txsched_set_prio(priv);
+
+	return processed;
+}
+
+/**
+ * ctucan_tx_cpl_pending() - Checks whether TXT buffer holds a not yet processed frame
+ * @priv:	Pointer to private data
+ * @i:		TXT buffer index
+ *
+ * Return: True if the frame in the buffer was inserted and not processed yet
+ */
+static bool ctucan_tx_cpl_pending(struct ctucan_priv *priv, unsigned int i)
+{
+	if (test_bit(CTUCANFD_FLAG_TX_SCHED, &priv->drv_flags))
+		return test_bit(i, &priv->txb_used);
+
+	return (i + priv->ntxbufs - priv->txb_tail % priv->ntxbufs) % priv->ntxbufs <
+	       priv->txb_head - priv->txb_tail;
+}
+
+/**
+ * ctucan_tx_cpl_finish() - Echoes or drops frame of TXT buffer according to its final state
+ * @ndev:	net_device pointer
+ * @i:		TXT buffer index
+ */
+static void ctucan_tx_cpl_finish(struct net_device *ndev, unsigned int i)
+{
+	struct ctucan_priv *priv = netdev_priv(ndev);
+	struct net_device_stats *stats = &ndev->stats;
+
+	ctucan_netdev_dbg(ndev, "TXI: TXB#%u: record status 0x%x\n", i, priv->txb_cpl_st[i]);
+
+	if (priv->txb_cpl_st[i] == TXT_TOK) {
 #if LINUX_VERSION_CODE >= KERNEL_VERSION(5, 12, 0)
-				can_free_echo_skb(ndev, txtb_id, NULL);
+		can_get_echo_skb(ndev, i, NULL);
 #else /* < 5.12.0 */
-				can_free_echo_skb(ndev, txtb_id);
+		can_get_echo_skb(ndev, i);
 #endif /* < 5.12.0 */
-				stats->tx_dropped++;
-				break;
-			case TXT_NOT_EXIST:
-				/* "HW Bug?"" already reported so just advance tail */
+		stats->tx_packets++;
+	} else {
+		/* See ctucan_tx_interrupt for the reasoning */
+		netdev_warn(ndev, "TXB in %s state\n",
+			    priv->txb_cpl_st[i] == TXT_ERR ? "Error" : "Aborted");
+#if LINUX_VERSION_CODE >= KERNEL_VERSION(5, 12, 0)
+		can_free_echo_skb(ndev, i, NULL);
+#else /* < 5.12.0 */
+		can_free_echo_skb(ndev, i);
+#endif /* < 5.12.0 */
+		stats->tx_dropped++;
+	}
+
+	clear_bit(i, &priv->txb_cpl_done);
+	priv->txb_tail++;
+	if (test_bit(CTUCANFD_FLAG_TX_SCHED, &priv->drv_flags))
+		clear_bit(i, &priv->txb_used);
+	else
+		ctucan_rotate_txb_prio(ndev);
+	ctucan_give_txtb_cmd(priv, TXT_CMD_SET_EMPTY, i);
+}
+
+/**
+ * ctucan_tx_cpl_complete() - Processes finished TXT buffers reported by TX completion FIFO
+ * @ndev:	net_device pointer
+ * @processed:	Set to true if at least one buffer was processed
+ *
+ * Records are popped till the FIFO is empty, so TX_STATUS is not scanned. Records may come out
+ * of buffer order (all buffers fail at once in bus-off), so in the default mode the final state
+ * is kept till the buffer reaches the tail. Cyclic TXT buffer is left to ctucan_tx_cyc_complete.
+ *
+ * When records were lost, popped records are discarded and the caller falls back to TX_STATUS
+ * scan. Records of buffers processed by the scan may still follow, so they are checked against
+ * TX_STATUS till no frame is pending. Must be called with tx_lock held.
+ *
+ * Return: False if records were lost and TX_STATUS must be scanned, true otherwise
+ */
+static bool ctucan_tx_cpl_complete(struct net_device *ndev, bool *processed)
+{
+	struct ctucan_priv *priv = netdev_priv(ndev);
+	unsigned long done;
+	unsigned int i;
+	u8 status;
+	u32 reg;
+
+	*processed = false;
+
+	while ((reg = ctucan_read32(priv, CTUCANFD_TX_CPL)) & REG_TX_CPL_TCV) {
+		if (reg & REG_TX_CPL_TCOF) {
+			netdev_warn(ndev, "TX completion FIFO overflow, scanning TX_STATUS\n");
+			priv->tx_cpl_verify = true;
+			priv->txb_cpl_done = 0;
+			while (ctucan_read32(priv, CTUCANFD_TX_CPL) & REG_TX_CPL_TCV)
+				;
+			return false;
+		}
+
+		i = FIELD_GET(REG_TX_CPL_TCIDX, reg);
+		status = FIELD_GET(REG_TX_CPL_TCST, reg);
+		if (i >= priv->ntxbufs || !ctucan_tx_cpl_pending(priv, i))
+			continue;
+		if (priv->tx_cpl_verify && ctucan_get_tx_status(priv, i) != status)
+			continue;
+
+		priv->txb_cpl_st[i] = status;
+		set_bit(i, &priv->txb_cpl_done);
+	}
+
+	if (test_bit(CTUCANFD_FLAG_TX_SCHED, &priv->drv_flags)) {
+		done = priv->txb_cpl_done;
+		for_each_set_bit(i, &done, priv->ntxbufs) {
+			ctucan_tx_cpl_finish(ndev, i);
+			*processed = true;
+		}
+		if (*processed)
+			ctucan_txsched_set_prio(priv);
+	} else {
+		while ((int)(priv->txb_head - priv->txb_tail) > 0) {
+			i = priv->txb_tail % priv->ntxbufs;
+			if (!test_bit(i, &priv->txb_cpl_done))
+				break;
+			ctucan_tx_cpl_finish(ndev, i);
+			*processed = true;
+		}
+	}
+
+	if (priv->txb_head == priv->txb_tail)
+		priv->tx_cpl_verify = false;
+
+	return true;
+}
+
+/**
+ * ctucan_tx_fifo_complete() - Processes frames which left TXT FIFO
+ * @ndev:	net_device pointer
+ *
+ * Frames inserted but no longer counted by TFFL were either transmitted, or flushed if TXT FIFO
+ * is in Failed/Aborted state. Must be called with tx_lock held.
+ *
+ * Return: True if at least one frame was processed
+ */
+static bool ctucan_tx_fifo_complete(struct net_device *ndev)
+{
+	struct ctucan_priv *priv = netdev_priv(ndev);
+	struct net_device_stats *stats = &ndev->stats;
+	enum ctucan_txtb_status txtb_status;
+	unsigned int pending, fill, idx;
+	bool processed = false;
+	bool failed;
+
+	ctucan_write32(priv, CTUCANFD_INT_STAT, REG_INT_STAT_TXBHCI | REG_INT_STAT_TFTI);
+
+	/* Fill level first, so that a flush in between is never accounted as transmission */
+	fill = FIELD_GET(REG_TX_FIFO_CTRL_TFFL, ctucan_read32(priv, CTUCANFD_TX_FIFO_CTRL));
+	txtb_status = ctucan_get_tx_status(priv, priv->ntxbufs - 1);
+	failed = txtb_status == TXT_ERR || txtb_status == TXT_ABT;
+	pending = priv->txf_head - priv->txf_tail;
+
+	ctucan_netdev_dbg(ndev, "TXI: TXT FIFO: status 0x%x, fill %u, pending %u\n",
+			  txtb_status, fill, pending);
+
+	if (failed && pending > fill)
+		netdev_warn(ndev, "TXT FIFO in %s state, dropping %u frames\n",
+			    txtb_status == TXT_ERR ? "Error" : "Aborted", pending - fill);
+
+	while (pending > fill) {
+		idx = priv->txf_tail % priv->tx_fifo_depth;
+		if (failed) {
+#if LINUX_VERSION_CODE >= KERNEL_VERSION(5, 12, 0)
+			can_free_echo_skb(ndev, idx, NULL);
+#else /* < 5.12.0 */
+			can_free_echo_skb(ndev, idx);
+#endif /* < 5.12.0 */
+			stats->tx_dropped++;
+		} else {
+#if LINUX_VERSION_CODE >= KERNEL_VERSION(5, 12, 0)
+			can_get_echo_skb(ndev, idx, NULL);
+#else /* < 5.12.0 */
+			can_get_echo_skb(ndev, idx);
+#endif /* < 5.12.0 */
+			stats->tx_packets++;
+		}
+		priv->txf_tail++;
+		pending--;
+		processed = true;
+	}
+
+	/* Close to draining, report each remaining frame */
+	if (pending <= priv->tx_fifo_th)
+		ctucan_write32(priv, CTUCANFD_INT_MASK_CLR, REG_INT_STAT_TXBHCI);
+
+	return processed;
+}
+
+/**
+ * ctucan_tx_interrupt() - Tx done Isr
+ * @ndev:	net_device pointer
+ */
+static void ctucan_tx_interrupt(struct net_device *ndev)
+{
+	struct ctucan_priv *priv = netdev_priv(ndev);
+	struct net_device_stats *stats = &ndev->stats;
+	bool first = true;
+	bool some_buffers_processed;
+	bool cyc_processed;
+	unsigned long flags;
+	enum ctucan_txtb_status txtb_status;
+	u32 txtb_id;
+
+	/*  read tx_status
+	 *  if txb[n].finished (bit 2)
+	 *	if ok -> echo
+	 *	if error / aborted -> ?? (find how to handle oneshot mode)
+	 *	txb_tail++
+	 */
+	do {
+		spin_lock_irqsave(&priv->tx_lock, flags);
+
+		if (test_bit(CTUCANFD_FLAG_TX_FIFO, &priv->drv_flags)) {
+			some_buffers_processed = ctucan_tx_fifo_complete(ndev);
+			goto clear;
+		}
+
+		cyc_processed = ctucan_tx_cyc_complete(ndev);
+
+		if (priv->tx_cpl_sup && ctucan_tx_cpl_complete(ndev, &some_buffers_processed)) {
+			some_buffers_processed |= cyc_processed;
+			goto clear;
+		}
+
+		if (test_bit(CTUCANFD_FLAG_TX_SCHED, &priv->drv_flags)) {
+			some_buffers_processed = ctucan_txsched_complete(ndev) || cyc_processed;
+			goto clear;
+		}
+
+		some_buffers_processed = cyc_processed;
+		while ((int)(priv->txb_head - priv->txb_tail) > 0) {
+			txtb_id = priv->txb_tail % priv->ntxbufs;
+			txtb_status = ctucan_get_tx_status(priv, txtb_id);
+
+			ctucan_netdev_dbg(ndev, "TXI: TXB#%u: status 0x%x\n", txtb_id, txtb_status);
+
+			switch (txtb_status) {
+			case TXT_TOK:
+				ctucan_netdev_dbg(ndev, "TXT_OK\n");
+#if LINUX_VERSION_CODE >= KERNEL_VERSION(5, 12, 0)
+				can_get_echo_skb(ndev, txtb_id, NULL);
+#else /* < 5.12.0 */
+				can_get_echo_skb(ndev, txtb_id);
+#endif /* < 5.12.0 */
+				stats->tx_packets++;
+				break;
+			case TXT_ERR:
+				/* This indicated that retransmit limit has been reached. Obviously
+				 * we should not echo the frame, but also not indicate any kind of
+				 * error. If desired, it was already reported (possible multiple
+				 * times) on each arbitration lost.
+				 */
+				netdev_warn(ndev, "TXB in Error state\n");
+#if LINUX_VERSION_CODE >= KERNEL_VERSION(5, 12, 0)
+				can_free_echo_skb(ndev, txtb_id, NULL);
+#else /* < 5.12.0 */
+				can_free_echo_skb(ndev, txtb_id);
+#endif /* < 5.12.0 */
+				stats->tx_dropped++;
+				break;
+			case TXT_ABT:
+				/* Same as for TXT_ERR, only with different cause. We *could*
+				 * re-queue the frame, but multiqueue/abort is not supported yet
+				 * anyway.
+				 */
+				netdev_warn(ndev, "TXB in Aborted state\n");
+#if LINUX_VERSION_CODE >= KERNEL_VERSION(5, 12, 0)
+				can_free_echo_skb(ndev, txtb_id, NULL);
+#else /* < 5.12.0 */
+				can_free_echo_skb(ndev, txtb_id);
+#endif /* < 5.12.0 */
+				stats->tx_dropped++;
+				break;
+			case TXT_NOT_EXIST:
+				/* "HW Bug?"" already reported so just advance tail */
 				priv->txb_tail++;
 				goto clear;
 			default:
@@ -1143,12 +2422,53 @@ clear:
 	spin_lock_irqsave(&priv->tx_lock, flags);
 
 	/* Check if at least one TX buffer is free */
-	if (CTU_CAN_FD_TXTNF(priv))
+	if (test_bit(CTUCANFD_FLAG_TX_FIFO, &priv->drv_flags) ? CTU_CAN_FD_TXFNF(priv) :
+	    CTU_CAN_FD_TXTNF(priv))
 		netif_wake_queue(ndev);
 
 	spin_unlock_irqrestore(&priv->tx_lock, flags);
 }
 
+/**
+ * ctucan_irq_lat_account() - Accounts IRQ-to-service latency of pending interrupts
+ * @priv:	Pointer to private data
+ * @isr:	Value of INT_STAT register
+ *
+ * Called from ISR right after INT_STAT was read. See CTUCANFD_FLAG_IRQ_LAT.
+ */
+static void ctucan_irq_lat_account(struct ctucan_priv *priv, u32 isr)
+{
+	u32 freq = ctucan_ts_freq(priv);
+	unsigned long pending = isr;
+	unsigned int i;
+	u32 now;
+
+	/* Read of TIMESTAMP_LOW re-latches TIMESTAMP_HIGH, do not interleave with ctucan_ts_read() */
+	spin_lock(&priv->ptp_lock);
+	now = ctucan_read32(priv, CTUCANFD_TIMESTAMP_LOW);
+	spin_unlock(&priv->ptp_lock);
+
+	for_each_set_bit(i, &pending, CTUCANFD_INT_COUNT) {
+		struct ctucan_irq_lat *lat = &priv->irq_lat[i];
+		u32 ts, ns;
+		int b;
+
+		ctucan_write32(priv, CTUCANFD_INT_TS_SEL, FIELD_PREP(REG_INT_TS_SEL_ITSEL, i));
+		ts = ctucan_read32(priv, CTUCANFD_INT_TS);
+		if (ts == lat->last_ts)
+			continue;
+		lat->last_ts = ts;
+
+		/* Timestamp wraps in 32 bits, latency is always shorter */
+		ns = min_t(u64, div_u64((u64)(now - ts) * NSEC_PER_SEC, freq), U32_MAX);
+		b = clamp_t(int, fls(ns) - 7, 0, CTUCANFD_IRQ_LAT_BUCKETS - 1);
+		lat->hist[b]++;
+		lat->sum_ns += ns;
+		lat->max_ns = max(lat->max_ns, ns);
+		lat->count++;
+	}
+}
+
 /**
  * ctucan_interrupt() - CAN Isr
  * @irq:	irq number
@@ -1177,6 +2497,9 @@ static irqreturn_t ctucan_interrupt(int irq, void *dev_id)
 		if (!isr)
 			return irq_loops ? IRQ_HANDLED : IRQ_NONE;
 
+		if (test_bit(CTUCANFD_FLAG_IRQ_LAT, &priv->drv_flags))
+			ctucan_irq_lat_account(priv, isr);
+
 		/* Receive Buffer Not Empty Interrupt */
 		if (FIELD_GET(REG_INT_STAT_RBNEI, isr)) {
 			ctucan_netdev_dbg(ndev, "RXBNEI\n");
@@ -1189,9 +2512,27 @@ static irqreturn_t ctucan_interrupt(int irq, void *dev_id)
 			napi_schedule(&priv->napi);
 		}
 
-		/* TXT Buffer HW Command Interrupt */
-		if (FIELD_GET(REG_INT_STAT_TXBHCI, isr)) {
-			ctucan_netdev_dbg(ndev, "TXBHCI\n");
+		/* Priority RX Buffer Not Empty Interrupt, handled the same way as RBNEI */
+		if (FIELD_GET(REG_INT_STAT_RPNEI, isr)) {
+			ctucan_netdev_dbg(ndev, "RPNEI\n");
+			icr = REG_INT_STAT_RPNEI;
+			ctucan_write32(priv, CTUCANFD_INT_MASK_SET, icr);
+			ctucan_write32(priv, CTUCANFD_INT_STAT, icr);
+			napi_schedule(&priv->napi);
+		}
+
+		/* RX DMA Interrupt, handled the same way as RBNEI */
+		if (FIELD_GET(REG_INT_STAT_DMAI, isr)) {
+			ctucan_netdev_dbg(ndev, "DMAI\n");
+			icr = REG_INT_STAT_DMAI;
+			ctucan_write32(priv, CTUCANFD_INT_MASK_SET, icr);
+			ctucan_write32(priv, CTUCANFD_INT_STAT, icr);
+			napi_schedule(&priv->napi);
+		}
+
+		/* TXT Buffer HW Command Interrupt, TXT FIFO Threshold Interrupt */
+		if (FIELD_GET(REG_INT_STAT_TXBHCI, isr) || FIELD_GET(REG_INT_STAT_TFTI, isr)) {
+			ctucan_netdev_dbg(ndev, "TXBHCI/TFTI\n");
 			/* Cleared inside */
 			ctucan_tx_interrupt(ndev);
 		}
@@ -1248,6 +2589,10 @@ static void ctucan_chip_stop(struct net_device *ndev)
 	/* Disable interrupts and disable CAN */
 	ctucan_write32(priv, CTUCANFD_INT_ENA_CLR, mask);
 	ctucan_write32(priv, CTUCANFD_INT_MASK_SET, mask);
+	if (test_and_clear_bit(CTUCANFD_FLAG_RX_DMA, &priv->drv_flags))
+		ctucan_write32(priv, CTUCANFD_RX_DMA_CTRL, 0);
+	if (test_and_clear_bit(CTUCANFD_FLAG_TX_CYC, &priv->drv_flags))
+		ctucan_give_txtb_cmd(priv, TXT_CMD_SET_ABORT, priv->txb_count - 1);
 	mode = ctucan_read32(priv, CTUCANFD_MODE);
 	mode &= ~REG_MODE_ENA;
 	ctucan_write32(priv, CTUCANFD_MODE, mode);
@@ -1255,6 +2600,129 @@ static void ctucan_chip_stop(struct net_device *ndev)
 	priv->can.state = CAN_STATE_STOPPED;
 }
 
+/**
+ * ctucan_rx_dma_alloc() - Allocates RX DMA ring if requested by rx_dma sysfs attribute
+ * @ndev:	Pointer to net_device structure
+ *
+ * Failure is not fatal, frames are read via RX_DATA when ring is not allocated.
+ */
+static void ctucan_rx_dma_alloc(struct net_device *ndev)
+{
+	struct ctucan_priv *priv = netdev_priv(ndev);
+	unsigned int rs = priv->cfg.rx_dma;
+	size_t size;
+
+	if (!rs || !priv->rx_dma_sup)
+		return;
+
+	/* RX DMA has 32 bit address */
+	if (dma_set_mask_and_coherent(priv->dev, DMA_BIT_MASK(32))) {
+		netdev_warn(ndev, "rx_dma: no 32 bit DMA, using RX_DATA reads\n");
+		return;
+	}
+
+	priv->rx_dma_slots = 1 << rs;
+	size = priv->rx_dma_slots * CTUCANFD_RX_DMA_SLOT_WORDS * sizeof(u32);
+	priv->rx_dma_ring = dma_alloc_coherent(priv->dev, size, &priv->rx_dma_addr, GFP_KERNEL);
+	if (!priv->rx_dma_ring) {
+		netdev_warn(ndev, "rx_dma: ring allocation failed, using RX_DATA reads\n");
+		return;
+	}
+
+	/* Coherent allocations are page aligned, slot alignment is 128 bytes */
+	WARN_ON(priv->rx_dma_addr & ~REG_RX_DMA_BASE_RDBASE);
+}
+
+/**
+ * ctucan_rx_dma_free() - Frees RX DMA ring
+ * @ndev:	Pointer to net_device structure
+ *
+ * RX DMA must be stopped (controller disabled) before the ring is freed.
+ */
+static void ctucan_rx_dma_free(struct net_device *ndev)
+{
+	struct ctucan_priv *priv = netdev_priv(ndev);
+
+	if (!priv->rx_dma_ring)
+		return;
+
+	dma_free_coherent(priv->dev, priv->rx_dma_slots * CTUCANFD_RX_DMA_SLOT_WORDS * sizeof(u32),
+			  priv->rx_dma_ring, priv->rx_dma_addr);
+	priv->rx_dma_ring = NULL;
+}
+
+static const char * const ctucan_int_names[CTUCANFD_INT_COUNT] = {
+	"RXI", "TXI", "EWLI", "DOI", "FCSI", "ALI", "BEI", "OFI",
+	"RXFI", "BSI", "RBNEI", "TXBHCI", "DMAI", "TFTI",
+	"RXPI", "RPNEI"
+};
+
+static int ctucan_irq_lat_show(struct seq_file *m, void *v)
+{
+	struct ctucan_priv *priv = m->private;
+	unsigned int i, b;
+
+	seq_printf(m, "%-7s %10s %10s %10s", "source", "count", "avg_ns", "max_ns");
+	for (b = 0; b < CTUCANFD_IRQ_LAT_BUCKETS - 1; b++)
+		seq_printf(m, " <%-8u", 128U << b);
+	seq_printf(m, " >=%u\n", 128U << (CTUCANFD_IRQ_LAT_BUCKETS - 2));
+
+	for (i = 0; i < CTUCANFD_INT_COUNT; i++) {
+		const struct ctucan_irq_lat *lat = &priv->irq_lat[i];
+
+		if (!lat->count)
+			continue;
+
+		seq_printf(m, "%-7s %10llu %10llu %10u", ctucan_int_names[i], lat->count,
+			   div64_u64(lat->sum_ns, lat->count), lat->max_ns);
+		for (b = 0; b < CTUCANFD_IRQ_LAT_BUCKETS; b++)
+			seq_printf(m, " %9u", lat->hist[b]);
+		seq_puts(m, "\n");
+	}
+
+	return 0;
+}
+DEFINE_SHOW_ATTRIBUTE(ctucan_irq_lat);
+
+/**
+ * ctucan_irq_lat_start() - Resets IRQ latency statistics and exports them in debugfs
+ * @ndev:	Pointer to net_device structure
+ *
+ * Statistics are kept while the interface is up.
+ */
+static void ctucan_irq_lat_start(struct net_device *ndev)
+{
+	struct ctucan_priv *priv = netdev_priv(ndev);
+	char name[IFNAMSIZ + 9];
+
+	if (!priv->cfg.irq_lat || !priv->irq_lat_sup) {
+		clear_bit(CTUCANFD_FLAG_IRQ_LAT, &priv->drv_flags);
+		return;
+	}
+
+	memset(priv->irq_lat, 0, sizeof(priv->irq_lat));
+	set_bit(CTUCANFD_FLAG_IRQ_LAT, &priv->drv_flags);
+
+	snprintf(name, sizeof(name), "ctucanfd-%s", netdev_name(ndev));
+	priv->debugfs_dir = debugfs_create_dir(name, NULL);
+	debugfs_create_file("irq_latency", 0444, priv->debugfs_dir, priv, &ctucan_irq_lat_fops);
+}
+
+/**
+ * ctucan_irq_lat_stop() - Removes IRQ latency statistics from debugfs
+ * @ndev:	Pointer to net_device structure
+ *
+ * Interrupt handler must not be installed anymore.
+ */
+static void ctucan_irq_lat_stop(struct net_device *ndev)
+{
+	struct ctucan_priv *priv = netdev_priv(ndev);
+
+	clear_bit(CTUCANFD_FLAG_IRQ_LAT, &priv->drv_flags);
+	debugfs_remove_recursive(priv->debugfs_dir);
+	priv->debugfs_dir = NULL;
+}
+
 /**
  * ctucan_open() - Driver open routine
  * @ndev:	Pointer to net_device structure
@@ -1288,6 +2756,14 @@ static int ctucan_open(struct net_device *ndev)
 		goto err_open;
 	}
 
+	/* Interrupts are not enabled yet, so calibration does not interfere with handlers */
+	ret = ctucan_ssp_calibrate(ndev);
+	if (ret < 0)
+		netdev_warn(ndev, "SSP calibration failed (%d), using default SSP\n", ret);
+
+	ctucan_rx_dma_alloc(ndev);
+	ctucan_irq_lat_start(ndev);
+
 	ret = request_irq(ndev->irq, ctucan_interrupt, priv->irq_flags, ndev->name, ndev);
 	if (ret < 0) {
 		netdev_err(ndev, "irq allocation for CAN failed\n");
@@ -1310,6 +2786,8 @@ static int ctucan_open(struct net_device *ndev)
 err_chip_start:
 	free_irq(ndev->irq, ndev);
 err_irq:
+	ctucan_irq_lat_stop(ndev);
+	ctucan_rx_dma_free(ndev);
 	close_candev(ndev);
 err_open:
 err_reset:
@@ -1334,6 +2812,8 @@ static int ctucan_close(struct net_device *ndev)
 	napi_disable(&priv->napi);
 	ctucan_chip_stop(ndev);
 	free_irq(ndev->irq, ndev);
+	ctucan_irq_lat_stop(ndev);
+	ctucan_rx_dma_free(ndev);
 	close_candev(ndev);
 
 	can_led_event(ndev, CAN_LED_EVENT_STOP);
@@ -1370,6 +2850,427 @@ static int ctucan_get_berr_counter(const struct net_device *ndev, struct can_ber
 	return 0;
 }
 
+/**
+ * rx_filter_show() - Shows RX acceptance filter rules
+ * @dev:	Network device
+ * @attr:	Device attribute
+ * @buf:	Output buffer
+ *
+ * Rules are printed one per line in candump format, "<can_id>:<can_mask>" or
+ * "<can_id>~<can_mask>" for inverted rules.
+ *
+ * Return: Number of bytes written
+ */
+static ssize_t rx_filter_show(struct device *dev, struct device_attribute *attr, char *buf)
+{
+	struct ctucan_priv *priv = netdev_priv(to_net_dev(dev));
+	const struct ctucan_filter *f = &priv->rx_filter;
+	const struct can_filter *rule;
+	ssize_t len = 0;
+	unsigned int i;
+
+	for (i = 0; i < f->n_rules; i++) {
+		rule = &f->rules[i];
+		len += scnprintf(buf + len, PAGE_SIZE - len, "%08x%c%08x\n",
+				 rule->can_id & ~CAN_INV_FILTER,
+				 (rule->can_id & CAN_INV_FILTER) ? '~' : ':', rule->can_mask);
+	}
+
+	return len;
+}
+
+/**
+ * rx_filter_store() - Sets RX acceptance filter rules
+ * @dev:	Network device
+ * @attr:	Device attribute
+ * @buf:	Rules in candump format (hex values), separated by white space or commas.
+ *		Empty string accepts all frames.
+ * @count:	Length of @buf
+ *
+ * Rules are compiled to configuration of hardware filters, frames the hardware filters can not
+ * reject are dropped by software filter in RX path. Filters are applied on interface open.
+ *
+ * Return: @count on success, -%EBUSY if interface is up, -%EINVAL on malformed input
+ */
+static ssize_t rx_filter_store(struct device *dev, struct device_attribute *attr,
+			       const char *buf, size_t count)
+{
+	struct net_device *ndev = to_net_dev(dev);
+	struct ctucan_priv *priv = netdev_priv(ndev);
+	struct can_filter rules[CTUCANFD_FILTER_MAX_RULES];
+	unsigned int n_rules = 0;
+	const char *p = buf;
+	char sep;
+	int len;
+	int ret;
+
+	if (netif_running(ndev))
+		return -EBUSY;
+
+	for (;;) {
+		while (*p == ',' || isspace(*p))
+			p++;
+		if (!*p)
+			break;
+		if (n_rules == CTUCANFD_FILTER_MAX_RULES)
+			return -EINVAL;
+		if (sscanf(p, "%x%c%x%n", &rules[n_rules].can_id, &sep,
+			   &rules[n_rules].can_mask, &len) != 3)
+			return -EINVAL;
+		if (sep == '~')
+			rules[n_rules].can_id |= CAN_INV_FILTER;
+		else if (sep != ':')
+			return -EINVAL;
+		n_rules++;
+		p += len;
+	}
+
+	ret = ctucan_filter_compile(&priv->rx_filter, rules, n_rules, priv->rx_filter_mask_sup,
+				    priv->rx_filter_range_sup);
+	if (ret)
+		return ret;
+
+	return count;
+}
+static DEVICE_ATTR_RW(rx_filter);
+
+/**
+ * rx_filter_dropped_show() - Shows number of frames dropped by software RX filter
+ * @dev:	Network device
+ * @attr:	Device attribute
+ * @buf:	Output buffer
+ *
+ * Return: Number of bytes written
+ */
+static ssize_t rx_filter_dropped_show(struct device *dev, struct device_attribute *attr,
+				      char *buf)
+{
+	struct ctucan_priv *priv = netdev_priv(to_net_dev(dev));
+
+	return scnprintf(buf, PAGE_SIZE, "%lu\n", priv->rx_filter_dropped);
+}
+static DEVICE_ATTR_RO(rx_filter_dropped);
+
+/**
+ * rx_prio_route_show() - Shows filters routed to Priority RX buffer
+ * @dev:	Network device
+ * @attr:	Device attribute
+ * @buf:	Output buffer
+ *
+ * Return: Number of bytes written, -EOPNOTSUPP if Priority RX buffer is not synthesized
+ */
+static ssize_t rx_prio_route_show(struct device *dev, struct device_attribute *attr, char *buf)
+{
+	struct ctucan_priv *priv = netdev_priv(to_net_dev(dev));
+
+	if (!priv->rx_prio_sup)
+		return -EOPNOTSUPP;
+
+	return scnprintf(buf, PAGE_SIZE, "0x%02x\n", priv->rx_prio_route);
+}
+
+/**
+ * rx_prio_route_store() - Selects filters routed to Priority RX buffer
+ * @dev:	Network device
+ * @attr:	Device attribute
+ * @buf:	Bit mask of hardware filters as in RXP_CTRL, bit 0 filter A, 1 filter B,
+ *		2 filter C, 3 range filter, 4 ID set filter. 0 disables routing.
+ * @count:	Length of @buf
+ *
+ * Frames accepted by a routed filter are read from Priority RX buffer before RX FIFO. Routing
+ * needs hardware filtering, see rx_filter. Routing is applied on interface open.
+ *
+ * Return: @count on success, -%EBUSY if interface is up, -%EINVAL on malformed input,
+ *	   -%EOPNOTSUPP if Priority RX buffer is not synthesized
+ */
+static ssize_t rx_prio_route_store(struct device *dev, struct device_attribute *attr,
+				   const char *buf, size_t count)
+{
+	struct net_device *ndev = to_net_dev(dev);
+	struct ctucan_priv *priv = netdev_priv(ndev);
+	u32 route;
+
+	if (!priv->rx_prio_sup)
+		return -EOPNOTSUPP;
+	if (netif_running(ndev))
+		return -EBUSY;
+	if (kstrtou32(buf, 0, &route) ||
+	    route & ~(REG_RXP_CTRL_RPRA | REG_RXP_CTRL_RPRB | REG_RXP_CTRL_RPRC |
+		      REG_RXP_CTRL_RPRR | REG_RXP_CTRL_RPRS))
+		return -EINVAL;
+
+	priv->rx_prio_route = route;
+
+	return count;
+}
+static DEVICE_ATTR_RW(rx_prio_route);
+
+/**
+ * tx_cyclic_show() - Shows cyclic transmission configuration
+ * @dev:	Network device
+ * @attr:	Device attribute
+ * @buf:	Output buffer
+ *
+ * Configuration is printed as "<period_us> <can_id>#<data>", or "0" when disabled. While
+ * cyclic transmission runs, number of skipped slots follows on the next line.
+ *
+ * Return: Number of bytes written, -EOPNOTSUPP if cyclic transmission is not synthesized or
+ *	   TXT FIFO is synthesized
+ */
+static ssize_t tx_cyclic_show(struct device *dev, struct device_attribute *attr, char *buf)
+{
+	struct ctucan_priv *priv = netdev_priv(to_net_dev(dev));
+	const struct canfd_frame *cf = &priv->tx_cyc_frame;
+	u8 txb = priv->txb_count - 1;
+	ssize_t len;
+	u32 reg;
+
+	if (!priv->tx_cyc_sup)
+		return -EOPNOTSUPP;
+
+	if (!priv->tx_cyc_period_us)
+		return scnprintf(buf, PAGE_SIZE, "0\n");
+
+	len = scnprintf(buf, PAGE_SIZE, (cf->can_id & CAN_EFF_FLAG) ? "%u %08x#%*phN\n" :
+			"%u %03x#%*phN\n", priv->tx_cyc_period_us, cf->can_id & CAN_EFF_MASK,
+			cf->len, cf->data);
+
+	if (test_bit(CTUCANFD_FLAG_TX_CYC, &priv->drv_flags)) {
+		ctucan_write32(priv, CTUCANFD_TXT_CYC_SEL, FIELD_PREP(REG_TXT_CYC_SEL_TCSEL, txb));
+		reg = FIELD_GET(REG_TXT_CYC_SEL_TCSKIP, ctucan_read32(priv, CTUCANFD_TXT_CYC_SEL));
+		len += scnprintf(buf + len, PAGE_SIZE - len, "skipped: %u\n", reg);
+	}
+
+	return len;
+}
+
+/**
+ * tx_cyclic_store() - Sets cyclic transmission
+ * @dev:	Network device
+ * @attr:	Device attribute
+ * @buf:	"<period_us> <can_id>#<data>" with hexadecimal identifier and up to 8 data bytes,
+ *		identifier with more than 3 digits is extended. "0" disables cyclic transmission.
+ * @count:	Length of @buf
+ *
+ * The last TXT buffer transmits the frame each @period_us microseconds (in timestamp time
+ * base) since the interface is opened. Applied on interface open.
+ *
+ * Return: @count on success, -%EBUSY if interface is up, -%EINVAL on malformed input,
+ *	   -%EOPNOTSUPP if cyclic transmission is not synthesized or TXT FIFO is synthesized
+ */
+static ssize_t tx_cyclic_store(struct device *dev, struct device_attribute *attr,
+			       const char *buf, size_t count)
+{
+	struct net_device *ndev = to_net_dev(dev);
+	struct ctucan_priv *priv = netdev_priv(ndev);
+	struct canfd_frame cf = {};
+	unsigned int period;
+	int id_start, id_end;
+	size_t dlen;
+
+	if (!priv->tx_cyc_sup)
+		return -EOPNOTSUPP;
+
+	if (netif_running(ndev))
+		return -EBUSY;
+
+	id_start = 0;
+	id_end = 0;
+	if (sscanf(buf, "%u %n%x%n", &period, &id_start, &cf.can_id, &id_end) < 1)
+		return -EINVAL;
+
+	if (!period) {
+		priv->tx_cyc_period_us = 0;
+		return count;
+	}
+
+	if (!id_end || buf[id_end] != '#')
+		return -EINVAL;
+
+	if (id_end - id_start > 3) {
+		if (cf.can_id > CAN_EFF_MASK)
+			return -EINVAL;
+		cf.can_id |= CAN_EFF_FLAG;
+	} else if (cf.can_id > CAN_SFF_MASK) {
+		return -EINVAL;
+	}
+
+	buf += id_end + 1;
+	dlen = strcspn(buf, " \t\n");
+	if (dlen % 2 || dlen / 2 > CAN_MAX_DLEN)
+		return -EINVAL;
+	cf.len = dlen / 2;
+	if (hex2bin(cf.data, buf, cf.len))
+		return -EINVAL;
+
+	priv->tx_cyc_frame = cf;
+	priv->tx_cyc_period_us = period;
+
+	return count;
+}
+static DEVICE_ATTR_RW(tx_cyclic);
+
+static const char * const ctucan_bus_stat_names[] = {
+	"busy_bits", "idle_bits", "error_frames", "overload_frames", "stuff_bits"
+};
+
+/**
+ * bus_stat_show() - Takes snapshot of bus statistics counters and shows it
+ * @dev:	Network device
+ * @attr:	Device attribute
+ * @buf:	Output buffer
+ *
+ * Counters are cleared by the snapshot, so each read shows statistics since the
+ * previous read. Bus load is ratio of busy bits to all counted bits in per mille.
+ *
+ * Return: Number of bytes written, -EOPNOTSUPP if counters are not synthesized
+ */
+static ssize_t bus_stat_show(struct device *dev, struct device_attribute *attr,
+			     char *buf)
+{
+	struct ctucan_priv *priv = netdev_priv(to_net_dev(dev));
+	u32 val[ARRAY_SIZE(ctucan_bus_stat_names)];
+	u64 total;
+	ssize_t len = 0;
+	unsigned int i;
+
+	if (!priv->bus_stat_sup)
+		return -EOPNOTSUPP;
+
+	mutex_lock(&priv->bus_stat_lock);
+	ctucan_write32(priv, CTUCANFD_COMMAND, REG_COMMAND_BSSNAP);
+	for (i = 0; i < ARRAY_SIZE(val); i++) {
+		ctucan_write32(priv, CTUCANFD_BUS_STAT_SEL,
+			       FIELD_PREP(REG_BUS_STAT_SEL_BSSEL, i));
+		val[i] = FIELD_GET(REG_BUS_STAT_BS_VAL,
+				   ctucan_read32(priv, CTUCANFD_BUS_STAT));
+	}
+	mutex_unlock(&priv->bus_stat_lock);
+
+	for (i = 0; i < ARRAY_SIZE(val); i++)
+		len += scnprintf(buf + len, PAGE_SIZE - len, "%s: %u\n",
+				 ctucan_bus_stat_names[i], val[i]);
+
+	total = (u64)val[0] + val[1];
+	len += scnprintf(buf + len, PAGE_SIZE - len, "load_permille: %u\n",
+			 total ? (u32)div64_u64((u64)val[0] * 1000, total) : 0);
+
+	return len;
+}
+static DEVICE_ATTR_RO(bus_stat);
+
+/**
+ * ctucan_open_cfg_store() - Sets a setting applied on interface open
+ * @dev:	Network device
+ * @buf:	Decimal or hexadecimal value
+ * @count:	Length of @buf
+ * @val:	Setting in priv->cfg
+ * @min:	Minimal value
+ * @max:	Maximal value
+ * @sup:	Feature is synthesized, otherwise only 0 is accepted
+ *
+ * Setting is changed under rtnl_lock, so that it does not race with ndo_open which reads it.
+ *
+ * Return: @count on success, -%EBUSY if interface is up, -%EINVAL on malformed input or value
+ *	   out of range, -%EOPNOTSUPP on non-zero value of feature which is not synthesized
+ */
+static ssize_t ctucan_open_cfg_store(struct device *dev, const char *buf, size_t count,
+				     u32 *val, u32 min, u32 max, bool sup)
+{
+	u32 v;
+	ssize_t ret = count;
+
+	if (kstrtou32(buf, 0, &v) || v < min || v > max)
+		return -EINVAL;
+	if (v && !sup)
+		return -EOPNOTSUPP;
+
+	if (!rtnl_trylock())
+		return restart_syscall();
+
+	if (netif_running(to_net_dev(dev)))
+		ret = -EBUSY;
+	else
+		*val = v;
+
+	rtnl_unlock();
+
+	return ret;
+}
+
+#define CTUCAN_OPEN_CFG_ATTR(_name, _min, _max, _sup)						\
+static ssize_t _name##_show(struct device *dev, struct device_attribute *attr, char *buf)	\
+{												\
+	struct ctucan_priv *priv = netdev_priv(to_net_dev(dev));				\
+												\
+	return scnprintf(buf, PAGE_SIZE, "%u\n", priv->cfg._name);				\
+}												\
+												\
+static ssize_t _name##_store(struct device *dev, struct device_attribute *attr,			\
+			     const char *buf, size_t count)					\
+{												\
+	struct ctucan_priv *priv = netdev_priv(to_net_dev(dev));				\
+												\
+	return ctucan_open_cfg_store(dev, buf, count, &priv->cfg._name, _min, _max, _sup);	\
+}												\
+static DEVICE_ATTR_RW(_name)
+
+/* Number of CAN FD frames sent in self-test mode to measure transceiver delay and calibrate
+ * secondary sample point, see ctucan_ssp_calibrate(). 0 - no calibration, at most 16 frames so
+ * that interface open is not delayed by more than ~320 ms.
+ */
+CTUCAN_OPEN_CFG_ATTR(ssp_autocal, 0, CTUCANFD_SSP_AUTOCAL_MAX, true);
+
+/* TXT buffer scheduling. 0 - FIFO with rotating priorities, 1 - length-aware, keeps all TXT
+ * buffers filled and preserves order per CAN ID, see CTUCANFD_FLAG_TX_SCHED.
+ */
+CTUCAN_OPEN_CFG_ATTR(tx_sched, 0, 1, true);
+
+/* RX FIFO overflow policy. 0 - received frame is discarded, 1 - oldest stored frames are
+ * discarded to make room for received frame.
+ */
+CTUCAN_OPEN_CFG_ATTR(rx_drop_oldest, 0, 1, true);
+
+/* Log2 of number of slots of RX DMA ring. 0 - frames are read from RX_DATA. */
+CTUCAN_OPEN_CFG_ATTR(rx_dma, 0, CTUCANFD_RX_DMA_RS_MAX, priv->rx_dma_sup);
+
+/* Number of frames moved by RX DMA per interrupt. */
+CTUCAN_OPEN_CFG_ATTR(rx_dma_batch, 1, 255, priv->rx_dma_sup);
+
+/* Transmit all frames via TXT FIFO, takes precedence over tx_sched. 0 - TXT buffers are used. */
+CTUCAN_OPEN_CFG_ATTR(tx_fifo, 0, 1, priv->tx_fifo_depth);
+
+/* Measure IRQ-to-service latency of each interrupt source. Histograms are in debugfs
+ * ctucanfd-<interface>/irq_latency while the interface is up.
+ */
+CTUCAN_OPEN_CFG_ATTR(irq_lat, 0, 1, priv->irq_lat_sup);
+
+/* Frequency of timestamp input of the core in Hz, used when the timestamp does not count
+ * nanoseconds. 0 - same as core clock.
+ */
+CTUCAN_OPEN_CFG_ATTR(ts_freq, 0, U32_MAX, true);
+
+static struct attribute *ctucan_sysfs_attrs[] = {
+	&dev_attr_rx_filter.attr,
+	&dev_attr_rx_filter_dropped.attr,
+	&dev_attr_rx_prio_route.attr,
+	&dev_attr_tx_cyclic.attr,
+	&dev_attr_bus_stat.attr,
+	&dev_attr_ssp_autocal.attr,
+	&dev_attr_tx_sched.attr,
+	&dev_attr_rx_drop_oldest.attr,
+	&dev_attr_rx_dma.attr,
+	&dev_attr_rx_dma_batch.attr,
+	&dev_attr_tx_fifo.attr,
+	&dev_attr_irq_lat.attr,
+	&dev_attr_ts_freq.attr,
+	NULL
+};
+
+static const struct attribute_group ctucan_sysfs_group = {
+	.attrs = ctucan_sysfs_attrs,
+};
+
 static const struct net_device_ops ctucan_netdev_ops = {
 	.ndo_open	= ctucan_open,
 	.ndo_stop	= ctucan_close,
@@ -1377,6 +3278,173 @@ static const struct net_device_ops ctucan_netdev_ops = {
 	.ndo_change_mtu	= can_change_mtu,
 };
 
+/**
+ * ctucan_get_ts_info() - Reports timestamping capabilities
+ * @ndev:	Pointer to net_device structure
+ * @info:	Timestamping capabilities
+ *
+ * Hardware RX timestamps are reported only when the timestamp generator counts nanoseconds.
+ *
+ * Return: 0 always
+ */
+static int ctucan_get_ts_info(struct net_device *ndev, struct ethtool_ts_info *info)
+{
+	struct ctucan_priv *priv = netdev_priv(ndev);
+
+	info->so_timestamping = SOF_TIMESTAMPING_TX_SOFTWARE |
+				SOF_TIMESTAMPING_RX_SOFTWARE |
+				SOF_TIMESTAMPING_SOFTWARE;
+
+	/* Received frames carry SOF timestamp of the PHC */
+	if (priv->ts_inc_nom) {
+		info->so_timestamping |= SOF_TIMESTAMPING_RX_HARDWARE |
+					 SOF_TIMESTAMPING_RAW_HARDWARE;
+		info->tx_types = BIT(HWTSTAMP_TX_OFF);
+		info->rx_filters = BIT(HWTSTAMP_FILTER_ALL);
+	}
+	info->phc_index = priv->ptp_clock ? ptp_clock_index(priv->ptp_clock) : -1;
+
+	return 0;
+}
+
+static const struct ethtool_ops ctucan_ethtool_ops = {
+	.get_ts_info	= ctucan_get_ts_info,
+};
+
+/**
+ * ctucan_ptp_adjfine() - Adjusts frequency of timestamp generator
+ * @ptp:	PTP clock info
+ * @scaled_ppm:	Frequency offset from nominal, in ppm with 16-bit fractional part
+ *
+ * Return: 0 always
+ */
+static int ctucan_ptp_adjfine(struct ptp_clock_info *ptp, long scaled_ppm)
+{
+	struct ctucan_priv *priv = container_of(ptp, struct ctucan_priv, ptp_info);
+	u64 inc = adjust_by_scaled_ppm(priv->ts_inc_nom, scaled_ppm);
+	unsigned long flags;
+
+	spin_lock_irqsave(&priv->ptp_lock, flags);
+	priv->ts_inc = min_t(u64, inc, U32_MAX);
+	ctucan_write32(priv, CTUCANFD_TS_INC, priv->ts_inc);
+	spin_unlock_irqrestore(&priv->ptp_lock, flags);
+
+	return 0;
+}
+
+/**
+ * ctucan_ptp_adjtime() - Steps timestamp generator
+ * @ptp:	PTP clock info
+ * @delta:	Offset in nanoseconds
+ *
+ * Return: 0 always
+ */
+static int ctucan_ptp_adjtime(struct ptp_clock_info *ptp, s64 delta)
+{
+	struct ctucan_priv *priv = container_of(ptp, struct ctucan_priv, ptp_info);
+	unsigned long flags;
+
+	spin_lock_irqsave(&priv->ptp_lock, flags);
+	ctucan_ts_write(priv, (u64)delta, true);
+	spin_unlock_irqrestore(&priv->ptp_lock, flags);
+
+	return 0;
+}
+
+static int ctucan_ptp_gettime64(struct ptp_clock_info *ptp, struct timespec64 *ts)
+{
+	struct ctucan_priv *priv = container_of(ptp, struct ctucan_priv, ptp_info);
+	unsigned long flags;
+	u64 ns;
+
+	spin_lock_irqsave(&priv->ptp_lock, flags);
+	ns = ctucan_ts_read(priv);
+	spin_unlock_irqrestore(&priv->ptp_lock, flags);
+
+	*ts = ns_to_timespec64(ns);
+
+	return 0;
+}
+
+static int ctucan_ptp_settime64(struct ptp_clock_info *ptp, const struct timespec64 *ts)
+{
+	struct ctucan_priv *priv = container_of(ptp, struct ctucan_priv, ptp_info);
+	unsigned long flags;
+
+	spin_lock_irqsave(&priv->ptp_lock, flags);
+	ctucan_ts_write(priv, timespec64_to_ns(ts), false);
+	spin_unlock_irqrestore(&priv->ptp_lock, flags);
+
+	return 0;
+}
+
+static int ctucan_ptp_enable(struct ptp_clock_info *ptp, struct ptp_clock_request *rq, int on)
+{
+	return -EOPNOTSUPP;
+}
+
+static const struct ptp_clock_info ctucan_ptp_info = {
+	.owner		= THIS_MODULE,
+	.name		= DRV_NAME,
+	.max_adj	= 500000,
+	.adjfine	= ctucan_ptp_adjfine,
+	.adjtime	= ctucan_ptp_adjtime,
+	.gettime64	= ctucan_ptp_gettime64,
+	.settime64	= ctucan_ptp_settime64,
+	.enable		= ctucan_ptp_enable,
+};
+
+/**
+ * ctucan_ptp_register() - Switches timestamp generator to nanoseconds and registers PHC
+ * @ndev:	Pointer to net_device structure
+ *
+ * Timestamp generator is loaded from system time. Failure to register PHC is not fatal,
+ * timestamps keep counting nanoseconds.
+ */
+static void ctucan_ptp_register(struct net_device *ndev)
+{
+	struct ctucan_priv *priv = netdev_priv(ndev);
+	u64 inc;
+
+	if (!priv->ts_gen_sup)
+		return;
+
+	/* TS_INC is 8.24 fixed point nanoseconds per core clock cycle */
+	inc = div_u64((u64)NSEC_PER_SEC << 24, priv->can.clock.freq);
+	if (inc > U32_MAX) {
+		netdev_warn(ndev, "core clock too slow for timestamp generator, PHC disabled\n");
+		return;
+	}
+
+	priv->ts_inc_nom = inc;
+	priv->ts_inc = inc;
+	ctucan_write32(priv, CTUCANFD_TS_INC, priv->ts_inc);
+	ctucan_ts_write(priv, ktime_to_ns(ktime_get_real()), false);
+
+	priv->ptp_info = ctucan_ptp_info;
+	priv->ptp_clock = ptp_clock_register(&priv->ptp_info, priv->dev);
+	if (IS_ERR(priv->ptp_clock)) {
+		netdev_warn(ndev, "failed to register PHC (err=%ld)\n", PTR_ERR(priv->ptp_clock));
+		priv->ptp_clock = NULL;
+	}
+}
+
+/**
+ * ctucan_ptp_unregister() - Unregisters PHC
+ * @ndev:	Pointer to net_device structure
+ *
+ * Must be called before the CAN device is unregistered.
+ */
+void ctucan_ptp_unregister(struct net_device *ndev)
+{
+	struct ctucan_priv *priv = netdev_priv(ndev);
+
+	if (priv->ptp_clock)
+		ptp_clock_unregister(priv->ptp_clock);
+	priv->ptp_clock = NULL;
+}
+EXPORT_SYMBOL(ctucan_ptp_unregister);
+
 int ctucan_suspend(struct device *dev)
 {
 	struct net_device *ndev = dev_get_drvdata(dev);
@@ -1419,15 +3487,18 @@ int ctucan_probe_common(struct device *dev, void __iomem *addr, int irq,
 {
 	struct ctucan_priv *priv;
 	struct net_device *ndev;
+	u32 reg;
 	int ret;
 
-	/* Create a CAN device instance for 8 (max) ntxbufs */
-	ndev = alloc_candev(sizeof(struct ctucan_priv), 8);
+	/* Create a CAN device instance for 8 (max) ntxbufs, or TXT FIFO of max. depth */
+	ndev = alloc_candev(sizeof(struct ctucan_priv), CTUCANFD_TX_FIFO_MAX_DEPTH);
 	if (!ndev)
 		return -ENOMEM;
 
 	priv = netdev_priv(ndev);
 	spin_lock_init(&priv->tx_lock);
+	spin_lock_init(&priv->ptp_lock);
+	mutex_init(&priv->bus_stat_lock);
 	INIT_LIST_HEAD(&priv->peers_on_pdev);
 	priv->dev = dev;
 	priv->can.bittiming_const = &ctu_can_fd_bit_timing_max;
@@ -1456,6 +3527,8 @@ int ctucan_probe_common(struct device *dev, void __iomem *addr, int irq,
 		set_drvdata_fnc(dev, ndev);
 	SET_NETDEV_DEV(ndev, dev);
 	ndev->netdev_ops = &ctucan_netdev_ops;
+	ndev->ethtool_ops = &ctucan_ethtool_ops;
+	ndev->sysfs_groups[0] = &ctucan_sysfs_group;
 
 	/* Getting the can_clk info */
 	if (!can_clk_rate) {
@@ -1494,12 +3567,42 @@ int ctucan_probe_common(struct device *dev, void __iomem *addr, int irq,
 
 	priv->ntxbufs = FIELD_GET(REG_TX_COMMAND_TXT_BUFFER_COUNT, ctucan_read32(priv, CTUCANFD_TX_COMMAND));
 	dev_dbg(dev, "txt buffers: %d detected", priv->ntxbufs);
+	priv->txb_count = priv->ntxbufs;
+
+	reg = ctucan_read32(priv, CTUCANFD_FILTER_CONTROL);
+	priv->rx_filter_mask_sup = FIELD_GET(REG_FILTER_CONTROL_SFA | REG_FILTER_CONTROL_SFB |
+					     REG_FILTER_CONTROL_SFC, reg);
+	priv->rx_filter_range_sup = FIELD_GET(REG_FILTER_CONTROL_SFR, reg);
+	priv->rx_skip_sup = FIELD_GET(REG_STATUS_SRXPK, ctucan_read32(priv, CTUCANFD_STATUS));
+	priv->tx_cpl_sup = FIELD_GET(REG_STATUS_STCPL, ctucan_read32(priv, CTUCANFD_STATUS));
+	priv->rx_prio_sup = FIELD_GET(REG_STATUS_STRXP, ctucan_read32(priv, CTUCANFD_STATUS));
+
+	priv->rx_dma_sup = FIELD_GET(REG_STATUS_SRDMA, ctucan_read32(priv, CTUCANFD_STATUS));
+
+	if (FIELD_GET(REG_STATUS_STXF, ctucan_read32(priv, CTUCANFD_STATUS)))
+		priv->tx_fifo_depth = FIELD_GET(REG_TX_FIFO_CTRL_TFDEPTH,
+						ctucan_read32(priv, CTUCANFD_TX_FIFO_CTRL));
+	dev_dbg(dev, "txt fifo depth: %u", priv->tx_fifo_depth);
+
+	/* The last TXT buffer is TXT FIFO when synthesized, see CTUCANFD_FLAG_TX_CYC */
+	priv->tx_cyc_sup = FIELD_GET(REG_STATUS_STCYC, ctucan_read32(priv, CTUCANFD_STATUS)) &&
+			   !priv->tx_fifo_depth;
+
+	priv->irq_lat_sup = FIELD_GET(REG_STATUS_SITS, ctucan_read32(priv, CTUCANFD_STATUS));
+	priv->bus_stat_sup = FIELD_GET(REG_STATUS_STCNT, ctucan_read32(priv, CTUCANFD_STATUS));
+	priv->ts_gen_sup = FIELD_GET(REG_STATUS_STSG, ctucan_read32(priv, CTUCANFD_STATUS));
+
+	reg = ctucan_read32(priv, CTUCANFD_DEVICE_ID);
+	priv->ts_high_latch = FIELD_GET(REG_DEVICE_ID_VER_MAJOR, reg) * 10 +
+			      FIELD_GET(REG_DEVICE_ID_VER_MINOR, reg) >= CTUCANFD_VER_TS_HIGH_LATCH;
 
 	ret = ctucan_reset(ndev);
 	if (ret < 0)
 		goto err_deviceoff;
 
 	priv->can.clock.freq = can_clk_rate;
+	priv->ssp_pos = -1;
+	priv->cfg.rx_dma_batch = CTUCANFD_RX_DMA_BATCH_DEF;
 
 	netif_napi_add(ndev, &priv->napi, ctucan_rx_poll, NAPI_POLL_WEIGHT);
 
@@ -1511,6 +3614,8 @@ int ctucan_probe_common(struct device *dev, void __iomem *addr, int irq,
 
 	devm_can_led_init(ndev);
 
+	ctucan_ptp_register(ndev);
+
 	pm_runtime_put(dev);
 
 	netdev_dbg(ndev, "mem_base=0x%p irq=%d clock=%d, no. of txt buffers:%d\n",
@@ -0,0 +1,291 @@
+// SPDX-License-Identifier: GPL-2.0-or-later
+/*******************************************************************************
+ *
+ * CTU CAN FD IP Core
+ *
+ * Copyright (C) 2015-2018 Ondrej Ille <ondrej.ille@gmail.com> FEE CTU
+ * Copyright (C) 2018-2020 Ondrej Ille <ondrej.ille@gmail.com> self-funded
+ * Copyright (C) 2018-2019 Martin Jerabek <martin.jerabek01@gmail.com> FEE CTU
+ * Copyright (C) 2018-2020 Pavel Pisa <pisa@cmp.felk.cvut.cz> FEE CTU/self-funded
+ *
+ * Project advisors:
+ *     Jiri Novak <jnovak@fel.cvut.cz>
+ *     Pavel Pisa <pisa@cmp.felk.cvut.cz>
+ *
+ * Department of Measurement         (http://meas.fel.cvut.cz/)
+ * Faculty of Electrical Engineering (http://www.fel.cvut.cz)
+ * Czech Technical University        (http://www.cvut.cz/)
+ *
+ * This program is free software; you can redistribute it and/or
+ * modify it under the terms of the GNU General Public License
+ * as published by the Free Software Foundation; either version 2
+ * of the License, or (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ ******************************************************************************/
+
+#define _GNU_SOURCE
+
+#include <err.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+
+#include "ctucanfd_cosim.h"
+
+/* Size of register map, accounting is done per 32-bit word */
+#define CTUCAN_COSIM_REGS	(0x1000 / 4)
+
+struct ctucan_cosim_reg_stat {
+	unsigned long reads;
+	unsigned long writes;
+	unsigned long long cycles;
+};
+
+struct ctucan_cosim_call_stat {
+	const char *name;
+	unsigned long calls;
+	unsigned long accesses;
+	unsigned long long cycles;
+	unsigned long max;
+};
+
+static struct {
+	FILE *req;
+	FILE *resp;
+
+	unsigned long accesses;
+	unsigned long long cycles;
+	struct ctucan_cosim_reg_stat regs[CTUCAN_COSIM_REGS];
+
+	struct ctucan_cosim_call_stat calls[CTUCAN_COSIM_MAX_CALLS];
+	unsigned int n_calls;
+
+	/* Call in progress and counters at its start */
+	struct ctucan_cosim_call_stat *cur;
+	unsigned long cur_accesses;
+	unsigned long long cur_cycles;
+} cosim;
+
+
+static u32 ctucan_cosim_reply(unsigned int *cycles)
+{
+	unsigned int data;
+
+	if (fflush(cosim.req) || fscanf(cosim.resp, "%x %u", &data, cycles) != 2) {
+		/* Nobody to report to */
+		cosim.req = NULL;
+		errx(1, "co-simulation: connection to simulator lost");
+	}
+	cosim.cycles += *cycles;
+	return data;
+}
+
+static void ctucan_cosim_account(enum ctu_can_fd_can_registers reg,
+				 unsigned int cycles, bool write)
+{
+	struct ctucan_cosim_reg_stat *r = &cosim.regs[(reg >> 2) % CTUCAN_COSIM_REGS];
+
+	if (write)
+		r->writes++;
+	else
+		r->reads++;
+	r->cycles += cycles;
+	cosim.accesses++;
+}
+
+u32 ctucan_cosim_read32(struct ctucan_hw_priv *priv,
+			enum ctu_can_fd_can_registers reg)
+{
+	unsigned int cycles;
+	u32 data;
+
+	(void)priv;
+	fprintf(cosim.req, "R %04x\n", reg);
+	data = ctucan_cosim_reply(&cycles);
+	ctucan_cosim_account(reg, cycles, false);
+	return data;
+}
+
+void ctucan_cosim_write32(struct ctucan_hw_priv *priv,
+			  enum ctu_can_fd_can_registers reg, u32 val)
+{
+	unsigned int cycles;
+
+	(void)priv;
+	fprintf(cosim.req, "W %04x %08x\n", reg, val);
+	ctucan_cosim_reply(&cycles);
+	ctucan_cosim_account(reg, cycles, true);
+}
+
+void ctucan_cosim_idle(unsigned int cycles)
+{
+	unsigned int done;
+
+	if (!cosim.req)
+		return;
+	fprintf(cosim.req, "I %u\n", cycles);
+	ctucan_cosim_reply(&done);
+}
+
+bool ctucan_cosim_active(void)
+{
+	return cosim.req != NULL;
+}
+
+void ctucan_cosim_call_begin(const char *name)
+{
+	struct ctucan_cosim_call_stat *c = NULL;
+
+	if (!cosim.req)
+		return;
+
+	for (unsigned int i = 0; i < cosim.n_calls; i++) {
+		if (!strcmp(cosim.calls[i].name, name)) {
+			c = &cosim.calls[i];
+			break;
+		}
+	}
+	if (!c) {
+		if (cosim.n_calls == CTUCAN_COSIM_MAX_CALLS)
+			return;
+		c = &cosim.calls[cosim.n_calls++];
+		c->name = name;
+	}
+
+	cosim.cur = c;
+	cosim.cur_accesses = cosim.accesses;
+	cosim.cur_cycles = cosim.cycles;
+}
+
+void ctucan_cosim_call_end(void)
+{
+	struct ctucan_cosim_call_stat *c = cosim.cur;
+	unsigned long cycles;
+
+	if (!c)
+		return;
+
+	cycles = cosim.cycles - cosim.cur_cycles;
+	c->calls++;
+	c->accesses += cosim.accesses - cosim.cur_accesses;
+	c->cycles += cycles;
+	if (cycles > c->max)
+		c->max = cycles;
+	cosim.cur = NULL;
+}
+
+static void ctucan_cosim_report(FILE *f)
+{
+	fprintf(f, "# call                     calls   accesses     cycles  cycles/call    max\n");
+	for (unsigned int i = 0; i < cosim.n_calls; i++) {
+		struct ctucan_cosim_call_stat *c = &cosim.calls[i];
+
+		fprintf(f, "%-24s %8lu %10lu %10llu %12llu %6lu\n", c->name,
+			c->calls, c->accesses, c->cycles,
+			c->calls ? c->cycles / c->calls : 0, c->max);
+	}
+	fprintf(f, "%-24s %8u %10lu %10llu\n", "total", 1, cosim.accesses,
+		cosim.cycles);
+
+	fprintf(f, "# register    reads   writes     cycles\n");
+	for (unsigned int i = 0; i < CTUCAN_COSIM_REGS; i++) {
+		struct ctucan_cosim_reg_stat *r = &cosim.regs[i];
+
+		if (r->reads || r->writes)
+			fprintf(f, "0x%03x    %8lu %8lu %10llu\n", i * 4, r->reads,
+				r->writes, r->cycles);
+	}
+}
+
+/*
+ * Compare average cycles per call with budget. Calls which are not in the
+ * report are skipped, so budget file can cover more programs.
+ */
+static int ctucan_cosim_check_budget(const char *path)
+{
+	char name[64];
+	unsigned long max;
+	int fails = 0;
+	FILE *f = fopen(path, "r");
+
+	if (!f) {
+		warn("co-simulation: budget file %s", path);
+		return 1;
+	}
+
+	while (fscanf(f, " %63s", name) == 1) {
+		if (name[0] == '#' || fscanf(f, "%lu", &max) != 1) {
+			fscanf(f, "%*[^\n]");
+			continue;
+		}
+		for (unsigned int i = 0; i < cosim.n_calls; i++) {
+			struct ctucan_cosim_call_stat *c = &cosim.calls[i];
+
+			if (strcmp(c->name, name) || !c->calls)
+				continue;
+			if (c->cycles / c->calls > max) {
+				warnx("co-simulation: %s takes %llu cycles per call, "
+				      "budget is %lu", name, c->cycles / c->calls, max);
+				fails++;
+			}
+		}
+	}
+	fclose(f);
+
+	return fails;
+}
+
+static void ctucan_cosim_exit(int status, void *arg)
+{
+	const char *report = getenv(CTUCAN_COSIM_REPORT_ENV);
+	const char *budget = getenv(CTUCAN_COSIM_BUDGET_ENV);
+	FILE *f = NULL;
+
+	(void)arg;
+	if (!cosim.req)
+		return;
+
+	if (report)
+		f = fopen(report, "w");
+	ctucan_cosim_report(f ? f : stderr);
+	if (f)
+		fclose(f);
+
+	if (budget && ctucan_cosim_check_budget(budget) && !status)
+		status = 1;
+
+	fprintf(cosim.req, "Q %d\n", status);
+	fclose(cosim.req);
+	fclose(cosim.resp);
+	cosim.req = NULL;
+}
+
+int ctucan_cosim_init(struct ctucan_hw_priv *priv, const char *dir)
+{
+	char path[256];
+
+	/* Simulator opens "req" first, so the order avoids a deadlock */
+	snprintf(path, sizeof(path), "%s/req", dir);
+	cosim.req = fopen(path, "w");
+	if (!cosim.req)
+		return -1;
+
+	snprintf(path, sizeof(path), "%s/resp", dir);
+	cosim.resp = fopen(path, "r");
+	if (!cosim.resp) {
+		fclose(cosim.req);
+		cosim.req = NULL;
+		return -1;
+	}
+
+	priv->mem_base = NULL;
+	priv->read_reg = ctucan_cosim_read32;
+	priv->write_reg = ctucan_cosim_write32;
+
+	on_exit(ctucan_cosim_exit, NULL);
+	return 0;
+}
@@ -0,0 +1,110 @@
+/* SPDX-License-Identifier: GPL-2.0-or-later */
+/*******************************************************************************
+ *
+ * CTU CAN FD IP Core
+ *
+ * Copyright (C) 2015-2018 Ondrej Ille <ondrej.ille@gmail.com> FEE CTU
+ * Copyright (C) 2018-2020 Ondrej Ille <ondrej.ille@gmail.com> self-funded
+ * Copyright (C) 2018-2019 Martin Jerabek <martin.jerabek01@gmail.com> FEE CTU
+ * Copyright (C) 2018-2020 Pavel Pisa <pisa@cmp.felk.cvut.cz> FEE CTU/self-funded
+ *
+ * Project advisors:
+ *     Jiri Novak <jnovak@fel.cvut.cz>
+ *     Pavel Pisa <pisa@cmp.felk.cvut.cz>
+ *
+ * Department of Measurement         (http://meas.fel.cvut.cz/)
+ * Faculty of Electrical Engineering (http://www.fel.cvut.cz)
+ * Czech Technical University        (http://www.cvut.cz/)
+ *
+ * This program is free software; you can redistribute it and/or
+ * modify it under the terms of the GNU General Public License
+ * as published by the Free Software Foundation; either version 2
+ * of the License, or (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ ******************************************************************************/
+
+#ifndef __CTUCANFD_COSIM__
+#define __CTUCANFD_COSIM__
+
+#include "ctucanfd_linux_defs.h"
+#include "ctucanfd_hw.h"
+
+/*
+ * HAL co-simulation bridge (userspace only)
+ *
+ * Register accesses of the HAL are forwarded to "hal_cosim" feature test
+ * running in the simulator, which executes them on the RTL via Memory bus
+ * agent. Requests and replies are text lines passed over two named pipes
+ * ("req" and "resp") in a directory given by CTUCAN_COSIM_ENV:
+ *
+ *	R <addr>		Read, reply: <data> <cycles>
+ *	W <addr> <data>		Write, reply: <data> <cycles>
+ *	I <cycles>		Let simulation run, reply: <data> <cycles>
+ *	Q <status>		End of simulation, no reply
+ *
+ * <addr> and <data> are hexadecimal (4 and 8 digits), <cycles> is number of
+ * system clock cycles the request took in simulation.
+ *
+ * Cycles are accounted per register and per "call". Call is a section of
+ * code between ctucan_cosim_call_begin() and ctucan_cosim_call_end(), e.g.
+ * a HAL function. On exit, the report is written to file given by
+ * CTUCAN_COSIM_REPORT_ENV (or to stderr). When CTUCAN_COSIM_BUDGET_ENV
+ * gives a budget file with "<call> <max cycles per call>" lines, calls
+ * exceeding their budget make the simulation fail.
+ */
+
+#define CTUCAN_COSIM_ENV		"CTUCANFD_COSIM"
+#define CTUCAN_COSIM_REPORT_ENV		"CTUCANFD_COSIM_REPORT"
+#define CTUCAN_COSIM_BUDGET_ENV		"CTUCANFD_COSIM_BUDGET"
+
+/* Maximal number of distinct calls in the report */
+#define CTUCAN_COSIM_MAX_CALLS		32
+
+/**
+ * ctucan_cosim_init - Connect to simulation and set register accessors.
+ *
+ * Report is written and simulation is finished when the program exits,
+ * exit status of the program is passed to the simulation.
+ *
+ * @priv: Private info
+ * @dir: Directory with "req" and "resp" named pipes.
+ * Return: 0 on success, -1 if pipes can not be opened.
+ */
+int ctucan_cosim_init(struct ctucan_hw_priv *priv, const char *dir);
+
+/**
+ * ctucan_cosim_active - Check whether HAL runs against simulation.
+ */
+bool ctucan_cosim_active(void);
+
+u32 ctucan_cosim_read32(struct ctucan_hw_priv *priv,
+			enum ctu_can_fd_can_registers reg);
+void ctucan_cosim_write32(struct ctucan_hw_priv *priv,
+			  enum ctu_can_fd_can_registers reg, u32 val);
+
+/**
+ * ctucan_cosim_idle - Let simulation run without register access.
+ *
+ * @cycles: Number of system clock cycles.
+ */
+void ctucan_cosim_idle(unsigned int cycles);
+
+/**
+ * ctucan_cosim_call_begin - Start accounting of a call.
+ *
+ * Calls do not nest, no-op when not co-simulating.
+ *
+ * @name: Name of the call in the report (string literal).
+ */
+void ctucan_cosim_call_begin(const char *name);
+
+/**
+ * ctucan_cosim_call_end - Finish accounting of the current call.
+ */
+void ctucan_cosim_call_end(void);
+
+#endif /* __CTUCANFD_COSIM__ */
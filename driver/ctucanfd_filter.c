@@ -0,0 +1,311 @@
+// SPDX-License-Identifier: GPL-2.0-or-later
+/*******************************************************************************
+ *
+ * CTU CAN FD IP Core
+ *
+ * Copyright (C) 2015-2018 Ondrej Ille <ondrej.ille@gmail.com> FEE CTU
+ * Copyright (C) 2018-2020 Ondrej Ille <ondrej.ille@gmail.com> self-funded
+ * Copyright (C) 2018-2019 Martin Jerabek <martin.jerabek01@gmail.com> FEE CTU
+ * Copyright (C) 2018-2020 Pavel Pisa <pisa@cmp.felk.cvut.cz> FEE CTU/self-funded
+ *
+ * Project advisors:
+ *     Jiri Novak <jnovak@fel.cvut.cz>
+ *     Pavel Pisa <pisa@cmp.felk.cvut.cz>
+ *
+ * Department of Measurement         (http://meas.fel.cvut.cz/)
+ * Faculty of Electrical Engineering (http://www.fel.cvut.cz)
+ * Czech Technical University        (http://www.cvut.cz/)
+ *
+ * This program is free software; you can redistribute it and/or
+ * modify it under the terms of the GNU General Public License
+ * as published by the Free Software Foundation; either version 2
+ * of the License, or (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ ******************************************************************************/
+
+
+#ifdef __KERNEL__
+# include <linux/errno.h>
+# include <linux/string.h>
+#else
+# include <errno.h>
+# include <string.h>
+#endif
+
+#include "ctucanfd_filter.h"
+
+static unsigned int ctucan_filter_weight(u32 x)
+{
+	unsigned int n = 0;
+
+	for (; x; x &= x - 1)
+		n++;
+	return n;
+}
+
+/* Number of identifiers accepted by item configured as mask filter */
+static s64 ctucan_filter_mask_size(const struct ctucan_filter_item *it)
+{
+	s64 size = 0;
+
+	if (it->ctrl & CTUCANFD_FILTER_BASE)
+		size += 1LL << (11 - ctucan_filter_weight(it->mask >> 18));
+	if (it->ctrl & CTUCANFD_FILTER_EXT)
+		size += 1LL << (29 - ctucan_filter_weight(it->mask));
+	return size;
+}
+
+/* Number of identifiers accepted by item configured as range filter */
+static s64 ctucan_filter_range_size(const struct ctucan_filter_item *it)
+{
+	s64 size = 0;
+
+	if (it->ctrl & CTUCANFD_FILTER_BASE)
+		size += (it->high >> 18) - (it->low >> 18) + 1;
+	if (it->ctrl & CTUCANFD_FILTER_EXT)
+		size += (s64)it->high - it->low + 1;
+	return size;
+}
+
+static void ctucan_filter_item_init(struct ctucan_filter_item *it, u8 ctrl,
+				    u32 mask, u32 val)
+{
+	it->ctrl = ctrl;
+	it->mask = mask & CTUCANFD_FILTER_ID_MASK;
+	it->val = val & it->mask;
+	it->low = it->val;
+	it->high = it->val | (~it->mask & CTUCANFD_FILTER_ID_MASK);
+	it->merged = false;
+}
+
+/* Smallest mask filter (and range) accepting everything accepted by a and b */
+static void ctucan_filter_item_merge(struct ctucan_filter_item *a,
+				     const struct ctucan_filter_item *b)
+{
+	a->mask &= b->mask & ~(a->val ^ b->val);
+	a->val &= a->mask;
+	if (b->low < a->low)
+		a->low = b->low;
+	if (b->high > a->high)
+		a->high = b->high;
+	a->ctrl |= b->ctrl;
+	a->merged = true;
+}
+
+/* Adds rule to exact software lookup tables, or to list of generic rules */
+static void ctucan_filter_add_sw(struct ctucan_filter *f, unsigned int idx)
+{
+	canid_t id = f->rules[idx].can_id;
+	canid_t mask = f->rules[idx].can_mask;
+	unsigned int i;
+	u32 eid;
+
+	if (!(id & CAN_INV_FILTER) &&
+	    (mask & (CAN_EFF_FLAG | CAN_RTR_FLAG)) == CAN_EFF_FLAG) {
+		if (!(id & CAN_EFF_FLAG) &&
+		    (mask & CAN_SFF_MASK) == CAN_SFF_MASK &&
+		    !(id & mask & CAN_EFF_MASK & ~CAN_SFF_MASK)) {
+			f->sff_map[(id & CAN_SFF_MASK) / 32] |=
+				1u << (id & 31);
+			return;
+		}
+		if ((id & CAN_EFF_FLAG) &&
+		    (mask & CAN_EFF_MASK) == CAN_EFF_MASK) {
+			eid = id & CAN_EFF_MASK;
+			for (i = f->n_eff; i > 0 && f->eff_ids[i - 1] >= eid; i--)
+				;
+			if (i < f->n_eff && f->eff_ids[i] == eid)
+				return;
+			memmove(&f->eff_ids[i + 1], &f->eff_ids[i],
+				(f->n_eff - i) * sizeof(f->eff_ids[0]));
+			f->eff_ids[i] = eid;
+			f->n_eff++;
+			return;
+		}
+	}
+	f->other[f->n_other++] = idx;
+}
+
+/* Splits rule to hardware filter items, returns number of items added */
+static unsigned int ctucan_filter_rule_items(const struct can_filter *rule,
+					     struct ctucan_filter_item *it,
+					     bool *exact)
+{
+	canid_t mask = rule->can_mask;
+	canid_t id = rule->can_id & mask;
+	unsigned int n = 0;
+
+	/* Inverted rule accepts almost everything, do not filter in HW */
+	if (rule->can_id & CAN_INV_FILTER) {
+		ctucan_filter_item_init(&it[n++], CTUCANFD_FILTER_BASE |
+					CTUCANFD_FILTER_EXT, 0, 0);
+		*exact = false;
+		return n;
+	}
+
+	/* HW filters do not distinguish RTR frames */
+	if (mask & CAN_RTR_FLAG)
+		*exact = false;
+
+	/* Base frame identifiers are in bits 28:18 of IDENTIFIER_W */
+	if ((!(mask & CAN_EFF_FLAG) || !(id & CAN_EFF_FLAG)) &&
+	    !(id & CAN_EFF_MASK & ~CAN_SFF_MASK))
+		ctucan_filter_item_init(&it[n++], CTUCANFD_FILTER_BASE,
+					(mask & CAN_SFF_MASK) << 18,
+					(id & CAN_SFF_MASK) << 18);
+
+	if (!(mask & CAN_EFF_FLAG) || (id & CAN_EFF_FLAG))
+		ctucan_filter_item_init(&it[n++], CTUCANFD_FILTER_EXT,
+					mask & CAN_EFF_MASK,
+					id & CAN_EFF_MASK);
+	return n;
+}
+
+int ctucan_filter_compile(struct ctucan_filter *f,
+			  const struct can_filter *rules, unsigned int n_rules,
+			  u8 mask_sup, bool range_sup)
+{
+	struct ctucan_filter_item *items = f->items;
+	struct ctucan_filter_item merged;
+	unsigned int n_items = 0;
+	unsigned int n_mask = 0;
+	unsigned int n_slots;
+	unsigned int i, j, a, b;
+	int range_idx = -1;
+	bool exact = true;
+	s64 cost, best;
+
+	if (n_rules > CTUCANFD_FILTER_MAX_RULES)
+		return -EINVAL;
+
+	memset(f, 0, sizeof(*f));
+	if (!n_rules)
+		return 0;
+
+	memcpy(f->rules, rules, n_rules * sizeof(*rules));
+	f->n_rules = n_rules;
+
+	for (i = 0; i < n_rules; i++) {
+		ctucan_filter_add_sw(f, i);
+		n_items += ctucan_filter_rule_items(&rules[i], &items[n_items],
+						    &exact);
+	}
+
+	for (i = 0; i < CTUCANFD_FILTER_MASK_COUNT; i++)
+		if (mask_sup & (1 << i))
+			n_mask++;
+	n_slots = n_mask + (range_sup ? 1 : 0);
+
+	/* No filter synthesized, filter in software only */
+	if (!n_slots) {
+		f->sw_ena = true;
+		return 0;
+	}
+	f->hw_ena = true;
+
+	/*
+	 * Merge pair of items with the smallest growth of accepted identifier
+	 * count until items fit into available filters.
+	 */
+	while (n_items > n_slots) {
+		best = 0;
+		a = 0;
+		b = 0;
+		for (i = 0; i < n_items; i++) {
+			for (j = i + 1; j < n_items; j++) {
+				merged = items[i];
+				ctucan_filter_item_merge(&merged, &items[j]);
+				cost = ctucan_filter_mask_size(&merged) -
+				       ctucan_filter_mask_size(&items[i]) -
+				       ctucan_filter_mask_size(&items[j]);
+				if (a == b || cost < best) {
+					best = cost;
+					a = i;
+					b = j;
+				}
+			}
+		}
+		ctucan_filter_item_merge(&items[a], &items[b]);
+		items[b] = items[--n_items];
+		exact = false;
+	}
+
+	/* Range filter takes the item it describes best */
+	if (n_items > n_mask) {
+		best = 0;
+		for (i = 0; i < n_items; i++) {
+			cost = ctucan_filter_mask_size(&items[i]) -
+			       ctucan_filter_range_size(&items[i]);
+			if (range_idx < 0 || cost > best) {
+				best = cost;
+				range_idx = i;
+			}
+		}
+		f->hw_range.ctrl = items[range_idx].ctrl;
+		f->hw_range.low = items[range_idx].low;
+		f->hw_range.high = items[range_idx].high;
+		if (ctucan_filter_range_size(&items[range_idx]) !=
+		    ctucan_filter_mask_size(&items[range_idx]))
+			exact = false;
+	}
+
+	for (i = 0, j = 0; i < n_items; i++) {
+		if ((int)i == range_idx)
+			continue;
+		while (!(mask_sup & (1 << j)))
+			j++;
+		f->hw_mask[j].ctrl = items[i].ctrl;
+		f->hw_mask[j].mask = items[i].mask;
+		f->hw_mask[j].low = items[i].val;
+		j++;
+	}
+
+	f->sw_ena = !exact;
+	return 0;
+}
+
+bool ctucan_filter_match(const struct ctucan_filter *f, canid_t can_id)
+{
+	const struct can_filter *rule;
+	unsigned int lo, hi, mid;
+	unsigned int i;
+	u32 eid;
+	bool match;
+
+	if (!f->n_rules)
+		return true;
+
+	if (can_id & CAN_EFF_FLAG) {
+		eid = can_id & CAN_EFF_MASK;
+		lo = 0;
+		hi = f->n_eff;
+		while (lo < hi) {
+			mid = (lo + hi) / 2;
+			if (f->eff_ids[mid] == eid)
+				return true;
+			if (f->eff_ids[mid] < eid)
+				lo = mid + 1;
+			else
+				hi = mid;
+		}
+	} else if (f->sff_map[(can_id & CAN_SFF_MASK) / 32] &
+		   (1u << (can_id & 31))) {
+		return true;
+	}
+
+	for (i = 0; i < f->n_other; i++) {
+		rule = &f->rules[f->other[i]];
+		match = !((can_id ^ (rule->can_id & ~CAN_INV_FILTER)) &
+			  rule->can_mask);
+		if (rule->can_id & CAN_INV_FILTER)
+			match = !match;
+		if (match)
+			return true;
+	}
+
+	return false;
+}
@@ -0,0 +1,157 @@
+/* SPDX-License-Identifier: GPL-2.0-or-later */
+/*******************************************************************************
+ *
+ * CTU CAN FD IP Core
+ *
+ * Copyright (C) 2015-2018 Ondrej Ille <ondrej.ille@gmail.com> FEE CTU
+ * Copyright (C) 2018-2020 Ondrej Ille <ondrej.ille@gmail.com> self-funded
+ * Copyright (C) 2018-2019 Martin Jerabek <martin.jerabek01@gmail.com> FEE CTU
+ * Copyright (C) 2018-2020 Pavel Pisa <pisa@cmp.felk.cvut.cz> FEE CTU/self-funded
+ *
+ * Project advisors:
+ *     Jiri Novak <jnovak@fel.cvut.cz>
+ *     Pavel Pisa <pisa@cmp.felk.cvut.cz>
+ *
+ * Department of Measurement         (http://meas.fel.cvut.cz/)
+ * Faculty of Electrical Engineering (http://www.fel.cvut.cz)
+ * Czech Technical University        (http://www.cvut.cz/)
+ *
+ * This program is free software; you can redistribute it and/or
+ * modify it under the terms of the GNU General Public License
+ * as published by the Free Software Foundation; either version 2
+ * of the License, or (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ ******************************************************************************/
+
+#ifndef __CTUCANFD_FILTER__
+#define __CTUCANFD_FILTER__
+
+#ifdef __KERNEL__
+# include <linux/types.h>
+# include <linux/can.h>
+#else
+# include "ctucanfd_linux_defs.h"
+#endif
+
+/*
+ * Acceptance filter compiler
+ *
+ * Translates a list of SocketCAN "struct can_filter" rules into the
+ * configuration of Filter A/B/C (bit mask) and the Range filter of the core.
+ * The hardware filters are limited in number (and each of them can be left
+ * out at synthesis), so the compiler merges rules until they fit. The result
+ * accepts a superset of frames matched by the rules. When the superset is not
+ * exact, the rules are additionally evaluated in software (RX path) by
+ * ctucan_filter_match().
+ */
+
+/* Maximal number of rules in one filter set */
+#define CTUCANFD_FILTER_MAX_RULES	32
+
+/* Number of mask filters (A, B, C) */
+#define CTUCANFD_FILTER_MASK_COUNT	3
+
+/* Identifier mask in IDENTIFIER_W format (base ID in bits 28:18) */
+#define CTUCANFD_FILTER_ID_MASK		0x1FFFFFFF
+
+/*
+ * Frame types accepted by a filter, layout matches per-filter nibble
+ * of FILTER_CONTROL register (N - CAN 2.0, F - CAN FD, B - base, E - ext.).
+ */
+#define CTUCANFD_FILTER_NB		0x1
+#define CTUCANFD_FILTER_NE		0x2
+#define CTUCANFD_FILTER_FB		0x4
+#define CTUCANFD_FILTER_FE		0x8
+#define CTUCANFD_FILTER_BASE		(CTUCANFD_FILTER_NB | CTUCANFD_FILTER_FB)
+#define CTUCANFD_FILTER_EXT		(CTUCANFD_FILTER_NE | CTUCANFD_FILTER_FE)
+
+/**
+ * struct ctucan_filter_hw - Configuration of single hardware filter
+ * @ctrl:	Accepted frame types (CTUCANFD_FILTER_xx), 0 if disabled
+ * @mask:	Mask filter: bit mask, Range filter: unused
+ * @low:	Mask filter: value, Range filter: lower threshold
+ * @high:	Mask filter: unused, Range filter: upper threshold
+ */
+struct ctucan_filter_hw {
+	u8 ctrl;
+	u32 mask;
+	u32 low;
+	u32 high;
+};
+
+/* Part of rule (or of merged rules) accepted by one hardware filter */
+struct ctucan_filter_item {
+	u8 ctrl;
+	u32 mask;
+	u32 val;
+	u32 low;
+	u32 high;
+	bool merged;
+};
+
+/**
+ * struct ctucan_filter - Compiled acceptance filter set
+ * @n_rules:	Number of rules
+ * @rules:	Rules as passed to ctucan_filter_compile()
+ * @hw_ena:	Hardware filtering shall be enabled (MODE[AFM])
+ * @hw_mask:	Configuration of Filter A, B, C
+ * @hw_range:	Configuration of Range filter
+ * @sw_ena:	Hardware filters accept superset of rules, frames must be
+ *		checked by ctucan_filter_match()
+ * @sff_map:	Bitmap of base identifiers matched exactly by some rule
+ * @n_eff:	Number of entries in @eff_ids
+ * @eff_ids:	Sorted extended identifiers matched exactly by some rule
+ * @n_other:	Number of entries in @other
+ * @other:	Indices of remaining rules, evaluated one by one
+ * @items:	Scratch space of ctucan_filter_compile(), kept here to keep it
+ *		off the kernel stack
+ */
+struct ctucan_filter {
+	unsigned int n_rules;
+	struct can_filter rules[CTUCANFD_FILTER_MAX_RULES];
+
+	bool hw_ena;
+	struct ctucan_filter_hw hw_mask[CTUCANFD_FILTER_MASK_COUNT];
+	struct ctucan_filter_hw hw_range;
+
+	bool sw_ena;
+	u32 sff_map[(CAN_SFF_MASK + 1) / 32];
+	unsigned int n_eff;
+	u32 eff_ids[CTUCANFD_FILTER_MAX_RULES];
+	unsigned int n_other;
+	u8 other[CTUCANFD_FILTER_MAX_RULES];
+
+	struct ctucan_filter_item items[2 * CTUCANFD_FILTER_MAX_RULES];
+};
+
+/**
+ * ctucan_filter_compile - Compile rules to hardware and software filters.
+ *
+ * Rules follow SocketCAN semantics: frame is accepted when it matches at
+ * least one rule. Empty rule set accepts all frames.
+ *
+ * @f:		Filter set to fill
+ * @rules:	Array of rules
+ * @n_rules:	Number of rules
+ * @mask_sup:	Bit i set if mask filter i (A = 0) is synthesized
+ * @range_sup:	Range filter is synthesized
+ * Return: 0 on success, -EINVAL if there are too many rules.
+ */
+int ctucan_filter_compile(struct ctucan_filter *f,
+			  const struct can_filter *rules, unsigned int n_rules,
+			  u8 mask_sup, bool range_sup);
+
+/**
+ * ctucan_filter_match - Software acceptance check of received frame.
+ *
+ * @f:		Compiled filter set
+ * @can_id:	Identifier of received frame including EFF/RTR flags
+ * Return: True if frame matches at least one rule.
+ */
+bool ctucan_filter_match(const struct ctucan_filter *f, canid_t can_id);
+
+#endif /*__CTUCANFD_FILTER__*/
@@ -59,9 +59,11 @@ union ctu_can_fd_frame_format_w {
 		uint32_t brs                     : 1;
 		uint32_t esi_rsv                 : 1;
 		uint32_t rwcnt                   : 5;
-		uint32_t reserved_31_16         : 16;
+		uint32_t ets                     : 1;
+		uint32_t reserved_31_17         : 15;
 #else
-		uint32_t reserved_31_16         : 16;
+		uint32_t reserved_31_17         : 15;
+		uint32_t ets                     : 1;
 		uint32_t rwcnt                   : 5;
 		uint32_t esi_rsv                 : 1;
 		uint32_t brs                     : 1;
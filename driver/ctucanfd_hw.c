@@ -30,6 +30,7 @@
 
 #ifdef __KERNEL__
 # include <linux/can/dev.h>
+# include <linux/io-64-nonatomic-lo-hi.h>
 #else
 /* The hardware registers mapping and low level layer should build
  * in userspace to allow development and verification of CTU CAN IP
@@ -40,11 +41,13 @@
  * generated from from IP-XACT/cactus helps to driver to hardware
  * and QEMU emulation model consistency keeping.
  */
+# include <string.h>
 # include "ctucanfd_linux_defs.h"
 #endif
 
 #include "ctucanfd_frame.h"
 #include "ctucanfd_hw.h"
+#include "ctucanfd_filter.h"
 
 
 void ctucan_hw_write32(struct ctucan_hw_priv *priv,
@@ -78,6 +81,27 @@ static void ctucan_hw_write_txt_buf(struct ctucan_hw_priv *priv,
 	priv->write_reg(priv, buf_base + offset, val);
 }
 
+/*
+ * Writes 'count' consecutive words of TXT Buffer starting at FRAME_FORMAT_W.
+ * On 64-bit bus, pairs of words are written by single access (lower word
+ * is on lower address), the last odd word by 32-bit access.
+ */
+static void ctucan_hw_write_txt_buf_words(struct ctucan_hw_priv *priv,
+					  enum ctu_can_fd_can_registers buf_base,
+					  const u32 *words, unsigned int count)
+{
+	unsigned int i = 0;
+
+	if (priv->access64 && priv->write_reg == ctucan_hw_write32) {
+		for (; i + 1 < count; i += 2)
+			iowrite64(((u64)words[i + 1] << 32) | words[i],
+				  priv->mem_base + buf_base + i * 4);
+	}
+
+	for (; i < count; i++)
+		ctucan_hw_write_txt_buf(priv, buf_base, i * 4, words[i]);
+}
+
 static union ctu_can_fd_identifier_w ctucan_hw_id_to_hwid(canid_t id)
 {
 	union ctu_can_fd_identifier_w hwid;
@@ -465,8 +489,8 @@ bool ctucan_hw_set_mask_filter(struct ctucan_hw_priv *priv, u8 fnum,
 		return false;
 	}
 
-	hwid_mask = ctucan_hw_id_to_hwid(filter->can_id);
-	hwid_val = ctucan_hw_id_to_hwid(filter->can_mask);
+	hwid_mask = ctucan_hw_id_to_hwid(filter->can_mask);
+	hwid_val = ctucan_hw_id_to_hwid(filter->can_id);
 	priv->write_reg(priv, CTU_CAN_FD_FILTER_CONTROL, creg.u32);
 	priv->write_reg(priv, maddr, hwid_mask.u32);
 	priv->write_reg(priv, vaddr, hwid_val.u32);
@@ -495,16 +519,168 @@ void ctucan_hw_set_range_filter(struct ctucan_hw_priv *priv, canid_t low_th,
 	priv->write_reg(priv, CTU_CAN_FD_FILTER_RAN_HIGH, hwid_high.u32);
 }
 
+bool ctucan_hw_get_id_set_filter_support(struct ctucan_hw_priv *priv)
+{
+	union ctu_can_fd_filter_control_filter_status reg;
+
+	reg.u32 = priv->read_reg(priv, CTU_CAN_FD_FILTER_CONTROL);
+
+	return !!reg.s.sfs;
+}
+
+void ctucan_hw_write_id_set_filter(struct ctucan_hw_priv *priv,
+				   enum ctu_can_fd_filter_set_addr_fset_tsel tsel,
+				   u16 addr, u32 data)
+{
+	union ctu_can_fd_filter_set_addr areg;
+
+	areg.u32 = 0;
+	areg.s.fset_addr = addr;
+	areg.s.fset_tsel = tsel;
+
+	priv->write_reg(priv, CTU_CAN_FD_FILTER_SET_ADDR, areg.u32);
+	priv->write_reg(priv, CTU_CAN_FD_FILTER_SET_DATA, data);
+}
+
+void ctucan_hw_set_id_set_filter(struct ctucan_hw_priv *priv, bool enable)
+{
+	union ctu_can_fd_filter_set_ctrl_filter_set_info creg;
+
+	creg.u32 = 0;
+	creg.s.fsnb = enable;
+	creg.s.fsne = enable;
+	creg.s.fsfb = enable;
+	creg.s.fsfe = enable;
+
+	priv->write_reg(priv, CTU_CAN_FD_FILTER_SET_CTRL, creg.u32);
+}
+
+void ctucan_hw_set_filters(struct ctucan_hw_priv *priv,
+			   const struct ctucan_filter *f)
+{
+	static const enum ctu_can_fd_can_registers
+		mask_regs[CTUCANFD_FILTER_MASK_COUNT] = {
+			CTU_CAN_FD_FILTER_A_MASK, CTU_CAN_FD_FILTER_B_MASK,
+			CTU_CAN_FD_FILTER_C_MASK
+	};
+	static const enum ctu_can_fd_can_registers
+		val_regs[CTUCANFD_FILTER_MASK_COUNT] = {
+			CTU_CAN_FD_FILTER_A_VAL, CTU_CAN_FD_FILTER_B_VAL,
+			CTU_CAN_FD_FILTER_C_VAL
+	};
+	union ctu_can_fd_mode_settings mode;
+	u32 ctrl = 0;
+	int i;
+
+	for (i = 0; i < CTUCANFD_FILTER_MASK_COUNT; i++) {
+		if (!ctucan_hw_get_mask_filter_support(priv, i))
+			continue;
+		priv->write_reg(priv, mask_regs[i], f->hw_mask[i].mask);
+		priv->write_reg(priv, val_regs[i], f->hw_mask[i].low);
+		ctrl |= f->hw_mask[i].ctrl << (4 * i);
+	}
+
+	if (ctucan_hw_get_range_filter_support(priv)) {
+		priv->write_reg(priv, CTU_CAN_FD_FILTER_RAN_LOW, f->hw_range.low);
+		priv->write_reg(priv, CTU_CAN_FD_FILTER_RAN_HIGH,
+				f->hw_range.high);
+		ctrl |= f->hw_range.ctrl << 12;
+	}
+
+	priv->write_reg(priv, CTU_CAN_FD_FILTER_CONTROL, ctrl);
+
+	mode.u32 = priv->read_reg(priv, CTU_CAN_FD_MODE);
+	mode.s.afm = f->hw_ena ? AFM_ENABLED : AFM_DISABLED;
+	priv->write_reg(priv, CTU_CAN_FD_MODE, mode.u32);
+}
+
 void ctucan_hw_set_rx_tsop(struct ctucan_hw_priv *priv,
 			   enum ctu_can_fd_rx_settings_rtsop val)
 {
 	union ctu_can_fd_rx_status_rx_settings reg;
 
-	reg.u32 = 0;
+	reg.u32 = priv->read_reg(priv, CTU_CAN_FD_RX_STATUS);
+	reg.u32 &= ~0xFFFF; /* RX_STATUS is read-only */
 	reg.s.rtsop = val;
 	priv->write_reg(priv, CTU_CAN_FD_RX_STATUS, reg.u32);
 }
 
+void ctucan_hw_set_rx_ovf_policy(struct ctucan_hw_priv *priv,
+				 enum ctu_can_fd_rx_settings_rovp val)
+{
+	union ctu_can_fd_rx_status_rx_settings reg;
+
+	reg.u32 = priv->read_reg(priv, CTU_CAN_FD_RX_STATUS);
+	reg.u32 &= ~0xFFFF; /* RX_STATUS is read-only */
+	reg.s.rovp = val;
+	priv->write_reg(priv, CTU_CAN_FD_RX_STATUS, reg.u32);
+}
+
+void ctucan_hw_set_rx_both_ts(struct ctucan_hw_priv *priv, bool enable)
+{
+	union ctu_can_fd_rx_status_rx_settings reg;
+
+	reg.u32 = priv->read_reg(priv, CTU_CAN_FD_RX_STATUS);
+	reg.u32 &= ~0xFFFF; /* RX_STATUS is read-only */
+	reg.s.rtsb = enable ? 1 : 0;
+	priv->write_reg(priv, CTU_CAN_FD_RX_STATUS, reg.u32);
+}
+
+void ctucan_hw_rx_dma_enable(struct ctucan_hw_priv *priv, u32 base, u8 rs,
+			     u8 batch, u16 tmo)
+{
+	union ctu_can_fd_rx_dma_ctrl reg;
+
+	priv->write_reg(priv, CTU_CAN_FD_RX_DMA_BASE, base);
+	ctucan_hw_rx_dma_set_cons(priv, 0);
+
+	reg.u32 = 0;
+	reg.s.rdena = RDMA_ENABLED;
+	reg.s.rdrs = rs;
+	reg.s.rdbatch = batch;
+	reg.s.rdtmo = tmo;
+	priv->write_reg(priv, CTU_CAN_FD_RX_DMA_CTRL, reg.u32);
+}
+
+/* Words of received frame which follow FRAME_FORMAT_W (RWCNT at most) */
+#define CTUCAN_HW_RX_FRAME_WORDS 21
+
+/*
+ * Reads 'count' words of received frame from RX data window. Every read
+ * from the window pops next word of RX Buffer, regardless of the address.
+ * The window is read at incrementing addresses, so with native access the
+ * reads can be merged to a burst (ldm, memcpy like copy).
+ */
+static void ctucan_hw_read_rx_window(struct ctucan_hw_priv *priv, u32 *buf,
+				     unsigned int count)
+{
+	unsigned int i;
+
+	if (priv->read_reg == ctucan_hw_read32 && priv->access64) {
+		/* Two words of RX Buffer per read, lower word is read first */
+		for (i = 0; i + 1 < count; i += 2) {
+			u64 val = ioread64(priv->mem_base +
+					   CTU_CAN_FD_RX_DATA_WINDOW + i * 4);
+
+			buf[i] = (u32)val;
+			buf[i + 1] = (u32)(val >> 32);
+		}
+		if (i < count)
+			buf[i] = ioread32(priv->mem_base +
+					  CTU_CAN_FD_RX_DATA_WINDOW + i * 4);
+		return;
+	}
+
+	if (priv->read_reg == ctucan_hw_read32) {
+		__ioread32_copy(buf, priv->mem_base + CTU_CAN_FD_RX_DATA_WINDOW,
+				count);
+		return;
+	}
+
+	for (i = 0; i < count; i++)
+		buf[i] = priv->read_reg(priv, CTU_CAN_FD_RX_DATA_WINDOW + i * 4);
+}
+
 void ctucan_hw_read_rx_frame(struct ctucan_hw_priv *priv,
 			     struct canfd_frame *cf, u64 *ts)
 {
@@ -517,14 +693,32 @@ void ctucan_hw_read_rx_frame(struct ctucan_hw_priv *priv,
 void ctucan_hw_read_rx_frame_ffw(struct ctucan_hw_priv *priv,
 				 struct canfd_frame *cf, u64 *ts,
 				 union ctu_can_fd_frame_format_w ffw)
+{
+	ctucan_hw_read_rx_frame_ffw_ts(priv, cf, ts, NULL, ffw);
+}
+
+void ctucan_hw_read_rx_frame_ffw_ts(struct ctucan_hw_priv *priv,
+				    struct canfd_frame *cf, u64 *ts,
+				    u64 *eof_ts,
+				    union ctu_can_fd_frame_format_w ffw)
 {
 	union ctu_can_fd_identifier_w idw;
+	u32 rw[CTUCAN_HW_RX_FRAME_WORDS];
+	unsigned int rwcnt = ffw.s.rwcnt;
+	unsigned int min_rwcnt = ctucan_hw_rx_frame_rwcnt(0, ffw.s.ets);
 	unsigned int i;
 	unsigned int wc;
 	unsigned int len;
 	enum ctu_can_fd_frame_format_w_ide ide;
 
-	idw.u32 = priv->read_reg(priv, CTU_CAN_FD_RX_DATA);
+	if (unlikely(rwcnt < min_rwcnt || rwcnt > CTUCAN_HW_RX_FRAME_WORDS))
+		rwcnt = clamp(rwcnt, min_rwcnt,
+			      (unsigned int)CTUCAN_HW_RX_FRAME_WORDS);
+
+	/* Rest of the frame at once */
+	ctucan_hw_read_rx_window(priv, rw, rwcnt);
+
+	idw.u32 = rw[0];
 
 	ide = (enum ctu_can_fd_frame_format_w_ide)ffw.s.ide;
 	cf->can_id = ctucan_hw_hwid_to_id(idw, ide);
@@ -540,7 +734,8 @@ void ctucan_hw_read_rx_frame_ffw(struct ctucan_hw_priv *priv,
 		cf->can_id |= CAN_RTR_FLAG;
 	}
 
-	wc = ffw.s.rwcnt - 3;
+	/* End of frame timestamp is stored after data words */
+	wc = rwcnt - min_rwcnt;
 
 	/* DLC */
 	if (ffw.s.dlc <= 8) {
@@ -556,18 +751,21 @@ void ctucan_hw_read_rx_frame_ffw(struct ctucan_hw_priv *priv,
 		len = wc * 4;
 
 	/* Timestamp */
-	*ts = (u64)(priv->read_reg(priv, CTU_CAN_FD_RX_DATA));
-	*ts |= ((u64)priv->read_reg(priv, CTU_CAN_FD_RX_DATA) << 32);
+	*ts = (u64)rw[1];
+	*ts |= ((u64)rw[2] << 32);
+
+	if (eof_ts) {
+		if (ffw.s.ets) {
+			*eof_ts = (u64)rw[rwcnt - 2];
+			*eof_ts |= ((u64)rw[rwcnt - 1] << 32);
+		} else {
+			*eof_ts = *ts;
+		}
+	}
 
 	/* Data */
-	for (i = 0; i < len; i += 4) {
-		u32 data = priv->read_reg(priv, CTU_CAN_FD_RX_DATA);
-		*(__le32 *)(cf->data + i) = cpu_to_le32(data);
-	}
-	while (unlikely(i < wc * 4)) {
-		priv->read_reg(priv, CTU_CAN_FD_RX_DATA);
-		i += 4;
-	}
+	for (i = 0; i < len; i += 4)
+		*(__le32 *)(cf->data + i) = cpu_to_le32(rw[3 + i / 4]);
 }
 
 enum ctu_can_fd_tx_status_tx1s ctucan_hw_get_tx_status(struct ctucan_hw_priv
@@ -634,6 +832,8 @@ bool ctucan_hw_insert_frame(struct ctucan_hw_priv *priv,
 	enum ctu_can_fd_can_registers buf_base;
 	union ctu_can_fd_frame_format_w ffw;
 	union ctu_can_fd_identifier_w idw;
+	u32 words[4 + CANFD_MAX_DLEN / 4];
+	unsigned int count = 4;
 	unsigned int i;
 
 	ffw.u32 = 0;
@@ -667,27 +867,22 @@ bool ctucan_hw_insert_frame(struct ctucan_hw_priv *priv,
 			ffw.s.brs = BR_SHIFT;
 	}
 
-	ctucan_hw_write_txt_buf(priv, buf_base,
-				CTU_CAN_FD_FRAME_FORMAT_W, ffw.u32);
-
-	ctucan_hw_write_txt_buf(priv, buf_base,
-				CTU_CAN_FD_IDENTIFIER_W, idw.u32);
-
-	ctucan_hw_write_txt_buf(priv, buf_base,
-				CTU_CAN_FD_TIMESTAMP_L_W, (u32)(ts));
-
-	ctucan_hw_write_txt_buf(priv, buf_base,
-				CTU_CAN_FD_TIMESTAMP_U_W, (u32)(ts >> 32));
+	/* Words in TXT Buffer order: FRAME_FORMAT_W, IDENTIFIER_W,
+	 * TIMESTAMP_L_W, TIMESTAMP_U_W, DATA_1_4_W, ...
+	 */
+	words[CTU_CAN_FD_FRAME_FORMAT_W / 4] = ffw.u32;
+	words[CTU_CAN_FD_IDENTIFIER_W / 4] = idw.u32;
+	words[CTU_CAN_FD_TIMESTAMP_L_W / 4] = (u32)(ts);
+	words[CTU_CAN_FD_TIMESTAMP_U_W / 4] = (u32)(ts >> 32);
 
 	if (!(cf->can_id & CAN_RTR_FLAG)) {
-		for (i = 0; i < cf->len; i += 4) {
-			u32 data = le32_to_cpu(*(__le32 *)(cf->data + i));
-
-			ctucan_hw_write_txt_buf(priv, buf_base,
-						CTU_CAN_FD_DATA_1_4_W + i, data);
-		}
+		for (i = 0; i < cf->len; i += 4)
+			words[count++] =
+				le32_to_cpu(*(__le32 *)(cf->data + i));
 	}
 
+	ctucan_hw_write_txt_buf_words(priv, buf_base, words, count);
+
 	return true;
 }
 
@@ -697,6 +892,14 @@ u64 ctucan_hw_read_timestamp(struct ctucan_hw_priv *priv)
 	union ctu_can_fd_timestamp_high ts_high;
 	union ctu_can_fd_timestamp_high ts_high_2;
 
+	if (priv->ts_high_latch) {
+		/* Read of TIMESTAMP_LOW latches TIMESTAMP_HIGH, order matters */
+		ts_low.u32 = priv->read_reg(priv, CTU_CAN_FD_TIMESTAMP_LOW);
+		ts_high.u32 = priv->read_reg(priv, CTU_CAN_FD_TIMESTAMP_HIGH);
+
+		return (((u64)ts_high.u32) << 32) | ((u64)ts_low.u32);
+	}
+
 	ts_high.u32 = priv->read_reg(priv, CTU_CAN_FD_TIMESTAMP_HIGH);
 	ts_low.u32 = priv->read_reg(priv, CTU_CAN_FD_TIMESTAMP_LOW);
 	ts_high_2.u32 = priv->read_reg(priv, CTU_CAN_FD_TIMESTAMP_HIGH);
@@ -725,3 +928,185 @@ void ctucan_hw_configure_ssp(struct ctucan_hw_priv *priv, bool enable_ssp,
 	ssp_cfg.s.ssp_offset = (uint32_t)ssp_offset;
 	priv->write_reg(priv, CTU_CAN_FD_TRV_DELAY, ssp_cfg.u32);
 }
+
+void ctucan_hw_trv_stats_init(struct ctucan_hw_trv_stats *stats)
+{
+	memset(stats, 0, sizeof(*stats));
+	stats->min = CTU_CAN_FD_TRV_DELAY_MAX;
+}
+
+void ctucan_hw_trv_stats_add(struct ctucan_hw_trv_stats *stats, u16 trv_delay)
+{
+	if (trv_delay > CTU_CAN_FD_TRV_DELAY_MAX)
+		trv_delay = CTU_CAN_FD_TRV_DELAY_MAX;
+
+	stats->hist[trv_delay]++;
+	stats->count++;
+	stats->sum += trv_delay;
+	if (trv_delay < stats->min)
+		stats->min = trv_delay;
+	if (trv_delay > stats->max)
+		stats->max = trv_delay;
+}
+
+u16 ctucan_hw_trv_stats_median(const struct ctucan_hw_trv_stats *stats)
+{
+	u32 acc = 0;
+	u16 i;
+
+	if (!stats->count)
+		return 0;
+
+	for (i = 0; i <= CTU_CAN_FD_TRV_DELAY_MAX; i++) {
+		acc += stats->hist[i];
+		if (acc * 2 >= stats->count)
+			break;
+	}
+	return i;
+}
+
+int ctucan_hw_calc_ssp_pos(const struct ctucan_hw_trv_stats *stats,
+			   const struct can_bittiming *dbt)
+{
+	int ssp_pos;
+
+	/* Sample point within data bit in system clock cycles */
+	ssp_pos = dbt->brp * (1 + dbt->prop_seg + dbt->phase_seg1);
+	ssp_pos += ctucan_hw_trv_stats_median(stats);
+
+	if (ssp_pos > CTU_CAN_FD_SSP_POS_MAX)
+		ssp_pos = CTU_CAN_FD_SSP_POS_MAX;
+
+	return ssp_pos;
+}
+
+int ctucan_hw_measure_trv_delay(struct ctucan_hw_priv *priv,
+				struct ctucan_hw_trv_stats *stats,
+				unsigned int count, u8 buf,
+				void (*poll)(void))
+{
+	enum ctu_can_fd_tx_status_tx1s status;
+	struct canfd_frame cf;
+	unsigned int i;
+	int done = 0;
+	int t;
+
+	memset(&cf, 0, sizeof(cf));
+	cf.can_id = 0x7FF;
+	cf.flags = CANFD_BRS;
+	cf.len = 8;
+
+	for (i = 0; i < count; i++) {
+		ctucan_hw_txt_set_empty(priv, buf);
+		cf.data[0] = (u8)i;
+		if (!ctucan_hw_insert_frame(priv, &cf, 0, buf, true))
+			break;
+		ctucan_hw_txt_set_rdy(priv, buf);
+
+		for (t = 0; t < CTU_CAN_FD_TRV_MEAS_POLLS; t++) {
+			if (poll)
+				poll();
+			status = ctucan_hw_get_tx_status(priv, buf);
+			if (status != TXT_RDY && status != TXT_TRAN &&
+			    status != TXT_ABTP)
+				break;
+		}
+
+		/* Frame stuck (e.g. no clock or bus), do not leave it pending */
+		if (t == CTU_CAN_FD_TRV_MEAS_POLLS)
+			ctucan_hw_txt_set_abort(priv, buf);
+
+		/* Delay is measured only in frames which finished OK */
+		if (status != TXT_TOK)
+			break;
+
+		ctucan_hw_trv_stats_add(stats, ctucan_hw_get_tran_delay(priv));
+		done++;
+	}
+
+	ctucan_hw_txt_set_empty(priv, buf);
+
+	return done;
+}
+
+u32 ctucan_hw_frame_time(const struct canfd_frame *cf, bool isfdf,
+			 u32 nbt_ns, u32 dbt_ns)
+{
+	bool ide = !!(cf->can_id & CAN_EFF_FLAG);
+	u32 len = (cf->can_id & CAN_RTR_FLAG) ? 0 : cf->len;
+	u32 nbits, dbits = 0;
+
+	if (!isfdf)
+		return ((ide ? 67 : 47) + 8 * len) * nbt_ns;
+
+	/* SOF .. BRS and CRC delimiter .. intermission in nominal bit-rate */
+	nbits = (ide ? 36 : 17) + 13;
+
+	/* ESI, DLC, data, stuff count, CRC with fixed stuff bits */
+	dbits = 5 + 8 * len + 5 + (len > 16 ? 21 + 6 : 17 + 5);
+
+	if (!(cf->flags & CANFD_BRS))
+		dbt_ns = nbt_ns;
+
+	return nbits * nbt_ns + dbits * dbt_ns;
+}
+
+void ctucan_hw_txsched_prio(const struct ctucan_hw_txb_frame *txb,
+			    unsigned int count, u32 seq_next, u8 *prio)
+{
+	bool assigned[8];
+	unsigned int i, j;
+	u8 level = 7;
+
+	/* TX_PRIORITY register holds at most 8 TXT Buffers */
+	if (count > 8)
+		count = 8;
+
+	for (i = 0; i < count; i++) {
+		assigned[i] = !txb[i].pending;
+		prio[i] = 0;
+	}
+
+	while (1) {
+		int best = -1;
+		bool best_starving = false;
+
+		for (i = 0; i < count; i++) {
+			bool starving;
+
+			if (assigned[i])
+				continue;
+
+			/* Older frame with the same CAN ID must be sent first */
+			for (j = 0; j < count; j++) {
+				if (!assigned[j] && txb[j].can_id == txb[i].can_id &&
+				    (int32_t)(txb[j].seq - txb[i].seq) < 0)
+					break;
+			}
+			if (j < count)
+				continue;
+
+			starving = seq_next - txb[i].seq > 2 * count;
+
+			if (best < 0 ||
+			    (starving && !best_starving) ||
+			    (starving == best_starving && starving &&
+			     (int32_t)(txb[i].seq - txb[best].seq) < 0) ||
+			    (starving == best_starving && !starving &&
+			     (txb[i].time_ns < txb[best].time_ns ||
+			      (txb[i].time_ns == txb[best].time_ns &&
+			       (int32_t)(txb[i].seq - txb[best].seq) < 0)))) {
+				best = i;
+				best_starving = starving;
+			}
+		}
+
+		if (best < 0)
+			break;
+
+		prio[best] = level;
+		if (level)
+			level--;
+		assigned[best] = true;
+	}
+}
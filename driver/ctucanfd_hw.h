@@ -52,6 +52,9 @@
 #define CTU_CAN_FD_TXT_BUFFER_3 2
 #define CTU_CAN_FD_TXT_BUFFER_4 3
 
+/* First core version (major * 10 + minor) which latches TIMESTAMP_HIGH */
+#define CTU_CAN_FD_VER_TS_HIGH_LATCH 25
+
 /*
  * Status macros -> pass "ctu_can_get_status" result
  */
@@ -128,6 +131,17 @@ struct ctucan_hw_priv {
 			enum ctu_can_fd_can_registers reg);
 	void (*write_reg)(struct ctucan_hw_priv *priv,
 			  enum ctu_can_fd_can_registers reg, u32 val);
+	/*
+	 * Core is attached via 64-bit bus (can_top_axi). RX data window and
+	 * TXT Buffer data are then accessed by 64-bit reads / writes, when
+	 * native little-endian accessors are used.
+	 */
+	bool access64;
+	/*
+	 * Read of TIMESTAMP_LOW latches TIMESTAMP_HIGH. Set from core version,
+	 * see CTU_CAN_FD_VER_TS_HIGH_LATCH.
+	 */
+	bool ts_high_latch;
 };
 
 void ctucan_hw_write32(struct ctucan_hw_priv *priv,
@@ -592,6 +606,55 @@ bool ctucan_hw_set_mask_filter(struct ctucan_hw_priv *priv, u8 fnum,
 void ctucan_hw_set_range_filter(struct ctucan_hw_priv *priv, canid_t low_th,
 				canid_t high_th, bool enable);
 
+/**
+ * ctucan_hw_get_id_set_filter_support - Check ID set filter support.
+ *
+ * @priv: Private info
+ * Return: True if ID set filter is present and can be used, False otherwise.
+ */
+bool ctucan_hw_get_id_set_filter_support(struct ctucan_hw_priv *priv);
+
+/**
+ * ctucan_hw_write_id_set_filter - Write word of ID set filter memory.
+ *
+ * Bitmap word N holds Base identifiers N * 32 ... N * 32 + 31 (bit 0 is the
+ * lowest identifier). Hash table entry is valid when bit 31 is set, bits
+ * 28:0 hold Extended identifier. Memories are not reset, so both must be
+ * fully written before the filter is enabled.
+ *
+ * @priv: Private info
+ * @tsel: Target memory (Base ID bitmap or Extended ID hash table)
+ * @addr: Word address within the memory
+ * @data: Data to write
+ */
+void ctucan_hw_write_id_set_filter(struct ctucan_hw_priv *priv,
+				   enum ctu_can_fd_filter_set_addr_fset_tsel tsel,
+				   u16 addr, u32 data);
+
+/**
+ * ctucan_hw_set_id_set_filter - Enable or disable ID set filter for all
+ *                                frame and identifier types.
+ *
+ * @priv: Private info
+ * @enable: Enable the ID set filter.
+ */
+void ctucan_hw_set_id_set_filter(struct ctucan_hw_priv *priv, bool enable);
+
+struct ctucan_filter;
+
+/**
+ * ctucan_hw_set_filters - Configure all filters of CTU CAN FD Core from
+ *                          compiled filter set (see ctucanfd_filter.h).
+ *
+ * Filters which are not synthesized are skipped. Acceptance filter mode
+ * is enabled only when filter set requires hardware filtering.
+ *
+ * @priv: Private info
+ * @f: Compiled filter set
+ */
+void ctucan_hw_set_filters(struct ctucan_hw_priv *priv,
+			   const struct ctucan_filter *f);
+
 /**
  * ctucan_hw_get_rx_fifo_size - Get size of the RX FIFO Buffer
  *                               of CTU CAN FD Core.
@@ -674,6 +737,372 @@ static inline u16 ctucan_hw_get_rx_frame_count(struct ctucan_hw_priv *priv)
 void ctucan_hw_set_rx_tsop(struct ctucan_hw_priv *priv,
 			   enum ctu_can_fd_rx_settings_rtsop val);
 
+/**
+ * ctucan_hw_set_rx_ovf_policy - Set RX FIFO overflow policy.
+ *
+ * With ROVP_DROP_OLD, oldest frames are discarded from RX FIFO to make room
+ * for received frame. Number of discarded frames is available via
+ * ctucan_hw_get_rx_drop_ctr.
+ *
+ * @priv: Private info
+ * @val: Overflow policy.
+ */
+void ctucan_hw_set_rx_ovf_policy(struct ctucan_hw_priv *priv,
+				 enum ctu_can_fd_rx_settings_rovp val);
+
+/**
+ * ctucan_hw_set_rx_both_ts - Store both SOF and EOF timestamps of RX Frame.
+ *
+ * When enabled, SOF timestamp is stored in place of regular timestamp and
+ * EOF timestamp is appended after data words (FRAME_FORMAT_W[ETS] is set).
+ * Use ctucan_hw_read_rx_frame_ffw_ts to read it.
+ *
+ * @priv: Private info
+ * @enable: Store both timestamps.
+ */
+void ctucan_hw_set_rx_both_ts(struct ctucan_hw_priv *priv, bool enable);
+
+/**
+ * ctucan_hw_get_rx_drop_ctr - Read number of frames discarded from RX FIFO
+ *                              to make room for received frames.
+ *
+ * @priv: Private info
+ * Return: Number of discarded frames.
+ */
+static inline u32 ctucan_hw_get_rx_drop_ctr(struct ctucan_hw_priv *priv)
+{
+	union ctu_can_fd_rx_drop_ctr reg;
+
+	reg.u32 = priv->read_reg(priv, CTU_CAN_FD_RX_DROP_CTR);
+	return reg.s.rx_drop_ctr_val;
+}
+
+/**
+ * ctucan_hw_rx_dma_sup - Check whether RX DMA is synthesized.
+ *
+ * @priv: Private info
+ * Return: true if RX DMA is present.
+ */
+static inline bool ctucan_hw_rx_dma_sup(struct ctucan_hw_priv *priv)
+{
+	union ctu_can_fd_status reg;
+
+	reg.u32 = priv->read_reg(priv, CTU_CAN_FD_STATUS);
+	return reg.s.srdma;
+}
+
+/**
+ * ctucan_hw_rx_dma_enable - Configure RX DMA ring and enable RX DMA.
+ *
+ * Ring has 2^rs slots of 128 bytes, starting at base. Producer and consumer
+ * indices must be 0 (RX DMA disabled before).
+ *
+ * @priv: Private info
+ * @base: Bus address of the ring, aligned to 128 bytes.
+ * @rs: Log2 of number of ring slots (1 - 12).
+ * @batch: Number of frames moved per DMAI interrupt.
+ * @tmo: DMAI timeout in units of 256 system clock cycles (0 - no timeout).
+ */
+void ctucan_hw_rx_dma_enable(struct ctucan_hw_priv *priv, u32 base, u8 rs,
+			     u8 batch, u16 tmo);
+
+/**
+ * ctucan_hw_rx_dma_disable - Disable RX DMA.
+ *
+ * RX DMA finishes frame it is moving, then producer index and bus error flag
+ * are cleared. Wait until ctucan_hw_rx_dma_active returns false before ring
+ * memory is released.
+ *
+ * @priv: Private info
+ */
+static inline void ctucan_hw_rx_dma_disable(struct ctucan_hw_priv *priv)
+{
+	priv->write_reg(priv, CTU_CAN_FD_RX_DMA_CTRL, 0);
+}
+
+/**
+ * ctucan_hw_rx_dma_active - Check whether RX DMA is moving a frame.
+ *
+ * @priv: Private info
+ * Return: true if frame is being moved.
+ */
+static inline bool ctucan_hw_rx_dma_active(struct ctucan_hw_priv *priv)
+{
+	union ctu_can_fd_rx_dma_status reg;
+
+	reg.u32 = priv->read_reg(priv, CTU_CAN_FD_RX_DMA_STATUS);
+	return reg.s.rdact;
+}
+
+/**
+ * ctucan_hw_rx_dma_get_prod - Read RX DMA producer index.
+ *
+ * Slots from consumer index up to producer index hold received frames.
+ *
+ * @priv: Private info
+ * @berr: Set to true if RX DMA stopped due to bus error.
+ * Return: Producer index.
+ */
+static inline u16 ctucan_hw_rx_dma_get_prod(struct ctucan_hw_priv *priv,
+					    bool *berr)
+{
+	union ctu_can_fd_rx_dma_status reg;
+
+	reg.u32 = priv->read_reg(priv, CTU_CAN_FD_RX_DMA_STATUS);
+	*berr = reg.s.rdberr;
+	return reg.s.rdprod;
+}
+
+/**
+ * ctucan_hw_rx_dma_set_cons - Write RX DMA consumer index.
+ *
+ * @priv: Private info
+ * @cons: Index of next slot to be read by SW.
+ */
+static inline void ctucan_hw_rx_dma_set_cons(struct ctucan_hw_priv *priv,
+					     u16 cons)
+{
+	union ctu_can_fd_rx_dma_cons reg;
+
+	reg.u32 = 0;
+	reg.s.rdcons = cons;
+	priv->write_reg(priv, CTU_CAN_FD_RX_DMA_CONS, reg.u32);
+}
+
+/**
+ * ctucan_hw_tx_fifo_depth - Get depth of TXT FIFO.
+ *
+ * TXT FIFO takes place of the last TXT buffer.
+ *
+ * @priv: Private info
+ * Return: Number of frames TXT FIFO can hold, 0 if TXT FIFO is not synthesized.
+ */
+static inline u8 ctucan_hw_tx_fifo_depth(struct ctucan_hw_priv *priv)
+{
+	union ctu_can_fd_status stat;
+	union ctu_can_fd_tx_fifo_ctrl_tx_fifo_status reg;
+
+	stat.u32 = priv->read_reg(priv, CTU_CAN_FD_STATUS);
+	if (!stat.s.stxf)
+		return 0;
+
+	reg.u32 = priv->read_reg(priv, CTU_CAN_FD_TX_FIFO_CTRL);
+	return reg.s.tfdepth;
+}
+
+/**
+ * ctucan_hw_tx_fifo_set_th - Set TXT FIFO threshold.
+ *
+ * TFTI interrupt is set when number of frames in TXT FIFO drops to threshold.
+ *
+ * @priv: Private info
+ * @th: Threshold (number of frames).
+ */
+static inline void ctucan_hw_tx_fifo_set_th(struct ctucan_hw_priv *priv, u8 th)
+{
+	union ctu_can_fd_tx_fifo_ctrl_tx_fifo_status reg;
+
+	reg.u32 = 0;
+	reg.s.tfth = th;
+	priv->write_reg(priv, CTU_CAN_FD_TX_FIFO_CTRL, reg.u32);
+}
+
+/**
+ * ctucan_hw_tx_fifo_get_fill - Get number of frames in TXT FIFO.
+ *
+ * @priv: Private info
+ * @full: Set to true if TXT FIFO is full.
+ * Return: Number of frames in TXT FIFO.
+ */
+static inline u8 ctucan_hw_tx_fifo_get_fill(struct ctucan_hw_priv *priv,
+					    bool *full)
+{
+	union ctu_can_fd_tx_fifo_ctrl_tx_fifo_status reg;
+
+	reg.u32 = priv->read_reg(priv, CTU_CAN_FD_TX_FIFO_CTRL);
+	*full = reg.s.tffull;
+	return reg.s.tffl;
+}
+
+/**
+ * ctucan_hw_int_ts_sup - Check whether interrupt timestamps are synthesized.
+ *
+ * @priv: Private info
+ * Return: true if INT_TS_SEL and INT_TS registers are present.
+ */
+static inline bool ctucan_hw_int_ts_sup(struct ctucan_hw_priv *priv)
+{
+	union ctu_can_fd_status stat;
+
+	stat.u32 = priv->read_reg(priv, CTU_CAN_FD_STATUS);
+	return stat.s.sits;
+}
+
+/**
+ * ctucan_hw_read_int_ts - Read timestamp at which interrupt became pending.
+ *
+ * Only lower 32 bits of timestamp are latched by the core.
+ *
+ * @priv: Private info
+ * @int_index: Index of interrupt as in INT_STAT register.
+ * Return: Lower 32 bits of timestamp when interrupt became pending.
+ */
+static inline u32 ctucan_hw_read_int_ts(struct ctucan_hw_priv *priv,
+					unsigned int int_index)
+{
+	union ctu_can_fd_int_ts_sel sel;
+	union ctu_can_fd_int_ts reg;
+
+	sel.u32 = 0;
+	sel.s.itsel = int_index;
+	priv->write_reg(priv, CTU_CAN_FD_INT_TS_SEL, sel.u32);
+
+	reg.u32 = priv->read_reg(priv, CTU_CAN_FD_INT_TS);
+	return reg.s.its_val;
+}
+
+/**
+ * ctucan_hw_bus_stat_snapshot - Store bus statistics counters to snapshot
+ *                               registers and clear them.
+ *
+ * @priv: Private info
+ */
+static inline void ctucan_hw_bus_stat_snapshot(struct ctucan_hw_priv *priv)
+{
+	union ctu_can_fd_command reg;
+
+	reg.u32 = 0;
+	reg.s.bssnap = 1;
+	priv->write_reg(priv, CTU_CAN_FD_COMMAND, reg.u32);
+}
+
+/**
+ * ctucan_hw_read_bus_stat - Read snapshot of bus statistics counter.
+ *
+ * @priv: Private info
+ * @sel: Counter to read.
+ * Return: Value of counter at last snapshot.
+ */
+static inline u32 ctucan_hw_read_bus_stat(struct ctucan_hw_priv *priv,
+					  enum ctu_can_fd_bus_stat_sel_bssel sel)
+{
+	union ctu_can_fd_bus_stat_sel reg_sel;
+	union ctu_can_fd_bus_stat reg;
+
+	reg_sel.u32 = 0;
+	reg_sel.s.bssel = sel;
+	priv->write_reg(priv, CTU_CAN_FD_BUS_STAT_SEL, reg_sel.u32);
+
+	reg.u32 = priv->read_reg(priv, CTU_CAN_FD_BUS_STAT);
+	return reg.s.bs_val;
+}
+
+/**
+ * ctucan_hw_tx_ts_sup - Check whether transmission start timestamps are
+ *                       synthesized.
+ *
+ * @priv: Private info
+ * Return: true if TXTB_TS_SEL, TXTB_TS_LOW and TXTB_TS_HIGH registers are
+ *         present.
+ */
+static inline bool ctucan_hw_tx_ts_sup(struct ctucan_hw_priv *priv)
+{
+	union ctu_can_fd_status stat;
+
+	stat.u32 = priv->read_reg(priv, CTU_CAN_FD_STATUS);
+	return stat.s.stxts;
+}
+
+/**
+ * ctucan_hw_read_tx_ts - Read timestamp at which last transmission from TXT
+ *                        Buffer started (SOF).
+ *
+ * Timestamp is captured at each transmission attempt, so after successful
+ * transmission it belongs to the transmitted frame.
+ *
+ * @priv: Private info
+ * @buf: TXT Buffer index (CTU_CAN_FD_TXT_BUFFER_1 ...)
+ * Return: Transmission start timestamp.
+ */
+static inline u64 ctucan_hw_read_tx_ts(struct ctucan_hw_priv *priv, u8 buf)
+{
+	union ctu_can_fd_txtb_ts_sel sel;
+	union ctu_can_fd_txtb_ts_low low;
+	union ctu_can_fd_txtb_ts_high high;
+
+	sel.u32 = 0;
+	sel.s.ttsel = buf - CTU_CAN_FD_TXT_BUFFER_1;
+	priv->write_reg(priv, CTU_CAN_FD_TXTB_TS_SEL, sel.u32);
+
+	low.u32 = priv->read_reg(priv, CTU_CAN_FD_TXTB_TS_LOW);
+	high.u32 = priv->read_reg(priv, CTU_CAN_FD_TXTB_TS_HIGH);
+	return ((u64)high.s.txtb_ts_high << 32) | low.s.txtb_ts_low;
+}
+
+/**
+ * ctucan_hw_ts_gen_sup - Check whether internal timestamp generator is
+ *                        synthesized.
+ *
+ * @priv: Private info
+ * Return: true if TS_INC, TS_STEP_LOW and TS_STEP_HIGH registers are present.
+ */
+static inline bool ctucan_hw_ts_gen_sup(struct ctucan_hw_priv *priv)
+{
+	union ctu_can_fd_status stat;
+
+	stat.u32 = priv->read_reg(priv, CTU_CAN_FD_STATUS);
+	return stat.s.stsg;
+}
+
+/**
+ * ctucan_hw_set_ts_inc - Set increment of internal timestamp generator.
+ *
+ * Timestamp is incremented by @inc / 2^24 in each clock cycle of the core.
+ *
+ * @priv: Private info
+ * @inc: Increment in 8.24 fixed point format.
+ */
+static inline void ctucan_hw_set_ts_inc(struct ctucan_hw_priv *priv, u32 inc)
+{
+	priv->write_reg(priv, CTU_CAN_FD_TS_INC, inc);
+}
+
+/**
+ * ctucan_hw_step_ts - Add offset to timestamp of internal timestamp generator.
+ *
+ * @priv: Private info
+ * @delta: Offset to be added (may be negative).
+ */
+static inline void ctucan_hw_step_ts(struct ctucan_hw_priv *priv, s64 delta)
+{
+	union ctu_can_fd_command cmd;
+
+	priv->write_reg(priv, CTU_CAN_FD_TS_STEP_LOW, (u32)delta);
+	priv->write_reg(priv, CTU_CAN_FD_TS_STEP_HIGH, (u32)((u64)delta >> 32));
+
+	cmd.u32 = 0;
+	cmd.s.tsstep = 1;
+	priv->write_reg(priv, CTU_CAN_FD_COMMAND, cmd.u32);
+}
+
+/**
+ * ctucan_hw_set_ts - Set timestamp of internal timestamp generator.
+ *
+ * @priv: Private info
+ * @ts: New timestamp value.
+ */
+static inline void ctucan_hw_set_ts(struct ctucan_hw_priv *priv, u64 ts)
+{
+	union ctu_can_fd_command cmd;
+
+	priv->write_reg(priv, CTU_CAN_FD_TS_STEP_LOW, (u32)ts);
+	priv->write_reg(priv, CTU_CAN_FD_TS_STEP_HIGH, (u32)(ts >> 32));
+
+	cmd.u32 = 0;
+	cmd.s.tsset = 1;
+	priv->write_reg(priv, CTU_CAN_FD_COMMAND, cmd.u32);
+}
+
 /**
  * ctu_can_fd_read_rx_ffw - Reads the first word of CAN Frame from RX FIFO
  *                          Buffer.
@@ -703,6 +1132,75 @@ static inline u32 ctucan_hw_read_rx_word(struct ctucan_hw_priv *priv)
 	return priv->read_reg(priv, CTU_CAN_FD_RX_DATA);
 }
 
+/**
+ * ctucan_hw_rx_frame_rwcnt - Returns RWCNT of CAN Frame stored in RX Buffer.
+ *
+ * Frame occupies RWCNT + 1 words of RX Buffer (FRAME_FORMAT_W is not counted).
+ *
+ * @len: Data length in bytes, 0 for RTR frames.
+ * @ets: Frame is stored with end of frame timestamp.
+ * Return: Number of words following FRAME_FORMAT_W.
+ */
+static inline unsigned int ctucan_hw_rx_frame_rwcnt(unsigned int len, bool ets)
+{
+	/* IDENTIFIER_W, TIMESTAMP_L_W, TIMESTAMP_U_W, data, EOF timestamp */
+	return 3 + (len + 3) / 4 + (ets ? 2 : 0);
+}
+
+/**
+ * ctucan_hw_rx_peek_sup - Check whether RX frame header peek and skip are
+ *                         synthesized.
+ *
+ * @priv: Private info
+ * Return: true if RX_PEEK_FFW, RX_PEEK_IDW registers and RXSKIP command are
+ *         present.
+ */
+static inline bool ctucan_hw_rx_peek_sup(struct ctucan_hw_priv *priv)
+{
+	union ctu_can_fd_status stat;
+
+	stat.u32 = priv->read_reg(priv, CTU_CAN_FD_STATUS);
+	return stat.s.srxpk;
+}
+
+/**
+ * ctucan_hw_rx_peek - Reads header of the oldest frame in RX Buffer without
+ *                     removing it.
+ *
+ * Header is fetched by the core in background, it is not available right
+ * after frame was stored, or when reading of the frame was already started.
+ *
+ * @priv: Private info
+ * @idw: Pointer to IDENTIFIER_W of the oldest frame.
+ * Return: FRAME_FORMAT_W of the oldest frame, zero if not available.
+ */
+static inline union ctu_can_fd_frame_format_w
+ctucan_hw_rx_peek(struct ctucan_hw_priv *priv, union ctu_can_fd_identifier_w *idw)
+{
+	union ctu_can_fd_frame_format_w ffw;
+
+	ffw.u32 = priv->read_reg(priv, CTU_CAN_FD_RX_PEEK_FFW);
+	idw->u32 = priv->read_reg(priv, CTU_CAN_FD_RX_PEEK_IDW);
+	return ffw;
+}
+
+/**
+ * ctucan_hw_rx_skip_frame - Removes the oldest frame from RX Buffer without
+ *                           reading it.
+ *
+ * When reading of the frame was already started, rest of the frame is removed.
+ *
+ * @priv: Private info
+ */
+static inline void ctucan_hw_rx_skip_frame(struct ctucan_hw_priv *priv)
+{
+	union ctu_can_fd_command cmd;
+
+	cmd.u32 = 0;
+	cmd.s.rxskip = 1;
+	priv->write_reg(priv, CTU_CAN_FD_COMMAND, cmd.u32);
+}
+
 /**
  * ctucan_hw_read_rx_frame - Reads CAN Frame from RX FIFO Buffer and stores it
  *                            to a buffer.
@@ -727,6 +1225,23 @@ void ctucan_hw_read_rx_frame_ffw(struct ctucan_hw_priv *priv,
 				 struct canfd_frame *cf, u64 *ts,
 				 union ctu_can_fd_frame_format_w ffw);
 
+/**
+ * ctucan_hw_read_rx_frame_ffw_ts - Reads rest of CAN Frame from RX FIFO Buffer
+ *                                   together with end of frame timestamp.
+ *
+ * @priv: Private info
+ * @cf: Pointer to buffer where the CAN Frame should be stored.
+ * @ts: Pointer to u64 where RX Timestamp (TIMESTAMP_L_W/U_W) should be stored.
+ * @eof_ts: Pointer to u64 where end of frame timestamp should be stored, may
+ *          be NULL. If the frame was stored without it (FRAME_FORMAT_W[ETS]
+ *          not set), value of @ts is stored.
+ * @ffw: Already read the first frame control word by the caller
+ */
+void ctucan_hw_read_rx_frame_ffw_ts(struct ctucan_hw_priv *priv,
+				    struct canfd_frame *cf, u64 *ts,
+				    u64 *eof_ts,
+				    union ctu_can_fd_frame_format_w ffw);
+
 /**
  * ctucan_hw_get_tx_status - Returns status of TXT Buffer.
  *
@@ -817,6 +1332,111 @@ static inline void ctucan_hw_txt_set_abort(struct ctucan_hw_priv *priv, u8 buf)
 	ctucan_hw_txt_buf_give_command(priv, cmd, buf);
 }
 
+/**
+ * ctucan_hw_txt_cyc_sup - Check whether cyclic transmission from TXT Buffers
+ *                         is synthesized.
+ *
+ * @priv: Private info
+ * Return: true if TXT_CYC_SEL, TXT_CYC_SKIP and TXT_CYC_PERIOD registers are
+ *         present.
+ */
+static inline bool ctucan_hw_txt_cyc_sup(struct ctucan_hw_priv *priv)
+{
+	union ctu_can_fd_status stat;
+
+	stat.u32 = priv->read_reg(priv, CTU_CAN_FD_STATUS);
+	return stat.s.stcyc;
+}
+
+/**
+ * ctucan_hw_txt_set_cyc_period - Set period of cyclic transmission from TXT
+ *                                Buffer.
+ *
+ * With non-zero period, TXT Buffer returns to Ready after each successful
+ * transmission and it is transmitted again one period after previous
+ * slot. First slot starts with the first transmission after "set_ready".
+ * Cyclic transmission is ended by "set_abort", or by zero period (after
+ * next transmission). Skip counter of the buffer is cleared.
+ *
+ * @priv: Private info
+ * @buf: TXT Buffer index (CTU_CAN_FD_TXT_BUFFER_1 ...)
+ * @period: Period in timestamp units, 0 disables cyclic transmission.
+ */
+static inline void ctucan_hw_txt_set_cyc_period(struct ctucan_hw_priv *priv,
+						u8 buf, u32 period)
+{
+	union ctu_can_fd_txt_cyc_sel_txt_cyc_skip sel;
+
+	sel.u32 = 0;
+	sel.s.tcsel = buf - CTU_CAN_FD_TXT_BUFFER_1;
+	priv->write_reg(priv, CTU_CAN_FD_TXT_CYC_SEL, sel.u32);
+	priv->write_reg(priv, CTU_CAN_FD_TXT_CYC_PERIOD, period);
+}
+
+/**
+ * ctucan_hw_txt_get_cyc_skip - Read number of skipped slots of cyclic
+ *                              transmission from TXT Buffer.
+ *
+ * Slot is skipped when transmission in the slot did not start (e.g. due to
+ * lost arbitration) before the following slot elapsed.
+ *
+ * @priv: Private info
+ * @buf: TXT Buffer index (CTU_CAN_FD_TXT_BUFFER_1 ...)
+ * Return: Skipped slots since period was set, saturates at 0xFFFF.
+ */
+static inline u16 ctucan_hw_txt_get_cyc_skip(struct ctucan_hw_priv *priv,
+					     u8 buf)
+{
+	union ctu_can_fd_txt_cyc_sel_txt_cyc_skip sel;
+
+	sel.u32 = 0;
+	sel.s.tcsel = buf - CTU_CAN_FD_TXT_BUFFER_1;
+	priv->write_reg(priv, CTU_CAN_FD_TXT_CYC_SEL, sel.u32);
+
+	sel.u32 = priv->read_reg(priv, CTU_CAN_FD_TXT_CYC_SEL);
+	return sel.s.tcskip;
+}
+
+/**
+ * ctucan_hw_tx_cpl_sup - Check whether TX completion FIFO is synthesized.
+ *
+ * @priv: Private info
+ * Return: true if TX_CPL and TX_CPL_TS registers are present.
+ */
+static inline bool ctucan_hw_tx_cpl_sup(struct ctucan_hw_priv *priv)
+{
+	union ctu_can_fd_status stat;
+
+	stat.u32 = priv->read_reg(priv, CTU_CAN_FD_STATUS);
+	return stat.s.stcpl;
+}
+
+/**
+ * ctucan_hw_tx_cpl_pop - Read and remove the oldest record of TX completion
+ *                        FIFO.
+ *
+ * Record is stored each time a TXT Buffer moves to TX OK, TX failed or
+ * Aborted. TXT Buffers finishing in the same clock cycle are stored lowest
+ * index first. Cyclic TXT Buffer produces a record only when it fails or is
+ * aborted.
+ *
+ * @priv: Private info
+ * @ts: If not NULL, lower 32 bits of timestamp when the TXT Buffer finished
+ *      are stored here (one more register access).
+ * Return: Record, "tcv" is 0 if the FIFO was empty. "tcof" is set if records
+ *         were lost since the previous read.
+ */
+static inline union ctu_can_fd_tx_cpl
+ctucan_hw_tx_cpl_pop(struct ctucan_hw_priv *priv, u32 *ts)
+{
+	union ctu_can_fd_tx_cpl cpl;
+
+	if (ts)
+		*ts = priv->read_reg(priv, CTU_CAN_FD_TX_CPL_TS);
+	cpl.u32 = priv->read_reg(priv, CTU_CAN_FD_TX_CPL);
+	return cpl;
+}
+
 /**
  * ctucan_hw_set_txt_priority - Set priority of TXT Buffers in CTU CAN FD Core.
  *
@@ -908,8 +1528,9 @@ static inline union ctu_can_fd_debug_register
  * ctucan_hw_read_timestamp - Read timestamp value which is used internally
  *                             by CTU CAN FD Core.
  *
- * Reads timestamp twice and checks consistency betwen upper and
- * lower timestamp word.
+ * On cores which latch upper timestamp word (ts_high_latch), reads lower
+ * word first and upper word afterwards. On older cores, reads timestamp
+ * twice and checks consistency betwen upper and lower timestamp word.
  *
  * @priv: Private info
  * Return: Value of timestamp in CTU CAN FD Core
@@ -929,6 +1550,134 @@ u64 ctucan_hw_read_timestamp(struct ctucan_hw_priv *priv);
 void ctucan_hw_configure_ssp(struct ctucan_hw_priv *priv, bool enable_ssp,
 			     bool use_trv_delay, int ssp_offset);
 
+/*
+ * Transceiver delay statistics used by Secondary sample point calibration.
+ * Measured delay is 7 bit wide (TRV_DELAY_VALUE), so each possible value
+ * has its own histogram bin.
+ */
+#define CTU_CAN_FD_TRV_DELAY_MAX 127
+#define CTU_CAN_FD_SSP_POS_MAX 255
+#define CTU_CAN_FD_TRV_MEAS_POLLS 100
+
+struct ctucan_hw_trv_stats {
+	u32 hist[CTU_CAN_FD_TRV_DELAY_MAX + 1];
+	u32 count;
+	u32 sum;
+	u16 min;
+	u16 max;
+};
+
+/**
+ * ctucan_hw_trv_stats_init - Clear transceiver delay statistics.
+ *
+ * @stats: Statistics to clear
+ */
+void ctucan_hw_trv_stats_init(struct ctucan_hw_trv_stats *stats);
+
+/**
+ * ctucan_hw_trv_stats_add - Add single transceiver delay measurement
+ *			     to statistics.
+ *
+ * @stats: Statistics to update
+ * @trv_delay: Measured transceiver delay (as returned by
+ *	       ctucan_hw_get_tran_delay)
+ */
+void ctucan_hw_trv_stats_add(struct ctucan_hw_trv_stats *stats, u16 trv_delay);
+
+/**
+ * ctucan_hw_trv_stats_median - Get median of measured transceiver delays.
+ *
+ * @stats: Statistics
+ * Return: Median transceiver delay in system clock cycles, 0 when no
+ *	   measurement was recorded.
+ */
+u16 ctucan_hw_trv_stats_median(const struct ctucan_hw_trv_stats *stats);
+
+/**
+ * ctucan_hw_calc_ssp_pos - Calculate position of Secondary sample point
+ *			    from measured transceiver delay.
+ *
+ * Secondary sample point is placed at median of measured transceiver delays
+ * plus position of regular sample point within data bit (in system clock
+ * cycles). Median is used since it is insensitive to single outliers caused
+ * by bus disturbances during measurement.
+ *
+ * @stats: Transceiver delay statistics
+ * @dbt: Data bit timing
+ * Return: Position of secondary sample point in system clock cycles,
+ *	   saturated to CTU_CAN_FD_SSP_POS_MAX.
+ */
+int ctucan_hw_calc_ssp_pos(const struct ctucan_hw_trv_stats *stats,
+			   const struct can_bittiming *dbt);
+
+/**
+ * ctucan_hw_measure_trv_delay - Measure transceiver delay over several frames.
+ *
+ * Sends @count CAN FD frames with bit-rate shift from TXT Buffer @buf and
+ * records transceiver delay measured by the Core after each successful
+ * transmission. Core must be enabled and configured (bit timing, mode).
+ * When Core is in loopback/self-test mode, no other node on the bus is
+ * needed for the measurement. Retransmit limit shall be enabled, otherwise
+ * frame which is never transmitted successfully blocks the measurement.
+ * TX status of each frame is checked at most CTU_CAN_FD_TRV_MEAS_POLLS
+ * times, then the frame is aborted and the measurement ends.
+ *
+ * @priv: Private info
+ * @stats: Statistics where measurements are stored (not cleared)
+ * @count: Number of frames to send
+ * @buf: TXT Buffer index used for measurement frames
+ * @poll: Function called before each TX status check, shall wait for
+ *	  a while (e.g. 100 us) so that a frame fits to the poll limit.
+ *	  May be NULL.
+ * Return: Number of frames which were transmitted successfully.
+ */
+int ctucan_hw_measure_trv_delay(struct ctucan_hw_priv *priv,
+				struct ctucan_hw_trv_stats *stats,
+				unsigned int count, u8 buf,
+				void (*poll)(void));
+
+/**
+ * ctucan_hw_frame_time - Estimate time which frame occupies the bus.
+ *
+ * Stuff bits (apart from fixed stuff bits of CAN FD) are not counted.
+ *
+ * @cf: CAN frame
+ * @isfdf: True if the frame is a FD frame.
+ * @nbt_ns: Nominal bit time in nanoseconds
+ * @dbt_ns: Data bit time in nanoseconds (used only with bit-rate shift)
+ * Return: Estimated time in nanoseconds, including intermission.
+ */
+u32 ctucan_hw_frame_time(const struct canfd_frame *cf, bool isfdf,
+			 u32 nbt_ns, u32 dbt_ns);
+
+/*
+ * Frame held in TXT Buffer, used by length-aware TX scheduling.
+ */
+struct ctucan_hw_txb_frame {
+	bool pending;
+	canid_t can_id;
+	u32 seq;
+	u32 time_ns;
+};
+
+/**
+ * ctucan_hw_txsched_prio - Compute TXT Buffer priorities for length-aware
+ *			    TX scheduling.
+ *
+ * Pending frames get unique priorities, shortest frame first. Frame is
+ * eligible only when no older frame with the same CAN ID is pending, so
+ * frames with equal CAN ID are transmitted in order. Frame overtaken by more
+ * than 2 * @count newer frames is served oldest first to avoid starvation.
+ * Same policy is used by kernel driver with "tx_sched=1".
+ *
+ * @txb: Array with @count TXT Buffers
+ * @count: Number of TXT Buffers
+ * @seq_next: Sequence number which will be given to next inserted frame
+ * @prio: Array with @count elements where priorities are stored
+ */
+void ctucan_hw_txsched_prio(const struct ctucan_hw_txb_frame *txb,
+			    unsigned int count, u32 seq_next, u8 *prio);
+
 extern const struct can_bittiming_const ctu_can_fd_bit_timing_max;
 extern const struct can_bittiming_const ctu_can_fd_bit_timing_data_max;
 
@@ -54,6 +54,7 @@ enum ctu_can_fd_can_frame_format {
 #define REG_FRAME_FORMAT_W_BRS BIT(9)
 #define REG_FRAME_FORMAT_W_ESI_RSV BIT(10)
 #define REG_FRAME_FORMAT_W_RWCNT GENMASK(15, 11)
+#define REG_FRAME_FORMAT_W_ETS BIT(16)
 
 /*  IDENTIFIER_W registers */
 #define REG_IDENTIFIER_W_IDENTIFIER_EXT GENMASK(17, 0)
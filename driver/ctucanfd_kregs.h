@@ -87,6 +87,34 @@ enum ctu_can_fd_can_registers {
 	CTUCANFD_YOLO_REG             = 0x90,
 	CTUCANFD_TIMESTAMP_LOW        = 0x94,
 	CTUCANFD_TIMESTAMP_HIGH       = 0x98,
+	CTUCANFD_FILTER_SET_CTRL      = 0x9c,
+	CTUCANFD_FILTER_SET_INFO      = 0x9e,
+	CTUCANFD_FILTER_SET_ADDR      = 0xa0,
+	CTUCANFD_FILTER_SET_DATA      = 0xa4,
+	CTUCANFD_RX_DROP_CTR          = 0xa8,
+	CTUCANFD_RX_DMA_CTRL          = 0xac,
+	CTUCANFD_RX_DMA_BASE          = 0xb0,
+	CTUCANFD_RX_DMA_CONS          = 0xb4,
+	CTUCANFD_RX_DMA_STATUS        = 0xb8,
+	CTUCANFD_TX_FIFO_CTRL         = 0xbc,
+	CTUCANFD_TX_FIFO_STATUS       = 0xbe,
+	CTUCANFD_INT_TS_SEL           = 0xc0,
+	CTUCANFD_INT_TS               = 0xc4,
+	CTUCANFD_BUS_STAT_SEL         = 0xc8,
+	CTUCANFD_BUS_STAT             = 0xcc,
+	CTUCANFD_TXTB_TS_SEL          = 0xd0,
+	CTUCANFD_TXTB_TS_LOW          = 0xd4,
+	CTUCANFD_TXTB_TS_HIGH         = 0xd8,
+	CTUCANFD_TS_INC               = 0xdc,
+	CTUCANFD_TS_STEP_LOW          = 0xe0,
+	CTUCANFD_TS_STEP_HIGH         = 0xe4,
+	CTUCANFD_RX_PEEK_FFW          = 0xe8,
+	CTUCANFD_RX_PEEK_IDW          = 0xec,
+	CTUCANFD_TXT_CYC_SEL          = 0xf0,
+	CTUCANFD_TXT_CYC_SKIP         = 0xf2,
+	CTUCANFD_TXT_CYC_PERIOD       = 0xf4,
+	CTUCANFD_TX_CPL_TS            = 0xf8,
+	CTUCANFD_TX_CPL               = 0xfc,
 	CTUCANFD_TXTB1_DATA_1        = 0x100,
 	CTUCANFD_TXTB1_DATA_2        = 0x104,
 	CTUCANFD_TXTB1_DATA_20       = 0x14c,
@@ -115,6 +143,11 @@ enum ctu_can_fd_can_registers {
 	CTUCANFD_TST_DEST            = 0x904,
 	CTUCANFD_TST_WDATA           = 0x908,
 	CTUCANFD_TST_RDATA           = 0x90c,
+	CTUCANFD_RX_DATA_WINDOW      = 0xa00,
+	CTUCANFD_RXP_CTRL            = 0xb00,
+	CTUCANFD_RXP_MEM_INFO        = 0xb04,
+	CTUCANFD_RXP_STATUS          = 0xb08,
+	CTUCANFD_RXP_DATA            = 0xb0c,
 };
 /* Control_registers memory region */
 
@@ -155,6 +188,15 @@ enum ctu_can_fd_can_registers {
 #define REG_STATUS_PEXS BIT(8)
 #define REG_STATUS_STCNT BIT(16)
 #define REG_STATUS_STRGS BIT(17)
+#define REG_STATUS_SRDMA BIT(18)
+#define REG_STATUS_STXF BIT(19)
+#define REG_STATUS_SITS BIT(20)
+#define REG_STATUS_STXTS BIT(21)
+#define REG_STATUS_STSG BIT(22)
+#define REG_STATUS_SRXPK BIT(23)
+#define REG_STATUS_STCYC BIT(24)
+#define REG_STATUS_STCPL BIT(25)
+#define REG_STATUS_STRXP BIT(26)
 
 /*  COMMAND registers */
 #define REG_COMMAND_RXRPMV BIT(1)
@@ -164,6 +206,11 @@ enum ctu_can_fd_can_registers {
 #define REG_COMMAND_RXFCRST BIT(5)
 #define REG_COMMAND_TXFCRST BIT(6)
 #define REG_COMMAND_CPEXS BIT(7)
+#define REG_COMMAND_RXDCRST BIT(8)
+#define REG_COMMAND_BSSNAP BIT(9)
+#define REG_COMMAND_TSSTEP BIT(10)
+#define REG_COMMAND_TSSET BIT(11)
+#define REG_COMMAND_RXSKIP BIT(12)
 
 /*  INT_STAT registers */
 #define REG_INT_STAT_RXI BIT(0)
@@ -178,18 +225,22 @@ enum ctu_can_fd_can_registers {
 #define REG_INT_STAT_BSI BIT(9)
 #define REG_INT_STAT_RBNEI BIT(10)
 #define REG_INT_STAT_TXBHCI BIT(11)
+#define REG_INT_STAT_DMAI BIT(12)
+#define REG_INT_STAT_TFTI BIT(13)
+#define REG_INT_STAT_RXPI BIT(14)
+#define REG_INT_STAT_RPNEI BIT(15)
 
 /*  INT_ENA_SET registers */
-#define REG_INT_ENA_SET_INT_ENA_SET GENMASK(11, 0)
+#define REG_INT_ENA_SET_INT_ENA_SET GENMASK(15, 0)
 
 /*  INT_ENA_CLR registers */
-#define REG_INT_ENA_CLR_INT_ENA_CLR GENMASK(11, 0)
+#define REG_INT_ENA_CLR_INT_ENA_CLR GENMASK(15, 0)
 
 /*  INT_MASK_SET registers */
-#define REG_INT_MASK_SET_INT_MASK_SET GENMASK(11, 0)
+#define REG_INT_MASK_SET_INT_MASK_SET GENMASK(15, 0)
 
 /*  INT_MASK_CLR registers */
-#define REG_INT_MASK_CLR_INT_MASK_CLR GENMASK(11, 0)
+#define REG_INT_MASK_CLR_INT_MASK_CLR GENMASK(15, 0)
 
 /*  BTR registers */
 #define REG_BTR_PROP GENMASK(6, 0)
@@ -272,6 +323,7 @@ enum ctu_can_fd_can_registers {
 #define REG_FILTER_CONTROL_SFB BIT(17)
 #define REG_FILTER_CONTROL_SFC BIT(18)
 #define REG_FILTER_CONTROL_SFR BIT(19)
+#define REG_FILTER_CONTROL_SFS BIT(20)
 
 /*  RX_MEM_INFO registers */
 #define REG_RX_MEM_INFO_RX_BUFF_SIZE GENMASK(12, 0)
@@ -287,6 +339,8 @@ enum ctu_can_fd_can_registers {
 #define REG_RX_STATUS_RXMOF BIT(2)
 #define REG_RX_STATUS_RXFRC GENMASK(14, 4)
 #define REG_RX_STATUS_RTSOP BIT(16)
+#define REG_RX_STATUS_ROVP BIT(17)
+#define REG_RX_STATUS_RTSB BIT(18)
 
 /*  RX_DATA registers */
 #define REG_RX_DATA_RX_DATA GENMASK(31, 0)
@@ -369,4 +423,125 @@ enum ctu_can_fd_can_registers {
 /*  TIMESTAMP_HIGH registers */
 #define REG_TIMESTAMP_HIGH_TIMESTAMP_HIGH GENMASK(31, 0)
 
+/*  FILTER_SET_CTRL FILTER_SET_INFO registers */
+#define REG_FILTER_SET_CTRL_FSNB BIT(0)
+#define REG_FILTER_SET_CTRL_FSNE BIT(1)
+#define REG_FILTER_SET_CTRL_FSFB BIT(2)
+#define REG_FILTER_SET_CTRL_FSFE BIT(3)
+#define REG_FILTER_SET_CTRL_FSET_HTW GENMASK(19, 16)
+#define REG_FILTER_SET_CTRL_FSET_PRB GENMASK(23, 20)
+
+/*  FILTER_SET_ADDR registers */
+#define REG_FILTER_SET_ADDR_FSET_ADDR GENMASK(9, 0)
+#define REG_FILTER_SET_ADDR_FSET_TSEL BIT(15)
+
+/*  FILTER_SET_DATA registers */
+#define REG_FILTER_SET_DATA_FSET_DATA GENMASK(31, 0)
+
+/*  RX_DROP_CTR registers */
+#define REG_RX_DROP_CTR_RX_DROP_CTR_VAL GENMASK(31, 0)
+
+/*  RX_DMA_CTRL registers */
+#define REG_RX_DMA_CTRL_RDENA BIT(0)
+#define REG_RX_DMA_CTRL_RDRS GENMASK(7, 4)
+#define REG_RX_DMA_CTRL_RDBATCH GENMASK(15, 8)
+#define REG_RX_DMA_CTRL_RDTMO GENMASK(31, 16)
+
+/*  RX_DMA_BASE registers */
+#define REG_RX_DMA_BASE_RDBASE GENMASK(31, 7)
+
+/*  RX_DMA_CONS registers */
+#define REG_RX_DMA_CONS_RDCONS GENMASK(11, 0)
+
+/*  RX_DMA_STATUS registers */
+#define REG_RX_DMA_STATUS_RDPROD GENMASK(11, 0)
+#define REG_RX_DMA_STATUS_RDACT BIT(16)
+#define REG_RX_DMA_STATUS_RDBERR BIT(17)
+
+/*  TX_FIFO_CTRL TX_FIFO_STATUS registers */
+#define REG_TX_FIFO_CTRL_TFTH GENMASK(6, 0)
+#define REG_TX_FIFO_CTRL_TFFL GENMASK(22, 16)
+#define REG_TX_FIFO_CTRL_TFFULL BIT(23)
+#define REG_TX_FIFO_CTRL_TFDEPTH GENMASK(30, 24)
+
+/*  INT_TS_SEL registers */
+#define REG_INT_TS_SEL_ITSEL GENMASK(3, 0)
+
+/*  INT_TS registers */
+#define REG_INT_TS_ITS_VAL GENMASK(31, 0)
+
+/*  BUS_STAT_SEL registers */
+#define REG_BUS_STAT_SEL_BSSEL GENMASK(2, 0)
+
+/*  BUS_STAT registers */
+#define REG_BUS_STAT_BS_VAL GENMASK(31, 0)
+
+/*  TXTB_TS_SEL registers */
+#define REG_TXTB_TS_SEL_TTSEL GENMASK(2, 0)
+
+/*  TXTB_TS_LOW registers */
+#define REG_TXTB_TS_LOW_TXTB_TS_LOW GENMASK(31, 0)
+
+/*  TXTB_TS_HIGH registers */
+#define REG_TXTB_TS_HIGH_TXTB_TS_HIGH GENMASK(31, 0)
+
+/*  TS_INC registers */
+#define REG_TS_INC_TS_INC_FRAC GENMASK(23, 0)
+#define REG_TS_INC_TS_INC_INT GENMASK(31, 24)
+
+/*  TS_STEP_LOW registers */
+#define REG_TS_STEP_LOW_TS_STEP_LOW GENMASK(31, 0)
+
+/*  TS_STEP_HIGH registers */
+#define REG_TS_STEP_HIGH_TS_STEP_HIGH GENMASK(31, 0)
+
+/*  RX_PEEK_FFW registers */
+#define REG_RX_PEEK_FFW_RX_PEEK_FFW_VAL GENMASK(31, 0)
+
+/*  RX_PEEK_IDW registers */
+#define REG_RX_PEEK_IDW_RX_PEEK_IDW_VAL GENMASK(31, 0)
+
+/*  TXT_CYC_SEL TXT_CYC_SKIP registers */
+#define REG_TXT_CYC_SEL_TCSEL GENMASK(2, 0)
+#define REG_TXT_CYC_SEL_TCSKIP GENMASK(31, 16)
+
+/*  TXT_CYC_PERIOD registers */
+#define REG_TXT_CYC_PERIOD_TXT_CYC_PERIOD GENMASK(31, 0)
+
+/*  TX_CPL_TS registers */
+#define REG_TX_CPL_TS_TX_CPL_TS_VAL GENMASK(31, 0)
+
+/*  TX_CPL registers */
+#define REG_TX_CPL_TCIDX GENMASK(2, 0)
+#define REG_TX_CPL_TCST GENMASK(7, 4)
+#define REG_TX_CPL_TCRC GENMASK(11, 8)
+#define REG_TX_CPL_TCCNT GENMASK(20, 16)
+#define REG_TX_CPL_TCOF BIT(30)
+#define REG_TX_CPL_TCV BIT(31)
+
+/* RX_Prio_Buffer memory region */
+
+/*  RXP_CTRL registers */
+#define REG_RXP_CTRL_RPRA BIT(0)
+#define REG_RXP_CTRL_RPRB BIT(1)
+#define REG_RXP_CTRL_RPRC BIT(2)
+#define REG_RXP_CTRL_RPRR BIT(3)
+#define REG_RXP_CTRL_RPRS BIT(4)
+#define REG_RXP_CTRL_RPRRB BIT(8)
+#define REG_RXP_CTRL_RPCDO BIT(9)
+
+/*  RXP_MEM_INFO registers */
+#define REG_RXP_MEM_INFO_RXP_BUFF_SIZE GENMASK(12, 0)
+#define REG_RXP_MEM_INFO_RXP_MEM_FREE GENMASK(28, 16)
+
+/*  RXP_STATUS registers */
+#define REG_RXP_STATUS_RXPE BIT(0)
+#define REG_RXP_STATUS_RXPF BIT(1)
+#define REG_RXP_STATUS_RXPMOF BIT(2)
+#define REG_RXP_STATUS_RXPFRC GENMASK(14, 4)
+#define REG_RXP_STATUS_RXPDOR BIT(15)
+
+/*  RXP_DATA registers */
+#define REG_RXP_DATA_RXP_DATA GENMASK(31, 0)
+
 #endif
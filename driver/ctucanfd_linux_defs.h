@@ -183,6 +183,18 @@ static inline u8 ioread8(const void *addr)
 	return *(const volatile u8*)addr;
 }
 
+__attribute__((noinline))
+static inline void iowrite64(u64 value, void *addr)
+{
+	*(volatile u64*)addr = value;
+}
+
+__attribute__((noinline))
+static inline u64 ioread64(const void *addr)
+{
+	return *(const volatile u64*)addr;
+}
+
 __attribute__((noinline))
 static inline void iowrite32be(u32 value, void *addr)
 {
@@ -195,6 +207,17 @@ static inline u32 ioread32be(const void *addr)
 	return be32_to_cpu(*(const volatile u32*)addr);
 }
 
+__attribute__((noinline))
+static inline void __ioread32_copy(void *to, const volatile void *from,
+				   size_t count)
+{
+	u32 *dst = (u32*)to;
+	const volatile u32 *src = (const volatile u32*)from;
+
+	while (count--)
+		*dst++ = *src++;
+}
+
 /* CAN DLC to real data length conversion helpers */
 u8 can_dlc2len(u8 can_dlc);
 u8 can_len2dlc(u8 len);
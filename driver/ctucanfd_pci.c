@@ -266,6 +266,7 @@ static void ctucan_pci_remove(struct pci_dev *pdev)
 						peers_on_pdev)) != NULL) {
 		ndev = priv->can.dev;
 
+		ctucan_ptp_unregister(ndev);
 		unregister_candev(ndev);
 
 		netif_napi_del(&priv->napi);
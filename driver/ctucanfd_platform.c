@@ -102,6 +102,7 @@ static int ctucan_platform_remove(struct platform_device *pdev)
 
 	netdev_dbg(ndev, "ctucan_remove");
 
+	ctucan_ptp_unregister(ndev);
 	unregister_candev(ndev);
 	pm_runtime_disable(&pdev->dev);
 	netif_napi_del(&priv->napi);
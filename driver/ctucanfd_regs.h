@@ -85,6 +85,34 @@ enum ctu_can_fd_can_registers {
 	CTU_CAN_FD_YOLO_REG             = 0x90,
 	CTU_CAN_FD_TIMESTAMP_LOW        = 0x94,
 	CTU_CAN_FD_TIMESTAMP_HIGH       = 0x98,
+	CTU_CAN_FD_FILTER_SET_CTRL      = 0x9c,
+	CTU_CAN_FD_FILTER_SET_INFO      = 0x9e,
+	CTU_CAN_FD_FILTER_SET_ADDR      = 0xa0,
+	CTU_CAN_FD_FILTER_SET_DATA      = 0xa4,
+	CTU_CAN_FD_RX_DROP_CTR          = 0xa8,
+	CTU_CAN_FD_RX_DMA_CTRL          = 0xac,
+	CTU_CAN_FD_RX_DMA_BASE          = 0xb0,
+	CTU_CAN_FD_RX_DMA_CONS          = 0xb4,
+	CTU_CAN_FD_RX_DMA_STATUS        = 0xb8,
+	CTU_CAN_FD_TX_FIFO_CTRL         = 0xbc,
+	CTU_CAN_FD_TX_FIFO_STATUS       = 0xbe,
+	CTU_CAN_FD_INT_TS_SEL           = 0xc0,
+	CTU_CAN_FD_INT_TS               = 0xc4,
+	CTU_CAN_FD_BUS_STAT_SEL         = 0xc8,
+	CTU_CAN_FD_BUS_STAT             = 0xcc,
+	CTU_CAN_FD_TXTB_TS_SEL          = 0xd0,
+	CTU_CAN_FD_TXTB_TS_LOW          = 0xd4,
+	CTU_CAN_FD_TXTB_TS_HIGH         = 0xd8,
+	CTU_CAN_FD_TS_INC               = 0xdc,
+	CTU_CAN_FD_TS_STEP_LOW          = 0xe0,
+	CTU_CAN_FD_TS_STEP_HIGH         = 0xe4,
+	CTU_CAN_FD_RX_PEEK_FFW          = 0xe8,
+	CTU_CAN_FD_RX_PEEK_IDW          = 0xec,
+	CTU_CAN_FD_TXT_CYC_SEL          = 0xf0,
+	CTU_CAN_FD_TXT_CYC_SKIP         = 0xf2,
+	CTU_CAN_FD_TXT_CYC_PERIOD       = 0xf4,
+	CTU_CAN_FD_TX_CPL_TS            = 0xf8,
+	CTU_CAN_FD_TX_CPL               = 0xfc,
 	CTU_CAN_FD_TXTB1_DATA_1        = 0x100,
 	CTU_CAN_FD_TXTB1_DATA_2        = 0x104,
 	CTU_CAN_FD_TXTB1_DATA_20       = 0x14c,
@@ -113,6 +141,11 @@ enum ctu_can_fd_can_registers {
 	CTU_CAN_FD_TST_DEST            = 0x904,
 	CTU_CAN_FD_TST_WDATA           = 0x908,
 	CTU_CAN_FD_TST_RDATA           = 0x90c,
+	CTU_CAN_FD_RX_DATA_WINDOW      = 0xa00,
+	CTU_CAN_FD_RXP_CTRL            = 0xb00,
+	CTU_CAN_FD_RXP_MEM_INFO        = 0xb04,
+	CTU_CAN_FD_RXP_STATUS          = 0xb08,
+	CTU_CAN_FD_RXP_DATA            = 0xb0c,
 };
 
 
@@ -281,9 +314,27 @@ union ctu_can_fd_status {
 		uint32_t reserved_15_9           : 7;
 		uint32_t stcnt                   : 1;
 		uint32_t strgs                   : 1;
-		uint32_t reserved_31_18         : 14;
+		uint32_t srdma                   : 1;
+		uint32_t stxf                    : 1;
+		uint32_t sits                    : 1;
+		uint32_t stxts                   : 1;
+		uint32_t stsg                    : 1;
+		uint32_t srxpk                   : 1;
+		uint32_t stcyc                   : 1;
+		uint32_t stcpl                   : 1;
+		uint32_t strxp                   : 1;
+		uint32_t reserved_31_27          : 5;
 #else
-		uint32_t reserved_31_18         : 14;
+		uint32_t reserved_31_27          : 5;
+		uint32_t strxp                   : 1;
+		uint32_t stcpl                   : 1;
+		uint32_t stcyc                   : 1;
+		uint32_t srxpk                   : 1;
+		uint32_t stsg                    : 1;
+		uint32_t stxts                   : 1;
+		uint32_t sits                    : 1;
+		uint32_t stxf                    : 1;
+		uint32_t srdma                   : 1;
 		uint32_t strgs                   : 1;
 		uint32_t stcnt                   : 1;
 		uint32_t reserved_15_9           : 7;
@@ -313,9 +364,19 @@ union ctu_can_fd_command {
 		uint32_t rxfcrst                 : 1;
 		uint32_t txfcrst                 : 1;
 		uint32_t cpexs                   : 1;
-		uint32_t reserved_31_8          : 24;
+		uint32_t rxdcrst                 : 1;
+		uint32_t bssnap                  : 1;
+		uint32_t tsstep                  : 1;
+		uint32_t tsset                   : 1;
+		uint32_t rxskip                  : 1;
+		uint32_t reserved_31_13         : 19;
 #else
-		uint32_t reserved_31_8          : 24;
+		uint32_t reserved_31_13         : 19;
+		uint32_t rxskip                  : 1;
+		uint32_t tsset                   : 1;
+		uint32_t tsstep                  : 1;
+		uint32_t bssnap                  : 1;
+		uint32_t rxdcrst                 : 1;
 		uint32_t cpexs                   : 1;
 		uint32_t txfcrst                 : 1;
 		uint32_t rxfcrst                 : 1;
@@ -345,9 +406,17 @@ union ctu_can_fd_int_stat {
 		uint32_t bsi                     : 1;
 		uint32_t rbnei                   : 1;
 		uint32_t txbhci                  : 1;
-		uint32_t reserved_31_12         : 20;
+		uint32_t dmai                    : 1;
+		uint32_t tfti                    : 1;
+		uint32_t rxpi                    : 1;
+		uint32_t rpnei                   : 1;
+		uint32_t reserved_31_16         : 16;
 #else
-		uint32_t reserved_31_12         : 20;
+		uint32_t reserved_31_16         : 16;
+		uint32_t rpnei                   : 1;
+		uint32_t rxpi                    : 1;
+		uint32_t tfti                    : 1;
+		uint32_t dmai                    : 1;
 		uint32_t txbhci                  : 1;
 		uint32_t rbnei                   : 1;
 		uint32_t bsi                     : 1;
@@ -369,11 +438,11 @@ union ctu_can_fd_int_ena_set {
 	struct ctu_can_fd_int_ena_set_s {
 #ifdef __LITTLE_ENDIAN_BITFIELD
   /* INT_ENA_SET */
-		uint32_t int_ena_set            : 12;
-		uint32_t reserved_31_12         : 20;
+		uint32_t int_ena_set            : 16;
+		uint32_t reserved_31_16         : 16;
 #else
-		uint32_t reserved_31_12         : 20;
-		uint32_t int_ena_set            : 12;
+		uint32_t reserved_31_16         : 16;
+		uint32_t int_ena_set            : 16;
 #endif
 	} s;
 };
@@ -383,11 +452,11 @@ union ctu_can_fd_int_ena_clr {
 	struct ctu_can_fd_int_ena_clr_s {
 #ifdef __LITTLE_ENDIAN_BITFIELD
   /* INT_ENA_CLR */
-		uint32_t int_ena_clr            : 12;
-		uint32_t reserved_31_12         : 20;
+		uint32_t int_ena_clr            : 16;
+		uint32_t reserved_31_16         : 16;
 #else
-		uint32_t reserved_31_12         : 20;
-		uint32_t int_ena_clr            : 12;
+		uint32_t reserved_31_16         : 16;
+		uint32_t int_ena_clr            : 16;
 #endif
 	} s;
 };
@@ -397,11 +466,11 @@ union ctu_can_fd_int_mask_set {
 	struct ctu_can_fd_int_mask_set_s {
 #ifdef __LITTLE_ENDIAN_BITFIELD
   /* INT_MASK_SET */
-		uint32_t int_mask_set           : 12;
-		uint32_t reserved_31_12         : 20;
+		uint32_t int_mask_set           : 16;
+		uint32_t reserved_31_16         : 16;
 #else
-		uint32_t reserved_31_12         : 20;
-		uint32_t int_mask_set           : 12;
+		uint32_t reserved_31_16         : 16;
+		uint32_t int_mask_set           : 16;
 #endif
 	} s;
 };
@@ -411,11 +480,11 @@ union ctu_can_fd_int_mask_clr {
 	struct ctu_can_fd_int_mask_clr_s {
 #ifdef __LITTLE_ENDIAN_BITFIELD
   /* INT_MASK_CLR */
-		uint32_t int_mask_clr           : 12;
-		uint32_t reserved_31_12         : 20;
+		uint32_t int_mask_clr           : 16;
+		uint32_t reserved_31_16         : 16;
 #else
-		uint32_t reserved_31_12         : 20;
-		uint32_t int_mask_clr           : 12;
+		uint32_t reserved_31_16         : 16;
+		uint32_t int_mask_clr           : 16;
 #endif
 	} s;
 };
@@ -684,9 +753,11 @@ union ctu_can_fd_filter_control_filter_status {
 		uint32_t sfb                     : 1;
 		uint32_t sfc                     : 1;
 		uint32_t sfr                     : 1;
-		uint32_t reserved_31_20         : 12;
+		uint32_t sfs                     : 1;
+		uint32_t reserved_31_21         : 11;
 #else
-		uint32_t reserved_31_20         : 12;
+		uint32_t reserved_31_21         : 11;
+		uint32_t sfs                     : 1;
 		uint32_t sfr                     : 1;
 		uint32_t sfc                     : 1;
 		uint32_t sfb                     : 1;
@@ -760,9 +831,13 @@ union ctu_can_fd_rx_status_rx_settings {
 		uint32_t reserved_15             : 1;
   /* RX_SETTINGS */
 		uint32_t rtsop                   : 1;
-		uint32_t reserved_31_17         : 15;
+		uint32_t rovp                    : 1;
+		uint32_t rtsb                    : 1;
+		uint32_t reserved_31_19         : 13;
 #else
-		uint32_t reserved_31_17         : 15;
+		uint32_t reserved_31_19         : 13;
+		uint32_t rtsb                    : 1;
+		uint32_t rovp                    : 1;
 		uint32_t rtsop                   : 1;
 		uint32_t reserved_15             : 1;
 		uint32_t rxfrc                  : 11;
@@ -779,6 +854,11 @@ enum ctu_can_fd_rx_settings_rtsop {
 	RTS_BEG       = 0x1,
 };
 
+enum ctu_can_fd_rx_settings_rovp {
+	ROVP_DROP_NEW       = 0x0,
+	ROVP_DROP_OLD       = 0x1,
+};
+
 union ctu_can_fd_rx_data {
 	uint32_t u32;
 	struct ctu_can_fd_rx_data_s {
@@ -1070,6 +1150,357 @@ union ctu_can_fd_timestamp_high {
 	} s;
 };
 
+union ctu_can_fd_filter_set_ctrl_filter_set_info {
+	uint32_t u32;
+	struct ctu_can_fd_filter_set_ctrl_filter_set_info_s {
+#ifdef __LITTLE_ENDIAN_BITFIELD
+  /* FILTER_SET_CTRL */
+		uint32_t fsnb                    : 1;
+		uint32_t fsne                    : 1;
+		uint32_t fsfb                    : 1;
+		uint32_t fsfe                    : 1;
+		uint32_t reserved_15_4          : 12;
+  /* FILTER_SET_INFO */
+		uint32_t fset_htw                : 4;
+		uint32_t fset_prb                : 4;
+		uint32_t reserved_31_24          : 8;
+#else
+		uint32_t reserved_31_24          : 8;
+		uint32_t fset_prb                : 4;
+		uint32_t fset_htw                : 4;
+		uint32_t reserved_15_4          : 12;
+		uint32_t fsfe                    : 1;
+		uint32_t fsfb                    : 1;
+		uint32_t fsne                    : 1;
+		uint32_t fsnb                    : 1;
+#endif
+	} s;
+};
+
+union ctu_can_fd_filter_set_addr {
+	uint32_t u32;
+	struct ctu_can_fd_filter_set_addr_s {
+#ifdef __LITTLE_ENDIAN_BITFIELD
+  /* FILTER_SET_ADDR */
+		uint32_t fset_addr              : 10;
+		uint32_t reserved_14_10          : 5;
+		uint32_t fset_tsel               : 1;
+		uint32_t reserved_31_16         : 16;
+#else
+		uint32_t reserved_31_16         : 16;
+		uint32_t fset_tsel               : 1;
+		uint32_t reserved_14_10          : 5;
+		uint32_t fset_addr              : 10;
+#endif
+	} s;
+};
+
+enum ctu_can_fd_filter_set_addr_fset_tsel {
+	FSET_TSEL_BITMAP       = 0x0,
+	FSET_TSEL_HASH         = 0x1,
+};
+
+union ctu_can_fd_filter_set_data {
+	uint32_t u32;
+	struct ctu_can_fd_filter_set_data_s {
+  /* FILTER_SET_DATA */
+		uint32_t fset_data              : 32;
+	} s;
+};
+
+union ctu_can_fd_rx_drop_ctr {
+	uint32_t u32;
+	struct ctu_can_fd_rx_drop_ctr_s {
+  /* RX_DROP_CTR */
+		uint32_t rx_drop_ctr_val        : 32;
+	} s;
+};
+
+union ctu_can_fd_rx_dma_ctrl {
+	uint32_t u32;
+	struct ctu_can_fd_rx_dma_ctrl_s {
+#ifdef __LITTLE_ENDIAN_BITFIELD
+  /* RX_DMA_CTRL */
+		uint32_t rdena                   : 1;
+		uint32_t reserved_3_1            : 3;
+		uint32_t rdrs                    : 4;
+		uint32_t rdbatch                 : 8;
+		uint32_t rdtmo                  : 16;
+#else
+		uint32_t rdtmo                  : 16;
+		uint32_t rdbatch                 : 8;
+		uint32_t rdrs                    : 4;
+		uint32_t reserved_3_1            : 3;
+		uint32_t rdena                   : 1;
+#endif
+	} s;
+};
+
+enum ctu_can_fd_rx_dma_ctrl_rdena {
+	RDMA_DISABLED       = 0x0,
+	RDMA_ENABLED        = 0x1,
+};
+
+union ctu_can_fd_rx_dma_base {
+	uint32_t u32;
+	struct ctu_can_fd_rx_dma_base_s {
+#ifdef __LITTLE_ENDIAN_BITFIELD
+  /* RX_DMA_BASE */
+		uint32_t reserved_6_0            : 7;
+		uint32_t rdbase                 : 25;
+#else
+		uint32_t rdbase                 : 25;
+		uint32_t reserved_6_0            : 7;
+#endif
+	} s;
+};
+
+union ctu_can_fd_rx_dma_cons {
+	uint32_t u32;
+	struct ctu_can_fd_rx_dma_cons_s {
+#ifdef __LITTLE_ENDIAN_BITFIELD
+  /* RX_DMA_CONS */
+		uint32_t rdcons                 : 12;
+		uint32_t reserved_31_12         : 20;
+#else
+		uint32_t reserved_31_12         : 20;
+		uint32_t rdcons                 : 12;
+#endif
+	} s;
+};
+
+union ctu_can_fd_rx_dma_status {
+	uint32_t u32;
+	struct ctu_can_fd_rx_dma_status_s {
+#ifdef __LITTLE_ENDIAN_BITFIELD
+  /* RX_DMA_STATUS */
+		uint32_t rdprod                 : 12;
+		uint32_t reserved_15_12          : 4;
+		uint32_t rdact                   : 1;
+		uint32_t rdberr                  : 1;
+		uint32_t reserved_31_18         : 14;
+#else
+		uint32_t reserved_31_18         : 14;
+		uint32_t rdberr                  : 1;
+		uint32_t rdact                   : 1;
+		uint32_t reserved_15_12          : 4;
+		uint32_t rdprod                 : 12;
+#endif
+	} s;
+};
+
+union ctu_can_fd_tx_fifo_ctrl_tx_fifo_status {
+	uint32_t u32;
+	struct ctu_can_fd_tx_fifo_ctrl_tx_fifo_status_s {
+#ifdef __LITTLE_ENDIAN_BITFIELD
+  /* TX_FIFO_CTRL */
+		uint32_t tfth                    : 7;
+		uint32_t reserved_15_7           : 9;
+  /* TX_FIFO_STATUS */
+		uint32_t tffl                    : 7;
+		uint32_t tffull                  : 1;
+		uint32_t tfdepth                 : 7;
+		uint32_t reserved_31             : 1;
+#else
+		uint32_t reserved_31             : 1;
+		uint32_t tfdepth                 : 7;
+		uint32_t tffull                  : 1;
+		uint32_t tffl                    : 7;
+		uint32_t reserved_15_7           : 9;
+		uint32_t tfth                    : 7;
+#endif
+	} s;
+};
+
+union ctu_can_fd_int_ts_sel {
+	uint32_t u32;
+	struct ctu_can_fd_int_ts_sel_s {
+#ifdef __LITTLE_ENDIAN_BITFIELD
+  /* INT_TS_SEL */
+		uint32_t itsel                   : 4;
+		uint32_t reserved_31_4          : 28;
+#else
+		uint32_t reserved_31_4          : 28;
+		uint32_t itsel                   : 4;
+#endif
+	} s;
+};
+
+union ctu_can_fd_int_ts {
+	uint32_t u32;
+	struct ctu_can_fd_int_ts_s {
+  /* INT_TS */
+		uint32_t its_val                : 32;
+	} s;
+};
+
+union ctu_can_fd_bus_stat_sel {
+	uint32_t u32;
+	struct ctu_can_fd_bus_stat_sel_s {
+#ifdef __LITTLE_ENDIAN_BITFIELD
+  /* BUS_STAT_SEL */
+		uint32_t bssel                   : 3;
+		uint32_t reserved_31_3          : 29;
+#else
+		uint32_t reserved_31_3          : 29;
+		uint32_t bssel                   : 3;
+#endif
+	} s;
+};
+
+enum ctu_can_fd_bus_stat_sel_bssel {
+	BS_BUSY_BITS        = 0x0,
+	BS_IDLE_BITS        = 0x1,
+	BS_ERR_FRMS         = 0x2,
+	BS_OVR_FRMS         = 0x3,
+	BS_STUFF_BITS       = 0x4,
+};
+
+union ctu_can_fd_bus_stat {
+	uint32_t u32;
+	struct ctu_can_fd_bus_stat_s {
+  /* BUS_STAT */
+		uint32_t bs_val                 : 32;
+	} s;
+};
+
+union ctu_can_fd_txtb_ts_sel {
+	uint32_t u32;
+	struct ctu_can_fd_txtb_ts_sel_s {
+#ifdef __LITTLE_ENDIAN_BITFIELD
+  /* TXTB_TS_SEL */
+		uint32_t ttsel                   : 3;
+		uint32_t reserved_31_3          : 29;
+#else
+		uint32_t reserved_31_3          : 29;
+		uint32_t ttsel                   : 3;
+#endif
+	} s;
+};
+
+union ctu_can_fd_txtb_ts_low {
+	uint32_t u32;
+	struct ctu_can_fd_txtb_ts_low_s {
+  /* TXTB_TS_LOW */
+		uint32_t txtb_ts_low            : 32;
+	} s;
+};
+
+union ctu_can_fd_txtb_ts_high {
+	uint32_t u32;
+	struct ctu_can_fd_txtb_ts_high_s {
+  /* TXTB_TS_HIGH */
+		uint32_t txtb_ts_high           : 32;
+	} s;
+};
+
+union ctu_can_fd_ts_inc {
+	uint32_t u32;
+	struct ctu_can_fd_ts_inc_s {
+#ifdef __LITTLE_ENDIAN_BITFIELD
+  /* TS_INC */
+		uint32_t ts_inc_frac            : 24;
+		uint32_t ts_inc_int              : 8;
+#else
+		uint32_t ts_inc_int              : 8;
+		uint32_t ts_inc_frac            : 24;
+#endif
+	} s;
+};
+
+union ctu_can_fd_ts_step_low {
+	uint32_t u32;
+	struct ctu_can_fd_ts_step_low_s {
+  /* TS_STEP_LOW */
+		uint32_t ts_step_low            : 32;
+	} s;
+};
+
+union ctu_can_fd_ts_step_high {
+	uint32_t u32;
+	struct ctu_can_fd_ts_step_high_s {
+  /* TS_STEP_HIGH */
+		uint32_t ts_step_high           : 32;
+	} s;
+};
+
+union ctu_can_fd_rx_peek_ffw {
+	uint32_t u32;
+	struct ctu_can_fd_rx_peek_ffw_s {
+  /* RX_PEEK_FFW */
+		uint32_t rx_peek_ffw_val        : 32;
+	} s;
+};
+
+union ctu_can_fd_rx_peek_idw {
+	uint32_t u32;
+	struct ctu_can_fd_rx_peek_idw_s {
+  /* RX_PEEK_IDW */
+		uint32_t rx_peek_idw_val        : 32;
+	} s;
+};
+
+union ctu_can_fd_txt_cyc_sel_txt_cyc_skip {
+	uint32_t u32;
+	struct ctu_can_fd_txt_cyc_sel_txt_cyc_skip_s {
+#ifdef __LITTLE_ENDIAN_BITFIELD
+  /* TXT_CYC_SEL */
+		uint32_t tcsel                   : 3;
+		uint32_t reserved_15_3          : 13;
+  /* TXT_CYC_SKIP */
+		uint32_t tcskip                 : 16;
+#else
+		uint32_t tcskip                 : 16;
+		uint32_t reserved_15_3          : 13;
+		uint32_t tcsel                   : 3;
+#endif
+	} s;
+};
+
+union ctu_can_fd_txt_cyc_period {
+	uint32_t u32;
+	struct ctu_can_fd_txt_cyc_period_s {
+  /* TXT_CYC_PERIOD */
+		uint32_t txt_cyc_period         : 32;
+	} s;
+};
+
+union ctu_can_fd_tx_cpl_ts {
+	uint32_t u32;
+	struct ctu_can_fd_tx_cpl_ts_s {
+  /* TX_CPL_TS */
+		uint32_t tx_cpl_ts_val          : 32;
+	} s;
+};
+
+union ctu_can_fd_tx_cpl {
+	uint32_t u32;
+	struct ctu_can_fd_tx_cpl_s {
+#ifdef __LITTLE_ENDIAN_BITFIELD
+  /* TX_CPL */
+		uint32_t tcidx                   : 3;
+		uint32_t reserved_3              : 1;
+		uint32_t tcst                    : 4;
+		uint32_t tcrc                    : 4;
+		uint32_t reserved_15_12          : 4;
+		uint32_t tccnt                   : 5;
+		uint32_t reserved_29_21          : 9;
+		uint32_t tcof                    : 1;
+		uint32_t tcv                     : 1;
+#else
+		uint32_t tcv                     : 1;
+		uint32_t tcof                    : 1;
+		uint32_t reserved_29_21          : 9;
+		uint32_t tccnt                   : 5;
+		uint32_t reserved_15_12          : 4;
+		uint32_t tcrc                    : 4;
+		uint32_t tcst                    : 4;
+		uint32_t reserved_3              : 1;
+		uint32_t tcidx                   : 3;
+#endif
+	} s;
+};
+
 union ctu_can_fd_tst_control {
 	uint32_t u32;
 	struct ctu_can_fd_tst_control_s {
@@ -1131,4 +1562,82 @@ union ctu_can_fd_tst_rdata {
 	} s;
 };
 
+union ctu_can_fd_rxp_ctrl {
+	uint32_t u32;
+	struct ctu_can_fd_rxp_ctrl_s {
+#ifdef __LITTLE_ENDIAN_BITFIELD
+  /* RXP_CTRL */
+		uint32_t rpra                    : 1;
+		uint32_t rprb                    : 1;
+		uint32_t rprc                    : 1;
+		uint32_t rprr                    : 1;
+		uint32_t rprs                    : 1;
+		uint32_t reserved_7_5            : 3;
+		uint32_t rprrb                   : 1;
+		uint32_t rpcdo                   : 1;
+		uint32_t reserved_31_10         : 22;
+#else
+		uint32_t reserved_31_10         : 22;
+		uint32_t rpcdo                   : 1;
+		uint32_t rprrb                   : 1;
+		uint32_t reserved_7_5            : 3;
+		uint32_t rprs                    : 1;
+		uint32_t rprr                    : 1;
+		uint32_t rprc                    : 1;
+		uint32_t rprb                    : 1;
+		uint32_t rpra                    : 1;
+#endif
+	} s;
+};
+
+union ctu_can_fd_rxp_mem_info {
+	uint32_t u32;
+	struct ctu_can_fd_rxp_mem_info_s {
+#ifdef __LITTLE_ENDIAN_BITFIELD
+  /* RXP_MEM_INFO */
+		uint32_t rxp_buff_size          : 13;
+		uint32_t reserved_15_13          : 3;
+		uint32_t rxp_mem_free           : 13;
+		uint32_t reserved_31_29          : 3;
+#else
+		uint32_t reserved_31_29          : 3;
+		uint32_t rxp_mem_free           : 13;
+		uint32_t reserved_15_13          : 3;
+		uint32_t rxp_buff_size          : 13;
+#endif
+	} s;
+};
+
+union ctu_can_fd_rxp_status {
+	uint32_t u32;
+	struct ctu_can_fd_rxp_status_s {
+#ifdef __LITTLE_ENDIAN_BITFIELD
+  /* RXP_STATUS */
+		uint32_t rxpe                    : 1;
+		uint32_t rxpf                    : 1;
+		uint32_t rxpmof                  : 1;
+		uint32_t reserved_3              : 1;
+		uint32_t rxpfrc                 : 11;
+		uint32_t rxpdor                  : 1;
+		uint32_t reserved_31_16         : 16;
+#else
+		uint32_t reserved_31_16         : 16;
+		uint32_t rxpdor                  : 1;
+		uint32_t rxpfrc                 : 11;
+		uint32_t reserved_3              : 1;
+		uint32_t rxpmof                  : 1;
+		uint32_t rxpf                    : 1;
+		uint32_t rxpe                    : 1;
+#endif
+	} s;
+};
+
+union ctu_can_fd_rxp_data {
+	uint32_t u32;
+	struct ctu_can_fd_rxp_data_s {
+  /* RXP_DATA */
+		uint32_t rxp_data               : 32;
+	} s;
+};
+
 #endif
@@ -212,6 +212,254 @@ timespec_sub (struct timespec *diff, const struct timespec *left,
     }
 }
 
+/* 100 polls of transceiver delay measurement give each frame 10 ms */
+static void trv_meas_poll(void)
+{
+    usleep(100);
+}
+
+/*
+ * TX scheduling benchmark. Frames are sent in internal loopback and received
+ * back with timestamps (taken at SOF), so gaps between frames on the bus can
+ * be measured. FIFO mode mimics default kernel driver scheduling (strict
+ * buffer order, rotating priorities), packed mode mimics "tx_sched=1".
+ */
+struct txsched_bench_res {
+    int rx;
+    u64 elapsed_ns;
+    u64 busy_ns;
+    u64 gap_max_ns;
+};
+
+static void txsched_bench_frame(struct canfd_frame *cf, int i, bool fd)
+{
+    static const u8 fd_lens[] = {64, 0, 12, 48, 8, 32, 1, 20};
+    static const u8 lens[] = {8, 0, 2, 6, 8, 1, 4, 8};
+
+    memset(cf, 0, sizeof(*cf));
+    cf->can_id = 0x100 + (i % 3);
+    cf->len = fd ? fd_lens[i % 8] : lens[i % 8];
+    if (fd)
+        cf->flags = CANFD_BRS;
+    for (int j = 0; j < cf->len; j++)
+        cf->data[j] = i + j;
+}
+
+static bool txsched_bench_done(enum ctu_can_fd_tx_status_tx1s st)
+{
+    return st == TXT_TOK || st == TXT_ERR || st == TXT_ABT;
+}
+
+static void txsched_bench_run(struct ctucan_hw_priv *priv, int frames, bool fd,
+                              bool packed, u32 nbt_ns, u32 dbt_ns,
+                              struct txsched_bench_res *res)
+{
+    const unsigned n = CTU_CAN_FD_TXT_BUFFER_COUNT;
+    struct ctucan_hw_txb_frame txb[CTU_CAN_FD_TXT_BUFFER_COUNT];
+    u32 txb_prio = 0x01234567;
+    unsigned head = 0, tail = 0;
+    int next = 0;
+    u64 ts_first = 0, ts_prev = 0, tick_start, tick_end;
+    u32 prev_time = 0;
+    struct timespec tic, tac, diff;
+    double ticks_per_ns;
+    u64 *ts_log = (u64 *)calloc(frames, sizeof(u64));
+    u32 *time_log = (u32 *)calloc(frames, sizeof(u32));
+
+    if (!ts_log || !time_log)
+        err(1, "calloc failed");
+
+    memset(res, 0, sizeof(*res));
+    memset(txb, 0, sizeof(txb));
+    for (unsigned i = 0; i < n; i++)
+        ctucan_hw_txt_set_empty(priv, i);
+    priv->write_reg(priv, CTU_CAN_FD_TX_PRIORITY, txb_prio);
+
+    clock_gettime(CLOCK_MONOTONIC, &tic);
+    tick_start = ctucan_hw_read_timestamp(priv);
+
+    while (res->rx < frames) {
+        bool refill = false;
+
+        /* Process finished buffers */
+        if (packed) {
+            for (unsigned i = 0; i < n; i++) {
+                if (txb[i].pending && txsched_bench_done(ctucan_hw_get_tx_status(priv, i))) {
+                    txb[i].pending = false;
+                    ctucan_hw_txt_set_empty(priv, i);
+                }
+            }
+        } else {
+            while (head != tail && txsched_bench_done(ctucan_hw_get_tx_status(priv, tail % n))) {
+                /* Same rotation as ctucan_rotate_txb_prio */
+                txb_prio = (txb_prio << 4) | ((txb_prio >> ((n - 1) * 4)) & 0xF);
+                priv->write_reg(priv, CTU_CAN_FD_TX_PRIORITY, txb_prio);
+                ctucan_hw_txt_set_empty(priv, tail % n);
+                tail++;
+            }
+        }
+
+        /* Refill free buffers */
+        if (packed) {
+            bool filled[CTU_CAN_FD_TXT_BUFFER_COUNT] = {false};
+            u8 prio[CTU_CAN_FD_TXT_BUFFER_COUNT];
+
+            for (unsigned i = 0; i < n && next < frames; i++) {
+                struct canfd_frame cf;
+
+                if (txb[i].pending)
+                    continue;
+                txsched_bench_frame(&cf, next, fd);
+                ctucan_cosim_call_begin("tx_insert");
+                if (!ctucan_hw_insert_frame(priv, &cf, 0, i, fd))
+                    errx(1, "error: TXT Buffer %u not accessible", i);
+                ctucan_cosim_call_end();
+                txb[i].pending = true;
+                txb[i].can_id = cf.can_id;
+                txb[i].seq = next++;
+                txb[i].time_ns = ctucan_hw_frame_time(&cf, fd, nbt_ns, dbt_ns);
+                filled[i] = true;
+                refill = true;
+            }
+            if (refill) {
+                /* Priorities must be valid before buffers become ready */
+                ctucan_hw_txsched_prio(txb, n, next, prio);
+                ctucan_hw_set_txt_priority(priv, prio);
+                for (unsigned i = 0; i < n; i++)
+                    if (filled[i])
+                        ctucan_hw_txt_set_rdy(priv, i);
+            }
+        } else {
+            while (head - tail < n && next < frames) {
+                struct canfd_frame cf;
+
+                txsched_bench_frame(&cf, next++, fd);
+                ctucan_cosim_call_begin("tx_frame");
+                if (!ctucan_hw_insert_frame(priv, &cf, 0, head % n, fd))
+                    errx(1, "error: TXT Buffer %u not accessible", head % n);
+                ctucan_hw_txt_set_rdy(priv, head % n);
+                ctucan_cosim_call_end();
+                head++;
+            }
+        }
+
+        /* Collect looped-back frames */
+        while (ctucan_hw_get_rx_frame_count(priv)) {
+            struct canfd_frame cf;
+            u64 ts;
+
+            ctucan_cosim_call_begin("rx_frame");
+            ctucan_hw_read_rx_frame(priv, &cf, &ts);
+            ctucan_cosim_call_end();
+            ts_log[res->rx] = ts;
+            time_log[res->rx] = ctucan_hw_frame_time(&cf, fd, nbt_ns, dbt_ns);
+            res->rx++;
+        }
+    }
+
+    clock_gettime(CLOCK_MONOTONIC, &tac);
+    tick_end = ctucan_hw_read_timestamp(priv);
+    timespec_sub(&diff, &tac, &tic);
+
+    /* Timestamp frequency is not known, calibrate it against monotonic clock */
+    ticks_per_ns = (double)(tick_end - tick_start) /
+                   ((double)diff.tv_sec * 1e9 + diff.tv_nsec);
+
+    ts_first = ts_log[0];
+    for (int i = 0; i < res->rx; i++) {
+        if (i > 0) {
+            u64 delta = (u64)((ts_log[i] - ts_prev) / ticks_per_ns);
+            u64 gap = delta > prev_time ? delta - prev_time : 0;
+
+            if (gap > res->gap_max_ns)
+                res->gap_max_ns = gap;
+        }
+        res->busy_ns += time_log[i];
+        ts_prev = ts_log[i];
+        prev_time = time_log[i];
+    }
+    res->elapsed_ns = (u64)((ts_prev - ts_first) / ticks_per_ns) + prev_time;
+
+    free(ts_log);
+    free(time_log);
+}
+
+static void txsched_bench(struct ctucan_hw_priv *priv, int frames, bool fd,
+                          const struct can_bittiming *nbt,
+                          const struct can_bittiming *dbt)
+{
+    u32 nbt_ns = 1000000000 / nbt->bitrate;
+    u32 dbt_ns = 1000000000 / dbt->bitrate;
+
+    ctucan_hw_set_rx_tsop(priv, RTS_BEG);
+
+    for (int packed = 0; packed < 2; packed++) {
+        struct txsched_bench_res res;
+
+        txsched_bench_run(priv, frames, fd, packed, nbt_ns, dbt_ns, &res);
+        printf("%s: %d frames, elapsed %llu us, bus busy %llu us, "
+               "utilization %.1f %%, idle %llu us, max gap %llu ns\n",
+               packed ? "length-aware" : "FIFO", res.rx,
+               (unsigned long long)res.elapsed_ns / 1000,
+               (unsigned long long)res.busy_ns / 1000,
+               res.elapsed_ns ? 100.0 * res.busy_ns / res.elapsed_ns : 0.0,
+               (unsigned long long)(res.elapsed_ns > res.busy_ns ?
+                                    res.elapsed_ns - res.busy_ns : 0) / 1000,
+               (unsigned long long)res.gap_max_ns);
+    }
+}
+
+/*
+ * Parses filter rules in candump format "<can_id>:<can_mask>" or
+ * "<can_id>~<can_mask>" (inverted), separated by commas, values in hex.
+ */
+static unsigned parse_filter_rules(const char *str, struct can_filter *rules)
+{
+    unsigned n = 0;
+    char *e;
+
+    while (*str) {
+        if (n >= CTUCANFD_FILTER_MAX_RULES)
+            errx(1, "-F accepts at most %d rules", CTUCANFD_FILTER_MAX_RULES);
+        rules[n].can_id = strtoul(str, &e, 16);
+        if (*e != ':' && *e != '~')
+            errx(1, "-F expects <can_id>:<can_mask> or <can_id>~<can_mask>");
+        if (*e == '~')
+            rules[n].can_id |= CAN_INV_FILTER;
+        rules[n].can_mask = strtoul(e + 1, &e, 16);
+        if (*e != ',' && *e != '\0')
+            errx(1, "-F rules must be separated by ','");
+        str = *e ? e + 1 : e;
+        n++;
+    }
+    return n;
+}
+
+static void setup_filters(struct ctucan_hw_priv *priv, struct ctucan_filter *f,
+                          const struct can_filter *rules, unsigned n_rules)
+{
+    u8 mask_sup = 0;
+
+    for (int i = 0; i < CTUCANFD_FILTER_MASK_COUNT; i++)
+        if (ctucan_hw_get_mask_filter_support(priv, i))
+            mask_sup |= 1 << i;
+
+    if (ctucan_filter_compile(f, rules, n_rules, mask_sup,
+                              ctucan_hw_get_range_filter_support(priv)))
+        errx(1, "error: filter compilation failed");
+    ctucan_hw_set_filters(priv, f);
+
+    for (int i = 0; i < CTUCANFD_FILTER_MASK_COUNT; i++)
+        if (f->hw_mask[i].ctrl)
+            printf("Filter %c: mask 0x%08x value 0x%08x types 0x%x\n", 'A' + i,
+                   f->hw_mask[i].mask, f->hw_mask[i].low, f->hw_mask[i].ctrl);
+    if (f->hw_range.ctrl)
+        printf("Range filter: 0x%08x - 0x%08x types 0x%x\n", f->hw_range.low,
+               f->hw_range.high, f->hw_range.ctrl);
+    printf("HW filtering %s, SW filtering %s\n", f->hw_ena ? "on" : "off",
+           f->sw_ena ? "on" : "off");
+}
+
 int main(int argc, char *argv[])
 {
     uintptr_t addr_base = 0;
@@ -226,13 +474,20 @@ int main(int argc, char *argv[])
     bool transmit_fdf = false;
     bool loopback_mode = false;
     bool test_read_speed = false;
+    bool access64 = false;
+    int ssp_cal_frames = 0;
+    int sched_bench_frames = 0;
+    static struct can_filter filter_rules[CTUCANFD_FILTER_MAX_RULES];
+    static struct ctucan_filter rx_filter;
+    unsigned n_filter_rules = 0;
+    unsigned sw_filtered = 0;
     //bool do_showhelp = false;
     static uintptr_t addrs[] = {0x43C30000, 0x43C70000};
 
     int c;
     char *e;
     const char *progname = argv[0];
-    while ((c = getopt(argc, argv, "i:a:g:b:B:I:fltThpr")) != -1) {
+    while ((c = getopt(argc, argv, "i:a:g:b:B:I:s:U:F:fltThprw")) != -1) {
         switch (c) {
             case 'i':
                 ifc = strtoul(optarg, &e, 0);
@@ -270,11 +525,28 @@ int main(int argc, char *argv[])
                     err(1, "-I expects a number");
             break;
 
+            case 's':
+                ssp_cal_frames = strtoul(optarg, &e, 0);
+                if (*e != '\0')
+                    err(1, "-s expects a number");
+            break;
+
+            case 'U':
+                sched_bench_frames = strtoul(optarg, &e, 0);
+                if (*e != '\0')
+                    err(1, "-U expects a number");
+            break;
+
+            case 'F':
+                n_filter_rules = parse_filter_rules(optarg, filter_rules);
+            break;
+
             case 'l': loopback_mode = true; break;
             case 't': do_transmit = true; break;
             case 'T': do_periodic_transmit = true; break;
             case 'f': transmit_fdf = true; break;
             case 'r': test_read_speed  = true; break;
+            case 'w': access64 = true; break;
             case 'p':
                 addrs[0] = pci_find_bar(0x1172, 0xcafd, 0, 1);
                 if (!addrs[0])
@@ -284,8 +556,16 @@ int main(int argc, char *argv[])
                 addrs[1] = addrs[0] + 0x4000;
             break;
             case 'h':
-                printf("Usage: %s [-i ifc] [-a address] [-l] [-t] [-T]\n\n"
-                       "  -t: Transmit\n",
+                printf("Usage: %s [-i ifc] [-a address] [-l] [-t] [-T] [-s frames] [-U frames] [-F filters]\n\n"
+                       "  -t: Transmit\n"
+                       "  -s: Calibrate secondary sample point from transceiver\n"
+                       "      delay measured over given number of CAN FD frames\n"
+                       "  -U: Compare bus utilization of FIFO and length-aware\n"
+                       "      TX scheduling in internal loopback (-f for CAN FD)\n"
+                       "  -F: Receive only frames matching <can_id>:<can_mask>\n"
+                       "      or <can_id>~<can_mask> rules (hex, comma separated)\n"
+                       "  -w: Use 64-bit accesses for RX and TXT Buffer data\n"
+                       "      (core attached by can_top_axi)\n",
                        progname
                 );
                 return 0;
@@ -302,6 +582,8 @@ int main(int argc, char *argv[])
     struct ctucan_hw_priv *priv = ctucanfd_init(addr_base);
     int res;
 
+    priv->access64 = access64;
+
     union ctu_can_fd_device_id_version reg;
     reg.u32 = priv->read_reg(priv, CTU_CAN_FD_DEVICE_ID);
 
@@ -331,6 +613,22 @@ int main(int argc, char *argv[])
 	printf("%d reads takes %ld.%09ld s\n",
 	       i, (long)diff.tv_sec, diff.tv_nsec);
 
+	if (priv->access64) {
+		const void *win = (const void *)((const volatile char *)priv->mem_base +
+						 CTU_CAN_FD_RX_DATA_WINDOW);
+		u64 dummy64;
+		(void)dummy64;
+		clock_gettime(CLOCK_MONOTONIC, &tic);
+		for (i = 0; i < 1000 * 1000; i++) {
+			dummy64 = ioread64(win);
+		}
+		clock_gettime(CLOCK_MONOTONIC, &tac);
+
+		timespec_sub(&diff, &tac, &tic);
+		printf("%d 64-bit reads takes %ld.%09ld s\n",
+		       i, (long)diff.tv_sec, diff.tv_nsec);
+	}
+
 	dummy = 0;
         clock_gettime(CLOCK_MONOTONIC, &tic);
 	for (i = 0; i < 1000 * 1000; i++) {
@@ -422,6 +720,67 @@ int main(int argc, char *argv[])
         ctucan_hw_set_mode(priv, &mode);
     }
 
+    if (ssp_cal_frames > 0) {
+        struct ctucan_hw_trv_stats stats;
+        int ssp_pos, done;
+
+        /*
+         * Self-test mode -> no ACK needed, so measurement works also
+         * without other node on the bus. Limit retransmissions so that
+         * failing frame does not block the measurement.
+         */
+        union ctu_can_fd_mode_settings mode;
+        mode.u32 = priv->read_reg(priv, CTU_CAN_FD_MODE);
+        mode.s.stm = 1;
+        priv->write_reg(priv, CTU_CAN_FD_MODE, mode.u32);
+        ctucan_hw_set_ret_limit(priv, true, 3);
+
+        ctucan_hw_enable(priv, true);
+        usleep(10000);
+
+        ctucan_hw_trv_stats_init(&stats);
+        done = ctucan_hw_measure_trv_delay(priv, &stats, ssp_cal_frames,
+                                           CTU_CAN_FD_TXT_BUFFER_1,
+                                           trv_meas_poll);
+        printf("TRV_DELAY measured in %d/%d frames\n", done, ssp_cal_frames);
+        if (!stats.count)
+            errx(1, "error: no transceiver delay measured");
+
+        printf("TRV_DELAY min %u, max %u, mean %u.%02u, median %u\n",
+               stats.min, stats.max, stats.sum / stats.count,
+               (stats.sum % stats.count) * 100 / stats.count,
+               ctucan_hw_trv_stats_median(&stats));
+        for (int i = stats.min; i <= stats.max; i++) {
+            if (stats.hist[i])
+                printf("  %3d: %u\n", i, stats.hist[i]);
+        }
+
+        ssp_pos = ctucan_hw_calc_ssp_pos(&stats, &data_timing);
+        printf("SSP position: %d clock cycles\n", ssp_pos);
+
+        /* SSP configuration is locked while Core is enabled */
+        ctucan_hw_enable(priv, false);
+        ctucan_hw_configure_ssp(priv, true, false, ssp_pos);
+        ctucan_hw_enable(priv, true);
+        printf("SSP_CFG=0x%08x\n", priv->read_reg(priv, CTU_CAN_FD_TRV_DELAY));
+        return 0;
+    }
+
+    if (sched_bench_frames > 0) {
+        struct can_ctrlmode mode = {0, 0};
+        mode.mask  = CAN_CTRLMODE_LOOPBACK | CAN_CTRLMODE_PRESUME_ACK | CAN_CTRLMODE_FD;
+        mode.flags = CAN_CTRLMODE_LOOPBACK | CAN_CTRLMODE_PRESUME_ACK | CAN_CTRLMODE_FD;
+        ctucan_hw_set_mode(priv, &mode);
+        ctucan_hw_enable(priv, true);
+        usleep(10000);
+
+        txsched_bench(priv, sched_bench_frames, transmit_fdf, &nom_timing, &data_timing);
+        return 0;
+    }
+
+    if (n_filter_rules)
+        setup_filters(priv, &rx_filter, filter_rules, n_filter_rules);
+
     ctucan_hw_enable(priv, true);
     usleep(10000);
 
@@ -463,6 +822,8 @@ int main(int argc, char *argv[])
         printf(", TX_STATUS 0x%04hx", priv->read_reg(priv, CTU_CAN_FD_TX_STATUS));
         //printf(", CTU_CAN_FD_ERR_CAPT 0x%02hhx", ctu_can_fd_read8(priv, CTU_CAN_FD_ERR_CAPT));
         printf(", TRV_DELAY 0x%0hx", priv->read_reg(priv, CTU_CAN_FD_TRV_DELAY));
+        if (rx_filter.sw_ena)
+            printf(", SW filtered %u", sw_filtered);
 
         printf("\n");
 
@@ -483,12 +844,16 @@ int main(int argc, char *argv[])
             struct canfd_frame cf;
             u64 ts;
             ctucan_hw_read_rx_frame(priv, &cf, &ts);
+            rxsz = 0;
+            nrxf = ctucan_hw_get_rx_frame_count(priv);
+            if (rx_filter.sw_ena && !ctucan_filter_match(&rx_filter, cf.can_id)) {
+                sw_filtered++;
+                continue;
+            }
             printf("%llu: #%x [%u]", ts, cf.can_id, cf.len);
             for (int i=0; i<cf.len; ++i)
                 printf(" %02x", cf.data[i]);
             printf("\n");
-            rxsz = 0;
-            nrxf = ctucan_hw_get_rx_frame_count(priv);
         }
 
         if (do_periodic_transmit && (loop_cycle & 1)) {
@@ -0,0 +1 @@
+../ctucanfd_filter.c
\ No newline at end of file
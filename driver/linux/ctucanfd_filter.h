@@ -0,0 +1 @@
+../ctucanfd_filter.h
\ No newline at end of file
@@ -85,6 +85,19 @@ void ctu_can_fd_write16(struct ctucan_hw_priv *priv, enum ctu_can_fd_can_registe
 
 struct ctucan_hw_priv* ctucanfd_init(uint32_t addr)
 {
+    const char *cosim = getenv(CTUCAN_COSIM_ENV);
+
+    if (cosim) {
+        struct ctucan_hw_priv *priv = new ctucan_hw_priv;
+        memset(priv, 0, sizeof(*priv));
+
+        if (ctucan_cosim_init(priv, cosim))
+            err(1, "open co-simulation pipes in %s", cosim);
+        fprintf(stderr, "co-simulation %s\n", cosim);
+        priv->ts_high_latch = ctucan_hw_get_version(priv) >= CTU_CAN_FD_VER_TS_HIGH_LATCH;
+        return priv;
+    }
+
     mem_open();
     volatile void * const base = mem_map(addr, CANFD_ADDR_RANGE);
 
@@ -94,6 +107,7 @@ struct ctucan_hw_priv* ctucanfd_init(uint32_t addr)
     priv->mem_base = base;
     priv->read_reg = ctucan_hw_read32;
     priv->write_reg = ctucan_hw_write32;
+    priv->ts_high_latch = ctucan_hw_get_version(priv) >= CTU_CAN_FD_VER_TS_HIGH_LATCH;
 
      // will leak memory, but who cares, this is just a prototype testing tool
     return priv;
@@ -32,6 +32,8 @@
 extern "C" {
 #include "ctucanfd_linux_defs.h"
 #include "ctucanfd_hw.h"
+#include "ctucanfd_filter.h"
+#include "ctucanfd_cosim.h"
 }
 
 #undef abs
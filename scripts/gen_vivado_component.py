@@ -4,13 +4,23 @@ Generate vivado component file in /src/component.xml.
 
 Serves to update the list of source files -- run when you add/delete/rename
 a src vhdl file.
+
+Top-level entity of the component is selected by --top:
+  apb - can_top_apb with APB4 slave (default, committed component.xml)
+  axi - can_top_axi with AXI4 slave with 64-bit data path
 """
 
+import argparse
 from jinja2 import Environment, FileSystemLoader, select_autoescape
 from pathlib import Path
 
 d = Path(__file__).parent
 
+parser = argparse.ArgumentParser(description=__doc__.splitlines()[1])
+parser.add_argument('--top', choices=['apb', 'axi'], default='apb',
+                    help='bus interface of top-level entity')
+args = parser.parse_args()
+
 jinja_env = Environment(
                 loader=FileSystemLoader(str(d)),
                 autoescape=select_autoescape(['html', 'xml']))
@@ -21,6 +31,6 @@ src_dir = d / '..' / 'src'
 files = [str(f.relative_to(src_dir)) for f in src_dir.glob('**/*.vhd')]
 files = sorted(files)
 
-contents = template.render(files=files)
+contents = template.render(files=files, top=args.top)
 with (src_dir / 'component.xml').open('wt', encoding='utf-8') as f:
     f.write(contents)
@@ -50,17 +50,21 @@
 ##			1. Set Environment variable $TOOL_NAME = "Vivado"
 ##          2. Wait till the end and check results in runs.
 ##
+##		Set $BENCHMARK_TARGET = "tx_arbitrator" to synthesize TX Arbitrator
+##		alone with 8, 16 and 32 TXT Buffers, with and without pipelined
+##		priority decoder. Resources and maximal frequency (Quartus) or
+##		worst slack at 100 MHz (Vivado) show the impact of the decoder.
+##		Default ("core") synthesizes whole CTU CAN FD.
+##
 ## 		Quartus TCL script for automation of core resource requirements.
 ##      Execute the script in Quartus project: Benchmark_project located
 ##      in synthesis/Quartus.
 ################################################################################
 
 
-proc intel_benchmark {} {
+proc intel_benchmark {top_entity param_names cfg_list} {
 
 	global results
-	global PARAM_NAMES
-	global CFG_LIST
 	
 	puts "Running Quartus Benchmark!"
 
@@ -68,14 +72,16 @@ proc intel_benchmark {} {
 	load_package flow
 	load_package report
 
+	set_global_assignment -name TOP_LEVEL_ENTITY $top_entity
+
 	#List through CTU CAN FD configurations
-	foreach config $CFG_LIST {
+	foreach config $cfg_list {
 	   set act_cfg [lindex $config 0]
 	   puts "Configuration name: ${act_cfg}"
 	   
 	   # Set configuration to top level entity and compile
-	   foreach par_name $PARAM_NAMES par_val $config {
-		    set_parameter -entity "CAN_Wrapper" -name $par_name $par_val
+	   foreach par_name $param_names par_val $config {
+		    set_parameter -entity $top_entity -name $par_name $par_val
 	   }
 	   execute_flow -compile
 	   
@@ -112,16 +118,16 @@ proc intel_benchmark {} {
 }
 
 
-proc xilinx_benchmark {} {
+proc xilinx_benchmark {top_entity param_names cfg_list} {
 
-    global CFG_LIST
-    global PARAM_NAMES
     global results
 
 	puts "Running Vivado Benchmark!"
 
+	set_property top $top_entity [current_fileset]
+
 	#List through CTU CAN FD configurations
-	foreach config $CFG_LIST {
+	foreach config $cfg_list {
 	   set act_cfg [lindex $config 0]
 	   puts "Configuration name: ${act_cfg}"
 	
@@ -134,7 +140,7 @@ proc xilinx_benchmark {} {
 
 		# Set configuration to top level entity
         set parm_dict {}
-	    foreach par_name $PARAM_NAMES par_val $config {
+	    foreach par_name $param_names par_val $config {
             puts "${par_name} : ${par_val}"
             dict append parm_dict $par_name=$par_val
 		}
@@ -144,6 +150,19 @@ proc xilinx_benchmark {} {
         reset_run $run_name
 		launch_run $run_name
 		wait_on_run $run_name
+
+		# Get resources and worst slack at 100 MHz from synthesized design
+		open_run $run_name
+		create_clock -name clk_sys -period 10.000 [get_ports clk_sys]
+		set luts [llength [get_cells -hierarchical -filter {PRIMITIVE_GROUP == LUT}]]
+		set regs [llength [get_cells -hierarchical -filter {PRIMITIVE_GROUP == FLOP_LATCH}]]
+		set wns [get_property SLACK [get_timing_paths -max_paths 1 -setup]]
+		close_design
+
+		lappend results [list $act_cfg [list "LUTs" $luts] \
+										[list "REGs" $regs] \
+										[list "WNS at 100 MHz" $wns]
+						]
     }
 }
 
@@ -205,6 +224,33 @@ set CFG_LIST [ list          [ list "Minimal_configuration" \
 							  ] 
 			]
 
+## Name of TX Arbitrator parameters
+set ARB_PARAM_NAMES [ list "dummy" \
+                           "G_TXT_BUFFER_COUNT" \
+                           "G_PRIO_DEC_PIPELINE"
+                    ]
+
+## List of TX Arbitrator configurations
+set ARB_CFG_LIST [ list [ list "TXT_Buffers_8"             8  false ] \
+                        [ list "TXT_Buffers_8_Pipelined"   8  true  ] \
+                        [ list "TXT_Buffers_16"            16 false ] \
+                        [ list "TXT_Buffers_16_Pipelined"  16 true  ] \
+                        [ list "TXT_Buffers_32"            32 false ] \
+                        [ list "TXT_Buffers_32_Pipelined"  32 true  ]
+                 ]
+
+if {![info exists BENCHMARK_TARGET]} {
+	set BENCHMARK_TARGET "core"
+}
+
+if {$BENCHMARK_TARGET == "tx_arbitrator"} {
+	set TOP_ENTITY "tx_arbitrator"
+	set PARAM_NAMES $ARB_PARAM_NAMES
+	set CFG_LIST $ARB_CFG_LIST
+} else {
+	set TOP_ENTITY "CAN_Wrapper"
+}
+
 
 ################################################################################
 ## Main script
@@ -214,12 +260,12 @@ puts "Starting CTU CAN FD FPGA Benchmark. Selected tool:"
 puts $TOOL_NAME
 
 if {$TOOL_NAME == "Quartus"} {
-	intel_benchmark
+	intel_benchmark $TOP_ENTITY $PARAM_NAMES $CFG_LIST
 }
 
 
 if {$TOOL_NAME == "Vivado"} {
-	xilinx_benchmark
+	xilinx_benchmark $TOP_ENTITY $PARAM_NAMES $CFG_LIST
 }
 
 print_results
@@ -72,6 +72,15 @@
 --
 -- Purpose:
 --  Counts number of transmitted and received frames on CAN Bus.
+--
+--  Additionally, bus statistics counters count bits on the bus when the node
+--  is transmitter or receiver (busy) and when bus is idle, error frames,
+--  overload frames and stuff bits. Bits are counted at sample point (Data bit
+--  rate bits are counted as well). On snapshot command, values of all bus
+--  statistics counters are stored to snapshot registers and counters restart
+--  from zero in the same clock cycle, so no event is lost. Snapshot register
+--  selected by "bus_stat_sel" is provided on output. Thus SW reads consistent
+--  set of values which corresponds to the same time interval.
 --------------------------------------------------------------------------------
 
 Library ieee;
@@ -120,6 +129,34 @@ entity bus_traffic_counters is
         -- Increment RX Traffic Counter
         inc_rx_ctr             :in   std_logic;
 
+        -- Store bus statistics counters to snapshot and clear them
+        bus_stat_snap          :in   std_logic;
+
+        -- Selector of bus statistics snapshot on output
+        bus_stat_sel           :in   std_logic_vector(2 downto 0);
+
+        ------------------------------------------------------------------------
+        -- Bus statistics sources
+        ------------------------------------------------------------------------
+        -- Sample point (RX Trigger)
+        sample                 :in   std_logic;
+
+        -- Unit is transmitter or receiver
+        is_transmitter         :in   std_logic;
+        is_receiver            :in   std_logic;
+
+        -- Bus is idle
+        is_idle                :in   std_logic;
+
+        -- Error frame is being transmitted
+        is_err_frm             :in   std_logic;
+
+        -- Overload frame is being transmitted
+        is_overload            :in   std_logic;
+
+        -- Bit was destuffed
+        destuffed              :in   std_logic;
+
         ------------------------------------------------------------------------
         -- Counter outputs
         ------------------------------------------------------------------------
@@ -127,7 +164,10 @@ entity bus_traffic_counters is
         tx_ctr                 :out  std_logic_vector(31 downto 0);
         
         -- RX Traffic counter
-        rx_ctr                 :out  std_logic_vector(31 downto 0)
+        rx_ctr                 :out  std_logic_vector(31 downto 0);
+
+        -- Selected bus statistics snapshot
+        bus_stat_ctr           :out  std_logic_vector(31 downto 0)
     );
 end entity;
 
@@ -151,6 +191,31 @@ architecture rtl of bus_traffic_counters is
     signal rx_ctr_rst_n_q        :     std_logic;
     signal rx_ctr_rst_n_q_scan   :     std_logic;
 
+    ----------------------------------------------------------------------------
+    -- Bus statistics counters (indices as in BUS_STAT_SEL register)
+    ----------------------------------------------------------------------------
+    constant C_BUS_STAT_COUNT    :     natural := 5;
+
+    constant C_BS_BUSY     : natural := to_integer(unsigned(BS_BUSY_BITS));
+    constant C_BS_IDLE     : natural := to_integer(unsigned(BS_IDLE_BITS));
+    constant C_BS_ERR_FRM  : natural := to_integer(unsigned(BS_ERR_FRMS));
+    constant C_BS_OVR_FRM  : natural := to_integer(unsigned(BS_OVR_FRMS));
+    constant C_BS_STUFF    : natural := to_integer(unsigned(BS_STUFF_BITS));
+
+    type t_bus_stat_ctrs is array (0 to C_BUS_STAT_COUNT - 1) of
+        unsigned(31 downto 0);
+
+    -- Increment of each counter
+    signal bus_stat_inc          :     std_logic_vector(C_BUS_STAT_COUNT - 1 downto 0);
+
+    -- Running counters and snapshots
+    signal bus_stat_ctr_q        :     t_bus_stat_ctrs;
+    signal bus_stat_snap_q       :     t_bus_stat_ctrs;
+
+    -- Error / Overload frame flags delayed for edge detection
+    signal is_err_frm_q          :     std_logic;
+    signal is_overload_q         :     std_logic;
+
 begin
 
     tx_ctr <= tx_ctr_i;
@@ -261,6 +326,64 @@ begin
     end process;
 
 
+    ----------------------------------------------------------------------------
+    -- Bus statistics counters
+    ----------------------------------------------------------------------------
+    bus_stat_inc(C_BS_BUSY) <= '1' when (sample = '1' and
+                                          (is_transmitter = '1' or
+                                           is_receiver = '1'))
+                                    else
+                                '0';
+
+    bus_stat_inc(C_BS_IDLE) <= '1' when (sample = '1' and is_idle = '1') else
+                                '0';
+
+    bus_stat_inc(C_BS_ERR_FRM) <= '1' when (is_err_frm = '1' and
+                                             is_err_frm_q = '0')
+                                       else
+                                   '0';
+
+    bus_stat_inc(C_BS_OVR_FRM) <= '1' when (is_overload = '1' and
+                                             is_overload_q = '0')
+                                       else
+                                   '0';
+
+    bus_stat_inc(C_BS_STUFF) <= '1' when (sample = '1' and destuffed = '1') else
+                                 '0';
+
+    bus_stat_ctr_proc : process(clk_sys, res_n)
+    begin
+        if (res_n = '0') then
+            bus_stat_ctr_q  <= (OTHERS => (OTHERS => '0'));
+            bus_stat_snap_q <= (OTHERS => (OTHERS => '0'));
+            is_err_frm_q    <= '0';
+            is_overload_q   <= '0';
+
+        elsif rising_edge(clk_sys) then
+            is_err_frm_q    <= is_err_frm;
+            is_overload_q   <= is_overload;
+
+            for i in 0 to C_BUS_STAT_COUNT - 1 loop
+                if (bus_stat_snap = '1') then
+                    bus_stat_snap_q(i) <= bus_stat_ctr_q(i);
+                    if (bus_stat_inc(i) = '1') then
+                        bus_stat_ctr_q(i) <= to_unsigned(1, 32);
+                    else
+                        bus_stat_ctr_q(i) <= (OTHERS => '0');
+                    end if;
+                elsif (bus_stat_inc(i) = '1') then
+                    bus_stat_ctr_q(i) <= bus_stat_ctr_q(i) + 1;
+                end if;
+            end loop;
+        end if;
+    end process;
+
+    bus_stat_ctr <= std_logic_vector(
+                        bus_stat_snap_q(to_integer(unsigned(bus_stat_sel))))
+                        when (to_integer(unsigned(bus_stat_sel)) < C_BUS_STAT_COUNT)
+                        else
+                    (OTHERS => '0');
+
     -- <RELEASE_OFF>
     ---------------------------------------------------------------------------
     -- Assertions
@@ -277,6 +400,15 @@ begin
     -- psl traffic_ctrs_rx_inc_cov : cover
     --  {inc_rx_ctr = '1'};
 
+    -- psl bus_stat_snap_on_inc_cov : cover
+    --  {bus_stat_snap = '1' and bus_stat_inc /= "00000"};
+
+    -- psl bus_stat_stuff_cov : cover
+    --  {bus_stat_inc(C_BS_STUFF) = '1'};
+
+    -- psl bus_stat_ovr_frm_cov : cover
+    --  {bus_stat_inc(C_BS_OVR_FRM) = '1'};
+
     -- <RELEASE_ON>
 
 end architecture;
@@ -327,6 +327,8 @@ architecture rtl of can_core is
     ----------------------------------------------------------------------------
     signal drv_clr_rx_ctr          :     std_logic;
     signal drv_clr_tx_ctr          :     std_logic;
+    signal drv_bus_stat_snap       :     std_logic;
+    signal drv_bus_stat_sel        :     std_logic_vector(2 downto 0);
     signal drv_bus_mon_ena         :     std_logic;
     signal drv_ena                 :     std_logic;
    
@@ -446,6 +448,7 @@ architecture rtl of can_core is
     -- Bus traffic counters
     signal tx_ctr                  :    std_logic_vector(31 downto 0);
     signal rx_ctr                  :    std_logic_vector(31 downto 0);
+    signal bus_stat_ctr            :    std_logic_vector(31 downto 0);
     
     signal tx_data_wbs_i           :    std_logic;
     
@@ -495,6 +498,9 @@ begin
     ----------------------------------------------------------------------------
     drv_clr_rx_ctr        <=  drv_bus(DRV_CLR_RX_CTR_INDEX);
     drv_clr_tx_ctr        <=  drv_bus(DRV_CLR_TX_CTR_INDEX);
+    drv_bus_stat_snap     <=  drv_bus(DRV_BUS_STAT_SNAP_INDEX);
+    drv_bus_stat_sel      <=  drv_bus(DRV_BUS_STAT_SEL_HIGH downto
+                                      DRV_BUS_STAT_SEL_LOW);
     drv_bus_mon_ena       <=  drv_bus(DRV_BUS_MON_ENA_INDEX);
     drv_ena               <=  drv_bus(DRV_ENA_INDEX);
 
@@ -818,10 +824,22 @@ begin
             clear_tx_ctr        => drv_clr_tx_ctr,          -- IN
             inc_tx_ctr          => tran_valid_i,            -- IN
             inc_rx_ctr          => rec_valid_i,             -- IN
+            bus_stat_snap       => drv_bus_stat_snap,       -- IN
+            bus_stat_sel        => drv_bus_stat_sel,        -- IN
+
+            -- Bus statistics sources
+            sample              => rx_triggers(0),          -- IN
+            is_transmitter      => is_transmitter,          -- IN
+            is_receiver         => is_receiver,             -- IN
+            is_idle             => is_idle,                 -- IN
+            is_err_frm          => is_err_frm,              -- IN
+            is_overload         => is_overload_i,           -- IN
+            destuffed           => destuffed,               -- IN
 
             -- Counter outputs
             tx_ctr              => tx_ctr,                  -- OUT
-            rx_ctr              => rx_ctr                   -- OUT
+            rx_ctr              => rx_ctr,                  -- OUT
+            bus_stat_ctr        => bus_stat_ctr             -- OUT
         );
 
     end generate bus_traffic_ctrs_gen;
@@ -829,6 +847,7 @@ begin
     no_bus_traffic_ctrs_gen : if (G_SUP_TRAFFIC_CTRS = false) generate
         tx_ctr <= (OTHERS => '0');
         rx_ctr <= (OTHERS => '0');
+        bus_stat_ctr <= (OTHERS => '0');
     end generate;
     
     ---------------------------------------------------------------------------
@@ -929,7 +948,7 @@ begin
     ----------------------------------------------------------------------------
     -- STATUS Bus Implementation
     ----------------------------------------------------------------------------
-    stat_bus(511 downto 386) <= (OTHERS => '0');
+    stat_bus(511 downto 418) <= (OTHERS => '0');
     stat_bus(299 downto 297) <= (OTHERS => '0');
     stat_bus(98 downto 90)   <= (OTHERS => '0');
     stat_bus(60 downto 32)   <= (OTHERS => '0');
@@ -1163,6 +1182,9 @@ begin
     stat_bus(STAT_TX_CTR_HIGH downto STAT_TX_CTR_LOW) <=
         tx_ctr;
 
+    stat_bus(STAT_BUS_STAT_CTR_HIGH downto STAT_BUS_STAT_CTR_LOW) <=
+        bus_stat_ctr;
+
     stat_bus(STAT_FCS_CHANGED_INDEX) <=
         fcs_changed_i;
         
@@ -94,8 +94,20 @@ entity can_top_ahb is
         sup_filtB           : boolean                  := true;
         sup_filtC           : boolean                  := true;
         sup_range           : boolean                  := true;
+        sup_filt_set        : boolean                  := false;
         sup_traffic_ctrs    : boolean                  := true;
-        sup_test_registers  : boolean                  := true
+        sup_test_registers  : boolean                  := true;
+        sup_rx_dma          : boolean                  := false;
+        sup_tx_fifo         : boolean                  := false;
+        tx_fifo_depth       : natural range 2 to 64    := 16;
+        tx_arb_pipeline     : boolean                  := false;
+        sup_int_ts          : boolean                  := false;
+        sup_tx_ts           : boolean                  := false;
+        sup_ts_gen          : boolean                  := false;
+        sup_txt_cyclic      : boolean                  := false;
+        sup_tx_cpl          : boolean                  := false;
+        sup_rx_prio         : boolean                  := false;
+        rx_prio_buffer_size : natural range 32 to 4096 := 32
     );
     port(
         -----------------------------------------------------------------------
@@ -116,6 +128,20 @@ entity can_top_ahb is
         hreadyout        : out std_logic;
         hresp            : out std_logic;
         hrdata           : out std_logic_vector(31 downto 0);
+
+        -----------------------------------------------------------------------
+        -- AHB master interface (RX DMA)
+        -----------------------------------------------------------------------
+        m_haddr          : out std_logic_vector(31 downto 0);
+        m_hwdata         : out std_logic_vector(31 downto 0);
+        m_hwrite         : out std_logic;
+        m_hsize          : out std_logic_vector(2 downto 0);
+        m_hburst         : out std_logic_vector(2 downto 0);
+        m_hprot          : out std_logic_vector(3 downto 0);
+        m_htrans         : out std_logic_vector(1 downto 0);
+        m_hmastlock      : out std_logic;
+        m_hready         : in  std_logic := '1';
+        m_hresp          : in  std_logic := '0';
         
         -----------------------------------------------------------------------
         -- Synchronized reset 
@@ -158,6 +184,12 @@ architecture rtl of can_top_ahb is
     
     signal res_n_out_i       : std_logic;
 
+    signal dma_m_addr        : std_logic_vector(31 downto 0);
+    signal dma_m_wdata       : std_logic_vector(31 downto 0);
+    signal dma_m_req         : std_logic;
+    signal dma_m_ack         : std_logic;
+    signal dma_m_err         : std_logic;
+
 begin
 
     can_inst : entity ctu_can_fd_rtl.can_top_level
@@ -168,8 +200,20 @@ begin
         sup_filtB           => sup_filtB,
         sup_filtC           => sup_filtC,
         sup_range           => sup_range,
+        sup_filt_set        => sup_filt_set,
         sup_traffic_ctrs    => sup_traffic_ctrs,
-        sup_test_registers  => sup_test_registers 
+        sup_test_registers  => sup_test_registers,
+        sup_rx_dma          => sup_rx_dma,
+        sup_tx_fifo         => sup_tx_fifo,
+        tx_fifo_depth       => tx_fifo_depth,
+        tx_arb_pipeline     => tx_arb_pipeline,
+        sup_int_ts          => sup_int_ts,
+        sup_tx_ts           => sup_tx_ts,
+        sup_ts_gen          => sup_ts_gen,
+        sup_txt_cyclic      => sup_txt_cyclic,
+        sup_tx_cpl          => sup_tx_cpl,
+        sup_rx_prio         => sup_rx_prio,
+        rx_prio_buffer_size => rx_prio_buffer_size
     )
     port map (
         clk_sys         => hclk,
@@ -188,6 +232,12 @@ begin
 
         int             => int,
 
+        dma_m_addr      => dma_m_addr,
+        dma_m_wdata     => dma_m_wdata,
+        dma_m_req       => dma_m_req,
+        dma_m_ack       => dma_m_ack,
+        dma_m_err       => dma_m_err,
+
         CAN_tx          => CAN_tx,
         CAN_rx          => CAN_rx,
 
@@ -222,6 +272,31 @@ begin
         hresp            => hresp,
         hrdata           => hrdata
     );
+
+
+    ahb_master_ifc_inst : entity ctu_can_fd_rtl.ahb_master_ifc
+    port map(
+        -- CTU CAN FD Interface
+        dma_m_addr       => dma_m_addr,
+        dma_m_wdata      => dma_m_wdata,
+        dma_m_req        => dma_m_req,
+        dma_m_ack        => dma_m_ack,
+        dma_m_err        => dma_m_err,
+
+        -- AHB interface 
+        hresetn          => res_n_out_i,
+        hclk             => hclk,
+        haddr            => m_haddr,
+        hwdata           => m_hwdata,
+        hwrite           => m_hwrite,
+        hsize            => m_hsize,
+        hburst           => m_hburst,
+        hprot            => m_hprot,
+        htrans           => m_htrans,
+        hmastlock        => m_hmastlock,
+        hready           => m_hready,
+        hresp            => m_hresp
+    );
     
     res_n_out <= res_n_out_i;
   
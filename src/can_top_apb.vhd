@@ -94,8 +94,19 @@ entity can_top_apb is
         sup_filtB           : boolean                  := true;
         sup_filtC           : boolean                  := true;
         sup_range           : boolean                  := true;
+        sup_filt_set        : boolean                  := false;
         sup_traffic_ctrs    : boolean                  := true;
-        sup_test_registers  : boolean                  := true
+        sup_test_registers  : boolean                  := true;
+        sup_tx_fifo         : boolean                  := false;
+        tx_fifo_depth       : natural range 2 to 64    := 16;
+        tx_arb_pipeline     : boolean                  := false;
+        sup_int_ts          : boolean                  := false;
+        sup_tx_ts           : boolean                  := false;
+        sup_ts_gen          : boolean                  := false;
+        sup_txt_cyclic      : boolean                  := false;
+        sup_tx_cpl          : boolean                  := false;
+        sup_rx_prio         : boolean                  := false;
+        rx_prio_buffer_size : natural range 32 to 4096 := 32
     );
     port(
         aclk             : in  std_logic;
@@ -141,7 +152,18 @@ begin
             sup_filtB           => sup_filtB,
             sup_filtC           => sup_filtC,
             sup_range           => sup_range,
-            sup_traffic_ctrs    => sup_traffic_ctrs
+            sup_filt_set        => sup_filt_set,
+            sup_traffic_ctrs    => sup_traffic_ctrs,
+            sup_tx_fifo         => sup_tx_fifo,
+            tx_fifo_depth       => tx_fifo_depth,
+            tx_arb_pipeline     => tx_arb_pipeline,
+            sup_int_ts          => sup_int_ts,
+            sup_tx_ts           => sup_tx_ts,
+            sup_ts_gen          => sup_ts_gen,
+            sup_txt_cyclic      => sup_txt_cyclic,
+            sup_tx_cpl          => sup_tx_cpl,
+            sup_rx_prio         => sup_rx_prio,
+            rx_prio_buffer_size => rx_prio_buffer_size
         )
         port map (
             clk_sys         => aclk,
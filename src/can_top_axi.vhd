@@ -0,0 +1,272 @@
+--------------------------------------------------------------------------------
+-- 
+-- CTU CAN FD IP Core 
+-- Copyright (C) 2021-present Ondrej Ille
+-- 
+-- Permission is hereby granted, free of charge, to any person obtaining a copy
+-- of this VHDL component and associated documentation files (the "Component"),
+-- to use, copy, modify, merge, publish, distribute the Component for
+-- educational, research, evaluation, self-interest purposes. Using the
+-- Component for commercial purposes is forbidden unless previously agreed with
+-- Copyright holder.
+-- 
+-- The above copyright notice and this permission notice shall be included in
+-- all copies or substantial portions of the Component.
+-- 
+-- THE COMPONENT IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+-- IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+-- FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+-- AUTHORS OR COPYRIGHTHOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+-- LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+-- FROM, OUT OF OR IN CONNECTION WITH THE COMPONENT OR THE USE OR OTHER DEALINGS
+-- IN THE COMPONENT.
+-- 
+-- The CAN protocol is developed by Robert Bosch GmbH and protected by patents.
+-- Anybody who wants to implement this IP core on silicon has to obtain a CAN
+-- protocol license from Bosch.
+-- 
+-- -------------------------------------------------------------------------------
+-- 
+-- CTU CAN FD IP Core 
+-- Copyright (C) 2015-2020 MIT License
+-- 
+-- Authors:
+--     Ondrej Ille <ondrej.ille@gmail.com>
+--     Martin Jerabek <martin.jerabek01@gmail.com>
+-- 
+-- Project advisors: 
+-- 	Jiri Novak <jnovak@fel.cvut.cz>
+-- 	Pavel Pisa <pisa@cmp.felk.cvut.cz>
+-- 
+-- Department of Measurement         (http://meas.fel.cvut.cz/)
+-- Faculty of Electrical Engineering (http://www.fel.cvut.cz)
+-- Czech Technical University        (http://www.cvut.cz/)
+-- 
+-- Permission is hereby granted, free of charge, to any person obtaining a copy
+-- of this VHDL component and associated documentation files (the "Component"),
+-- to deal in the Component without restriction, including without limitation
+-- the rights to use, copy, modify, merge, publish, distribute, sublicense,
+-- and/or sell copies of the Component, and to permit persons to whom the
+-- Component is furnished to do so, subject to the following conditions:
+-- 
+-- The above copyright notice and this permission notice shall be included in
+-- all copies or substantial portions of the Component.
+-- 
+-- THE COMPONENT IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+-- IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+-- FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+-- AUTHORS OR COPYRIGHTHOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+-- LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+-- FROM, OUT OF OR IN CONNECTION WITH THE COMPONENT OR THE USE OR OTHER DEALINGS
+-- IN THE COMPONENT.
+-- 
+-- The CAN protocol is developed by Robert Bosch GmbH and protected by patents.
+-- Anybody who wants to implement this IP core on silicon has to obtain a CAN
+-- protocol license from Bosch.
+-- 
+--------------------------------------------------------------------------------
+--------------------------------------------------------------------------------
+-- Purpose:
+--    Top-level entity using AXI4 (full) slave with 64-bit data path.
+--------------------------------------------------------------------------------
+
+Library ieee;
+use ieee.std_logic_1164.all;
+use ieee.numeric_std.ALL;
+use ieee.math_real.ALL;
+
+Library ctu_can_fd_rtl;
+use ctu_can_fd_rtl.id_transfer_pkg.all;
+use ctu_can_fd_rtl.can_constants_pkg.all;
+use ctu_can_fd_rtl.can_types_pkg.all;
+use ctu_can_fd_rtl.drv_stat_pkg.all;
+use ctu_can_fd_rtl.unary_ops_pkg.all;
+
+use ctu_can_fd_rtl.CAN_FD_register_map.all;
+use ctu_can_fd_rtl.CAN_FD_frame_format.all;
+
+entity can_top_axi is
+    generic(
+        rx_buffer_size      : natural range 32 to 4098 := 128;
+        txt_buffer_count    : natural range 2 to 8     := 4; 
+        sup_filtA           : boolean                  := true;
+        sup_filtB           : boolean                  := true;
+        sup_filtC           : boolean                  := true;
+        sup_range           : boolean                  := true;
+        sup_filt_set        : boolean                  := false;
+        sup_traffic_ctrs    : boolean                  := true;
+        sup_test_registers  : boolean                  := true;
+        sup_tx_fifo         : boolean                  := false;
+        tx_fifo_depth       : natural range 2 to 64    := 16;
+        tx_arb_pipeline     : boolean                  := false;
+        sup_int_ts          : boolean                  := false;
+        sup_tx_ts           : boolean                  := false;
+        sup_ts_gen          : boolean                  := false;
+        sup_txt_cyclic      : boolean                  := false;
+        sup_tx_cpl          : boolean                  := false;
+        sup_rx_prio         : boolean                  := false;
+        rx_prio_buffer_size : natural range 32 to 4096 := 32;
+        axi_id_width        : natural range 1 to 16    := 4
+    );
+    port(
+        aclk             : in  std_logic;
+        arstn            : in  std_logic;
+        scan_enable      : in  std_logic;
+        res_n_out        : out std_logic;
+
+        irq              : out std_logic;
+        CAN_tx           : out std_logic;
+        CAN_rx           : in  std_logic;
+        timestamp        : in std_logic_vector(63 downto 0);
+
+        -- Ports of AXI4
+        s_axi_awid       : in  std_logic_vector(axi_id_width - 1 downto 0);
+        s_axi_awaddr     : in  std_logic_vector(31 downto 0);
+        s_axi_awlen      : in  std_logic_vector(7 downto 0);
+        s_axi_awsize     : in  std_logic_vector(2 downto 0);
+        s_axi_awburst    : in  std_logic_vector(1 downto 0);
+        s_axi_awlock     : in  std_logic;
+        s_axi_awcache    : in  std_logic_vector(3 downto 0);
+        s_axi_awprot     : in  std_logic_vector(2 downto 0);
+        s_axi_awvalid    : in  std_logic;
+        s_axi_awready    : out std_logic;
+        s_axi_wdata      : in  std_logic_vector(63 downto 0);
+        s_axi_wstrb      : in  std_logic_vector(7 downto 0);
+        s_axi_wlast      : in  std_logic;
+        s_axi_wvalid     : in  std_logic;
+        s_axi_wready     : out std_logic;
+        s_axi_bid        : out std_logic_vector(axi_id_width - 1 downto 0);
+        s_axi_bresp      : out std_logic_vector(1 downto 0);
+        s_axi_bvalid     : out std_logic;
+        s_axi_bready     : in  std_logic;
+        s_axi_arid       : in  std_logic_vector(axi_id_width - 1 downto 0);
+        s_axi_araddr     : in  std_logic_vector(31 downto 0);
+        s_axi_arlen      : in  std_logic_vector(7 downto 0);
+        s_axi_arsize     : in  std_logic_vector(2 downto 0);
+        s_axi_arburst    : in  std_logic_vector(1 downto 0);
+        s_axi_arlock     : in  std_logic;
+        s_axi_arcache    : in  std_logic_vector(3 downto 0);
+        s_axi_arprot     : in  std_logic_vector(2 downto 0);
+        s_axi_arvalid    : in  std_logic;
+        s_axi_arready    : out std_logic;
+        s_axi_rid        : out std_logic_vector(axi_id_width - 1 downto 0);
+        s_axi_rdata      : out std_logic_vector(63 downto 0);
+        s_axi_rresp      : out std_logic_vector(1 downto 0);
+        s_axi_rlast      : out std_logic;
+        s_axi_rvalid     : out std_logic;
+        s_axi_rready     : in  std_logic
+  );
+end entity can_top_axi;
+
+architecture rtl of can_top_axi is
+ 
+    signal reg_data_in      : std_logic_vector(31 downto 0);
+    signal reg_data_out     : std_logic_vector(31 downto 0);
+    signal reg_addr         : std_logic_vector(15 downto 0);
+    signal reg_be           : std_logic_vector(3 downto 0);
+    signal reg_cs           : std_logic;
+    signal reg_rden         : std_logic;
+    signal reg_wren         : std_logic;
+    
+begin
+
+    can_inst: entity ctu_can_fd_rtl.can_top_level
+        generic map (
+            rx_buffer_size      => rx_buffer_size,
+            txt_buffer_count    => txt_buffer_count,
+            sup_filtA           => sup_filtA,
+            sup_filtB           => sup_filtB,
+            sup_filtC           => sup_filtC,
+            sup_range           => sup_range,
+            sup_filt_set        => sup_filt_set,
+            sup_traffic_ctrs    => sup_traffic_ctrs,
+            sup_tx_fifo         => sup_tx_fifo,
+            tx_fifo_depth       => tx_fifo_depth,
+            tx_arb_pipeline     => tx_arb_pipeline,
+            sup_int_ts          => sup_int_ts,
+            sup_tx_ts           => sup_tx_ts,
+            sup_ts_gen          => sup_ts_gen,
+            sup_txt_cyclic      => sup_txt_cyclic,
+            sup_tx_cpl          => sup_tx_cpl,
+            sup_rx_prio         => sup_rx_prio,
+            rx_prio_buffer_size => rx_prio_buffer_size
+        )
+        port map (
+            clk_sys         => aclk,
+            res_n           => arstn,
+            res_n_out       => res_n_out,
+            scan_enable     => scan_enable,
+
+            data_in         => reg_data_in,
+            data_out        => reg_data_out,
+            adress          => reg_addr,
+            scs             => reg_cs,
+            srd             => reg_rden,
+            swr             => reg_wren,
+            sbe             => reg_be,
+
+            int             => irq,
+
+            CAN_tx          => CAN_tx,
+            CAN_rx          => CAN_rx,
+
+            timestamp       => timestamp
+        );
+
+    axi_inst : entity ctu_can_fd_rtl.axi_ifc
+        generic map (
+            AXI_ID_WIDTH    => axi_id_width
+        )
+        port map (
+            aclk            => aclk,
+
+            -- Not reset by soft reset, write to MODE register shall get its
+            -- write response.
+            arstn           => arstn,
+
+            reg_data_in_o   => reg_data_in,
+            reg_data_out_i  => reg_data_out,
+            reg_addr_o      => reg_addr,
+            reg_be_o        => reg_be,
+            reg_cs_o        => reg_cs,
+            reg_rden_o      => reg_rden,
+            reg_wren_o      => reg_wren,
+
+            s_axi_awid      => s_axi_awid,
+            s_axi_awaddr    => s_axi_awaddr,
+            s_axi_awlen     => s_axi_awlen,
+            s_axi_awsize    => s_axi_awsize,
+            s_axi_awburst   => s_axi_awburst,
+            s_axi_awlock    => s_axi_awlock,
+            s_axi_awcache   => s_axi_awcache,
+            s_axi_awprot    => s_axi_awprot,
+            s_axi_awvalid   => s_axi_awvalid,
+            s_axi_awready   => s_axi_awready,
+            s_axi_wdata     => s_axi_wdata,
+            s_axi_wstrb     => s_axi_wstrb,
+            s_axi_wlast     => s_axi_wlast,
+            s_axi_wvalid    => s_axi_wvalid,
+            s_axi_wready    => s_axi_wready,
+            s_axi_bid       => s_axi_bid,
+            s_axi_bresp     => s_axi_bresp,
+            s_axi_bvalid    => s_axi_bvalid,
+            s_axi_bready    => s_axi_bready,
+            s_axi_arid      => s_axi_arid,
+            s_axi_araddr    => s_axi_araddr,
+            s_axi_arlen     => s_axi_arlen,
+            s_axi_arsize    => s_axi_arsize,
+            s_axi_arburst   => s_axi_arburst,
+            s_axi_arlock    => s_axi_arlock,
+            s_axi_arcache   => s_axi_arcache,
+            s_axi_arprot    => s_axi_arprot,
+            s_axi_arvalid   => s_axi_arvalid,
+            s_axi_arready   => s_axi_arready,
+            s_axi_rid       => s_axi_rid,
+            s_axi_rdata     => s_axi_rdata,
+            s_axi_rresp     => s_axi_rresp,
+            s_axi_rlast     => s_axi_rlast,
+            s_axi_rvalid    => s_axi_rvalid,
+            s_axi_rready    => s_axi_rready
+        );
+        
+end architecture rtl;
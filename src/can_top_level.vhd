@@ -80,6 +80,7 @@
 --  7. TX Arbitrator
 --  8. Frame filters
 --  9. Reset synchroniser
+--  10. RX DMA
 --------------------------------------------------------------------------------
 
 Library ieee;
@@ -120,12 +121,49 @@ entity can_top_level is
         -- Synthesize Range Filter
         sup_range           : boolean                := false;
         
+        -- Synthesize ID set filter (Base ID bitmap, Extended ID hash table)
+        sup_filt_set        : boolean                := false;
+        
         -- Synthesize Test registers
         sup_test_registers  : boolean                := true;
         
         -- Insert Traffic counters
         sup_traffic_ctrs    : boolean                := false;
         
+        -- Synthesize RX DMA (bus master moving RX frames to system memory)
+        sup_rx_dma          : boolean                := false;
+        
+        -- Replace last TXT Buffer by TXT FIFO (in-order queue of frames)
+        sup_tx_fifo         : boolean                := false;
+        
+        -- Number of frames in TXT FIFO
+        tx_fifo_depth       : natural range 2 to 64  := 16;
+        
+        -- Pipeline TXT Buffer priority decoder (one cycle of selection latency)
+        tx_arb_pipeline     : boolean                := false;
+        
+        -- Latch timestamp when interrupt becomes pending (IRQ latency)
+        sup_int_ts          : boolean                := false;
+        
+        -- Capture timestamp at start of transmission from each TXT Buffer
+        sup_tx_ts           : boolean                := false;
+        
+        -- Internal timestamp generator with rate adjustment (replaces
+        -- "timestamp" input)
+        sup_ts_gen          : boolean                := false;
+        
+        -- Cyclic transmission from TXT Buffers (period and skip counter)
+        sup_txt_cyclic      : boolean                := false;
+
+        -- TX completion FIFO (record for each TXT Buffer reaching final state)
+        sup_tx_cpl          : boolean                := false;
+
+        -- Priority RX Buffer (frames routed to it by frame filters)
+        sup_rx_prio         : boolean                := false;
+
+        -- Priority RX Buffer RAM size (32 bit words)
+        rx_prio_buffer_size : natural range 32 to 4096 := 32;
+        
         -- Target technology (ASIC or FPGA)
         target_technology   : natural                := C_TECH_FPGA
     );
@@ -177,6 +215,24 @@ entity can_top_level is
         -- Interrupt output
         irq         : out std_logic;
 
+        -----------------------------------------------------------------------
+        -- RX DMA bus master interface (not used when sup_rx_dma = false)
+        -----------------------------------------------------------------------
+        -- Write address
+        dma_m_addr  : out std_logic_vector(31 downto 0);
+
+        -- Write data
+        dma_m_wdata : out std_logic_vector(31 downto 0);
+
+        -- Write request
+        dma_m_req   : out std_logic;
+
+        -- Write finished
+        dma_m_ack   : in  std_logic := '0';
+
+        -- Write finished with error
+        dma_m_err   : in  std_logic := '0';
+
         -----------------------------------------------------------------------
         -- CAN Bus Interface
         -----------------------------------------------------------------------
@@ -192,7 +248,8 @@ entity can_top_level is
         test_probe  : out t_ctu_can_fd_test_probe;
 
         -----------------------------------------------------------------------
-        -- Timestamp for time based transmission / reception
+        -- Timestamp for time based transmission / reception (not used when
+        -- sup_ts_gen = true)
         -----------------------------------------------------------------------
         timestamp    : in std_logic_vector(63 downto 0)
     );
@@ -261,6 +318,43 @@ architecture rtl of can_top_level is
     -- RX buffer middle of frame
     signal rx_mof               :    std_logic;
 
+    -- Number of frames discarded to make room for received frames
+    signal rx_drop_ctr          :    std_logic_vector(31 downto 0);
+
+    -- FRAME_FORMAT_W and IDENTIFIER_W of the oldest frame in RX buffer
+    signal rx_peek_ffw          :    std_logic_vector(31 downto 0);
+    signal rx_peek_idw          :    std_logic_vector(31 downto 0);
+
+    ----------------------------------------------------------------------------
+    -- Priority RX Buffer <-> Memory registers Interface
+    ----------------------------------------------------------------------------
+    signal rxp_buf_size         :    std_logic_vector(12 downto 0);
+    signal rxp_full             :    std_logic;
+    signal rxp_empty            :    std_logic;
+    signal rxp_frame_count      :    std_logic_vector(10 downto 0);
+    signal rxp_mem_free         :    std_logic_vector(12 downto 0);
+    signal rxp_data_overrun     :    std_logic;
+    signal rxp_read_buff        :    std_logic_vector(31 downto 0);
+    signal rxp_mof              :    std_logic;
+
+    ----------------------------------------------------------------------------
+    -- RX DMA <-> RX Buffer, Memory registers, Interrupt manager Interface
+    ----------------------------------------------------------------------------
+    -- Read word from RX Buffer by RX DMA
+    signal dma_read_start       :    std_logic;
+
+    -- RX DMA Producer index
+    signal rx_dma_prod          :    std_logic_vector(11 downto 0);
+
+    -- RX DMA is moving frame
+    signal rx_dma_act           :    std_logic;
+
+    -- RX DMA stopped due to bus error
+    signal rx_dma_berr          :    std_logic;
+
+    -- RX DMA batch interrupt
+    signal rx_dma_int           :    std_logic;
+
     ----------------------------------------------------------------------------
     -- TXT Buffer <-> Memory registers Interface
     ----------------------------------------------------------------------------
@@ -280,6 +374,20 @@ architecture rtl of can_top_level is
     -- TXT Buffer status
     signal txtb_state           :    t_txt_bufs_state(txt_buffer_count - 1 downto 0);
 
+    -- TXT Buffer skipped slots of cyclic transmission
+    signal txtb_cyc_skip        :    t_txt_bufs_cyc_skip(txt_buffer_count - 1 downto 0);
+
+    -- TX completion FIFO - oldest record
+    signal tx_cpl_index         :    std_logic_vector(2 downto 0);
+    signal tx_cpl_state         :    std_logic_vector(3 downto 0);
+    signal tx_cpl_retr_ctr      :    std_logic_vector(C_RETR_LIM_CTR_WIDTH - 1 downto 0);
+    signal tx_cpl_ts            :    std_logic_vector(31 downto 0);
+
+    -- TX completion FIFO - number of records, overflow, not empty
+    signal tx_cpl_count         :    std_logic_vector(4 downto 0);
+    signal tx_cpl_overflow      :    std_logic;
+    signal tx_cpl_valid         :    std_logic;
+
     -- SW Commands to TXT Buffer
     signal txtb_sw_cmd          :    t_txtb_sw_cmd;
     
@@ -291,6 +399,18 @@ architecture rtl of can_top_level is
     
     -- TXT Buffer bus-off behavior
     signal txt_buf_failed_bof   :    std_logic;
+
+    ----------------------------------------------------------------------------
+    -- TXT FIFO <-> Memory registers, Interrupt manager Interface
+    ----------------------------------------------------------------------------
+    -- Number of frames in TXT FIFO
+    signal tx_fifo_fill         :    std_logic_vector(6 downto 0);
+
+    -- TXT FIFO is full
+    signal tx_fifo_full         :    std_logic;
+
+    -- Number of frames in TXT FIFO dropped to threshold
+    signal tx_fifo_int          :    std_logic;
     
     ------------------------------------------------------------------------
     -- Interrupt Manager <-> Memory registers Interface
@@ -304,6 +424,30 @@ architecture rtl of can_top_level is
     -- Interrupt mask
     signal int_mask             :    std_logic_vector(C_INT_COUNT - 1 downto 0);
     
+    -- Pending timestamp of selected interrupt
+    signal int_ts               :    std_logic_vector(31 downto 0);
+    
+    -- Transmission start timestamp of selected TXT Buffer
+    signal txtb_ts              :    std_logic_vector(63 downto 0);
+    
+    ------------------------------------------------------------------------
+    -- Timestamp generator <-> Memory registers Interface
+    ------------------------------------------------------------------------
+    -- Increment per clock cycle
+    signal ts_inc               :    std_logic_vector(31 downto 0);
+    
+    -- Step / set value
+    signal ts_step              :    std_logic_vector(63 downto 0);
+    
+    -- Step command
+    signal ts_step_cmd          :    std_logic;
+    
+    -- Set command
+    signal ts_set_cmd           :    std_logic;
+    
+    -- Timestamp used within CTU CAN FD (input or internal generator)
+    signal timestamp_i          :    std_logic_vector(63 downto 0);
+    
     ------------------------------------------------------------------------
     -- RX Buffer <-> CAN Core Interface
     ------------------------------------------------------------------------
@@ -359,6 +503,12 @@ architecture rtl of can_top_level is
     signal store_data_f         :    std_logic;
     signal rec_valid_f          :    std_logic;
     signal rec_abort_f          :    std_logic;
+
+    -- Filtered RX Buffer commands routed to Priority RX Buffer
+    signal store_metadata_p     :    std_logic;
+    signal store_data_p         :    std_logic;
+    signal rec_valid_p          :    std_logic;
+    signal rec_abort_p          :    std_logic;
     
     ------------------------------------------------------------------------
     -- TXT Buffers <-> Interrrupt Manager Interface
@@ -569,8 +719,20 @@ begin
         G_SUP_FILTB             => sup_filtB,
         G_SUP_FILTC             => sup_filtC,
         G_SUP_RANGE             => sup_range,
+        G_SUP_FILT_SET          => sup_filt_set,
+        G_FILT_SET_HASH_WIDTH   => C_FILT_SET_HASH_WIDTH,
+        G_FILT_SET_PROBE_LEN    => C_FILT_SET_PROBE_LEN,
         G_SUP_TEST_REGISTERS    => sup_test_registers,
         G_SUP_TRAFFIC_CTRS      => sup_traffic_ctrs,
+        G_SUP_RX_DMA            => sup_rx_dma,
+        G_SUP_TX_FIFO           => sup_tx_fifo,
+        G_TX_FIFO_DEPTH         => tx_fifo_depth,
+        G_SUP_INT_TS            => sup_int_ts,
+        G_SUP_TX_TS             => sup_tx_ts,
+        G_SUP_TS_GEN            => sup_ts_gen,
+        G_SUP_TXT_CYC           => sup_txt_cyclic,
+        G_SUP_TX_CPL            => sup_tx_cpl,
+        G_SUP_RX_PRIO           => sup_rx_prio,
         G_TXT_BUFFER_COUNT      => txt_buffer_count, 
         G_INT_COUNT             => C_INT_COUNT,
         G_TRV_CTR_WIDTH         => C_TRV_CTR_WIDTH,
@@ -598,7 +760,7 @@ begin
         srd                     => srd,                     -- IN
         swr                     => swr,                     -- IN
         sbe                     => sbe,                     -- IN
-        timestamp               => timestamp,               -- IN
+        timestamp               => timestamp_i,             -- IN
         
         -- Buses to/from rest of CTU CAN FD
         drv_bus                 => drv_bus,                 -- OUT
@@ -620,6 +782,28 @@ begin
         rx_write_pointer        => rx_write_pointer,        -- IN
         rx_data_overrun         => rx_data_overrun,         -- IN
         rx_mof                  => rx_mof,                  -- IN
+        rx_drop_ctr             => rx_drop_ctr,             -- IN
+        rx_peek_ffw             => rx_peek_ffw,             -- IN
+        rx_peek_idw             => rx_peek_idw,             -- IN
+
+        -- Priority RX Buffer Interface
+        rxp_read_buff           => rxp_read_buff,           -- IN
+        rxp_buf_size            => rxp_buf_size,            -- IN
+        rxp_full                => rxp_full,                -- IN
+        rxp_empty               => rxp_empty,               -- IN
+        rxp_frame_count         => rxp_frame_count,         -- IN
+        rxp_mem_free            => rxp_mem_free,            -- IN
+        rxp_data_overrun        => rxp_data_overrun,        -- IN
+        rxp_mof                 => rxp_mof,                 -- IN
+
+        -- RX DMA Interface
+        rx_dma_prod             => rx_dma_prod,             -- IN
+        rx_dma_act              => rx_dma_act,              -- IN
+        rx_dma_berr             => rx_dma_berr,             -- IN
+
+        -- TXT FIFO Interface
+        tx_fifo_fill            => tx_fifo_fill,            -- IN
+        tx_fifo_full            => tx_fifo_full,            -- IN
 
         -- Interface to TXT Buffers
         txtb_port_a_data        => txtb_port_a_data,        -- OUT
@@ -627,6 +811,14 @@ begin
         txtb_port_a_cs          => txtb_port_a_cs,          -- OUT
         txtb_port_a_be          => txtb_port_a_be,          -- OUT
         txtb_state              => txtb_state,              -- IN
+        txtb_cyc_skip           => txtb_cyc_skip,           -- IN
+        tx_cpl_index            => tx_cpl_index,            -- IN
+        tx_cpl_state            => tx_cpl_state,            -- IN
+        tx_cpl_retr_ctr         => tx_cpl_retr_ctr,         -- IN
+        tx_cpl_ts               => tx_cpl_ts,               -- IN
+        tx_cpl_count            => tx_cpl_count,            -- IN
+        tx_cpl_overflow         => tx_cpl_overflow,         -- IN
+        tx_cpl_valid            => tx_cpl_valid,            -- IN
         txtb_sw_cmd             => txtb_sw_cmd,             -- OUT
         txtb_sw_cmd_index       => txtb_sw_cmd_index,       -- OUT
         txtb_prorities          => txtb_prorities,          -- OUT
@@ -638,9 +830,41 @@ begin
         -- Interrrupt Interface
         int_vector              => int_vector,              -- IN
         int_ena                 => int_ena,                 -- IN
-        int_mask                => int_mask                 -- IN
+        int_mask                => int_mask,                -- IN
+        int_ts                  => int_ts,                  -- IN
+
+        -- TX Arbitrator Interface
+        txtb_ts                 => txtb_ts,                 -- IN
+
+        -- Timestamp generator Interface
+        ts_inc                  => ts_inc,                  -- OUT
+        ts_step                 => ts_step,                 -- OUT
+        ts_step_cmd             => ts_step_cmd,             -- OUT
+        ts_set_cmd              => ts_set_cmd               -- OUT
     );
 
+    ---------------------------------------------------------------------------
+    -- Timestamp generator
+    ---------------------------------------------------------------------------
+    ts_gen_inst_gen : if (sup_ts_gen) generate
+        timestamp_gen_inst : entity ctu_can_fd_rtl.timestamp_gen
+        port map(
+            clk_sys             => clk_sys,                 -- IN
+            res_n               => res_soft_n,              -- IN
+
+            ts_inc              => ts_inc,                  -- IN
+            ts_step             => ts_step,                 -- IN
+            ts_step_cmd         => ts_step_cmd,             -- IN
+            ts_set_cmd          => ts_set_cmd,              -- IN
+
+            timestamp           => timestamp_i              -- OUT
+        );
+    end generate ts_gen_inst_gen;
+
+    ts_gen_not_gen : if (not sup_ts_gen) generate
+        timestamp_i <= timestamp;
+    end generate ts_gen_not_gen;
+
     ---------------------------------------------------------------------------
     -- RX Buffer
     ---------------------------------------------------------------------------
@@ -684,72 +908,324 @@ begin
         rx_write_pointer        => rx_write_pointer,        -- OUT
         rx_data_overrun         => rx_data_overrun,         -- OUT
         rx_mof                  => rx_mof,                  -- OUT
+        rx_drop_ctr             => rx_drop_ctr,             -- OUT
+        rx_peek_ffw             => rx_peek_ffw,             -- OUT
+        rx_peek_idw             => rx_peek_idw,             -- OUT
         
-        -- External timestamp input
-        timestamp               => timestamp,               -- IN
+        -- Timestamp
+        timestamp               => timestamp_i,             -- IN
 
         -- Memory registers interface
         rx_read_buff            => rx_read_buff,            -- IN
         drv_bus                 => drv_bus,                 -- IN
+        dma_read_start          => dma_read_start,          -- IN
         test_registers_out      => test_registers_out,      -- IN        
         tst_rdata_rx_buf        => tst_rdata_rx_buf         -- OUT
     );
 
     ---------------------------------------------------------------------------
-    -- TXT Buffers
+    -- Priority RX Buffer. Second instance of RX Buffer which stores frames
+    -- routed by frame filters. It shares RX Buffer configuration (timestamp
+    -- options, overflow policy) but has own read, erase and clear overrun
+    -- commands. It is not accessible via test registers, and RX DMA reads
+    -- only RX Buffer.
     ---------------------------------------------------------------------------
-    txt_buf_comp_gen : for i in 0 to txt_buffer_count - 1 generate
+    rx_prio_gen : if (sup_rx_prio) generate
+        constant C_TST_REGS_OFF : test_registers_out_t :=
+            (OTHERS => (OTHERS => '0'));
+        signal drv_bus_rxp      : std_logic_vector(1023 downto 0);
     begin
-        txt_buffer_inst : entity ctu_can_fd_rtl.txt_buffer
+
+        drv_bus_rxp_proc : process(drv_bus)
+        begin
+            drv_bus_rxp <= drv_bus;
+            drv_bus_rxp(DRV_READ_START_INDEX) <= drv_bus(DRV_RXP_READ_START_INDEX);
+            drv_bus_rxp(DRV_ERASE_RX_INDEX) <= drv_bus(DRV_RXP_ERASE_INDEX);
+            drv_bus_rxp(DRV_CLR_OVR_INDEX) <= drv_bus(DRV_RXP_CLR_OVR_INDEX);
+            drv_bus_rxp(DRV_RX_SKIP_INDEX) <= '0';
+            drv_bus_rxp(DRV_CLR_RX_DROP_CTR_INDEX) <= '0';
+        end process;
+
+        rx_prio_buffer_inst : entity ctu_can_fd_rtl.rx_buffer
         generic map(
-            G_TXT_BUFFER_COUNT  => txt_buffer_count,
-            G_ID                => i,
-            G_TECHNOLOGY        => target_technology
+            G_RX_BUFF_SIZE          => rx_prio_buffer_size,
+            G_TECHNOLOGY            => target_technology
         )
         port map(
-            clk_sys             => clk_sys,                         -- IN
-            res_n               => res_core_n,                      -- IN
+            clk_sys                 => clk_sys,                 -- IN
+            res_n                   => res_core_n,              -- IN
 
             -- DFT support
-            scan_enable         => scan_enable,                     -- IN
-
-
-            -- Memory Registers Interface
-            txtb_port_a_data    => txtb_port_a_data,                -- IN
-            txtb_port_a_address => txtb_port_a_address,             -- IN
-            txtb_port_a_cs      => txtb_port_a_cs(i),               -- IN
-            txtb_port_a_be      => txtb_port_a_be,                  -- IN
-            txtb_sw_cmd         => txtb_sw_cmd,                     -- IN
-            txtb_sw_cmd_index   => txtb_sw_cmd_index,               -- IN
-            txtb_state          => txtb_state(i),                   -- OUT
-            txt_buf_failed_bof  => txt_buf_failed_bof,              -- IN
-            drv_rom_ena         => drv_bus(DRV_ROM_ENA_INDEX),      -- IN
-            drv_bus_mon_ena     => drv_bus(DRV_BUS_MON_ENA_INDEX),  -- IN
-    
-            -- Memory testability
-            test_registers_out  => test_registers_out,              -- IN
-            tst_rdata_txt_buf   => tst_rdata_txt_bufs(i),           -- OUT
-    
-            -- Interrupt Manager Interface
-            txtb_hw_cmd_int     => txtb_hw_cmd_int(i),              -- OUT
-    
-            -- CAN Core and TX Arbitrator Interface
-            txtb_hw_cmd         => txtb_hw_cmd,                     -- IN
-            txtb_hw_cmd_index   => txtb_hw_cmd_index,               -- IN
-            txtb_port_b_data    => txtb_port_b_data(i),             -- OUT
-            txtb_port_b_address => txtb_port_b_address,             -- IN
-            txtb_port_b_clk_en  => txtb_port_b_clk_en,              -- IN
-            is_bus_off          => is_bus_off,                      -- IN
-            txtb_available      => txtb_available(i)                -- OUT
+            scan_enable             => scan_enable,             -- IN
+
+            -- Metadata from CAN Core
+            rec_ident               => rec_ident,               -- IN
+            rec_dlc                 => rec_dlc,                 -- IN
+            rec_ident_type          => rec_ident_type,          -- IN
+            rec_frame_type          => rec_frame_type,          -- IN
+            rec_is_rtr              => rec_is_rtr,              -- IN
+            rec_brs                 => rec_brs,                 -- IN
+            rec_esi                 => rec_esi,                 -- IN
+
+            -- Control signals from CAN Core, routed by Frame filters
+            store_metadata_f        => store_metadata_p,        -- IN
+            store_data_f            => store_data_p,            -- IN
+            store_data_word         => store_data_word,         -- IN
+            rec_valid_f             => rec_valid_p,             -- IN
+            rec_abort_f             => rec_abort_p,             -- IN
+            sof_pulse               => sof_pulse,               -- IN
+
+            -- Status signals of Priority RX Buffer
+            rx_buf_size             => rxp_buf_size,            -- OUT
+            rx_full                 => rxp_full,                -- OUT
+            rx_empty                => rxp_empty,               -- OUT
+            rx_frame_count          => rxp_frame_count,         -- OUT
+            rx_mem_free             => rxp_mem_free,            -- OUT
+            rx_read_pointer         => open,                    -- OUT
+            rx_write_pointer        => open,                    -- OUT
+            rx_data_overrun         => rxp_data_overrun,        -- OUT
+            rx_mof                  => rxp_mof,                 -- OUT
+            rx_drop_ctr             => open,                    -- OUT
+            rx_peek_ffw             => open,                    -- OUT
+            rx_peek_idw             => open,                    -- OUT
+
+            -- Timestamp
+            timestamp               => timestamp_i,             -- IN
+
+            -- Memory registers interface
+            rx_read_buff            => rxp_read_buff,           -- OUT
+            drv_bus                 => drv_bus_rxp,             -- IN
+            dma_read_start          => '0',                     -- IN
+            test_registers_out      => C_TST_REGS_OFF,          -- IN
+            tst_rdata_rx_buf        => open                     -- OUT
         );
+    end generate rx_prio_gen;
+
+    rx_prio_not_gen : if (not sup_rx_prio) generate
+        rxp_buf_size     <= (OTHERS => '0');
+        rxp_full         <= '0';
+        rxp_empty        <= '1';
+        rxp_frame_count  <= (OTHERS => '0');
+        rxp_mem_free     <= (OTHERS => '0');
+        rxp_data_overrun <= '0';
+        rxp_read_buff    <= (OTHERS => '0');
+        rxp_mof          <= '0';
+    end generate rx_prio_not_gen;
+
+    ---------------------------------------------------------------------------
+    -- RX DMA
+    ---------------------------------------------------------------------------
+    rx_dma_gen : if (sup_rx_dma) generate
+        rx_dma_inst : entity ctu_can_fd_rtl.rx_dma
+        port map(
+            clk_sys             => clk_sys,                 -- IN
+            res_n               => res_core_n,              -- IN
+
+            -- Memory registers interface
+            drv_bus             => drv_bus,                 -- IN
+            rx_dma_prod         => rx_dma_prod,             -- OUT
+            rx_dma_act          => rx_dma_act,              -- OUT
+            rx_dma_berr         => rx_dma_berr,             -- OUT
+
+            -- RX Buffer interface
+            rx_read_buff        => rx_read_buff,            -- IN
+            rx_empty            => rx_empty,                -- IN
+            dma_read_start      => dma_read_start,          -- OUT
+
+            -- Bus master interface
+            dma_m_addr          => dma_m_addr,              -- OUT
+            dma_m_wdata         => dma_m_wdata,             -- OUT
+            dma_m_req           => dma_m_req,               -- OUT
+            dma_m_ack           => dma_m_ack,               -- IN
+            dma_m_err           => dma_m_err,               -- IN
+
+            -- Interrupt manager interface
+            rx_dma_int          => rx_dma_int               -- OUT
+        );
+    end generate rx_dma_gen;
+
+    rx_dma_not_gen : if (not sup_rx_dma) generate
+        dma_read_start  <= '0';
+        rx_dma_prod     <= (OTHERS => '0');
+        rx_dma_act      <= '0';
+        rx_dma_berr     <= '0';
+        rx_dma_int      <= '0';
+        dma_m_addr      <= (OTHERS => '0');
+        dma_m_wdata     <= (OTHERS => '0');
+        dma_m_req       <= '0';
+    end generate rx_dma_not_gen;
+
+    ---------------------------------------------------------------------------
+    -- TXT Buffers. When TXT FIFO is supported, it takes place of the last
+    -- TXT Buffer.
+    ---------------------------------------------------------------------------
+    txt_buf_comp_gen : for i in 0 to txt_buffer_count - 1 generate
+    begin
+        txt_buf_gen : if ((not sup_tx_fifo) or (i < txt_buffer_count - 1)) generate
+            txt_buffer_inst : entity ctu_can_fd_rtl.txt_buffer
+            generic map(
+                G_TXT_BUFFER_COUNT  => txt_buffer_count,
+                G_ID                => i,
+                G_SUP_CYCLIC        => sup_txt_cyclic,
+                G_TECHNOLOGY        => target_technology
+            )
+            port map(
+                clk_sys             => clk_sys,                         -- IN
+                res_n               => res_core_n,                      -- IN
+
+                -- DFT support
+                scan_enable         => scan_enable,                     -- IN
+
+
+                -- Memory Registers Interface
+                txtb_port_a_data    => txtb_port_a_data,                -- IN
+                txtb_port_a_address => txtb_port_a_address,             -- IN
+                txtb_port_a_cs      => txtb_port_a_cs(i),               -- IN
+                txtb_port_a_be      => txtb_port_a_be,                  -- IN
+                txtb_sw_cmd         => txtb_sw_cmd,                     -- IN
+                txtb_sw_cmd_index   => txtb_sw_cmd_index,               -- IN
+                txtb_state          => txtb_state(i),                   -- OUT
+                txt_buf_failed_bof  => txt_buf_failed_bof,              -- IN
+                drv_rom_ena         => drv_bus(DRV_ROM_ENA_INDEX),      -- IN
+                drv_bus_mon_ena     => drv_bus(DRV_BUS_MON_ENA_INDEX),  -- IN
+                txt_cyc_period      => drv_bus(DRV_TXT_CYC_PERIOD_HIGH downto
+                                               DRV_TXT_CYC_PERIOD_LOW), -- IN
+                txt_cyc_wr          => drv_bus(DRV_TXT_CYC_WR_INDEX),   -- IN
+                txt_cyc_sel         => drv_bus(DRV_TXT_CYC_SEL_HIGH downto
+                                               DRV_TXT_CYC_SEL_LOW),    -- IN
+                txtb_cyc_skip       => txtb_cyc_skip(i),                -- OUT
+                timestamp           => timestamp_i,                     -- IN
+    
+                -- Memory testability
+                test_registers_out  => test_registers_out,              -- IN
+                tst_rdata_txt_buf   => tst_rdata_txt_bufs(i),           -- OUT
+    
+                -- Interrupt Manager Interface
+                txtb_hw_cmd_int     => txtb_hw_cmd_int(i),              -- OUT
+    
+                -- CAN Core and TX Arbitrator Interface
+                txtb_hw_cmd         => txtb_hw_cmd,                     -- IN
+                txtb_hw_cmd_index   => txtb_hw_cmd_index,               -- IN
+                txtb_port_b_data    => txtb_port_b_data(i),             -- OUT
+                txtb_port_b_address => txtb_port_b_address,             -- IN
+                txtb_port_b_clk_en  => txtb_port_b_clk_en,              -- IN
+                is_bus_off          => is_bus_off,                      -- IN
+                txtb_available      => txtb_available(i)                -- OUT
+            );
+        end generate txt_buf_gen;
+
+        txt_fifo_gen : if (sup_tx_fifo and (i = txt_buffer_count - 1)) generate
+            txt_fifo_inst : entity ctu_can_fd_rtl.txt_fifo
+            generic map(
+                G_TXT_BUFFER_COUNT  => txt_buffer_count,
+                G_ID                => i,
+                G_DEPTH             => tx_fifo_depth,
+                G_TECHNOLOGY        => target_technology
+            )
+            port map(
+                clk_sys             => clk_sys,                         -- IN
+                res_n               => res_core_n,                      -- IN
+
+                -- DFT support
+                scan_enable         => scan_enable,                     -- IN
+
+                -- Memory Registers Interface
+                txtb_port_a_data    => txtb_port_a_data,                -- IN
+                txtb_port_a_address => txtb_port_a_address,             -- IN
+                txtb_port_a_cs      => txtb_port_a_cs(i),               -- IN
+                txtb_port_a_be      => txtb_port_a_be,                  -- IN
+                txtb_sw_cmd         => txtb_sw_cmd,                     -- IN
+                txtb_sw_cmd_index   => txtb_sw_cmd_index,               -- IN
+                txtb_state          => txtb_state(i),                   -- OUT
+                txt_buf_failed_bof  => txt_buf_failed_bof,              -- IN
+                drv_rom_ena         => drv_bus(DRV_ROM_ENA_INDEX),      -- IN
+                drv_bus_mon_ena     => drv_bus(DRV_BUS_MON_ENA_INDEX),  -- IN
+                tx_fifo_th          => drv_bus(DRV_TX_FIFO_TH_HIGH downto
+                                               DRV_TX_FIFO_TH_LOW),     -- IN
+                tx_fifo_fill        => tx_fifo_fill,                    -- OUT
+                tx_fifo_full        => tx_fifo_full,                    -- OUT
+
+                -- Memory testability
+                test_registers_out  => test_registers_out,              -- IN
+                tst_rdata_txt_buf   => tst_rdata_txt_bufs(i),           -- OUT
+
+                -- Interrupt Manager Interface
+                txtb_hw_cmd_int     => txtb_hw_cmd_int(i),              -- OUT
+                tx_fifo_int         => tx_fifo_int,                     -- OUT
+
+                -- CAN Core and TX Arbitrator Interface
+                txtb_hw_cmd         => txtb_hw_cmd,                     -- IN
+                txtb_hw_cmd_index   => txtb_hw_cmd_index,               -- IN
+                txtb_port_b_data    => txtb_port_b_data(i),             -- OUT
+                txtb_port_b_address => txtb_port_b_address,             -- IN
+                txtb_port_b_clk_en  => txtb_port_b_clk_en,              -- IN
+                is_bus_off          => is_bus_off,                      -- IN
+                txtb_available      => txtb_available(i)                -- OUT
+            );
+
+            -- TXT FIFO does not transmit cyclically
+            txtb_cyc_skip(i) <= (OTHERS => '0');
+        end generate txt_fifo_gen;
     end generate;
 
+    tx_fifo_not_gen : if (not sup_tx_fifo) generate
+        tx_fifo_fill    <= (OTHERS => '0');
+        tx_fifo_full    <= '0';
+        tx_fifo_int     <= '0';
+    end generate tx_fifo_not_gen;
+
+    ---------------------------------------------------------------------------
+    -- TX completion FIFO
+    ---------------------------------------------------------------------------
+    tx_cpl_gen : if (sup_tx_cpl) generate
+        txt_cpl_fifo_inst : entity ctu_can_fd_rtl.txt_cpl_fifo
+        generic map(
+            G_TXT_BUFFER_COUNT      => txt_buffer_count,
+            G_DEPTH                 => C_TX_CPL_DEPTH,
+            G_RETR_LIM_CTR_WIDTH    => C_RETR_LIM_CTR_WIDTH
+        )
+        port map(
+            clk_sys                 => clk_sys,                 -- IN
+            res_n                   => res_core_n,              -- IN
+
+            -- TXT Buffers interface
+            txtb_state              => txtb_state,              -- IN
+
+            -- CAN Core interface
+            retr_ctr                => stat_bus(STAT_RETR_CTR_HIGH downto
+                                                STAT_RETR_CTR_LOW), -- IN
+            timestamp               => timestamp_i,             -- IN
+
+            -- Memory registers interface
+            tx_cpl_pop              => drv_bus(DRV_TX_CPL_POP_INDEX), -- IN
+            tx_cpl_index            => tx_cpl_index,            -- OUT
+            tx_cpl_state            => tx_cpl_state,            -- OUT
+            tx_cpl_retr_ctr         => tx_cpl_retr_ctr,         -- OUT
+            tx_cpl_ts               => tx_cpl_ts,               -- OUT
+            tx_cpl_count            => tx_cpl_count,            -- OUT
+            tx_cpl_overflow         => tx_cpl_overflow,         -- OUT
+            tx_cpl_valid            => tx_cpl_valid             -- OUT
+        );
+    end generate tx_cpl_gen;
+
+    tx_cpl_not_gen : if (not sup_tx_cpl) generate
+        tx_cpl_index    <= (OTHERS => '0');
+        tx_cpl_state    <= (OTHERS => '0');
+        tx_cpl_retr_ctr <= (OTHERS => '0');
+        tx_cpl_ts       <= (OTHERS => '0');
+        tx_cpl_count    <= (OTHERS => '0');
+        tx_cpl_overflow <= '0';
+        tx_cpl_valid    <= '0';
+    end generate tx_cpl_not_gen;
+
     ---------------------------------------------------------------------------
     -- TX Arbitrator
     ---------------------------------------------------------------------------
     tx_arbitrator_inst : entity ctu_can_fd_rtl.tx_arbitrator
     generic map(
-        G_TXT_BUFFER_COUNT      => txt_buffer_count
+        G_TXT_BUFFER_COUNT      => txt_buffer_count,
+        G_PRIO_DEC_PIPELINE     => tx_arb_pipeline,
+        G_SUP_TX_TS             => sup_tx_ts
     )
     port map( 
         clk_sys                 => clk_sys,                 -- IN
@@ -779,7 +1255,8 @@ begin
         -- Memory registers interface
         txtb_prorities          => txtb_prorities,          -- IN
         drv_bus                 => drv_bus,                 -- IN
-        timestamp               => timestamp                -- IN
+        timestamp               => timestamp_i,             -- IN
+        txtb_ts                 => txtb_ts                  -- OUT
     );
 
     ---------------------------------------------------------------------------
@@ -790,7 +1267,11 @@ begin
         G_SUP_FILTA             => sup_filtA,
         G_SUP_FILTB             => sup_filtB,
         G_SUP_FILTC             => sup_filtC,
-        G_SUP_RANGE             => sup_range
+        G_SUP_RANGE             => sup_range,
+        G_SUP_FILT_SET          => sup_filt_set,
+        G_FILT_SET_HASH_WIDTH   => C_FILT_SET_HASH_WIDTH,
+        G_FILT_SET_PROBE_LEN    => C_FILT_SET_PROBE_LEN,
+        G_SUP_RX_PRIO           => sup_rx_prio
     )
     port map(
         clk_sys                 => clk_sys,                 -- IN
@@ -814,7 +1295,13 @@ begin
         store_metadata_f        => store_metadata_f,        -- OUT
         store_data_f            => store_data_f,            -- OUT
         rec_valid_f             => rec_valid_f,             -- OUT
-        rec_abort_f             => rec_abort_f              -- OUT
+        rec_abort_f             => rec_abort_f,             -- OUT
+
+        -- Frame filters output - Priority RX Buffer
+        store_metadata_p        => store_metadata_p,        -- OUT
+        store_data_p            => store_data_p,            -- OUT
+        rec_valid_p             => rec_valid_p,             -- OUT
+        rec_abort_p             => rec_abort_p              -- OUT
     );
 
     ---------------------------------------------------------------------------
@@ -823,7 +1310,8 @@ begin
     int_manager_inst : entity ctu_can_fd_rtl.int_manager
     generic map(
         G_INT_COUNT             => C_INT_COUNT,
-        G_TXT_BUFFER_COUNT      => txt_buffer_count
+        G_TXT_BUFFER_COUNT      => txt_buffer_count,
+        G_SUP_INT_TS            => sup_int_ts
     )
     port map(
         clk_sys                 => clk_sys,                 -- IN
@@ -848,13 +1336,21 @@ begin
         rx_empty                => rx_empty,                -- IN
         txtb_hw_cmd_int         => txtb_hw_cmd_int,         -- IN
         is_overload             => is_overload,             -- IN
+        rx_dma_int              => rx_dma_int,              -- IN
+        tx_fifo_int             => tx_fifo_int,             -- IN
+        rec_valid_p             => rec_valid_p,             -- IN
+        rxp_empty               => rxp_empty,               -- IN
+
+        -- Timestamp
+        timestamp               => timestamp_i,             -- IN
 
         -- Memory registers Interface
         drv_bus                 => drv_bus,                 -- IN
         int                     => irq,                     -- OUT
         int_vector              => int_vector,              -- OUT
         int_mask                => int_mask,                -- OUT
-        int_ena                 => int_ena                  -- OUT
+        int_ena                 => int_ena,                 -- OUT
+        int_ts                  => int_ts                   -- OUT
     );
 
     ---------------------------------------------------------------------------
@@ -934,7 +1430,7 @@ begin
         tx_data_wbs             => tx_data_wbs,             -- OUT
 
         -- Others
-        timestamp               => timestamp,               -- IN
+        timestamp               => timestamp_i,             -- IN
         ssp_reset               => ssp_reset,               -- OUT
         tran_delay_meas         => tran_delay_meas,         -- OUT
         bit_err                 => bit_err,                 -- IN
@@ -76,11 +76,14 @@
 --  11 bit and 29 bit filters can be compared. If 13 bit filters are compared,
 --  then MSB 18 bits in Received Identifier has to be zeros. Also mask for the 
 --  filter in case of 16-bit filter HAS to have 16 uppest bits equal to zero!
---  Filters  A,B,C and Range are present. If input identifier matches at least one
---  it is considered as valid. Frame type (CAN Basic, CAN Extended, CAN FD Basic)
+--  Filters  A,B,C, Range and ID set filter are present. If input identifier
+--  matches at least one it is considered as valid. Frame type (CAN Basic, CAN Extended, CAN FD Basic)
 --  are also selectable for filtering. Filters can be optionally left out from
 --  synthesis or disabled in runtime. If filters are disabled, no frame is
 --  filtered out.
+--  Optionally, valid frame is routed to Priority RX Buffer when it matches at
+--  least one filter whose routing bit is set. Commands of such frame are
+--  given only to Priority RX Buffer, other frames go only to RX Buffer.
 --------------------------------------------------------------------------------
 
 Library ieee;
@@ -110,7 +113,19 @@ entity frame_filters is
         G_SUP_FILTC          : boolean := true;
         
         -- Support range filter
-        G_SUP_RANGE          : boolean := true
+        G_SUP_RANGE          : boolean := true;
+
+        -- Support ID set filter
+        G_SUP_FILT_SET       : boolean := true;
+
+        -- ID set filter - Hash table address width
+        G_FILT_SET_HASH_WIDTH : natural range 1 to 10 := 8;
+
+        -- ID set filter - Hash table probe length
+        G_FILT_SET_PROBE_LEN  : natural range 1 to 15 := 4;
+
+        -- Support routing to Priority RX Buffer
+        G_SUP_RX_PRIO        : boolean := false
     );
     port(
         ------------------------------------------------------------------------
@@ -171,7 +186,22 @@ entity frame_filters is
         rec_valid_f          : out   std_logic;
         
         -- Command to abort storing of RX frame (due to Error frame) - Filtered
-        rec_abort_f          : out   std_logic
+        rec_abort_f          : out   std_logic;
+
+        ------------------------------------------------------------------------
+        -- Frame filters output - routed to Priority RX Buffer
+        ------------------------------------------------------------------------
+        -- Store Metadata in Priority RX Buffer
+        store_metadata_p     : out   std_logic;
+
+        -- Command to store word of CAN Data to Priority RX Buffer
+        store_data_p         : out   std_logic;
+
+        -- Received frame valid - Priority RX Buffer
+        rec_valid_p          : out   std_logic;
+
+        -- Command to abort storing of RX frame - Priority RX Buffer
+        rec_abort_p          : out   std_logic
     );
 end entity;
   
@@ -230,6 +260,24 @@ architecture rtl of frame_filters is
     -- Output of range filter is valid
     signal int_filter_ran_valid     :       std_logic;
 
+    -- ID set filter control bits
+    signal drv_filter_set_ctrl      :       std_logic_vector(3 downto 0);
+
+    -- ID set filter memory write
+    signal drv_filter_set_wr        :       std_logic;
+
+    -- ID set filter memory table select
+    signal drv_filter_set_tsel      :       std_logic;
+
+    -- ID set filter memory address
+    signal drv_filter_set_addr      :       std_logic_vector(9 downto 0);
+
+    -- ID set filter memory data
+    signal drv_filter_set_data      :       std_logic_vector(31 downto 0);
+
+    -- Output of ID set filter is valid
+    signal int_filter_set_valid     :       std_logic;
+
 
     -- Enable the message filters
     signal drv_filters_ena          :       std_logic;
@@ -245,6 +293,7 @@ architecture rtl of frame_filters is
     signal filter_B_enable          :       std_logic;
     signal filter_C_enable          :       std_logic;
     signal filter_range_enable      :       std_logic; 
+    signal filter_set_enable        :       std_logic;
 
     signal filter_result            :       std_logic;
 
@@ -255,6 +304,17 @@ architecture rtl of frame_filters is
     signal drv_drop_remote_frames   :       std_logic;
  
     signal drop_rtr_frame           :       std_logic;
+
+    -- Routing bits (A, B, C, Range, ID set) to Priority RX Buffer
+    signal drv_rxp_route            :       std_logic_vector(4 downto 0);
+
+    -- Identifier is routed to Priority RX Buffer
+    signal ident_prio_d             :       std_logic;
+    signal ident_prio_q             :       std_logic;
+
+    -- Frame goes to RX Buffer / Priority RX Buffer
+    signal main_sel                 :       std_logic;
+    signal prio_sel                 :       std_logic;
     
 begin
 
@@ -285,8 +345,18 @@ begin
                                            DRV_FILTER_RAN_LO_TH_LOW);
     drv_filter_ran_hi_th        <= drv_bus(DRV_FILTER_RAN_HI_TH_HIGH downto
                                            DRV_FILTER_RAN_HI_TH_LOW);
+    drv_filter_set_ctrl         <= drv_bus(DRV_FILTER_SET_CTRL_HIGH downto
+                                           DRV_FILTER_SET_CTRL_LOW);
+    drv_filter_set_wr           <= drv_bus(DRV_FILTER_SET_WR_INDEX);
+    drv_filter_set_tsel         <= drv_bus(DRV_FILTER_SET_TSEL_INDEX);
+    drv_filter_set_addr         <= drv_bus(DRV_FILTER_SET_ADDR_HIGH downto
+                                           DRV_FILTER_SET_ADDR_LOW);
+    drv_filter_set_data         <= drv_bus(DRV_FILTER_SET_DATA_HIGH downto
+                                           DRV_FILTER_SET_DATA_LOW);
     drv_filters_ena             <= drv_bus(DRV_FILTERS_ENA_INDEX);
     drv_drop_remote_frames      <= drv_bus(DRV_FILTER_DROP_RF_INDEX);
+    drv_rxp_route               <= drv_bus(DRV_RXP_ROUTE_HIGH downto
+                                           DRV_RXP_ROUTE_LOW);
 
     ---------------------------------------------------------------------------
     -- Decoding Filter enables based on accepted frame types by each filter
@@ -317,6 +387,9 @@ begin
     filter_range_enable <= '1' when ((drv_filter_ran_ctrl and int_data_type) /= x"0")
                            else
                            '0';
+    filter_set_enable <= '1' when ((drv_filter_set_ctrl and int_data_type) /= x"0")
+                             else
+                         '0';
 
     ---------------------------------------------------------------------------
     -- Filter instances
@@ -378,6 +451,28 @@ begin
         valid           => int_filter_ran_valid     -- OUT
     );
 
+    id_set_filter_inst : entity ctu_can_fd_rtl.id_set_filter
+    generic map(
+        G_IS_PRESENT      => G_SUP_FILT_SET,
+        G_HASH_WIDTH      => G_FILT_SET_HASH_WIDTH,
+        G_PROBE_LEN       => G_FILT_SET_PROBE_LEN
+    )
+    port map(
+        clk_sys           => clk_sys,               -- IN
+        res_n             => res_n,                 -- IN
+
+        mem_write         => drv_filter_set_wr,     -- IN
+        mem_tsel          => drv_filter_set_tsel,   -- IN
+        mem_addr          => drv_filter_set_addr,   -- IN
+        mem_data          => drv_filter_set_data,   -- IN
+
+        filter_input      => rec_ident,             -- IN
+        filter_ident_type => rec_ident_type,        -- IN
+        enable            => filter_set_enable,     -- IN
+
+        valid             => int_filter_set_valid   -- OUT
+    );
+
  
     ---------------------------------------------------------------------------
     -- If no filter is supported then Identifier is always valid, regardless
@@ -385,15 +480,18 @@ begin
     -- should not affect the acceptance! Everyhting should be affected!
     ---------------------------------------------------------------------------
     filt_sup_gen_false : if (G_SUP_FILTA = false and G_SUP_FILTB = false and
-                             G_SUP_FILTC = false and G_SUP_RANGE = false) generate
+                             G_SUP_FILTC = false and G_SUP_RANGE = false and
+                             G_SUP_FILT_SET = false) generate
         ident_valid_d <= '1';
         filter_result <= '0';
         drop_rtr_frame <= '0';
+        ident_prio_d <= '0';
     end generate;
 
 
     filt_sup_gen_true : if (G_SUP_FILTA = true or G_SUP_FILTB = true or
-                            G_SUP_FILTC = true or G_SUP_RANGE = true) generate
+                            G_SUP_FILTC = true or G_SUP_RANGE = true or
+                            G_SUP_FILT_SET = true) generate
 
         drop_rtr_frame <= '1' when (drv_drop_remote_frames = DROP_RF_ENABLED
                                     and rec_is_rtr = RTR_FRAME)
@@ -404,13 +502,39 @@ begin
                          '1' when (int_filter_A_valid = '1' or
                                    int_filter_B_valid = '1' or
                                    int_filter_C_valid = '1' or
-                                   int_filter_ran_valid = '1')
+                                   int_filter_ran_valid = '1' or
+                                   int_filter_set_valid = '1')
                              else
                          '0';
 
         ident_valid_d <=  filter_result when (drv_filters_ena = '1')
                                         else
                                     '1';
+
+        -----------------------------------------------------------------------
+        -- Routing to Priority RX Buffer. Only frames accepted by filters can
+        -- be routed, so routing takes effect only when filters are enabled.
+        -----------------------------------------------------------------------
+        rx_prio_gen_true : if (G_SUP_RX_PRIO) generate
+            ident_prio_d <= '1' when (drv_filters_ena = '1' and
+                                      filter_result = '1' and
+                                      ((int_filter_A_valid = '1' and
+                                        drv_rxp_route(0) = '1') or
+                                       (int_filter_B_valid = '1' and
+                                        drv_rxp_route(1) = '1') or
+                                       (int_filter_C_valid = '1' and
+                                        drv_rxp_route(2) = '1') or
+                                       (int_filter_ran_valid = '1' and
+                                        drv_rxp_route(3) = '1') or
+                                       (int_filter_set_valid = '1' and
+                                        drv_rxp_route(4) = '1')))
+                                else
+                            '0';
+        end generate;
+
+        rx_prio_gen_false : if (not G_SUP_RX_PRIO) generate
+            ident_prio_d <= '0';
+        end generate;
     end generate;
 
 
@@ -422,27 +546,51 @@ begin
     begin
         if (res_n = '0') then
             ident_valid_q <= '0';
+            ident_prio_q <= '0';
         elsif rising_edge(clk_sys) then
             ident_valid_q   <= ident_valid_d;
+            ident_prio_q    <= ident_prio_d;
         end if;
     end process valid_reg_proc;
     
     ---------------------------------------------------------------------------
     -- Filtering RX Buffer commands
     ---------------------------------------------------------------------------
-    store_metadata_f <= '1' when (store_metadata = '1' and ident_valid_q = '1')
+    main_sel <= '1' when (ident_valid_q = '1' and ident_prio_q = '0') else
+                '0';
+
+    prio_sel <= '1' when (ident_valid_q = '1' and ident_prio_q = '1') else
+                '0';
+
+    store_metadata_f <= '1' when (store_metadata = '1' and main_sel = '1')
+                            else
+                        '0';
+
+    store_data_f <= '1' when (store_data = '1' and main_sel = '1')
+                        else
+                    '0';
+
+    rec_valid_f <= '1' when (rec_valid = '1' and main_sel = '1')
+                       else
+                   '0';
+
+    rec_abort_f <= '1' when (rec_abort = '1' and main_sel = '1')
+                       else
+                   '0';
+
+    store_metadata_p <= '1' when (store_metadata = '1' and prio_sel = '1')
                             else
                         '0';
 
-    store_data_f <= '1' when (store_data = '1' and ident_valid_q = '1')
+    store_data_p <= '1' when (store_data = '1' and prio_sel = '1')
                         else
                     '0';
 
-    rec_valid_f <= '1' when (rec_valid = '1' and ident_valid_q = '1')
+    rec_valid_p <= '1' when (rec_valid = '1' and prio_sel = '1')
                        else
                    '0';
 
-    rec_abort_f <= '1' when (rec_abort = '1' and ident_valid_q = '1')
+    rec_abort_p <= '1' when (rec_abort = '1' and prio_sel = '1')
                        else
                    '0';
                    
@@ -0,0 +1,331 @@
+--------------------------------------------------------------------------------
+-- 
+-- CTU CAN FD IP Core 
+-- Copyright (C) 2021-present Ondrej Ille
+-- 
+-- Permission is hereby granted, free of charge, to any person obtaining a copy
+-- of this VHDL component and associated documentation files (the "Component"),
+-- to use, copy, modify, merge, publish, distribute the Component for
+-- educational, research, evaluation, self-interest purposes. Using the
+-- Component for commercial purposes is forbidden unless previously agreed with
+-- Copyright holder.
+-- 
+-- The above copyright notice and this permission notice shall be included in
+-- all copies or substantial portions of the Component.
+-- 
+-- THE COMPONENT IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+-- IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+-- FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+-- AUTHORS OR COPYRIGHTHOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+-- LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+-- FROM, OUT OF OR IN CONNECTION WITH THE COMPONENT OR THE USE OR OTHER DEALINGS
+-- IN THE COMPONENT.
+-- 
+-- The CAN protocol is developed by Robert Bosch GmbH and protected by patents.
+-- Anybody who wants to implement this IP core on silicon has to obtain a CAN
+-- protocol license from Bosch.
+-- 
+-- -------------------------------------------------------------------------------
+-- 
+-- CTU CAN FD IP Core 
+-- Copyright (C) 2015-2020 MIT License
+-- 
+-- Authors:
+--     Ondrej Ille <ondrej.ille@gmail.com>
+--     Martin Jerabek <martin.jerabek01@gmail.com>
+-- 
+-- Project advisors: 
+-- 	Jiri Novak <jnovak@fel.cvut.cz>
+-- 	Pavel Pisa <pisa@cmp.felk.cvut.cz>
+-- 
+-- Department of Measurement         (http://meas.fel.cvut.cz/)
+-- Faculty of Electrical Engineering (http://www.fel.cvut.cz)
+-- Czech Technical University        (http://www.cvut.cz/)
+-- 
+-- Permission is hereby granted, free of charge, to any person obtaining a copy
+-- of this VHDL component and associated documentation files (the "Component"),
+-- to deal in the Component without restriction, including without limitation
+-- the rights to use, copy, modify, merge, publish, distribute, sublicense,
+-- and/or sell copies of the Component, and to permit persons to whom the
+-- Component is furnished to do so, subject to the following conditions:
+-- 
+-- The above copyright notice and this permission notice shall be included in
+-- all copies or substantial portions of the Component.
+-- 
+-- THE COMPONENT IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+-- IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+-- FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+-- AUTHORS OR COPYRIGHTHOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+-- LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+-- FROM, OUT OF OR IN CONNECTION WITH THE COMPONENT OR THE USE OR OTHER DEALINGS
+-- IN THE COMPONENT.
+-- 
+-- The CAN protocol is developed by Robert Bosch GmbH and protected by patents.
+-- Anybody who wants to implement this IP core on silicon has to obtain a CAN
+-- protocol license from Bosch.
+-- 
+--------------------------------------------------------------------------------
+
+
+--------------------------------------------------------------------------------
+-- Module:
+--  ID set filter for CAN identifiers.
+--
+-- Purpose:
+--  Filters CAN identifier by membership in a set of identifiers stored in
+--  memory. Base identifiers are looked up in 2048-bit bitmap (one bit per
+--  identifier). Extended identifiers are looked up in a hash table with
+--  2^G_HASH_WIDTH entries and linear probing. Each hash table entry contains
+--  valid bit (bit 31) and 29-bit identifier (bits 28:0). Identifier is stored
+--  at one of G_PROBE_LEN consecutive entries (modulo table size) starting at
+--  hash index of the identifier. Hash index is XOR-fold of the identifier
+--  to G_HASH_WIDTH bits.
+--
+--  Lookup is started whenever input identifier changes, or a memory is
+--  written. Lookup takes G_PROBE_LEN + 1 clock cycles and output is not valid
+--  during the lookup. Since received identifier is stable on the input for
+--  several bit times before it is stored to RX Buffer, this is sufficient.
+--
+--  Both memories are write only from memory registers. Content of memories is
+--  not reset, and it must be initialized by SW before the filter is enabled.
+--------------------------------------------------------------------------------
+
+Library ieee;
+use ieee.std_logic_1164.all;
+use ieee.numeric_std.ALL;
+
+Library ctu_can_fd_rtl;
+use ctu_can_fd_rtl.id_transfer_pkg.all;
+use ctu_can_fd_rtl.can_constants_pkg.all;
+
+use ctu_can_fd_rtl.can_types_pkg.all;
+use ctu_can_fd_rtl.drv_stat_pkg.all;
+use ctu_can_fd_rtl.unary_ops_pkg.all;
+
+use ctu_can_fd_rtl.CAN_FD_register_map.all;
+use ctu_can_fd_rtl.CAN_FD_frame_format.all;
+
+entity id_set_filter is
+    generic(
+        -- Filter presence
+        G_IS_PRESENT         :   boolean;
+
+        -- Hash table address width (2^G_HASH_WIDTH entries)
+        G_HASH_WIDTH         :   natural range 1 to 10 := 8;
+
+        -- Number of probed hash table entries
+        G_PROBE_LEN          :   natural range 1 to 15 := 4
+    );
+    port(
+        ------------------------------------------------------------------------
+        -- Clock and Asynchronous reset
+        ------------------------------------------------------------------------
+        -- System clock
+        clk_sys              : in  std_logic;
+
+        -- Asynchronous reset
+        res_n                : in  std_logic;
+
+        ------------------------------------------------------------------------
+        -- Memory write interface
+        ------------------------------------------------------------------------
+        -- Write memory word
+        mem_write            : in  std_logic;
+
+        -- Table select (0 - Bitmap, 1 - Hash table)
+        mem_tsel             : in  std_logic;
+
+        -- Word address
+        mem_addr             : in  std_logic_vector(9 downto 0);
+
+        -- Word data
+        mem_data             : in  std_logic_vector(31 downto 0);
+
+        ------------------------------------------------------------------------
+        -- Filter interface
+        ------------------------------------------------------------------------
+        -- Filter input (Identifier in RX Buffer format)
+        filter_input         : in  std_logic_vector(28 downto 0);
+
+        -- Identifier type (0-Base Format, 1-Extended Format)
+        filter_ident_type    : in  std_logic;
+
+        -- Filter enable (output is stuck at zero when disabled)
+        enable               : in  std_logic;
+
+        -- '1' when Filter input passes the filter
+        valid                : out std_logic
+    );
+end entity;
+
+architecture rtl of id_set_filter is
+
+    constant C_HASH_DEPTH           :   natural := 2 ** G_HASH_WIDTH;
+
+    ----------------------------------------------------------------------------
+    -- XOR-fold of identifier to hash table index
+    ----------------------------------------------------------------------------
+    function hash_index(
+        ident           :   std_logic_vector(28 downto 0)
+    ) return unsigned is
+        variable index  :   std_logic_vector(G_HASH_WIDTH - 1 downto 0);
+    begin
+        index := (OTHERS => '0');
+        for i in 0 to 28 loop
+            index(i mod G_HASH_WIDTH) := index(i mod G_HASH_WIDTH) xor ident(i);
+        end loop;
+        return unsigned(index);
+    end function;
+
+begin
+
+    gen_filt_pos : if (G_IS_PRESENT = true) generate
+
+        -- Bitmap memory
+        signal bmp_write            :   std_logic;
+        signal bmp_addr_b           :   std_logic_vector(5 downto 0);
+        signal bmp_data_out         :   std_logic_vector(31 downto 0);
+
+        -- Hash table memory
+        signal hash_write           :   std_logic;
+        signal hash_addr_b          :   std_logic_vector(G_HASH_WIDTH - 1 downto 0);
+        signal hash_data_out        :   std_logic_vector(31 downto 0);
+
+        -- Looked up key (identifier type and identifier)
+        signal key_d                :   std_logic_vector(29 downto 0);
+        signal key_q                :   std_logic_vector(29 downto 0);
+
+        -- Lookup restart
+        signal lookup_restart       :   std_logic;
+
+        -- Lookup step. Memory word read in step N is available in step N + 1.
+        signal lookup_step          :   natural range 0 to G_PROBE_LEN + 1;
+
+        -- Lookup is finished
+        signal lookup_done          :   std_logic;
+
+        -- Memory word read in previous step matches the key
+        signal word_hit             :   std_logic;
+
+        -- Identifier was found
+        signal lookup_hit           :   std_logic;
+
+    begin
+
+        ------------------------------------------------------------------------
+        -- Memory write
+        ------------------------------------------------------------------------
+        bmp_write  <= '1' when (mem_write = '1' and mem_tsel = FSET_TSEL_BITMAP)
+                          else
+                      '0';
+
+        hash_write <= '1' when (mem_write = '1' and mem_tsel = FSET_TSEL_HASH)
+                          else
+                      '0';
+
+        ------------------------------------------------------------------------
+        -- Memories
+        ------------------------------------------------------------------------
+        bitmap_ram_inst : entity ctu_can_fd_rtl.inf_ram_wrapper
+        generic map(
+            G_WORD_WIDTH           => 32,
+            G_DEPTH                => 64,
+            G_ADDRESS_WIDTH        => 6,
+            G_SYNC_READ            => true
+        )
+        port map(
+            clk_sys                => clk_sys,                         -- IN
+
+            addr_A                 => mem_addr(5 downto 0),            -- IN
+            write                  => bmp_write,                       -- IN
+            data_in                => mem_data,                        -- IN
+            be                     => "1111",                          -- IN
+
+            addr_B                 => bmp_addr_b,                      -- IN
+            data_out               => bmp_data_out                     -- OUT
+        );
+
+        hash_ram_inst : entity ctu_can_fd_rtl.inf_ram_wrapper
+        generic map(
+            G_WORD_WIDTH           => 32,
+            G_DEPTH                => C_HASH_DEPTH,
+            G_ADDRESS_WIDTH        => G_HASH_WIDTH,
+            G_SYNC_READ            => true
+        )
+        port map(
+            clk_sys                => clk_sys,                         -- IN
+
+            addr_A                 => mem_addr(G_HASH_WIDTH - 1 downto 0), -- IN
+            write                  => hash_write,                      -- IN
+            data_in                => mem_data,                        -- IN
+            be                     => "1111",                          -- IN
+
+            addr_B                 => hash_addr_b,                     -- IN
+            data_out               => hash_data_out                    -- OUT
+        );
+
+        ------------------------------------------------------------------------
+        -- Read addresses. Base identifier is in bits 28:18 of filter input.
+        -- Bitmap word is given by upper 6 bits of Base identifier, bit within
+        -- the word by lower 5 bits.
+        ------------------------------------------------------------------------
+        bmp_addr_b  <= filter_input(28 downto 23);
+
+        hash_addr_b <= std_logic_vector(hash_index(filter_input) +
+                           to_unsigned(lookup_step mod C_HASH_DEPTH, G_HASH_WIDTH));
+
+        ------------------------------------------------------------------------
+        -- Lookup is restarted when identifier or its type changes, or when
+        -- memory is written.
+        ------------------------------------------------------------------------
+        key_d <= filter_ident_type & filter_input;
+
+        lookup_restart <= '1' when (key_d /= key_q or mem_write = '1')
+                              else
+                          '0';
+
+        word_hit <=
+            bmp_data_out(to_integer(unsigned(key_q(22 downto 18))))
+                when (key_q(29) = BASE) else
+            '1' when (hash_data_out(31) = '1' and
+                      hash_data_out(28 downto 0) = key_q(28 downto 0))
+                else
+            '0';
+
+        lookup_proc : process(res_n, clk_sys)
+        begin
+            if (res_n = '0') then
+                key_q       <= (OTHERS => '0');
+                lookup_step <= 0;
+                lookup_hit  <= '0';
+            elsif (rising_edge(clk_sys)) then
+                key_q <= key_d;
+
+                if (lookup_restart = '1') then
+                    lookup_step <= 0;
+                    lookup_hit  <= '0';
+                elsif (lookup_step < G_PROBE_LEN + 1) then
+                    lookup_step <= lookup_step + 1;
+                    if (lookup_step > 0 and word_hit = '1') then
+                        lookup_hit <= '1';
+                    end if;
+                end if;
+            end if;
+        end process;
+
+        lookup_done <= '1' when (lookup_step = G_PROBE_LEN + 1)
+                           else
+                       '0';
+
+        valid <= '1' when (lookup_done = '1' and lookup_hit = '1' and
+                           enable = '1')
+                     else
+                 '0';
+
+    end generate;
+
+    gen_filt_neg : if (G_IS_PRESENT = false) generate
+        valid <= '0';
+    end generate;
+
+end architecture;
@@ -73,6 +73,12 @@
 -- Purpose:
 --  Adaptor from AHB to internal bus of CTU CAN FD.
 --
+--  Each beat of a burst (INCR / WRAP) is passed as single access with its
+--  own address. Read data are returned in the data phase of the beat, so
+--  burst reads run without wait states. Reads from RX data window (any address
+--  of the window reads next word of RX Buffer) thus allow reading whole frame
+--  by single burst.
+--
 --------------------------------------------------------------------------------
 
 Library ieee;
@@ -126,8 +132,14 @@ end entity;
 
 architecture rtl of ahb_ifc is
     
+    -- Transfer type idle
+    constant TT_IDLE   : std_logic_vector(1 downto 0) := "00";
+
     -- Transfer type busy
     constant TT_BUSY   : std_logic_vector(1 downto 0) := "01";
+
+    -- Transfer type sequential (next beat of burst)
+    constant TT_SEQ    : std_logic_vector(1 downto 0) := "11";
     
     signal hsel_valid  : std_logic;
 
@@ -149,9 +161,11 @@ architecture rtl of ahb_ifc is
 
 begin
     
-    -- Only accept transaction if previous one completed OK!
+    -- Only accept transaction if previous one completed OK! IDLE transfer is
+    -- ignored too, otherwise it would read RX Buffer when address of IDLE
+    -- transfer (e.g. after burst) points to RX_DATA or RX data window.
     hsel_valid <= '1' when (hsel = '1' and hready = '1' and
-                            htrans /= TT_BUSY)
+                            htrans /= TT_BUSY and htrans /= TT_IDLE)
                       else
                   '0';
 
@@ -275,6 +289,13 @@ begin
     
     -- psl ahb_read_after_read_cov : 
     --      cover {hwrite = '0' and hsel = '1'; hwrite = '0' and hsel = '1'};
+
+    -- psl ahb_burst_read_cov :
+    --      cover {srd_i = '1' and htrans = TT_SEQ and hburst /= "000"};
+
+    -- psl ahb_burst_read_busy_cov :
+    --      cover {srd_i = '1'; hsel = '1' and htrans = TT_BUSY;
+    --             srd_i = '1' and htrans = TT_SEQ};
     
     -- <RELEASE_ON>
     
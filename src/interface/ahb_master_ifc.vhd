@@ -0,0 +1,200 @@
+--------------------------------------------------------------------------------
+-- 
+-- CTU CAN FD IP Core 
+-- Copyright (C) 2021-present Ondrej Ille
+-- 
+-- Permission is hereby granted, free of charge, to any person obtaining a copy
+-- of this VHDL component and associated documentation files (the "Component"),
+-- to use, copy, modify, merge, publish, distribute the Component for
+-- educational, research, evaluation, self-interest purposes. Using the
+-- Component for commercial purposes is forbidden unless previously agreed with
+-- Copyright holder.
+-- 
+-- The above copyright notice and this permission notice shall be included in
+-- all copies or substantial portions of the Component.
+-- 
+-- THE COMPONENT IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+-- IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+-- FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+-- AUTHORS OR COPYRIGHTHOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+-- LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+-- FROM, OUT OF OR IN CONNECTION WITH THE COMPONENT OR THE USE OR OTHER DEALINGS
+-- IN THE COMPONENT.
+-- 
+-- The CAN protocol is developed by Robert Bosch GmbH and protected by patents.
+-- Anybody who wants to implement this IP core on silicon has to obtain a CAN
+-- protocol license from Bosch.
+-- 
+-- -------------------------------------------------------------------------------
+-- 
+-- CTU CAN FD IP Core 
+-- Copyright (C) 2015-2020 MIT License
+-- 
+-- Authors:
+--     Ondrej Ille <ondrej.ille@gmail.com>
+--     Martin Jerabek <martin.jerabek01@gmail.com>
+-- 
+-- Project advisors: 
+-- 	Jiri Novak <jnovak@fel.cvut.cz>
+-- 	Pavel Pisa <pisa@cmp.felk.cvut.cz>
+-- 
+-- Department of Measurement         (http://meas.fel.cvut.cz/)
+-- Faculty of Electrical Engineering (http://www.fel.cvut.cz)
+-- Czech Technical University        (http://www.cvut.cz/)
+-- 
+-- Permission is hereby granted, free of charge, to any person obtaining a copy
+-- of this VHDL component and associated documentation files (the "Component"),
+-- to deal in the Component without restriction, including without limitation
+-- the rights to use, copy, modify, merge, publish, distribute, sublicense,
+-- and/or sell copies of the Component, and to permit persons to whom the
+-- Component is furnished to do so, subject to the following conditions:
+-- 
+-- The above copyright notice and this permission notice shall be included in
+-- all copies or substantial portions of the Component.
+-- 
+-- THE COMPONENT IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+-- IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+-- FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+-- AUTHORS OR COPYRIGHTHOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+-- LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+-- FROM, OUT OF OR IN CONNECTION WITH THE COMPONENT OR THE USE OR OTHER DEALINGS
+-- IN THE COMPONENT.
+-- 
+-- The CAN protocol is developed by Robert Bosch GmbH and protected by patents.
+-- Anybody who wants to implement this IP core on silicon has to obtain a CAN
+-- protocol license from Bosch.
+-- 
+--------------------------------------------------------------------------------
+
+--------------------------------------------------------------------------------
+-- Module:
+--  AHB Master Interface.
+--
+-- Purpose:
+--  Adaptor from bus master interface of RX DMA to AHB-Lite master. Each
+--  request is executed as single 32 bit non-sequential write transfer.
+--  Request is acknowledged at the end of data phase. Error response of slave
+--  is signalled together with acknowledge.
+--
+--------------------------------------------------------------------------------
+
+Library ieee;
+use ieee.std_logic_1164.all;
+use ieee.numeric_std.ALL;
+
+Library ctu_can_fd_rtl;
+use ctu_can_fd_rtl.id_transfer_pkg.all;
+use ctu_can_fd_rtl.can_constants_pkg.all;
+
+use ctu_can_fd_rtl.can_types_pkg.all;
+use ctu_can_fd_rtl.drv_stat_pkg.all;
+use ctu_can_fd_rtl.unary_ops_pkg.all;
+
+use ctu_can_fd_rtl.CAN_FD_register_map.all;
+use ctu_can_fd_rtl.CAN_FD_frame_format.all;
+
+entity ahb_master_ifc is
+    port (
+        -----------------------------------------------------------------------
+        -- CTU CAN FD Interface
+        -----------------------------------------------------------------------
+        dma_m_addr       : in  std_logic_vector(31 downto 0);
+        dma_m_wdata      : in  std_logic_vector(31 downto 0);
+        dma_m_req        : in  std_logic;
+        dma_m_ack        : out std_logic;
+        dma_m_err        : out std_logic;
+
+        -----------------------------------------------------------------------
+        -- AHB interface 
+        -----------------------------------------------------------------------
+        hresetn          : in  std_logic;
+        hclk             : in  std_logic;
+        haddr            : out std_logic_vector(31 downto 0);
+        hwdata           : out std_logic_vector(31 downto 0);
+        hwrite           : out std_logic;
+        hsize            : out std_logic_vector(2 downto 0);
+        hburst           : out std_logic_vector(2 downto 0);
+        hprot            : out std_logic_vector(3 downto 0);
+        htrans           : out std_logic_vector(1 downto 0);
+        hmastlock        : out std_logic;
+        hready           : in  std_logic;
+        hresp            : in  std_logic
+    );
+end entity;
+
+architecture rtl of ahb_master_ifc is
+    
+    -- Transfer types
+    constant TT_IDLE     : std_logic_vector(1 downto 0) := "00";
+    constant TT_NONSEQ   : std_logic_vector(1 downto 0) := "10";
+
+    -- Data phase of transfer is in progress
+    signal data_phase_d  : std_logic;
+    signal data_phase_q  : std_logic;
+
+    -- Address phase is driven
+    signal addr_phase    : std_logic;
+
+begin
+
+    ---------------------------------------------------------------------------
+    -- Address phase is driven when request is pending and no data phase is in
+    -- progress. Request (with address and data) is held until acknowledge, so
+    -- address and data need not be registered.
+    ---------------------------------------------------------------------------
+    addr_phase <= '1' when (dma_m_req = '1' and data_phase_q = '0')
+                      else
+                  '0';
+
+    data_phase_d <= '1' when (addr_phase = '1' and hready = '1')
+                        else
+                    '0' when (hready = '1')
+                        else
+                    data_phase_q;
+
+    data_phase_reg_proc : process(hclk, hresetn)
+    begin
+        if (hresetn = '0') then
+            data_phase_q <= '0';
+        elsif (rising_edge(hclk)) then
+            data_phase_q <= data_phase_d;
+        end if;
+    end process;
+
+    haddr     <= dma_m_addr;
+    hwdata    <= dma_m_wdata;
+    hwrite    <= '1';
+    hsize     <= "010";
+    hburst    <= "000";
+    hprot     <= "0011";
+    hmastlock <= '0';
+    htrans    <= TT_NONSEQ when (addr_phase = '1') else
+                 TT_IDLE;
+
+    dma_m_ack <= '1' when (data_phase_q = '1' and hready = '1')
+                     else
+                 '0';
+    dma_m_err <= hresp;
+    
+    -- <RELEASE_OFF>
+    ---------------------------------------------------------------------------
+    ---------------------------------------------------------------------------
+    -- Assertions
+    ---------------------------------------------------------------------------
+    ---------------------------------------------------------------------------
+    
+    -- psl default clock is rising_edge (hclk);
+    
+    -- psl ahb_master_wait_state_cov : 
+    --      cover {data_phase_q = '1' and hready = '0'};
+    
+    -- psl ahb_master_err_resp_cov : 
+    --      cover {data_phase_q = '1' and hready = '1' and hresp = '1'};
+
+    -- psl ahb_master_req_drop_asrt : assert never
+    --      (data_phase_q = '1' and dma_m_req = '0')
+    --      report "Bus master request shall be held until acknowledge!";
+    
+    -- <RELEASE_ON>
+    
+end architecture rtl;
@@ -0,0 +1,515 @@
+--------------------------------------------------------------------------------
+-- 
+-- CTU CAN FD IP Core 
+-- Copyright (C) 2021-present Ondrej Ille
+-- 
+-- Permission is hereby granted, free of charge, to any person obtaining a copy
+-- of this VHDL component and associated documentation files (the "Component"),
+-- to use, copy, modify, merge, publish, distribute the Component for
+-- educational, research, evaluation, self-interest purposes. Using the
+-- Component for commercial purposes is forbidden unless previously agreed with
+-- Copyright holder.
+-- 
+-- The above copyright notice and this permission notice shall be included in
+-- all copies or substantial portions of the Component.
+-- 
+-- THE COMPONENT IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+-- IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+-- FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+-- AUTHORS OR COPYRIGHTHOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+-- LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+-- FROM, OUT OF OR IN CONNECTION WITH THE COMPONENT OR THE USE OR OTHER DEALINGS
+-- IN THE COMPONENT.
+-- 
+-- The CAN protocol is developed by Robert Bosch GmbH and protected by patents.
+-- Anybody who wants to implement this IP core on silicon has to obtain a CAN
+-- protocol license from Bosch.
+-- 
+-- -------------------------------------------------------------------------------
+-- 
+-- CTU CAN FD IP Core 
+-- Copyright (C) 2015-2020 MIT License
+-- 
+-- Authors:
+--     Ondrej Ille <ondrej.ille@gmail.com>
+--     Martin Jerabek <martin.jerabek01@gmail.com>
+-- 
+-- Project advisors: 
+-- 	Jiri Novak <jnovak@fel.cvut.cz>
+-- 	Pavel Pisa <pisa@cmp.felk.cvut.cz>
+-- 
+-- Department of Measurement         (http://meas.fel.cvut.cz/)
+-- Faculty of Electrical Engineering (http://www.fel.cvut.cz)
+-- Czech Technical University        (http://www.cvut.cz/)
+-- 
+-- Permission is hereby granted, free of charge, to any person obtaining a copy
+-- of this VHDL component and associated documentation files (the "Component"),
+-- to deal in the Component without restriction, including without limitation
+-- the rights to use, copy, modify, merge, publish, distribute, sublicense,
+-- and/or sell copies of the Component, and to permit persons to whom the
+-- Component is furnished to do so, subject to the following conditions:
+-- 
+-- The above copyright notice and this permission notice shall be included in
+-- all copies or substantial portions of the Component.
+-- 
+-- THE COMPONENT IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+-- IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+-- FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+-- AUTHORS OR COPYRIGHTHOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+-- LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+-- FROM, OUT OF OR IN CONNECTION WITH THE COMPONENT OR THE USE OR OTHER DEALINGS
+-- IN THE COMPONENT.
+-- 
+-- The CAN protocol is developed by Robert Bosch GmbH and protected by patents.
+-- Anybody who wants to implement this IP core on silicon has to obtain a CAN
+-- protocol license from Bosch.
+-- 
+--------------------------------------------------------------------------------
+
+--------------------------------------------------------------------------------
+-- Module:
+--  AXI4 Interface.
+--
+-- Purpose:
+--  Adaptor from AXI4 (full) slave with 64-bit data path to internal bus of
+--  CTU CAN FD.
+--
+--  Single transaction is processed at a time. Write and read address channels
+--  are arbitrated in round-robin manner, IDs are returned in BID / RID.
+--  FIXED, INCR and WRAP bursts are supported. Each beat is split to at most
+--  two 32-bit accesses of internal bus (lower lane first):
+--   - Write accesses only the lanes which have at least one strobe set.
+--   - 64-bit read accesses both lanes, narrow read accesses only the lane
+--     selected by address bit 2. Thus narrow read from RX_DATA or RX data
+--     window pops only single word of RX Buffer.
+--
+--  64-bit reads from RX data window return two words of RX Buffer in single
+--  beat, INCR burst into TXT Buffer data area writes two words per beat.
+--  Exclusive accesses are not supported, OKAY is always responded.
+--
+--------------------------------------------------------------------------------
+
+Library ieee;
+use ieee.std_logic_1164.all;
+use ieee.numeric_std.ALL;
+
+Library ctu_can_fd_rtl;
+use ctu_can_fd_rtl.id_transfer_pkg.all;
+use ctu_can_fd_rtl.can_constants_pkg.all;
+
+use ctu_can_fd_rtl.can_types_pkg.all;
+use ctu_can_fd_rtl.drv_stat_pkg.all;
+use ctu_can_fd_rtl.unary_ops_pkg.all;
+
+use ctu_can_fd_rtl.CAN_FD_register_map.all;
+use ctu_can_fd_rtl.CAN_FD_frame_format.all;
+
+entity axi_ifc is
+    generic (
+        -- ID (bits  15-12 of reg_addr_o)
+        ID                : natural := 1;
+
+        -- Width of AXI ID signals
+        AXI_ID_WIDTH      : natural range 1 to 16 := 4
+    );
+    port (
+        aclk             : in  std_logic;
+        arstn            : in  std_logic;
+
+        -----------------------------------------------------------------------
+        -- CTU CAN FD Interface
+        -----------------------------------------------------------------------
+        reg_data_in_o    : out std_logic_vector(31 downto 0);
+        reg_data_out_i   : in  std_logic_vector(31 downto 0);
+        reg_addr_o       : out std_logic_vector(15 downto 0);
+        reg_be_o         : out std_logic_vector(3 downto 0);
+        reg_cs_o         : out std_logic;
+        reg_rden_o       : out std_logic;
+        reg_wren_o       : out std_logic;
+
+        -----------------------------------------------------------------------
+        -- AXI4 interface
+        -----------------------------------------------------------------------
+        -- Write address channel
+        s_axi_awid       : in  std_logic_vector(AXI_ID_WIDTH - 1 downto 0);
+        s_axi_awaddr     : in  std_logic_vector(31 downto 0);
+        s_axi_awlen      : in  std_logic_vector(7 downto 0);
+        s_axi_awsize     : in  std_logic_vector(2 downto 0);
+        s_axi_awburst    : in  std_logic_vector(1 downto 0);
+        s_axi_awlock     : in  std_logic;
+        s_axi_awcache    : in  std_logic_vector(3 downto 0);
+        s_axi_awprot     : in  std_logic_vector(2 downto 0);
+        s_axi_awvalid    : in  std_logic;
+        s_axi_awready    : out std_logic;
+
+        -- Write data channel
+        s_axi_wdata      : in  std_logic_vector(63 downto 0);
+        s_axi_wstrb      : in  std_logic_vector(7 downto 0);
+        s_axi_wlast      : in  std_logic;
+        s_axi_wvalid     : in  std_logic;
+        s_axi_wready     : out std_logic;
+
+        -- Write response channel
+        s_axi_bid        : out std_logic_vector(AXI_ID_WIDTH - 1 downto 0);
+        s_axi_bresp      : out std_logic_vector(1 downto 0);
+        s_axi_bvalid     : out std_logic;
+        s_axi_bready     : in  std_logic;
+
+        -- Read address channel
+        s_axi_arid       : in  std_logic_vector(AXI_ID_WIDTH - 1 downto 0);
+        s_axi_araddr     : in  std_logic_vector(31 downto 0);
+        s_axi_arlen      : in  std_logic_vector(7 downto 0);
+        s_axi_arsize     : in  std_logic_vector(2 downto 0);
+        s_axi_arburst    : in  std_logic_vector(1 downto 0);
+        s_axi_arlock     : in  std_logic;
+        s_axi_arcache    : in  std_logic_vector(3 downto 0);
+        s_axi_arprot     : in  std_logic_vector(2 downto 0);
+        s_axi_arvalid    : in  std_logic;
+        s_axi_arready    : out std_logic;
+
+        -- Read data channel
+        s_axi_rid        : out std_logic_vector(AXI_ID_WIDTH - 1 downto 0);
+        s_axi_rdata      : out std_logic_vector(63 downto 0);
+        s_axi_rresp      : out std_logic_vector(1 downto 0);
+        s_axi_rlast      : out std_logic;
+        s_axi_rvalid     : out std_logic;
+        s_axi_rready     : in  std_logic
+    );
+end entity;
+
+architecture rtl of axi_ifc is
+
+    -- Burst types
+    constant BURST_FIXED : std_logic_vector(1 downto 0) := "00";
+    constant BURST_WRAP  : std_logic_vector(1 downto 0) := "10";
+
+    -- Beat size of 64 bits (both lanes)
+    constant SIZE_64     : std_logic_vector(2 downto 0) := "011";
+
+    -- OKAY response
+    constant RESP_OKAY   : std_logic_vector(1 downto 0) := "00";
+
+    type t_axi_ifc_state is (
+        s_idle,         -- Waiting for write or read address
+        s_wr_data,      -- Waiting for write data beat
+        s_wr_acc,       -- Writing lane of beat to internal bus
+        s_wr_resp,      -- Write response
+        s_rd_acc,       -- Reading lane of beat from internal bus
+        s_rd_cap,       -- Capturing read data of last lane
+        s_rd_data       -- Read data beat
+    );
+
+    subtype t_reg_addr is unsigned(ID_ADRESS_LOWER - 1 downto 0);
+
+    ---------------------------------------------------------------------------
+    -- Address increment of single beat. Sizes above 64 bits are not legal on
+    -- 64-bit bus, they are handled as 64-bit.
+    ---------------------------------------------------------------------------
+    function beat_incr(
+        size : std_logic_vector(2 downto 0)
+    ) return t_reg_addr is
+        variable res : t_reg_addr := (others => '0');
+    begin
+        case size is
+        when "000"  => res(0) := '1';
+        when "001"  => res(1) := '1';
+        when "010"  => res(2) := '1';
+        when others => res(3) := '1';
+        end case;
+        return res;
+    end function;
+
+    ---------------------------------------------------------------------------
+    -- Mask of address bits which wrap within WRAP burst (burst length times
+    -- beat size, minus one).
+    ---------------------------------------------------------------------------
+    function wrap_mask(
+        len  : std_logic_vector(7 downto 0);
+        size : std_logic_vector(2 downto 0)
+    ) return t_reg_addr is
+        variable beats : t_reg_addr;
+    begin
+        beats := resize(unsigned(len(3 downto 0)), ID_ADRESS_LOWER) + 1;
+        case size is
+        when "000"  => return beats - 1;
+        when "001"  => return shift_left(beats, 1) - 1;
+        when "010"  => return shift_left(beats, 2) - 1;
+        when others => return shift_left(beats, 3) - 1;
+        end case;
+    end function;
+
+    signal state_q       : t_axi_ifc_state;
+
+    -- Transaction attributes
+    signal addr_q        : t_reg_addr;
+    signal addr_next     : t_reg_addr;
+    signal len_q         : unsigned(7 downto 0);
+    signal size_q        : std_logic_vector(2 downto 0);
+    signal burst_q       : std_logic_vector(1 downto 0);
+    signal wrap_mask_q   : t_reg_addr;
+    signal id_q          : std_logic_vector(AXI_ID_WIDTH - 1 downto 0);
+
+    -- Lane of beat accessed on internal bus (0 - lower, 1 - upper)
+    signal lane_q        : std_logic;
+
+    -- Last accepted transaction was write (round-robin arbitration)
+    signal wr_last_q     : std_logic;
+
+    signal pick_wr       : std_logic;
+    signal pick_rd       : std_logic;
+
+    signal wdata_q       : std_logic_vector(63 downto 0);
+    signal wstrb_q       : std_logic_vector(7 downto 0);
+    signal rdata_q       : std_logic_vector(63 downto 0);
+
+    -- Read was issued in previous cycle, data are on reg_data_out_i
+    signal rd_pend_q     : std_logic;
+    signal rd_lane_q     : std_logic;
+
+    signal swr_i         : std_logic;
+    signal srd_i         : std_logic;
+
+begin
+
+    ---------------------------------------------------------------------------
+    -- Address channel arbitration: Write has priority unless last accepted
+    -- transaction was write and read is pending.
+    ---------------------------------------------------------------------------
+    pick_wr <= '1' when (state_q = s_idle and s_axi_awvalid = '1' and
+                         (s_axi_arvalid = '0' or wr_last_q = '0'))
+                   else
+               '0';
+
+    pick_rd <= '1' when (state_q = s_idle and s_axi_arvalid = '1' and
+                         pick_wr = '0')
+                   else
+               '0';
+
+    ---------------------------------------------------------------------------
+    -- Address of next beat
+    ---------------------------------------------------------------------------
+    addr_next_proc : process(addr_q, size_q, burst_q, wrap_mask_q)
+        variable incr      : t_reg_addr;
+        variable incr_addr : t_reg_addr;
+    begin
+        incr := beat_incr(size_q);
+        incr_addr := (addr_q and not (incr - 1)) + incr;
+
+        if (burst_q = BURST_FIXED) then
+            addr_next <= addr_q;
+        elsif (burst_q = BURST_WRAP) then
+            addr_next <= (addr_q and not wrap_mask_q) or
+                         (incr_addr and wrap_mask_q);
+        else
+            addr_next <= incr_addr;
+        end if;
+    end process;
+
+    ---------------------------------------------------------------------------
+    -- Transaction FSM
+    ---------------------------------------------------------------------------
+    axi_fsm_proc : process(aclk, arstn)
+    begin
+        if (arstn = '0') then
+            state_q     <= s_idle;
+            addr_q      <= (others => '0');
+            len_q       <= (others => '0');
+            size_q      <= (others => '0');
+            burst_q     <= (others => '0');
+            wrap_mask_q <= (others => '0');
+            id_q        <= (others => '0');
+            lane_q      <= '0';
+            wr_last_q   <= '0';
+            wdata_q     <= (others => '0');
+            wstrb_q     <= (others => '0');
+            rdata_q     <= (others => '0');
+            rd_pend_q   <= '0';
+            rd_lane_q   <= '0';
+
+        elsif (rising_edge(aclk)) then
+
+            -- Read data are available one cycle after read enable
+            rd_pend_q <= srd_i;
+            rd_lane_q <= lane_q;
+            if (rd_pend_q = '1') then
+                if (rd_lane_q = '0') then
+                    rdata_q(31 downto 0) <= reg_data_out_i;
+                else
+                    rdata_q(63 downto 32) <= reg_data_out_i;
+                end if;
+            end if;
+
+            case state_q is
+            when s_idle =>
+                if (pick_wr = '1') then
+                    addr_q      <= unsigned(
+                        s_axi_awaddr(ID_ADRESS_LOWER - 1 downto 0));
+                    len_q       <= unsigned(s_axi_awlen);
+                    size_q      <= s_axi_awsize;
+                    burst_q     <= s_axi_awburst;
+                    wrap_mask_q <= wrap_mask(s_axi_awlen, s_axi_awsize);
+                    id_q        <= s_axi_awid;
+                    wr_last_q   <= '1';
+                    state_q     <= s_wr_data;
+                elsif (pick_rd = '1') then
+                    addr_q      <= unsigned(
+                        s_axi_araddr(ID_ADRESS_LOWER - 1 downto 0));
+                    len_q       <= unsigned(s_axi_arlen);
+                    size_q      <= s_axi_arsize;
+                    burst_q     <= s_axi_arburst;
+                    wrap_mask_q <= wrap_mask(s_axi_arlen, s_axi_arsize);
+                    id_q        <= s_axi_arid;
+                    lane_q      <= s_axi_araddr(2);
+                    wr_last_q   <= '0';
+                    state_q     <= s_rd_acc;
+                end if;
+
+            when s_wr_data =>
+                if (s_axi_wvalid = '1') then
+                    wdata_q <= s_axi_wdata;
+                    wstrb_q <= s_axi_wstrb;
+
+                    if (s_axi_wstrb(3 downto 0) /= "0000") then
+                        lane_q  <= '0';
+                        state_q <= s_wr_acc;
+                    elsif (s_axi_wstrb(7 downto 4) /= "0000") then
+                        lane_q  <= '1';
+                        state_q <= s_wr_acc;
+
+                    -- No strobe set, beat is skipped
+                    elsif (len_q = 0) then
+                        state_q <= s_wr_resp;
+                    else
+                        len_q  <= len_q - 1;
+                        addr_q <= addr_next;
+                    end if;
+                end if;
+
+            when s_wr_acc =>
+                if (lane_q = '0' and wstrb_q(7 downto 4) /= "0000") then
+                    lane_q <= '1';
+                elsif (len_q = 0) then
+                    state_q <= s_wr_resp;
+                else
+                    len_q   <= len_q - 1;
+                    addr_q  <= addr_next;
+                    state_q <= s_wr_data;
+                end if;
+
+            when s_wr_resp =>
+                if (s_axi_bready = '1') then
+                    state_q <= s_idle;
+                end if;
+
+            when s_rd_acc =>
+                if (lane_q = '0' and size_q = SIZE_64) then
+                    lane_q <= '1';
+                else
+                    state_q <= s_rd_cap;
+                end if;
+
+            when s_rd_cap =>
+                state_q <= s_rd_data;
+
+            when s_rd_data =>
+                if (s_axi_rready = '1') then
+                    if (len_q = 0) then
+                        state_q <= s_idle;
+                    else
+                        len_q   <= len_q - 1;
+                        addr_q  <= addr_next;
+                        lane_q  <= addr_next(2);
+                        state_q <= s_rd_acc;
+                    end if;
+                end if;
+            end case;
+        end if;
+    end process;
+
+    ---------------------------------------------------------------------------
+    -- Internal bus
+    ---------------------------------------------------------------------------
+    swr_i <= '1' when (state_q = s_wr_acc) else
+             '0';
+
+    srd_i <= '1' when (state_q = s_rd_acc) else
+             '0';
+
+    reg_addr_o(ID_ADRESS_HIGHER downto ID_ADRESS_LOWER) <=
+        std_logic_vector(to_unsigned(ID, 4));
+    reg_addr_o(ID_ADRESS_LOWER - 1 downto 3) <=
+        std_logic_vector(addr_q(ID_ADRESS_LOWER - 1 downto 3));
+    reg_addr_o(2) <= lane_q;
+    reg_addr_o(1 downto 0) <= (others => '0');
+
+    reg_data_in_o <= wdata_q(31 downto 0) when (lane_q = '0') else
+                     wdata_q(63 downto 32);
+
+    reg_be_o <= (others => '1') when (swr_i = '0') else
+                wstrb_q(3 downto 0) when (lane_q = '0') else
+                wstrb_q(7 downto 4);
+
+    reg_cs_o   <= swr_i or srd_i;
+    reg_wren_o <= swr_i;
+    reg_rden_o <= srd_i;
+
+    ---------------------------------------------------------------------------
+    -- AXI channels
+    ---------------------------------------------------------------------------
+    s_axi_awready <= pick_wr;
+    s_axi_arready <= pick_rd;
+
+    s_axi_wready <= '1' when (state_q = s_wr_data) else
+                    '0';
+
+    s_axi_bid    <= id_q;
+    s_axi_bresp  <= RESP_OKAY;
+    s_axi_bvalid <= '1' when (state_q = s_wr_resp) else
+                    '0';
+
+    s_axi_rid    <= id_q;
+    s_axi_rdata  <= rdata_q;
+    s_axi_rresp  <= RESP_OKAY;
+    s_axi_rlast  <= '1' when (len_q = 0) else
+                    '0';
+    s_axi_rvalid <= '1' when (state_q = s_rd_data) else
+                    '0';
+
+    -- <RELEASE_OFF>
+    ---------------------------------------------------------------------------
+    ---------------------------------------------------------------------------
+    -- Assertions
+    ---------------------------------------------------------------------------
+    ---------------------------------------------------------------------------
+
+    -- psl default clock is rising_edge (aclk);
+
+    -- psl axi_wlast_asrt : assert always
+    --  (state_q = s_wr_data and s_axi_wvalid = '1' and len_q = 0) ->
+    --      s_axi_wlast = '1'
+    --  report "WLAST shall be set on last beat of write burst";
+
+    -- psl axi_wr_rd_collision_cov :
+    --      cover {s_axi_awvalid = '1' and s_axi_arvalid = '1' and
+    --             state_q = s_idle};
+
+    -- psl axi_wr_burst_cov :
+    --      cover {state_q = s_wr_data and s_axi_wvalid = '1' and
+    --             s_axi_wlast = '0'};
+
+    -- psl axi_wr_both_lanes_cov :
+    --      cover {swr_i = '1' and lane_q = '0'; swr_i = '1' and lane_q = '1'};
+
+    -- psl axi_rd_both_lanes_cov :
+    --      cover {srd_i = '1' and lane_q = '0'; srd_i = '1' and lane_q = '1'};
+
+    -- psl axi_rd_burst_cov :
+    --      cover {state_q = s_rd_data and s_axi_rready = '1' and len_q /= 0};
+
+    -- psl axi_rd_wrap_cov :
+    --      cover {state_q = s_rd_data and burst_q = BURST_WRAP and
+    --             s_axi_rready = '1' and len_q /= 0};
+
+    -- <RELEASE_ON>
+
+end architecture rtl;
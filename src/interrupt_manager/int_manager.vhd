@@ -77,6 +77,11 @@
 --  it is captured to interrupt vector. If an interrupt is enabled and it is
 --  active in Interrupt vector, it causes Interrupt output to be asserted.
 --  Interrupt output is pipelined to make sure it is glitch free.
+--  Optionally, lower 32 bits of timestamp are latched for each interrupt when
+--  it becomes pending (set in Interrupt vector which was clear, or set again
+--  in the same cycle as it is cleared). Timestamp of interrupt selected by
+--  INT_TS_SEL is provided to memory registers. SW can then measure latency
+--  between interrupt assertion and its servicing.
 --------------------------------------------------------------------------------
 
 Library ieee;
@@ -100,7 +105,10 @@ entity int_manager is
         G_INT_COUNT          : natural  := 11;
         
         -- Number of TXT Buffers
-        G_TXT_BUFFER_COUNT   : natural := 4
+        G_TXT_BUFFER_COUNT   : natural := 4;
+
+        -- Latch timestamp when interrupt becomes pending
+        G_SUP_INT_TS         : boolean := false
     );
     port(
         ------------------------------------------------------------------------
@@ -151,6 +159,23 @@ entity int_manager is
         -- Overload frame is being transmitted
         is_overload      :in   std_logic;
 
+        -- RX DMA finished batch of frames
+        rx_dma_int       :in   std_logic;
+
+        -- Number of frames in TXT FIFO dropped to threshold
+        tx_fifo_int      :in   std_logic;
+
+        -- Frame was stored to Priority RX Buffer
+        rec_valid_p      :in   std_logic;
+
+        -- Priority RX Buffer is empty
+        rxp_empty        :in   std_logic;
+
+        ------------------------------------------------------------------------
+        -- Timestamp
+        ------------------------------------------------------------------------
+        timestamp        :in   std_logic_vector(63 downto 0);
+
         ------------------------------------------------------------------------
         -- Memory registers Interface
         ------------------------------------------------------------------------
@@ -166,7 +191,10 @@ entity int_manager is
         int_mask         :out  std_logic_vector(G_INT_COUNT - 1 downto 0);
 
         -- Interrupt enable
-        int_ena          :out  std_logic_vector(G_INT_COUNT - 1 downto 0)
+        int_ena          :out  std_logic_vector(G_INT_COUNT - 1 downto 0);
+
+        -- Pending timestamp of interrupt selected by INT_TS_SEL
+        int_ts           :out  std_logic_vector(31 downto 0)
     );
 end entity;
 
@@ -185,6 +213,8 @@ architecture rtl of int_manager is
 
     signal drv_int_mask_clr       :     std_logic_vector(G_INT_COUNT - 1 downto 0);
 
+    signal drv_int_ts_sel         :     std_logic_vector(3 downto 0);
+
     ----------------------------------------------------------------------------
     -- Internal registers and signals
     ----------------------------------------------------------------------------
@@ -199,6 +229,18 @@ architecture rtl of int_manager is
 
     constant zero_mask            :     std_logic_vector(G_INT_COUNT - 1 downto 0)
                                                 := (OTHERS => '0');
+
+    ----------------------------------------------------------------------------
+    -- Interrupt pending timestamps
+    ----------------------------------------------------------------------------
+    type t_int_ts_array is array (0 to G_INT_COUNT - 1) of
+        std_logic_vector(31 downto 0);
+
+    -- Interrupt becomes pending in this cycle
+    signal int_ts_capt            :     std_logic_vector(G_INT_COUNT - 1 downto 0);
+
+    -- Latched timestamps
+    signal int_ts_q               :     t_int_ts_array;
                                                 
     ----------------------------------------------------------------------------
     -- Reset over set priority assignment
@@ -216,6 +258,7 @@ begin
     drv_int_ena_clr   <= drv_bus(DRV_INT_ENA_CLR_HIGH downto DRV_INT_ENA_CLR_LOW);
     drv_int_mask_set  <= drv_bus(DRV_INT_MASK_SET_HIGH downto DRV_INT_MASK_SET_LOW);
     drv_int_mask_clr  <= drv_bus(DRV_INT_MASK_CLR_HIGH downto DRV_INT_MASK_CLR_LOW);
+    drv_int_ts_sel    <= drv_bus(DRV_INT_TS_SEL_HIGH downto DRV_INT_TS_SEL_LOW);
 
 
     ---------------------------------------------------------------------------      
@@ -251,6 +294,16 @@ begin
     -- Overload frame interrupt
     int_input_active(OFI_IND)       <= is_overload;
 
+    -- RX DMA interrupt
+    int_input_active(DMAI_IND)      <= rx_dma_int;
+
+    -- TXT FIFO threshold interrupt
+    int_input_active(TFTI_IND)      <= tx_fifo_int;
+
+    -- Priority RX Buffer interrupts
+    int_input_active(RXPI_IND)      <= rec_valid_p;
+    int_input_active(RPNEI_IND)     <= not rxp_empty;
+
     ---------------------------------------------------------------------------
     -- Interrupt module instances
     ---------------------------------------------------------------------------
@@ -276,6 +329,41 @@ begin
         );
     end generate int_module_gen;
 
+    ---------------------------------------------------------------------------
+    -- Interrupt pending timestamps. Captured with the same condition with
+    -- which int_module sets Interrupt status (set has priority over clear).
+    ---------------------------------------------------------------------------
+    int_ts_gen_true : if (G_SUP_INT_TS) generate
+
+        int_ts_capt <= int_input_active and (not int_mask_i) and
+                       ((not int_vect_i) or drv_int_vect_clr);
+
+        int_ts_proc : process(res_n, clk_sys)
+        begin
+            if (res_n = '0') then
+                int_ts_q <= (OTHERS => (OTHERS => '0'));
+            elsif rising_edge(clk_sys) then
+                for i in 0 to G_INT_COUNT - 1 loop
+                    if (int_ts_capt(i) = '1') then
+                        int_ts_q(i) <= timestamp(31 downto 0);
+                    end if;
+                end loop;
+            end if;
+        end process;
+
+        int_ts <= int_ts_q(to_integer(unsigned(drv_int_ts_sel)))
+                      when (to_integer(unsigned(drv_int_ts_sel)) < G_INT_COUNT)
+                      else
+                  (OTHERS => '0');
+
+    end generate int_ts_gen_true;
+
+    int_ts_gen_false : if (not G_SUP_INT_TS) generate
+        int_ts_capt <= (OTHERS => '0');
+        int_ts_q <= (OTHERS => (OTHERS => '0'));
+        int_ts <= (OTHERS => '0');
+    end generate int_ts_gen_false;
+
     ---------------------------------------------------------------------------
     -- Output interrupt DFF to make sure that interrupt output will be
     -- glitch free!
@@ -383,5 +471,26 @@ begin
     -- psl ofi_enable_cov : cover
     --  {int_vect_i(OFI_IND) = '1' and int_ena(OFI_IND) = '1'};
 
+    -- psl dmai_int_set_cov : cover
+    --  {int_vect_i(DMAI_IND) = '0';int_vect_i(DMAI_IND) = '1'};
+
+    -- psl dmai_enable_cov : cover
+    --  {int_vect_i(DMAI_IND) = '1' and int_ena(DMAI_IND) = '1'};
+
+    -- psl tfti_int_set_cov : cover
+    --  {int_vect_i(TFTI_IND) = '0';int_vect_i(TFTI_IND) = '1'};
+
+    -- psl tfti_enable_cov : cover
+    --  {int_vect_i(TFTI_IND) = '1' and int_ena(TFTI_IND) = '1'};
+
+    -- psl rxpi_int_set_cov : cover
+    --  {int_vect_i(RXPI_IND) = '0';int_vect_i(RXPI_IND) = '1'};
+
+    -- psl rpnei_enable_cov : cover
+    --  {int_vect_i(RPNEI_IND) = '1' and int_ena(RPNEI_IND) = '1'};
+
+    -- psl int_ts_capt_on_clear_cov : cover
+    --  {(int_ts_capt and int_vect_i) /= zero_mask};
+
     -- <RELEASE_ON>
 end architecture;
\ No newline at end of file
@@ -104,6 +104,25 @@ package can_registers_pkg is
      tx_command                  : std_logic_vector(15 downto 0);
      tx_priority                 : std_logic_vector(31 downto 0);
      ssp_cfg                     : std_logic_vector(15 downto 0);
+     timestamp_low_read          : std_logic;
+     filter_set_ctrl             : std_logic_vector(15 downto 0);
+     filter_set_addr             : std_logic_vector(15 downto 0);
+     filter_set_data             : std_logic_vector(31 downto 0);
+     filter_set_data_write       : std_logic;
+     rx_dma_ctrl                 : std_logic_vector(31 downto 0);
+     rx_dma_base                 : std_logic_vector(31 downto 0);
+     rx_dma_cons                 : std_logic_vector(15 downto 0);
+     tx_fifo_ctrl                : std_logic_vector(15 downto 0);
+     int_ts_sel                  : std_logic_vector(31 downto 0);
+     bus_stat_sel                : std_logic_vector(31 downto 0);
+     txtb_ts_sel                 : std_logic_vector(31 downto 0);
+     ts_inc                      : std_logic_vector(31 downto 0);
+     ts_step_low                 : std_logic_vector(31 downto 0);
+     ts_step_high                : std_logic_vector(31 downto 0);
+     txt_cyc_sel                 : std_logic_vector(15 downto 0);
+     txt_cyc_period              : std_logic_vector(31 downto 0);
+     txt_cyc_period_write        : std_logic;
+     tx_cpl_read                 : std_logic;
   end record;
 
 
@@ -136,6 +155,19 @@ package can_registers_pkg is
      yolo_reg                    : std_logic_vector(31 downto 0);
      timestamp_low               : std_logic_vector(31 downto 0);
      timestamp_high              : std_logic_vector(31 downto 0);
+     filter_set_info             : std_logic_vector(15 downto 0);
+     rx_drop_ctr                 : std_logic_vector(31 downto 0);
+     rx_dma_status               : std_logic_vector(31 downto 0);
+     tx_fifo_status              : std_logic_vector(15 downto 0);
+     int_ts                      : std_logic_vector(31 downto 0);
+     bus_stat                    : std_logic_vector(31 downto 0);
+     txtb_ts_low                 : std_logic_vector(31 downto 0);
+     txtb_ts_high                : std_logic_vector(31 downto 0);
+     rx_peek_ffw                 : std_logic_vector(31 downto 0);
+     rx_peek_idw                 : std_logic_vector(31 downto 0);
+     txt_cyc_skip                : std_logic_vector(15 downto 0);
+     tx_cpl_ts                   : std_logic_vector(31 downto 0);
+     tx_cpl                      : std_logic_vector(31 downto 0);
   end record;
 
 
@@ -89,7 +89,15 @@ generic (
     constant SUP_TRAFFIC_CTRS    : boolean := true;
     constant SUP_RANGE           : boolean := true;
     constant SUP_FILT_C          : boolean := true;
-    constant SUP_FILT_B          : boolean := true
+    constant SUP_FILT_B          : boolean := true;
+    constant SUP_FILT_SET        : boolean := true;
+    constant SUP_RX_DMA          : boolean := true;
+    constant SUP_TX_FIFO         : boolean := true;
+    constant SUP_INT_TS          : boolean := true;
+    constant SUP_TX_TS           : boolean := true;
+    constant SUP_TS_GEN          : boolean := true;
+    constant SUP_TXT_CYC         : boolean := true;
+    constant SUP_TX_CPL          : boolean := true
 );
 port (
     signal clk_sys               :in std_logic;
@@ -110,10 +118,10 @@ end entity control_registers_reg_map;
 
 
 architecture rtl of control_registers_reg_map is
-  signal reg_sel : std_logic_vector(38 downto 0);
+  signal reg_sel : std_logic_vector(63 downto 0);
   constant ADDR_VECT
-                 : std_logic_vector(233 downto 0) := "100110100101100100100011100010100001100000011111011110011101011100011011011010011001011000010111010110010101010100010011010010010001010000001111001110001101001100001011001010001001001000000111000110000101000100000011000010000001000000";
-  signal read_data_mux_in : std_logic_vector(1247 downto 0);
+                 : std_logic_vector(383 downto 0) := "111111111110111101111100111011111010111001111000110111110110110101110100110011110010110001110000101111101110101101101100101011101010101001101000100111100110100101100100100011100010100001100000011111011110011101011100011011011010011001011000010111010110010101010100010011010010010001010000001111001110001101001100001011001010001001001000000111000110000101000100000011000010000001000000";
+  signal read_data_mux_in : std_logic_vector(2047 downto 0);
   signal read_data_mask_n : std_logic_vector(31 downto 0);
   signal control_registers_out_i : Control_registers_out_t;
   signal read_mux_ena                : std_logic;
@@ -126,7 +134,7 @@ begin
     address_decoder_control_registers_comp : address_decoder
     generic map(
         address_width                   => 6 ,
-        address_entries                 => 39 ,
+        address_entries                 => 64 ,
         addr_vect                       => ADDR_VECT ,
         registered_out                  => false ,
         reset_polarity                  => RESET_POLARITY 
@@ -194,10 +202,10 @@ begin
     command_reg_comp : memory_reg
     generic map(
         data_width                      => 32 ,
-        data_mask                       => "00000000000000000000000011111110" ,
+        data_mask                       => "00000000000000000001111111111110" ,
         reset_polarity                  => RESET_POLARITY ,
         reset_value                     => "00000000000000000000000000000000" ,
-        auto_clear                      => "00000000000000000000000011111110" ,
+        auto_clear                      => "00000000000000000001111111111110" ,
         is_lockable                     => false 
     )
     port map(
@@ -218,10 +226,10 @@ begin
     int_stat_reg_comp : memory_reg
     generic map(
         data_width                      => 16 ,
-        data_mask                       => "0000111111111111" ,
+        data_mask                       => "1111111111111111" ,
         reset_polarity                  => RESET_POLARITY ,
         reset_value                     => "0000000000000000" ,
-        auto_clear                      => "0000111111111111" ,
+        auto_clear                      => "1111111111111111" ,
         is_lockable                     => false 
     )
     port map(
@@ -242,10 +250,10 @@ begin
     int_ena_set_reg_comp : memory_reg
     generic map(
         data_width                      => 16 ,
-        data_mask                       => "0000111111111111" ,
+        data_mask                       => "1111111111111111" ,
         reset_polarity                  => RESET_POLARITY ,
         reset_value                     => "0000000000000000" ,
-        auto_clear                      => "0000111111111111" ,
+        auto_clear                      => "1111111111111111" ,
         is_lockable                     => false 
     )
     port map(
@@ -266,10 +274,10 @@ begin
     int_ena_clr_reg_comp : memory_reg
     generic map(
         data_width                      => 16 ,
-        data_mask                       => "0000111111111111" ,
+        data_mask                       => "1111111111111111" ,
         reset_polarity                  => RESET_POLARITY ,
         reset_value                     => "0000000000000000" ,
-        auto_clear                      => "0000111111111111" ,
+        auto_clear                      => "1111111111111111" ,
         is_lockable                     => false 
     )
     port map(
@@ -290,10 +298,10 @@ begin
     int_mask_set_reg_comp : memory_reg
     generic map(
         data_width                      => 16 ,
-        data_mask                       => "0000111111111111" ,
+        data_mask                       => "1111111111111111" ,
         reset_polarity                  => RESET_POLARITY ,
         reset_value                     => "0000000000000000" ,
-        auto_clear                      => "0000111111111111" ,
+        auto_clear                      => "1111111111111111" ,
         is_lockable                     => false 
     )
     port map(
@@ -314,10 +322,10 @@ begin
     int_mask_clr_reg_comp : memory_reg
     generic map(
         data_width                      => 16 ,
-        data_mask                       => "0000111111111111" ,
+        data_mask                       => "1111111111111111" ,
         reset_polarity                  => RESET_POLARITY ,
         reset_value                     => "0000000000000000" ,
-        auto_clear                      => "0000111111111111" ,
+        auto_clear                      => "1111111111111111" ,
         is_lockable                     => false 
     )
     port map(
@@ -730,7 +738,7 @@ begin
     rx_settings_reg_comp : memory_reg
     generic map(
         data_width                      => 8 ,
-        data_mask                       => "00000001" ,
+        data_mask                       => "00000111" ,
         reset_polarity                  => RESET_POLARITY ,
         reset_value                     => "00000000" ,
         auto_clear                      => "00000000" ,
@@ -843,6 +851,588 @@ begin
         reg_value                       => control_registers_out_i.ssp_cfg -- out
     );
 
+    ----------------------------------------------------------------------------
+    -- TIMESTAMP_LOW access signallization
+    ----------------------------------------------------------------------------
+
+    timestamp_low_access_signaller_comp : access_signaller
+    generic map(
+        reset_polarity                  => RESET_POLARITY ,
+        data_width                      => 32 ,
+        read_signalling                 => True ,
+        write_signalling                => False ,
+        read_signalling_reg             => False ,
+        write_signalling_reg            => False 
+    )
+    port map(
+        clk_sys                         => clk_sys ,-- in
+        res_n                           => res_n ,-- in
+        cs                              => reg_sel(37) ,-- in
+        read                            => read ,-- in
+        write                           => write ,-- in
+        be                              => be(3 downto 0) ,-- in
+        write_signal                    => open ,-- out
+        read_signal                     => control_registers_out_i.timestamp_low_read -- out
+    );
+
+    ----------------------------------------------------------------------------
+    -- FILTER_SET_CTRL register
+    ----------------------------------------------------------------------------
+    FILTER_SET_CTRL_present_gen_t : if (SUP_FILT_SET = true) generate
+
+    filter_set_ctrl_reg_comp : memory_reg
+    generic map(
+        data_width                      => 16 ,
+        data_mask                       => "0000000000001111" ,
+        reset_polarity                  => RESET_POLARITY ,
+        reset_value                     => "0000000000000000" ,
+        auto_clear                      => "0000000000000000" ,
+        is_lockable                     => false 
+    )
+    port map(
+        clk_sys                         => clk_sys ,-- in
+        res_n                           => res_n ,-- in
+        data_in                         => w_data(15 downto 0) ,-- in
+        write                           => write ,-- in
+        cs                              => reg_sel(39) ,-- in
+        w_be                            => be(1 downto 0) ,-- in
+        lock                            => '0' ,-- in
+        reg_value                       => control_registers_out_i.filter_set_ctrl -- out
+    );
+
+    end generate FILTER_SET_CTRL_present_gen_t;
+
+    FILTER_SET_CTRL_present_gen_f : if (SUP_FILT_SET = false) generate
+        control_registers_out_i.filter_set_ctrl <= "0000000000000000";
+    end generate FILTER_SET_CTRL_present_gen_f;
+
+    ----------------------------------------------------------------------------
+    -- FILTER_SET_ADDR register
+    ----------------------------------------------------------------------------
+    FILTER_SET_ADDR_present_gen_t : if (SUP_FILT_SET = true) generate
+
+    filter_set_addr_reg_comp : memory_reg
+    generic map(
+        data_width                      => 16 ,
+        data_mask                       => "1000001111111111" ,
+        reset_polarity                  => RESET_POLARITY ,
+        reset_value                     => "0000000000000000" ,
+        auto_clear                      => "0000000000000000" ,
+        is_lockable                     => false 
+    )
+    port map(
+        clk_sys                         => clk_sys ,-- in
+        res_n                           => res_n ,-- in
+        data_in                         => w_data(15 downto 0) ,-- in
+        write                           => write ,-- in
+        cs                              => reg_sel(40) ,-- in
+        w_be                            => be(1 downto 0) ,-- in
+        lock                            => '0' ,-- in
+        reg_value                       => control_registers_out_i.filter_set_addr -- out
+    );
+
+    end generate FILTER_SET_ADDR_present_gen_t;
+
+    FILTER_SET_ADDR_present_gen_f : if (SUP_FILT_SET = false) generate
+        control_registers_out_i.filter_set_addr <= "0000000000000000";
+    end generate FILTER_SET_ADDR_present_gen_f;
+
+    ----------------------------------------------------------------------------
+    -- FILTER_SET_DATA register
+    ----------------------------------------------------------------------------
+    FILTER_SET_DATA_present_gen_t : if (SUP_FILT_SET = true) generate
+
+    filter_set_data_reg_comp : memory_reg
+    generic map(
+        data_width                      => 32 ,
+        data_mask                       => "11111111111111111111111111111111" ,
+        reset_polarity                  => RESET_POLARITY ,
+        reset_value                     => "00000000000000000000000000000000" ,
+        auto_clear                      => "00000000000000000000000000000000" ,
+        is_lockable                     => false 
+    )
+    port map(
+        clk_sys                         => clk_sys ,-- in
+        res_n                           => res_n ,-- in
+        data_in                         => w_data(31 downto 0) ,-- in
+        write                           => write ,-- in
+        cs                              => reg_sel(41) ,-- in
+        w_be                            => be(3 downto 0) ,-- in
+        lock                            => '0' ,-- in
+        reg_value                       => control_registers_out_i.filter_set_data -- out
+    );
+
+    end generate FILTER_SET_DATA_present_gen_t;
+
+    FILTER_SET_DATA_present_gen_f : if (SUP_FILT_SET = false) generate
+        control_registers_out_i.filter_set_data <= "00000000000000000000000000000000";
+    end generate FILTER_SET_DATA_present_gen_f;
+
+    ----------------------------------------------------------------------------
+    -- FILTER_SET_DATA access signallization
+    ----------------------------------------------------------------------------
+    FILTER_SET_DATA_signal_gen_t : if (SUP_FILT_SET = true) generate
+
+    filter_set_data_access_signaller_comp : access_signaller
+    generic map(
+        reset_polarity                  => RESET_POLARITY ,
+        data_width                      => 32 ,
+        read_signalling                 => False ,
+        write_signalling                => True ,
+        read_signalling_reg             => False ,
+        write_signalling_reg            => True 
+    )
+    port map(
+        clk_sys                         => clk_sys ,-- in
+        res_n                           => res_n ,-- in
+        cs                              => reg_sel(41) ,-- in
+        read                            => read ,-- in
+        write                           => write ,-- in
+        be                              => be(3 downto 0) ,-- in
+        write_signal                    => control_registers_out_i.filter_set_data_write ,-- out
+        read_signal                     => open -- out
+    );
+
+    end generate FILTER_SET_DATA_signal_gen_t;
+
+    FILTER_SET_DATA_signal_gen_f : if (SUP_FILT_SET = false) generate
+        control_registers_out_i.filter_set_data_write <= '0';
+    end generate FILTER_SET_DATA_signal_gen_f;
+
+    ----------------------------------------------------------------------------
+    -- RX_DMA_CTRL register
+    ----------------------------------------------------------------------------
+    RX_DMA_CTRL_present_gen_t : if (SUP_RX_DMA = true) generate
+
+    rx_dma_ctrl_reg_comp : memory_reg
+    generic map(
+        data_width                      => 32 ,
+        data_mask                       => "11111111111111111111111111110001" ,
+        reset_polarity                  => RESET_POLARITY ,
+        reset_value                     => "00000000000000000000000000000000" ,
+        auto_clear                      => "00000000000000000000000000000000" ,
+        is_lockable                     => false 
+    )
+    port map(
+        clk_sys                         => clk_sys ,-- in
+        res_n                           => res_n ,-- in
+        data_in                         => w_data(31 downto 0) ,-- in
+        write                           => write ,-- in
+        cs                              => reg_sel(43) ,-- in
+        w_be                            => be(3 downto 0) ,-- in
+        lock                            => '0' ,-- in
+        reg_value                       => control_registers_out_i.rx_dma_ctrl -- out
+    );
+
+    end generate RX_DMA_CTRL_present_gen_t;
+
+    RX_DMA_CTRL_present_gen_f : if (SUP_RX_DMA = false) generate
+        control_registers_out_i.rx_dma_ctrl <= "00000000000000000000000000000000";
+    end generate RX_DMA_CTRL_present_gen_f;
+
+    ----------------------------------------------------------------------------
+    -- RX_DMA_BASE register
+    ----------------------------------------------------------------------------
+    RX_DMA_BASE_present_gen_t : if (SUP_RX_DMA = true) generate
+
+    rx_dma_base_reg_comp : memory_reg
+    generic map(
+        data_width                      => 32 ,
+        data_mask                       => "11111111111111111111111110000000" ,
+        reset_polarity                  => RESET_POLARITY ,
+        reset_value                     => "00000000000000000000000000000000" ,
+        auto_clear                      => "00000000000000000000000000000000" ,
+        is_lockable                     => false 
+    )
+    port map(
+        clk_sys                         => clk_sys ,-- in
+        res_n                           => res_n ,-- in
+        data_in                         => w_data(31 downto 0) ,-- in
+        write                           => write ,-- in
+        cs                              => reg_sel(44) ,-- in
+        w_be                            => be(3 downto 0) ,-- in
+        lock                            => '0' ,-- in
+        reg_value                       => control_registers_out_i.rx_dma_base -- out
+    );
+
+    end generate RX_DMA_BASE_present_gen_t;
+
+    RX_DMA_BASE_present_gen_f : if (SUP_RX_DMA = false) generate
+        control_registers_out_i.rx_dma_base <= "00000000000000000000000000000000";
+    end generate RX_DMA_BASE_present_gen_f;
+
+    ----------------------------------------------------------------------------
+    -- RX_DMA_CONS register
+    ----------------------------------------------------------------------------
+    RX_DMA_CONS_present_gen_t : if (SUP_RX_DMA = true) generate
+
+    rx_dma_cons_reg_comp : memory_reg
+    generic map(
+        data_width                      => 16 ,
+        data_mask                       => "0000111111111111" ,
+        reset_polarity                  => RESET_POLARITY ,
+        reset_value                     => "0000000000000000" ,
+        auto_clear                      => "0000000000000000" ,
+        is_lockable                     => false 
+    )
+    port map(
+        clk_sys                         => clk_sys ,-- in
+        res_n                           => res_n ,-- in
+        data_in                         => w_data(15 downto 0) ,-- in
+        write                           => write ,-- in
+        cs                              => reg_sel(45) ,-- in
+        w_be                            => be(1 downto 0) ,-- in
+        lock                            => '0' ,-- in
+        reg_value                       => control_registers_out_i.rx_dma_cons -- out
+    );
+
+    end generate RX_DMA_CONS_present_gen_t;
+
+    RX_DMA_CONS_present_gen_f : if (SUP_RX_DMA = false) generate
+        control_registers_out_i.rx_dma_cons <= "0000000000000000";
+    end generate RX_DMA_CONS_present_gen_f;
+
+    ----------------------------------------------------------------------------
+    -- TX_FIFO_CTRL register
+    ----------------------------------------------------------------------------
+    TX_FIFO_CTRL_present_gen_t : if (SUP_TX_FIFO = true) generate
+
+    tx_fifo_ctrl_reg_comp : memory_reg
+    generic map(
+        data_width                      => 16 ,
+        data_mask                       => "0000000001111111" ,
+        reset_polarity                  => RESET_POLARITY ,
+        reset_value                     => "0000000000000000" ,
+        auto_clear                      => "0000000000000000" ,
+        is_lockable                     => false 
+    )
+    port map(
+        clk_sys                         => clk_sys ,-- in
+        res_n                           => res_n ,-- in
+        data_in                         => w_data(15 downto 0) ,-- in
+        write                           => write ,-- in
+        cs                              => reg_sel(47) ,-- in
+        w_be                            => be(1 downto 0) ,-- in
+        lock                            => '0' ,-- in
+        reg_value                       => control_registers_out_i.tx_fifo_ctrl -- out
+    );
+
+    end generate TX_FIFO_CTRL_present_gen_t;
+
+    TX_FIFO_CTRL_present_gen_f : if (SUP_TX_FIFO = false) generate
+        control_registers_out_i.tx_fifo_ctrl <= "0000000000000000";
+    end generate TX_FIFO_CTRL_present_gen_f;
+
+    ----------------------------------------------------------------------------
+    -- INT_TS_SEL register
+    ----------------------------------------------------------------------------
+    INT_TS_SEL_present_gen_t : if (SUP_INT_TS = true) generate
+
+    int_ts_sel_reg_comp : memory_reg
+    generic map(
+        data_width                      => 32 ,
+        data_mask                       => "00000000000000000000000000001111" ,
+        reset_polarity                  => RESET_POLARITY ,
+        reset_value                     => "00000000000000000000000000000000" ,
+        auto_clear                      => "00000000000000000000000000000000" ,
+        is_lockable                     => false 
+    )
+    port map(
+        clk_sys                         => clk_sys ,-- in
+        res_n                           => res_n ,-- in
+        data_in                         => w_data(31 downto 0) ,-- in
+        write                           => write ,-- in
+        cs                              => reg_sel(48) ,-- in
+        w_be                            => be(3 downto 0) ,-- in
+        lock                            => '0' ,-- in
+        reg_value                       => control_registers_out_i.int_ts_sel -- out
+    );
+
+    end generate INT_TS_SEL_present_gen_t;
+
+    INT_TS_SEL_present_gen_f : if (SUP_INT_TS = false) generate
+        control_registers_out_i.int_ts_sel <= "00000000000000000000000000000000";
+    end generate INT_TS_SEL_present_gen_f;
+
+    ----------------------------------------------------------------------------
+    -- BUS_STAT_SEL register
+    ----------------------------------------------------------------------------
+    BUS_STAT_SEL_present_gen_t : if (SUP_TRAFFIC_CTRS = true) generate
+
+    bus_stat_sel_reg_comp : memory_reg
+    generic map(
+        data_width                      => 32 ,
+        data_mask                       => "00000000000000000000000000000111" ,
+        reset_polarity                  => RESET_POLARITY ,
+        reset_value                     => "00000000000000000000000000000000" ,
+        auto_clear                      => "00000000000000000000000000000000" ,
+        is_lockable                     => false 
+    )
+    port map(
+        clk_sys                         => clk_sys ,-- in
+        res_n                           => res_n ,-- in
+        data_in                         => w_data(31 downto 0) ,-- in
+        write                           => write ,-- in
+        cs                              => reg_sel(50) ,-- in
+        w_be                            => be(3 downto 0) ,-- in
+        lock                            => '0' ,-- in
+        reg_value                       => control_registers_out_i.bus_stat_sel -- out
+    );
+
+    end generate BUS_STAT_SEL_present_gen_t;
+
+    BUS_STAT_SEL_present_gen_f : if (SUP_TRAFFIC_CTRS = false) generate
+        control_registers_out_i.bus_stat_sel <= "00000000000000000000000000000000";
+    end generate BUS_STAT_SEL_present_gen_f;
+
+    ----------------------------------------------------------------------------
+    -- TXTB_TS_SEL register
+    ----------------------------------------------------------------------------
+    TXTB_TS_SEL_present_gen_t : if (SUP_TX_TS = true) generate
+
+    txtb_ts_sel_reg_comp : memory_reg
+    generic map(
+        data_width                      => 32 ,
+        data_mask                       => "00000000000000000000000000000111" ,
+        reset_polarity                  => RESET_POLARITY ,
+        reset_value                     => "00000000000000000000000000000000" ,
+        auto_clear                      => "00000000000000000000000000000000" ,
+        is_lockable                     => false 
+    )
+    port map(
+        clk_sys                         => clk_sys ,-- in
+        res_n                           => res_n ,-- in
+        data_in                         => w_data(31 downto 0) ,-- in
+        write                           => write ,-- in
+        cs                              => reg_sel(52) ,-- in
+        w_be                            => be(3 downto 0) ,-- in
+        lock                            => '0' ,-- in
+        reg_value                       => control_registers_out_i.txtb_ts_sel -- out
+    );
+
+    end generate TXTB_TS_SEL_present_gen_t;
+
+    TXTB_TS_SEL_present_gen_f : if (SUP_TX_TS = false) generate
+        control_registers_out_i.txtb_ts_sel <= "00000000000000000000000000000000";
+    end generate TXTB_TS_SEL_present_gen_f;
+
+    ----------------------------------------------------------------------------
+    -- TS_INC register
+    ----------------------------------------------------------------------------
+    TS_INC_present_gen_t : if (SUP_TS_GEN = true) generate
+
+    ts_inc_reg_comp : memory_reg
+    generic map(
+        data_width                      => 32 ,
+        data_mask                       => "11111111111111111111111111111111" ,
+        reset_polarity                  => RESET_POLARITY ,
+        reset_value                     => "00000001000000000000000000000000" ,
+        auto_clear                      => "00000000000000000000000000000000" ,
+        is_lockable                     => false 
+    )
+    port map(
+        clk_sys                         => clk_sys ,-- in
+        res_n                           => res_n ,-- in
+        data_in                         => w_data(31 downto 0) ,-- in
+        write                           => write ,-- in
+        cs                              => reg_sel(55) ,-- in
+        w_be                            => be(3 downto 0) ,-- in
+        lock                            => '0' ,-- in
+        reg_value                       => control_registers_out_i.ts_inc -- out
+    );
+
+    end generate TS_INC_present_gen_t;
+
+    TS_INC_present_gen_f : if (SUP_TS_GEN = false) generate
+        control_registers_out_i.ts_inc <= "00000001000000000000000000000000";
+    end generate TS_INC_present_gen_f;
+
+    ----------------------------------------------------------------------------
+    -- TS_STEP_LOW register
+    ----------------------------------------------------------------------------
+    TS_STEP_LOW_present_gen_t : if (SUP_TS_GEN = true) generate
+
+    ts_step_low_reg_comp : memory_reg
+    generic map(
+        data_width                      => 32 ,
+        data_mask                       => "11111111111111111111111111111111" ,
+        reset_polarity                  => RESET_POLARITY ,
+        reset_value                     => "00000000000000000000000000000000" ,
+        auto_clear                      => "00000000000000000000000000000000" ,
+        is_lockable                     => false 
+    )
+    port map(
+        clk_sys                         => clk_sys ,-- in
+        res_n                           => res_n ,-- in
+        data_in                         => w_data(31 downto 0) ,-- in
+        write                           => write ,-- in
+        cs                              => reg_sel(56) ,-- in
+        w_be                            => be(3 downto 0) ,-- in
+        lock                            => '0' ,-- in
+        reg_value                       => control_registers_out_i.ts_step_low -- out
+    );
+
+    end generate TS_STEP_LOW_present_gen_t;
+
+    TS_STEP_LOW_present_gen_f : if (SUP_TS_GEN = false) generate
+        control_registers_out_i.ts_step_low <= "00000000000000000000000000000000";
+    end generate TS_STEP_LOW_present_gen_f;
+
+    ----------------------------------------------------------------------------
+    -- TS_STEP_HIGH register
+    ----------------------------------------------------------------------------
+    TS_STEP_HIGH_present_gen_t : if (SUP_TS_GEN = true) generate
+
+    ts_step_high_reg_comp : memory_reg
+    generic map(
+        data_width                      => 32 ,
+        data_mask                       => "11111111111111111111111111111111" ,
+        reset_polarity                  => RESET_POLARITY ,
+        reset_value                     => "00000000000000000000000000000000" ,
+        auto_clear                      => "00000000000000000000000000000000" ,
+        is_lockable                     => false 
+    )
+    port map(
+        clk_sys                         => clk_sys ,-- in
+        res_n                           => res_n ,-- in
+        data_in                         => w_data(31 downto 0) ,-- in
+        write                           => write ,-- in
+        cs                              => reg_sel(57) ,-- in
+        w_be                            => be(3 downto 0) ,-- in
+        lock                            => '0' ,-- in
+        reg_value                       => control_registers_out_i.ts_step_high -- out
+    );
+
+    end generate TS_STEP_HIGH_present_gen_t;
+
+    TS_STEP_HIGH_present_gen_f : if (SUP_TS_GEN = false) generate
+        control_registers_out_i.ts_step_high <= "00000000000000000000000000000000";
+    end generate TS_STEP_HIGH_present_gen_f;
+
+    ----------------------------------------------------------------------------
+    -- TXT_CYC_SEL register
+    ----------------------------------------------------------------------------
+    TXT_CYC_SEL_present_gen_t : if (SUP_TXT_CYC = true) generate
+
+    txt_cyc_sel_reg_comp : memory_reg
+    generic map(
+        data_width                      => 16 ,
+        data_mask                       => "0000000000000111" ,
+        reset_polarity                  => RESET_POLARITY ,
+        reset_value                     => "0000000000000000" ,
+        auto_clear                      => "0000000000000000" ,
+        is_lockable                     => false 
+    )
+    port map(
+        clk_sys                         => clk_sys ,-- in
+        res_n                           => res_n ,-- in
+        data_in                         => w_data(15 downto 0) ,-- in
+        write                           => write ,-- in
+        cs                              => reg_sel(60) ,-- in
+        w_be                            => be(1 downto 0) ,-- in
+        lock                            => '0' ,-- in
+        reg_value                       => control_registers_out_i.txt_cyc_sel -- out
+    );
+
+    end generate TXT_CYC_SEL_present_gen_t;
+
+    TXT_CYC_SEL_present_gen_f : if (SUP_TXT_CYC = false) generate
+        control_registers_out_i.txt_cyc_sel <= "0000000000000000";
+    end generate TXT_CYC_SEL_present_gen_f;
+
+    ----------------------------------------------------------------------------
+    -- TXT_CYC_PERIOD register
+    ----------------------------------------------------------------------------
+    TXT_CYC_PERIOD_present_gen_t : if (SUP_TXT_CYC = true) generate
+
+    txt_cyc_period_reg_comp : memory_reg
+    generic map(
+        data_width                      => 32 ,
+        data_mask                       => "11111111111111111111111111111111" ,
+        reset_polarity                  => RESET_POLARITY ,
+        reset_value                     => "00000000000000000000000000000000" ,
+        auto_clear                      => "00000000000000000000000000000000" ,
+        is_lockable                     => false 
+    )
+    port map(
+        clk_sys                         => clk_sys ,-- in
+        res_n                           => res_n ,-- in
+        data_in                         => w_data(31 downto 0) ,-- in
+        write                           => write ,-- in
+        cs                              => reg_sel(61) ,-- in
+        w_be                            => be(3 downto 0) ,-- in
+        lock                            => '0' ,-- in
+        reg_value                       => control_registers_out_i.txt_cyc_period -- out
+    );
+
+    end generate TXT_CYC_PERIOD_present_gen_t;
+
+    TXT_CYC_PERIOD_present_gen_f : if (SUP_TXT_CYC = false) generate
+        control_registers_out_i.txt_cyc_period <= "00000000000000000000000000000000";
+    end generate TXT_CYC_PERIOD_present_gen_f;
+
+    ----------------------------------------------------------------------------
+    -- TXT_CYC_PERIOD access signallization
+    ----------------------------------------------------------------------------
+    TXT_CYC_PERIOD_signal_gen_t : if (SUP_TXT_CYC = true) generate
+
+    txt_cyc_period_access_signaller_comp : access_signaller
+    generic map(
+        reset_polarity                  => RESET_POLARITY ,
+        data_width                      => 32 ,
+        read_signalling                 => False ,
+        write_signalling                => True ,
+        read_signalling_reg             => False ,
+        write_signalling_reg            => True 
+    )
+    port map(
+        clk_sys                         => clk_sys ,-- in
+        res_n                           => res_n ,-- in
+        cs                              => reg_sel(61) ,-- in
+        read                            => read ,-- in
+        write                           => write ,-- in
+        be                              => be(3 downto 0) ,-- in
+        write_signal                    => control_registers_out_i.txt_cyc_period_write ,-- out
+        read_signal                     => open -- out
+    );
+
+    end generate TXT_CYC_PERIOD_signal_gen_t;
+
+    TXT_CYC_PERIOD_signal_gen_f : if (SUP_TXT_CYC = false) generate
+        control_registers_out_i.txt_cyc_period_write <= '0';
+    end generate TXT_CYC_PERIOD_signal_gen_f;
+
+    ----------------------------------------------------------------------------
+    -- TX_CPL access signallization
+    ----------------------------------------------------------------------------
+    TX_CPL_signal_gen_t : if (SUP_TX_CPL = true) generate
+
+    tx_cpl_access_signaller_comp : access_signaller
+    generic map(
+        reset_polarity                  => RESET_POLARITY ,
+        data_width                      => 32 ,
+        read_signalling                 => True ,
+        write_signalling                => False ,
+        read_signalling_reg             => False ,
+        write_signalling_reg            => False 
+    )
+    port map(
+        clk_sys                         => clk_sys ,-- in
+        res_n                           => res_n ,-- in
+        cs                              => reg_sel(63) ,-- in
+        read                            => read ,-- in
+        write                           => write ,-- in
+        be                              => be(3 downto 0) ,-- in
+        write_signal                    => open ,-- out
+        read_signal                     => control_registers_out_i.tx_cpl_read -- out
+    );
+
+    end generate TX_CPL_signal_gen_t;
+
+    TX_CPL_signal_gen_f : if (SUP_TX_CPL = false) generate
+        control_registers_out_i.tx_cpl_read <= '0';
+    end generate TX_CPL_signal_gen_f;
+
     ----------------------------------------------------------------------------
     -- Read data multiplexor enable 
     ----------------------------------------------------------------------------
@@ -861,7 +1451,7 @@ begin
     data_mux_control_registers_comp : data_mux
     generic map(
         data_out_width                  => 32 ,
-        data_in_width                   => 1248 ,
+        data_in_width                   => 2048 ,
         sel_width                       => 6 ,
         registered_out                  => REGISTERED_READ ,
         reset_polarity                  => RESET_POLARITY 
@@ -880,6 +1470,81 @@ begin
   -- Read data driver
   ------------------------------------------------------------------------------
   read_data_mux_in <=
+    -- Adress:252
+    control_registers_in.tx_cpl &
+
+    -- Adress:248
+    control_registers_in.tx_cpl_ts &
+
+    -- Adress:244
+    control_registers_out_i.txt_cyc_period &
+
+    -- Adress:240
+    control_registers_in.txt_cyc_skip & control_registers_out_i.txt_cyc_sel &
+
+    -- Adress:236
+    control_registers_in.rx_peek_idw &
+
+    -- Adress:232
+    control_registers_in.rx_peek_ffw &
+
+    -- Adress:228
+    control_registers_out_i.ts_step_high &
+
+    -- Adress:224
+    control_registers_out_i.ts_step_low &
+
+    -- Adress:220
+    control_registers_out_i.ts_inc &
+
+    -- Adress:216
+    control_registers_in.txtb_ts_high &
+
+    -- Adress:212
+    control_registers_in.txtb_ts_low &
+
+    -- Adress:208
+    control_registers_out_i.txtb_ts_sel &
+
+    -- Adress:204
+    control_registers_in.bus_stat &
+
+    -- Adress:200
+    control_registers_out_i.bus_stat_sel &
+
+    -- Adress:196
+    control_registers_in.int_ts &
+
+    -- Adress:192
+    control_registers_out_i.int_ts_sel &
+
+    -- Adress:188
+    control_registers_in.tx_fifo_status & control_registers_out_i.tx_fifo_ctrl &
+
+    -- Adress:184
+    control_registers_in.rx_dma_status &
+
+    -- Adress:180
+    "00000000" & "00000000" & control_registers_out_i.rx_dma_cons &
+
+    -- Adress:176
+    control_registers_out_i.rx_dma_base &
+
+    -- Adress:172
+    control_registers_out_i.rx_dma_ctrl &
+
+    -- Adress:168
+    control_registers_in.rx_drop_ctr &
+
+    -- Adress:164
+    control_registers_out_i.filter_set_data &
+
+    -- Adress:160
+    "00000000" & "00000000" & control_registers_out_i.filter_set_addr &
+
+    -- Adress:156
+    control_registers_in.filter_set_info & control_registers_out_i.filter_set_ctrl &
+
     -- Adress:152
     control_registers_in.timestamp_high &
 
@@ -1229,6 +1894,135 @@ begin
     -- psl timestamp_high_read_access_cov : cover
     -- {((cs='1') and (read='1') and (reg_sel(38)='1') and ((be(0)='1') or (be(1)='1') or (be(2)='1') or (be(3)='1')))};
 
+    -- psl filter_set_ctrl_write_access_cov : cover
+    -- {((cs='1') and (write='1') and (reg_sel(39)='1') and ((be(0)='1') or (be(1)='1')))};
+
+    -- psl filter_set_ctrl_read_access_cov : cover
+    -- {((cs='1') and (read='1') and (reg_sel(39)='1') and ((be(0)='1') or (be(1)='1')))};
+
+    -- psl filter_set_info_read_access_cov : cover
+    -- {((cs='1') and (read='1') and (reg_sel(39)='1') and ((be(2)='1') or (be(3)='1')))};
+
+    -- psl filter_set_addr_write_access_cov : cover
+    -- {((cs='1') and (write='1') and (reg_sel(40)='1') and ((be(0)='1') or (be(1)='1')))};
+
+    -- psl filter_set_addr_read_access_cov : cover
+    -- {((cs='1') and (read='1') and (reg_sel(40)='1') and ((be(0)='1') or (be(1)='1')))};
+
+    -- psl filter_set_data_write_access_cov : cover
+    -- {((cs='1') and (write='1') and (reg_sel(41)='1') and ((be(0)='1') or (be(1)='1') or (be(2)='1') or (be(3)='1')))};
+
+    -- psl filter_set_data_read_access_cov : cover
+    -- {((cs='1') and (read='1') and (reg_sel(41)='1') and ((be(0)='1') or (be(1)='1') or (be(2)='1') or (be(3)='1')))};
+
+    -- psl rx_drop_ctr_read_access_cov : cover
+    -- {((cs='1') and (read='1') and (reg_sel(42)='1') and ((be(0)='1') or (be(1)='1') or (be(2)='1') or (be(3)='1')))};
+
+    -- psl rx_dma_ctrl_write_access_cov : cover
+    -- {((cs='1') and (write='1') and (reg_sel(43)='1') and ((be(0)='1') or (be(1)='1') or (be(2)='1') or (be(3)='1')))};
+
+    -- psl rx_dma_ctrl_read_access_cov : cover
+    -- {((cs='1') and (read='1') and (reg_sel(43)='1') and ((be(0)='1') or (be(1)='1') or (be(2)='1') or (be(3)='1')))};
+
+    -- psl rx_dma_base_write_access_cov : cover
+    -- {((cs='1') and (write='1') and (reg_sel(44)='1') and ((be(0)='1') or (be(1)='1') or (be(2)='1') or (be(3)='1')))};
+
+    -- psl rx_dma_base_read_access_cov : cover
+    -- {((cs='1') and (read='1') and (reg_sel(44)='1') and ((be(0)='1') or (be(1)='1') or (be(2)='1') or (be(3)='1')))};
+
+    -- psl rx_dma_cons_write_access_cov : cover
+    -- {((cs='1') and (write='1') and (reg_sel(45)='1') and ((be(0)='1') or (be(1)='1')))};
+
+    -- psl rx_dma_cons_read_access_cov : cover
+    -- {((cs='1') and (read='1') and (reg_sel(45)='1') and ((be(0)='1') or (be(1)='1')))};
+
+    -- psl rx_dma_status_read_access_cov : cover
+    -- {((cs='1') and (read='1') and (reg_sel(46)='1') and ((be(0)='1') or (be(1)='1') or (be(2)='1') or (be(3)='1')))};
+
+    -- psl tx_fifo_ctrl_write_access_cov : cover
+    -- {((cs='1') and (write='1') and (reg_sel(47)='1') and ((be(0)='1') or (be(1)='1')))};
+
+    -- psl tx_fifo_ctrl_read_access_cov : cover
+    -- {((cs='1') and (read='1') and (reg_sel(47)='1') and ((be(0)='1') or (be(1)='1')))};
+
+    -- psl tx_fifo_status_read_access_cov : cover
+    -- {((cs='1') and (read='1') and (reg_sel(47)='1') and ((be(2)='1') or (be(3)='1')))};
+
+    -- psl int_ts_sel_write_access_cov : cover
+    -- {((cs='1') and (write='1') and (reg_sel(48)='1') and ((be(0)='1') or (be(1)='1') or (be(2)='1') or (be(3)='1')))};
+
+    -- psl int_ts_sel_read_access_cov : cover
+    -- {((cs='1') and (read='1') and (reg_sel(48)='1') and ((be(0)='1') or (be(1)='1') or (be(2)='1') or (be(3)='1')))};
+
+    -- psl int_ts_read_access_cov : cover
+    -- {((cs='1') and (read='1') and (reg_sel(49)='1') and ((be(0)='1') or (be(1)='1') or (be(2)='1') or (be(3)='1')))};
+
+    -- psl bus_stat_sel_write_access_cov : cover
+    -- {((cs='1') and (write='1') and (reg_sel(50)='1') and ((be(0)='1') or (be(1)='1') or (be(2)='1') or (be(3)='1')))};
+
+    -- psl bus_stat_sel_read_access_cov : cover
+    -- {((cs='1') and (read='1') and (reg_sel(50)='1') and ((be(0)='1') or (be(1)='1') or (be(2)='1') or (be(3)='1')))};
+
+    -- psl bus_stat_read_access_cov : cover
+    -- {((cs='1') and (read='1') and (reg_sel(51)='1') and ((be(0)='1') or (be(1)='1') or (be(2)='1') or (be(3)='1')))};
+
+    -- psl txtb_ts_sel_write_access_cov : cover
+    -- {((cs='1') and (write='1') and (reg_sel(52)='1') and ((be(0)='1') or (be(1)='1') or (be(2)='1') or (be(3)='1')))};
+
+    -- psl txtb_ts_sel_read_access_cov : cover
+    -- {((cs='1') and (read='1') and (reg_sel(52)='1') and ((be(0)='1') or (be(1)='1') or (be(2)='1') or (be(3)='1')))};
+
+    -- psl txtb_ts_low_read_access_cov : cover
+    -- {((cs='1') and (read='1') and (reg_sel(53)='1') and ((be(0)='1') or (be(1)='1') or (be(2)='1') or (be(3)='1')))};
+
+    -- psl txtb_ts_high_read_access_cov : cover
+    -- {((cs='1') and (read='1') and (reg_sel(54)='1') and ((be(0)='1') or (be(1)='1') or (be(2)='1') or (be(3)='1')))};
+
+    -- psl ts_inc_write_access_cov : cover
+    -- {((cs='1') and (write='1') and (reg_sel(55)='1') and ((be(0)='1') or (be(1)='1') or (be(2)='1') or (be(3)='1')))};
+
+    -- psl ts_inc_read_access_cov : cover
+    -- {((cs='1') and (read='1') and (reg_sel(55)='1') and ((be(0)='1') or (be(1)='1') or (be(2)='1') or (be(3)='1')))};
+
+    -- psl ts_step_low_write_access_cov : cover
+    -- {((cs='1') and (write='1') and (reg_sel(56)='1') and ((be(0)='1') or (be(1)='1') or (be(2)='1') or (be(3)='1')))};
+
+    -- psl ts_step_low_read_access_cov : cover
+    -- {((cs='1') and (read='1') and (reg_sel(56)='1') and ((be(0)='1') or (be(1)='1') or (be(2)='1') or (be(3)='1')))};
+
+    -- psl ts_step_high_write_access_cov : cover
+    -- {((cs='1') and (write='1') and (reg_sel(57)='1') and ((be(0)='1') or (be(1)='1') or (be(2)='1') or (be(3)='1')))};
+
+    -- psl ts_step_high_read_access_cov : cover
+    -- {((cs='1') and (read='1') and (reg_sel(57)='1') and ((be(0)='1') or (be(1)='1') or (be(2)='1') or (be(3)='1')))};
+
+    -- psl rx_peek_ffw_read_access_cov : cover
+    -- {((cs='1') and (read='1') and (reg_sel(58)='1') and ((be(0)='1') or (be(1)='1') or (be(2)='1') or (be(3)='1')))};
+
+    -- psl rx_peek_idw_read_access_cov : cover
+    -- {((cs='1') and (read='1') and (reg_sel(59)='1') and ((be(0)='1') or (be(1)='1') or (be(2)='1') or (be(3)='1')))};
+
+    -- psl txt_cyc_sel_write_access_cov : cover
+    -- {((cs='1') and (write='1') and (reg_sel(60)='1') and ((be(0)='1') or (be(1)='1')))};
+
+    -- psl txt_cyc_sel_read_access_cov : cover
+    -- {((cs='1') and (read='1') and (reg_sel(60)='1') and ((be(0)='1') or (be(1)='1')))};
+
+    -- psl txt_cyc_skip_read_access_cov : cover
+    -- {((cs='1') and (read='1') and (reg_sel(60)='1') and ((be(2)='1') or (be(3)='1')))};
+
+    -- psl txt_cyc_period_write_access_cov : cover
+    -- {((cs='1') and (write='1') and (reg_sel(61)='1') and ((be(0)='1') or (be(1)='1') or (be(2)='1') or (be(3)='1')))};
+
+    -- psl txt_cyc_period_read_access_cov : cover
+    -- {((cs='1') and (read='1') and (reg_sel(61)='1') and ((be(0)='1') or (be(1)='1') or (be(2)='1') or (be(3)='1')))};
+
+    -- psl tx_cpl_ts_read_access_cov : cover
+    -- {((cs='1') and (read='1') and (reg_sel(62)='1') and ((be(0)='1') or (be(1)='1') or (be(2)='1') or (be(3)='1')))};
+
+    -- psl tx_cpl_read_access_cov : cover
+    -- {((cs='1') and (read='1') and (reg_sel(63)='1') and ((be(0)='1') or (be(1)='1') or (be(2)='1') or (be(3)='1')))};
+
     -- <RELEASE_ON>
 
 end architecture rtl;
@@ -108,6 +108,42 @@ entity memory_registers is
         -- Support Range Filter
         G_SUP_RANGE         : boolean                         := true;
 
+        -- Support ID set filter
+        G_SUP_FILT_SET      : boolean                         := true;
+
+        -- ID set filter - Hash table address width
+        G_FILT_SET_HASH_WIDTH : natural range 1 to 10         := 8;
+
+        -- ID set filter - Hash table probe length
+        G_FILT_SET_PROBE_LEN  : natural range 1 to 15         := 4;
+
+        -- Support RX DMA
+        G_SUP_RX_DMA        : boolean                         := true;
+
+        -- Support TXT FIFO
+        G_SUP_TX_FIFO       : boolean                         := true;
+
+        -- Number of frames in TXT FIFO
+        G_TX_FIFO_DEPTH     : natural range 2 to 64           := 16;
+
+        -- Support interrupt pending timestamps
+        G_SUP_INT_TS        : boolean                         := true;
+
+        -- Support TXT Buffer transmission start timestamps
+        G_SUP_TX_TS         : boolean                         := true;
+
+        -- Support internal timestamp generator
+        G_SUP_TS_GEN        : boolean                         := true;
+
+        -- Support cyclic transmission from TXT Buffers
+        G_SUP_TXT_CYC       : boolean                         := true;
+
+        -- Support TX completion FIFO
+        G_SUP_TX_CPL        : boolean                         := true;
+
+        -- Support Priority RX Buffer
+        G_SUP_RX_PRIO       : boolean                         := true;
+
         -- Support Test registers
         G_SUP_TEST_REGISTERS: boolean                         := true;
 
@@ -118,7 +154,7 @@ entity memory_registers is
         G_TXT_BUFFER_COUNT  : natural range 2 to 8            := 4;
 
         -- Number of Interrupts
-        G_INT_COUNT         : natural                         := 12;
+        G_INT_COUNT         : natural                         := 16;
 
         -- Width (number of bits) in transceiver delay measurement counter
         G_TRV_CTR_WIDTH     : natural                         := 7;
@@ -237,6 +273,57 @@ entity memory_registers is
         -- Middle of frame indication
         rx_mof               :in   std_logic;
 
+        -- Number of frames discarded to make room for received frames
+        rx_drop_ctr          :in   std_logic_vector(31 downto 0);
+
+        -- FRAME_FORMAT_W and IDENTIFIER_W of the oldest frame
+        rx_peek_ffw          :in   std_logic_vector(31 downto 0);
+        rx_peek_idw          :in   std_logic_vector(31 downto 0);
+
+        ------------------------------------------------------------------------
+        -- Priority RX Buffer Interface
+        ------------------------------------------------------------------------
+        -- Priority RX Buffer data output
+        rxp_read_buff        :in   std_logic_vector(31 downto 0);
+
+        -- Size of Priority RX buffer (in words)
+        rxp_buf_size         :in   std_logic_vector(12 downto 0);
+
+        -- Priority RX Buffer is full / empty
+        rxp_full             :in   std_logic;
+        rxp_empty            :in   std_logic;
+
+        -- Number of frames in Priority RX buffer
+        rxp_frame_count      :in   std_logic_vector(10 downto 0);
+
+        -- Number of free 32 bit words in Priority RX buffer
+        rxp_mem_free         :in   std_logic_vector(12 downto 0);
+
+        -- Priority RX Buffer data overrun Flag, middle of frame indication
+        rxp_data_overrun     :in   std_logic;
+        rxp_mof              :in   std_logic;
+
+        ------------------------------------------------------------------------
+        -- RX DMA status
+        ------------------------------------------------------------------------
+        -- Producer index of RX DMA ring
+        rx_dma_prod          :in   std_logic_vector(11 downto 0);
+
+        -- RX DMA is moving a frame
+        rx_dma_act           :in   std_logic;
+
+        -- RX DMA stopped on bus error
+        rx_dma_berr          :in   std_logic;
+
+        ------------------------------------------------------------------------
+        -- TXT FIFO status
+        ------------------------------------------------------------------------
+        -- Number of frames in TXT FIFO
+        tx_fifo_fill         :in   std_logic_vector(6 downto 0);
+
+        -- TXT FIFO is full
+        tx_fifo_full         :in   std_logic;
+
         ------------------------------------------------------------------------
         -- Interface to TXT Buffers
         ------------------------------------------------------------------------
@@ -255,6 +342,20 @@ entity memory_registers is
         -- TXT Buffer status
         txtb_state           :in   t_txt_bufs_state(G_TXT_BUFFER_COUNT - 1 downto 0);
 
+        -- Skipped cyclic slots of TXT Buffers
+        txtb_cyc_skip        :in   t_txt_bufs_cyc_skip(G_TXT_BUFFER_COUNT - 1 downto 0);
+
+        -- TX completion FIFO - oldest record
+        tx_cpl_index         :in   std_logic_vector(2 downto 0);
+        tx_cpl_state         :in   std_logic_vector(3 downto 0);
+        tx_cpl_retr_ctr      :in   std_logic_vector(3 downto 0);
+        tx_cpl_ts            :in   std_logic_vector(31 downto 0);
+
+        -- TX completion FIFO - number of records, overflow, not empty
+        tx_cpl_count         :in   std_logic_vector(4 downto 0);
+        tx_cpl_overflow      :in   std_logic;
+        tx_cpl_valid         :in   std_logic;
+
         -- SW Commands to TXT Buffer
         txtb_sw_cmd          :out  t_txtb_sw_cmd;
         
@@ -283,7 +384,31 @@ entity memory_registers is
         int_ena              :in   std_logic_vector(G_INT_COUNT - 1 downto 0);
         
         -- Interrupt mask
-        int_mask             :in   std_logic_vector(G_INT_COUNT - 1 downto 0)
+        int_mask             :in   std_logic_vector(G_INT_COUNT - 1 downto 0);
+
+        -- Pending timestamp of interrupt selected by INT_TS_SEL
+        int_ts               :in   std_logic_vector(31 downto 0);
+
+        ------------------------------------------------------------------------
+        -- TX Arbitrator Interface
+        ------------------------------------------------------------------------
+        -- Transmission start timestamp of TXT Buffer selected by TXTB_TS_SEL
+        txtb_ts              :in   std_logic_vector(63 downto 0);
+
+        ------------------------------------------------------------------------
+        -- Timestamp generator Interface
+        ------------------------------------------------------------------------
+        -- Increment per clock cycle (TS_INC)
+        ts_inc               :out  std_logic_vector(31 downto 0);
+
+        -- Step / set value (TS_STEP_HIGH & TS_STEP_LOW)
+        ts_step              :out  std_logic_vector(63 downto 0);
+
+        -- Step timestamp by "ts_step" (COMMAND[TSSTEP])
+        ts_step_cmd          :out  std_logic;
+
+        -- Set timestamp to "ts_step" (COMMAND[TSSET])
+        ts_set_cmd           :out  std_logic
     );  
 end entity;
 
@@ -317,10 +442,18 @@ architecture rtl of memory_registers is
     
     signal test_registers_cs          : std_logic;
     signal test_registers_cs_reg      : std_logic;
+
+    signal rx_data_window_cs          : std_logic;
+    signal rx_data_window_cs_reg      : std_logic;
+
+    signal rx_prio_buffer_cs          : std_logic;
+    signal rx_prio_buffer_cs_reg      : std_logic;
     
     -- Read data from generated register modules
     signal control_registers_rdata    : std_logic_vector(31 downto 0);
     signal test_registers_rdata       : std_logic_vector(31 downto 0);
+    signal rx_data_window_rdata       : std_logic_vector(31 downto 0);
+    signal rx_prio_buffer_rdata       : std_logic_vector(31 downto 0);
    
     -- Fault confinement State Indication
     signal is_err_active          :     std_logic;
@@ -351,9 +484,22 @@ architecture rtl of memory_registers is
     -- RX buffer control signals
     signal rx_buf_mode : std_logic;
     signal rx_move_cmd : std_logic;
+    signal rx_dma_ena  : std_logic;
+    signal rx_data_read : std_logic;
+    signal rx_window_read : std_logic;
+
+    -- Priority RX Buffer registers
+    signal rxp_ctrl_wr    : std_logic;
+    signal rxp_data_read  : std_logic;
+    signal rxp_route_q    : std_logic_vector(4 downto 0);
+    signal rxp_erase      : std_logic;
+    signal rxp_clr_ovr    : std_logic;
 
     signal ctr_pres_sel_q : std_logic_vector(3 downto 0);
 
+    -- Upper word of timestamp latched by read of TIMESTAMP_LOW
+    signal timestamp_high_q : std_logic_vector(31 downto 0);
+
     ---------------------------------------------------------------------------
     -- 
     ---------------------------------------------------------------------------
@@ -444,6 +590,16 @@ begin
                              else
                          '0';
 
+    rx_data_window_cs <= '1' when (adress(11 downto 8) = RX_DATA_WINDOW_BLOCK)
+                                   and (can_core_cs = '1')
+                             else
+                         '0';
+
+    rx_prio_buffer_cs <= '1' when (adress(11 downto 8) = RX_PRIO_BUFFER_BLOCK)
+                                   and (can_core_cs = '1')
+                             else
+                         '0';
+
     ----------------------------------------------------------------------------
     -- Registering control registers chip select
     ----------------------------------------------------------------------------
@@ -452,18 +608,122 @@ begin
         if (res_n = '0') then
             control_registers_cs_reg  <= '0';
             test_registers_cs_reg <= '0';
+            rx_data_window_cs_reg <= '0';
+            rx_prio_buffer_cs_reg <= '0';
         elsif (rising_edge(clk_sys)) then
             control_registers_cs_reg  <= control_registers_cs;
             test_registers_cs_reg <= test_registers_cs;
+            rx_data_window_cs_reg <= rx_data_window_cs;
+            rx_prio_buffer_cs_reg <= rx_prio_buffer_cs;
         end if;
     end process;
 
+    ----------------------------------------------------------------------------
+    -- RX data window. Each read from any address of the window reads one word
+    -- from RX Buffer (as RX_DATA does). Thus consecutive beats of incrementing
+    -- or wrapping burst read consecutive words of RX Buffer FIFO.
+    ----------------------------------------------------------------------------
+    rx_window_read <= '1' when (rx_data_window_cs = '1' and srd = '1') else
+                      '0';
+
+    rx_window_rdata_proc : process(res_n, clk_sys)
+    begin
+        if (res_n = '0') then
+            rx_data_window_rdata <= (OTHERS => '0');
+        elsif (rising_edge(clk_sys)) then
+            if (rx_window_read = '1') then
+                rx_data_window_rdata <= rx_read_buff;
+            end if;
+        end if;
+    end process;
+
+    ----------------------------------------------------------------------------
+    -- Priority RX Buffer registers. There are only four of them, so they are
+    -- decoded here and not by generated register map. Read of RXP_DATA moves
+    -- read pointer of Priority RX Buffer (there is no manual mode).
+    ----------------------------------------------------------------------------
+    rx_prio_gen_true : if G_SUP_RX_PRIO generate
+        rxp_ctrl_wr <= '1' when (rx_prio_buffer_cs = '1' and swr = '1' and
+                                 adress(7 downto 2) = RXP_CTRL_ADR(7 downto 2))
+                           else
+                       '0';
+
+        rxp_data_read <= '1' when (rx_prio_buffer_cs = '1' and srd = '1' and
+                                   adress(7 downto 2) = RXP_DATA_ADR(7 downto 2))
+                             else
+                         '0';
+
+        rxp_route_proc : process(soft_res_q_n, clk_sys)
+        begin
+            if (soft_res_q_n = '0') then
+                rxp_route_q <= RPRS_RSTVAL & RPRR_RSTVAL & RPRC_RSTVAL &
+                               RPRB_RSTVAL & RPRA_RSTVAL;
+            elsif (rising_edge(clk_sys)) then
+                if (rxp_ctrl_wr = '1' and sbe(0) = '1') then
+                    rxp_route_q <= data_in(RPRS_IND downto RPRA_IND);
+                end if;
+            end if;
+        end process;
+
+        rxp_erase <= data_in(RPRRB_IND) when (rxp_ctrl_wr = '1' and sbe(1) = '1')
+                                        else
+                     '0';
+
+        rxp_clr_ovr <= data_in(RPCDO_IND) when (rxp_ctrl_wr = '1' and sbe(1) = '1')
+                                          else
+                       '0';
+
+        rxp_rdata_proc : process(res_n, clk_sys)
+        begin
+            if (res_n = '0') then
+                rx_prio_buffer_rdata <= (OTHERS => '0');
+            elsif (rising_edge(clk_sys)) then
+                if (rx_prio_buffer_cs = '1' and srd = '1') then
+                    rx_prio_buffer_rdata <= (OTHERS => '0');
+
+                    if (adress(7 downto 2) = RXP_CTRL_ADR(7 downto 2)) then
+                        rx_prio_buffer_rdata(RPRS_IND downto RPRA_IND) <=
+                            rxp_route_q;
+
+                    elsif (adress(7 downto 2) = RXP_MEM_INFO_ADR(7 downto 2)) then
+                        rx_prio_buffer_rdata(RXP_BUFF_SIZE_H downto RXP_BUFF_SIZE_L)
+                            <= rxp_buf_size;
+                        rx_prio_buffer_rdata(RXP_MEM_FREE_H downto RXP_MEM_FREE_L)
+                            <= rxp_mem_free;
+
+                    elsif (adress(7 downto 2) = RXP_STATUS_ADR(7 downto 2)) then
+                        rx_prio_buffer_rdata(RXPE_IND) <= rxp_empty;
+                        rx_prio_buffer_rdata(RXPF_IND) <= rxp_full;
+                        rx_prio_buffer_rdata(RXPMOF_IND) <= rxp_mof;
+                        rx_prio_buffer_rdata(RXPFRC_H downto RXPFRC_L) <=
+                            rxp_frame_count;
+                        rx_prio_buffer_rdata(RXPDOR_IND) <= rxp_data_overrun;
+
+                    elsif (adress(7 downto 2) = RXP_DATA_ADR(7 downto 2)) then
+                        rx_prio_buffer_rdata <= rxp_read_buff;
+                    end if;
+                end if;
+            end if;
+        end process;
+    end generate rx_prio_gen_true;
+
+    rx_prio_gen_false : if not G_SUP_RX_PRIO generate
+        rxp_ctrl_wr <= '0';
+        rxp_data_read <= '0';
+        rxp_route_q <= (OTHERS => '0');
+        rxp_erase <= '0';
+        rxp_clr_ovr <= '0';
+        rx_prio_buffer_rdata <= (OTHERS => '0');
+    end generate rx_prio_gen_false;
+
     ----------------------------------------------------------------------------
     -- Read data multiplexor. Use registered version of chip select signals
     -- since read data are returned one clock cycle later!
     ----------------------------------------------------------------------------
     data_out <= control_registers_rdata when (control_registers_cs_reg = '1') else
                    test_registers_rdata when (test_registers_cs_reg = '1') else
+                   rx_data_window_rdata when (rx_data_window_cs_reg = '1') else
+                   rx_prio_buffer_rdata when (rx_prio_buffer_cs_reg = '1') else
                         (OTHERS => '0');
 
     ----------------------------------------------------------------------------
@@ -521,7 +781,15 @@ begin
         SUP_RANGE             => G_SUP_RANGE,
         SUP_FILT_C            => G_SUP_FILTC,
         SUP_FILT_B            => G_SUP_FILTB,
-        SUP_TRAFFIC_CTRS      => G_SUP_TRAFFIC_CTRS
+        SUP_TRAFFIC_CTRS      => G_SUP_TRAFFIC_CTRS,
+        SUP_FILT_SET          => G_SUP_FILT_SET,
+        SUP_RX_DMA            => G_SUP_RX_DMA,
+        SUP_TX_FIFO           => G_SUP_TX_FIFO,
+        SUP_INT_TS            => G_SUP_INT_TS,
+        SUP_TX_TS             => G_SUP_TX_TS,
+        SUP_TS_GEN            => G_SUP_TS_GEN,
+        SUP_TXT_CYC           => G_SUP_TXT_CYC,
+        SUP_TX_CPL            => G_SUP_TX_CPL
     )
     port map(
         clk_sys               => clk_control_regs,
@@ -719,7 +987,74 @@ begin
         status_comb(STCNT_IND) <= '0';
     end generate traffic_ctrs_gen_false;
     
-    status_comb(31 downto 18) <= (others => '0');
+    rx_dma_gen_true : if G_SUP_RX_DMA generate
+        status_comb(SRDMA_IND) <= '1';
+    end generate rx_dma_gen_true;
+
+    rx_dma_gen_false : if not G_SUP_RX_DMA generate
+        status_comb(SRDMA_IND) <= '0';
+    end generate rx_dma_gen_false;
+
+    tx_fifo_gen_true : if G_SUP_TX_FIFO generate
+        status_comb(STXF_IND) <= '1';
+    end generate tx_fifo_gen_true;
+
+    tx_fifo_gen_false : if not G_SUP_TX_FIFO generate
+        status_comb(STXF_IND) <= '0';
+    end generate tx_fifo_gen_false;
+
+    int_ts_gen_true : if G_SUP_INT_TS generate
+        status_comb(SITS_IND) <= '1';
+    end generate int_ts_gen_true;
+
+    int_ts_gen_false : if not G_SUP_INT_TS generate
+        status_comb(SITS_IND) <= '0';
+    end generate int_ts_gen_false;
+
+    tx_ts_gen_true : if G_SUP_TX_TS generate
+        status_comb(STXTS_IND) <= '1';
+    end generate tx_ts_gen_true;
+
+    tx_ts_gen_false : if not G_SUP_TX_TS generate
+        status_comb(STXTS_IND) <= '0';
+    end generate tx_ts_gen_false;
+
+    ts_gen_true : if G_SUP_TS_GEN generate
+        status_comb(STSG_IND) <= '1';
+    end generate ts_gen_true;
+
+    ts_gen_false : if not G_SUP_TS_GEN generate
+        status_comb(STSG_IND) <= '0';
+    end generate ts_gen_false;
+
+    -- RX frame header peek and skip is always present
+    status_comb(SRXPK_IND) <= '1';
+
+    txt_cyc_gen_true : if G_SUP_TXT_CYC generate
+        status_comb(STCYC_IND) <= '1';
+    end generate txt_cyc_gen_true;
+
+    txt_cyc_gen_false : if not G_SUP_TXT_CYC generate
+        status_comb(STCYC_IND) <= '0';
+    end generate txt_cyc_gen_false;
+
+    tx_cpl_gen_true : if G_SUP_TX_CPL generate
+        status_comb(STCPL_IND) <= '1';
+    end generate tx_cpl_gen_true;
+
+    tx_cpl_gen_false : if not G_SUP_TX_CPL generate
+        status_comb(STCPL_IND) <= '0';
+    end generate tx_cpl_gen_false;
+
+    rx_prio_stat_gen_true : if G_SUP_RX_PRIO generate
+        status_comb(STRXP_IND) <= '1';
+    end generate rx_prio_stat_gen_true;
+
+    rx_prio_stat_gen_false : if not G_SUP_RX_PRIO generate
+        status_comb(STRXP_IND) <= '0';
+    end generate rx_prio_stat_gen_false;
+
+    status_comb(31 downto 27) <= (others => '0');
     status_comb(15 downto 9) <= (others => '0');
 
     ----------------------------------------------------------------------------
@@ -788,6 +1123,24 @@ begin
     drv_bus(DRV_PEXS_CLR_INDEX) <= align_wrd_to_reg(
         control_registers_out.command, CPEXS_IND);
 
+    -- RXDCRST - RX drop counter reset
+    drv_bus(DRV_CLR_RX_DROP_CTR_INDEX) <= align_wrd_to_reg(
+        control_registers_out.command, RXDCRST_IND);
+
+    -- RXSKIP - Skip oldest frame in RX buffer
+    drv_bus(DRV_RX_SKIP_INDEX) <= align_wrd_to_reg(
+        control_registers_out.command, RXSKIP_IND);
+
+    -- BSSNAP - Bus statistics snapshot
+    drv_bus(DRV_BUS_STAT_SNAP_INDEX) <= align_wrd_to_reg(
+        control_registers_out.command, BSSNAP_IND);
+
+    -- TSSTEP - Step timestamp generator
+    ts_step_cmd <= align_wrd_to_reg(control_registers_out.command, TSSTEP_IND);
+
+    -- TSSET - Set timestamp generator
+    ts_set_cmd <= align_wrd_to_reg(control_registers_out.command, TSSET_IND);
+
     ---------------------------------------------------------------------------
     -- SETTINGS Register
     ---------------------------------------------------------------------------
@@ -1025,6 +1378,37 @@ begin
             control_registers_out.filter_control, FRFE_IND, FRNB_IND);
 
 
+    --------------------------------------------------------------------------
+    -- FILTER_SET_CTRL
+    ---------------------------------------------------------------------------
+    drv_bus(DRV_FILTER_SET_CTRL_HIGH downto DRV_FILTER_SET_CTRL_LOW) <= align_wrd_to_reg(
+            control_registers_out.filter_set_ctrl, FSFE_IND, FSNB_IND);
+
+
+    --------------------------------------------------------------------------
+    -- FILTER_SET_ADDR
+    ---------------------------------------------------------------------------
+
+    -- Table select (Bitmap / Hash table)
+    drv_bus(DRV_FILTER_SET_TSEL_INDEX) <= align_wrd_to_reg(
+            control_registers_out.filter_set_addr, FSET_TSEL_IND);
+
+    -- Word address
+    drv_bus(DRV_FILTER_SET_ADDR_HIGH downto DRV_FILTER_SET_ADDR_LOW) <= align_wrd_to_reg(
+            control_registers_out.filter_set_addr, FSET_ADDR_H, FSET_ADDR_L);
+
+
+    --------------------------------------------------------------------------
+    -- FILTER_SET_DATA
+    ---------------------------------------------------------------------------
+    drv_bus(DRV_FILTER_SET_DATA_HIGH downto DRV_FILTER_SET_DATA_LOW) <= align_wrd_to_reg(
+            control_registers_out.filter_set_data, FSET_DATA_H, FSET_DATA_L);
+
+    -- Write to ID set filter memory (registered, data are already stored in
+    -- FILTER_SET_DATA).
+    drv_bus(DRV_FILTER_SET_WR_INDEX) <= control_registers_out.filter_set_data_write;
+
+
     --------------------------------------------------------------------------
     -- RX_SETTINGS
     ---------------------------------------------------------------------------
@@ -1033,21 +1417,121 @@ begin
     drv_bus(DRV_RTSOPT_INDEX) <= align_wrd_to_reg(
         control_registers_out.rx_settings, RTSOP_IND);
 
+    -- ROVP - RX buffer overflow policy
+    drv_bus(DRV_RX_DROP_OLD_INDEX) <= align_wrd_to_reg(
+        control_registers_out.rx_settings, ROVP_IND);
+
+    -- RTSB - Store both timestamps (SOF and EOF) of received frame
+    drv_bus(DRV_RTSB_INDEX) <= align_wrd_to_reg(
+        control_registers_out.rx_settings, RTSB_IND);
+
 
     --------------------------------------------------------------------------
     -- RX_DATA
     ---------------------------------------------------------------------------
     -- Signal increment of RX buffer pointer when:
-    --  1. Automated mode - we read from RX_DATA register
+    --  1. Automated mode - we read from RX_DATA register or RX data window
     --  2. Manual mode - we issue COMMAND[RXRPMV].
+    -- When RX DMA is enabled, RX Buffer is read only by RX DMA.
     rx_buf_mode <= align_wrd_to_reg(control_registers_out.mode, RXBAM_IND);
     rx_move_cmd <= align_wrd_to_reg(control_registers_out.command, RXRPMV_IND);
+    rx_dma_ena  <= align_wrd_to_reg(control_registers_out.rx_dma_ctrl, RDENA_IND);
+    rx_data_read <= control_registers_out.rx_data_read or rx_window_read;
     
     drv_bus(DRV_READ_START_INDEX) <=
-        control_registers_out.rx_data_read when (rx_buf_mode = RXBAM_ENABLED)
+                                       '0' when (rx_dma_ena = RDMA_ENABLED)
+                                           else
+                              rx_data_read when (rx_buf_mode = RXBAM_ENABLED)
                                            else
                                rx_move_cmd;
 
+
+    --------------------------------------------------------------------------
+    -- RX_DMA_CTRL
+    ---------------------------------------------------------------------------
+    drv_bus(DRV_RX_DMA_ENA_INDEX) <= rx_dma_ena;
+
+    drv_bus(DRV_RX_DMA_RS_HIGH downto DRV_RX_DMA_RS_LOW) <= align_wrd_to_reg(
+            control_registers_out.rx_dma_ctrl, RDRS_H, RDRS_L);
+
+    drv_bus(DRV_RX_DMA_BATCH_HIGH downto DRV_RX_DMA_BATCH_LOW) <= align_wrd_to_reg(
+            control_registers_out.rx_dma_ctrl, RDBATCH_H, RDBATCH_L);
+
+    drv_bus(DRV_RX_DMA_TMO_HIGH downto DRV_RX_DMA_TMO_LOW) <= align_wrd_to_reg(
+            control_registers_out.rx_dma_ctrl, RDTMO_H, RDTMO_L);
+
+
+    --------------------------------------------------------------------------
+    -- RX_DMA_BASE
+    ---------------------------------------------------------------------------
+    drv_bus(DRV_RX_DMA_BASE_HIGH downto DRV_RX_DMA_BASE_LOW) <= align_wrd_to_reg(
+            control_registers_out.rx_dma_base, RDBASE_H, RDBASE_L);
+
+
+    --------------------------------------------------------------------------
+    -- RX_DMA_CONS
+    ---------------------------------------------------------------------------
+    drv_bus(DRV_RX_DMA_CONS_HIGH downto DRV_RX_DMA_CONS_LOW) <= align_wrd_to_reg(
+            control_registers_out.rx_dma_cons, RDCONS_H, RDCONS_L);
+
+    --------------------------------------------------------------------------
+    -- TX_FIFO_CTRL
+    ---------------------------------------------------------------------------
+    drv_bus(DRV_TX_FIFO_TH_HIGH downto DRV_TX_FIFO_TH_LOW) <= align_wrd_to_reg(
+            control_registers_out.tx_fifo_ctrl, TFTH_H, TFTH_L);
+
+    --------------------------------------------------------------------------
+    -- INT_TS_SEL
+    ---------------------------------------------------------------------------
+    drv_bus(DRV_INT_TS_SEL_HIGH downto DRV_INT_TS_SEL_LOW) <= align_wrd_to_reg(
+            control_registers_out.int_ts_sel, ITSEL_H, ITSEL_L);
+
+    --------------------------------------------------------------------------
+    -- BUS_STAT_SEL
+    ---------------------------------------------------------------------------
+    drv_bus(DRV_BUS_STAT_SEL_HIGH downto DRV_BUS_STAT_SEL_LOW) <= align_wrd_to_reg(
+            control_registers_out.bus_stat_sel, BSSEL_H, BSSEL_L);
+
+    --------------------------------------------------------------------------
+    -- TXTB_TS_SEL
+    ---------------------------------------------------------------------------
+    drv_bus(DRV_TXTB_TS_SEL_HIGH downto DRV_TXTB_TS_SEL_LOW) <= align_wrd_to_reg(
+            control_registers_out.txtb_ts_sel, TTSEL_H, TTSEL_L);
+
+    --------------------------------------------------------------------------
+    -- TXT_CYC_SEL, TXT_CYC_PERIOD
+    ---------------------------------------------------------------------------
+    drv_bus(DRV_TXT_CYC_SEL_HIGH downto DRV_TXT_CYC_SEL_LOW) <= align_wrd_to_reg(
+            control_registers_out.txt_cyc_sel, TCSEL_H, TCSEL_L);
+
+    drv_bus(DRV_TXT_CYC_PERIOD_HIGH downto DRV_TXT_CYC_PERIOD_LOW) <=
+            control_registers_out.txt_cyc_period;
+
+    -- Period is stored by TXT Buffer selected by TXT_CYC_SEL upon write to
+    -- TXT_CYC_PERIOD.
+    drv_bus(DRV_TXT_CYC_WR_INDEX) <= control_registers_out.txt_cyc_period_write;
+
+    --------------------------------------------------------------------------
+    -- TX_CPL
+    ---------------------------------------------------------------------------
+    -- Oldest record of TX completion FIFO is removed by read of TX_CPL.
+    drv_bus(DRV_TX_CPL_POP_INDEX) <= control_registers_out.tx_cpl_read;
+
+    --------------------------------------------------------------------------
+    -- RXP_CTRL, RXP_DATA
+    ---------------------------------------------------------------------------
+    drv_bus(DRV_RXP_ROUTE_HIGH downto DRV_RXP_ROUTE_LOW) <= rxp_route_q;
+    drv_bus(DRV_RXP_READ_START_INDEX) <= rxp_data_read;
+    drv_bus(DRV_RXP_ERASE_INDEX) <= rxp_erase;
+    drv_bus(DRV_RXP_CLR_OVR_INDEX) <= rxp_clr_ovr;
+
+    --------------------------------------------------------------------------
+    -- TS_INC, TS_STEP_LOW, TS_STEP_HIGH
+    ---------------------------------------------------------------------------
+    ts_inc <= control_registers_out.ts_inc;
+    ts_step <= control_registers_out.ts_step_high &
+               control_registers_out.ts_step_low;
+
     --------------------------------------------------------------------------
     -- TX_COMMAND
     ---------------------------------------------------------------------------
@@ -1304,9 +1788,21 @@ begin
                 align_reg_to_wrd(SFR_IND, length)) <= '0';
         end generate not_sup_filt_range_gen;
 
+        -- SFS - Support ID set filter -> yes
+        sup_filt_set_gen : if (G_SUP_FILT_SET) generate
+            Control_registers_in.filter_status(
+                align_reg_to_wrd(SFS_IND, length)) <= '1';
+        end generate sup_filt_set_gen;
+
+        -- SFS - Support ID set filter -> no
+        not_sup_filt_set_gen : if (not G_SUP_FILT_SET) generate
+            Control_registers_in.filter_status(
+                align_reg_to_wrd(SFS_IND, length)) <= '0';
+        end generate not_sup_filt_set_gen;
+
         -- Pad rest by zeroes
         Control_registers_in.filter_status(
-            Control_registers_in.filter_status'length - 1 downto 4) <=
+            Control_registers_in.filter_status'length - 1 downto 5) <=
             (OTHERS => '0');
 
     end block filter_status_block;
@@ -1565,6 +2061,145 @@ begin
     end block tx_fr_ctr_block;
 
 
+    ---------------------------------------------------------------------------
+    -- RX_DROP_CTR register
+    ---------------------------------------------------------------------------
+    rx_drop_ctr_block : block
+        constant length : natural := Control_registers_in.rx_drop_ctr'length;
+    begin
+
+        Control_registers_in.rx_drop_ctr(
+            align_reg_to_wrd(RX_DROP_CTR_VAL_H, length) downto
+            align_reg_to_wrd(RX_DROP_CTR_VAL_L, length)) <=
+            rx_drop_ctr;
+
+    end block rx_drop_ctr_block;
+
+
+    ---------------------------------------------------------------------------
+    -- RX_DMA_STATUS register
+    ---------------------------------------------------------------------------
+    rx_dma_status_block : block
+        constant length : natural := Control_registers_in.rx_dma_status'length;
+    begin
+
+        Control_registers_in.rx_dma_status(
+            align_reg_to_wrd(RDPROD_H, length) downto
+            align_reg_to_wrd(RDPROD_L, length)) <=
+            rx_dma_prod;
+
+        Control_registers_in.rx_dma_status(
+            align_reg_to_wrd(RDACT_IND, length)) <= rx_dma_act;
+
+        Control_registers_in.rx_dma_status(
+            align_reg_to_wrd(RDBERR_IND, length)) <= rx_dma_berr;
+
+        Control_registers_in.rx_dma_status(15 downto 12) <= (OTHERS => '0');
+        Control_registers_in.rx_dma_status(31 downto 18) <= (OTHERS => '0');
+
+    end block rx_dma_status_block;
+
+
+    ---------------------------------------------------------------------------
+    -- TX_FIFO_STATUS register
+    ---------------------------------------------------------------------------
+    tx_fifo_status_block : block
+        constant length : natural := Control_registers_in.tx_fifo_status'length;
+    begin
+
+        Control_registers_in.tx_fifo_status(
+            align_reg_to_wrd(TFFL_H, length) downto
+            align_reg_to_wrd(TFFL_L, length)) <=
+            tx_fifo_fill;
+
+        Control_registers_in.tx_fifo_status(
+            align_reg_to_wrd(TFFULL_IND, length)) <= tx_fifo_full;
+
+        tx_fifo_depth_gen_true : if G_SUP_TX_FIFO generate
+            Control_registers_in.tx_fifo_status(
+                align_reg_to_wrd(TFDEPTH_H, length) downto
+                align_reg_to_wrd(TFDEPTH_L, length)) <=
+                std_logic_vector(to_unsigned(G_TX_FIFO_DEPTH, 7));
+        end generate tx_fifo_depth_gen_true;
+
+        tx_fifo_depth_gen_false : if not G_SUP_TX_FIFO generate
+            Control_registers_in.tx_fifo_status(
+                align_reg_to_wrd(TFDEPTH_H, length) downto
+                align_reg_to_wrd(TFDEPTH_L, length)) <= (OTHERS => '0');
+        end generate tx_fifo_depth_gen_false;
+
+        Control_registers_in.tx_fifo_status(15) <= '0';
+
+    end block tx_fifo_status_block;
+
+
+    ---------------------------------------------------------------------------
+    -- INT_TS register
+    ---------------------------------------------------------------------------
+    Control_registers_in.int_ts <= int_ts;
+
+
+    ---------------------------------------------------------------------------
+    -- BUS_STAT register
+    ---------------------------------------------------------------------------
+    bus_stat_block : block
+        constant length : natural := Control_registers_in.bus_stat'length;
+    begin
+
+        Control_registers_in.bus_stat(
+            align_reg_to_wrd(BS_VAL_H, length) downto
+            align_reg_to_wrd(BS_VAL_L, length)) <=
+            stat_bus(STAT_BUS_STAT_CTR_HIGH downto STAT_BUS_STAT_CTR_LOW);
+
+    end block bus_stat_block;
+
+
+    ---------------------------------------------------------------------------
+    -- TXTB_TS_LOW, TXTB_TS_HIGH registers
+    ---------------------------------------------------------------------------
+    Control_registers_in.txtb_ts_low <= txtb_ts(31 downto 0);
+    Control_registers_in.txtb_ts_high <= txtb_ts(63 downto 32);
+
+
+    ---------------------------------------------------------------------------
+    -- RX_PEEK_FFW, RX_PEEK_IDW registers
+    ---------------------------------------------------------------------------
+    Control_registers_in.rx_peek_ffw <= rx_peek_ffw;
+    Control_registers_in.rx_peek_idw <= rx_peek_idw;
+
+
+    ---------------------------------------------------------------------------
+    -- TXT_CYC_SKIP register
+    ---------------------------------------------------------------------------
+    txt_cyc_skip_block : block
+        signal txt_cyc_sel : natural range 0 to 7;
+    begin
+        txt_cyc_sel <= to_integer(unsigned(align_wrd_to_reg(
+                            control_registers_out.txt_cyc_sel, TCSEL_H, TCSEL_L)));
+
+        Control_registers_in.txt_cyc_skip <= txtb_cyc_skip(txt_cyc_sel)
+                                                when (txt_cyc_sel < G_TXT_BUFFER_COUNT)
+                                                else
+                                             (OTHERS => '0');
+    end block txt_cyc_skip_block;
+
+
+    ---------------------------------------------------------------------------
+    -- TX_CPL_TS, TX_CPL registers
+    ---------------------------------------------------------------------------
+    Control_registers_in.tx_cpl_ts <= tx_cpl_ts;
+
+    Control_registers_in.tx_cpl(TCIDX_H downto TCIDX_L) <= tx_cpl_index;
+    Control_registers_in.tx_cpl(3) <= '0';
+    Control_registers_in.tx_cpl(TCST_H downto TCST_L) <= tx_cpl_state;
+    Control_registers_in.tx_cpl(TCRC_H downto TCRC_L) <= tx_cpl_retr_ctr;
+    Control_registers_in.tx_cpl(15 downto 12) <= (OTHERS => '0');
+    Control_registers_in.tx_cpl(TCCNT_H downto TCCNT_L) <= tx_cpl_count;
+    Control_registers_in.tx_cpl(29 downto 21) <= (OTHERS => '0');
+    Control_registers_in.tx_cpl(TCOF_IND) <= tx_cpl_overflow;
+    Control_registers_in.tx_cpl(TCV_IND) <= tx_cpl_valid;
+
+
     ---------------------------------------------------------------------------
     -- DEBUG register
     ---------------------------------------------------------------------------
@@ -1672,12 +2307,27 @@ begin
 
     ---------------------------------------------------------------------------
     -- TIMESTAMP_LOW, TIMESTAMP_HIGH registers
+    --
+    -- Read of TIMESTAMP_LOW latches upper word of timestamp in the same clock
+    -- cycle as lower word is sampled to read data. TIMESTAMP_HIGH returns
+    -- latched value, so LOW followed by HIGH read gives consistent timestamp.
     ---------------------------------------------------------------------------
     timestamp_registers_block : block
         constant ts_low_l : natural := Control_registers_in.timestamp_low'length;
         constant ts_high_l : natural := Control_registers_in.timestamp_high'length;
     begin
 
+        timestamp_high_proc : process(res_n, clk_sys)
+        begin
+            if (res_n = '0') then
+                timestamp_high_q <= (OTHERS => '0');
+            elsif (rising_edge(clk_sys)) then
+                if (Control_registers_out.timestamp_low_read = '1') then
+                    timestamp_high_q <= timestamp(63 downto 32);
+                end if;
+            end if;
+        end process;
+
         Control_registers_in.timestamp_low(
             align_reg_to_wrd(TIMESTAMP_LOW_H, ts_low_l) downto
             align_reg_to_wrd(TIMESTAMP_LOW_L, ts_low_l)) <=
@@ -1686,18 +2336,45 @@ begin
         Control_registers_in.timestamp_high(
             align_reg_to_wrd(TIMESTAMP_HIGH_H, ts_high_l) downto
             align_reg_to_wrd(TIMESTAMP_HIGH_L, ts_high_l)) <=
-            timestamp(63 downto 32);
+            timestamp_high_q;
 
     end block timestamp_registers_block;
 
+
+    ---------------------------------------------------------------------------
+    -- FILTER_SET_INFO register
+    ---------------------------------------------------------------------------
+    filter_set_info_block : block
+        constant length : natural := Control_registers_in.filter_set_info'length;
+    begin
+
+        sup_filt_set_gen : if (G_SUP_FILT_SET) generate
+            Control_registers_in.filter_set_info(
+                align_reg_to_wrd(FSET_HTW_H, length) downto
+                align_reg_to_wrd(FSET_HTW_L, length)) <=
+                std_logic_vector(to_unsigned(G_FILT_SET_HASH_WIDTH, 4));
+
+            Control_registers_in.filter_set_info(
+                align_reg_to_wrd(FSET_PRB_H, length) downto
+                align_reg_to_wrd(FSET_PRB_L, length)) <=
+                std_logic_vector(to_unsigned(G_FILT_SET_PROBE_LEN, 4));
+        end generate sup_filt_set_gen;
+
+        not_sup_filt_set_gen : if (not G_SUP_FILT_SET) generate
+            Control_registers_in.filter_set_info(7 downto 0) <= (OTHERS => '0');
+        end generate not_sup_filt_set_gen;
+
+        Control_registers_in.filter_set_info(15 downto 8) <= (OTHERS => '0');
+
+    end block filter_set_info_block;
+
    
     ----------------------------------------------------------------------------
     -- Driving bus assignment
     ----------------------------------------------------------------------------
     -- Note:  All unused signals indices are assigned to zero!
     drv_bus(80 downto 61)   <= (OTHERS => '0');
-    drv_bus(349 downto 331) <= (OTHERS => '0');
-    drv_bus(355 downto 354) <= (OTHERS => '0');
+    drv_bus(355)            <= '0';
     drv_bus(360 downto 358) <= (OTHERS => '0');
     drv_bus(362 downto 361) <= (OTHERS => '0');
     drv_bus(365 downto 363) <= (OTHERS => '0');
@@ -1711,13 +2388,14 @@ begin
     drv_bus(506 downto 475) <= (OTHERS => '0');
     drv_bus(444 downto 430) <= (OTHERS => '0');
 
-    drv_bus(1023 downto 876)<= (OTHERS => '0');
+    drv_bus(1023 downto 1021)<= (OTHERS => '0');
+    drv_bus(908 downto 884) <= (OTHERS => '0');
 
-    drv_bus(863 downto 844) <= (OTHERS => '0');
-    drv_bus(831 downto 812) <= (OTHERS => '0');
-    drv_bus(799 downto 780) <= (OTHERS => '0');
-    drv_bus(767 downto 748) <= (OTHERS => '0');
-    drv_bus(735 downto 614) <= (OTHERS => '0');
+    drv_bus(863 downto 848) <= (OTHERS => '0');
+    drv_bus(831 downto 816) <= (OTHERS => '0');
+    drv_bus(799 downto 784) <= (OTHERS => '0');
+    drv_bus(767 downto 752) <= (OTHERS => '0');
+    drv_bus(735 downto 659) <= (OTHERS => '0');
     
     drv_bus(613 downto 610) <= (OTHERS => '0');
     drv_bus(600 downto 580) <= (OTHERS => '0');
@@ -1746,6 +2424,12 @@ begin
     
     -- psl rx_buf_manual_mode_cov : cover
     --   {rx_buf_mode = RXBAM_DISABLED};
+
+    -- psl rx_data_window_burst_cov : cover
+    --   {rx_window_read = '1'[*4]};
+
+    -- psl rxp_data_read_cov : cover
+    --   {rxp_data_read = '1'};
     
 
 end architecture;
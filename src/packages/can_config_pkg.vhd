@@ -81,14 +81,14 @@ use ieee.std_logic_1164.all;
 package can_config_pkg is
 
     -- IP Core version
-    constant C_CTU_CAN_FD_VERSION_MINOR : std_logic_vector(7 downto 0) := x"04";
+    constant C_CTU_CAN_FD_VERSION_MINOR : std_logic_vector(7 downto 0) := x"05";
     constant C_CTU_CAN_FD_VERSION_MAJOR : std_logic_vector(7 downto 0) := x"02";
 
     -- Number of TXT Buffers
     constant C_TXT_BUFFER_COUNT     : natural := 4;
     
     -- Number of Interrupts
-    constant C_INT_COUNT            : natural := 12;  
+    constant C_INT_COUNT            : natural := 16;  
   
     -- Number of Sample Triggers
     constant C_SAMPLE_TRIGGER_COUNT : natural range 2 to 8 := 2;
@@ -144,6 +144,16 @@ package can_config_pkg is
     -- Width of SSP counters
     constant C_SSP_CTRS_WIDTH       : natural := 15;
 
+    -- ID set filter - Hash table address width (hash table has
+    -- 2^C_FILT_SET_HASH_WIDTH entries, up to 1024)
+    constant C_FILT_SET_HASH_WIDTH  : natural range 1 to 10 := 8;
+
+    -- ID set filter - Number of hash table entries probed for each identifier
+    constant C_FILT_SET_PROBE_LEN   : natural range 1 to 15 := 4;
+
+    -- Number of records in TX completion FIFO
+    constant C_TX_CPL_DEPTH         : natural range 2 to 16 := 16;
+
     -- CRC polynomials
     constant C_CRC15_POL : std_logic_vector(15 downto 0) := x"C599";
     constant C_CRC17_POL : std_logic_vector(19 downto 0) := x"3685B";
@@ -105,6 +105,7 @@ package can_fd_frame_format is
   constant ESI_RSV_IND           : natural := 10;
   constant RWCNT_L               : natural := 11;
   constant RWCNT_H               : natural := 15;
+  constant ETS_IND               : natural := 16;
 
   -- "RTR" field enumerated values
   constant NO_RTR_FRAME       : std_logic := '0';
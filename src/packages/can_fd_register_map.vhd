@@ -134,6 +134,34 @@ package can_fd_register_map is
   constant YOLO_REG_ADR              : std_logic_vector(11 downto 0) := x"090";
   constant TIMESTAMP_LOW_ADR         : std_logic_vector(11 downto 0) := x"094";
   constant TIMESTAMP_HIGH_ADR        : std_logic_vector(11 downto 0) := x"098";
+  constant FILTER_SET_CTRL_ADR       : std_logic_vector(11 downto 0) := x"09C";
+  constant FILTER_SET_INFO_ADR       : std_logic_vector(11 downto 0) := x"09E";
+  constant FILTER_SET_ADDR_ADR       : std_logic_vector(11 downto 0) := x"0A0";
+  constant FILTER_SET_DATA_ADR       : std_logic_vector(11 downto 0) := x"0A4";
+  constant RX_DROP_CTR_ADR           : std_logic_vector(11 downto 0) := x"0A8";
+  constant RX_DMA_CTRL_ADR           : std_logic_vector(11 downto 0) := x"0AC";
+  constant RX_DMA_BASE_ADR           : std_logic_vector(11 downto 0) := x"0B0";
+  constant RX_DMA_CONS_ADR           : std_logic_vector(11 downto 0) := x"0B4";
+  constant RX_DMA_STATUS_ADR         : std_logic_vector(11 downto 0) := x"0B8";
+  constant TX_FIFO_CTRL_ADR          : std_logic_vector(11 downto 0) := x"0BC";
+  constant TX_FIFO_STATUS_ADR        : std_logic_vector(11 downto 0) := x"0BE";
+  constant INT_TS_SEL_ADR            : std_logic_vector(11 downto 0) := x"0C0";
+  constant INT_TS_ADR                : std_logic_vector(11 downto 0) := x"0C4";
+  constant BUS_STAT_SEL_ADR          : std_logic_vector(11 downto 0) := x"0C8";
+  constant BUS_STAT_ADR              : std_logic_vector(11 downto 0) := x"0CC";
+  constant TXTB_TS_SEL_ADR           : std_logic_vector(11 downto 0) := x"0D0";
+  constant TXTB_TS_LOW_ADR           : std_logic_vector(11 downto 0) := x"0D4";
+  constant TXTB_TS_HIGH_ADR          : std_logic_vector(11 downto 0) := x"0D8";
+  constant TS_INC_ADR                : std_logic_vector(11 downto 0) := x"0DC";
+  constant TS_STEP_LOW_ADR           : std_logic_vector(11 downto 0) := x"0E0";
+  constant TS_STEP_HIGH_ADR          : std_logic_vector(11 downto 0) := x"0E4";
+  constant RX_PEEK_FFW_ADR           : std_logic_vector(11 downto 0) := x"0E8";
+  constant RX_PEEK_IDW_ADR           : std_logic_vector(11 downto 0) := x"0EC";
+  constant TXT_CYC_SEL_ADR           : std_logic_vector(11 downto 0) := x"0F0";
+  constant TXT_CYC_SKIP_ADR          : std_logic_vector(11 downto 0) := x"0F2";
+  constant TXT_CYC_PERIOD_ADR        : std_logic_vector(11 downto 0) := x"0F4";
+  constant TX_CPL_TS_ADR             : std_logic_vector(11 downto 0) := x"0F8";
+  constant TX_CPL_ADR                : std_logic_vector(11 downto 0) := x"0FC";
 
   ------------------------------------------------------------------------------
   ------------------------------------------------------------------------------
@@ -235,6 +263,27 @@ package can_fd_register_map is
   constant TST_WDATA_ADR             : std_logic_vector(11 downto 0) := x"908";
   constant TST_RDATA_ADR             : std_logic_vector(11 downto 0) := x"90C";
 
+  ------------------------------------------------------------------------------
+  ------------------------------------------------------------------------------
+  -- Address block: RX_Data_Window
+  ------------------------------------------------------------------------------
+  ------------------------------------------------------------------------------
+  constant RX_DATA_WINDOW_BLOCK         : std_logic_vector(3 downto 0) := x"A";
+
+  constant RX_DATA_WINDOW_ADR        : std_logic_vector(11 downto 0) := x"A00";
+
+  ------------------------------------------------------------------------------
+  ------------------------------------------------------------------------------
+  -- Address block: RX_Prio_Buffer
+  ------------------------------------------------------------------------------
+  ------------------------------------------------------------------------------
+  constant RX_PRIO_BUFFER_BLOCK         : std_logic_vector(3 downto 0) := x"B";
+
+  constant RXP_CTRL_ADR              : std_logic_vector(11 downto 0) := x"B00";
+  constant RXP_MEM_INFO_ADR          : std_logic_vector(11 downto 0) := x"B04";
+  constant RXP_STATUS_ADR            : std_logic_vector(11 downto 0) := x"B08";
+  constant RXP_DATA_ADR              : std_logic_vector(11 downto 0) := x"B0C";
+
   ------------------------------------------------------------------------------
   -- DEVICE_ID register
   --
@@ -388,6 +437,15 @@ package can_fd_register_map is
   constant PEXS_IND               : natural := 8;
   constant STCNT_IND             : natural := 16;
   constant STRGS_IND             : natural := 17;
+  constant SRDMA_IND             : natural := 18;
+  constant STXF_IND              : natural := 19;
+  constant SITS_IND              : natural := 20;
+  constant STXTS_IND             : natural := 21;
+  constant STSG_IND              : natural := 22;
+  constant SRXPK_IND             : natural := 23;
+  constant STCYC_IND             : natural := 24;
+  constant STCPL_IND             : natural := 25;
+  constant STRXP_IND             : natural := 26;
 
   -- STATUS register reset values
   constant RXNE_RSTVAL        : std_logic := '0';
@@ -399,6 +457,7 @@ package can_fd_register_map is
   constant EWL_RSTVAL         : std_logic := '0';
   constant IDLE_RSTVAL        : std_logic := '1';
   constant PEXS_RSTVAL        : std_logic := '0';
+  constant SRXPK_RSTVAL       : std_logic := '1';
 
   ------------------------------------------------------------------------------
   -- COMMAND register
@@ -414,6 +473,11 @@ package can_fd_register_map is
   constant RXFCRST_IND            : natural := 5;
   constant TXFCRST_IND            : natural := 6;
   constant CPEXS_IND              : natural := 7;
+  constant RXDCRST_IND            : natural := 8;
+  constant BSSNAP_IND             : natural := 9;
+  constant TSSTEP_IND            : natural := 10;
+  constant TSSET_IND             : natural := 11;
+  constant RXSKIP_IND            : natural := 12;
 
   -- COMMAND register reset values
   constant RRB_RSTVAL         : std_logic := '0';
@@ -422,6 +486,11 @@ package can_fd_register_map is
   constant RXFCRST_RSTVAL     : std_logic := '0';
   constant TXFCRST_RSTVAL     : std_logic := '0';
   constant CPEXS_RSTVAL       : std_logic := '0';
+  constant RXDCRST_RSTVAL     : std_logic := '0';
+  constant BSSNAP_RSTVAL      : std_logic := '0';
+  constant TSSTEP_RSTVAL      : std_logic := '0';
+  constant TSSET_RSTVAL       : std_logic := '0';
+  constant RXSKIP_RSTVAL      : std_logic := '0';
 
   ------------------------------------------------------------------------------
   -- INT_STAT register
@@ -442,6 +511,10 @@ package can_fd_register_map is
   constant BSI_IND                : natural := 9;
   constant RBNEI_IND             : natural := 10;
   constant TXBHCI_IND            : natural := 11;
+  constant DMAI_IND              : natural := 12;
+  constant TFTI_IND              : natural := 13;
+  constant RXPI_IND              : natural := 14;
+  constant RPNEI_IND             : natural := 15;
 
   -- INT_STAT register reset values
   constant RXI_RSTVAL         : std_logic := '0';
@@ -456,6 +529,10 @@ package can_fd_register_map is
   constant RBNEI_RSTVAL       : std_logic := '0';
   constant OFI_RSTVAL         : std_logic := '0';
   constant TXBHCI_RSTVAL      : std_logic := '0';
+  constant DMAI_RSTVAL        : std_logic := '0';
+  constant TFTI_RSTVAL        : std_logic := '0';
+  constant RXPI_RSTVAL        : std_logic := '0';
+  constant RPNEI_RSTVAL       : std_logic := '0';
 
   ------------------------------------------------------------------------------
   -- INT_ENA_SET register
@@ -468,10 +545,10 @@ package can_fd_register_map is
   -- .
   ------------------------------------------------------------------------------
   constant INT_ENA_SET_L          : natural := 0;
-  constant INT_ENA_SET_H         : natural := 11;
+  constant INT_ENA_SET_H         : natural := 15;
 
   -- INT_ENA_SET register reset values
-  constant INT_ENA_SET_RSTVAL : std_logic_vector(11 downto 0) := x"000";
+  constant INT_ENA_SET_RSTVAL : std_logic_vector(15 downto 0) := x"0000";
 
   ------------------------------------------------------------------------------
   -- INT_ENA_CLR register
@@ -482,10 +559,10 @@ package can_fd_register_map is
   -- it is set in Interrupt status register.
   ------------------------------------------------------------------------------
   constant INT_ENA_CLR_L          : natural := 0;
-  constant INT_ENA_CLR_H         : natural := 11;
+  constant INT_ENA_CLR_H         : natural := 15;
 
   -- INT_ENA_CLR register reset values
-  constant INT_ENA_CLR_RSTVAL : std_logic_vector(11 downto 0) := x"000";
+  constant INT_ENA_CLR_RSTVAL : std_logic_vector(15 downto 0) := x"0000";
 
   ------------------------------------------------------------------------------
   -- INT_MASK_SET register
@@ -497,10 +574,10 @@ package can_fd_register_map is
   -- er is not empty for RXNEI).
   ------------------------------------------------------------------------------
   constant INT_MASK_SET_L         : natural := 0;
-  constant INT_MASK_SET_H        : natural := 11;
+  constant INT_MASK_SET_H        : natural := 15;
 
   -- INT_MASK_SET register reset values
-  constant INT_MASK_SET_RSTVAL : std_logic_vector(11 downto 0) := x"000";
+  constant INT_MASK_SET_RSTVAL : std_logic_vector(15 downto 0) := x"0000";
 
   ------------------------------------------------------------------------------
   -- INT_MASK_CLR register
@@ -512,10 +589,10 @@ package can_fd_register_map is
   -- pty for RXNEI).
   ------------------------------------------------------------------------------
   constant INT_MASK_CLR_L         : natural := 0;
-  constant INT_MASK_CLR_H        : natural := 11;
+  constant INT_MASK_CLR_H        : natural := 15;
 
   -- INT_MASK_CLR register reset values
-  constant INT_MASK_CLR_RSTVAL : std_logic_vector(11 downto 0) := x"000";
+  constant INT_MASK_CLR_RSTVAL : std_logic_vector(15 downto 0) := x"0000";
 
   ------------------------------------------------------------------------------
   -- BTR register
@@ -798,6 +875,7 @@ package can_fd_register_map is
   constant SFB_IND               : natural := 17;
   constant SFC_IND               : natural := 18;
   constant SFR_IND               : natural := 19;
+  constant SFS_IND               : natural := 20;
 
   -- FILTER_STATUS register reset values
 
@@ -847,13 +925,21 @@ package can_fd_register_map is
   -- Settings of RX buffer FIFO.
   ------------------------------------------------------------------------------
   constant RTSOP_IND             : natural := 16;
+  constant ROVP_IND              : natural := 17;
+  constant RTSB_IND              : natural := 18;
 
   -- "RTSOP" field enumerated values
   constant RTS_END            : std_logic := '0';
   constant RTS_BEG            : std_logic := '1';
 
+  -- "ROVP" field enumerated values
+  constant ROVP_DROP_NEW      : std_logic := '0';
+  constant ROVP_DROP_OLD      : std_logic := '1';
+
   -- RX_SETTINGS register reset values
   constant RTSOP_RSTVAL       : std_logic := '0';
+  constant ROVP_RSTVAL        : std_logic := '0';
+  constant RTSB_RSTVAL        : std_logic := '0';
 
   ------------------------------------------------------------------------------
   -- RX_DATA register
@@ -1163,10 +1249,10 @@ package can_fd_register_map is
   ------------------------------------------------------------------------------
   -- TIMESTAMP_LOW register
   --
-  -- Register with current value of CTU CAN FD time base. No shadowing is implem
-  -- ented on TIMESTAMP_LOW/HIGH registers and user has to take care of proper r
-  -- ead from both registers, since overflow of TIMESTAMP_LOW might occur betwee
-  -- n read of TIMESTAMP_LOW and TIMESTAMP_HIGH.
+  -- Register with current value of CTU CAN FD time base. Read of TIMESTAMP_LOW 
+  -- latches bits 63:32 of time base to TIMESTAMP_HIGH. To get consistent value 
+  -- of time base, TIMESTAMP_LOW shall be read first, followed by read of TIMEST
+  -- AMP_HIGH.
   ------------------------------------------------------------------------------
   constant TIMESTAMP_LOW_L        : natural := 0;
   constant TIMESTAMP_LOW_H       : natural := 31;
@@ -1176,16 +1262,417 @@ package can_fd_register_map is
   ------------------------------------------------------------------------------
   -- TIMESTAMP_HIGH register
   --
-  -- Register with current value of CTU CAN FD time base. No shadowing is implem
-  -- ented on TIMESTAMP_LOW/HIGH registers and user has to take care of proper r
-  -- ead from both registers, since overflow of TIMESTAMP_LOW might occur betwee
-  -- n read of TIMESTAMP_LOW and TIMESTAMP_HIGH.
+  -- Register with current value of CTU CAN FD time base. Read of TIMESTAMP_LOW 
+  -- latches bits 63:32 of time base to TIMESTAMP_HIGH. To get consistent value 
+  -- of time base, TIMESTAMP_LOW shall be read first, followed by read of TIMEST
+  -- AMP_HIGH.
   ------------------------------------------------------------------------------
   constant TIMESTAMP_HIGH_L       : natural := 0;
   constant TIMESTAMP_HIGH_H      : natural := 31;
 
   -- TIMESTAMP_HIGH register reset values
 
+  ------------------------------------------------------------------------------
+  -- FILTER_SET_CTRL register
+  --
+  -- ID set filter control register. Configures ID set filter to accept only sel
+  -- ected frame types. Base identifiers are looked up in identifier bitmap, Ext
+  -- ended identifiers are looked up in hash table. Every bit is active in logic
+  --  1.
+  ------------------------------------------------------------------------------
+  constant FSNB_IND               : natural := 0;
+  constant FSNE_IND               : natural := 1;
+  constant FSFB_IND               : natural := 2;
+  constant FSFE_IND               : natural := 3;
+
+  -- FILTER_SET_CTRL register reset values
+  constant FSNB_RSTVAL        : std_logic := '0';
+  constant FSNE_RSTVAL        : std_logic := '0';
+  constant FSFB_RSTVAL        : std_logic := '0';
+  constant FSFE_RSTVAL        : std_logic := '0';
+
+  ------------------------------------------------------------------------------
+  -- FILTER_SET_INFO register
+  --
+  -- Size of ID set filter memories.
+  ------------------------------------------------------------------------------
+  constant FSET_HTW_L            : natural := 16;
+  constant FSET_HTW_H            : natural := 19;
+  constant FSET_PRB_L            : natural := 20;
+  constant FSET_PRB_H            : natural := 23;
+
+  -- FILTER_SET_INFO register reset values
+
+  ------------------------------------------------------------------------------
+  -- FILTER_SET_ADDR register
+  --
+  -- Address of ID set filter memory word which is written by next write to FILT
+  -- ER_SET_DATA register.
+  ------------------------------------------------------------------------------
+  constant FSET_ADDR_L            : natural := 0;
+  constant FSET_ADDR_H            : natural := 9;
+  constant FSET_TSEL_IND         : natural := 15;
+
+  -- "FSET_TSEL" field enumerated values
+  constant FSET_TSEL_BITMAP   : std_logic := '0';
+  constant FSET_TSEL_HASH     : std_logic := '1';
+
+  -- FILTER_SET_ADDR register reset values
+  constant FSET_ADDR_RSTVAL : std_logic_vector(9 downto 0) := (OTHERS => '0');
+  constant FSET_TSEL_RSTVAL   : std_logic := '0';
+
+  ------------------------------------------------------------------------------
+  -- FILTER_SET_DATA register
+  --
+  -- Data word of ID set filter memory. Write to this register stores the word t
+  -- o the memory selected by FILTER_SET_ADDR. Hash table entry contains valid f
+  -- lag in bit 31 and identifier (in IDENTIFIER_W format) in bits 28:0. Identif
+  -- ier must be stored at one of FILTER_SET_INFO[FSET_PRB] entries following it
+  -- s hash index (modulo hash table size). Hash index is XOR of all identifier 
+  -- bits folded to FILTER_SET_INFO[FSET_HTW] bits. Memories are not reset, they
+  --  must be initialized before the filter is enabled.
+  ------------------------------------------------------------------------------
+  constant FSET_DATA_L            : natural := 0;
+  constant FSET_DATA_H           : natural := 31;
+
+  -- FILTER_SET_DATA register reset values
+  constant FSET_DATA_RSTVAL : std_logic_vector(31 downto 0) := x"00000000";
+
+  ------------------------------------------------------------------------------
+  -- RX_DROP_CTR register
+  --
+  -- Number of frames discarded from RX buffer FIFO to make room for newly recei
+  -- ved frames (RX_SETTINGS[ROVP] = ROVP_DROP_OLD).
+  ------------------------------------------------------------------------------
+  constant RX_DROP_CTR_VAL_L      : natural := 0;
+  constant RX_DROP_CTR_VAL_H     : natural := 31;
+
+  -- RX_DROP_CTR register reset values
+  constant RX_DROP_CTR_VAL_RSTVAL
+                 : std_logic_vector(31 downto 0) := x"00000000";
+
+  ------------------------------------------------------------------------------
+  -- RX_DMA_CTRL register
+  --
+  -- RX DMA control register. RX DMA moves received frames from RX buffer to a r
+  -- ing of frame slots in system memory. Each slot is 128 bytes long and contai
+  -- ns one frame in the same format as read from RX_DATA. Ring must be configur
+  -- ed before RX DMA is enabled.
+  ------------------------------------------------------------------------------
+  constant RDENA_IND              : natural := 0;
+  constant RDRS_L                 : natural := 4;
+  constant RDRS_H                 : natural := 7;
+  constant RDBATCH_L              : natural := 8;
+  constant RDBATCH_H             : natural := 15;
+  constant RDTMO_L               : natural := 16;
+  constant RDTMO_H               : natural := 31;
+
+  -- "RDENA" field enumerated values
+  constant RDMA_DISABLED      : std_logic := '0';
+  constant RDMA_ENABLED       : std_logic := '1';
+
+  -- RX_DMA_CTRL register reset values
+  constant RDENA_RSTVAL       : std_logic := '0';
+  constant RDRS_RSTVAL : std_logic_vector(3 downto 0) := x"0";
+  constant RDBATCH_RSTVAL : std_logic_vector(7 downto 0) := x"00";
+  constant RDTMO_RSTVAL : std_logic_vector(15 downto 0) := x"0000";
+
+  ------------------------------------------------------------------------------
+  -- RX_DMA_BASE register
+  --
+  -- Base address of RX DMA ring in system memory. Ring must be aligned to 128 b
+  -- ytes.
+  ------------------------------------------------------------------------------
+  constant RDBASE_L               : natural := 7;
+  constant RDBASE_H              : natural := 31;
+
+  -- RX_DMA_BASE register reset values
+  constant RDBASE_RSTVAL : std_logic_vector(24 downto 0) := (OTHERS => '0');
+
+  ------------------------------------------------------------------------------
+  -- RX_DMA_CONS register
+  --
+  -- Consumer index of RX DMA ring. SW writes index of next slot it will read. R
+  -- ing is full when incremented producer index (modulo ring size) equals consu
+  -- mer index.
+  ------------------------------------------------------------------------------
+  constant RDCONS_L               : natural := 0;
+  constant RDCONS_H              : natural := 11;
+
+  -- RX_DMA_CONS register reset values
+  constant RDCONS_RSTVAL : std_logic_vector(11 downto 0) := x"000";
+
+  ------------------------------------------------------------------------------
+  -- RX_DMA_STATUS register
+  --
+  -- RX DMA status register.
+  ------------------------------------------------------------------------------
+  constant RDPROD_L               : natural := 0;
+  constant RDPROD_H              : natural := 11;
+  constant RDACT_IND             : natural := 16;
+  constant RDBERR_IND            : natural := 17;
+
+  -- RX_DMA_STATUS register reset values
+  constant RDPROD_RSTVAL : std_logic_vector(11 downto 0) := x"000";
+  constant RDACT_RSTVAL       : std_logic := '0';
+  constant RDBERR_RSTVAL      : std_logic := '0';
+
+  ------------------------------------------------------------------------------
+  -- TX_FIFO_CTRL register
+  --
+  -- Control of TXT FIFO. TXT FIFO takes place of the last TXT Buffer when prese
+  -- nt.
+  ------------------------------------------------------------------------------
+  constant TFTH_L                 : natural := 0;
+  constant TFTH_H                 : natural := 6;
+
+  -- TX_FIFO_CTRL register reset values
+  constant TFTH_RSTVAL : std_logic_vector(6 downto 0) := "0000000";
+
+  ------------------------------------------------------------------------------
+  -- TX_FIFO_STATUS register
+  --
+  -- Status of TXT FIFO.
+  ------------------------------------------------------------------------------
+  constant TFFL_L                : natural := 16;
+  constant TFFL_H                : natural := 22;
+  constant TFFULL_IND            : natural := 23;
+  constant TFDEPTH_L             : natural := 24;
+  constant TFDEPTH_H             : natural := 30;
+
+  -- TX_FIFO_STATUS register reset values
+  constant TFFL_RSTVAL : std_logic_vector(6 downto 0) := "0000000";
+  constant TFFULL_RSTVAL      : std_logic := '0';
+
+  ------------------------------------------------------------------------------
+  -- INT_TS_SEL register
+  --
+  -- Selects interrupt whose pending timestamp is returned in INT_TS register.
+  ------------------------------------------------------------------------------
+  constant ITSEL_L                : natural := 0;
+  constant ITSEL_H                : natural := 3;
+
+  -- INT_TS_SEL register reset values
+  constant ITSEL_RSTVAL : std_logic_vector(3 downto 0) := x"0";
+
+  ------------------------------------------------------------------------------
+  -- INT_TS register
+  --
+  -- Timestamp of interrupt pending.
+  ------------------------------------------------------------------------------
+  constant ITS_VAL_L              : natural := 0;
+  constant ITS_VAL_H             : natural := 31;
+
+  -- INT_TS register reset values
+  constant ITS_VAL_RSTVAL : std_logic_vector(31 downto 0) := x"00000000";
+
+  ------------------------------------------------------------------------------
+  -- BUS_STAT_SEL register
+  --
+  -- Selects bus statistics counter whose snapshot is returned in BUS_STAT regis
+  -- ter.
+  ------------------------------------------------------------------------------
+  constant BSSEL_L                : natural := 0;
+  constant BSSEL_H                : natural := 2;
+
+  -- "BSSEL" field enumerated values
+  constant BS_BUSY_BITS : std_logic_vector(2 downto 0) := "000";
+  constant BS_IDLE_BITS : std_logic_vector(2 downto 0) := "001";
+  constant BS_ERR_FRMS : std_logic_vector(2 downto 0) := "010";
+  constant BS_OVR_FRMS : std_logic_vector(2 downto 0) := "011";
+  constant BS_STUFF_BITS : std_logic_vector(2 downto 0) := "100";
+
+  -- BUS_STAT_SEL register reset values
+  constant BSSEL_RSTVAL : std_logic_vector(2 downto 0) := "000";
+
+  ------------------------------------------------------------------------------
+  -- BUS_STAT register
+  --
+  -- Snapshot of bus statistics counter.
+  ------------------------------------------------------------------------------
+  constant BS_VAL_L               : natural := 0;
+  constant BS_VAL_H              : natural := 31;
+
+  -- BUS_STAT register reset values
+  constant BS_VAL_RSTVAL : std_logic_vector(31 downto 0) := x"00000000";
+
+  ------------------------------------------------------------------------------
+  -- TXTB_TS_SEL register
+  --
+  -- Selects TXT buffer whose transmission start timestamp is returned in TXTB_T
+  -- S_LOW and TXTB_TS_HIGH registers.
+  ------------------------------------------------------------------------------
+  constant TTSEL_L                : natural := 0;
+  constant TTSEL_H                : natural := 2;
+
+  -- TXTB_TS_SEL register reset values
+  constant TTSEL_RSTVAL : std_logic_vector(2 downto 0) := "000";
+
+  ------------------------------------------------------------------------------
+  -- TXTB_TS_LOW register
+  --
+  -- Transmission start timestamp of TXT buffer, lower word.
+  ------------------------------------------------------------------------------
+  constant TXTB_TS_LOW_L          : natural := 0;
+  constant TXTB_TS_LOW_H         : natural := 31;
+
+  -- TXTB_TS_LOW register reset values
+  constant TXTB_TS_LOW_RSTVAL : std_logic_vector(31 downto 0) := x"00000000";
+
+  ------------------------------------------------------------------------------
+  -- TXTB_TS_HIGH register
+  --
+  -- Transmission start timestamp of TXT buffer, upper word.
+  ------------------------------------------------------------------------------
+  constant TXTB_TS_HIGH_L         : natural := 0;
+  constant TXTB_TS_HIGH_H        : natural := 31;
+
+  -- TXTB_TS_HIGH register reset values
+  constant TXTB_TS_HIGH_RSTVAL : std_logic_vector(31 downto 0) := x"00000000";
+
+  ------------------------------------------------------------------------------
+  -- TS_INC register
+  --
+  -- Increment of internal timestamp generator in each cycle of system clock. Al
+  -- lows to tune rate of timestamp (e.g. to count nanoseconds and to follow ref
+  -- erence clock).
+  ------------------------------------------------------------------------------
+  constant TS_INC_FRAC_L          : natural := 0;
+  constant TS_INC_FRAC_H         : natural := 23;
+  constant TS_INC_INT_L          : natural := 24;
+  constant TS_INC_INT_H          : natural := 31;
+
+  -- TS_INC register reset values
+  constant TS_INC_FRAC_RSTVAL : std_logic_vector(23 downto 0) := x"000000";
+  constant TS_INC_INT_RSTVAL : std_logic_vector(7 downto 0) := x"01";
+
+  ------------------------------------------------------------------------------
+  -- TS_STEP_LOW register
+  --
+  -- Value for COMMAND[TSSTEP] and COMMAND[TSSET], lower word.
+  ------------------------------------------------------------------------------
+  constant TS_STEP_LOW_L          : natural := 0;
+  constant TS_STEP_LOW_H         : natural := 31;
+
+  -- TS_STEP_LOW register reset values
+  constant TS_STEP_LOW_RSTVAL : std_logic_vector(31 downto 0) := x"00000000";
+
+  ------------------------------------------------------------------------------
+  -- TS_STEP_HIGH register
+  --
+  -- Value for COMMAND[TSSTEP] and COMMAND[TSSET], upper word.
+  ------------------------------------------------------------------------------
+  constant TS_STEP_HIGH_L         : natural := 0;
+  constant TS_STEP_HIGH_H        : natural := 31;
+
+  -- TS_STEP_HIGH register reset values
+  constant TS_STEP_HIGH_RSTVAL : std_logic_vector(31 downto 0) := x"00000000";
+
+  ------------------------------------------------------------------------------
+  -- RX_PEEK_FFW register
+  --
+  -- FRAME_FORMAT_W of the oldest frame in RX buffer FIFO. Reading this register
+  --  does not move the read pointer. Together with RX_PEEK_IDW and COMMAND[RXSK
+  -- IP], it allows SW to reject a frame without reading its data words.
+  ------------------------------------------------------------------------------
+  constant RX_PEEK_FFW_VAL_L      : natural := 0;
+  constant RX_PEEK_FFW_VAL_H     : natural := 31;
+
+  -- RX_PEEK_FFW register reset values
+  constant RX_PEEK_FFW_VAL_RSTVAL
+                 : std_logic_vector(31 downto 0) := x"00000000";
+
+  ------------------------------------------------------------------------------
+  -- RX_PEEK_IDW register
+  --
+  -- IDENTIFIER_W of the oldest frame in RX buffer FIFO. Reading this register d
+  -- oes not move the read pointer.
+  ------------------------------------------------------------------------------
+  constant RX_PEEK_IDW_VAL_L      : natural := 0;
+  constant RX_PEEK_IDW_VAL_H     : natural := 31;
+
+  -- RX_PEEK_IDW register reset values
+  constant RX_PEEK_IDW_VAL_RSTVAL
+                 : std_logic_vector(31 downto 0) := x"00000000";
+
+  ------------------------------------------------------------------------------
+  -- TXT_CYC_SEL register
+  --
+  -- Selects TXT buffer whose period is written by TXT_CYC_PERIOD and whose skip
+  --  counter is returned in TXT_CYC_SKIP.
+  ------------------------------------------------------------------------------
+  constant TCSEL_L                : natural := 0;
+  constant TCSEL_H                : natural := 2;
+
+  -- TXT_CYC_SEL register reset values
+  constant TCSEL_RSTVAL : std_logic_vector(2 downto 0) := "000";
+
+  ------------------------------------------------------------------------------
+  -- TXT_CYC_SKIP register
+  --
+  -- Number of cyclic slots of TXT buffer selected by TXT_CYC_SEL which were ski
+  -- pped since its period was written. Saturates at 0xFFFF.
+  ------------------------------------------------------------------------------
+  constant TCSKIP_L              : natural := 16;
+  constant TCSKIP_H              : natural := 31;
+
+  -- TXT_CYC_SKIP register reset values
+  constant TCSKIP_RSTVAL : std_logic_vector(15 downto 0) := x"0000";
+
+  ------------------------------------------------------------------------------
+  -- TXT_CYC_PERIOD register
+  --
+  -- Writing this register sets period of cyclic transmission (in timestamp unit
+  -- s) of TXT buffer selected by TXT_CYC_SEL and clears its skip counter. Zero 
+  -- disables cyclic transmission. Read returns last written value.
+  ------------------------------------------------------------------------------
+  constant TXT_CYC_PERIOD_L       : natural := 0;
+  constant TXT_CYC_PERIOD_H      : natural := 31;
+
+  -- TXT_CYC_PERIOD register reset values
+  constant TXT_CYC_PERIOD_RSTVAL : std_logic_vector(31 downto 0) := x"00000000";
+
+  ------------------------------------------------------------------------------
+  -- TX_CPL_TS register
+  --
+  -- Lower 32 bits of timestamp when TXT buffer of the oldest record in TX compl
+  -- etion FIFO reached its final state. Reading this register does not remove t
+  -- he record. Reads as zero when TX completion FIFO is empty.
+  ------------------------------------------------------------------------------
+  constant TX_CPL_TS_VAL_L        : natural := 0;
+  constant TX_CPL_TS_VAL_H       : natural := 31;
+
+  -- TX_CPL_TS register reset values
+  constant TX_CPL_TS_VAL_RSTVAL : std_logic_vector(31 downto 0) := x"00000000";
+
+  ------------------------------------------------------------------------------
+  -- TX_CPL register
+  --
+  -- The oldest record of TX completion FIFO. Record is stored each time a TXT b
+  -- uffer moves to TX OK, TX failed or TX aborted state. Reading this register 
+  -- removes the record from TX completion FIFO. When TX completion FIFO is empt
+  -- y, TCV is 0 and read has no effect. This register shall be read by 32 bit a
+  -- ccess.
+  ------------------------------------------------------------------------------
+  constant TCIDX_L                : natural := 0;
+  constant TCIDX_H                : natural := 2;
+  constant TCST_L                 : natural := 4;
+  constant TCST_H                 : natural := 7;
+  constant TCRC_L                 : natural := 8;
+  constant TCRC_H                : natural := 11;
+  constant TCCNT_L               : natural := 16;
+  constant TCCNT_H               : natural := 20;
+  constant TCOF_IND              : natural := 30;
+  constant TCV_IND               : natural := 31;
+
+  -- TX_CPL register reset values
+  constant TCIDX_RSTVAL : std_logic_vector(2 downto 0) := "000";
+  constant TCST_RSTVAL : std_logic_vector(3 downto 0) := x"0";
+  constant TCRC_RSTVAL : std_logic_vector(3 downto 0) := x"0";
+  constant TCCNT_RSTVAL : std_logic_vector(4 downto 0) := "00000";
+  constant TCOF_RSTVAL        : std_logic := '0';
+  constant TCV_RSTVAL         : std_logic := '0';
+
   ------------------------------------------------------------------------------
   -- TXTB1_DATA_1 register
   --
@@ -1477,4 +1964,74 @@ package can_fd_register_map is
 
   -- TST_RDATA register reset values
 
+  ------------------------------------------------------------------------------
+  -- RX_DATA_WINDOW register
+  --
+  -- Start of RX data window.
+  ------------------------------------------------------------------------------
+  constant RX_DATA_WINDOW_L       : natural := 0;
+  constant RX_DATA_WINDOW_H      : natural := 31;
+
+  -- RX_DATA_WINDOW register reset values
+
+  ------------------------------------------------------------------------------
+  -- RXP_CTRL register
+  --
+  -- Routing of frames to Priority RX buffer and commands of Priority RX buffer.
+  ------------------------------------------------------------------------------
+  constant RPRA_IND               : natural := 0;
+  constant RPRB_IND               : natural := 1;
+  constant RPRC_IND               : natural := 2;
+  constant RPRR_IND               : natural := 3;
+  constant RPRS_IND               : natural := 4;
+  constant RPRRB_IND              : natural := 8;
+  constant RPCDO_IND              : natural := 9;
+
+  -- RXP_CTRL register reset values
+  constant RPRA_RSTVAL        : std_logic := '0';
+  constant RPRB_RSTVAL        : std_logic := '0';
+  constant RPRC_RSTVAL        : std_logic := '0';
+  constant RPRR_RSTVAL        : std_logic := '0';
+  constant RPRS_RSTVAL        : std_logic := '0';
+  constant RPRRB_RSTVAL       : std_logic := '0';
+  constant RPCDO_RSTVAL       : std_logic := '0';
+
+  ------------------------------------------------------------------------------
+  -- RXP_MEM_INFO register
+  --
+  ------------------------------------------------------------------------------
+  constant RXP_BUFF_SIZE_L        : natural := 0;
+  constant RXP_BUFF_SIZE_H       : natural := 12;
+  constant RXP_MEM_FREE_L        : natural := 16;
+  constant RXP_MEM_FREE_H        : natural := 28;
+
+  -- RXP_MEM_INFO register reset values
+
+  ------------------------------------------------------------------------------
+  -- RXP_STATUS register
+  --
+  ------------------------------------------------------------------------------
+  constant RXPE_IND               : natural := 0;
+  constant RXPF_IND               : natural := 1;
+  constant RXPMOF_IND             : natural := 2;
+  constant RXPFRC_L               : natural := 4;
+  constant RXPFRC_H              : natural := 14;
+  constant RXPDOR_IND            : natural := 15;
+
+  -- RXP_STATUS register reset values
+  constant RXPE_RSTVAL        : std_logic := '1';
+  constant RXPF_RSTVAL        : std_logic := '0';
+  constant RXPMOF_RSTVAL      : std_logic := '0';
+  constant RXPFRC_RSTVAL : std_logic_vector(10 downto 0) := (OTHERS => '0');
+  constant RXPDOR_RSTVAL      : std_logic := '0';
+
+  ------------------------------------------------------------------------------
+  -- RXP_DATA register
+  --
+  ------------------------------------------------------------------------------
+  constant RXP_DATA_L             : natural := 0;
+  constant RXP_DATA_H            : natural := 31;
+
+  -- RXP_DATA register reset values
+
 end package;
@@ -166,9 +166,19 @@ package can_types_pkg is
         s_rxb_skip_ts_high,
         s_rxb_store_end_ts_low,
         s_rxb_store_end_ts_high,
+        s_rxb_store_eof_ts_low,
+        s_rxb_store_eof_ts_high,
         s_rxb_store_data
     );
 
+    -- RX DMA state type
+    type t_rx_dma_state is (
+        s_rdma_idle,
+        s_rdma_read,
+        s_rdma_write,
+        s_rdma_commit
+    );
+
     -- TX arbitrator state type
     type t_tx_arb_state is (
         s_arb_idle,
@@ -206,6 +216,10 @@ package can_types_pkg is
     -- States of Buffers
     type t_txt_bufs_state is array (integer range <>) of
         std_logic_vector(3 downto 0);
+
+    -- Skipped slots of cyclic transmission
+    type t_txt_bufs_cyc_skip is array (integer range <>) of
+        std_logic_vector(15 downto 0);
     
     -- SW commands
     type t_txtb_sw_cmd is record
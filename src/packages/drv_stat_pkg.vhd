@@ -171,11 +171,78 @@ package drv_stat_pkg is
     
     constant DRV_FILTER_DROP_RF_INDEX : natural := 330;
 
+    constant DRV_FILTER_SET_CTRL_LOW  : natural := 331;
+    constant DRV_FILTER_SET_CTRL_HIGH : natural := 334;
+
+    constant DRV_FILTER_SET_WR_INDEX   : natural := 335;
+    constant DRV_FILTER_SET_TSEL_INDEX : natural := 336;
+
+    constant DRV_FILTER_SET_ADDR_LOW  : natural := 337;
+    constant DRV_FILTER_SET_ADDR_HIGH : natural := 346;
+
+    constant DRV_FILTER_SET_DATA_LOW  : natural := 975;
+    constant DRV_FILTER_SET_DATA_HIGH : natural := 1006;
+
     -- RX Buffer
     constant DRV_ERASE_RX_INDEX   : natural := 350;
     constant DRV_RTSOPT_INDEX     : natural := 351;
     constant DRV_READ_START_INDEX : natural := 352;
     constant DRV_CLR_OVR_INDEX    : natural := 353;
+    constant DRV_RX_DROP_OLD_INDEX : natural := 347;
+    constant DRV_CLR_RX_DROP_CTR_INDEX : natural := 348;
+    constant DRV_RTSB_INDEX       : natural := 349;
+    constant DRV_RX_SKIP_INDEX    : natural := 354;
+
+    -- RX DMA
+    constant DRV_RX_DMA_ENA_INDEX   : natural := 909;
+
+    constant DRV_RX_DMA_RS_LOW      : natural := 910;
+    constant DRV_RX_DMA_RS_HIGH     : natural := 913;
+
+    constant DRV_RX_DMA_BATCH_LOW   : natural := 914;
+    constant DRV_RX_DMA_BATCH_HIGH  : natural := 921;
+
+    constant DRV_RX_DMA_TMO_LOW     : natural := 922;
+    constant DRV_RX_DMA_TMO_HIGH    : natural := 937;
+
+    constant DRV_RX_DMA_BASE_LOW    : natural := 938;
+    constant DRV_RX_DMA_BASE_HIGH   : natural := 962;
+
+    constant DRV_RX_DMA_CONS_LOW    : natural := 963;
+    constant DRV_RX_DMA_CONS_HIGH   : natural := 974;
+
+    -- TXT FIFO
+    constant DRV_TX_FIFO_TH_LOW     : natural := 1007;
+    constant DRV_TX_FIFO_TH_HIGH    : natural := 1013;
+
+    -- Interrupt timestamp selector
+    constant DRV_INT_TS_SEL_LOW     : natural := 1014;
+    constant DRV_INT_TS_SEL_HIGH    : natural := 1017;
+
+    -- TXT Buffer transmission start timestamp selector
+    constant DRV_TXTB_TS_SEL_LOW    : natural := 1018;
+    constant DRV_TXTB_TS_SEL_HIGH   : natural := 1020;
+
+    -- Cyclic transmission of TXT Buffers
+    constant DRV_TXT_CYC_PERIOD_LOW  : natural := 614;
+    constant DRV_TXT_CYC_PERIOD_HIGH : natural := 645;
+
+    constant DRV_TXT_CYC_WR_INDEX    : natural := 646;
+
+    constant DRV_TXT_CYC_SEL_LOW     : natural := 647;
+    constant DRV_TXT_CYC_SEL_HIGH    : natural := 649;
+
+    -- TX completion FIFO - remove oldest record
+    constant DRV_TX_CPL_POP_INDEX    : natural := 650;
+
+    -- Priority RX Buffer - routing bits (filter A, B, C, range, ID set)
+    constant DRV_RXP_ROUTE_LOW       : natural := 651;
+    constant DRV_RXP_ROUTE_HIGH      : natural := 655;
+
+    -- Priority RX Buffer - read word, erase buffer, clear data overrun
+    constant DRV_RXP_READ_START_INDEX : natural := 656;
+    constant DRV_RXP_ERASE_INDEX      : natural := 657;
+    constant DRV_RXP_CLR_OVR_INDEX    : natural := 658;
 
     -- TXT Buffer
     constant DRV_TXT1_WR          : natural := 357;
@@ -185,19 +252,19 @@ package drv_stat_pkg is
 
 
     -- Interrupt manager indices 
-    constant DRV_INT_CLR_HIGH   : natural := 747;
+    constant DRV_INT_CLR_HIGH   : natural := 751;
     constant DRV_INT_CLR_LOW    : natural := 736;
 
-    constant DRV_INT_ENA_SET_HIGH     : natural := 779;
+    constant DRV_INT_ENA_SET_HIGH     : natural := 783;
     constant DRV_INT_ENA_SET_LOW      : natural := 768;
 
-    constant DRV_INT_ENA_CLR_HIGH   : natural := 811;
+    constant DRV_INT_ENA_CLR_HIGH   : natural := 815;
     constant DRV_INT_ENA_CLR_LOW    : natural := 800;
 
-    constant DRV_INT_MASK_SET_HIGH   : natural := 843;
+    constant DRV_INT_MASK_SET_HIGH   : natural := 847;
     constant DRV_INT_MASK_SET_LOW    : natural := 832;
 
-    constant DRV_INT_MASK_CLR_HIGH   : natural := 875;
+    constant DRV_INT_MASK_CLR_HIGH   : natural := 879;
     constant DRV_INT_MASK_CLR_LOW    : natural := 864;
 
     constant DRV_SSP_DELAY_SELECT_HIGH : natural := 374;
@@ -241,6 +308,12 @@ package drv_stat_pkg is
     constant DRV_CLR_RX_CTR_INDEX : natural := 473;
     constant DRV_CLR_TX_CTR_INDEX : natural := 474;
 
+    -- Bus statistics counters
+    constant DRV_BUS_STAT_SNAP_INDEX : natural := 880;
+
+    constant DRV_BUS_STAT_SEL_LOW    : natural := 881;
+    constant DRV_BUS_STAT_SEL_HIGH   : natural := 883;
+
     constant DRV_ACK_FORB_INDEX        : natural := 507;
     constant DRV_INT_LOOBACK_ENA_INDEX : natural := 508;
 
@@ -434,4 +507,7 @@ package drv_stat_pkg is
     
     constant STAT_PEXS_INDEX                : natural := 385;
 
+    constant STAT_BUS_STAT_CTR_LOW          : natural := 386;
+    constant STAT_BUS_STAT_CTR_HIGH         : natural := 417;
+
 end package;
@@ -76,6 +76,15 @@
 --  RX Buffer is continously stored as it is being received. At the end of frame
 --  it is committed to memory, and becomes available to the user. If Overrun
 --  or Release receive Buffer occured meanwhile, frame is reverted.
+--  When "drop oldest" overflow policy is set, oldest stored frames are
+--  discarded during storing of new frame until there is enough space for it.
+--  When both timestamps are configured (RX_SETTINGS[RTSB]), timestamp from
+--  start of frame is stored to TIMESTAMP_L_W/TIMESTAMP_U_W and timestamp
+--  from end of frame is stored as two additional words after data words.
+--  FRAME_FORMAT_W and IDENTIFIER_W of the oldest frame are fetched from RAM
+--  when the frame becomes the oldest one, and provided to SW without moving
+--  the read pointer. Skip command (COMMAND[RXSKIP]) discards the oldest frame
+--  (or its unread remainder) in one clock cycle.
 --------------------------------------------------------------------------------
 
 Library ieee;
@@ -200,6 +209,14 @@ entity rx_buffer is
         
         -- Middle of frame indication
         rx_mof               :out    std_logic;
+
+        -- Number of frames discarded to make room for received frames
+        rx_drop_ctr          :out    std_logic_vector(31 downto 0);
+
+        -- FRAME_FORMAT_W and IDENTIFIER_W of the oldest frame (zeroes when
+        -- not available)
+        rx_peek_ffw          :out    std_logic_vector(31 downto 0);
+        rx_peek_idw          :out    std_logic_vector(31 downto 0);
         
         -- External timestamp input
         timestamp            :in     std_logic_vector(63 downto 0);
@@ -212,6 +229,9 @@ entity rx_buffer is
         
         -- Driving bus from registers
         drv_bus              :in     std_logic_vector(1023 downto 0);
+
+        -- Read word by RX DMA (same as read of RX_DATA register)
+        dma_read_start       :in     std_logic;
         
         -- Test registers
         test_registers_out   :in     test_registers_out_t;
@@ -239,6 +259,18 @@ architecture rtl of rx_buffer is
     -- Receive Timestamp options
     signal drv_rtsopt               :       std_logic;
 
+    -- Overflow policy (drop oldest frame instead of received frame)
+    signal drv_rx_drop_old          :       std_logic;
+
+    -- Clear counter of discarded frames
+    signal drv_clr_rx_drop_ctr      :       std_logic;
+
+    -- Store both timestamps (start and end of frame)
+    signal drv_rtsb                 :       std_logic;
+
+    -- Skip oldest frame
+    signal drv_rx_skip              :       std_logic;
+
 
     ----------------------------------------------------------------------------
     -- FIFO  Memory - Pointers
@@ -250,6 +282,10 @@ architecture rtl of rx_buffer is
     -- Read pointer incremented by 1 (combinationally)
     signal read_pointer_inc_1       : std_logic_vector(11 downto 0);
 
+    -- Read pointer moved to next frame when oldest frame is dropped or
+    -- skipped (combinationally)
+    signal read_pointer_drop        : std_logic_vector(11 downto 0);
+
     -- Write pointer (committed, available to SW, after frame was stored)
     signal write_pointer            : std_logic_vector(11 downto 0);
 
@@ -337,6 +373,59 @@ architecture rtl of rx_buffer is
     -- truly written to the memory and raw pointer can be updated!
     signal write_raw_OK             :       std_logic;
 
+    -- Discard oldest frame stored in RX Buffer to make room for received
+    -- frame. Read pointer moves to next frame.
+    signal drop_oldest              :       std_logic;
+
+
+    ----------------------------------------------------------------------------
+    -- Drop oldest overflow policy
+    ----------------------------------------------------------------------------
+
+    -- Length (in words) of frame which is being stored, including FRAME_FORMAT
+    -- word. Combinationally decoded from metadata and registered for the rest
+    -- of frame storing.
+    signal store_frame_len_com      :       unsigned(4 downto 0);
+    signal store_frame_len_q        :       unsigned(4 downto 0);
+    signal store_frame_len          :       unsigned(4 downto 0);
+
+    -- Length (in words) of oldest frame in RX Buffer, including FRAME_FORMAT
+    -- word. Decoded from FRAME_FORMAT word on read pointer.
+    signal oldest_frame_len         :       std_logic_vector(4 downto 0);
+
+    -- Frame is being stored to RX Buffer
+    signal storing_frame            :       std_logic;
+
+    -- Counter of discarded frames
+    signal rx_drop_ctr_q            :       unsigned(31 downto 0);
+
+
+    ----------------------------------------------------------------------------
+    -- Header peek and skip of oldest frame
+    ----------------------------------------------------------------------------
+
+    -- Skip oldest frame (or remainder of frame being read)
+    signal skip_frame               :       std_logic;
+
+    -- Oldest frame is dropped or skipped, read pointer moves to next frame
+    signal drop_frame               :       std_logic;
+
+    -- Number of words released by "drop_frame"
+    signal drop_length              :       std_logic_vector(4 downto 0);
+
+    -- Word on read pointer. RAM output, or fetched FRAME_FORMAT_W in the
+    -- cycle when RAM output holds IDENTIFIER_W.
+    signal head_word                :       std_logic_vector(31 downto 0);
+
+    -- Fetch of header: RAM is read on read pointer + 1 (IDENTIFIER_W)
+    signal peek_fetch               :       std_logic;
+    signal peek_idw_fetch_q         :       std_logic;
+
+    -- Fetched header of oldest frame
+    signal head_ffw_q               :       std_logic_vector(31 downto 0);
+    signal head_idw_q               :       std_logic_vector(31 downto 0);
+    signal head_valid_q             :       std_logic;
+
 
     ----------------------------------------------------------------------------
     -- RX Buffer FSM outputs
@@ -353,7 +442,7 @@ architecture rtl of rx_buffer is
     signal stored_ts                :       std_logic;
 
     -- Data write selector
-    signal data_selector            :       std_logic_vector(4 downto 0);
+    signal data_selector            :       std_logic_vector(6 downto 0);
 
     -- Signals that write pointer should be stored to timestamp write pointer
     signal store_ts_wr_ptr          :       std_logic;
@@ -373,6 +462,15 @@ architecture rtl of rx_buffer is
     -- from received DLC (the size is in 32-bit words).
     signal rwcnt_com                :       natural range 0 to 31;
 
+    -- Size of the frame (without Frame format word) without end of frame
+    -- timestamp words.
+    signal rwcnt_data               :       unsigned(4 downto 0);
+
+    -- Both timestamps are stored for frame. Latched at the beginning of frame
+    -- storing, so that change of configuration does not corrupt stored frame.
+    signal rtsb_q                   :       std_logic;
+    signal rtsb_eff                 :       std_logic;
+
     -- Combinational decoded frame format word from metadata.
     signal frame_form_w             :       std_logic_vector(31 downto 0);
 
@@ -383,6 +481,10 @@ architecture rtl of rx_buffer is
     -- Clock enable signal for timestamp capture register 
     signal timestamp_capture_ce     :       std_logic;
 
+    -- Timestamp captured at the end of frame, stored after data words when
+    -- both timestamps are stored.
+    signal timestamp_eof            :       std_logic_vector(63 downto 0);
+
 
     ----------------------------------------------------------------------------
     -- RAM wrapper signals
@@ -419,9 +521,13 @@ begin
     -- Driving bus aliases
     ----------------------------------------------------------------------------
     drv_erase_rx          <= drv_bus(DRV_ERASE_RX_INDEX);
-    drv_read_start        <= drv_bus(DRV_READ_START_INDEX);
+    drv_read_start        <= drv_bus(DRV_READ_START_INDEX) or dma_read_start;
     drv_clr_ovr           <= drv_bus(DRV_CLR_OVR_INDEX);
     drv_rtsopt            <= drv_bus(DRV_RTSOPT_INDEX);
+    drv_rx_drop_old       <= drv_bus(DRV_RX_DROP_OLD_INDEX);
+    drv_clr_rx_drop_ctr   <= drv_bus(DRV_CLR_RX_DROP_CTR_INDEX);
+    drv_rtsb              <= drv_bus(DRV_RTSB_INDEX);
+    drv_rx_skip           <= drv_bus(DRV_RX_SKIP_INDEX);
 
 
     ----------------------------------------------------------------------------
@@ -443,6 +549,15 @@ begin
     rx_frame_count       <= std_logic_vector(to_unsigned(frame_count, 11)); 
     rx_mem_free          <= rx_mem_free_i;
     rx_empty             <= rx_empty_i;
+    rx_drop_ctr          <= std_logic_vector(rx_drop_ctr_q);
+    rx_peek_ffw          <= head_ffw_q when (head_valid_q = '1' and
+                                             rx_empty_i = '0')
+                                       else
+                            (OTHERS => '0');
+    rx_peek_idw          <= head_idw_q when (head_valid_q = '1' and
+                                             rx_empty_i = '0')
+                                       else
+                            (OTHERS => '0');
 
     ----------------------------------------------------------------------------
     -- Common reset signal. Whole buffer can be reset by two ways:
@@ -496,6 +611,7 @@ begin
         store_data_f        => store_data_f,        -- IN
         rec_valid_f         => rec_valid_f,         -- IN
         rec_abort_f         => rec_abort_f,         -- IN
+        store_eof_ts        => rtsb_q,              -- IN
         
         write_raw_intent    => write_raw_intent,    -- OUT
         write_ts            => write_ts,            -- OUT
@@ -525,9 +641,12 @@ begin
         store_ts_wr_ptr         => store_ts_wr_ptr,         -- IN
         inc_ts_wr_ptr           => inc_ts_wr_ptr,           -- IN
         read_increment          => read_increment,          -- IN
+        drop_frame              => drop_frame,              -- IN
+        drop_length             => drop_length,             -- IN
         
         read_pointer            => read_pointer,            -- OUT
         read_pointer_inc_1      => read_pointer_inc_1,      -- OUT
+        read_pointer_drop       => read_pointer_drop,       -- OUT
         write_pointer           => write_pointer,           -- OUT
         write_pointer_raw       => write_pointer_raw,       -- OUT
         write_pointer_ts        => write_pointer_ts,        -- OUT
@@ -539,11 +658,13 @@ begin
     -- Memory data which are written depend on state of the FSM
     ----------------------------------------------------------------------------
     with data_selector select memory_write_data <=
-        frame_form_w                     when "00001",
-        "000" & rec_ident                when "00010",
-        store_data_word                  when "00100",
-        timestamp_capture(31 downto 0)   when "01000",
-        timestamp_capture(63 downto 32)  when "10000",
+        frame_form_w                     when "0000001",
+        "000" & rec_ident                when "0000010",
+        store_data_word                  when "0000100",
+        timestamp_capture(31 downto 0)   when "0001000",
+        timestamp_capture(63 downto 32)  when "0010000",
+        timestamp_eof(31 downto 0)       when "0100000",
+        timestamp_eof(63 downto 32)      when "1000000",
         (OTHERS => '0')                  when others;
 
 
@@ -595,7 +716,7 @@ begin
     -- provide zeroes instead. This guarantees that zeroes are read even if
     -- memory content is not defined ater power-up!
     ----------------------------------------------------------------------------
-    rx_read_buff <= RAM_data_out when (rx_empty_i = '0') else
+    rx_read_buff <= head_word when (rx_empty_i = '0') else
                     (OTHERS => '0');
 
 
@@ -640,22 +761,50 @@ begin
     --  1. For RTR Frames -> 3 (Only ID + 2 Timestamp words)
     --  2. For Normal CAN Frames with DLC > 8 max. 8 bytes -> RWCNT = 5
     --  3. Otherwise Number of data bytes is matching Received DLC!
+    -- When both timestamps are stored, two words of end of frame timestamp
+    -- are added.
     ----------------------------------------------------------------------------
-    frame_form_w(RWCNT_H downto RWCNT_L)  <=
+    rwcnt_data <=
         "00011" when (rec_is_rtr = RTR_FRAME) else
         "00101" when ((rec_frame_type = NORMAL_CAN) and (rec_dlc(3) = '1')) else
-         std_logic_vector(to_unsigned(rwcnt_com, (RWCNT_H - RWCNT_L + 1)));
+         to_unsigned(rwcnt_com, (RWCNT_H - RWCNT_L + 1));
+
+    frame_form_w(RWCNT_H downto RWCNT_L)  <=
+        std_logic_vector(rwcnt_data + 2) when (rtsb_eff = '1') else
+        std_logic_vector(rwcnt_data);
+
+    frame_form_w(ETS_IND)                 <= rtsb_eff;
+    frame_form_w(31 downto 17)            <= (OTHERS => '0');
+
+    ----------------------------------------------------------------------------
+    -- Storing of both timestamps is latched when storing of frame starts.
+    ----------------------------------------------------------------------------
+    rtsb_proc : process(clk_sys, res_n)
+    begin
+        if (res_n = '0') then
+            rtsb_q <= '0';
+        elsif (rising_edge(clk_sys)) then
+            if (store_metadata_f = '1') then
+                rtsb_q <= drv_rtsb;
+            end if;
+        end if;
+    end process;
 
-    frame_form_w(31 downto 16)            <= (OTHERS => '0');
+    rtsb_eff <= drv_rtsb when (store_metadata_f = '1') else
+                rtsb_q;
 
 
     ----------------------------------------------------------------------------
     -- Capturing timestamp. Done at the beginning or end of frame based on
-    -- SW configuration.
+    -- SW configuration. When both timestamps are stored, timestamp from the
+    -- beginning of frame is captured here, and timestamp from the end of
+    -- frame is captured separately.
     ----------------------------------------------------------------------------
-    timestamp_capture_ce <= '1' when (drv_rtsopt = RTS_END and rec_valid_f = '1')
+    timestamp_capture_ce <= '1' when (drv_rtsopt = RTS_END and drv_rtsb = '0' and
+                                      rec_valid_f = '1')
                                 else
-                            '1' when (drv_rtsopt = RTS_BEG and sof_pulse = '1')
+                            '1' when ((drv_rtsopt = RTS_BEG or drv_rtsb = '1') and
+                                      sof_pulse = '1')
                                 else
                             '0';
                             
@@ -670,6 +819,17 @@ begin
         end if;
     end process;
 
+    capt_eof_ts_proc : process(clk_sys, res_n)
+    begin
+        if (res_n = '0') then
+            timestamp_eof           <= (OTHERS => '0');
+        elsif (rising_edge(clk_sys)) then
+            if (rec_valid_f = '1') then
+                timestamp_eof       <= timestamp;
+            end if;
+        end if;
+    end process;
+
 
     ----------------------------------------------------------------------------
     -- Reading counter (read_counter_q) which is loaded by RWCNT during read
@@ -685,7 +845,7 @@ begin
     -- decrementing the "frame_count".
     ---------------------------------------------------------------------------
     read_counter_d <= read_counter_q - 1 when (read_counter_q > "00000") else
-                      unsigned(RAM_data_out(RWCNT_H downto RWCNT_L));
+                      unsigned(head_word(RWCNT_H downto RWCNT_L));
     
     read_frame_proc : process(clk_sys, rx_buf_res_n_q_scan)
     begin
@@ -700,6 +860,8 @@ begin
             --------------------------------------------------------------------
             if (read_increment = '1') then
                 read_counter_q <= read_counter_d;
+            elsif (skip_frame = '1') then
+                read_counter_q <= (OTHERS => '0');
             end if;
         end if;    
     end process;
@@ -719,8 +881,10 @@ begin
 
         elsif (rising_edge(clk_sys)) then
 
-            -- Read of last word, but no new commit
-            if ((read_increment = '1') and (read_counter_q = "00001")) then
+            -- Read of last word or drop/skip of oldest frame, but no new commit
+            if (((read_increment = '1') and (read_counter_q = "00001")) or
+                (drop_frame = '1'))
+            then
                 if (commit_rx_frame = '0') then
                     frame_count           <= frame_count - 1;
                 end if;
@@ -734,9 +898,145 @@ begin
     end process;
     
 
+    ----------------------------------------------------------------------------
+    -- Drop oldest overflow policy. When frame is being stored and there is not
+    -- enough free memory for whole frame, oldest frame is discarded (one frame
+    -- per clock cycle). Oldest frame can't be discarded while user is reading
+    -- it (RX_STATUS[RXMOF]). In such case, regular overrun may occur.
+    --
+    -- Length of stored frame is taken directly from metadata when storing
+    -- starts. Since each frame is at least 4 words long, and FSM stores at
+    -- most one word per clock cycle, dropping always keeps ahead of storing.
+    ----------------------------------------------------------------------------
+    store_frame_len_com <= unsigned(frame_form_w(RWCNT_H downto RWCNT_L)) + 1;
+
+    store_frame_len_proc : process(clk_sys, res_n)
+    begin
+        if (res_n = '0') then
+            store_frame_len_q <= (OTHERS => '0');
+        elsif (rising_edge(clk_sys)) then
+            if (store_metadata_f = '1') then
+                store_frame_len_q <= store_frame_len_com;
+            end if;
+        end if;
+    end process;
+
+    store_frame_len <= store_frame_len_com when (store_metadata_f = '1') else
+                       store_frame_len_q;
+
+    -- FSM is out of idle state only when frame is being stored
+    storing_frame <= '1' when (store_metadata_f = '1' or
+                               reset_overrun_flag = '0')
+                         else
+                     '0';
+
+    oldest_frame_len <= std_logic_vector(
+                            unsigned(head_word(RWCNT_H downto RWCNT_L)) + 1);
+
+    drop_oldest <= '1' when (drv_rx_drop_old = ROVP_DROP_OLD and
+                             storing_frame = '1' and
+                             data_overrun_i = '0' and
+                             drv_erase_rx = '0' and
+                             rx_empty_i = '0' and
+                             read_counter_q = "00000" and
+                             read_increment = '0' and
+                             skip_frame = '0' and
+                             unsigned(rx_mem_free_i) < store_frame_len)
+                       else
+                   '0';
+
+    ----------------------------------------------------------------------------
+    -- Counter of discarded frames. Not erased by Release Receive Buffer command.
+    ----------------------------------------------------------------------------
+    rx_drop_ctr_proc : process(clk_sys, res_n)
+    begin
+        if (res_n = '0') then
+            rx_drop_ctr_q <= (OTHERS => '0');
+        elsif (rising_edge(clk_sys)) then
+            if (drv_clr_rx_drop_ctr = '1') then
+                rx_drop_ctr_q <= (OTHERS => '0');
+            elsif (drop_oldest = '1') then
+                rx_drop_ctr_q <= rx_drop_ctr_q + 1;
+            end if;
+        end if;
+    end process;
+
+
+    ----------------------------------------------------------------------------
+    -- Skip of oldest frame. When the frame is not being read, whole frame is
+    -- discarded (as with drop oldest policy). When user already read part of
+    -- the frame (RX_STATUS[RXMOF]), remaining words are discarded. Skip has
+    -- priority over drop of oldest frame, which then follows in next cycle if
+    -- still needed. Skipped frames are not counted in RX_DROP_CTR.
+    ----------------------------------------------------------------------------
+    skip_frame <= '1' when (drv_rx_skip = '1' and
+                            drv_erase_rx = '0' and
+                            rx_empty_i = '0' and
+                            read_increment = '0')
+                      else
+                  '0';
+
+    drop_frame <= drop_oldest or skip_frame;
+
+    drop_length <= oldest_frame_len when (read_counter_q = "00000") else
+                   std_logic_vector(read_counter_q);
+
+
+    ----------------------------------------------------------------------------
+    -- Header peek. When a frame becomes the oldest one, its FRAME_FORMAT_W is
+    -- on RAM output. In the cycle when RAM is not read otherwise, it is
+    -- latched, and RAM is read on read pointer + 1 to get IDENTIFIER_W. In the
+    -- next cycle, IDENTIFIER_W is latched and RAM is read on read pointer
+    -- again. During this cycle, latched FRAME_FORMAT_W substitutes RAM output,
+    -- so read of RX_DATA, drop and skip may occur in any cycle.
+    --
+    -- Header becomes invalid when the oldest frame leaves RX Buffer. If user
+    -- starts reading the frame before the header was fetched, peek registers
+    -- read as zero until the next frame becomes the oldest one.
+    ----------------------------------------------------------------------------
+    peek_fetch <= '1' when (rx_empty_i = '0' and
+                            head_valid_q = '0' and
+                            peek_idw_fetch_q = '0' and
+                            read_counter_q = "00000" and
+                            read_increment = '0' and
+                            drop_frame = '0')
+                      else
+                  '0';
+
+    head_word <= head_ffw_q when (peek_idw_fetch_q = '1') else
+                 RAM_data_out;
+
+    peek_proc : process(clk_sys, rx_buf_res_n_q_scan)
+    begin
+        if (rx_buf_res_n_q_scan = '0') then
+            head_ffw_q          <= (OTHERS => '0');
+            head_idw_q          <= (OTHERS => '0');
+            head_valid_q        <= '0';
+            peek_idw_fetch_q    <= '0';
+        elsif (rising_edge(clk_sys)) then
+            peek_idw_fetch_q    <= peek_fetch;
+
+            if (peek_fetch = '1') then
+                head_ffw_q      <= RAM_data_out;
+            end if;
+
+            if (drop_frame = '1' or
+                (read_increment = '1' and read_counter_q = "00001"))
+            then
+                head_valid_q    <= '0';
+            elsif (peek_idw_fetch_q = '1') then
+                head_idw_q      <= RAM_data_out;
+                head_valid_q    <= '1';
+            end if;
+        end if;
+    end process;
+
+
     ----------------------------------------------------------------------------
     -- Commit RX Frame when last word was written and overrun did not occur!
     -- This can be either from "rxb_store_data" state or "rxb_store_end_ts_high"
+    -- or "rxb_store_eof_ts_high". Last word of end of frame timestamp is
+    -- written in the same cycle, so overrun on it must abort the frame too.
     ----------------------------------------------------------------------------
     commit_proc : process(clk_sys, rx_buf_res_n_q_scan)
     begin
@@ -747,7 +1047,7 @@ begin
         elsif (rising_edge(clk_sys)) then
 
             if (stored_ts = '1') then
-                if (data_overrun_i = '0') then
+                if (data_overrun_i = '0' and overrun_condition = '0') then
                     commit_rx_frame         <= '1';
                 else
                     commit_overrun_abort    <= '1';
@@ -823,9 +1123,14 @@ begin
     -- Clock gating for RAM. Enable when:
     -- 1. CAN Core is writing
     -- 2. Reading occurs from register map.
-    -- 3. Permanently when Memory testing is enabled, or in scan mode
-    ----------------------------------------------------------------------------
-    rx_buf_ram_clk_en <= '1' when (RAM_write = '1' or drv_read_start = '1')
+    -- 3. Oldest frame is dropped or skipped (next frame becomes available on
+    --    read side).
+    -- 4. Header of oldest frame is fetched.
+    -- 5. Permanently when Memory testing is enabled, or in scan mode
+    ----------------------------------------------------------------------------
+    rx_buf_ram_clk_en <= '1' when (RAM_write = '1' or drv_read_start = '1' or
+                                   drop_frame = '1' or peek_fetch = '1' or
+                                   peek_idw_fetch_q = '1')
                              else
                          '1' when (test_registers_out.tst_control(TMAENA_IND) = '1' or
                                    scan_enable = '1')
@@ -886,9 +1191,13 @@ begin
     -- RAM read address is given by read pointers. If no transaction for read
     -- of RX DATA is in progress, read pointer is given by its real value.
     -- During transaction, Incremented Read pointer is chosen to avoid one clock
-    -- cycle delay caused by increment on read pointer!
+    -- cycle delay caused by increment on read pointer! The same is done when
+    -- oldest frame is dropped or skipped. IDENTIFIER_W is fetched from
+    -- incremented read pointer too.
     ----------------------------------------------------------------------------
-    RAM_read_address <= read_pointer_inc_1 when (read_increment = '1') else
+    RAM_read_address <= read_pointer_inc_1 when (read_increment = '1' or
+                                                 peek_fetch = '1') else
+                        read_pointer_drop when (drop_frame = '1') else
                               read_pointer;
                               
 
@@ -949,8 +1258,7 @@ begin
 
             elsif (store_metadata_f = '1') then
 
-                exp_data_stores := to_integer(unsigned(
-                                    frame_form_w(RWCNT_H downto RWCNT_L))) - 3;
+                exp_data_stores := to_integer(rwcnt_data) - 3;
                 act_data_stores := 0;
             end if;
 
@@ -980,8 +1288,13 @@ begin
     -- psl default clock is rising_edge(clk_sys);
     
     -- psl read_counter_lt_rwcnt_asrt : assert never
-    --  (read_counter_q > 19)
+    --  (read_counter_q > 21)
     -- report "Read counter higher than longest RWCNT!";
+
+    -- psl drop_oldest_len_asrt : assert never
+    --  (drop_oldest = '1' and (unsigned(oldest_frame_len) < 4 or
+    --                          unsigned(oldest_frame_len) > 22))
+    -- report "Dropped frame has invalid length!";
     
     ----------------------------------------------------------------------------
     ----------------------------------------------------------------------------
@@ -1042,6 +1355,12 @@ begin
     -- psl rx_buf_eof_timestamp :
     --      cover {drv_rtsopt = RTS_END and commit_rx_frame = '1'};
     --
+    -- psl rx_buf_both_timestamps_cov :
+    --      cover {rtsb_q = '1' and commit_rx_frame = '1'};
+    --
+    -- psl rx_buf_both_timestamps_overrun_cov :
+    --      cover {rtsb_q = '1' and commit_overrun_abort = '1'};
+    --
     -- psl rx_buf_burst_read_short_cov :
     --      cover {(read_increment = '1')[*4]};
     --
@@ -1050,6 +1369,24 @@ begin
     -- Note: SW reads the frame like so: Read metadata one by one and then 16 data words.
     --       Therefore highest burst achievable is 16 with current TB!
     
+    -- psl rx_buf_drop_oldest_cov :
+    --      cover {drop_oldest = '1'};
+    --
+    -- psl rx_buf_drop_oldest_multiple_cov :
+    --      cover {drop_oldest = '1'; drop_oldest = '1'};
+    --
+    -- psl rx_buf_drop_oldest_blocked_by_read_cov :
+    --      cover {drv_rx_drop_old = ROVP_DROP_OLD and overrun_condition = '1'};
+    --
+    -- psl rx_buf_skip_frame_cov :
+    --      cover {skip_frame = '1' and read_counter_q = "00000"};
+    --
+    -- psl rx_buf_skip_frame_mof_cov :
+    --      cover {skip_frame = '1' and read_counter_q /= "00000"};
+    --
+    -- psl rx_buf_read_during_peek_fetch_cov :
+    --      cover {read_increment = '1' and peek_idw_fetch_q = '1'};
+    --
     -- psl rx_buf_frame_abort_cov :
     --      cover {rec_abort_f = '1'};
     --
@@ -117,6 +117,12 @@ entity rx_buffer_fsm is
         -- Abort storing of RX Frame to RX Buffer.
         rec_abort_f          :in     std_logic;
 
+        -----------------------------------------------------------------------
+        -- Configuration
+        -----------------------------------------------------------------------
+        -- Store also timestamp captured at the end of frame (after data words)
+        store_eof_ts         :in     std_logic;
+
         -----------------------------------------------------------------------
         -- FSM outputs
         -----------------------------------------------------------------------
@@ -131,7 +137,7 @@ entity rx_buffer_fsm is
 
         -- Data selector for selection of memory word to be stored in RX Buffer 
         -- RAM (one hot coded)
-        data_selector        :out    std_logic_vector(4 downto 0);
+        data_selector        :out    std_logic_vector(6 downto 0);
 
         -- Load timestamp write pointer from regular write pointer
         store_ts_wr_ptr      :out    std_logic;
@@ -164,7 +170,7 @@ begin
     -- Next State process
     ----------------------------------------------------------------------------
     next_state_proc : process(curr_state, store_metadata_f, rec_abort_f, 
-        rec_valid_f)
+        rec_valid_f, store_eof_ts)
     begin
         next_state <= curr_state;
         
@@ -230,9 +236,26 @@ begin
             next_state      <= s_rxb_store_end_ts_high;
 
         --------------------------------------------------------------------
-        -- Store first TIMESTAMP_U_W.
+        -- Store first TIMESTAMP_U_W. If both timestamps are stored, continue
+        -- with end of frame timestamp after data words.
         --------------------------------------------------------------------
         when s_rxb_store_end_ts_high =>
+            if (store_eof_ts = '1') then
+                next_state      <= s_rxb_store_eof_ts_low;
+            else
+                next_state      <= s_rxb_idle;
+            end if;
+
+        --------------------------------------------------------------------
+        -- Store lower word of end of frame timestamp.
+        --------------------------------------------------------------------
+        when s_rxb_store_eof_ts_low =>
+            next_state      <= s_rxb_store_eof_ts_high;
+
+        --------------------------------------------------------------------
+        -- Store upper word of end of frame timestamp.
+        --------------------------------------------------------------------
+        when s_rxb_store_eof_ts_high =>
             next_state      <= s_rxb_idle;
             
         end case;
@@ -242,7 +265,7 @@ begin
     ----------------------------------------------------------------------------
     -- Current State process (outputs)
     ----------------------------------------------------------------------------
-    curr_state_proc : process(curr_state, store_data_f)
+    curr_state_proc : process(curr_state, store_data_f, store_eof_ts)
     begin
         write_raw_intent <= '0';
         write_ts <= '0'; 
@@ -258,11 +281,11 @@ begin
             
         when s_rxb_store_frame_format =>
             write_raw_intent <= '1';
-            data_selector    <= "00001";
+            data_selector    <= "0000001";
             
         when s_rxb_store_identifier =>
             write_raw_intent <= '1';
-            data_selector    <= "00010";
+            data_selector    <= "0000010";
 
         when s_rxb_skip_ts_low =>
             write_raw_intent <= '1';
@@ -275,14 +298,14 @@ begin
             write_raw_intent <= '1';
             
         when s_rxb_store_data =>
-            data_selector    <= "00100";
+            data_selector    <= "0000100";
             
             if (store_data_f = '1') then
                 write_raw_intent      <= '1';
             end if;
             
         when s_rxb_store_end_ts_low =>
-            data_selector    <= "01000";
+            data_selector    <= "0001000";
 
             -- Timestamp write pointer is incremented once more when lower
             -- timestamp word was stored, to point to higher timestamp word.
@@ -292,13 +315,25 @@ begin
             write_ts   <= '1';
             
         when s_rxb_store_end_ts_high =>
-            data_selector    <= "10000";
+            data_selector    <= "0010000";
             
-            -- Storing of timestamp is ending and frame can be committed.
-            stored_ts <= '1';
+            -- Storing of timestamp is ending and frame can be committed,
+            -- unless end of frame timestamp follows.
+            stored_ts <= not store_eof_ts;
             
             -- Signalling that timestamp is stored to memory.
             write_ts   <= '1';
+
+        when s_rxb_store_eof_ts_low =>
+            write_raw_intent <= '1';
+            data_selector    <= "0100000";
+
+        when s_rxb_store_eof_ts_high =>
+            write_raw_intent <= '1';
+            data_selector    <= "1000000";
+
+            -- Storing of timestamp is ending and frame can be committed.
+            stored_ts <= '1';
         end case;
     end process;
     
@@ -347,7 +382,9 @@ begin
     --  (rec_abort_f = '1') and
     --  (curr_state = s_rxb_store_identifier or curr_state = s_rxb_skip_ts_low or
     --   curr_state = s_rxb_skip_ts_high or curr_state = s_rxb_store_end_ts_low or
-    --   curr_state = s_rxb_store_end_ts_high)
+    --   curr_state = s_rxb_store_end_ts_high or
+    --   curr_state = s_rxb_store_eof_ts_low or
+    --   curr_state = s_rxb_store_eof_ts_high)
     --  report "RX Buffer abort not supported storing of Identifier and Timestamp";
 
     -- <RELEASE_ON>
@@ -80,6 +80,9 @@
 --  Counters for free memory:
 --    1. RX mem free internal for control of storing and overrun
 --    2. RX mem free available to user.
+--  Read pointer moves by one word on read from RX_DATA, or by whole frame
+--  when oldest frame is dropped or skipped. When frame is skipped while it is
+--  being read, read pointer moves by the words which were not read yet.
 --------------------------------------------------------------------------------
 
 Library ieee;
@@ -141,6 +144,13 @@ entity rx_buffer_pointers is
         -- RX Buffer RAM is being read by SW
         read_increment       :in     std_logic;
 
+        -- Oldest frame is dropped or skipped, read pointer moves to next
+        -- frame
+        drop_frame           :in     std_logic;
+
+        -- Number of words to drop (remaining words of oldest frame)
+        drop_length          :in     std_logic_vector(4 downto 0);
+
         -----------------------------------------------------------------------
         -- Status outputs
         -----------------------------------------------------------------------
@@ -150,6 +160,9 @@ entity rx_buffer_pointers is
         -- Read pointer incremented by 1 (combinationally)
         read_pointer_inc_1     :out  std_logic_vector(11 downto 0);
 
+        -- Read pointer moved by length of dropped frame (combinationally)
+        read_pointer_drop      :out  std_logic_vector(11 downto 0);
+
         -- Write pointer (committed, available to SW, after frame was stored)
         write_pointer          :out  std_logic_vector(11 downto 0);
 
@@ -193,6 +206,7 @@ architecture rtl of rx_buffer_pointers is
 
     signal read_pointer_i        :       unsigned(C_PTR_WIDTH - 1 downto 0);
     signal read_pointer_inc_1_i  :       unsigned(C_PTR_WIDTH - 1 downto 0);
+    signal read_pointer_drop_i   :       unsigned(C_PTR_WIDTH - 1 downto 0);
     signal write_pointer_i       :       unsigned(C_PTR_WIDTH - 1 downto 0);
     
     signal write_pointer_raw_i   :       unsigned(C_PTR_WIDTH - 1 downto 0);
@@ -212,21 +226,26 @@ architecture rtl of rx_buffer_pointers is
     -- Raw value of number of free memory words.
     signal rx_mem_free_raw          :  unsigned(C_FREE_MEM_WIDTH - 1 downto 0);
 
+    -- Number of words released from memory in this clock cycle. 1 when
+    -- reading RX_DATA, "drop_length" when oldest frame is dropped or skipped.
+    signal rx_mem_free_inc          :  unsigned(C_FREE_MEM_WIDTH - 1 downto 0);
+
     -- Number of free memory words calculated during frame storing before commit
-    -- combinationally incremented by 1.
-    signal rx_mem_free_raw_inc_1    :  unsigned(C_FREE_MEM_WIDTH - 1 downto 0);
+    -- combinationally incremented by released words.
+    signal rx_mem_free_raw_inc      :  unsigned(C_FREE_MEM_WIDTH - 1 downto 0);
 
     -- Number of free memory words calculated during frame storing before commit
-    -- combinationally decremented by 1.
-    signal rx_mem_free_raw_dec_1    :  unsigned(C_FREE_MEM_WIDTH - 1 downto 0);
+    -- combinationally incremented by released words and decremented by 1.
+    signal rx_mem_free_raw_inc_dec_1 : unsigned(C_FREE_MEM_WIDTH - 1 downto 0);
 
-    -- Number of free memory words available to SW, combinationally icnremented
-    -- by 1.
-    signal rx_mem_free_i_inc_1      :  unsigned(C_FREE_MEM_WIDTH - 1 downto 0);
+    -- Number of free memory words available to SW, combinationally incremented
+    -- by released words.
+    signal rx_mem_free_i_inc        :  unsigned(C_FREE_MEM_WIDTH - 1 downto 0);
 
 begin
     read_pointer            <= std_logic_vector(resize(read_pointer_i, 12));
     read_pointer_inc_1      <= std_logic_vector(resize(read_pointer_inc_1_i, 12));
+    read_pointer_drop       <= std_logic_vector(resize(read_pointer_drop_i, 12));
     write_pointer           <= std_logic_vector(resize(write_pointer_i, 12));
     write_pointer_raw       <= std_logic_vector(resize(write_pointer_raw_i, 12));
     write_pointer_ts        <= std_logic_vector(resize(write_pointer_ts_i, 12));
@@ -235,7 +254,8 @@ begin
 
     ----------------------------------------------------------------------------
     -- Read pointer, incremented during read from RX Buffer FIFO.
-    -- Moving to next word by reading (if there is sth to read).
+    -- Moving to next word by reading (if there is sth to read), or to next
+    -- frame when oldest frame is dropped or skipped.
     ----------------------------------------------------------------------------
     read_pointer_proc : process(clk_sys, rx_buf_res_n_q_scan)
     begin
@@ -244,6 +264,8 @@ begin
         elsif (rising_edge(clk_sys)) then
             if (read_increment = '1') then
                 read_pointer_i    <= read_pointer_inc_1_i;
+            elsif (drop_frame = '1') then
+                read_pointer_i    <= read_pointer_drop_i;
             end if;
         end if;
     end process;
@@ -316,8 +338,17 @@ begin
 
 
     ----------------------------------------------------------------------------
-    -- Calculating amount of free memory.
+    -- Calculating amount of free memory. Read of RX_DATA releases one word,
+    -- dropping or skipping of oldest frame releases its remaining words. These
+    -- never occur at the same time.
     ----------------------------------------------------------------------------
+    rx_mem_free_inc <= to_unsigned(1, C_FREE_MEM_WIDTH) when (read_increment = '1')
+                                                      else
+                       resize(unsigned(drop_length), C_FREE_MEM_WIDTH)
+                                                      when (drop_frame = '1')
+                                                      else
+                       (OTHERS => '0');
+
     mem_free_proc : process(clk_sys, rx_buf_res_n_q_scan)
     begin
         if (rx_buf_res_n_q_scan = '0') then
@@ -329,49 +360,32 @@ begin
             --------------------------------------------------------------------
             -- Calculate free memory internally (raw)
             --------------------------------------------------------------------
-            if (read_increment = '1') then
 
-                -- Read of memory word, and abort at the same time. Revert last
-                -- commited value of read pointer incremented by 1.
-                if (rec_abort_f = '1' or commit_overrun_abort = '1') then
-                    rx_mem_free_raw <= rx_mem_free_i_inc_1;
+            -- Abort, or abort was previously flaged -> Revert last commited
+            -- value (plus words released meanwhile).
+            if (rec_abort_f = '1' or commit_overrun_abort = '1') then
+                rx_mem_free_raw <= rx_mem_free_i_inc;
 
-                -- Read of memory word and no write of memory word. Load raw
-                -- value incremented by 1.
-                elsif (write_raw_OK = '0') then
-                    rx_mem_free_raw <= rx_mem_free_raw_inc_1;
-
-                -- Implicit else: Read increment and write of a word at the same
-                -- time, rx_mem_free_raw remains unchanged.
-                end if;
+            -- Write of memory word, decrement by 1 (plus words released
+            -- meanwhile).
+            elsif (write_raw_OK = '1') then
+                rx_mem_free_raw <= rx_mem_free_raw_inc_dec_1;
 
+            -- No write, only words released (if any).
             else
-
-                -- Abort, or abort was previously flaged -> Revert last commited
-                -- value.
-                if (rec_abort_f = '1' or commit_overrun_abort = '1') then
-                    rx_mem_free_raw <= rx_mem_free_i_i;
-
-                -- No read, write only, decrement by 1.
-                elsif (write_raw_OK = '1') then
-                    rx_mem_free_raw <= rx_mem_free_raw_dec_1;
-                end if;
+                rx_mem_free_raw <= rx_mem_free_raw_inc;
             end if;
 
             --------------------------------------------------------------------
             -- Calculate free memory for user:
-            --      1. Increment when user reads the frame.
+            --      1. Increment when user reads the frame or frame is dropped
+            --         or skipped.
             --      2. Load RAW value when comitt occurs
             --------------------------------------------------------------------
-            if (read_increment = '1') then
-                if (commit_rx_frame = '1') then        
-                    rx_mem_free_i_i <= rx_mem_free_raw_inc_1;
-                else
-                    rx_mem_free_i_i <= rx_mem_free_i_inc_1;
-                end if;
-    
-            elsif (commit_rx_frame = '1') then
-                rx_mem_free_i_i     <= rx_mem_free_raw;
+            if (commit_rx_frame = '1') then
+                rx_mem_free_i_i     <= rx_mem_free_raw_inc;
+            else
+                rx_mem_free_i_i     <= rx_mem_free_i_inc;
             end if;
 
         end if;
@@ -381,11 +395,12 @@ begin
     ----------------------------------------------------------------------------
     -- Calculating incremented value of free memory combinationally
     ----------------------------------------------------------------------------
-    mem_free_arith_proc : process(rx_mem_free_i_i, rx_mem_free_raw)
+    mem_free_arith_proc : process(rx_mem_free_i_i, rx_mem_free_raw,
+        rx_mem_free_inc)
     begin
-        rx_mem_free_i_inc_1     <= rx_mem_free_i_i + 1;
-        rx_mem_free_raw_inc_1   <= rx_mem_free_raw + 1;
-        rx_mem_free_raw_dec_1   <= rx_mem_free_raw - 1;
+        rx_mem_free_i_inc           <= rx_mem_free_i_i + rx_mem_free_inc;
+        rx_mem_free_raw_inc         <= rx_mem_free_raw + rx_mem_free_inc;
+        rx_mem_free_raw_inc_dec_1   <= rx_mem_free_raw + rx_mem_free_inc - 1;
     end process;
 
     ----------------------------------------------------------------------------
@@ -400,6 +415,14 @@ begin
     begin
         read_pointer_inc_1_i <= read_pointer_i + 1;
     end process;
+
+    ----------------------------------------------------------------------------
+    -- Read pointer of next frame when oldest frame is dropped or skipped.
+    -- Pointer width is at least 5 bits (minimal RX Buffer size is 32 words),
+    -- so frame length always fits.
+    ----------------------------------------------------------------------------
+    read_pointer_drop_i <= read_pointer_i +
+                           resize(unsigned(drop_length), C_PTR_WIDTH);
     
     -- <RELEASE_OFF>
     ----------------------------------------------------------------------------
@@ -0,0 +1,479 @@
+--------------------------------------------------------------------------------
+-- 
+-- CTU CAN FD IP Core 
+-- Copyright (C) 2021-present Ondrej Ille
+-- 
+-- Permission is hereby granted, free of charge, to any person obtaining a copy
+-- of this VHDL component and associated documentation files (the "Component"),
+-- to use, copy, modify, merge, publish, distribute the Component for
+-- educational, research, evaluation, self-interest purposes. Using the
+-- Component for commercial purposes is forbidden unless previously agreed with
+-- Copyright holder.
+-- 
+-- The above copyright notice and this permission notice shall be included in
+-- all copies or substantial portions of the Component.
+-- 
+-- THE COMPONENT IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+-- IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+-- FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+-- AUTHORS OR COPYRIGHTHOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+-- LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+-- FROM, OUT OF OR IN CONNECTION WITH THE COMPONENT OR THE USE OR OTHER DEALINGS
+-- IN THE COMPONENT.
+-- 
+-- The CAN protocol is developed by Robert Bosch GmbH and protected by patents.
+-- Anybody who wants to implement this IP core on silicon has to obtain a CAN
+-- protocol license from Bosch.
+-- 
+-- -------------------------------------------------------------------------------
+-- 
+-- CTU CAN FD IP Core 
+-- Copyright (C) 2015-2020 MIT License
+-- 
+-- Authors:
+--     Ondrej Ille <ondrej.ille@gmail.com>
+--     Martin Jerabek <martin.jerabek01@gmail.com>
+-- 
+-- Project advisors: 
+-- 	Jiri Novak <jnovak@fel.cvut.cz>
+-- 	Pavel Pisa <pisa@cmp.felk.cvut.cz>
+-- 
+-- Department of Measurement         (http://meas.fel.cvut.cz/)
+-- Faculty of Electrical Engineering (http://www.fel.cvut.cz)
+-- Czech Technical University        (http://www.cvut.cz/)
+-- 
+-- Permission is hereby granted, free of charge, to any person obtaining a copy
+-- of this VHDL component and associated documentation files (the "Component"),
+-- to deal in the Component without restriction, including without limitation
+-- the rights to use, copy, modify, merge, publish, distribute, sublicense,
+-- and/or sell copies of the Component, and to permit persons to whom the
+-- Component is furnished to do so, subject to the following conditions:
+-- 
+-- The above copyright notice and this permission notice shall be included in
+-- all copies or substantial portions of the Component.
+-- 
+-- THE COMPONENT IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+-- IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+-- FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+-- AUTHORS OR COPYRIGHTHOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+-- LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+-- FROM, OUT OF OR IN CONNECTION WITH THE COMPONENT OR THE USE OR OTHER DEALINGS
+-- IN THE COMPONENT.
+-- 
+-- The CAN protocol is developed by Robert Bosch GmbH and protected by patents.
+-- Anybody who wants to implement this IP core on silicon has to obtain a CAN
+-- protocol license from Bosch.
+-- 
+--------------------------------------------------------------------------------
+
+--------------------------------------------------------------------------------
+-- Module:
+--  RX DMA.
+--
+-- Purpose:
+--  Moves received frames from RX Buffer to a ring of frame slots in system
+--  memory via bus master interface. Ring has 2^RX_DMA_CTRL[RDRS] slots, each
+--  slot is 128 bytes long (32 words) and it is aligned to its size. Frame is
+--  stored to a slot in the same format as it is read from RX_DATA (FRAME_FORMAT
+--  word first). Unused words at the end of slot are not written.
+--
+--  Ring is handled by Producer index (RX_DMA_STATUS[RDPROD], owned by RX DMA)
+--  and Consumer index (RX_DMA_CONS, owned by SW). RX DMA moves a frame only
+--  when there is a free slot, one slot is always left empty to distinguish
+--  full and empty ring. If the ring is full, frames remain in RX Buffer.
+--  Producer index is incremented after all words of the frame were written,
+--  so SW never observes partially written slot.
+--
+--  Each frame is read word by word from RX Buffer (as if read from RX_DATA)
+--  and written by single write transfer of bus master interface. Bus master
+--  holds "dma_m_req" together with address and data until "dma_m_ack". If
+--  "dma_m_err" is active together with "dma_m_ack", RX DMA sets RDBERR, reads
+--  the rest of the frame from RX Buffer without writing it, and stops.
+--
+--  Interrupt is signalled after RX_DMA_CTRL[RDBATCH] frames were moved (0 is
+--  interpreted as 1), or when RX_DMA_CTRL[RDTMO] x 256 clock cycles elapsed
+--  since the first frame which was not signalled yet (0 disables timeout).
+--
+--  When RX_DMA_CTRL[RDENA] is cleared, RX DMA finishes the frame it is moving
+--  (RX_DMA_STATUS[RDACT]), and then it resets Producer index and RDBERR.
+--------------------------------------------------------------------------------
+
+Library ieee;
+use ieee.std_logic_1164.all;
+use ieee.numeric_std.ALL;
+
+Library ctu_can_fd_rtl;
+use ctu_can_fd_rtl.id_transfer_pkg.all;
+use ctu_can_fd_rtl.can_constants_pkg.all;
+
+use ctu_can_fd_rtl.can_types_pkg.all;
+use ctu_can_fd_rtl.drv_stat_pkg.all;
+use ctu_can_fd_rtl.unary_ops_pkg.all;
+
+use ctu_can_fd_rtl.CAN_FD_register_map.all;
+use ctu_can_fd_rtl.CAN_FD_frame_format.all;
+
+entity rx_dma is
+    port(
+        ------------------------------------------------------------------------
+        -- Clock and Asynchronous reset
+        ------------------------------------------------------------------------
+        -- System clock
+        clk_sys              : in  std_logic;
+
+        -- Asynchronous reset
+        res_n                : in  std_logic;
+
+        ------------------------------------------------------------------------
+        -- Memory registers interface
+        ------------------------------------------------------------------------
+        -- Driving bus
+        drv_bus              : in  std_logic_vector(1023 downto 0);
+
+        -- Producer index
+        rx_dma_prod          : out std_logic_vector(11 downto 0);
+
+        -- Frame is being moved
+        rx_dma_act           : out std_logic;
+
+        -- Stopped due to bus error
+        rx_dma_berr          : out std_logic;
+
+        ------------------------------------------------------------------------
+        -- RX Buffer interface
+        ------------------------------------------------------------------------
+        -- Actually loaded data for reading
+        rx_read_buff         : in  std_logic_vector(31 downto 0);
+
+        -- RX Buffer is empty (no frame is stored)
+        rx_empty             : in  std_logic;
+
+        -- Read word from RX Buffer
+        dma_read_start       : out std_logic;
+
+        ------------------------------------------------------------------------
+        -- Bus master interface
+        ------------------------------------------------------------------------
+        -- Write address (byte address, word aligned)
+        dma_m_addr           : out std_logic_vector(31 downto 0);
+
+        -- Write data
+        dma_m_wdata          : out std_logic_vector(31 downto 0);
+
+        -- Write request
+        dma_m_req            : out std_logic;
+
+        -- Write finished
+        dma_m_ack            : in  std_logic;
+
+        -- Write finished with error (valid with dma_m_ack)
+        dma_m_err            : in  std_logic;
+
+        ------------------------------------------------------------------------
+        -- Interrupt manager interface
+        ------------------------------------------------------------------------
+        -- Batch of frames was moved
+        rx_dma_int           : out std_logic
+    );
+end entity;
+
+architecture rtl of rx_dma is
+
+    ----------------------------------------------------------------------------
+    -- Driving bus aliases
+    ----------------------------------------------------------------------------
+    signal drv_ena              :   std_logic;
+    signal drv_rs               :   std_logic_vector(3 downto 0);
+    signal drv_batch            :   std_logic_vector(7 downto 0);
+    signal drv_tmo              :   std_logic_vector(15 downto 0);
+    signal drv_base             :   std_logic_vector(24 downto 0);
+    signal drv_cons             :   std_logic_vector(11 downto 0);
+
+    ----------------------------------------------------------------------------
+    -- Ring handling
+    ----------------------------------------------------------------------------
+    signal ring_mask            :   unsigned(11 downto 0);
+    signal prod_q               :   unsigned(11 downto 0);
+    signal prod_next            :   unsigned(11 downto 0);
+    signal ring_full            :   std_logic;
+
+    ----------------------------------------------------------------------------
+    -- Frame transfer
+    ----------------------------------------------------------------------------
+    signal curr_state           :   t_rx_dma_state;
+    signal next_state           :   t_rx_dma_state;
+
+    -- Index of word within slot
+    signal word_ctr_q           :   unsigned(4 downto 0);
+
+    -- Number of words of frame remaining after the actual word
+    signal words_left_d         :   unsigned(4 downto 0);
+    signal words_left_q         :   unsigned(4 downto 0);
+
+    signal wdata_q              :   std_logic_vector(31 downto 0);
+    signal berr_q               :   std_logic;
+
+    signal read_word            :   std_logic;
+    signal commit               :   std_logic;
+
+    ----------------------------------------------------------------------------
+    -- Interrupt batching
+    ----------------------------------------------------------------------------
+    signal batch_lim            :   unsigned(7 downto 0);
+    signal batch_ctr_q          :   unsigned(7 downto 0);
+    signal batch_ctr_inc        :   unsigned(7 downto 0);
+    signal tmo_presc_q          :   unsigned(7 downto 0);
+    signal tmo_ctr_q            :   unsigned(15 downto 0);
+    signal tmo_expired          :   std_logic;
+    signal batch_done           :   std_logic;
+
+    ----------------------------------------------------------------------------
+    -- Mask of ring index (ring has 2^rs slots, at most 4096)
+    ----------------------------------------------------------------------------
+    function ring_index_mask(
+        rs              :   std_logic_vector(3 downto 0)
+    ) return unsigned is
+        variable mask   :   unsigned(11 downto 0);
+    begin
+        for i in 0 to 11 loop
+            if (i < to_integer(unsigned(rs))) then
+                mask(i) := '1';
+            else
+                mask(i) := '0';
+            end if;
+        end loop;
+        return mask;
+    end function;
+
+begin
+
+    drv_ena   <= drv_bus(DRV_RX_DMA_ENA_INDEX);
+    drv_rs    <= drv_bus(DRV_RX_DMA_RS_HIGH downto DRV_RX_DMA_RS_LOW);
+    drv_batch <= drv_bus(DRV_RX_DMA_BATCH_HIGH downto DRV_RX_DMA_BATCH_LOW);
+    drv_tmo   <= drv_bus(DRV_RX_DMA_TMO_HIGH downto DRV_RX_DMA_TMO_LOW);
+    drv_base  <= drv_bus(DRV_RX_DMA_BASE_HIGH downto DRV_RX_DMA_BASE_LOW);
+    drv_cons  <= drv_bus(DRV_RX_DMA_CONS_HIGH downto DRV_RX_DMA_CONS_LOW);
+
+    ----------------------------------------------------------------------------
+    -- Ring is full when incremented Producer index would reach Consumer index.
+    ----------------------------------------------------------------------------
+    ring_mask <= ring_index_mask(drv_rs);
+    prod_next <= (prod_q + 1) and ring_mask;
+
+    ring_full <= '1' when (prod_next = (unsigned(drv_cons) and ring_mask))
+                     else
+                 '0';
+
+    ----------------------------------------------------------------------------
+    -- Next state process
+    ----------------------------------------------------------------------------
+    next_state_proc : process(curr_state, drv_ena, berr_q, rx_empty, ring_full,
+        words_left_d, words_left_q, dma_m_ack, dma_m_err)
+    begin
+        next_state <= curr_state;
+
+        case curr_state is
+        when s_rdma_idle =>
+            if (drv_ena = '1' and berr_q = '0' and rx_empty = '0' and
+                ring_full = '0')
+            then
+                next_state <= s_rdma_read;
+            end if;
+
+        when s_rdma_read =>
+            -- Frame was erased from RX Buffer (COMMAND[RRB]) meanwhile.
+            if (rx_empty = '1') then
+                next_state <= s_rdma_idle;
+
+            -- After bus error, rest of the frame is only read out.
+            elsif (berr_q = '1') then
+                if (words_left_d = 0) then
+                    next_state <= s_rdma_idle;
+                end if;
+            else
+                next_state <= s_rdma_write;
+            end if;
+
+        when s_rdma_write =>
+            if (dma_m_ack = '1') then
+                if (words_left_q /= 0) then
+                    next_state <= s_rdma_read;
+                elsif (dma_m_err = '1') then
+                    next_state <= s_rdma_idle;
+                else
+                    next_state <= s_rdma_commit;
+                end if;
+            end if;
+
+        when s_rdma_commit =>
+            next_state <= s_rdma_idle;
+
+        end case;
+    end process;
+
+    ----------------------------------------------------------------------------
+    -- State register
+    ----------------------------------------------------------------------------
+    state_reg_proc : process(clk_sys, res_n)
+    begin
+        if (res_n = '0') then
+            curr_state <= s_rdma_idle;
+        elsif (rising_edge(clk_sys)) then
+            curr_state <= next_state;
+        end if;
+    end process;
+
+    read_word <= '1' when (curr_state = s_rdma_read and rx_empty = '0') else
+                 '0';
+
+    commit <= '1' when (curr_state = s_rdma_commit) else
+              '0';
+
+    ----------------------------------------------------------------------------
+    -- Number of remaining words is loaded from RWCNT of FRAME_FORMAT word.
+    ----------------------------------------------------------------------------
+    words_left_d <= unsigned(rx_read_buff(RWCNT_H downto RWCNT_L))
+                        when (word_ctr_q = 0)
+                        else
+                    words_left_q - 1;
+
+    ----------------------------------------------------------------------------
+    -- Word counter, data register
+    ----------------------------------------------------------------------------
+    word_reg_proc : process(clk_sys, res_n)
+    begin
+        if (res_n = '0') then
+            word_ctr_q      <= (OTHERS => '0');
+            words_left_q    <= (OTHERS => '0');
+            wdata_q         <= (OTHERS => '0');
+        elsif (rising_edge(clk_sys)) then
+            if (curr_state = s_rdma_idle) then
+                word_ctr_q <= (OTHERS => '0');
+            elsif (curr_state = s_rdma_write and dma_m_ack = '1') then
+                word_ctr_q <= word_ctr_q + 1;
+            elsif (curr_state = s_rdma_read and berr_q = '1') then
+                word_ctr_q <= word_ctr_q + 1;
+            end if;
+
+            if (read_word = '1') then
+                words_left_q <= words_left_d;
+                wdata_q      <= rx_read_buff;
+            end if;
+        end if;
+    end process;
+
+    ----------------------------------------------------------------------------
+    -- Producer index and bus error flag. Both are reset when RX DMA is
+    -- disabled and idle.
+    ----------------------------------------------------------------------------
+    prod_reg_proc : process(clk_sys, res_n)
+    begin
+        if (res_n = '0') then
+            prod_q          <= (OTHERS => '0');
+            berr_q          <= '0';
+        elsif (rising_edge(clk_sys)) then
+            if (curr_state = s_rdma_idle and drv_ena = '0') then
+                prod_q <= (OTHERS => '0');
+                berr_q <= '0';
+            else
+                if (commit = '1') then
+                    prod_q <= prod_next;
+                end if;
+
+                if (curr_state = s_rdma_write and dma_m_ack = '1' and
+                    dma_m_err = '1')
+                then
+                    berr_q <= '1';
+                end if;
+            end if;
+        end if;
+    end process;
+
+    ----------------------------------------------------------------------------
+    -- Interrupt batching. Batch is finished when RDBATCH frames were moved,
+    -- or timeout elapsed since first frame of the batch.
+    ----------------------------------------------------------------------------
+    batch_lim <= x"01" when (drv_batch = x"00") else
+                 unsigned(drv_batch);
+
+    batch_ctr_inc <= batch_ctr_q + 1;
+
+    tmo_expired <= '1' when (batch_ctr_q /= 0 and drv_tmo /= x"0000" and
+                             tmo_ctr_q >= unsigned(drv_tmo))
+                       else
+                   '0';
+
+    batch_done <= '1' when (commit = '1' and batch_ctr_inc >= batch_lim) else
+                  '1' when (tmo_expired = '1') else
+                  '0';
+
+    batch_ctr_proc : process(clk_sys, res_n)
+    begin
+        if (res_n = '0') then
+            batch_ctr_q     <= (OTHERS => '0');
+            tmo_presc_q     <= (OTHERS => '0');
+            tmo_ctr_q       <= (OTHERS => '0');
+        elsif (rising_edge(clk_sys)) then
+            if (batch_done = '1' or drv_ena = '0') then
+                batch_ctr_q <= (OTHERS => '0');
+            elsif (commit = '1') then
+                batch_ctr_q <= batch_ctr_inc;
+            end if;
+
+            -- Timeout runs only when some frame was not signalled yet.
+            if (batch_done = '1' or batch_ctr_q = 0) then
+                tmo_presc_q <= (OTHERS => '0');
+                tmo_ctr_q   <= (OTHERS => '0');
+            else
+                tmo_presc_q <= tmo_presc_q + 1;
+                if (tmo_presc_q = x"FF") then
+                    tmo_ctr_q <= tmo_ctr_q + 1;
+                end if;
+            end if;
+        end if;
+    end process;
+
+    ----------------------------------------------------------------------------
+    -- Outputs
+    ----------------------------------------------------------------------------
+    dma_read_start <= read_word;
+
+    dma_m_addr  <= std_logic_vector(unsigned(drv_base) + resize(prod_q, 25)) &
+                   std_logic_vector(word_ctr_q) & "00";
+    dma_m_wdata <= wdata_q;
+    dma_m_req   <= '1' when (curr_state = s_rdma_write) else
+                   '0';
+
+    rx_dma_prod <= std_logic_vector(prod_q);
+    rx_dma_act  <= '0' when (curr_state = s_rdma_idle) else
+                   '1';
+    rx_dma_berr <= berr_q;
+    rx_dma_int  <= batch_done;
+
+    -- <RELEASE_OFF>
+    ----------------------------------------------------------------------------
+    -- Assertions / Functional coverage
+    ----------------------------------------------------------------------------
+    -- psl default clock is rising_edge(clk_sys);
+
+    -- psl rx_dma_frame_len_asrt : assert never
+    --  (read_word = '1' and word_ctr_q = 0 and
+    --   (unsigned(rx_read_buff(RWCNT_H downto RWCNT_L)) < 3 or
+    --    unsigned(rx_read_buff(RWCNT_H downto RWCNT_L)) > 21))
+    --  report "RX DMA: Invalid RWCNT of frame read from RX Buffer!";
+
+    -- psl rx_dma_ring_full_cov : cover
+    --  {curr_state = s_rdma_idle and drv_ena = '1' and rx_empty = '0' and
+    --   ring_full = '1'};
+
+    -- psl rx_dma_berr_cov : cover
+    --  {curr_state = s_rdma_write and dma_m_ack = '1' and dma_m_err = '1'};
+
+    -- psl rx_dma_batch_tmo_cov : cover
+    --  {tmo_expired = '1'};
+
+    -- psl rx_dma_batch_full_cov : cover
+    --  {commit = '1' and batch_ctr_inc >= batch_lim and batch_lim > 1};
+    -- <RELEASE_ON>
+
+end architecture;
@@ -0,0 +1,190 @@
+--------------------------------------------------------------------------------
+-- 
+-- CTU CAN FD IP Core 
+-- Copyright (C) 2021-present Ondrej Ille
+-- 
+-- Permission is hereby granted, free of charge, to any person obtaining a copy
+-- of this VHDL component and associated documentation files (the "Component"),
+-- to use, copy, modify, merge, publish, distribute the Component for
+-- educational, research, evaluation, self-interest purposes. Using the
+-- Component for commercial purposes is forbidden unless previously agreed with
+-- Copyright holder.
+-- 
+-- The above copyright notice and this permission notice shall be included in
+-- all copies or substantial portions of the Component.
+-- 
+-- THE COMPONENT IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+-- IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+-- FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+-- AUTHORS OR COPYRIGHTHOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+-- LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+-- FROM, OUT OF OR IN CONNECTION WITH THE COMPONENT OR THE USE OR OTHER DEALINGS
+-- IN THE COMPONENT.
+-- 
+-- The CAN protocol is developed by Robert Bosch GmbH and protected by patents.
+-- Anybody who wants to implement this IP core on silicon has to obtain a CAN
+-- protocol license from Bosch.
+-- 
+-- -------------------------------------------------------------------------------
+-- 
+-- CTU CAN FD IP Core 
+-- Copyright (C) 2015-2020 MIT License
+-- 
+-- Authors:
+--     Ondrej Ille <ondrej.ille@gmail.com>
+--     Martin Jerabek <martin.jerabek01@gmail.com>
+-- 
+-- Project advisors: 
+-- 	Jiri Novak <jnovak@fel.cvut.cz>
+-- 	Pavel Pisa <pisa@cmp.felk.cvut.cz>
+-- 
+-- Department of Measurement         (http://meas.fel.cvut.cz/)
+-- Faculty of Electrical Engineering (http://www.fel.cvut.cz)
+-- Czech Technical University        (http://www.cvut.cz/)
+-- 
+-- Permission is hereby granted, free of charge, to any person obtaining a copy
+-- of this VHDL component and associated documentation files (the "Component"),
+-- to deal in the Component without restriction, including without limitation
+-- the rights to use, copy, modify, merge, publish, distribute, sublicense,
+-- and/or sell copies of the Component, and to permit persons to whom the
+-- Component is furnished to do so, subject to the following conditions:
+-- 
+-- The above copyright notice and this permission notice shall be included in
+-- all copies or substantial portions of the Component.
+-- 
+-- THE COMPONENT IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+-- IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+-- FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+-- AUTHORS OR COPYRIGHTHOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+-- LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+-- FROM, OUT OF OR IN CONNECTION WITH THE COMPONENT OR THE USE OR OTHER DEALINGS
+-- IN THE COMPONENT.
+-- 
+-- The CAN protocol is developed by Robert Bosch GmbH and protected by patents.
+-- Anybody who wants to implement this IP core on silicon has to obtain a CAN
+-- protocol license from Bosch.
+-- 
+--------------------------------------------------------------------------------
+
+--------------------------------------------------------------------------------
+-- Module:
+--  Timestamp generator.
+--
+-- Purpose:
+--  Internal 64 bit timestamp counter with fractional rate adjustment. In each
+--  clock cycle, the counter is incremented by integer part of increment and
+--  fractional part is accumulated in fraction accumulator. Carry from the
+--  fraction accumulator adds one more to the counter. This allows SW to tune
+--  the rate of the counter in steps of 2^-24 of increment (e.g. to count in
+--  nanoseconds from arbitrary system clock and to follow a reference clock).
+--
+--  Counter can be stepped by signed offset (step command) or set to absolute
+--  value (set command). Both commands take value from "ts_step" input. Step
+--  is applied together with regular increment so that no clock cycle is lost.
+--------------------------------------------------------------------------------
+
+Library ieee;
+use ieee.std_logic_1164.all;
+use ieee.numeric_std.ALL;
+
+entity timestamp_gen is
+    port(
+        -----------------------------------------------------------------------
+        -- Clock and Asynchronous Reset
+        -----------------------------------------------------------------------
+        -- System clock
+        clk_sys        :in   std_logic;
+
+        -- Asynchronous reset
+        res_n          :in   std_logic;
+
+        -----------------------------------------------------------------------
+        -- Control signals
+        -----------------------------------------------------------------------
+        -- Increment per clock cycle (31:24 integer part, 23:0 fraction)
+        ts_inc         :in   std_logic_vector(31 downto 0);
+
+        -- Step / set value
+        ts_step        :in   std_logic_vector(63 downto 0);
+
+        -- Add "ts_step" (two's complement) to timestamp
+        ts_step_cmd    :in   std_logic;
+
+        -- Load "ts_step" to timestamp
+        ts_set_cmd     :in   std_logic;
+
+        -----------------------------------------------------------------------
+        -- Timestamp output
+        -----------------------------------------------------------------------
+        timestamp      :out  std_logic_vector(63 downto 0)
+    );
+end entity;
+
+architecture rtl of timestamp_gen is
+
+    -- Timestamp counter
+    signal ts_ctr_d     : unsigned(63 downto 0);
+    signal ts_ctr_q     : unsigned(63 downto 0);
+
+    -- Fraction accumulator (one bit wider to hold carry)
+    signal frac_acc_d   : unsigned(24 downto 0);
+    signal frac_acc_q   : unsigned(23 downto 0);
+
+    -- Increment in current clock cycle (integer part + carry from fraction)
+    signal ts_add       : unsigned(63 downto 0);
+
+    -- Step applied in current clock cycle
+    signal ts_step_add  : unsigned(63 downto 0);
+
+begin
+
+    frac_acc_d <= ('0' & frac_acc_q) + ('0' & unsigned(ts_inc(23 downto 0)));
+
+    ts_add <= resize(unsigned(ts_inc(31 downto 24)), 64) +
+              resize(frac_acc_d(24 downto 24), 64);
+
+    ts_step_add <= unsigned(ts_step) when (ts_step_cmd = '1') else
+                   (OTHERS => '0');
+
+    -- Next value (set has priority over step)
+    ts_ctr_d <= unsigned(ts_step) when (ts_set_cmd = '1') else
+                ts_ctr_q + ts_add + ts_step_add;
+
+    ---------------------------------------------------------------------------
+    -- Counter and fraction accumulator registers
+    ---------------------------------------------------------------------------
+    ts_ctr_reg_proc : process(clk_sys, res_n)
+    begin
+        if (res_n = '0') then
+            ts_ctr_q <= (OTHERS => '0');
+            frac_acc_q <= (OTHERS => '0');
+        elsif (rising_edge(clk_sys)) then
+            ts_ctr_q <= ts_ctr_d;
+            if (ts_set_cmd = '1') then
+                frac_acc_q <= (OTHERS => '0');
+            else
+                frac_acc_q <= frac_acc_d(23 downto 0);
+            end if;
+        end if;
+    end process;
+
+    timestamp <= std_logic_vector(ts_ctr_q);
+
+    -- <RELEASE_OFF>
+    ---------------------------------------------------------------------------
+    -- Functional coverage
+    ---------------------------------------------------------------------------
+
+    -- psl default clock is rising_edge(clk_sys);
+
+    -- psl ts_gen_frac_carry_cov : cover
+    --  {frac_acc_d(24) = '1'};
+
+    -- psl ts_gen_step_cov : cover
+    --  {ts_step_cmd = '1'};
+
+    -- psl ts_gen_set_cov : cover
+    --  {ts_set_cmd = '1'};
+
+    -- <RELEASE_ON>
+end architecture;
@@ -71,10 +71,22 @@
 --  Priority decoder.
 -- 
 -- Purpose:
---  Combinational decoder for TXT BufferS priority. Considers priority, bufffer
---  validity. Generic amount of buffers is available (up to 8). Decoder consists
---  of 3 levels of comparators (4+2+1). If two frames have the same priority,
---  a frame with lower index is selected.                                                                                                                                               
+--  Decoder for TXT Buffers priority. Considers priority, bufffer validity.
+--  Generic amount of buffers is available (up to 32). Decoder is a binary
+--  tree of comparators with ceil(log2(G_TXT_BUFFER_COUNT)) levels (4+2+1 for
+--  8 buffers). If two frames have the same priority, a frame with lower index
+--  is selected.
+--
+--  Tree is stored as a heap: node "k" has child nodes "2k" (lower indices)
+--  and "2k+1" (upper indices), node 1 is the root. Leafs are nodes
+--  C_LEAFS to 2 * C_LEAFS - 1, leafs above G_TXT_BUFFER_COUNT are never
+--  valid.
+--
+--  When G_PIPELINE = true, outputs of comparators in the middle level of the
+--  tree are registered, so critical path is split to half for the price of one
+--  clock cycle of selection latency. Output is masked by actual validity of
+--  selected buffer, so a buffer which is no longer valid is never selected.
+--  A buffer which became valid is selected one clock cycle later. 
 --------------------------------------------------------------------------------
 
 Library ieee;
@@ -96,9 +108,21 @@ use ctu_can_fd_rtl.CAN_FD_frame_format.all;
 entity priority_decoder is
     generic(
         -- Number of TXT Buffers
-        G_TXT_BUFFER_COUNT     : natural range 2 to 8
+        G_TXT_BUFFER_COUNT     : natural range 1 to 32;
+
+        -- Register middle level of comparator tree
+        G_PIPELINE             : boolean := false
     );
     port( 
+        ------------------------------------------------------------------------
+        -- Clock and Asynchronous reset (used only when G_PIPELINE = true)
+        ------------------------------------------------------------------------
+        -- System clock
+        clk_sys          : in  std_logic;
+
+        -- Asynchronous reset
+        res_n            : in  std_logic;
+
         ------------------------------------------------------------------------
         -- TXT Buffer information
         ------------------------------------------------------------------------
@@ -124,232 +148,160 @@ end entity;
 architecture rtl of priority_decoder is
 
     ----------------------------------------------------------------------------
-    -- Level 0 aliases for input signals to provide variable signal width
+    -- Tree dimensions
     ----------------------------------------------------------------------------
-    type level0_priority_type  is array (7 downto 0) of
-          std_logic_vector(2 downto 0);
-    signal l0_prio        : level0_priority_type;
-    signal l0_valid       : std_logic_vector(7 downto 0);
+    -- Number of comparator levels
+    constant C_LEVELS       : natural :=
+        integer(ceil(log2(real(G_TXT_BUFFER_COUNT))));
+
+    -- Number of leafs (TXT Buffer count rounded up to power of 2)
+    constant C_LEAFS        : natural := 2 ** C_LEVELS;
 
+    -- Depth of nodes whose outputs are registered when G_PIPELINE = true
+    -- (root has depth 0).
+    constant C_PIPE_DEPTH   : natural := C_LEVELS / 2;
 
     ----------------------------------------------------------------------------
-    -- Level 1 priorities and valid indicators
+    -- Tree node: highest priority in sub-tree and index of its buffer
     ----------------------------------------------------------------------------
-    type level1_priority_type  is array (3 downto 0) of
-          std_logic_vector(2 downto 0);
-    type level1_comp_valid_type is array (3 downto 0) of
-          std_logic_vector(1 downto 0);
-    signal l1_prio        : level1_priority_type;
-    signal l1_valid       : std_logic_vector(3 downto 0);
-    signal l1_winner      : std_logic_vector(3 downto 0);
+    type t_prio_dec_node is record
+        valid    : std_logic;
+        prio     : std_logic_vector(2 downto 0);
+        index    : natural range 0 to C_LEAFS - 1;
+    end record;
 
+    type t_prio_dec_node_array is array (natural range <>) of t_prio_dec_node;
+
+    constant C_NODE_RSTVAL  : t_prio_dec_node := ('0', "000", 0);
+
+    -- Combinational output of each node, and node output as seen by upper
+    -- level (registered in pipeline level).
+    signal node_d           : t_prio_dec_node_array(1 to 2 * C_LEAFS - 1);
+    signal node_q           : t_prio_dec_node_array(1 to 2 * C_LEAFS - 1);
 
     ----------------------------------------------------------------------------
-    -- Level 2 priorities and valid indicators
+    -- Returns depth of a node in the tree (root has depth 0)
     ----------------------------------------------------------------------------
-    type level2_priority_type  is array (1 downto 0) of
-          std_logic_vector(2 downto 0);
-    type level2_comp_valid_type is array (1 downto 0) of
-          std_logic_vector(1 downto 0);
-    signal l2_prio        : level2_priority_type;
-    signal l2_valid       : std_logic_vector(1 downto 0);
-    signal l2_winner      : std_logic_vector(1 downto 0);
+    function node_depth(
+        constant k : natural
+    ) return natural is
+        variable tmp   : natural := k;
+        variable depth : natural := 0;
+    begin
+        while (tmp > 1) loop
+            tmp := tmp / 2;
+            depth := depth + 1;
+        end loop;
+        return depth;
+    end function;
 
     ----------------------------------------------------------------------------
-    -- Level 3, we dont need the priorities, we only need the
-    -- outcome which of them is bigger (since there is no next stage)
+    -- Single comparator. Upper sub-tree wins only with strictly higher
+    -- priority, so lower index wins in case of equal priorities.
     ----------------------------------------------------------------------------
-    signal l3_valid       : std_logic;
-    signal l3_winner      : std_logic;
+    function compare(
+        constant lower : t_prio_dec_node;
+        constant upper : t_prio_dec_node
+    ) return t_prio_dec_node is
+    begin
+        if (upper.valid = '1' and
+            (lower.valid = '0' or unsigned(upper.prio) > unsigned(lower.prio)))
+        then
+            return upper;
+        end if;
+
+        if (lower.valid = '1') then
+            return lower;
+        end if;
 
-    constant LOWER_TREE   : std_logic := '0';
-    constant UPPER_TREE   : std_logic := '1';  
+        return C_NODE_RSTVAL;
+    end function;
+
+    -- Selected node (root of the tree)
+    signal root_index       : natural range 0 to C_LEAFS - 1;
 
 begin
   
     ----------------------------------------------------------------------------
-    -- Level 0 - aliases
+    -- Leafs - input TXT Buffers
     ----------------------------------------------------------------------------
-    l0_gen : for i in 0 to G_TXT_BUFFER_COUNT - 1 generate
+    leaf_gen : for i in 0 to C_LEAFS - 1 generate
+
+        leaf_valid_gen : if (i < G_TXT_BUFFER_COUNT) generate
+
+            -- pragma translate_off
+            
+            -- Since we cover "00" as inactive value, instead of active values 
+            -- "01", "10" or "11", rather make sure that input values are defined
+            l0_val_proc : process(prio_valid(i))
+            begin
+                if (prio_valid(i) /= '0' and prio_valid(i) /= '1' and now /= 0 fs) then
+                    report "Input values not exactly defined" severity error;
+                end if;
+            end process;
+            -- pragma translate_on
 
-        -- pragma translate_off
-        
-        -- Since we cover "00" as inactive value, instead of active values 
-        -- "01", "10" or "11", rather make sure that input values are defined
-        l0_val_proc : process(prio_valid(i))
-        begin
-            if (prio_valid(i) /= '0' and prio_valid(i) /= '1' and now /= 0 fs) then
-                report "Input values not exactly defined" severity error;
-            end if;
-        end process;
-        -- pragma translate_on
-
-        l0_prio(i)  <= prio(i);
-        l0_valid(i) <= prio_valid(i);
+            node_d(C_LEAFS + i) <= (prio_valid(i), prio(i), i);
+        end generate;
 
-    end generate;
+        leaf_fill_gen : if (i >= G_TXT_BUFFER_COUNT) generate
+            node_d(C_LEAFS + i) <= C_NODE_RSTVAL;
+        end generate;
+
+        node_q(C_LEAFS + i) <= node_d(C_LEAFS + i);
 
-  
-    fill_zeroes_gen : if (G_TXT_BUFFER_COUNT < 8) generate
-        l0_prio(7 downto G_TXT_BUFFER_COUNT)  <= (OTHERS => (OTHERS => '0'));
-        l0_valid(7 downto G_TXT_BUFFER_COUNT) <= (OTHERS => '0');
     end generate;
-    
-    
+
     ----------------------------------------------------------------------------
-    -- Level 1 comparators
+    -- Comparators
     ----------------------------------------------------------------------------
-    l1_prio_dec_proc : process(l0_valid, l0_prio)
-        variable tmp : level1_comp_valid_type := (OTHERS => (OTHERS => '0'));
-    begin
-        for i in 0 to 3 loop
-            tmp(i) := l0_valid(2 * i + 1 downto 2 * i);
-            case tmp(i) is
-            when "01" =>
-                l1_prio(i)      <= l0_prio(2 * i);
-                l1_valid(i)     <= '1'; 
-                l1_winner(i)    <= LOWER_TREE;
-
-            when "10" =>
-                l1_prio(i)      <= l0_prio(2 * i + 1);
-                l1_valid(i)     <= '1'; 
-                l1_winner(i)    <= UPPER_TREE;
-
-            when "11" => 
-                if (unsigned(l0_prio(2 * i + 1)) > unsigned(l0_prio(2 * i))) then
-                    l1_prio(i)    <= l0_prio(2 * i + 1);
-                    l1_winner(i)  <= UPPER_TREE;
-                else
-                    l1_prio(i)    <= l0_prio(2 * i);
-                    l1_winner(i)  <= LOWER_TREE;
-                end if;
-                l1_valid(i)     <= '1';  
+    comp_gen : for k in 1 to C_LEAFS - 1 generate
 
-            when "00" =>
-                l1_valid(i)     <= '0';
-                l1_prio(i)      <= l0_prio(2 * i + 1);
-                l1_winner(i)    <= UPPER_TREE;
+        node_d(k) <= compare(node_q(2 * k), node_q(2 * k + 1));
 
-            when others => 
-                l1_valid(i)     <= '0';
-                l1_prio(i)      <= l0_prio(2 * i + 1);
-                l1_winner(i)    <= UPPER_TREE;
+        comp_reg_gen : if (G_PIPELINE and node_depth(k) = C_PIPE_DEPTH) generate
+            comp_reg_proc : process(clk_sys, res_n)
+            begin
+                if (res_n = '0') then
+                    node_q(k) <= C_NODE_RSTVAL;
+                elsif (rising_edge(clk_sys)) then
+                    node_q(k) <= node_d(k);
+                end if;
+            end process;
+        end generate;
 
-            end case;
-        end loop;
-    end process; 
+        comp_comb_gen : if (not G_PIPELINE or node_depth(k) /= C_PIPE_DEPTH) generate
+            node_q(k) <= node_d(k);
+        end generate;
 
+    end generate;
 
     ----------------------------------------------------------------------------
-    -- Level 2 comparators
+    -- Output
     ----------------------------------------------------------------------------
-    l2_prio_dec_proc : process(l1_valid, l1_prio)
-        variable tmp : level2_comp_valid_type := (OTHERS => (OTHERS => '0'));
-    begin
-        for i in 0 to 1 loop
-            tmp(i) := l1_valid(2 * i + 1 downto 2 * i);
-
-            case tmp(i) is
-            when "01" => 
-                l2_prio(i)      <= l1_prio(2 * i);
-                l2_valid(i)     <= '1'; 
-                l2_winner(i)    <= LOWER_TREE;
-
-            when "10" => 
-                l2_prio(i)      <= l1_prio(2 * i + 1);
-                l2_valid(i)     <= '1'; 
-                l2_winner(i)    <= UPPER_TREE;
-
-            when "11" => 
-                if (unsigned(l1_prio(2 * i + 1)) > unsigned(l1_prio(2 * i))) then
-                    l2_prio(i)    <= l1_prio(2 * i + 1);
-                    l2_winner(i)  <= UPPER_TREE;
-                else
-                    l2_prio(i)    <= l1_prio(2 * i);
-                    l2_winner(i)  <= LOWER_TREE;
-                end if;
-                l2_valid(i)     <= '1';  
-             
-            when "00" =>
-                l2_valid(i)     <= '0';
-                l2_prio(i)      <= l1_prio(2 * i + 1);
-                l2_winner(i)    <= UPPER_TREE;
-
-            when others => 
-                l2_valid(i)     <= '0';
-                l2_prio(i)      <= l1_prio(2 * i + 1);
-                l2_winner(i)    <= UPPER_TREE;
-
-            end case;
-        end loop;  
-    end process;
-  
-  
-    ----------------------------------------------------------------------------
-    -- Level 3 comparators
-    ----------------------------------------------------------------------------
-  
-    -- Here we have only one comparator, plus we dont need
-    -- the priority on the output...  
-
-    -- Validity of level 3 is also the output validity
-    l3_valid  <= '0' when l2_valid(1 downto 0) = "00" 
-                   else
-                '1';
-    output_valid <= '1' when l3_valid = '1' else '0';
-
-    -- Priority comparator of level 3
-    l3_winner  <= LOWER_TREE when l2_valid(1 downto 0) = "01" else
-                UPPER_TREE when l2_valid(1 downto 0) = "10" else
-                UPPER_TREE when (l2_valid(1 downto 0) = "11" and
-                                 unsigned(l2_prio(1)) > unsigned(l2_prio(0))) 
-                           else 
-                LOWER_TREE;
-   
+    -- Note that modulo is used only for purpose of getting rid of compiler
+    -- warnings. Leafs above TXT_BUFFER_COUNT are never valid, so selected
+    -- index is within range whenever output is valid.
+    root_index <= node_q(1).index;
+    output_index <= root_index mod G_TXT_BUFFER_COUNT;
+
+    pipe_out_gen : if (G_PIPELINE) generate
+        output_valid <= node_q(1).valid and
+                        prio_valid(root_index mod G_TXT_BUFFER_COUNT);
+    end generate;
+
+    comb_out_gen : if (not G_PIPELINE) generate
+        output_valid <= node_q(1).valid;
+    end generate;
 
+    -- <RELEASE_OFF>
     ----------------------------------------------------------------------------
-    -- Output index decoder
+    -- Functional coverage
     ----------------------------------------------------------------------------
-    -- Just find out the winning buffer index from decisions in the tree
-
-    -- Note that modulo is used only for purpose of getting rid of
-    -- compiler warnings. If lower amount of buffers is on input 
-    -- (TXT_BUFFER_COUNT), then higher indices of input priorities and
-    -- valid sinals are set to 0. This leads to the case that "buf_index" 
-    -- will NEVER be assigned value higher than its available
-    -- range.
-   
-    out_index_proc : process(l3_winner, l2_winner, l1_winner)
-    begin
-        if (l3_winner = LOWER_TREE) then
-            if (l2_winner(0) = LOWER_TREE) then
-                if (l1_winner(0) = LOWER_TREE) then
-                    output_index <= 0;
-                else
-                    output_index <= 1;
-                end if;
-            else
-                if (l1_winner(1) = LOWER_TREE) then
-                    output_index <= 2 mod G_TXT_BUFFER_COUNT;
-                else
-                    output_index <= 3 mod G_TXT_BUFFER_COUNT;
-                end if;
-            end if;      
-        else
-            if (l2_winner(1) = LOWER_TREE) then
-                if (l1_winner(2) = LOWER_TREE) then
-                    output_index <= 4 mod G_TXT_BUFFER_COUNT;
-                else
-                    output_index <= 5 mod G_TXT_BUFFER_COUNT;
-                end if;
-            else
-                if (l1_winner(3) = LOWER_TREE) then
-                    output_index <= 6 mod G_TXT_BUFFER_COUNT;
-                else
-                    output_index <= 7 mod G_TXT_BUFFER_COUNT;
-                end if;
-            end if;   
-        end if;
-    end process;     
-  
-end architecture;
\ No newline at end of file
+    -- psl default clock is rising_edge(clk_sys);
+    --
+    -- psl prio_dec_valid_cov : cover
+    --  {output_valid = '1'};
+    -- <RELEASE_ON>
+
+end architecture;
@@ -79,6 +79,9 @@
 --  value of external Timestamp. This realizes the functionality of transmission
 --  at exact time! Metadata of transmitted frame are loaded to output of TX
 --  Arbitrator as part of selection process.
+--  Optionally, timestamp is captured for each TXT Buffer when it is locked for
+--  transmission (start of SOF). Timestamp of TXT Buffer selected by
+--  TXTB_TS_SEL is provided to memory registers.
 --------------------------------------------------------------------------------
 
 Library ieee;
@@ -100,7 +103,13 @@ use ctu_can_fd_rtl.CAN_FD_frame_format.all;
 entity tx_arbitrator is
     generic(
         -- Number of TXT Buffers
-        G_TXT_BUFFER_COUNT      : natural range 1 to 8
+        G_TXT_BUFFER_COUNT      : natural range 1 to 32;
+
+        -- Pipeline priority decoder
+        G_PRIO_DEC_PIPELINE     : boolean := false;
+
+        -- Capture transmission start timestamps of TXT Buffers
+        G_SUP_TX_TS             : boolean := false
     );
     port( 
         -----------------------------------------------------------------------
@@ -179,7 +188,10 @@ entity tx_arbitrator is
         drv_bus                 :in std_logic_vector(1023 downto 0);
 
         -- TimeStamp value
-        timestamp               :in std_logic_vector(63 downto 0)
+        timestamp               :in std_logic_vector(63 downto 0);
+
+        -- Transmission start timestamp of TXT Buffer selected by TXTB_TS_SEL
+        txtb_ts                 :out std_logic_vector(63 downto 0)
   );
 end entity;
 
@@ -298,6 +310,17 @@ architecture rtl of tx_arbitrator is
     -- Time triggered transmission mode enabled
     signal drv_tttm_ena               : std_logic;                   
 
+    -- TXT Buffer selected for reading of transmission start timestamp
+    signal drv_txtb_ts_sel            : std_logic_vector(2 downto 0);
+
+    ---------------------------------------------------------------------------
+    -- Transmission start timestamps
+    ---------------------------------------------------------------------------
+    type t_txtb_ts_array is array (0 to G_TXT_BUFFER_COUNT - 1) of
+        std_logic_vector(63 downto 0);
+
+    signal txtb_ts_q                  : t_txtb_ts_array;
+
     ---------------------------------------------------------------------------
     -- Comparing procedure for two 64 bit std logic vectors
     ---------------------------------------------------------------------------
@@ -322,9 +345,12 @@ begin
   ------------------------------------------------------------------------------
   priority_decoder_inst : entity ctu_can_fd_rtl.priority_decoder 
   generic map(
-     G_TXT_BUFFER_COUNT    => G_TXT_BUFFER_COUNT
+     G_TXT_BUFFER_COUNT    => G_TXT_BUFFER_COUNT,
+     G_PIPELINE            => G_PRIO_DEC_PIPELINE
   )
   port map( 
+     clk_sys        => clk_sys,             -- IN
+     res_n          => res_n,               -- IN
      prio           => txtb_prorities,      -- IN
      prio_valid     => txtb_available,      -- IN
      
@@ -362,6 +388,7 @@ begin
   );
 
   drv_tttm_ena <= drv_bus(DRV_TTTM_ENA_INDEX);
+  drv_txtb_ts_sel <= drv_bus(DRV_TXTB_TS_SEL_HIGH downto DRV_TXTB_TS_SEL_LOW);
 
   ------------------------------------------------------------------------------
   -- Comparing timestamp with external timestamp. This assumes that Upper 
@@ -448,6 +475,36 @@ begin
     end if;
   end process;
 
+  ------------------------------------------------------------------------------
+  -- Transmission start timestamps. Captured when TXT Buffer is locked by CAN
+  -- Core, which happens at start of SOF. Overwritten by each transmission
+  -- attempt (also retransmissions).
+  ------------------------------------------------------------------------------
+  tx_ts_gen_true : if (G_SUP_TX_TS) generate
+
+    txtb_ts_proc : process(res_n, clk_sys)
+    begin
+      if (res_n = '0') then
+        txtb_ts_q <= (OTHERS => (OTHERS => '0'));
+      elsif (rising_edge(clk_sys)) then
+        if (txtb_hw_cmd.lock = '1') then
+          txtb_ts_q(int_txtb_index) <= timestamp;
+        end if;
+      end if;
+    end process;
+
+    txtb_ts <= txtb_ts_q(to_integer(unsigned(drv_txtb_ts_sel)))
+                   when (to_integer(unsigned(drv_txtb_ts_sel)) < G_TXT_BUFFER_COUNT)
+                   else
+               (OTHERS => '0');
+
+  end generate tx_ts_gen_true;
+
+  tx_ts_gen_false : if (not G_SUP_TX_TS) generate
+    txtb_ts_q <= (OTHERS => (OTHERS => '0'));
+    txtb_ts <= (OTHERS => '0');
+  end generate tx_ts_gen_false;
+
   ------------------------------------------------------------------------------
   -- Double buffer registers for Metadata.
   ------------------------------------------------------------------------------
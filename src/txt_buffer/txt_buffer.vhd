@@ -73,6 +73,12 @@
 -- Purpose:
 --  Stores single frame for transmission in internal RAM. Accessed from Memory
 --  registers via memory bus (to store frame) and SW commands.
+--  Optionally, TXT Buffer transmits cyclically. When its period is non-zero,
+--  the first transmission (start of SOF) sets the first slot. After each
+--  successfull transmission TXT Buffer returns to Ready, and becomes available
+--  for TX Arbitrator at the next slot (previous slot + period). When a slot
+--  is delayed (e.g. by lost arbitration) so that the following slot already
+--  elapsed, the slot is skipped and skip counter is incremented.
 --------------------------------------------------------------------------------
 
 Library ieee;
@@ -100,6 +106,9 @@ entity txt_buffer is
         
         -- TXT Buffer ID
         G_ID                   :     natural := 1;
+
+        -- Support cyclic transmission
+        G_SUP_CYCLIC           :     boolean := false;
         
         -- Technology type
         G_TECHNOLOGY           :     natural := C_TECH_ASIC
@@ -151,6 +160,18 @@ entity txt_buffer is
 
         -- Bus monitoring mode
         drv_bus_mon_ena        :in   std_logic;
+
+        -- Period of cyclic transmission (in timestamp units). Stored when
+        -- "txt_cyc_wr" is active and "txt_cyc_sel" selects this TXT Buffer.
+        txt_cyc_period         :in   std_logic_vector(31 downto 0);
+        txt_cyc_wr             :in   std_logic;
+        txt_cyc_sel            :in   std_logic_vector(2 downto 0);
+
+        -- Number of skipped slots of cyclic transmission
+        txtb_cyc_skip          :out  std_logic_vector(15 downto 0);
+
+        -- Timestamp
+        timestamp              :in   std_logic_vector(63 downto 0);
         
         ------------------------------------------------------------------------
         -- Memory Testability
@@ -218,6 +239,13 @@ architecture rtl of txt_buffer is
     -- Output of TXT Buffer RAM
     signal txtb_port_b_data_i     : std_logic_vector(31 downto 0);
 
+    -- TXT Buffer is Ready (from TXT Buffer FSM)
+    signal txtb_available_i       : std_logic;
+
+    -- Cyclic transmission
+    signal txtb_cyclic            : std_logic;
+    signal txtb_cyc_restart       : std_logic;
+
     ----------------------------------------------------------------------------
     ----------------------------------------------------------------------------
     -- RAM wrapper signals
@@ -341,14 +369,121 @@ begin
         is_bus_off             => is_bus_off,               -- IN
         drv_rom_ena            => drv_rom_ena,              -- IN
         drv_bus_mon_ena        => drv_bus_mon_ena,          -- IN
+        txtb_cyclic            => txtb_cyclic,              -- IN
 
         txtb_user_accessible   => txtb_user_accessible,     -- OUT
         txtb_hw_cmd_int        => txtb_hw_cmd_int,          -- OUT
         txtb_state             => txtb_state,               -- OUT
-        txtb_available         => txtb_available,           -- OUT
-        txtb_unmask_data_ram   => txtb_unmask_data_ram      -- OUT
+        txtb_available         => txtb_available_i,         -- OUT
+        txtb_unmask_data_ram   => txtb_unmask_data_ram,     -- OUT
+        txtb_cyc_restart       => txtb_cyc_restart          -- OUT
     );
 
+    ----------------------------------------------------------------------------
+    -- Cyclic transmission
+    ----------------------------------------------------------------------------
+    cyc_gen_true : if (G_SUP_CYCLIC) generate
+
+        -- Period of cyclic transmission
+        signal cyc_period_q       : std_logic_vector(31 downto 0);
+
+        -- Time of current slot, valid since first transmission after
+        -- TXT Buffer was set ready.
+        signal slot_q             : std_logic_vector(63 downto 0);
+        signal slot_valid_q       : std_logic;
+        signal slot_next          : std_logic_vector(63 downto 0);
+
+        -- Current slot elapsed, TXT Buffer can be transmitted
+        signal slot_due           : std_logic;
+
+        -- Following slot elapsed before transmission in current slot
+        signal slot_skip          : std_logic;
+
+        -- Skip counter
+        signal cyc_skip_q         : unsigned(15 downto 0);
+    begin
+
+        period_reg_proc : process(res_n, clk_sys)
+        begin
+            if (res_n = '0') then
+                cyc_period_q <= (OTHERS => '0');
+                cyc_skip_q <= (OTHERS => '0');
+            elsif (rising_edge(clk_sys)) then
+                if (txt_cyc_wr = '1' and
+                    to_integer(unsigned(txt_cyc_sel)) = G_ID)
+                then
+                    cyc_period_q <= txt_cyc_period;
+                    cyc_skip_q <= (OTHERS => '0');
+                elsif (slot_skip = '1' and cyc_skip_q /= x"FFFF") then
+                    cyc_skip_q <= cyc_skip_q + 1;
+                end if;
+            end if;
+        end process;
+
+        txtb_cyclic <= '0' when (cyc_period_q = x"00000000")
+                           else
+                       '1';
+
+        slot_next <= std_logic_vector(unsigned(slot_q) +
+                                      resize(unsigned(cyc_period_q), 64));
+
+        ------------------------------------------------------------------------
+        -- First slot is set when TXT Buffer is locked for the first time after
+        -- it was set ready. Slot is invalidated when TXT Buffer leaves Ready,
+        -- TX in progress and Abort in progress states.
+        ------------------------------------------------------------------------
+        slot_reg_proc : process(res_n, clk_sys)
+        begin
+            if (res_n = '0') then
+                slot_q <= (OTHERS => '0');
+                slot_valid_q <= '0';
+            elsif (rising_edge(clk_sys)) then
+                if (txtb_user_accessible = '1') then
+                    slot_valid_q <= '0';
+                elsif (txtb_hw_cmd.lock = '1' and hw_cbs = '1' and
+                       slot_valid_q = '0' and txtb_cyclic = '1')
+                then
+                    slot_q <= timestamp;
+                    slot_valid_q <= '1';
+                elsif (txtb_cyc_restart = '1' or slot_skip = '1') then
+                    slot_q <= slot_next;
+                end if;
+            end if;
+        end process;
+
+        slot_skip <= '1' when (txtb_available_i = '1' and slot_valid_q = '1' and
+                               txtb_cyclic = '1' and
+                               unsigned(slot_next) <= unsigned(timestamp))
+                         else
+                     '0';
+
+        slot_due <= '1' when (slot_valid_q = '0' or
+                              unsigned(slot_q) <= unsigned(timestamp))
+                        else
+                    '0';
+
+        txtb_available <= txtb_available_i and slot_due;
+
+        txtb_cyc_skip <= std_logic_vector(cyc_skip_q);
+
+        -- <RELEASE_OFF>
+        -- psl default clock is rising_edge(clk_sys);
+
+        -- psl txtb_cyc_wait_slot_cov : cover
+        --    {txtb_available_i = '1' and slot_due = '0'};
+
+        -- psl txtb_cyc_skip_cov : cover
+        --    {slot_skip = '1'};
+        -- <RELEASE_ON>
+
+    end generate cyc_gen_true;
+
+    cyc_gen_false : if (not G_SUP_CYCLIC) generate
+        txtb_cyclic <= '0';
+        txtb_available <= txtb_available_i;
+        txtb_cyc_skip <= (OTHERS => '0');
+    end generate cyc_gen_false;
+
     -- <RELEASE_OFF>
     ----------------------------------------------------------------------------
     ----------------------------------------------------------------------------
@@ -73,6 +73,8 @@
 -- Purpose:
 --  Handles HW commands from Protocol control and SW commands from Memory 
 --  registers.
+--  Cyclic TXT Buffer returns to Ready after successful transmission (unless
+--  abort was requested), without interrupt.
 --------------------------------------------------------------------------------
 
 Library ieee;
@@ -124,6 +126,9 @@ entity txt_buffer_fsm is
         -- Bus monitoring mode
         drv_bus_mon_ena        :in   std_logic;
 
+        -- TXT Buffer transmits cyclically
+        txtb_cyclic            :in   std_logic;
+
         ------------------------------------------------------------------------   
         -- CAN Core interface
         ------------------------------------------------------------------------
@@ -152,7 +157,10 @@ entity txt_buffer_fsm is
         txtb_available          :out  std_logic;
                 
         -- UnMask content of TXT Buffer RAM
-        txtb_unmask_data_ram    :out  std_logic
+        txtb_unmask_data_ram    :out  std_logic;
+
+        -- Cyclic TXT Buffer transmitted successfully and returns to Ready
+        txtb_cyc_restart        :out  std_logic
     );             
 end entity;
 
@@ -172,6 +180,9 @@ architecture rtl of txt_buffer_fsm is
     signal go_to_failed        : std_logic;
     signal transient_state     : std_logic;
 
+    -- Cyclic TXT Buffer returns to Ready
+    signal cyc_restart         : std_logic;
+
 begin
 
     abort_applied <= '1' when (txtb_sw_cmd.set_abt = '1' and sw_cbs = '1') else
@@ -191,11 +202,19 @@ begin
                         else
                     '0';
 
+    cyc_restart <= '1' when (curr_state = s_txt_tx_prog and
+                             txtb_hw_cmd.unlock = '1' and hw_cbs = '1' and
+                             txtb_hw_cmd.failed = '0' and
+                             txtb_hw_cmd.valid = '1' and
+                             txtb_cyclic = '1' and abort_applied = '0')
+                       else
+                   '0';
+
     ----------------------------------------------------------------------------
     -- Next state process
     ----------------------------------------------------------------------------
     tx_buf_fsm_next_state_proc : process(curr_state, txtb_sw_cmd, sw_cbs, 
-        txtb_hw_cmd, hw_cbs, abort_applied, go_to_failed)
+        txtb_hw_cmd, hw_cbs, abort_applied, go_to_failed, cyc_restart)
     begin
         next_state <= curr_state;
 
@@ -243,6 +262,8 @@ begin
                 -- Retransmitt reached, transmitt OK, or try again...
                 if (txtb_hw_cmd.failed         = '1') then
                     next_state     <= s_txt_failed;
+                elsif (cyc_restart             = '1') then
+                    next_state     <= s_txt_ready;
                 elsif (txtb_hw_cmd.valid       = '1') then
                     next_state     <= s_txt_ok;
                 elsif (txtb_hw_cmd.err         = '1' or 
@@ -368,7 +389,8 @@ begin
     -- TXT Buffer HW Command generates interrupt upon transition to
     -- Failed, Done and Aborted states!
     txtb_hw_cmd_int <= '1' when (hw_cbs = '1') and ((txtb_hw_cmd.failed = '1') or
-                                                   (txtb_hw_cmd.valid = '1') or
+                                                   (txtb_hw_cmd.valid = '1' and
+                                                    cyc_restart = '0') or
                                                    ((txtb_hw_cmd.unlock = '1') and
                                                     (curr_state = s_txt_ab_prog)) or
                                                    ((txtb_sw_cmd.set_abt = '1') and
@@ -408,6 +430,8 @@ begin
                                 else
                             '0';
 
+    txtb_cyc_restart <= cyc_restart;
+
 
     -- <RELEASE_OFF>
     ----------------------------------------------------------------------------
@@ -425,6 +449,8 @@ begin
     -- psl txtb_fsm_error_cov : cover {curr_state = s_txt_failed};
     -- psl txtb_fsm_aborted_cov : cover {curr_state = s_txt_aborted};
     -- psl txtb_fsm_tx_ok_cov : cover {curr_state = s_txt_ok};
+
+    -- psl txtb_fsm_cyc_restart_cov : cover {cyc_restart = '1'};
     
     -- Simultaneous HW and SW Commands
     --
@@ -71,10 +71,11 @@
 --  TXT Buffer RAM
 --
 -- Purpose:
---  Wrapper for dual port RAM in TXT Buffer.
+--  Wrapper for dual port RAM in TXT Buffer. Also used by TXT FIFO which
+--  stores multiple frames in single RAM.
 --
 -- Memory parameters:
---  Depth: 20
+--  Depth: 20 (G_DEPTH)
 --  Word size: 32 bits
 --  Read: Synchronous
 --  Write: Synchronous
@@ -104,7 +105,13 @@ use ctu_can_fd_rtl.can_registers_pkg.all;
 entity txt_buffer_ram is
     generic(
         -- TXT buffer ID
-        G_ID                   :     natural
+        G_ID                   :     natural;
+
+        -- Number of words in RAM
+        G_DEPTH                :     natural := 20;
+
+        -- Width of RAM address
+        G_ADDRESS_WIDTH        :     natural := 5
     );
     port(
         ------------------------------------------------------------------------
@@ -126,7 +133,7 @@ entity txt_buffer_ram is
         -- Port A - Write (from Memory registers)
         ------------------------------------------------------------------------
         -- Address
-        port_a_address       :in     std_logic_vector(4 downto 0);
+        port_a_address       :in     std_logic_vector(G_ADDRESS_WIDTH - 1 downto 0);
         
         -- Data
         port_a_data_in       :in     std_logic_vector(31 downto 0);
@@ -141,7 +148,7 @@ entity txt_buffer_ram is
         -- Port B - Read (from CAN Core)
         -----------------------------------------------------------------------
         -- Address
-        port_b_address       :in     std_logic_vector(4 downto 0);
+        port_b_address       :in     std_logic_vector(G_ADDRESS_WIDTH - 1 downto 0);
         
         -- Data
         port_b_data_out      :out    std_logic_vector(31 downto 0)
@@ -150,11 +157,11 @@ end entity;
 
 architecture rtl of txt_buffer_ram is
     
-    signal port_a_address_i      : std_logic_vector(4 downto 0);
+    signal port_a_address_i      : std_logic_vector(G_ADDRESS_WIDTH - 1 downto 0);
     signal port_a_write_i        : std_logic;
     signal port_a_data_in_i      : std_logic_vector(31 downto 0);
 
-    signal port_b_address_i      : std_logic_vector(4 downto 0);
+    signal port_b_address_i      : std_logic_vector(G_ADDRESS_WIDTH - 1 downto 0);
     signal port_b_data_out_i     : std_logic_vector(31 downto 0);
     
     signal tst_ena               : std_logic;
@@ -169,7 +176,7 @@ begin
     txt_buf_ram_inst : entity ctu_can_fd_rtl.inf_ram_wrapper 
     generic map (
         G_WORD_WIDTH           => 32,
-        G_DEPTH                => 20,
+        G_DEPTH                => G_DEPTH,
         G_ADDRESS_WIDTH        => port_a_address'length,
         G_RESET_POLARITY       => '0',
         G_SYNC_READ            => true
@@ -201,7 +208,7 @@ begin
 
     -- Write port
     port_a_address_i <= port_a_address when (tst_ena = '0') else
-                        tst_addr(4 downto 0);
+                        tst_addr(G_ADDRESS_WIDTH - 1 downto 0);
 
     port_a_write_i <= port_a_write when (tst_ena = '0') else
                       test_registers_out.tst_control(TWRSTB_IND);
@@ -211,7 +218,7 @@ begin
 
     -- Read port
     port_b_address_i <= port_b_address when (tst_ena = '0') else
-                        tst_addr(4 downto 0);
+                        tst_addr(G_ADDRESS_WIDTH - 1 downto 0);
 
     tst_rdata_txt_buf <= port_b_data_out_i when (tst_ena = '1') else
                          (OTHERS => '0');
@@ -0,0 +1,367 @@
+--------------------------------------------------------------------------------
+-- 
+-- CTU CAN FD IP Core 
+-- Copyright (C) 2021-present Ondrej Ille
+-- 
+-- Permission is hereby granted, free of charge, to any person obtaining a copy
+-- of this VHDL component and associated documentation files (the "Component"),
+-- to use, copy, modify, merge, publish, distribute the Component for
+-- educational, research, evaluation, self-interest purposes. Using the
+-- Component for commercial purposes is forbidden unless previously agreed with
+-- Copyright holder.
+-- 
+-- The above copyright notice and this permission notice shall be included in
+-- all copies or substantial portions of the Component.
+-- 
+-- THE COMPONENT IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+-- IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+-- FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+-- AUTHORS OR COPYRIGHTHOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+-- LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+-- FROM, OUT OF OR IN CONNECTION WITH THE COMPONENT OR THE USE OR OTHER DEALINGS
+-- IN THE COMPONENT.
+-- 
+-- The CAN protocol is developed by Robert Bosch GmbH and protected by patents.
+-- Anybody who wants to implement this IP core on silicon has to obtain a CAN
+-- protocol license from Bosch.
+-- 
+-- -------------------------------------------------------------------------------
+-- 
+-- CTU CAN FD IP Core 
+-- Copyright (C) 2015-2020 MIT License
+-- 
+-- Authors:
+--     Ondrej Ille <ondrej.ille@gmail.com>
+--     Martin Jerabek <martin.jerabek01@gmail.com>
+-- 
+-- Project advisors: 
+-- 	Jiri Novak <jnovak@fel.cvut.cz>
+-- 	Pavel Pisa <pisa@cmp.felk.cvut.cz>
+-- 
+-- Department of Measurement         (http://meas.fel.cvut.cz/)
+-- Faculty of Electrical Engineering (http://www.fel.cvut.cz)
+-- Czech Technical University        (http://www.cvut.cz/)
+-- 
+-- Permission is hereby granted, free of charge, to any person obtaining a copy
+-- of this VHDL component and associated documentation files (the "Component"),
+-- to deal in the Component without restriction, including without limitation
+-- the rights to use, copy, modify, merge, publish, distribute, sublicense,
+-- and/or sell copies of the Component, and to permit persons to whom the
+-- Component is furnished to do so, subject to the following conditions:
+-- 
+-- The above copyright notice and this permission notice shall be included in
+-- all copies or substantial portions of the Component.
+-- 
+-- THE COMPONENT IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+-- IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+-- FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+-- AUTHORS OR COPYRIGHTHOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+-- LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+-- FROM, OUT OF OR IN CONNECTION WITH THE COMPONENT OR THE USE OR OTHER DEALINGS
+-- IN THE COMPONENT.
+-- 
+-- The CAN protocol is developed by Robert Bosch GmbH and protected by patents.
+-- Anybody who wants to implement this IP core on silicon has to obtain a CAN
+-- protocol license from Bosch.
+-- 
+
+--------------------------------------------------------------------------------
+-- Module:
+--  TX completion FIFO
+-- 
+-- Purpose:
+--  Stores a record for each TXT Buffer which moved to one of final states
+--  (TX OK, Failed, Aborted). Record contains index of TXT Buffer, its final
+--  state, value of retransmitt counter and lower 32 bits of timestamp when the
+--  state was reached. SW reads records in order of completion, so it does not
+--  need to read and decode TX_STATUS.
+--
+--  Several TXT Buffers may reach final state in the same clock cycle (e.g.
+--  all buffers fail when node turns bus-off, or multiple buffers are aborted
+--  by single command). Such buffers are marked as pending, and records are
+--  stored one per clock cycle, lowest index first. Retransmitt counter and
+--  timestamp are sampled when record is stored.
+--
+--  When FIFO is full, record is dropped and overflow flag is set. Overflow
+--  flag is cleared when a record is read.
+--------------------------------------------------------------------------------
+
+Library ieee;
+use ieee.std_logic_1164.all;
+use ieee.numeric_std.ALL;
+
+Library ctu_can_fd_rtl;
+use ctu_can_fd_rtl.can_types_pkg.all;
+use ctu_can_fd_rtl.unary_ops_pkg.all;
+
+use ctu_can_fd_rtl.CAN_FD_register_map.all;
+
+entity txt_cpl_fifo is
+    generic(
+        -- Number of TXT Buffers
+        G_TXT_BUFFER_COUNT     :     natural range 2 to 8;
+
+        -- Number of records in FIFO
+        G_DEPTH                :     natural range 2 to 16 := 16;
+
+        -- Width of retransmitt counter
+        G_RETR_LIM_CTR_WIDTH   :     natural := 4
+    );
+    port(
+        ------------------------------------------------------------------------
+        -- Clock and Asynchronous reset
+        ------------------------------------------------------------------------
+        -- System clock
+        clk_sys                :in   std_logic;
+        
+        -- Asynchronous reset
+        res_n                  :in   std_logic;
+
+        ------------------------------------------------------------------------
+        -- TXT Buffers interface
+        ------------------------------------------------------------------------
+        -- TXT Buffer states (encoded for Memory registers)
+        txtb_state             :in   t_txt_bufs_state(G_TXT_BUFFER_COUNT - 1 downto 0);
+
+        ------------------------------------------------------------------------
+        -- CAN Core interface
+        ------------------------------------------------------------------------
+        -- Retransmitt counter
+        retr_ctr               :in   std_logic_vector(G_RETR_LIM_CTR_WIDTH - 1 downto 0);
+
+        -- Timestamp
+        timestamp              :in   std_logic_vector(63 downto 0);
+
+        ------------------------------------------------------------------------
+        -- Memory registers interface
+        ------------------------------------------------------------------------
+        -- Remove oldest record
+        tx_cpl_pop             :in   std_logic;
+
+        -- Oldest record - TXT Buffer index
+        tx_cpl_index           :out  std_logic_vector(2 downto 0);
+
+        -- Oldest record - Final state of TXT Buffer
+        tx_cpl_state           :out  std_logic_vector(3 downto 0);
+
+        -- Oldest record - Retransmitt counter
+        tx_cpl_retr_ctr        :out  std_logic_vector(G_RETR_LIM_CTR_WIDTH - 1 downto 0);
+
+        -- Oldest record - Timestamp (lower 32 bits)
+        tx_cpl_ts              :out  std_logic_vector(31 downto 0);
+
+        -- Number of records in FIFO
+        tx_cpl_count           :out  std_logic_vector(4 downto 0);
+
+        -- Record was dropped since last read
+        tx_cpl_overflow        :out  std_logic;
+
+        -- FIFO is not empty
+        tx_cpl_valid           :out  std_logic
+    );
+end entity;
+
+architecture rtl of txt_cpl_fifo is
+
+    -- Record of TX completion
+    type t_tx_cpl_rec is record
+        index       : std_logic_vector(2 downto 0);
+        state       : std_logic_vector(3 downto 0);
+        retr_ctr    : std_logic_vector(G_RETR_LIM_CTR_WIDTH - 1 downto 0);
+        ts          : std_logic_vector(31 downto 0);
+    end record;
+
+    type t_tx_cpl_mem is array (0 to G_DEPTH - 1) of t_tx_cpl_rec;
+
+    signal mem                    : t_tx_cpl_mem;
+
+    ----------------------------------------------------------------------------
+    -- Detection of final states
+    ----------------------------------------------------------------------------
+    -- TXT Buffer is in one of final states (TX OK, Failed, Aborted)
+    signal txtb_final             : std_logic_vector(G_TXT_BUFFER_COUNT - 1 downto 0);
+    signal txtb_final_q           : std_logic_vector(G_TXT_BUFFER_COUNT - 1 downto 0);
+
+    -- TXT Buffer reached final state, record not stored yet
+    signal pend_q                 : std_logic_vector(G_TXT_BUFFER_COUNT - 1 downto 0);
+    signal pend_d                 : std_logic_vector(G_TXT_BUFFER_COUNT - 1 downto 0);
+
+    -- Index of TXT Buffer whose record is stored
+    signal push_index             : natural range 0 to G_TXT_BUFFER_COUNT - 1;
+
+    ----------------------------------------------------------------------------
+    -- FIFO pointers
+    ----------------------------------------------------------------------------
+    -- Oldest record
+    signal head                   : natural range 0 to G_DEPTH - 1;
+
+    -- Slot for next record
+    signal tail                   : natural range 0 to G_DEPTH - 1;
+
+    -- Number of records in FIFO
+    signal fill                   : natural range 0 to G_DEPTH;
+
+    -- FIFO is full
+    signal fifo_full              : std_logic;
+
+    ----------------------------------------------------------------------------
+    -- FIFO operations
+    ----------------------------------------------------------------------------
+    -- Record is available
+    signal push_req               : std_logic;
+
+    -- Store record
+    signal push                   : std_logic;
+
+    -- Remove oldest record
+    signal pop                    : std_logic;
+
+    -- Record dropped since last read
+    signal overflow_q             : std_logic;
+
+begin
+
+    txtb_final_gen : for i in 0 to G_TXT_BUFFER_COUNT - 1 generate
+        txtb_final(i) <= '1' when (txtb_state(i) = TXT_TOK or
+                                   txtb_state(i) = TXT_ERR or
+                                   txtb_state(i) = TXT_ABT)
+                             else
+                         '0';
+    end generate txtb_final_gen;
+
+    -- TXT Buffer is pending from the cycle when it reaches final state, till
+    -- its record is stored.
+    pend_d <= pend_q or (txtb_final and not txtb_final_q);
+
+    push_req <= or_reduce(pend_d);
+
+    ----------------------------------------------------------------------------
+    -- Lowest pending TXT Buffer is stored first.
+    ----------------------------------------------------------------------------
+    push_index_proc : process(pend_d)
+    begin
+        push_index <= 0;
+        for i in G_TXT_BUFFER_COUNT - 1 downto 0 loop
+            if (pend_d(i) = '1') then
+                push_index <= i;
+            end if;
+        end loop;
+    end process;
+
+    fifo_full <= '1' when (fill = G_DEPTH)
+                     else
+                 '0';
+
+    push <= push_req and not fifo_full;
+
+    pop <= '1' when (tx_cpl_pop = '1' and fill > 0)
+               else
+           '0';
+
+    ----------------------------------------------------------------------------
+    -- Pending TXT Buffers. Record of TXT Buffer is consumed also when FIFO is
+    -- full (it is dropped).
+    ----------------------------------------------------------------------------
+    pend_proc : process(clk_sys, res_n)
+    begin
+        if (res_n = '0') then
+            txtb_final_q <= (OTHERS => '0');
+            pend_q <= (OTHERS => '0');
+        elsif (rising_edge(clk_sys)) then
+            txtb_final_q <= txtb_final;
+            pend_q <= pend_d;
+            if (push_req = '1') then
+                pend_q(push_index) <= '0';
+            end if;
+        end if;
+    end process;
+
+    ----------------------------------------------------------------------------
+    -- FIFO pointers and overflow flag
+    ----------------------------------------------------------------------------
+    fifo_ptr_proc : process(clk_sys, res_n)
+    begin
+        if (res_n = '0') then
+            head <= 0;
+            tail <= 0;
+            fill <= 0;
+            overflow_q <= '0';
+        elsif (rising_edge(clk_sys)) then
+            if (push = '1') then
+                tail <= (tail + 1) mod G_DEPTH;
+            end if;
+
+            if (pop = '1') then
+                head <= (head + 1) mod G_DEPTH;
+            end if;
+
+            if (push = '1' and pop = '0') then
+                fill <= fill + 1;
+            elsif (push = '0' and pop = '1') then
+                fill <= fill - 1;
+            end if;
+
+            if (push_req = '1' and fifo_full = '1') then
+                overflow_q <= '1';
+            elsif (pop = '1') then
+                overflow_q <= '0';
+            end if;
+        end if;
+    end process;
+
+    ----------------------------------------------------------------------------
+    -- FIFO memory. Not reset, only records between head and tail are valid.
+    ----------------------------------------------------------------------------
+    mem_proc : process(clk_sys)
+    begin
+        if (rising_edge(clk_sys)) then
+            if (push = '1') then
+                mem(tail).index <= std_logic_vector(to_unsigned(push_index, 3));
+                mem(tail).state <= txtb_state(push_index);
+                mem(tail).retr_ctr <= retr_ctr;
+                mem(tail).ts <= timestamp(31 downto 0);
+            end if;
+        end if;
+    end process;
+
+    ----------------------------------------------------------------------------
+    -- Oldest record is masked when FIFO is empty.
+    ----------------------------------------------------------------------------
+    tx_cpl_valid <= '1' when (fill > 0)
+                        else
+                    '0';
+
+    tx_cpl_index    <= mem(head).index    when (fill > 0) else (OTHERS => '0');
+    tx_cpl_state    <= mem(head).state    when (fill > 0) else (OTHERS => '0');
+    tx_cpl_retr_ctr <= mem(head).retr_ctr when (fill > 0) else (OTHERS => '0');
+    tx_cpl_ts       <= mem(head).ts       when (fill > 0) else (OTHERS => '0');
+
+    tx_cpl_count <= std_logic_vector(to_unsigned(fill, 5));
+    tx_cpl_overflow <= overflow_q;
+
+    -- <RELEASE_OFF>
+    ----------------------------------------------------------------------------
+    ----------------------------------------------------------------------------
+    -- Assertions and functional coverage
+    ----------------------------------------------------------------------------
+    ----------------------------------------------------------------------------
+    -- psl default clock is rising_edge(clk_sys);
+
+    -- psl txt_cpl_fifo_full_cov : cover
+    --  {fifo_full = '1'};
+
+    -- psl txt_cpl_fifo_overflow_cov : cover
+    --  {push_req = '1' and fifo_full = '1'};
+
+    -- psl txt_cpl_fifo_push_pop_cov : cover
+    --  {push = '1' and pop = '1'};
+
+    -- psl txt_cpl_fifo_multiple_pending_cov : cover
+    --  {(pend_d and std_logic_vector(unsigned(pend_d) - 1)) /=
+    --   (pend_d'range => '0')};
+
+    -- psl txt_cpl_fifo_pop_when_empty_cov : cover
+    --  {tx_cpl_pop = '1' and fill = 0};
+
+    -- <RELEASE_ON>
+end architecture;
@@ -0,0 +1,549 @@
+--------------------------------------------------------------------------------
+-- 
+-- CTU CAN FD IP Core 
+-- Copyright (C) 2021-present Ondrej Ille
+-- 
+-- Permission is hereby granted, free of charge, to any person obtaining a copy
+-- of this VHDL component and associated documentation files (the "Component"),
+-- to use, copy, modify, merge, publish, distribute the Component for
+-- educational, research, evaluation, self-interest purposes. Using the
+-- Component for commercial purposes is forbidden unless previously agreed with
+-- Copyright holder.
+-- 
+-- The above copyright notice and this permission notice shall be included in
+-- all copies or substantial portions of the Component.
+-- 
+-- THE COMPONENT IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+-- IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+-- FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+-- AUTHORS OR COPYRIGHTHOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+-- LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+-- FROM, OUT OF OR IN CONNECTION WITH THE COMPONENT OR THE USE OR OTHER DEALINGS
+-- IN THE COMPONENT.
+-- 
+-- The CAN protocol is developed by Robert Bosch GmbH and protected by patents.
+-- Anybody who wants to implement this IP core on silicon has to obtain a CAN
+-- protocol license from Bosch.
+-- 
+-- -------------------------------------------------------------------------------
+-- 
+-- CTU CAN FD IP Core 
+-- Copyright (C) 2015-2020 MIT License
+-- 
+-- Authors:
+--     Ondrej Ille <ondrej.ille@gmail.com>
+--     Martin Jerabek <martin.jerabek01@gmail.com>
+-- 
+-- Project advisors: 
+-- 	Jiri Novak <jnovak@fel.cvut.cz>
+-- 	Pavel Pisa <pisa@cmp.felk.cvut.cz>
+-- 
+-- Department of Measurement         (http://meas.fel.cvut.cz/)
+-- Faculty of Electrical Engineering (http://www.fel.cvut.cz)
+-- Czech Technical University        (http://www.cvut.cz/)
+-- 
+-- Permission is hereby granted, free of charge, to any person obtaining a copy
+-- of this VHDL component and associated documentation files (the "Component"),
+-- to deal in the Component without restriction, including without limitation
+-- the rights to use, copy, modify, merge, publish, distribute, sublicense,
+-- and/or sell copies of the Component, and to permit persons to whom the
+-- Component is furnished to do so, subject to the following conditions:
+-- 
+-- The above copyright notice and this permission notice shall be included in
+-- all copies or substantial portions of the Component.
+-- 
+-- THE COMPONENT IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+-- IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+-- FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+-- AUTHORS OR COPYRIGHTHOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+-- LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+-- FROM, OUT OF OR IN CONNECTION WITH THE COMPONENT OR THE USE OR OTHER DEALINGS
+-- IN THE COMPONENT.
+-- 
+-- The CAN protocol is developed by Robert Bosch GmbH and protected by patents.
+-- Anybody who wants to implement this IP core on silicon has to obtain a CAN
+-- protocol license from Bosch.
+-- 
+--------------------------------------------------------------------------------
+
+--------------------------------------------------------------------------------
+-- Module:
+--  TXT FIFO
+-- 
+-- Purpose:
+--  Stores up to G_DEPTH frames for transmission in single RAM and offers them
+--  to TX Arbitrator in order of insertion. TXT FIFO has the same interface as
+--  TXT Buffer, and it takes place of the last TXT Buffer. From SW point of
+--  view, it is accessed like TXT Buffer:
+--   1. Frame is written to TXT Buffer memory region of the last TXT Buffer.
+--      Data are written to a slot at tail of FIFO. Writes are accepted only
+--      when FIFO is not full.
+--   2. "set_ready" command inserts the frame to FIFO (moves tail).
+--   3. "set_abort" command aborts frame which is ready or being transmitted.
+--   4. "set_empty" command flushes FIFO (when frame is not being transmitted).
+--
+--  Frame at head of FIFO is handled by TXT Buffer FSM. When the FSM is in
+--  one of final states (Empty, TX OK, Failed, Aborted) and FIFO is not empty,
+--  it is moved to Ready by internal "set_ready" command. When the frame is
+--  transmitted succesfully, it is removed from FIFO (head moves) and next
+--  frame is offered. When transmission fails, or it is aborted, all frames
+--  are flushed, and FSM remains in Failed or Aborted until next frame is
+--  inserted.
+--
+--  Interrupt is signalled when number of frames in FIFO drops to threshold
+--  due to succesfull transmission, or when frames above threshold are flushed.
+--------------------------------------------------------------------------------
+
+Library ieee;
+use ieee.std_logic_1164.all;
+use ieee.numeric_std.ALL;
+use ieee.math_real.ALL;
+
+Library ctu_can_fd_rtl;
+use ctu_can_fd_rtl.id_transfer_pkg.all;
+use ctu_can_fd_rtl.can_constants_pkg.all;
+
+use ctu_can_fd_rtl.can_types_pkg.all;
+use ctu_can_fd_rtl.drv_stat_pkg.all;
+use ctu_can_fd_rtl.unary_ops_pkg.all;
+
+use ctu_can_fd_rtl.CAN_FD_register_map.all;
+use ctu_can_fd_rtl.CAN_FD_frame_format.all;
+
+use ctu_can_fd_rtl.can_registers_pkg.all;
+
+entity txt_fifo is
+    generic(
+        -- Number of TXT Buffers
+        G_TXT_BUFFER_COUNT     :     natural range 2 to 8;
+        
+        -- TXT Buffer ID (index of TXT Buffer which is replaced by TXT FIFO)
+        G_ID                   :     natural := 1;
+
+        -- Number of frames in TXT FIFO
+        G_DEPTH                :     natural range 2 to 64 := 16;
+        
+        -- Technology type
+        G_TECHNOLOGY           :     natural := C_TECH_ASIC
+    );
+    port(
+        ------------------------------------------------------------------------
+        -- Clock and Asynchronous reset
+        ------------------------------------------------------------------------
+        -- System clock
+        clk_sys                :in   std_logic;
+        
+        -- Asynchronous reset
+        res_n                  :in   std_logic;
+
+        -----------------------------------------------------------------------
+        -- DFT support
+        -----------------------------------------------------------------------
+        scan_enable            :in   std_logic;
+
+        ------------------------------------------------------------------------
+        -- Memory Registers Interface
+        ------------------------------------------------------------------------
+        -- Data to be written to TXT FIFO RAM
+        txtb_port_a_data       :in   std_logic_vector(31 downto 0);
+        
+        -- Address in TXT Buffer memory region
+        txtb_port_a_address    :in   std_logic_vector(4 downto 0);
+
+        -- TXT FIFO RAM chip select
+        txtb_port_a_cs         :in   std_logic;
+        
+        -- TXT FIFO port A - Byte enable
+        txtb_port_a_be         :in   std_logic_vector(3 downto 0);
+
+        -- SW commands
+        txtb_sw_cmd            :in   t_txtb_sw_cmd;
+        
+        -- TXT Buffer index for which SW command is valid
+        txtb_sw_cmd_index      :in   std_logic_vector(G_TXT_BUFFER_COUNT - 1 downto 0);
+
+        -- Buffer State (encoded for Memory registers)
+        txtb_state             :out  std_logic_vector(3 downto 0);
+
+        -- TXT Buffer bus-off behavior
+        txt_buf_failed_bof     :in   std_logic;
+        
+        -- Restricted operation mode
+        drv_rom_ena            :in   std_logic;
+
+        -- Bus monitoring mode
+        drv_bus_mon_ena        :in   std_logic;
+
+        -- TXT FIFO threshold
+        tx_fifo_th             :in   std_logic_vector(6 downto 0);
+
+        -- Number of frames in TXT FIFO
+        tx_fifo_fill           :out  std_logic_vector(6 downto 0);
+
+        -- TXT FIFO is full
+        tx_fifo_full           :out  std_logic;
+        
+        ------------------------------------------------------------------------
+        -- Memory Testability
+        ------------------------------------------------------------------------
+        -- Test registers
+        test_registers_out     :in   test_registers_out_t;
+        
+        -- TXT FIFO RAM test output
+        tst_rdata_txt_buf      :out  std_logic_vector(31 downto 0);
+
+        ------------------------------------------------------------------------   
+        -- Interrupt Manager Interface
+        ------------------------------------------------------------------------
+        -- HW Command applied
+        txtb_hw_cmd_int        :out  std_logic;
+
+        -- Number of frames in TXT FIFO dropped to threshold
+        tx_fifo_int            :out  std_logic;
+
+        ------------------------------------------------------------------------
+        -- CAN Core and TX Arbitrator Interface
+        ------------------------------------------------------------------------
+        -- HW Commands 
+        txtb_hw_cmd            :in   t_txtb_hw_cmd;
+        
+        -- Index of TXT Buffer for which HW commands is valid          
+        txtb_hw_cmd_index      :in   natural range 0 to G_TXT_BUFFER_COUNT - 1;
+
+        -- TXT FIFO RAM data output (frame at head of FIFO)
+        txtb_port_b_data       :out  std_logic_vector(31 downto 0);
+        
+        -- TXT FIFO RAM address (within frame at head of FIFO)
+        txtb_port_b_address    :in   natural range 0 to 19;
+
+        -- Clock enable to TXT FIFO port B
+        txtb_port_b_clk_en     :in   std_logic;
+
+        -- Unit just turned bus off.
+        is_bus_off             :in   std_logic;
+
+        -- TXT FIFO is available to be locked by CAN Core for transmission
+        txtb_available         :out  std_logic
+    );
+end entity;
+
+architecture rtl of txt_fifo is
+
+    -- Number of words in single slot of FIFO (one frame)
+    constant C_SLOT_SIZE          : natural := 20;
+
+    -- TXT FIFO RAM size and address width
+    constant C_RAM_DEPTH          : natural := G_DEPTH * C_SLOT_SIZE;
+    constant C_RAM_ADDRESS_WIDTH  : natural :=
+        integer(ceil(log2(real(C_RAM_DEPTH))));
+
+    ----------------------------------------------------------------------------
+    -- FIFO pointers
+    ----------------------------------------------------------------------------
+    -- Slot with frame which is offered to TX Arbitrator
+    signal head                   : natural range 0 to G_DEPTH - 1;
+
+    -- Slot to which SW writes next frame
+    signal tail                   : natural range 0 to G_DEPTH - 1;
+
+    -- Number of frames in FIFO
+    signal fill_q                 : natural range 0 to G_DEPTH;
+    signal fill_d                 : natural range 0 to G_DEPTH;
+
+    -- FIFO is full
+    signal fifo_full              : std_logic;
+
+    ----------------------------------------------------------------------------
+    -- FIFO operations
+    ----------------------------------------------------------------------------
+    -- Insert frame at tail
+    signal push                   : std_logic;
+
+    -- Remove frame from head (transmitted succesfully)
+    signal pop                    : std_logic;
+
+    -- Remove all frames
+    signal flush                  : std_logic;
+
+    -- Internal buffer selects for commands. Commands are shared across the
+    -- buffers so we need unique identifier
+    signal hw_cbs                 : std_logic;
+    signal sw_cbs                 : std_logic;
+
+    ----------------------------------------------------------------------------
+    -- TXT Buffer FSM interface
+    ----------------------------------------------------------------------------
+    -- Commands to FSM (set_ready is generated internally)
+    signal fsm_sw_cmd             : t_txtb_sw_cmd;
+
+    -- FSM state (encoded) and its registered value
+    signal txtb_state_i           : std_logic_vector(3 downto 0);
+    signal txtb_state_q           : std_logic_vector(3 downto 0);
+
+    -- FSM is in one of final states (Empty, TX OK, Failed, Aborted)
+    signal fsm_final              : std_logic;
+
+    -- Unmask TXT FIFO RAM output
+    signal txtb_unmask_data_ram   : std_logic;
+
+    -- Output of TXT FIFO RAM
+    signal txtb_port_b_data_i     : std_logic_vector(31 downto 0);
+
+    ----------------------------------------------------------------------------
+    -- RAM wrapper signals
+    ----------------------------------------------------------------------------
+    -- Write control signal    
+    signal ram_write              : std_logic;
+
+    -- Write and read addresses
+    signal ram_write_address      : std_logic_vector(C_RAM_ADDRESS_WIDTH - 1 downto 0);
+    signal ram_read_address       : std_logic_vector(C_RAM_ADDRESS_WIDTH - 1 downto 0);
+
+    -- Clock enabled
+    signal txtb_ram_clk_en        : std_logic;
+    
+    -- RAM clocks
+    signal clk_ram                : std_logic;
+
+begin
+        
+    -- Command buffer select signals
+    hw_cbs <= '1' when (txtb_hw_cmd_index = G_ID)
+                  else
+              '0';
+  
+    sw_cbs <= '1' when (txtb_sw_cmd_index(G_ID) = '1') 
+                  else
+              '0';
+
+    fsm_final <= '1' when (txtb_state_i = TXT_ETY or txtb_state_i = TXT_TOK or
+                           txtb_state_i = TXT_ERR or txtb_state_i = TXT_ABT)
+                     else
+                 '0';
+
+    fifo_full <= '1' when (fill_q = G_DEPTH)
+                     else
+                 '0';
+
+    ----------------------------------------------------------------------------
+    -- FIFO operations:
+    --  1. Push - "set_ready" command when FIFO is not full.
+    --  2. Pop - Frame at head was transmitted succesfully.
+    --  3. Flush - FSM just moved to Failed or Aborted, or "set_empty" command
+    --     when frame is not being transmitted.
+    ----------------------------------------------------------------------------
+    push <= '1' when (txtb_sw_cmd.set_rdy = '1' and sw_cbs = '1' and
+                      fifo_full = '0')
+                else
+            '0';
+
+    pop <= '1' when (txtb_hw_cmd.unlock = '1' and txtb_hw_cmd.valid = '1' and
+                     txtb_hw_cmd.failed = '0' and hw_cbs = '1')
+               else
+           '0';
+
+    flush <= '1' when (txtb_state_i /= txtb_state_q) and
+                      (txtb_state_i = TXT_ERR or txtb_state_i = TXT_ABT)
+                 else
+             '1' when (txtb_sw_cmd.set_ety = '1' and sw_cbs = '1' and
+                       fsm_final = '1')
+                 else
+             '0';
+
+    fill_d <= 1 when (flush = '1' and push = '1') else
+              0 when (flush = '1') else
+              fill_q + 1 when (push = '1' and pop = '0') else
+              fill_q - 1 when (push = '0' and pop = '1') else
+              fill_q;
+
+    ----------------------------------------------------------------------------
+    -- FIFO pointers
+    ----------------------------------------------------------------------------
+    fifo_ptr_proc : process(clk_sys, res_n)
+    begin
+        if (res_n = '0') then
+            head <= 0;
+            tail <= 0;
+            fill_q <= 0;
+            txtb_state_q <= TXT_ETY;
+        elsif (rising_edge(clk_sys)) then
+            if (push = '1') then
+                tail <= (tail + 1) mod G_DEPTH;
+            end if;
+
+            if (flush = '1') then
+                head <= tail;
+            elsif (pop = '1') then
+                head <= (head + 1) mod G_DEPTH;
+            end if;
+
+            fill_q <= fill_d;
+            txtb_state_q <= txtb_state_i;
+        end if;
+    end process;
+
+    tx_fifo_fill <= std_logic_vector(to_unsigned(fill_q, 7));
+    tx_fifo_full <= fifo_full;
+
+    -- Number of frames dropped to (or below) threshold
+    tx_fifo_int <= '1' when (pop = '1' and push = '0' and
+                             fill_d = to_integer(unsigned(tx_fifo_th)))
+                       else
+                   '1' when (flush = '1' and
+                             fill_q > to_integer(unsigned(tx_fifo_th)))
+                       else
+                   '0';
+
+    ----------------------------------------------------------------------------
+    -- Commands to TXT Buffer FSM. Frame at head of FIFO is made ready when FSM
+    -- is in final state. This is not done when FIFO is being flushed since
+    -- fill level is not updated yet.
+    ----------------------------------------------------------------------------
+    fsm_sw_cmd.set_rdy <= '1' when (fill_q > 0 and fsm_final = '1' and
+                                    flush = '0')
+                              else
+                          '0';
+    fsm_sw_cmd.set_ety <= txtb_sw_cmd.set_ety and sw_cbs;
+    fsm_sw_cmd.set_abt <= txtb_sw_cmd.set_abt and sw_cbs;
+
+    ----------------------------------------------------------------------------
+    -- TXT FIFO RAM addresses. Each frame occupies C_SLOT_SIZE words. Writes
+    -- outside of frame (beyond last data word) are ignored, so that they do not
+    -- overwrite next slot.
+    ----------------------------------------------------------------------------
+    ram_write <= '1' when (txtb_port_a_cs = '1' and fifo_full = '0' and
+                           unsigned(txtb_port_a_address) < C_SLOT_SIZE)
+                     else
+                 '0';
+
+    ram_write_address <= std_logic_vector(to_unsigned(
+                            tail * C_SLOT_SIZE + to_integer(unsigned(txtb_port_a_address)),
+                            C_RAM_ADDRESS_WIDTH));
+
+    ram_read_address <= std_logic_vector(to_unsigned(
+                            head * C_SLOT_SIZE + txtb_port_b_address,
+                            C_RAM_ADDRESS_WIDTH));
+
+    ----------------------------------------------------------------------------
+    -- Output of TXT FIFO RAM is masked when it is not valid (see TXT Buffer).
+    ----------------------------------------------------------------------------
+    txtb_port_b_data <= txtb_port_b_data_i when (txtb_unmask_data_ram = '1')
+                                           else
+                           (OTHERS => '0');
+
+    txtb_state <= txtb_state_i;
+
+    ----------------------------------------------------------------------------
+    -- Clock gating for TXT FIFO RAM. Enable when:
+    --  1. Read access from CAN core
+    --  2. Write access from user
+    --  3. Always in memory test mode, or in scan mode
+    ----------------------------------------------------------------------------
+    txtb_ram_clk_en <= '1' when (txtb_port_b_clk_en = '1' or ram_write = '1')
+                           else
+                       '1' when (test_registers_out.tst_control(TMAENA_IND) = '1' or
+                                 scan_enable = '1')
+                           else
+                       '0';
+
+    clk_gate_txt_fifo_ram_comp : entity ctu_can_fd_rtl.clk_gate
+    generic map(
+        G_TECHNOLOGY       => G_TECHNOLOGY
+    )
+    port map(
+        clk_in             => clk_sys,
+        clk_en             => txtb_ram_clk_en,
+
+        clk_out            => clk_ram
+    );
+
+    ----------------------------------------------------------------------------
+    -- RAM Memory of TXT FIFO
+    ----------------------------------------------------------------------------
+    txt_fifo_ram_inst : entity ctu_can_fd_rtl.txt_buffer_ram
+    generic map(
+        G_ID                 => G_ID,
+        G_DEPTH              => C_RAM_DEPTH,
+        G_ADDRESS_WIDTH      => C_RAM_ADDRESS_WIDTH
+    )
+    port map(
+        -- Clock and Asynchronous reset
+        clk_sys              => clk_ram,                -- IN
+
+        -- Memory testability
+        test_registers_out   => test_registers_out,     -- IN
+        tst_rdata_txt_buf    => tst_rdata_txt_buf,      -- OUT
+
+        -- Port A - Write (from Memory registers)
+        port_a_address       => ram_write_address,      -- IN
+        port_a_data_in       => txtb_port_a_data,       -- IN
+        port_a_write         => ram_write,              -- IN
+        port_a_be            => txtb_port_a_be,         -- IN
+
+        -- Port B - Read (from CAN Core)
+        port_b_address       => ram_read_address,       -- IN
+        port_b_data_out      => txtb_port_b_data_i      -- OUT
+    );
+    
+    ----------------------------------------------------------------------------
+    -- TXT Buffer FSM (handles frame at head of FIFO)
+    ----------------------------------------------------------------------------
+    txt_buffer_fsm_inst : entity ctu_can_fd_rtl.txt_buffer_fsm
+    generic map(
+        G_ID                   => G_ID
+    )
+    port map(
+        clk_sys                => clk_sys,                  -- IN
+        res_n                  => res_n,                    -- IN
+
+        txtb_sw_cmd            => fsm_sw_cmd,               -- IN
+        sw_cbs                 => '1',                      -- IN
+        txt_buf_failed_bof     => txt_buf_failed_bof,       -- IN
+
+        txtb_hw_cmd            => txtb_hw_cmd,              -- IN
+        hw_cbs                 => hw_cbs,                   -- IN
+        is_bus_off             => is_bus_off,               -- IN
+        drv_rom_ena            => drv_rom_ena,              -- IN
+        drv_bus_mon_ena        => drv_bus_mon_ena,          -- IN
+        txtb_cyclic            => '0',                      -- IN
+
+        txtb_user_accessible   => open,                     -- OUT
+        txtb_hw_cmd_int        => txtb_hw_cmd_int,          -- OUT
+        txtb_state             => txtb_state_i,             -- OUT
+        txtb_available         => txtb_available,           -- OUT
+        txtb_unmask_data_ram   => txtb_unmask_data_ram,     -- OUT
+        txtb_cyc_restart       => open                      -- OUT
+    );
+
+    -- <RELEASE_OFF>
+    ----------------------------------------------------------------------------
+    ----------------------------------------------------------------------------
+    -- Assertions and functional coverage
+    ----------------------------------------------------------------------------
+    ----------------------------------------------------------------------------
+    -- psl default clock is rising_edge(clk_sys);
+
+    -- psl txt_fifo_no_pop_when_empty_asrt : assert never
+    --  (pop = '1' and fill_q = 0)
+    --  report "Frame removed from empty TXT FIFO!";
+
+    -- psl txt_fifo_full_cov : cover
+    --  {fifo_full = '1'};
+
+    -- psl txt_fifo_push_when_full_cov : cover
+    --  {txtb_sw_cmd.set_rdy = '1' and sw_cbs = '1' and fifo_full = '1'};
+
+    -- psl txt_fifo_push_pop_cov : cover
+    --  {push = '1' and pop = '1'};
+
+    -- psl txt_fifo_flush_cov : cover
+    --  {flush = '1' and fill_q > 1};
+
+    -- psl txt_fifo_push_flush_cov : cover
+    --  {push = '1' and flush = '1'};
+
+    -- psl txt_fifo_th_int_cov : cover
+    --  {tx_fifo_int = '1'};
+
+    -- <RELEASE_ON>
+end architecture;
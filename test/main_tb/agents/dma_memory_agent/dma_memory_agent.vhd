@@ -0,0 +1,210 @@
+--------------------------------------------------------------------------------
+-- 
+-- CTU CAN FD IP Core 
+-- Copyright (C) 2021-present Ondrej Ille
+-- 
+-- Permission is hereby granted, free of charge, to any person obtaining a copy
+-- of this VHDL component and associated documentation files (the "Component"),
+-- to use, copy, modify, merge, publish, distribute the Component for
+-- educational, research, evaluation, self-interest purposes. Using the
+-- Component for commercial purposes is forbidden unless previously agreed with
+-- Copyright holder.
+-- 
+-- The above copyright notice and this permission notice shall be included in
+-- all copies or substantial portions of the Component.
+-- 
+-- THE COMPONENT IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+-- IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+-- FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+-- AUTHORS OR COPYRIGHTHOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+-- LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+-- FROM, OUT OF OR IN CONNECTION WITH THE COMPONENT OR THE USE OR OTHER DEALINGS
+-- IN THE COMPONENT.
+-- 
+-- The CAN protocol is developed by Robert Bosch GmbH and protected by patents.
+-- Anybody who wants to implement this IP core on silicon has to obtain a CAN
+-- protocol license from Bosch.
+-- 
+-- -------------------------------------------------------------------------------
+-- 
+-- CTU CAN FD IP Core 
+-- Copyright (C) 2015-2020 MIT License
+-- 
+-- Authors:
+--     Ondrej Ille <ondrej.ille@gmail.com>
+--     Martin Jerabek <martin.jerabek01@gmail.com>
+-- 
+-- Project advisors: 
+-- 	Jiri Novak <jnovak@fel.cvut.cz>
+-- 	Pavel Pisa <pisa@cmp.felk.cvut.cz>
+-- 
+-- Department of Measurement         (http://meas.fel.cvut.cz/)
+-- Faculty of Electrical Engineering (http://www.fel.cvut.cz)
+-- Czech Technical University        (http://www.cvut.cz/)
+-- 
+-- Permission is hereby granted, free of charge, to any person obtaining a copy
+-- of this VHDL component and associated documentation files (the "Component"),
+-- to deal in the Component without restriction, including without limitation
+-- the rights to use, copy, modify, merge, publish, distribute, sublicense,
+-- and/or sell copies of the Component, and to permit persons to whom the
+-- Component is furnished to do so, subject to the following conditions:
+-- 
+-- The above copyright notice and this permission notice shall be included in
+-- all copies or substantial portions of the Component.
+-- 
+-- THE COMPONENT IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+-- IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+-- FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+-- AUTHORS OR COPYRIGHTHOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+-- LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+-- FROM, OUT OF OR IN CONNECTION WITH THE COMPONENT OR THE USE OR OTHER DEALINGS
+-- IN THE COMPONENT.
+-- 
+-- The CAN protocol is developed by Robert Bosch GmbH and protected by patents.
+-- Anybody who wants to implement this IP core on silicon has to obtain a CAN
+-- protocol license from Bosch.
+-- 
+--------------------------------------------------------------------------------
+--------------------------------------------------------------------------------
+--  @Purpose:
+--    DMA memory agent - Simple memory slave connected to RX DMA bus master
+--    interface of DUT.
+--
+--    Has following features:
+--      - Stores data of each write request to memory (address is taken
+--        modulo memory size).
+--      - Configurable number of wait cycles before acknowledge.
+--      - Finishing writes with error (data are not stored).
+--      - Reading memory content and number of executed writes.
+--
+--------------------------------------------------------------------------------
+-- Revision History:
+--    19.10.2026   Created file
+--------------------------------------------------------------------------------
+
+Library ctu_can_fd_tb;
+context ctu_can_fd_tb.ieee_context;
+context ctu_can_fd_tb.tb_common_context;
+
+use ctu_can_fd_tb.dma_memory_agent_pkg.all;
+
+
+entity dma_memory_agent is
+    port (
+        clk_sys     : in  std_logic;
+
+        dma_m_addr  : in  std_logic_vector(31 downto 0);
+        dma_m_wdata : in  std_logic_vector(31 downto 0);
+        dma_m_req   : in  std_logic;
+        dma_m_ack   : out std_logic;
+        dma_m_err   : out std_logic
+    );
+end entity;
+
+
+architecture tb of dma_memory_agent is
+
+    type t_dma_memory is array (0 to C_DMA_MEMORY_SIZE - 1) of
+        std_logic_vector(31 downto 0);
+
+    signal memory       : t_dma_memory := (OTHERS => (OTHERS => '0'));
+
+    ---------------------------------------------------------------------------
+    -- Parameters configured over communication library
+    ---------------------------------------------------------------------------
+    signal ack_delay    : natural := 0;
+    signal error_ena    : boolean := false;
+
+    signal mem_clear    : std_logic := '0';
+
+    signal wait_ctr     : natural := 0;
+    signal write_ctr    : natural := 0;
+
+    signal dma_m_ack_i  : std_logic := '0';
+
+begin
+
+    ---------------------------------------------------------------------------
+    -- Comunication receiver process
+    ---------------------------------------------------------------------------
+    receiver_proc : process
+        variable cmd : integer;
+        variable reply_code : integer;
+        variable tmp_int : integer;
+    begin
+        receive_start(default_channel, C_DMA_MEMORY_AGENT_ID);
+
+        -- Command is sent as message type
+        cmd := com_channel_data.get_msg_code;
+        reply_code := C_REPLY_CODE_OK;
+
+        case cmd is
+        when DMA_MEMORY_AGENT_CMD_CLEAR =>
+            mem_clear <= '1';
+            wait for 0 ns;
+            mem_clear <= '0';
+            wait for 0 ns;
+
+        when DMA_MEMORY_AGENT_CMD_READ =>
+            tmp_int := com_channel_data.get_param;
+            com_channel_data.set_param(
+                memory((tmp_int / 4) mod C_DMA_MEMORY_SIZE));
+
+        when DMA_MEMORY_AGENT_CMD_ACK_DELAY_SET =>
+            ack_delay <= com_channel_data.get_param;
+
+        when DMA_MEMORY_AGENT_CMD_ERROR_SET =>
+            error_ena <= com_channel_data.get_param;
+
+        when DMA_MEMORY_AGENT_CMD_GET_WRITE_COUNT =>
+            com_channel_data.set_param(write_ctr);
+
+        when others =>
+            info_m("Invalid message type: " & integer'image(cmd));
+            reply_code := C_REPLY_CODE_ERR;
+
+        end case;
+        receive_finish(default_channel, reply_code);
+    end process;
+
+    ---------------------------------------------------------------------------
+    -- Memory slave. Request is held by master until acknowledge, which is
+    -- active for single clock cycle.
+    ---------------------------------------------------------------------------
+    memory_proc : process(clk_sys, mem_clear)
+        variable index : natural;
+    begin
+        if (mem_clear = '1') then
+            memory      <= (OTHERS => (OTHERS => '0'));
+            write_ctr   <= 0;
+            wait_ctr    <= 0;
+            dma_m_ack_i <= '0';
+            dma_m_err   <= '0';
+
+        elsif (rising_edge(clk_sys)) then
+            dma_m_ack_i <= '0';
+            dma_m_err   <= '0';
+
+            if (dma_m_req = '1' and dma_m_ack_i = '0') then
+                if (wait_ctr < ack_delay) then
+                    wait_ctr <= wait_ctr + 1;
+                else
+                    wait_ctr    <= 0;
+                    write_ctr   <= write_ctr + 1;
+                    dma_m_ack_i <= '1';
+
+                    if (error_ena) then
+                        dma_m_err <= '1';
+                    else
+                        index := (to_integer(unsigned(dma_m_addr(31 downto 2))))
+                                    mod C_DMA_MEMORY_SIZE;
+                        memory(index) <= dma_m_wdata;
+                    end if;
+                end if;
+            end if;
+        end if;
+    end process;
+
+    dma_m_ack <= dma_m_ack_i;
+
+end architecture;
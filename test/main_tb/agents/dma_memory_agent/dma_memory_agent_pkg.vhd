@@ -0,0 +1,248 @@
+--------------------------------------------------------------------------------
+-- 
+-- CTU CAN FD IP Core 
+-- Copyright (C) 2021-present Ondrej Ille
+-- 
+-- Permission is hereby granted, free of charge, to any person obtaining a copy
+-- of this VHDL component and associated documentation files (the "Component"),
+-- to use, copy, modify, merge, publish, distribute the Component for
+-- educational, research, evaluation, self-interest purposes. Using the
+-- Component for commercial purposes is forbidden unless previously agreed with
+-- Copyright holder.
+-- 
+-- The above copyright notice and this permission notice shall be included in
+-- all copies or substantial portions of the Component.
+-- 
+-- THE COMPONENT IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+-- IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+-- FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+-- AUTHORS OR COPYRIGHTHOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+-- LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+-- FROM, OUT OF OR IN CONNECTION WITH THE COMPONENT OR THE USE OR OTHER DEALINGS
+-- IN THE COMPONENT.
+-- 
+-- The CAN protocol is developed by Robert Bosch GmbH and protected by patents.
+-- Anybody who wants to implement this IP core on silicon has to obtain a CAN
+-- protocol license from Bosch.
+-- 
+-- -------------------------------------------------------------------------------
+-- 
+-- CTU CAN FD IP Core 
+-- Copyright (C) 2015-2020 MIT License
+-- 
+-- Authors:
+--     Ondrej Ille <ondrej.ille@gmail.com>
+--     Martin Jerabek <martin.jerabek01@gmail.com>
+-- 
+-- Project advisors: 
+-- 	Jiri Novak <jnovak@fel.cvut.cz>
+-- 	Pavel Pisa <pisa@cmp.felk.cvut.cz>
+-- 
+-- Department of Measurement         (http://meas.fel.cvut.cz/)
+-- Faculty of Electrical Engineering (http://www.fel.cvut.cz)
+-- Czech Technical University        (http://www.cvut.cz/)
+-- 
+-- Permission is hereby granted, free of charge, to any person obtaining a copy
+-- of this VHDL component and associated documentation files (the "Component"),
+-- to deal in the Component without restriction, including without limitation
+-- the rights to use, copy, modify, merge, publish, distribute, sublicense,
+-- and/or sell copies of the Component, and to permit persons to whom the
+-- Component is furnished to do so, subject to the following conditions:
+-- 
+-- The above copyright notice and this permission notice shall be included in
+-- all copies or substantial portions of the Component.
+-- 
+-- THE COMPONENT IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+-- IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+-- FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+-- AUTHORS OR COPYRIGHTHOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+-- LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+-- FROM, OUT OF OR IN CONNECTION WITH THE COMPONENT OR THE USE OR OTHER DEALINGS
+-- IN THE COMPONENT.
+-- 
+-- The CAN protocol is developed by Robert Bosch GmbH and protected by patents.
+-- Anybody who wants to implement this IP core on silicon has to obtain a CAN
+-- protocol license from Bosch.
+-- 
+--------------------------------------------------------------------------------
+--------------------------------------------------------------------------------
+--  @Purpose:
+--    Package with API for DMA memory agent.
+--
+--------------------------------------------------------------------------------
+-- Revision History:
+--    19.10.2026   Created file
+--------------------------------------------------------------------------------
+
+Library ctu_can_fd_tb;
+context ctu_can_fd_tb.ieee_context;
+context ctu_can_fd_tb.tb_common_context;
+
+
+package dma_memory_agent_pkg is
+
+    -- Size of memory model (32 bit words). Address is taken modulo size.
+    constant C_DMA_MEMORY_SIZE : natural := 1024;
+
+    ---------------------------------------------------------------------------
+    -- DMA memory agent component
+    ---------------------------------------------------------------------------
+    component dma_memory_agent is
+    port (
+        clk_sys     : in  std_logic;
+
+        dma_m_addr  : in  std_logic_vector(31 downto 0);
+        dma_m_wdata : in  std_logic_vector(31 downto 0);
+        dma_m_req   : in  std_logic;
+        dma_m_ack   : out std_logic;
+        dma_m_err   : out std_logic
+    );
+    end component;
+
+    ---------------------------------------------------------------------------
+    ---------------------------------------------------------------------------
+    -- DMA memory agent API
+    ---------------------------------------------------------------------------
+    ---------------------------------------------------------------------------
+
+    ---------------------------------------------------------------------------
+    -- Clear whole memory and number of executed writes
+    --
+    -- @param channel   Channel on which to send the request
+    ---------------------------------------------------------------------------
+    procedure dma_memory_agent_clear(
+        signal   channel     : inout t_com_channel
+    );
+
+    ---------------------------------------------------------------------------
+    -- Read word from memory
+    --
+    -- @param channel   Channel on which to send the request
+    -- @param address   Byte address (word aligned)
+    -- @param data      Read data
+    ---------------------------------------------------------------------------
+    procedure dma_memory_agent_read(
+        signal   channel     : inout t_com_channel;
+        constant address     : in    natural;
+        variable data        : out   std_logic_vector(31 downto 0)
+    );
+
+    ---------------------------------------------------------------------------
+    -- Configure number of clock cycles between request and acknowledge
+    --
+    -- @param channel   Channel on which to send the request
+    -- @param delay     Number of wait cycles
+    ---------------------------------------------------------------------------
+    procedure dma_memory_agent_set_ack_delay(
+        signal   channel     : inout t_com_channel;
+        constant delay       : in    natural
+    );
+
+    ---------------------------------------------------------------------------
+    -- Finish all following writes with error (data are not stored)
+    --
+    -- @param channel   Channel on which to send the request
+    -- @param error     True - finish writes with error, False - normally
+    ---------------------------------------------------------------------------
+    procedure dma_memory_agent_set_error(
+        signal   channel     : inout t_com_channel;
+        constant error       : in    boolean
+    );
+
+    ---------------------------------------------------------------------------
+    -- Get number of writes executed since last clear (including writes
+    -- finished with error).
+    --
+    -- @param channel   Channel on which to send the request
+    -- @param count     Number of writes
+    ---------------------------------------------------------------------------
+    procedure dma_memory_agent_get_write_count(
+        signal   channel     : inout t_com_channel;
+        variable count       : out   natural
+    );
+
+    ---------------------------------------------------------------------------
+    ---------------------------------------------------------------------------
+    -- Private declarations
+    ---------------------------------------------------------------------------
+    ---------------------------------------------------------------------------
+
+    -- Supported commands
+    constant DMA_MEMORY_AGENT_CMD_CLEAR                 : integer := 0;
+    constant DMA_MEMORY_AGENT_CMD_READ                  : integer := 1;
+    constant DMA_MEMORY_AGENT_CMD_ACK_DELAY_SET         : integer := 2;
+    constant DMA_MEMORY_AGENT_CMD_ERROR_SET             : integer := 3;
+    constant DMA_MEMORY_AGENT_CMD_GET_WRITE_COUNT       : integer := 4;
+
+    -- Tag for messages
+    constant DMA_MEMORY_AGENT_TAG : string := "DMA Memory Agent: ";
+
+end package;
+
+
+package body dma_memory_agent_pkg is
+
+    procedure dma_memory_agent_clear(
+        signal   channel     : inout t_com_channel
+    ) is
+    begin
+        info_m(DMA_MEMORY_AGENT_TAG & "Clearing memory");
+        send(channel, C_DMA_MEMORY_AGENT_ID, DMA_MEMORY_AGENT_CMD_CLEAR);
+        debug_m(DMA_MEMORY_AGENT_TAG & "Memory cleared");
+    end procedure;
+
+
+    procedure dma_memory_agent_read(
+        signal   channel     : inout t_com_channel;
+        constant address     : in    natural;
+        variable data        : out   std_logic_vector(31 downto 0)
+    ) is
+        variable tmp : std_logic_vector(127 downto 0);
+    begin
+        debug_m(DMA_MEMORY_AGENT_TAG & "Reading address: " &
+                integer'image(address));
+        com_channel_data.set_param(address);
+        send(channel, C_DMA_MEMORY_AGENT_ID, DMA_MEMORY_AGENT_CMD_READ);
+        tmp := com_channel_data.get_param;
+        data := tmp(31 downto 0);
+        debug_m(DMA_MEMORY_AGENT_TAG & "Read data: 0x" & to_hstring(tmp(31 downto 0)));
+    end procedure;
+
+
+    procedure dma_memory_agent_set_ack_delay(
+        signal   channel     : inout t_com_channel;
+        constant delay       : in    natural
+    ) is
+    begin
+        info_m(DMA_MEMORY_AGENT_TAG & "Setting acknowledge delay");
+        com_channel_data.set_param(delay);
+        send(channel, C_DMA_MEMORY_AGENT_ID, DMA_MEMORY_AGENT_CMD_ACK_DELAY_SET);
+        debug_m(DMA_MEMORY_AGENT_TAG & "Acknowledge delay set");
+    end procedure;
+
+
+    procedure dma_memory_agent_set_error(
+        signal   channel     : inout t_com_channel;
+        constant error       : in    boolean
+    ) is
+    begin
+        info_m(DMA_MEMORY_AGENT_TAG & "Setting error response: " &
+               boolean'image(error));
+        com_channel_data.set_param(error);
+        send(channel, C_DMA_MEMORY_AGENT_ID, DMA_MEMORY_AGENT_CMD_ERROR_SET);
+        debug_m(DMA_MEMORY_AGENT_TAG & "Error response set");
+    end procedure;
+
+
+    procedure dma_memory_agent_get_write_count(
+        signal   channel     : inout t_com_channel;
+        variable count       : out   natural
+    ) is
+    begin
+        info_m(DMA_MEMORY_AGENT_TAG & "Getting write count");
+        send(channel, C_DMA_MEMORY_AGENT_ID, DMA_MEMORY_AGENT_CMD_GET_WRITE_COUNT);
+        count := com_channel_data.get_param;
+        debug_m(DMA_MEMORY_AGENT_TAG & "Write count: " & integer'image(count));
+    end procedure;
+
+end package body;
@@ -176,6 +176,7 @@ begin
         sup_filtB           => false,
         sup_filtC           => false,
         sup_range           => false,
+        sup_filt_set        => false,
         sup_traffic_ctrs    => false,
         target_technology   => C_TECH_ASIC
     )
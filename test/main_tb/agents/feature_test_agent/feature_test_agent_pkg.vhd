@@ -186,10 +186,13 @@ package feature_test_agent_pkg is
         tx_frame_ctr_rst        :   boolean;
         clear_pexs_flag         :   boolean;
         rx_buf_rdptr_move       :   boolean;
+        rx_drop_ctr_rst         :   boolean;
+        bus_stat_snap           :   boolean;
+        rx_skip_frame           :   boolean;
     end record;
 
     constant SW_command_rst_val : SW_command :=
-        (false, false, false, false, false, false, false);
+        (false, false, false, false, false, false, false, false, false, false);
 
     -- Controller status
     type SW_status is record
@@ -220,11 +223,15 @@ package feature_test_agent_pkg is
         rx_buffer_not_empty_int :   boolean;
         tx_buffer_hw_cmd        :   boolean;
         overload_frame          :   boolean;
+        rx_dma_int              :   boolean;
+        tx_fifo_int             :   boolean;
+        rx_prio_int             :   boolean;
+        rx_prio_not_empty_int   :   boolean;
     end record;
     
     constant SW_interrupts_rst_val : SW_interrupts := (
         false, false, false, false, false, false, false, false,
-        false, false, false, false, false);
+        false, false, false, false, false, false, false, false, false);
 
     -- Fault confinement states
     type SW_fault_state is (
@@ -253,6 +260,15 @@ package feature_test_agent_pkg is
         tx_frames               :   natural;
     end record;
 
+    -- Bus statistics counters
+    type SW_bus_stat is record
+        busy_bits               :   natural;
+        idle_bits               :   natural;
+        err_frames              :   natural;
+        ovr_frames              :   natural;
+        stuff_bits              :   natural;
+    end record;
+
     -- RX Buffer info and status
     type SW_RX_Buffer_info is record
         rx_buff_size            :   natural range 0 to 2 ** 13 - 1;
@@ -268,6 +284,8 @@ package feature_test_agent_pkg is
     -- RX Buffer options
     type SW_RX_Buffer_options is record
         rx_time_stamp_options   :   boolean;
+        rx_drop_oldest          :   boolean;
+        rx_time_stamp_both      :   boolean;
     end record;
 
     -- Error code capture
@@ -402,6 +420,10 @@ package feature_test_agent_pkg is
         -- Timestamp (as defined in TIMESTAMP_U_W and TIMESTAMP_L_W)
         timestamp               :   std_logic_vector(63 downto 0);
 
+        -- End of frame timestamp (stored after data words when
+        -- FRAME_FORMAT_W[ETS] is set). Valid only for received frames.
+        eof_timestamp           :   std_logic_vector(63 downto 0);
+
         -- Receive word count field as stored in RX Buffer FRAME_FORM_W.
         -- Indicates number of 32 bit words which Frame ocupies in RX Buffer
         -- without FRAME_FORM_W.
@@ -1599,6 +1621,37 @@ package feature_test_agent_pkg is
     );
 
 
+    ----------------------------------------------------------------------------
+    -- Take snapshot of bus statistics counters (counters are cleared) and
+    -- read it.
+    --
+    -- Arguments:
+    --  stat            Variable in which bus statistics will be stored
+    --  node            Node which shall be accessed (Test node or DUT).
+    ----------------------------------------------------------------------------
+    procedure read_bus_stat(
+        variable stat           : out   SW_bus_stat;
+        constant node           : in    t_feature_node;
+        signal   channel        : inout t_com_channel
+    );
+
+
+    ----------------------------------------------------------------------------
+    -- Read timestamp at which last transmission from TXT Buffer started.
+    --
+    -- Arguments:
+    --  ts              Variable in which timestamp will be stored
+    --  buf_nr          Number of TXT Buffer (1 : Number of TXT Buffers)
+    --  node            Node which shall be accessed (Test node or DUT).
+    ----------------------------------------------------------------------------
+    procedure read_txtb_ts(
+        variable ts             : out   std_logic_vector(63 downto 0);
+        constant buf_nr         : in    SW_TXT_index_type;
+        constant node           : in    t_feature_node;
+        signal   channel        : inout t_com_channel
+    );
+
+
     ----------------------------------------------------------------------------
     -- Read transceiver delay register.
     --
@@ -2616,6 +2669,7 @@ package body feature_test_agent_pkg is
 
         decode_dlc(frame.dlc, frame.data_length);
         frame.timestamp := (OTHERS => '0');
+        frame.eof_timestamp := (OTHERS => '0');
 
         if (frame.rtr = RTR_FRAME) then
             frame.data          := (OTHERS => (OTHERS => '0'));
@@ -3012,6 +3066,21 @@ package body feature_test_agent_pkg is
                 frame.data((i * 4) + 3) := r_data(31 downto 24);
             end loop;
         end if;
+
+        -- End of frame timestamp follows data words
+        if (frm_fmt_word(ETS_IND) = '1') then
+            for i in 0 to 1 loop
+                if (automatic_mode) then
+                    CAN_read(r_data, RX_DATA_ADR, node, channel);
+                else
+                    CAN_read_by_byte(r_data, RX_DATA_ADR, node, channel);
+                    give_controller_command(command, node, channel);
+                end if;
+                frame.eof_timestamp(32 * i + 31 downto 32 * i) := r_data;
+            end loop;
+        else
+            frame.eof_timestamp := frame.timestamp;
+        end if;
     end procedure;
 
 
@@ -3394,6 +3463,18 @@ package body feature_test_agent_pkg is
             data(RTSOP_IND mod 8) := RTS_END;
         end if;
 
+        if (options.rx_drop_oldest) then
+            data(ROVP_IND mod 8) := ROVP_DROP_OLD;
+        else
+            data(ROVP_IND mod 8) := ROVP_DROP_NEW;
+        end if;
+
+        if (options.rx_time_stamp_both) then
+            data(RTSB_IND mod 8) := '1';
+        else
+            data(RTSB_IND mod 8) := '0';
+        end if;
+
         CAN_write(data, RX_SETTINGS_ADR, node, channel);
     end procedure;
 
@@ -3658,6 +3739,18 @@ package body feature_test_agent_pkg is
         if (command.rx_buf_rdptr_move) then
             data(RXRPMV_IND)     := '1';
         end if;
+
+        if (command.rx_drop_ctr_rst) then
+            data(RXDCRST_IND)    := '1';
+        end if;
+
+        if (command.bus_stat_snap) then
+            data(BSSNAP_IND)     := '1';
+        end if;
+
+        if (command.rx_skip_frame) then
+            data(RXSKIP_IND)     := '1';
+        end if;
         
         CAN_write(data, COMMAND_ADR, node, channel);
     end procedure;
@@ -3818,6 +3911,22 @@ package body feature_test_agent_pkg is
             tmp(OFI_IND)        := '1';
         end if;
 
+        if (interrupts.rx_dma_int) then
+            tmp(DMAI_IND)       := '1';
+        end if;
+
+        if (interrupts.tx_fifo_int) then
+            tmp(TFTI_IND)       := '1';
+        end if;
+
+        if (interrupts.rx_prio_int) then
+            tmp(RXPI_IND)       := '1';
+        end if;
+
+        if (interrupts.rx_prio_not_empty_int) then
+            tmp(RPNEI_IND)      := '1';
+        end if;
+
         return tmp;
     end function;
 
@@ -3827,8 +3936,8 @@ package body feature_test_agent_pkg is
     )return SW_interrupts is
         variable tmp            :       SW_interrupts;
     begin
-        tmp := (false, false, false, false, false, false,
-                false, false, false, false, false, false, false);
+        tmp := (false, false, false, false, false, false, false, false,
+                false, false, false, false, false, false, false, false, false);
 
         if (int_reg(RXI_IND) = '1') then
             tmp.receive_int              :=  true;
@@ -3878,6 +3987,22 @@ package body feature_test_agent_pkg is
             tmp.overload_frame           := true;
         end if;
 
+        if (int_reg(DMAI_IND) = '1') then
+            tmp.rx_dma_int               := true;
+        end if;
+
+        if (int_reg(TFTI_IND) = '1') then
+            tmp.tx_fifo_int              := true;
+        end if;
+
+        if (int_reg(RXPI_IND) = '1') then
+            tmp.rx_prio_int              := true;
+        end if;
+
+        if (int_reg(RPNEI_IND) = '1') then
+            tmp.rx_prio_not_empty_int    := true;
+        end if;
+
         return tmp;
     end function;
 
@@ -4274,6 +4399,58 @@ package body feature_test_agent_pkg is
     end procedure;
 
 
+    procedure read_bus_stat(
+        variable stat           : out   SW_bus_stat;
+        constant node           : in    t_feature_node;
+        signal   channel        : inout t_com_channel
+    )is
+        variable data           :       std_logic_vector(31 downto 0);
+        variable command        :       SW_command := SW_command_rst_val;
+
+        type t_bus_stat_vals is array (0 to 4) of natural;
+        variable val            :       t_bus_stat_vals;
+    begin
+        command.bus_stat_snap := true;
+        give_controller_command(command, node, channel);
+
+        for i in val'range loop
+            data := (OTHERS => '0');
+            data(BSSEL_H downto BSSEL_L) := std_logic_vector(
+                                                to_unsigned(i, 3));
+            CAN_write(data, BUS_STAT_SEL_ADR, node, channel);
+
+            CAN_read(data, BUS_STAT_ADR, node, channel);
+            val(i) := to_integer(unsigned(data(BS_VAL_H downto BS_VAL_L)));
+        end loop;
+
+        stat.busy_bits  := val(to_integer(unsigned(BS_BUSY_BITS)));
+        stat.idle_bits  := val(to_integer(unsigned(BS_IDLE_BITS)));
+        stat.err_frames := val(to_integer(unsigned(BS_ERR_FRMS)));
+        stat.ovr_frames := val(to_integer(unsigned(BS_OVR_FRMS)));
+        stat.stuff_bits := val(to_integer(unsigned(BS_STUFF_BITS)));
+    end procedure;
+
+
+    procedure read_txtb_ts(
+        variable ts             : out   std_logic_vector(63 downto 0);
+        constant buf_nr         : in    SW_TXT_index_type;
+        constant node           : in    t_feature_node;
+        signal   channel        : inout t_com_channel
+    )is
+        variable data           :       std_logic_vector(31 downto 0);
+    begin
+        data := (OTHERS => '0');
+        data(TTSEL_H downto TTSEL_L) := std_logic_vector(
+                                            to_unsigned(buf_nr - 1, 3));
+        CAN_write(data, TXTB_TS_SEL_ADR, node, channel);
+
+        CAN_read(data, TXTB_TS_LOW_ADR, node, channel);
+        ts(31 downto 0) := data;
+        CAN_read(data, TXTB_TS_HIGH_ADR, node, channel);
+        ts(63 downto 32) := data;
+    end procedure;
+
+
     procedure read_trv_delay(
         variable trv_delay      : out   natural;
         constant node           : in    t_feature_node;
@@ -102,6 +102,7 @@ use ctu_can_fd_tb.btr_maximal_ftest.all;
 use ctu_can_fd_tb.btr_minimal_ftest.all;
 use ctu_can_fd_tb.btr_ssp_access_ftest.all;
 use ctu_can_fd_tb.bus_start_ftest.all;
+use ctu_can_fd_tb.bus_stat_ftest.all;
 use ctu_can_fd_tb.byte_enable_ftest.all;
 
 use ctu_can_fd_tb.command_cdo_ftest.all;
@@ -141,6 +142,7 @@ use ctu_can_fd_tb.int_tx_ftest.all;
 use ctu_can_fd_tb.int_of_ftest.all;
 
 use ctu_can_fd_tb.message_filter_ftest.all;
+use ctu_can_fd_tb.message_filter_id_set_ftest.all;
 use ctu_can_fd_tb.mode_bus_monitoring_ftest.all;
 use ctu_can_fd_tb.mode_fd_enable_ftest.all;
 use ctu_can_fd_tb.mode_loopback_ftest.all;
@@ -164,6 +166,12 @@ use ctu_can_fd_tb.retr_limit_2_ftest.all;
 use ctu_can_fd_tb.retr_limit_3_ftest.all;
 use ctu_can_fd_tb.rx_buf_empty_read_ftest.all;
 use ctu_can_fd_tb.rx_counter_ftest.all;
+use ctu_can_fd_tb.rx_data_window_ftest.all;
+use ctu_can_fd_tb.rx_dma_ftest.all;
+use ctu_can_fd_tb.rx_peek_skip_ftest.all;
+use ctu_can_fd_tb.rx_prio_ftest.all;
+use ctu_can_fd_tb.rx_settings_rovp_ftest.all;
+use ctu_can_fd_tb.rx_settings_rtsb_ftest.all;
 use ctu_can_fd_tb.rx_settings_rtsop_ftest.all;
 use ctu_can_fd_tb.rx_status_ftest.all;
 use ctu_can_fd_tb.rx_status_mof_ftest.all;
@@ -196,8 +204,13 @@ use ctu_can_fd_tb.tx_priority_change_ftest.all;
 use ctu_can_fd_tb.tx_priority_ftest.all;
 use ctu_can_fd_tb.tx_status_ftest.all;
 use ctu_can_fd_tb.timestamp_low_high_ftest.all;
+use ctu_can_fd_tb.ts_gen_ftest.all;
+use ctu_can_fd_tb.hal_cosim_ftest.all;
 use ctu_can_fd_tb.txt_buffer_byte_access_ftest.all;
 use ctu_can_fd_tb.txt_buffer_hazard_ftest.all;
+use ctu_can_fd_tb.txt_cyclic_ftest.all;
+use ctu_can_fd_tb.tx_cpl_ftest.all;
+use ctu_can_fd_tb.tx_fifo_ftest.all;
 
 
 package feature_test_list_pkg is
@@ -244,6 +257,8 @@ package body feature_test_list_pkg is
             btr_ssp_access_ftest_exec(channel);
         elsif (test_name = "bus_start") then
             bus_start_ftest_exec(channel);
+        elsif (test_name = "bus_stat") then
+            bus_stat_ftest_exec(channel);
         elsif (test_name = "byte_enable") then
             byte_enable_ftest_exec(channel);
         
@@ -316,6 +331,8 @@ package body feature_test_list_pkg is
 
         elsif (test_name = "message_filter") then
             message_filter_ftest_exec(channel);
+        elsif (test_name = "message_filter_id_set") then
+            message_filter_id_set_ftest_exec(channel);
         elsif (test_name = "mode_bus_monitoring") then
             mode_bus_monitoring_ftest_exec(channel);
         elsif (test_name = "mode_fd_enable") then
@@ -359,6 +376,18 @@ package body feature_test_list_pkg is
             rx_buf_empty_read_ftest_exec(channel);
         elsif (test_name = "rx_counter") then
             rx_counter_ftest_exec(channel);
+        elsif (test_name = "rx_data_window") then
+            rx_data_window_ftest_exec(channel);
+        elsif (test_name = "rx_dma") then
+            rx_dma_ftest_exec(channel);
+        elsif (test_name = "rx_peek_skip") then
+            rx_peek_skip_ftest_exec(channel);
+        elsif (test_name = "rx_prio") then
+            rx_prio_ftest_exec(channel);
+        elsif (test_name = "rx_settings_rovp") then
+            rx_settings_rovp_ftest_exec(channel);
+        elsif (test_name = "rx_settings_rtsb") then
+            rx_settings_rtsb_ftest_exec(channel);
         elsif (test_name = "rx_settings_rtsop") then
             rx_settings_rtsop_ftest_exec(channel);
         elsif (test_name = "rx_status") then
@@ -421,10 +450,20 @@ package body feature_test_list_pkg is
             tx_status_ftest_exec(channel);
         elsif (test_name = "timestamp_low_high") then
             timestamp_low_high_ftest_exec(channel);
+        elsif (test_name = "ts_gen") then
+            ts_gen_ftest_exec(channel);
         elsif (test_name = "txt_buffer_byte_access") then
             txt_buffer_byte_access_ftest_exec(channel);
         elsif (test_name = "txt_buffer_hazard") then
             txt_buffer_hazard_ftest_exec(channel);
+        elsif (test_name = "txt_cyclic") then
+            txt_cyclic_ftest_exec(channel);
+        elsif (test_name = "tx_cpl") then
+            tx_cpl_ftest_exec(channel);
+        elsif (test_name = "tx_fifo") then
+            tx_fifo_ftest_exec(channel);
+        elsif (test_name = "hal_cosim") then
+            hal_cosim_ftest_exec(channel);
             
         else
             error_m("TODO: Implement calling feature test function based on test name!!");
@@ -80,9 +80,14 @@
 --
 --    Reference tests are ALWAYS run on 2 MBit/500 KBit with 80 % sample point!
 --
+--    Data sets are read at run-time from "reference_<test_name>.txt" files in
+--    "reference_data_path" directory. Frames are read one by one, when end of
+--    file is reached, reading continues from start of the file.
+--
 --------------------------------------------------------------------------------
 -- Revision History:
 --    09.4.2021   Created file
+--    19.10.2026  Read data sets from files at run-time.
 --------------------------------------------------------------------------------
 
 Library ctu_can_fd_tb;
@@ -91,17 +96,6 @@ context ctu_can_fd_tb.tb_common_context;
 context ctu_can_fd_tb.rtl_context;
 context ctu_can_fd_tb.tb_agents_context;
 
-use ctu_can_fd_tb.reference_data_set_1.all;
-use ctu_can_fd_tb.reference_data_set_2.all;
-use ctu_can_fd_tb.reference_data_set_3.all;
-use ctu_can_fd_tb.reference_data_set_4.all;
-use ctu_can_fd_tb.reference_data_set_5.all;
-use ctu_can_fd_tb.reference_data_set_6.all;
-use ctu_can_fd_tb.reference_data_set_7.all;
-use ctu_can_fd_tb.reference_data_set_8.all;
-use ctu_can_fd_tb.reference_data_set_9.all;
-use ctu_can_fd_tb.reference_data_set_10.all;
-
 
 entity reference_test_agent is
     generic(
@@ -109,7 +103,8 @@ entity reference_test_agent is
         test_name               : string;
         test_type               : string;
         stand_alone_vip_mode    : boolean;
-        reference_iterations    : natural range 1 to 1000
+        reference_iterations    : natural range 1 to 1000;
+        reference_data_path     : string
     );
 end entity;
 
@@ -129,12 +124,43 @@ begin
         -- 2 Mbit / 500 Kbit, 80 % sample point
         variable bus_timing     : bit_time_config_type := 
             (2, 1, 40, 39, 20, 10, 20, 14, 15, 10);
-        variable data_set : t_reference_data_set;
+        file data_set : text;
+        variable open_status : file_open_status;
+        variable item : t_reference_item;
         variable driver_item : t_can_driver_entry :=
             ('0', 0 ns, false, (OTHERS => '0'));
         variable rx_frame : SW_CAN_frame_type;
         variable result : boolean;
         variable reference_offset : natural;
+
+        -----------------------------------------------------------------------
+        -- Read next reference item from data set. Empty lines and comments
+        -- are skipped, at the end of file, reading wraps to its start.
+        -----------------------------------------------------------------------
+        procedure read_next_item is
+            variable l : line;
+            variable wrapped : boolean := false;
+        begin
+            loop
+                if endfile(data_set) then
+                    if wrapped then
+                        error_m("No reference items in data set!");
+                        return;
+                    end if;
+                    wrapped := true;
+                    file_close(data_set);
+                    file_open(data_set, reference_data_path & "reference_" &
+                              test_name & ".txt", read_mode);
+                end if;
+                readline(data_set, l);
+                if (l'length > 0) then
+                    exit when l(l'low) /= '#';
+                end if;
+                deallocate(l);
+            end loop;
+            reference_item_read(l, item);
+            deallocate(l);
+        end procedure;
     begin
         wait until reference_start = '1';
 
@@ -152,28 +178,11 @@ begin
         CAN_wait_bus_on(DUT_NODE, default_channel);
         info_m("Bus integration finished");
 
-        if (test_name = "data_set_1") then
-            data_set := C_reference_data_set_1;
-        elsif (test_name = "data_set_2") then
-            data_set := C_reference_data_set_2;
-        elsif (test_name = "data_set_3") then
-            data_set := C_reference_data_set_3;
-        elsif (test_name = "data_set_4") then
-            data_set := C_reference_data_set_4;
-        elsif (test_name = "data_set_5") then
-            data_set := C_reference_data_set_5;
-        elsif (test_name = "data_set_6") then
-            data_set := C_reference_data_set_6;
-        elsif (test_name = "data_set_7") then
-            data_set := C_reference_data_set_7;
-        elsif (test_name = "data_set_8") then
-            data_set := C_reference_data_set_8;
-        elsif (test_name = "data_set_9") then
-            data_set := C_reference_data_set_9;
-        elsif (test_name = "data_set_10") then
-            data_set := C_reference_data_set_10;
-        else
-            error_m("Invalid reference test data set");
+        file_open(open_status, data_set, reference_data_path & "reference_" &
+                  test_name & ".txt", read_mode);
+        if (open_status /= open_ok) then
+            error_m("Invalid reference test data set: " & reference_data_path &
+                    "reference_" & test_name & ".txt");
         end if;
 
         -----------------------------------------------------------------------
@@ -181,17 +190,23 @@ begin
         -----------------------------------------------------------------------
         rand_int_v(899, reference_offset);
 
+        -- Skip frames before random offset
+        for frame_index in 1 to reference_offset loop
+            read_next_item;
+        end loop;
+
         for frame_index in reference_offset to reference_offset + reference_iterations loop
-            
+            read_next_item;
+
             info_m("Testing frame nr: " & integer'image(frame_index - reference_offset));
             info_m("Frame position in dataset: " & integer'image(frame_index));
 
             info_m("Pushing frame to CAN agent...");
             can_agent_driver_flush(default_channel);
-            for seq_ind in 1 to data_set(frame_index).seq_len loop
+            for seq_ind in 1 to item.seq_len loop
                 
-                driver_item.value := data_set(frame_index).seq(seq_ind).value;
-                driver_item.drive_time := data_set(frame_index).seq(seq_ind).drive_time;
+                driver_item.value := item.seq(seq_ind).value;
+                driver_item.drive_time := item.seq(seq_ind).drive_time;
                 can_agent_driver_push_item(default_channel, driver_item);
             end loop;
 
@@ -203,13 +218,13 @@ begin
             CAN_read_frame(rx_frame, DUT_NODE, default_channel);
             
             info_m("Comparing received vs golden frame...");
-            -- Pre-calculate RWCNT of TX frame
-            decode_dlc_rx_buff(data_set(frame_index).frame.dlc, data_set(frame_index).frame.rwcnt);
-            CAN_compare_frames(rx_frame, data_set(frame_index).frame, false, result);
+            CAN_compare_frames(rx_frame, item.frame, false, result);
             
             check_m(result, "Frames equal");
         end loop; 
 
+        file_close(data_set);
+
         -- Signal test is done.
         reference_result <= ctu_vip_test_result.get_result;
         wait for 0 ns;
@@ -73,6 +73,7 @@
 --------------------------------------------------------------------------------
 -- Revision History:
 --    11.4.2021   Created file
+--    19.10.2026  Reference items are parsed from data set files.
 --------------------------------------------------------------------------------
 
 Library ctu_can_fd_tb;
@@ -96,7 +97,8 @@ package reference_test_agent_pkg is
         test_name               : string;
         test_type               : string;
         stand_alone_vip_mode    : boolean;
-        reference_iterations    : natural range 1 to 1000
+        reference_iterations    : natural range 1 to 1000;
+        reference_data_path     : string
     );
     end component;
 
@@ -111,14 +113,94 @@ package reference_test_agent_pkg is
         seq_len : natural;
     end record;
 
-    type t_reference_data_set is
-        array (1 to 1000) of t_reference_item;
-
-    type t_reference_data_set_acc is access t_reference_data_set;
+    ---------------------------------------------------------------------------
+    -- Parse reference item from a line of reference data set file. Line
+    -- contains space separated values:
+    --  frame_format ident_type rtr brs data_length identifier
+    --  data[data_length] seq_len (value drive_time_ns)[seq_len]
+    -- Data bytes are hexadecimal, all other values are decimal.
+    --
+    -- Arguments:
+    --  l               Line read from reference data set file.
+    --  item            Variable in which parsed reference item is stored.
+    ---------------------------------------------------------------------------
+    procedure reference_item_read(
+        variable l              : inout line;
+        variable item           : out   t_reference_item
+    );
 
 end package;
 
 
 package body reference_test_agent_pkg is
 
+    procedure reference_item_read(
+        variable l              : inout line;
+        variable item           : out   t_reference_item
+    ) is
+        variable val            :       natural;
+        variable byte           :       std_logic_vector(7 downto 0);
+        variable seq_len        :       natural;
+    begin
+        item.frame.esi := '0';
+        item.frame.timestamp := (OTHERS => '0');
+        item.frame.data := (OTHERS => (OTHERS => '0'));
+
+        read(l, val);
+        item.frame.frame_format := '0';
+        if (val = 1) then
+            item.frame.frame_format := '1';
+        end if;
+
+        read(l, val);
+        item.frame.ident_type := '0';
+        if (val = 1) then
+            item.frame.ident_type := '1';
+        end if;
+
+        read(l, val);
+        item.frame.rtr := '0';
+        if (val = 1) then
+            item.frame.rtr := '1';
+        end if;
+
+        read(l, val);
+        item.frame.brs := '0';
+        if (val = 1) then
+            item.frame.brs := '1';
+        end if;
+
+        read(l, val);
+        item.frame.data_length := val;
+        decode_length(val, item.frame.dlc);
+        decode_dlc_rx_buff(item.frame.dlc, item.frame.rwcnt);
+
+        read(l, val);
+        item.frame.identifier := val;
+
+        for i in 0 to item.frame.data_length - 1 loop
+            hread(l, byte);
+            item.frame.data(i) := byte;
+        end loop;
+
+        read(l, seq_len);
+        if (seq_len > C_MAX_REF_SEQ_LENGHT) then
+            error_m("Reference item sequence too long: " &
+                    integer'image(seq_len));
+            seq_len := C_MAX_REF_SEQ_LENGHT;
+        end if;
+        item.seq_len := seq_len;
+
+        for i in 1 to seq_len loop
+            read(l, val);
+            item.seq(i).value := '0';
+            if (val = 1) then
+                item.seq(i).value := '1';
+            end if;
+
+            read(l, val);
+            item.seq(i).drive_time := val * 1 ns;
+        end loop;
+    end procedure;
+
 end package body;
@@ -91,5 +91,6 @@ context tb_agents_context is
     use ctu_can_fd_tb.test_controller_agent_pkg.all;
     use ctu_can_fd_tb.test_probe_agent_pkg.all;
     use ctu_can_fd_tb.reference_test_agent_pkg.all;
+    use ctu_can_fd_tb.dma_memory_agent_pkg.all;
 
 end context;
\ No newline at end of file
@@ -109,7 +109,10 @@ entity ctu_can_fd_vip is
         seed                    : natural := 0;
         
         -- Reference test iterations
-        reference_iterations    : natural range 1 to 1000 := 1000
+        reference_iterations    : natural range 1 to 1000 := 1000;
+
+        -- Directory with reference data set files (with trailing "/")
+        reference_data_path     : string := ""
     );
     port(
         -- Test control
@@ -138,7 +141,14 @@ entity ctu_can_fd_vip is
         can_rx              : out   std_logic;          
 
         test_probe          : in    t_ctu_can_fd_test_probe;
-        timestamp           : out   std_logic_vector(63 DOWNTO 0) 
+        timestamp           : out   std_logic_vector(63 DOWNTO 0);
+
+        -- RX DMA bus master interface of DUT
+        dma_m_addr          : in    std_logic_vector(31 DOWNTO 0) := (OTHERS => '0');
+        dma_m_wdata         : in    std_logic_vector(31 DOWNTO 0) := (OTHERS => '0');
+        dma_m_req           : in    std_logic := '0';
+        dma_m_ack           : out   std_logic;
+        dma_m_err           : out   std_logic
     );
 end entity;
 
@@ -246,6 +256,20 @@ begin
         timestamp       => timestamp
     );
     
+    ---------------------------------------------------------------------------
+    -- DMA memory agent - memory slave for RX DMA of DUT
+    ---------------------------------------------------------------------------
+    dma_memory_agent_inst : dma_memory_agent
+    port map(
+        clk_sys         => clk_sys_i,
+
+        dma_m_addr      => dma_m_addr,
+        dma_m_wdata     => dma_m_wdata,
+        dma_m_req       => dma_m_req,
+        dma_m_ack       => dma_m_ack,
+        dma_m_err       => dma_m_err
+    );
+
     ---------------------------------------------------------------------------
     -- Test probe agent - allows peeking signals brought to test-probe.
     ---------------------------------------------------------------------------
@@ -382,7 +406,8 @@ begin
         test_name            => test_name,
         test_type            => test_type,
         stand_alone_vip_mode => stand_alone_vip_mode,
-        reference_iterations => reference_iterations
+        reference_iterations => reference_iterations,
+        reference_data_path  => reference_data_path
     );
 
 
@@ -0,0 +1,209 @@
+--------------------------------------------------------------------------------
+-- 
+-- CTU CAN FD IP Core 
+-- Copyright (C) 2021-present Ondrej Ille
+-- 
+-- Permission is hereby granted, free of charge, to any person obtaining a copy
+-- of this VHDL component and associated documentation files (the "Component"),
+-- to use, copy, modify, merge, publish, distribute the Component for
+-- educational, research, evaluation, self-interest purposes. Using the
+-- Component for commercial purposes is forbidden unless previously agreed with
+-- Copyright holder.
+-- 
+-- The above copyright notice and this permission notice shall be included in
+-- all copies or substantial portions of the Component.
+-- 
+-- THE COMPONENT IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+-- IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+-- FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+-- AUTHORS OR COPYRIGHTHOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+-- LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+-- FROM, OUT OF OR IN CONNECTION WITH THE COMPONENT OR THE USE OR OTHER DEALINGS
+-- IN THE COMPONENT.
+-- 
+-- The CAN protocol is developed by Robert Bosch GmbH and protected by patents.
+-- Anybody who wants to implement this IP core on silicon has to obtain a CAN
+-- protocol license from Bosch.
+-- 
+-- -------------------------------------------------------------------------------
+-- 
+-- CTU CAN FD IP Core 
+-- Copyright (C) 2015-2020 MIT License
+-- 
+-- Authors:
+--     Ondrej Ille <ondrej.ille@gmail.com>
+--     Martin Jerabek <martin.jerabek01@gmail.com>
+-- 
+-- Project advisors: 
+-- 	Jiri Novak <jnovak@fel.cvut.cz>
+-- 	Pavel Pisa <pisa@cmp.felk.cvut.cz>
+-- 
+-- Department of Measurement         (http://meas.fel.cvut.cz/)
+-- Faculty of Electrical Engineering (http://www.fel.cvut.cz)
+-- Czech Technical University        (http://www.cvut.cz/)
+-- 
+-- Permission is hereby granted, free of charge, to any person obtaining a copy
+-- of this VHDL component and associated documentation files (the "Component"),
+-- to deal in the Component without restriction, including without limitation
+-- the rights to use, copy, modify, merge, publish, distribute, sublicense,
+-- and/or sell copies of the Component, and to permit persons to whom the
+-- Component is furnished to do so, subject to the following conditions:
+-- 
+-- The above copyright notice and this permission notice shall be included in
+-- all copies or substantial portions of the Component.
+-- 
+-- THE COMPONENT IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+-- IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+-- FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+-- AUTHORS OR COPYRIGHTHOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+-- LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+-- FROM, OUT OF OR IN CONNECTION WITH THE COMPONENT OR THE USE OR OTHER DEALINGS
+-- IN THE COMPONENT.
+-- 
+-- The CAN protocol is developed by Robert Bosch GmbH and protected by patents.
+-- Anybody who wants to implement this IP core on silicon has to obtain a CAN
+-- protocol license from Bosch.
+-- 
+--------------------------------------------------------------------------------
+
+--------------------------------------------------------------------------------
+-- @TestInfoStart
+--
+-- @Purpose:
+--  Bus statistics counters and snapshot command.
+--
+-- @Verifies:
+--  @1. Busy bits and stuff bits counters are incremented by transmitted frame.
+--  @2. COMMAND[BSSNAP] clears bus statistics counters.
+--  @3. Idle bits counter is incremented when bus is idle.
+--  @4. Error frames counter is incremented by error frame.
+--
+-- @Test sequence:
+--  @1. Issue snapshot in DUT to clear bus statistics counters. Send frame with
+--      Base identifier 0 (contains stuff bits) by Test node. Wait until bus is
+--      idle, take snapshot in DUT and check that busy bits and stuff bits are
+--      not zero, and that error and overload frames are zero.
+--  @2. Take snapshot in DUT again right away and check that busy bits, stuff
+--      bits, error frames and overload frames are zero.
+--  @3. Wait for 20 bits and take snapshot in DUT. Check that idle bits counter
+--      is at least 19 (phase of sample point is not known) and busy bits
+--      counter is zero.
+--  @4. Set Test node to ACK forbidden mode. Send frame by DUT and wait until
+--      bus is idle. Take snapshot in DUT and check that error frames counter
+--      is 1.
+--
+-- @TestInfoEnd
+--------------------------------------------------------------------------------
+-- Revision History:
+--    19.10.2026   Created file
+--------------------------------------------------------------------------------
+
+Library ctu_can_fd_tb;
+context ctu_can_fd_tb.ieee_context;
+context ctu_can_fd_tb.rtl_context;
+context ctu_can_fd_tb.tb_common_context;
+
+use ctu_can_fd_tb.feature_test_agent_pkg.all;
+
+package bus_stat_ftest is
+    procedure bus_stat_ftest_exec(
+        signal      chn             : inout  t_com_channel
+    );
+end package;
+
+
+package body bus_stat_ftest is
+    procedure bus_stat_ftest_exec(
+        signal      chn             : inout  t_com_channel
+    ) is
+        variable CAN_frame          :     SW_CAN_frame_type;
+        variable frame_sent         :     boolean := false;
+        variable bus_stat           :     SW_bus_stat;
+        variable mode_2             :     SW_mode := SW_mode_rst_val;
+    begin
+
+        -----------------------------------------------------------------------
+        -- @1. Issue snapshot in DUT to clear bus statistics counters. Send
+        --     frame with Base identifier 0 (contains stuff bits) by Test node.
+        --     Wait until bus is idle, take snapshot in DUT and check that busy
+        --     bits and stuff bits are not zero, and that error and overload
+        --     frames are zero.
+        -----------------------------------------------------------------------
+        info_m("Step 1");
+
+        read_bus_stat(bus_stat, DUT_NODE, chn);
+
+        CAN_generate_frame(CAN_frame);
+        CAN_frame.identifier := 0;
+        CAN_frame.ident_type := BASE;
+        CAN_send_frame(CAN_frame, 1, TEST_NODE, chn, frame_sent);
+
+        CAN_wait_frame_sent(DUT_NODE, chn);
+        CAN_wait_bus_idle(DUT_NODE, chn);
+        CAN_wait_bus_idle(TEST_NODE, chn);
+
+        read_bus_stat(bus_stat, DUT_NODE, chn);
+        info_m("Busy bits: " & integer'image(bus_stat.busy_bits));
+        info_m("Stuff bits: " & integer'image(bus_stat.stuff_bits));
+
+        check_m(bus_stat.busy_bits > 0, "Busy bits counted");
+        check_m(bus_stat.stuff_bits > 0, "Stuff bits counted");
+        check_m(bus_stat.err_frames = 0, "No error frame counted");
+        check_m(bus_stat.ovr_frames = 0, "No overload frame counted");
+
+        -----------------------------------------------------------------------
+        -- @2. Take snapshot in DUT again right away and check that busy bits,
+        --     stuff bits, error frames and overload frames are zero.
+        -----------------------------------------------------------------------
+        info_m("Step 2");
+
+        read_bus_stat(bus_stat, DUT_NODE, chn);
+
+        check_m(bus_stat.busy_bits = 0, "Busy bits cleared by snapshot");
+        check_m(bus_stat.stuff_bits = 0, "Stuff bits cleared by snapshot");
+        check_m(bus_stat.err_frames = 0, "Error frames cleared by snapshot");
+        check_m(bus_stat.ovr_frames = 0, "Overload frames cleared by snapshot");
+
+        -----------------------------------------------------------------------
+        -- @3. Wait for 20 bits and take snapshot in DUT. Check that idle bits
+        --     counter is at least 19 (phase of sample point is not known) and
+        --     busy bits counter is zero.
+        -----------------------------------------------------------------------
+        info_m("Step 3");
+
+        CAN_wait_n_bits(20, true, DUT_NODE, chn);
+
+        read_bus_stat(bus_stat, DUT_NODE, chn);
+        info_m("Idle bits: " & integer'image(bus_stat.idle_bits));
+
+        check_m(bus_stat.idle_bits >= 19, "Idle bits counted");
+        check_m(bus_stat.busy_bits = 0, "No busy bits when bus is idle");
+
+        -----------------------------------------------------------------------
+        -- @4. Set Test node to ACK forbidden mode. Send frame by DUT and wait
+        --     until bus is idle. Take snapshot in DUT and check that error
+        --     frames counter is 1.
+        -----------------------------------------------------------------------
+        info_m("Step 4");
+
+        CAN_enable_retr_limit(true, 0, DUT_NODE, chn);
+        mode_2.acknowledge_forbidden := true;
+        set_core_mode(mode_2, TEST_NODE, chn);
+
+        CAN_send_frame(CAN_frame, 1, DUT_NODE, chn, frame_sent);
+        CAN_wait_error_frame(DUT_NODE, chn);
+
+        CAN_wait_bus_idle(DUT_NODE, chn);
+        CAN_wait_bus_idle(TEST_NODE, chn);
+
+        read_bus_stat(bus_stat, DUT_NODE, chn);
+        info_m("Error frames: " & integer'image(bus_stat.err_frames));
+
+        check_m(bus_stat.err_frames = 1, "Error frame counted");
+
+        mode_2.acknowledge_forbidden := false;
+        set_core_mode(mode_2, TEST_NODE, chn);
+
+  end procedure;
+
+end package body;
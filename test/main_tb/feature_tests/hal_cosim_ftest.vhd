@@ -0,0 +1,172 @@
+--------------------------------------------------------------------------------
+-- 
+-- CTU CAN FD IP Core 
+-- Copyright (C) 2021-present Ondrej Ille
+-- 
+-- Permission is hereby granted, free of charge, to any person obtaining a copy
+-- of this VHDL component and associated documentation files (the "Component"),
+-- to use, copy, modify, merge, publish, distribute the Component for
+-- educational, research, evaluation, self-interest purposes. Using the
+-- Component for commercial purposes is forbidden unless previously agreed with
+-- Copyright holder.
+-- 
+-- The above copyright notice and this permission notice shall be included in
+-- all copies or substantial portions of the Component.
+-- 
+-- THE COMPONENT IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+-- IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+-- FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+-- AUTHORS OR COPYRIGHTHOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+-- LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+-- FROM, OUT OF OR IN CONNECTION WITH THE COMPONENT OR THE USE OR OTHER DEALINGS
+-- IN THE COMPONENT.
+-- 
+-- The CAN protocol is developed by Robert Bosch GmbH and protected by patents.
+-- Anybody who wants to implement this IP core on silicon has to obtain a CAN
+-- protocol license from Bosch.
+-- 
+-- -------------------------------------------------------------------------------
+
+--------------------------------------------------------------------------------
+-- @TestInfoStart
+--
+-- @Purpose:
+--  HAL co-simulation feature test.
+--
+-- @Verifies:
+--  @1. Userspace HAL (driver/ctucanfd_hw.c) works with the RTL when its
+--      register accesses are executed in simulation.
+--  @2. Number of system clock cycles taken by HAL calls fits into budget
+--      (checked by HAL side, see driver/ctucanfd_cosim.h).
+--
+-- @Test sequence:
+--  @1. Turn Test node off, HAL program runs DUT in loopback. Open named
+--      pipes created by test framework. HAL program is started by test
+--      framework before the simulation.
+--  @2. Read requests from "req" pipe and execute them on DUT: register read,
+--      register write or letting simulation run. Reply each request with
+--      read data and number of clock cycles the request took. Finish when
+--      HAL program exits and check its exit status.
+--
+-- @TestInfoEnd
+--------------------------------------------------------------------------------
+-- Revision History:
+--    19.10.2026   Created file
+--------------------------------------------------------------------------------
+
+Library ctu_can_fd_tb;
+context ctu_can_fd_tb.ieee_context;
+context ctu_can_fd_tb.rtl_context;
+context ctu_can_fd_tb.tb_common_context;
+
+use ctu_can_fd_tb.feature_test_agent_pkg.all;
+use ctu_can_fd_tb.clk_gen_agent_pkg.all;
+
+package hal_cosim_ftest is
+    procedure hal_cosim_ftest_exec(
+        signal      chn             : inout  t_com_channel
+    );
+end package;
+
+
+package body hal_cosim_ftest is
+
+    -- Relative to simulation working directory, created by test framework
+    constant C_HAL_COSIM_DIR : string := "hal_cosim/";
+
+    procedure hal_cosim_ftest_exec(
+        signal      chn             : inout  t_com_channel
+    ) is
+        file     req_file       : text;
+        file     resp_file      : text;
+        variable status         : file_open_status;
+        variable l_in           : line;
+        variable l_out          : line;
+        variable op             : character;
+        variable addr           : std_logic_vector(15 downto 0);
+        variable data           : std_logic_vector(31 downto 0);
+        variable cycles         : integer;
+        variable exit_status    : integer;
+        variable clk_period     : time;
+        variable start          : time;
+        variable accesses       : natural := 0;
+        variable total_cycles   : natural := 0;
+    begin
+
+        -----------------------------------------------------------------------
+        -- @1. Turn Test node off, HAL program runs DUT in loopback. Open named
+        --     pipes created by test framework. HAL program is started by test
+        --     framework before the simulation.
+        -----------------------------------------------------------------------
+        info_m("Step 1: Connect to HAL program");
+
+        CAN_turn_controller(false, TEST_NODE, chn);
+        clk_agent_get_period(chn, clk_period);
+
+        -- HAL program opens "req" first, keep the same order.
+        file_open(status, req_file, C_HAL_COSIM_DIR & "req", read_mode);
+        check_m(status = open_ok, "Open " & C_HAL_COSIM_DIR & "req");
+        file_open(status, resp_file, C_HAL_COSIM_DIR & "resp", write_mode);
+        check_m(status = open_ok, "Open " & C_HAL_COSIM_DIR & "resp");
+
+        -----------------------------------------------------------------------
+        -- @2. Read requests from "req" pipe and execute them on DUT: register
+        --     read, register write or letting simulation run. Reply each
+        --     request with read data and number of clock cycles the request
+        --     took. Finish when HAL program exits and check its exit status.
+        -----------------------------------------------------------------------
+        info_m("Step 2: Execute HAL requests");
+
+        loop
+            if (endfile(req_file)) then
+                error_m("HAL program closed connection without finishing!");
+                exit;
+            end if;
+
+            readline(req_file, l_in);
+            read(l_in, op);
+            start := now;
+            data := (OTHERS => '0');
+
+            case op is
+            when 'R' =>
+                hread(l_in, addr);
+                CAN_read(data, addr(11 downto 0), DUT_NODE, chn);
+                accesses := accesses + 1;
+            when 'W' =>
+                hread(l_in, addr);
+                hread(l_in, data);
+                CAN_write(data, addr(11 downto 0), DUT_NODE, chn);
+                accesses := accesses + 1;
+            when 'I' =>
+                read(l_in, cycles);
+                wait for cycles * clk_period;
+            when 'Q' =>
+                read(l_in, exit_status);
+                check_m(exit_status = 0, "HAL program exit status: " &
+                        integer'image(exit_status));
+                exit;
+            when others =>
+                error_m("Invalid HAL request: " & op);
+                exit;
+            end case;
+
+            cycles := (now - start) / clk_period;
+            total_cycles := total_cycles + cycles;
+
+            write(l_out, to_hstring(data));
+            write(l_out, ' ');
+            write(l_out, cycles);
+            writeline(resp_file, l_out);
+            flush(resp_file);
+        end loop;
+
+        info_m("HAL register accesses: " & integer'image(accesses) &
+               ", clock cycles: " & integer'image(total_cycles));
+
+        file_close(req_file);
+        file_close(resp_file);
+
+  end procedure;
+
+end package body;
@@ -0,0 +1,295 @@
+--------------------------------------------------------------------------------
+-- 
+-- CTU CAN FD IP Core 
+-- Copyright (C) 2021-present Ondrej Ille
+-- 
+-- Permission is hereby granted, free of charge, to any person obtaining a copy
+-- of this VHDL component and associated documentation files (the "Component"),
+-- to use, copy, modify, merge, publish, distribute the Component for
+-- educational, research, evaluation, self-interest purposes. Using the
+-- Component for commercial purposes is forbidden unless previously agreed with
+-- Copyright holder.
+-- 
+-- The above copyright notice and this permission notice shall be included in
+-- all copies or substantial portions of the Component.
+-- 
+-- THE COMPONENT IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+-- IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+-- FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+-- AUTHORS OR COPYRIGHTHOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+-- LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+-- FROM, OUT OF OR IN CONNECTION WITH THE COMPONENT OR THE USE OR OTHER DEALINGS
+-- IN THE COMPONENT.
+-- 
+-- The CAN protocol is developed by Robert Bosch GmbH and protected by patents.
+-- Anybody who wants to implement this IP core on silicon has to obtain a CAN
+-- protocol license from Bosch.
+-- 
+-- -------------------------------------------------------------------------------
+-- 
+-- CTU CAN FD IP Core 
+-- Copyright (C) 2015-2020 MIT License
+-- 
+-- Authors:
+--     Ondrej Ille <ondrej.ille@gmail.com>
+--     Martin Jerabek <martin.jerabek01@gmail.com>
+-- 
+-- Project advisors: 
+-- 	Jiri Novak <jnovak@fel.cvut.cz>
+-- 	Pavel Pisa <pisa@cmp.felk.cvut.cz>
+-- 
+-- Department of Measurement         (http://meas.fel.cvut.cz/)
+-- Faculty of Electrical Engineering (http://www.fel.cvut.cz)
+-- Czech Technical University        (http://www.cvut.cz/)
+-- 
+-- Permission is hereby granted, free of charge, to any person obtaining a copy
+-- of this VHDL component and associated documentation files (the "Component"),
+-- to deal in the Component without restriction, including without limitation
+-- the rights to use, copy, modify, merge, publish, distribute, sublicense,
+-- and/or sell copies of the Component, and to permit persons to whom the
+-- Component is furnished to do so, subject to the following conditions:
+-- 
+-- The above copyright notice and this permission notice shall be included in
+-- all copies or substantial portions of the Component.
+-- 
+-- THE COMPONENT IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+-- IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+-- FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+-- AUTHORS OR COPYRIGHTHOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+-- LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+-- FROM, OUT OF OR IN CONNECTION WITH THE COMPONENT OR THE USE OR OTHER DEALINGS
+-- IN THE COMPONENT.
+-- 
+-- The CAN protocol is developed by Robert Bosch GmbH and protected by patents.
+-- Anybody who wants to implement this IP core on silicon has to obtain a CAN
+-- protocol license from Bosch.
+-- 
+--------------------------------------------------------------------------------
+
+--------------------------------------------------------------------------------
+-- @TestInfoStart
+--
+-- @Purpose:
+--  ID set filter feature test.
+--
+-- @Verifies:
+--  @1. Base identifier whose bit is set in ID set filter bitmap passes the
+--      filter. Base identifier whose bit is not set does not pass the filter.
+--  @2. Extended identifier stored in ID set filter hash table passes the
+--      filter. Extended identifier not stored in hash table does not pass the
+--      filter.
+--  @3. When ID set filter is disabled for all frame/identifier types, frame
+--      with identifier in the set does not pass the filter.
+--
+-- @Test sequence:
+--  @1. Check ID set filter is synthesized, skip the test otherwise. Read hash
+--      table width. Clear Base ID bitmap and Extended ID hash table.
+--  @2. Generate random Base identifier and set its bit in the bitmap. Generate
+--      random Extended identifier and store it to hash table. Disable all
+--      other filters, enable ID set filter and Frame filters mode in DUT.
+--  @3. Send frame with Base identifier from bitmap by Test node, check it is
+--      received by DUT. Send frame with other Base identifier, check it is
+--      not received by DUT.
+--  @4. Send frame with Extended identifier from hash table by Test node, check
+--      it is received by DUT. Send frame with other Extended identifier, check
+--      it is not received by DUT.
+--  @5. Disable ID set filter. Send frame with Base identifier from bitmap by
+--      Test node, check it is not received by DUT.
+--
+-- @TestInfoEnd
+--------------------------------------------------------------------------------
+-- Revision History:
+--    19.10.2026   Created file
+--------------------------------------------------------------------------------
+
+Library ctu_can_fd_tb;
+context ctu_can_fd_tb.ieee_context;
+context ctu_can_fd_tb.rtl_context;
+context ctu_can_fd_tb.tb_common_context;
+
+use ctu_can_fd_tb.feature_test_agent_pkg.all;
+
+package message_filter_id_set_ftest is
+    procedure message_filter_id_set_ftest_exec(
+        signal      chn             : inout  t_com_channel
+    );
+end package;
+
+
+package body message_filter_id_set_ftest is
+
+    ----------------------------------------------------------------------------
+    -- Write word to ID set filter memory of DUT.
+    ----------------------------------------------------------------------------
+    procedure write_id_set_word(
+        constant    tsel            : in     std_logic;
+        constant    addr            : in     natural;
+        constant    data            : in     std_logic_vector(31 downto 0);
+        signal      chn             : inout  t_com_channel
+    ) is
+        variable    addr_reg        :        std_logic_vector(31 downto 0) :=
+                                                (OTHERS => '0');
+    begin
+        addr_reg(FSET_ADDR_H downto FSET_ADDR_L) :=
+            std_logic_vector(to_unsigned(addr, FSET_ADDR_H - FSET_ADDR_L + 1));
+        addr_reg(FSET_TSEL_IND) := tsel;
+        CAN_write(addr_reg, FILTER_SET_ADDR_ADR, DUT_NODE, chn);
+        CAN_write(data, FILTER_SET_DATA_ADR, DUT_NODE, chn);
+    end procedure;
+
+    ----------------------------------------------------------------------------
+    -- Send frame by Test node and check whether it was received by DUT.
+    ----------------------------------------------------------------------------
+    procedure send_and_check(
+        variable    frame           : inout  SW_CAN_frame_type;
+        constant    exp_rx          : in     boolean;
+        signal      chn             : inout  t_com_channel
+    ) is
+        variable    rx_frame        :        SW_CAN_frame_type;
+        variable    rx_buf_state    :        SW_RX_Buffer_info;
+        variable    frame_sent      :        boolean := false;
+        variable    frames_equal    :        boolean := false;
+    begin
+        CAN_send_frame(frame, 1, TEST_NODE, chn, frame_sent);
+        CAN_wait_frame_sent(DUT_NODE, chn);
+
+        get_rx_buf_state(rx_buf_state, DUT_NODE, chn);
+
+        if (exp_rx) then
+            check_m(rx_buf_state.rx_frame_count = 1,
+                    "Frame with ID in the set received!");
+            CAN_read_frame(rx_frame, DUT_NODE, chn);
+            CAN_compare_frames(rx_frame, frame, false, frames_equal);
+            check_m(frames_equal, "TX/RX frame equal!");
+        else
+            check_m(rx_buf_state.rx_frame_count = 0,
+                    "Frame with ID out of the set filtered out!");
+        end if;
+    end procedure;
+
+
+    procedure message_filter_id_set_ftest_exec(
+        signal      chn             : inout  t_com_channel
+    ) is
+        variable CAN_TX_frame       :       SW_CAN_frame_type;
+        variable mode_1             :       SW_mode := SW_mode_rst_val;
+        variable data               :       std_logic_vector(31 downto 0);
+        variable word               :       std_logic_vector(31 downto 0);
+
+        variable hash_width         :       natural;
+        variable hash_index         :       std_logic_vector(9 downto 0);
+        variable rand_val           :       natural;
+
+        variable base_id            :       natural range 0 to 2047;
+        variable ext_id             :       std_logic_vector(28 downto 0);
+    begin
+
+        ------------------------------------------------------------------------
+        -- @1. Check ID set filter is synthesized, skip the test otherwise.
+        --     Read hash table width. Clear Base ID bitmap and Extended ID hash
+        --     table.
+        ------------------------------------------------------------------------
+        info_m("Step 1: Check ID set filter presence, clear its memories");
+
+        CAN_read(data, FILTER_CONTROL_ADR, DUT_NODE, chn);
+        if (data(SFS_IND) = '0') then
+            info_m("ID set filter not synthesized -> Skipping the test!");
+            return;
+        end if;
+
+        CAN_read(data, FILTER_SET_CTRL_ADR, DUT_NODE, chn);
+        hash_width := to_integer(unsigned(data(FSET_HTW_H downto FSET_HTW_L)));
+        info_m("Hash table width: " & integer'image(hash_width));
+
+        for i in 0 to 63 loop
+            write_id_set_word(FSET_TSEL_BITMAP, i, x"00000000", chn);
+        end loop;
+
+        for i in 0 to 2 ** hash_width - 1 loop
+            write_id_set_word(FSET_TSEL_HASH, i, x"00000000", chn);
+        end loop;
+
+        ------------------------------------------------------------------------
+        -- @2. Generate random Base identifier and set its bit in the bitmap.
+        --     Generate random Extended identifier and store it to hash table.
+        --     Disable all other filters, enable ID set filter and Frame
+        --     filters mode in DUT.
+        ------------------------------------------------------------------------
+        info_m("Step 2: Program ID set filter");
+
+        rand_int_v(2047, rand_val);
+        base_id := rand_val;
+        word := (OTHERS => '0');
+        word(base_id mod 32) := '1';
+        write_id_set_word(FSET_TSEL_BITMAP, base_id / 32, word, chn);
+
+        -- Hash index is XOR-fold of identifier to hash table width. Only one
+        -- identifier is inserted, so no collisions need to be resolved.
+        rand_logic_vect_v(ext_id, 0.5);
+        hash_index := (OTHERS => '0');
+        for i in 0 to 28 loop
+            hash_index(i mod hash_width) :=
+                hash_index(i mod hash_width) xor ext_id(i);
+        end loop;
+        write_id_set_word(FSET_TSEL_HASH, to_integer(unsigned(hash_index)),
+                          "100" & ext_id, chn);
+
+        CAN_write(x"00000000", FILTER_CONTROL_ADR, DUT_NODE, chn);
+
+        data := (OTHERS => '0');
+        data(FSNB_IND) := '1';
+        data(FSNE_IND) := '1';
+        data(FSFB_IND) := '1';
+        data(FSFE_IND) := '1';
+        CAN_write(data(15 downto 0), FILTER_SET_CTRL_ADR, DUT_NODE, chn);
+
+        mode_1.acceptance_filter := true;
+        set_core_mode(mode_1, DUT_NODE, chn);
+
+        ------------------------------------------------------------------------
+        -- @3. Send frame with Base identifier from bitmap by Test node, check
+        --     it is received by DUT. Send frame with other Base identifier,
+        --     check it is not received by DUT.
+        ------------------------------------------------------------------------
+        info_m("Step 3: Base identifiers");
+
+        CAN_generate_frame(CAN_TX_frame);
+        CAN_TX_frame.ident_type := BASE;
+        CAN_TX_frame.identifier := base_id;
+        send_and_check(CAN_TX_frame, true, chn);
+
+        CAN_TX_frame.identifier := (base_id + 1) mod 2048;
+        send_and_check(CAN_TX_frame, false, chn);
+
+        ------------------------------------------------------------------------
+        -- @4. Send frame with Extended identifier from hash table by Test
+        --     node, check it is received by DUT. Send frame with other
+        --     Extended identifier, check it is not received by DUT.
+        ------------------------------------------------------------------------
+        info_m("Step 4: Extended identifiers");
+
+        CAN_generate_frame(CAN_TX_frame);
+        CAN_TX_frame.ident_type := EXTENDED;
+        CAN_TX_frame.identifier := to_integer(unsigned(ext_id));
+        send_and_check(CAN_TX_frame, true, chn);
+
+        CAN_TX_frame.identifier := (to_integer(unsigned(ext_id)) + 1) mod
+                                   (2 ** 29);
+        send_and_check(CAN_TX_frame, false, chn);
+
+        ------------------------------------------------------------------------
+        -- @5. Disable ID set filter. Send frame with Base identifier from
+        --     bitmap by Test node, check it is not received by DUT.
+        ------------------------------------------------------------------------
+        info_m("Step 5: ID set filter disabled");
+
+        CAN_write(x"0000", FILTER_SET_CTRL_ADR, DUT_NODE, chn);
+
+        CAN_generate_frame(CAN_TX_frame);
+        CAN_TX_frame.ident_type := BASE;
+        CAN_TX_frame.identifier := base_id;
+        send_and_check(CAN_TX_frame, false, chn);
+
+  end procedure;
+
+end package body;
@@ -346,10 +346,19 @@ package body mode_rst_ftest is
                     next;
                 end if;
                 
-                -- STATUS register -> Mask STCNT, STRGS bits
+                -- STATUS register -> Mask STCNT, STRGS bits and other bits
+                -- which reflect generic configuration of DUT.
                 if (Control_registers_list(i).address = STATUS_ADR) then
                     r_data_32(STCNT_IND) := '0';
                     r_data_32(STRGS_IND) := '0';
+                    r_data_32(SRDMA_IND) := '0';
+                    r_data_32(STXF_IND) := '0';
+                    r_data_32(SITS_IND) := '0';
+                    r_data_32(STXTS_IND) := '0';
+                    r_data_32(STSG_IND) := '0';
+                    r_data_32(STCYC_IND) := '0';
+                    r_data_32(STCPL_IND) := '0';
+                    r_data_32(STRXP_IND) := '0';
                 end if;
                 
                 check_m(r_data_32 = reg_rst_val_32, "Address: 0x" &
@@ -0,0 +1,225 @@
+--------------------------------------------------------------------------------
+-- 
+-- CTU CAN FD IP Core 
+-- Copyright (C) 2021-present Ondrej Ille
+-- 
+-- Permission is hereby granted, free of charge, to any person obtaining a copy
+-- of this VHDL component and associated documentation files (the "Component"),
+-- to use, copy, modify, merge, publish, distribute the Component for
+-- educational, research, evaluation, self-interest purposes. Using the
+-- Component for commercial purposes is forbidden unless previously agreed with
+-- Copyright holder.
+-- 
+-- The above copyright notice and this permission notice shall be included in
+-- all copies or substantial portions of the Component.
+-- 
+-- THE COMPONENT IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+-- IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+-- FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+-- AUTHORS OR COPYRIGHTHOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+-- LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+-- FROM, OUT OF OR IN CONNECTION WITH THE COMPONENT OR THE USE OR OTHER DEALINGS
+-- IN THE COMPONENT.
+-- 
+-- The CAN protocol is developed by Robert Bosch GmbH and protected by patents.
+-- Anybody who wants to implement this IP core on silicon has to obtain a CAN
+-- protocol license from Bosch.
+-- 
+-- -------------------------------------------------------------------------------
+-- 
+-- CTU CAN FD IP Core 
+-- Copyright (C) 2015-2020 MIT License
+-- 
+-- Authors:
+--     Ondrej Ille <ondrej.ille@gmail.com>
+--     Martin Jerabek <martin.jerabek01@gmail.com>
+-- 
+-- Project advisors: 
+-- 	Jiri Novak <jnovak@fel.cvut.cz>
+-- 	Pavel Pisa <pisa@cmp.felk.cvut.cz>
+-- 
+-- Department of Measurement         (http://meas.fel.cvut.cz/)
+-- Faculty of Electrical Engineering (http://www.fel.cvut.cz)
+-- Czech Technical University        (http://www.cvut.cz/)
+-- 
+-- Permission is hereby granted, free of charge, to any person obtaining a copy
+-- of this VHDL component and associated documentation files (the "Component"),
+-- to deal in the Component without restriction, including without limitation
+-- the rights to use, copy, modify, merge, publish, distribute, sublicense,
+-- and/or sell copies of the Component, and to permit persons to whom the
+-- Component is furnished to do so, subject to the following conditions:
+-- 
+-- The above copyright notice and this permission notice shall be included in
+-- all copies or substantial portions of the Component.
+-- 
+-- THE COMPONENT IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+-- IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+-- FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+-- AUTHORS OR COPYRIGHTHOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+-- LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+-- FROM, OUT OF OR IN CONNECTION WITH THE COMPONENT OR THE USE OR OTHER DEALINGS
+-- IN THE COMPONENT.
+-- 
+-- The CAN protocol is developed by Robert Bosch GmbH and protected by patents.
+-- Anybody who wants to implement this IP core on silicon has to obtain a CAN
+-- protocol license from Bosch.
+-- 
+
+--------------------------------------------------------------------------------
+-- @TestInfoStart
+--
+-- @Purpose:
+--  RX data window feature test.
+--
+-- @Verifies:
+--  @1. Read from RX data window reads next word of RX Buffer, as read from
+--      RX_DATA does.
+--  @2. Burst read with incrementing address from RX data window reads
+--      consecutive words of RX Buffer.
+--  @3. Address within RX data window does not matter.
+--
+-- @Test sequence:
+--  @1. Generate random CAN frame and send it by Test node. Read the frame from
+--      RX_DATA in DUT word by word and store it.
+--  @2. Send the same frame by Test node. Read whole frame from DUT by single
+--      burst with incrementing address starting at RX data window. Compare
+--      with frame read in @1 (except timestamp). Check RX Buffer is empty.
+--  @3. Send the same frame by Test node. Read FRAME_FORMAT_W from RX_DATA and
+--      rest of the frame by burst starting at random address within RX data
+--      window. Compare with frame read in @1 (except timestamp). Check RX
+--      Buffer is empty.
+--
+-- @TestInfoEnd
+--------------------------------------------------------------------------------
+-- Revision History:
+--    19.10.2026   Created file
+--------------------------------------------------------------------------------
+
+Library ctu_can_fd_tb;
+context ctu_can_fd_tb.ieee_context;
+context ctu_can_fd_tb.rtl_context;
+context ctu_can_fd_tb.tb_common_context;
+
+use ctu_can_fd_tb.feature_test_agent_pkg.all;
+
+package rx_data_window_ftest is
+    procedure rx_data_window_ftest_exec(
+        signal      chn             : inout  t_com_channel
+    );
+end package;
+
+
+package body rx_data_window_ftest is
+    procedure rx_data_window_ftest_exec(
+        signal      chn             : inout  t_com_channel
+    ) is
+        -- Generated frame
+        variable frame_1            :     SW_CAN_frame_type;
+        variable frame_sent         :     boolean;
+
+        variable rx_buf_info        :     SW_RX_Buffer_info;
+
+        -- Frame read word by word from RX_DATA, and by burst
+        type t_frame_words is array (0 to 19) of std_logic_vector(31 downto 0);
+        variable ref_words          :     t_frame_words;
+        variable burst_data         :     std_logic_vector(20 * 32 - 1 downto 0);
+        variable r_data             :     std_logic_vector(31 downto 0);
+
+        variable rwcnt              :     natural;
+        variable offset             :     natural;
+        variable addr               :     std_logic_vector(11 downto 0);
+
+        procedure send_and_wait(
+            signal  chn             : inout  t_com_channel
+        ) is
+        begin
+            CAN_send_frame(frame_1, 1, TEST_NODE, chn, frame_sent);
+            CAN_wait_frame_sent(TEST_NODE, chn);
+            CAN_wait_bus_idle(DUT_NODE, chn);
+            CAN_wait_bus_idle(TEST_NODE, chn);
+        end procedure;
+
+        -- Compare frame read by burst (word 'first' is at burst_data LSBs)
+        -- with frame read from RX_DATA. Timestamp is not compared.
+        procedure compare_burst(
+            constant first          : in    natural
+        ) is
+            variable word           :       std_logic_vector(31 downto 0);
+        begin
+            for i in first to rwcnt loop
+                word := burst_data((i - first) * 32 + 31 downto
+                                   (i - first) * 32);
+                if (i /= 2 and i /= 3) then
+                    check_m(word = ref_words(i),
+                            "Word " & integer'image(i) & " read by burst: 0x" &
+                            to_hstring(word) & " expected: 0x" &
+                            to_hstring(ref_words(i)));
+                end if;
+            end loop;
+        end procedure;
+    begin
+
+        -----------------------------------------------------------------------
+        -- @1. Generate random CAN frame and send it by Test node. Read the
+        --     frame from RX_DATA in DUT word by word and store it.
+        -----------------------------------------------------------------------
+        info_m("Step 1");
+
+        CAN_generate_frame(frame_1);
+        send_and_wait(chn);
+
+        CAN_read(ref_words(0), RX_DATA_ADR, DUT_NODE, chn);
+        rwcnt := to_integer(unsigned(ref_words(0)(RWCNT_H downto RWCNT_L)));
+        for i in 1 to rwcnt loop
+            CAN_read(ref_words(i), RX_DATA_ADR, DUT_NODE, chn);
+        end loop;
+        info_m("Frame has " & integer'image(rwcnt + 1) & " words");
+
+        get_rx_buf_state(rx_buf_info, DUT_NODE, chn);
+        check_m(rx_buf_info.rx_empty, "RX Buffer empty");
+
+        -----------------------------------------------------------------------
+        -- @2. Send the same frame by Test node. Read whole frame from DUT by
+        --     single burst with incrementing address starting at RX data
+        --     window. Compare with frame read in @1 (except timestamp). Check
+        --     RX Buffer is empty.
+        -----------------------------------------------------------------------
+        info_m("Step 2");
+
+        send_and_wait(chn);
+
+        CAN_read(burst_data((rwcnt + 1) * 32 - 1 downto 0), RX_DATA_WINDOW_ADR,
+                 DUT_NODE, chn);
+        compare_burst(0);
+
+        get_rx_buf_state(rx_buf_info, DUT_NODE, chn);
+        check_m(rx_buf_info.rx_empty, "RX Buffer empty after burst");
+
+        -----------------------------------------------------------------------
+        -- @3. Send the same frame by Test node. Read FRAME_FORMAT_W from
+        --     RX_DATA and rest of the frame by burst starting at random address
+        --     within RX data window. Compare with frame read in @1 (except
+        --     timestamp). Check RX Buffer is empty.
+        -----------------------------------------------------------------------
+        info_m("Step 3");
+
+        send_and_wait(chn);
+
+        CAN_read(r_data, RX_DATA_ADR, DUT_NODE, chn);
+        check_m(r_data = ref_words(0), "FRAME_FORMAT_W read from RX_DATA");
+
+        -- Burst must not cross end of the window (64 words)
+        rand_int_v(64 - rwcnt, offset);
+        addr := std_logic_vector(unsigned(RX_DATA_WINDOW_ADR) +
+                                 to_unsigned(offset * 4, 12));
+        info_m("Burst from address: 0x" & to_hstring(addr));
+
+        CAN_read(burst_data(rwcnt * 32 - 1 downto 0), addr, DUT_NODE, chn);
+        compare_burst(1);
+
+        get_rx_buf_state(rx_buf_info, DUT_NODE, chn);
+        check_m(rx_buf_info.rx_empty, "RX Buffer empty after burst");
+
+  end procedure;
+
+end package body;
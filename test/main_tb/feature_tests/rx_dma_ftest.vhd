@@ -0,0 +1,373 @@
+--------------------------------------------------------------------------------
+-- 
+-- CTU CAN FD IP Core 
+-- Copyright (C) 2021-present Ondrej Ille
+-- 
+-- Permission is hereby granted, free of charge, to any person obtaining a copy
+-- of this VHDL component and associated documentation files (the "Component"),
+-- to use, copy, modify, merge, publish, distribute the Component for
+-- educational, research, evaluation, self-interest purposes. Using the
+-- Component for commercial purposes is forbidden unless previously agreed with
+-- Copyright holder.
+-- 
+-- The above copyright notice and this permission notice shall be included in
+-- all copies or substantial portions of the Component.
+-- 
+-- THE COMPONENT IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+-- IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+-- FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+-- AUTHORS OR COPYRIGHTHOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+-- LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+-- FROM, OUT OF OR IN CONNECTION WITH THE COMPONENT OR THE USE OR OTHER DEALINGS
+-- IN THE COMPONENT.
+-- 
+-- The CAN protocol is developed by Robert Bosch GmbH and protected by patents.
+-- Anybody who wants to implement this IP core on silicon has to obtain a CAN
+-- protocol license from Bosch.
+-- 
+-- -------------------------------------------------------------------------------
+-- 
+-- CTU CAN FD IP Core 
+-- Copyright (C) 2015-2020 MIT License
+-- 
+-- Authors:
+--     Ondrej Ille <ondrej.ille@gmail.com>
+--     Martin Jerabek <martin.jerabek01@gmail.com>
+-- 
+-- Project advisors: 
+-- 	Jiri Novak <jnovak@fel.cvut.cz>
+-- 	Pavel Pisa <pisa@cmp.felk.cvut.cz>
+-- 
+-- Department of Measurement         (http://meas.fel.cvut.cz/)
+-- Faculty of Electrical Engineering (http://www.fel.cvut.cz)
+-- Czech Technical University        (http://www.cvut.cz/)
+-- 
+-- Permission is hereby granted, free of charge, to any person obtaining a copy
+-- of this VHDL component and associated documentation files (the "Component"),
+-- to deal in the Component without restriction, including without limitation
+-- the rights to use, copy, modify, merge, publish, distribute, sublicense,
+-- and/or sell copies of the Component, and to permit persons to whom the
+-- Component is furnished to do so, subject to the following conditions:
+-- 
+-- The above copyright notice and this permission notice shall be included in
+-- all copies or substantial portions of the Component.
+-- 
+-- THE COMPONENT IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+-- IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+-- FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+-- AUTHORS OR COPYRIGHTHOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+-- LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+-- FROM, OUT OF OR IN CONNECTION WITH THE COMPONENT OR THE USE OR OTHER DEALINGS
+-- IN THE COMPONENT.
+-- 
+-- The CAN protocol is developed by Robert Bosch GmbH and protected by patents.
+-- Anybody who wants to implement this IP core on silicon has to obtain a CAN
+-- protocol license from Bosch.
+-- 
+
+--------------------------------------------------------------------------------
+-- @TestInfoStart
+--
+-- @Purpose:
+--  RX DMA feature test.
+--
+-- @Verifies:
+--  @1. RX DMA moves received frames from RX Buffer to consecutive slots of
+--      ring in system memory. Frame in slot has the same format as read from
+--      RX_DATA.
+--  @2. RX_DMA_STATUS[RDPROD] is incremented after each moved frame and
+--      INT_STAT[DMAI] is set when RX_DMA_CTRL[RDBATCH] frames were moved.
+--  @3. RX DMA does not move frame when ring is full, frame stays in RX
+--      Buffer and it is moved when SW advances RX_DMA_CONS.
+--  @4. Read from RX_DATA or RX data window does not move RX Buffer read
+--      pointer while RX DMA is enabled.
+--  @5. When write is finished with error, RX_DMA_STATUS[RDBERR] is set, rest
+--      of the frame is removed from RX Buffer and RDPROD is not incremented.
+--  @6. Disabling RX DMA resets RDPROD and RDBERR.
+--
+-- @Test sequence:
+--  @1. Check STATUS[SRDMA], skip the test if it is not set. Check
+--      RX_DMA_STATUS is in reset state. Clear DMA memory, configure ring of
+--      four slots at random base address, RDBATCH = 1 and enable RX DMA.
+--  @2. Send three random frames by Test node. Check RX Buffer is empty,
+--      RDPROD = 3 and INT_STAT[DMAI] is set. Read frames from slots 0 to 2
+--      and compare them with sent frames. Clear DMAI.
+--  @3. Send random frame by Test node. Check that no write was executed to
+--      DMA memory, RDPROD = 3 and the frame is in RX Buffer.
+--  @4. Read RX_DATA and RX data window several times. Check RX Buffer read
+--      pointer and frame count did not change.
+--  @5. Set RX_DMA_CONS to 3. Check the frame was moved to slot 3, RDPROD = 0
+--      and RX Buffer is empty.
+--  @6. Configure DMA memory to finish writes with error. Send random frame
+--      by Test node. Check RDBERR is set, RDPROD = 0, single write was
+--      executed and RX Buffer is empty. Disable RX DMA and check RDPROD and
+--      RDBERR are cleared.
+--
+-- @TestInfoEnd
+--------------------------------------------------------------------------------
+-- Revision History:
+--    19.10.2026   Created file
+--------------------------------------------------------------------------------
+
+Library ctu_can_fd_tb;
+context ctu_can_fd_tb.ieee_context;
+context ctu_can_fd_tb.rtl_context;
+context ctu_can_fd_tb.tb_common_context;
+
+use ctu_can_fd_tb.feature_test_agent_pkg.all;
+use ctu_can_fd_tb.dma_memory_agent_pkg.all;
+
+package rx_dma_ftest is
+    procedure rx_dma_ftest_exec(
+        signal      chn             : inout  t_com_channel
+    );
+end package;
+
+
+package body rx_dma_ftest is
+    procedure rx_dma_ftest_exec(
+        signal      chn             : inout  t_com_channel
+    ) is
+        -- Generated frames
+        type t_frames is array (0 to 3) of SW_CAN_frame_type;
+        variable frames             :     t_frames;
+        variable frame_rx           :     SW_CAN_frame_type;
+        variable frame_sent         :     boolean;
+        variable outcome            :     boolean;
+
+        variable rx_buf_info        :     SW_RX_Buffer_info;
+        variable rx_buf_info_2      :     SW_RX_Buffer_info;
+        variable interrupts         :     SW_interrupts := SW_interrupts_rst_val;
+        variable int_clear          :     SW_interrupts := SW_interrupts_rst_val;
+
+        variable r_data             :     std_logic_vector(31 downto 0);
+        variable ffw                :     std_logic_vector(31 downto 0);
+        variable burst_data         :     std_logic_vector(127 downto 0);
+        variable base               :     natural;
+        variable write_count        :     natural;
+        variable write_count_2      :     natural;
+
+        -- Check RX DMA status
+        procedure check_rx_dma_status(
+            constant prod           : in    natural;
+            constant berr           : in    std_logic;
+            signal   chn            : inout t_com_channel
+        ) is
+            variable status         :       std_logic_vector(31 downto 0);
+        begin
+            CAN_read(status, RX_DMA_STATUS_ADR, DUT_NODE, chn);
+            check_m(to_integer(unsigned(status(RDPROD_H downto RDPROD_L))) =
+                    prod, "RX_DMA_STATUS[RDPROD] = " & integer'image(prod));
+            check_m(status(RDACT_IND) = '0', "RX_DMA_STATUS[RDACT] not set");
+            check_m(status(RDBERR_IND) = berr,
+                    "RX_DMA_STATUS[RDBERR] = " & std_logic'image(berr));
+        end procedure;
+
+        -- Read frame from slot of RX DMA ring in DMA memory
+        procedure read_dma_frame(
+            constant slot           : in    natural;
+            variable frame          : inout SW_CAN_frame_type;
+            signal   chn            : inout t_com_channel
+        ) is
+            variable addr           :       natural;
+            variable ffw            :       std_logic_vector(31 downto 0);
+            variable idw            :       std_logic_vector(31 downto 0);
+            variable data           :       std_logic_vector(31 downto 0);
+        begin
+            addr := base + slot * 128;
+            dma_memory_agent_read(chn, addr, ffw);
+            dma_memory_agent_read(chn, addr + 4, idw);
+            dma_memory_agent_read(chn, addr + 8, frame.timestamp(31 downto 0));
+            dma_memory_agent_read(chn, addr + 12, frame.timestamp(63 downto 32));
+
+            frame.dlc           := ffw(DLC_H downto DLC_L);
+            frame.rtr           := ffw(RTR_IND);
+            frame.ident_type    := ffw(IDE_IND);
+            frame.frame_format  := ffw(FDF_IND);
+            frame.brs           := ffw(BRS_IND);
+            frame.rwcnt         := to_integer(unsigned(ffw(RWCNT_H downto RWCNT_L)));
+            decode_dlc(frame.dlc, frame.data_length);
+            id_hw_to_sw(idw(28 downto 0), frame.ident_type, frame.identifier);
+
+            -- Rest of the frame, data words and end of frame timestamp
+            for i in 0 to frame.rwcnt - 4 loop
+                dma_memory_agent_read(chn, addr + 16 + i * 4, data);
+                if ((frame.rtr = NO_RTR_FRAME or frame.frame_format = FD_CAN)
+                    and i * 4 < frame.data_length)
+                then
+                    frame.data(i * 4)       := data(7 downto 0);
+                    frame.data((i * 4) + 1) := data(15 downto 8);
+                    frame.data((i * 4) + 2) := data(23 downto 16);
+                    frame.data((i * 4) + 3) := data(31 downto 24);
+                end if;
+            end loop;
+        end procedure;
+
+        procedure send_and_wait(
+            variable frame          : inout SW_CAN_frame_type;
+            signal   chn            : inout t_com_channel
+        ) is
+        begin
+            CAN_send_frame(frame, 1, TEST_NODE, chn, frame_sent);
+            CAN_wait_frame_sent(TEST_NODE, chn);
+            CAN_wait_bus_idle(DUT_NODE, chn);
+            CAN_wait_bus_idle(TEST_NODE, chn);
+
+            -- Give RX DMA time to move the frame
+            wait for 2 us;
+        end procedure;
+    begin
+
+        -----------------------------------------------------------------------
+        -- @1. Check STATUS[SRDMA], skip the test if it is not set. Check
+        --     RX_DMA_STATUS is in reset state. Clear DMA memory, configure
+        --     ring of four slots at random base address, RDBATCH = 1 and
+        --     enable RX DMA.
+        -----------------------------------------------------------------------
+        info_m("Step 1");
+
+        CAN_read(r_data, STATUS_ADR, DUT_NODE, chn);
+        if (r_data(SRDMA_IND) = '0') then
+            info_m("RX DMA not supported, skipping!");
+            return;
+        end if;
+
+        check_rx_dma_status(0, '0', chn);
+        dma_memory_agent_clear(chn);
+
+        -- Ring of four slots (512 bytes) must fit to DMA memory
+        rand_int_v(C_DMA_MEMORY_SIZE / 32 - 4, base);
+        base := base * 128;
+        info_m("RX DMA ring base: " & integer'image(base));
+
+        r_data := std_logic_vector(to_unsigned(base, 32));
+        CAN_write(r_data, RX_DMA_BASE_ADR, DUT_NODE, chn);
+        r_data := (OTHERS => '0');
+        CAN_write(r_data, RX_DMA_CONS_ADR, DUT_NODE, chn);
+
+        r_data := (OTHERS => '0');
+        r_data(RDRS_H downto RDRS_L) := x"2";
+        r_data(RDBATCH_H downto RDBATCH_L) := x"01";
+        r_data(RDENA_IND) := RDMA_ENABLED;
+        CAN_write(r_data, RX_DMA_CTRL_ADR, DUT_NODE, chn);
+
+        -----------------------------------------------------------------------
+        -- @2. Send three random frames by Test node. Check RX Buffer is
+        --     empty, RDPROD = 3 and INT_STAT[DMAI] is set. Read frames from
+        --     slots 0 to 2 and compare them with sent frames. Clear DMAI.
+        -----------------------------------------------------------------------
+        info_m("Step 2");
+
+        for i in 0 to 2 loop
+            CAN_generate_frame(frames(i));
+            send_and_wait(frames(i), chn);
+        end loop;
+
+        get_rx_buf_state(rx_buf_info, DUT_NODE, chn);
+        check_m(rx_buf_info.rx_empty, "RX Buffer empty");
+        check_rx_dma_status(3, '0', chn);
+
+        read_int_status(interrupts, DUT_NODE, chn);
+        check_m(interrupts.rx_dma_int, "INT_STAT[DMAI] set");
+
+        for i in 0 to 2 loop
+            read_dma_frame(i, frame_rx, chn);
+            CAN_compare_frames(frame_rx, frames(i), false, outcome);
+            check_m(outcome, "Frame " & integer'image(i) & " in RX DMA ring");
+        end loop;
+
+        int_clear.rx_dma_int := true;
+        clear_int_status(int_clear, DUT_NODE, chn);
+
+        -----------------------------------------------------------------------
+        -- @3. Send random frame by Test node. Check that no write was
+        --     executed to DMA memory, RDPROD = 3 and the frame is in RX
+        --     Buffer.
+        -----------------------------------------------------------------------
+        info_m("Step 3");
+
+        dma_memory_agent_get_write_count(chn, write_count);
+
+        CAN_generate_frame(frames(3));
+        send_and_wait(frames(3), chn);
+
+        dma_memory_agent_get_write_count(chn, write_count_2);
+        check_m(write_count_2 = write_count, "No write to full ring");
+        check_rx_dma_status(3, '0', chn);
+
+        get_rx_buf_state(rx_buf_info, DUT_NODE, chn);
+        check_m(rx_buf_info.rx_frame_count = 1, "Frame stays in RX Buffer");
+
+        -----------------------------------------------------------------------
+        -- @4. Read RX_DATA and RX data window several times. Check RX Buffer
+        --     read pointer and frame count did not change.
+        -----------------------------------------------------------------------
+        info_m("Step 4");
+
+        for i in 0 to 3 loop
+            CAN_read(r_data, RX_DATA_ADR, DUT_NODE, chn);
+            if (i = 0) then
+                ffw := r_data;
+            else
+                check_m(r_data = ffw, "RX_DATA returns the same word");
+            end if;
+        end loop;
+        CAN_read(burst_data, RX_DATA_WINDOW_ADR, DUT_NODE, chn);
+
+        get_rx_buf_state(rx_buf_info_2, DUT_NODE, chn);
+        check_m(rx_buf_info_2.rx_read_pointer = rx_buf_info.rx_read_pointer,
+                "RX Buffer read pointer not moved by RX_DATA read");
+        check_m(rx_buf_info_2.rx_frame_count = 1,
+                "Frame not removed by RX_DATA read");
+
+        -----------------------------------------------------------------------
+        -- @5. Set RX_DMA_CONS to 3. Check the frame was moved to slot 3,
+        --     RDPROD = 0 and RX Buffer is empty.
+        -----------------------------------------------------------------------
+        info_m("Step 5");
+
+        r_data := std_logic_vector(to_unsigned(3, 32));
+        CAN_write(r_data, RX_DMA_CONS_ADR, DUT_NODE, chn);
+        wait for 2 us;
+
+        check_rx_dma_status(0, '0', chn);
+        get_rx_buf_state(rx_buf_info, DUT_NODE, chn);
+        check_m(rx_buf_info.rx_empty, "RX Buffer empty after RX_DMA_CONS move");
+
+        read_dma_frame(3, frame_rx, chn);
+        CAN_compare_frames(frame_rx, frames(3), false, outcome);
+        check_m(outcome, "Frame moved to slot 3");
+
+        -----------------------------------------------------------------------
+        -- @6. Configure DMA memory to finish writes with error. Send random
+        --     frame by Test node. Check RDBERR is set, RDPROD = 0, single
+        --     write was executed and RX Buffer is empty. Disable RX DMA and
+        --     check RDPROD and RDBERR are cleared.
+        -----------------------------------------------------------------------
+        info_m("Step 6");
+
+        dma_memory_agent_set_error(chn, true);
+        dma_memory_agent_get_write_count(chn, write_count);
+
+        CAN_generate_frame(frames(0));
+        send_and_wait(frames(0), chn);
+
+        dma_memory_agent_get_write_count(chn, write_count_2);
+        check_m(write_count_2 = write_count + 1, "Single write with error");
+        check_rx_dma_status(0, '1', chn);
+
+        get_rx_buf_state(rx_buf_info, DUT_NODE, chn);
+        check_m(rx_buf_info.rx_empty, "Frame removed from RX Buffer after error");
+
+        r_data := (OTHERS => '0');
+        r_data(RDRS_H downto RDRS_L) := x"2";
+        r_data(RDBATCH_H downto RDBATCH_L) := x"01";
+        r_data(RDENA_IND) := RDMA_DISABLED;
+        CAN_write(r_data, RX_DMA_CTRL_ADR, DUT_NODE, chn);
+        check_rx_dma_status(0, '0', chn);
+
+        dma_memory_agent_set_error(chn, false);
+
+  end procedure;
+
+end package body;
@@ -0,0 +1,268 @@
+--------------------------------------------------------------------------------
+-- 
+-- CTU CAN FD IP Core 
+-- Copyright (C) 2021-present Ondrej Ille
+-- 
+-- Permission is hereby granted, free of charge, to any person obtaining a copy
+-- of this VHDL component and associated documentation files (the "Component"),
+-- to use, copy, modify, merge, publish, distribute the Component for
+-- educational, research, evaluation, self-interest purposes. Using the
+-- Component for commercial purposes is forbidden unless previously agreed with
+-- Copyright holder.
+-- 
+-- The above copyright notice and this permission notice shall be included in
+-- all copies or substantial portions of the Component.
+-- 
+-- THE COMPONENT IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+-- IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+-- FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+-- AUTHORS OR COPYRIGHTHOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+-- LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+-- FROM, OUT OF OR IN CONNECTION WITH THE COMPONENT OR THE USE OR OTHER DEALINGS
+-- IN THE COMPONENT.
+-- 
+-- The CAN protocol is developed by Robert Bosch GmbH and protected by patents.
+-- Anybody who wants to implement this IP core on silicon has to obtain a CAN
+-- protocol license from Bosch.
+-- 
+-- -------------------------------------------------------------------------------
+-- 
+-- CTU CAN FD IP Core 
+-- Copyright (C) 2015-2020 MIT License
+-- 
+-- Authors:
+--     Ondrej Ille <ondrej.ille@gmail.com>
+--     Martin Jerabek <martin.jerabek01@gmail.com>
+-- 
+-- Project advisors: 
+-- 	Jiri Novak <jnovak@fel.cvut.cz>
+-- 	Pavel Pisa <pisa@cmp.felk.cvut.cz>
+-- 
+-- Department of Measurement         (http://meas.fel.cvut.cz/)
+-- Faculty of Electrical Engineering (http://www.fel.cvut.cz)
+-- Czech Technical University        (http://www.cvut.cz/)
+-- 
+-- Permission is hereby granted, free of charge, to any person obtaining a copy
+-- of this VHDL component and associated documentation files (the "Component"),
+-- to deal in the Component without restriction, including without limitation
+-- the rights to use, copy, modify, merge, publish, distribute, sublicense,
+-- and/or sell copies of the Component, and to permit persons to whom the
+-- Component is furnished to do so, subject to the following conditions:
+-- 
+-- The above copyright notice and this permission notice shall be included in
+-- all copies or substantial portions of the Component.
+-- 
+-- THE COMPONENT IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+-- IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+-- FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+-- AUTHORS OR COPYRIGHTHOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+-- LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+-- FROM, OUT OF OR IN CONNECTION WITH THE COMPONENT OR THE USE OR OTHER DEALINGS
+-- IN THE COMPONENT.
+-- 
+-- The CAN protocol is developed by Robert Bosch GmbH and protected by patents.
+-- Anybody who wants to implement this IP core on silicon has to obtain a CAN
+-- protocol license from Bosch.
+-- 
+
+--------------------------------------------------------------------------------
+-- @TestInfoStart
+--
+-- @Purpose:
+--  RX Buffer header peek and skip command feature test.
+--
+-- @Verifies:
+--  @1. RX_PEEK_FFW and RX_PEEK_IDW contain FRAME_FORMAT_W and IDENTIFIER_W of
+--      the oldest frame in RX Buffer.
+--  @2. Reading RX_PEEK_FFW and RX_PEEK_IDW does not move read pointer.
+--  @3. COMMAND[RXSKIP] discards the oldest frame from RX Buffer.
+--  @4. COMMAND[RXSKIP] issued in the middle of frame (RX_STATUS[RXMOF])
+--      discards the rest of the frame.
+--  @5. RX_PEEK_FFW and RX_PEEK_IDW read as zero when RX Buffer is empty.
+--
+-- @Test sequence:
+--  @1. Check that RX_PEEK_FFW and RX_PEEK_IDW are zero. Generate three random
+--      CAN frames with base identifiers 1, 2 and 3 and send them by Test node.
+--      Check that DUT has three frames in RX Buffer.
+--  @2. Read RX_PEEK_FFW and RX_PEEK_IDW twice. Check that they are equal,
+--      FRAME_FORMAT_W is not zero and identifier is 1. Check that RX frame
+--      count and RX memory free did not change and RX_STATUS[RXMOF] is not
+--      set.
+--  @3. Issue COMMAND[RXSKIP]. Check that RX frame count decremented, RX memory
+--      free increased by size of first frame, and RX_PEEK_IDW identifier is 2.
+--  @4. Read frame from DUT and compare it with second sent frame. Check that
+--      RX_PEEK_IDW identifier is 3.
+--  @5. Read two words from RX_DATA and check they are equal to RX_PEEK_FFW
+--      and RX_PEEK_IDW read before. Check RX_STATUS[RXMOF] is set. Issue
+--      COMMAND[RXSKIP]. Check that RX Buffer is empty, RX_STATUS[RXMOF] is
+--      not set, whole RX Buffer is free and RX_PEEK_FFW and RX_PEEK_IDW are
+--      zero.
+--
+-- @TestInfoEnd
+--------------------------------------------------------------------------------
+-- Revision History:
+--    19.10.2026   Created file
+--------------------------------------------------------------------------------
+
+Library ctu_can_fd_tb;
+context ctu_can_fd_tb.ieee_context;
+context ctu_can_fd_tb.rtl_context;
+context ctu_can_fd_tb.tb_common_context;
+
+use ctu_can_fd_tb.feature_test_agent_pkg.all;
+
+package rx_peek_skip_ftest is
+    procedure rx_peek_skip_ftest_exec(
+        signal      chn             : inout  t_com_channel
+    );
+end package;
+
+
+package body rx_peek_skip_ftest is
+    procedure rx_peek_skip_ftest_exec(
+        signal      chn             : inout  t_com_channel
+    ) is
+        -- Generated frames
+        type t_frames is array (1 to 3) of SW_CAN_frame_type;
+        variable frames             :     t_frames;
+        variable frame_rx           :     SW_CAN_frame_type;
+        variable frame_sent         :     boolean;
+        variable outcome            :     boolean;
+
+        variable rx_buf_info        :     SW_RX_Buffer_info;
+        variable rx_buf_info_2      :     SW_RX_Buffer_info;
+        variable command            :     SW_command := SW_command_rst_val;
+
+        variable peek_ffw           :     std_logic_vector(31 downto 0);
+        variable peek_idw           :     std_logic_vector(31 downto 0);
+        variable r_data             :     std_logic_vector(31 downto 0);
+        variable r_data_2           :     std_logic_vector(31 downto 0);
+        variable rwcnt              :     natural;
+
+        -- Check base identifier in IDENTIFIER_W
+        procedure check_peek_id(
+            constant ident          : in    natural;
+            signal   chn            : inout t_com_channel
+        ) is
+        begin
+            CAN_read(peek_idw, RX_PEEK_IDW_ADR, DUT_NODE, chn);
+            check_m(to_integer(unsigned(peek_idw(IDENTIFIER_BASE_H downto
+                                                 IDENTIFIER_BASE_L))) = ident,
+                    "RX_PEEK_IDW identifier: " & integer'image(ident));
+        end procedure;
+    begin
+
+        -----------------------------------------------------------------------
+        -- @1. Check that RX_PEEK_FFW and RX_PEEK_IDW are zero. Generate three
+        --     random CAN frames with base identifiers 1, 2 and 3 and send
+        --     them by Test node. Check that DUT has three frames in RX Buffer.
+        -----------------------------------------------------------------------
+        info_m("Step 1");
+
+        CAN_read(r_data, RX_PEEK_FFW_ADR, DUT_NODE, chn);
+        check_m(r_data = x"00000000", "RX_PEEK_FFW zero when RX Buffer empty");
+        CAN_read(r_data, RX_PEEK_IDW_ADR, DUT_NODE, chn);
+        check_m(r_data = x"00000000", "RX_PEEK_IDW zero when RX Buffer empty");
+
+        for i in 1 to 3 loop
+            CAN_generate_frame(frames(i));
+            frames(i).ident_type := BASE;
+            frames(i).identifier := i;
+            CAN_send_frame(frames(i), 1, TEST_NODE, chn, frame_sent);
+            CAN_wait_frame_sent(TEST_NODE, chn);
+        end loop;
+
+        CAN_wait_bus_idle(DUT_NODE, chn);
+        CAN_wait_bus_idle(TEST_NODE, chn);
+
+        get_rx_buf_state(rx_buf_info, DUT_NODE, chn);
+        check_m(rx_buf_info.rx_frame_count = 3, "Three frames in RX Buffer");
+
+        -----------------------------------------------------------------------
+        -- @2. Read RX_PEEK_FFW and RX_PEEK_IDW twice. Check that they are
+        --     equal, FRAME_FORMAT_W is not zero and identifier is 1. Check
+        --     that RX frame count and RX memory free did not change and
+        --     RX_STATUS[RXMOF] is not set.
+        -----------------------------------------------------------------------
+        info_m("Step 2");
+
+        CAN_read(peek_ffw, RX_PEEK_FFW_ADR, DUT_NODE, chn);
+        check_peek_id(1, chn);
+        check_m(peek_ffw /= x"00000000", "RX_PEEK_FFW not zero");
+
+        CAN_read(r_data, RX_PEEK_FFW_ADR, DUT_NODE, chn);
+        CAN_read(r_data_2, RX_PEEK_IDW_ADR, DUT_NODE, chn);
+        check_m(r_data = peek_ffw, "RX_PEEK_FFW stable");
+        check_m(r_data_2 = peek_idw, "RX_PEEK_IDW stable");
+
+        get_rx_buf_state(rx_buf_info_2, DUT_NODE, chn);
+        check_m(rx_buf_info_2.rx_frame_count = 3, "RX frame count unchanged");
+        check_m(rx_buf_info_2.rx_mem_free = rx_buf_info.rx_mem_free,
+                "RX memory free unchanged");
+        check_false_m(rx_buf_info_2.rx_mof, "RX_STATUS[RXMOF] not set");
+
+        -----------------------------------------------------------------------
+        -- @3. Issue COMMAND[RXSKIP]. Check that RX frame count decremented,
+        --     RX memory free increased by size of first frame, and
+        --     RX_PEEK_IDW identifier is 2.
+        -----------------------------------------------------------------------
+        info_m("Step 3");
+
+        rwcnt := to_integer(unsigned(peek_ffw(RWCNT_H downto RWCNT_L)));
+
+        command.rx_skip_frame := true;
+        give_controller_command(command, DUT_NODE, chn);
+
+        get_rx_buf_state(rx_buf_info_2, DUT_NODE, chn);
+        check_m(rx_buf_info_2.rx_frame_count = 2, "RX frame count decremented");
+        check_m(rx_buf_info_2.rx_mem_free = rx_buf_info.rx_mem_free + rwcnt + 1,
+                "RX memory free increased by " & integer'image(rwcnt + 1));
+
+        check_peek_id(2, chn);
+
+        -----------------------------------------------------------------------
+        -- @4. Read frame from DUT and compare it with second sent frame.
+        --     Check that RX_PEEK_IDW identifier is 3.
+        -----------------------------------------------------------------------
+        info_m("Step 4");
+
+        CAN_read_frame(frame_rx, DUT_NODE, chn);
+        CAN_compare_frames(frame_rx, frames(2), false, outcome);
+        check_m(outcome, "Second frame read after skip");
+
+        check_peek_id(3, chn);
+        CAN_read(peek_ffw, RX_PEEK_FFW_ADR, DUT_NODE, chn);
+
+        -----------------------------------------------------------------------
+        -- @5. Read two words from RX_DATA and check they are equal to
+        --     RX_PEEK_FFW and RX_PEEK_IDW read before. Check RX_STATUS[RXMOF]
+        --     is set. Issue COMMAND[RXSKIP]. Check that RX Buffer is empty,
+        --     RX_STATUS[RXMOF] is not set, whole RX Buffer is free and
+        --     RX_PEEK_FFW and RX_PEEK_IDW are zero.
+        -----------------------------------------------------------------------
+        info_m("Step 5");
+
+        CAN_read(r_data, RX_DATA_ADR, DUT_NODE, chn);
+        CAN_read(r_data_2, RX_DATA_ADR, DUT_NODE, chn);
+        check_m(r_data = peek_ffw, "FRAME_FORMAT_W equal to RX_PEEK_FFW");
+        check_m(r_data_2 = peek_idw, "IDENTIFIER_W equal to RX_PEEK_IDW");
+
+        get_rx_buf_state(rx_buf_info_2, DUT_NODE, chn);
+        check_m(rx_buf_info_2.rx_mof, "RX_STATUS[RXMOF] set");
+
+        give_controller_command(command, DUT_NODE, chn);
+
+        get_rx_buf_state(rx_buf_info_2, DUT_NODE, chn);
+        check_m(rx_buf_info_2.rx_empty, "RX Buffer empty");
+        check_false_m(rx_buf_info_2.rx_mof, "RX_STATUS[RXMOF] not set");
+        check_m(rx_buf_info_2.rx_mem_free = rx_buf_info_2.rx_buff_size,
+                "Whole RX Buffer free");
+
+        CAN_read(r_data, RX_PEEK_FFW_ADR, DUT_NODE, chn);
+        check_m(r_data = x"00000000", "RX_PEEK_FFW zero after skip");
+        CAN_read(r_data, RX_PEEK_IDW_ADR, DUT_NODE, chn);
+        check_m(r_data = x"00000000", "RX_PEEK_IDW zero after skip");
+
+  end procedure;
+
+end package body;
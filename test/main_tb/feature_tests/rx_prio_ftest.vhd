@@ -0,0 +1,439 @@
+--------------------------------------------------------------------------------
+-- 
+-- CTU CAN FD IP Core 
+-- Copyright (C) 2021-present Ondrej Ille
+-- 
+-- Permission is hereby granted, free of charge, to any person obtaining a copy
+-- of this VHDL component and associated documentation files (the "Component"),
+-- to use, copy, modify, merge, publish, distribute the Component for
+-- educational, research, evaluation, self-interest purposes. Using the
+-- Component for commercial purposes is forbidden unless previously agreed with
+-- Copyright holder.
+-- 
+-- The above copyright notice and this permission notice shall be included in
+-- all copies or substantial portions of the Component.
+-- 
+-- THE COMPONENT IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+-- IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+-- FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+-- AUTHORS OR COPYRIGHTHOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+-- LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+-- FROM, OUT OF OR IN CONNECTION WITH THE COMPONENT OR THE USE OR OTHER DEALINGS
+-- IN THE COMPONENT.
+-- 
+-- The CAN protocol is developed by Robert Bosch GmbH and protected by patents.
+-- Anybody who wants to implement this IP core on silicon has to obtain a CAN
+-- protocol license from Bosch.
+-- 
+-- -------------------------------------------------------------------------------
+-- 
+-- CTU CAN FD IP Core 
+-- Copyright (C) 2015-2020 MIT License
+-- 
+-- Authors:
+--     Ondrej Ille <ondrej.ille@gmail.com>
+--     Martin Jerabek <martin.jerabek01@gmail.com>
+-- 
+-- Project advisors: 
+-- 	Jiri Novak <jnovak@fel.cvut.cz>
+-- 	Pavel Pisa <pisa@cmp.felk.cvut.cz>
+-- 
+-- Department of Measurement         (http://meas.fel.cvut.cz/)
+-- Faculty of Electrical Engineering (http://www.fel.cvut.cz)
+-- Czech Technical University        (http://www.cvut.cz/)
+-- 
+-- Permission is hereby granted, free of charge, to any person obtaining a copy
+-- of this VHDL component and associated documentation files (the "Component"),
+-- to deal in the Component without restriction, including without limitation
+-- the rights to use, copy, modify, merge, publish, distribute, sublicense,
+-- and/or sell copies of the Component, and to permit persons to whom the
+-- Component is furnished to do so, subject to the following conditions:
+-- 
+-- The above copyright notice and this permission notice shall be included in
+-- all copies or substantial portions of the Component.
+-- 
+-- THE COMPONENT IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+-- IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+-- FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+-- AUTHORS OR COPYRIGHTHOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+-- LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+-- FROM, OUT OF OR IN CONNECTION WITH THE COMPONENT OR THE USE OR OTHER DEALINGS
+-- IN THE COMPONENT.
+-- 
+-- The CAN protocol is developed by Robert Bosch GmbH and protected by patents.
+-- Anybody who wants to implement this IP core on silicon has to obtain a CAN
+-- protocol license from Bosch.
+-- 
+
+--------------------------------------------------------------------------------
+-- @TestInfoStart
+--
+-- @Purpose:
+--  Priority RX Buffer feature test.
+--
+-- @Verifies:
+--  @1. Frames accepted by filter which is not routed by RXP_CTRL are stored
+--      to RX Buffer.
+--  @2. Frames accepted by filter routed by RXP_CTRL are stored to Priority RX
+--      Buffer and they are available in RXP_DATA regardless of number of
+--      frames in RX Buffer.
+--  @3. INT_STAT[RXPI] and INT_STAT[RPNEI] are set when frame is stored to
+--      Priority RX Buffer. RPNEI can not be cleared while Priority RX Buffer
+--      is not empty.
+--  @4. RXP_CTRL[RPRRB] erases Priority RX Buffer and does not change routing.
+--  @5. Frames routed to Priority RX Buffer are stored and can be read from
+--      RXP_DATA while RX Buffer is full and overrun.
+--
+-- @Test sequence:
+--  @1. Check STATUS[STRXP] and FILTER_CONTROL[SFA], skip the test if any of
+--      them is not set. Check Priority RX Buffer is empty and whole memory is
+--      free. Enable frame filters mode, configure filter A to accept all
+--      frames with base identifier.
+--  @2. Send four CAN 2.0 frames with base identifier by Test node. Check that
+--      they are stored to RX Buffer and Priority RX Buffer is empty.
+--  @3. Route filter A to Priority RX Buffer and check RXP_CTRL. Send random
+--      frame with base identifier by Test node. Check that RX Buffer still
+--      contains four frames, Priority RX Buffer contains one frame and
+--      INT_STAT[RXPI] and INT_STAT[RPNEI] are set.
+--  @4. Read frame from RXP_DATA and compare it with sent frame. Check that
+--      Priority RX Buffer is empty, clear RXPI and RPNEI and check they are
+--      not set. Read four frames from RX Buffer and compare them with sent
+--      frames.
+--  @5. Send frame by Test node, check it is in Priority RX Buffer. Clear
+--      RPNEI, check it is still set. Issue RXP_CTRL[RPRRB] and check
+--      Priority RX Buffer is empty, whole memory is free and routing is not
+--      changed.
+--  @6. Disable routing. Send frames by Test node until RX Buffer is full,
+--      and one more frame. Check RX Buffer is full and STATUS[DOR] is set.
+--      Route filter A to Priority RX Buffer and send frame by Test node.
+--      Check it is stored to Priority RX Buffer, read it from RXP_DATA and
+--      compare it with sent frame. Check RX Buffer frame count did not
+--      change. Release RX Buffer and clear Data overrun flag.
+--
+-- @TestInfoEnd
+--------------------------------------------------------------------------------
+-- Revision History:
+--    19.10.2026   Created file
+--------------------------------------------------------------------------------
+
+Library ctu_can_fd_tb;
+context ctu_can_fd_tb.ieee_context;
+context ctu_can_fd_tb.rtl_context;
+context ctu_can_fd_tb.tb_common_context;
+
+use ctu_can_fd_tb.feature_test_agent_pkg.all;
+
+package rx_prio_ftest is
+    procedure rx_prio_ftest_exec(
+        signal      chn             : inout  t_com_channel
+    );
+end package;
+
+
+package body rx_prio_ftest is
+    procedure rx_prio_ftest_exec(
+        signal      chn             : inout  t_com_channel
+    ) is
+        -- Generated frames
+        type t_frames is array (1 to 4) of SW_CAN_frame_type;
+        variable frames             :     t_frames;
+        variable frame_prio         :     SW_CAN_frame_type;
+        variable frame_bulk         :     SW_CAN_frame_type;
+        variable frame_rx           :     SW_CAN_frame_type;
+        variable frame_sent         :     boolean;
+        variable outcome            :     boolean;
+
+        variable mode               :     SW_mode := SW_mode_rst_val;
+        variable filt_A_cfg         :     SW_CAN_mask_filter_config;
+        variable rx_buf_info        :     SW_RX_Buffer_info;
+        variable interrupts         :     SW_interrupts := SW_interrupts_rst_val;
+        variable int_clear          :     SW_interrupts := SW_interrupts_rst_val;
+
+        variable command            :     SW_command := SW_command_rst_val;
+        variable status             :     SW_status;
+
+        variable r_data             :     std_logic_vector(31 downto 0);
+        variable buf_size           :     natural;
+        variable in_rx_buf          :     natural;
+        variable rx_frame_count     :     natural;
+
+        -- Check number of frames in Priority RX Buffer
+        procedure check_rxp_frame_count(
+            constant count          : in    natural;
+            signal   chn            : inout t_com_channel
+        ) is
+            variable status         :       std_logic_vector(31 downto 0);
+        begin
+            CAN_read(status, RXP_STATUS_ADR, DUT_NODE, chn);
+            check_m(to_integer(unsigned(status(RXPFRC_H downto RXPFRC_L))) =
+                    count, "Priority RX Buffer frame count: " &
+                    integer'image(count));
+            if (count = 0) then
+                check_m(status(RXPE_IND) = '1', "Priority RX Buffer empty");
+            else
+                check_m(status(RXPE_IND) = '0', "Priority RX Buffer not empty");
+            end if;
+        end procedure;
+
+        -- Read frame from RXP_DATA (same format as RX_DATA)
+        procedure read_rxp_frame(
+            variable frame          : inout SW_CAN_frame_type;
+            signal   chn            : inout t_com_channel
+        ) is
+            variable ffw            :       std_logic_vector(31 downto 0);
+            variable idw            :       std_logic_vector(31 downto 0);
+            variable data           :       std_logic_vector(31 downto 0);
+        begin
+            CAN_read(ffw, RXP_DATA_ADR, DUT_NODE, chn);
+            CAN_read(idw, RXP_DATA_ADR, DUT_NODE, chn);
+            CAN_read(frame.timestamp(31 downto 0), RXP_DATA_ADR, DUT_NODE, chn);
+            CAN_read(frame.timestamp(63 downto 32), RXP_DATA_ADR, DUT_NODE, chn);
+
+            frame.dlc           := ffw(DLC_H downto DLC_L);
+            frame.rtr           := ffw(RTR_IND);
+            frame.ident_type    := ffw(IDE_IND);
+            frame.frame_format  := ffw(FDF_IND);
+            frame.brs           := ffw(BRS_IND);
+            frame.rwcnt         := to_integer(unsigned(ffw(RWCNT_H downto RWCNT_L)));
+            decode_dlc(frame.dlc, frame.data_length);
+            id_hw_to_sw(idw(28 downto 0), frame.ident_type, frame.identifier);
+
+            -- Rest of the frame, data words and end of frame timestamp
+            for i in 0 to frame.rwcnt - 4 loop
+                CAN_read(data, RXP_DATA_ADR, DUT_NODE, chn);
+                if ((frame.rtr = NO_RTR_FRAME or frame.frame_format = FD_CAN)
+                    and i * 4 < frame.data_length)
+                then
+                    frame.data(i * 4)       := data(7 downto 0);
+                    frame.data((i * 4) + 1) := data(15 downto 8);
+                    frame.data((i * 4) + 2) := data(23 downto 16);
+                    frame.data((i * 4) + 3) := data(31 downto 24);
+                end if;
+            end loop;
+        end procedure;
+    begin
+
+        -----------------------------------------------------------------------
+        -- @1. Check STATUS[STRXP] and FILTER_CONTROL[SFA], skip the test if
+        --     any of them is not set. Check Priority RX Buffer is empty and
+        --     whole memory is free. Enable frame filters mode, configure
+        --     filter A to accept all frames with base identifier.
+        -----------------------------------------------------------------------
+        info_m("Step 1");
+
+        CAN_read(r_data, STATUS_ADR, DUT_NODE, chn);
+        if (r_data(STRXP_IND) = '0') then
+            info_m("Priority RX Buffer not supported, skipping!");
+            return;
+        end if;
+
+        CAN_read(r_data, FILTER_CONTROL_ADR, DUT_NODE, chn);
+        if (r_data(SFA_IND) = '0') then
+            info_m("Filter A not synthesized, skipping!");
+            return;
+        end if;
+
+        check_rxp_frame_count(0, chn);
+        CAN_read(r_data, RXP_MEM_INFO_ADR, DUT_NODE, chn);
+        buf_size := to_integer(unsigned(
+                        r_data(RXP_BUFF_SIZE_H downto RXP_BUFF_SIZE_L)));
+        check_m(buf_size > 0, "Priority RX Buffer size not zero");
+        check_m(to_integer(unsigned(r_data(RXP_MEM_FREE_H downto RXP_MEM_FREE_L)))
+                = buf_size, "Whole Priority RX Buffer free");
+
+        mode.acceptance_filter := true;
+        set_core_mode(mode, DUT_NODE, chn);
+
+        filt_A_cfg.ID_value := 0;
+        filt_A_cfg.ID_mask := 0;
+        filt_A_cfg.ident_type := BASE;
+        filt_A_cfg.acc_CAN_2_0 := true;
+        filt_A_cfg.acc_CAN_FD := true;
+        CAN_set_mask_filter(filter_A, filt_A_cfg, DUT_NODE, chn);
+
+        -----------------------------------------------------------------------
+        -- @2. Send four CAN 2.0 frames with base identifier by Test node.
+        --     Check that they are stored to RX Buffer and Priority RX Buffer
+        --     is empty.
+        -----------------------------------------------------------------------
+        info_m("Step 2");
+
+        for i in 1 to 4 loop
+            CAN_generate_frame(frames(i));
+            frames(i).ident_type := BASE;
+            frames(i).identifier := i;
+            frames(i).frame_format := NORMAL_CAN;
+            frames(i).rtr := NO_RTR_FRAME;
+            frames(i).dlc := "1000";
+            decode_dlc(frames(i).dlc, frames(i).data_length);
+            CAN_send_frame(frames(i), 1, TEST_NODE, chn, frame_sent);
+            CAN_wait_frame_sent(TEST_NODE, chn);
+        end loop;
+
+        CAN_wait_bus_idle(DUT_NODE, chn);
+        CAN_wait_bus_idle(TEST_NODE, chn);
+
+        get_rx_buf_state(rx_buf_info, DUT_NODE, chn);
+        check_m(rx_buf_info.rx_frame_count = 4, "Four frames in RX Buffer");
+        check_rxp_frame_count(0, chn);
+
+        -----------------------------------------------------------------------
+        -- @3. Route filter A to Priority RX Buffer and check RXP_CTRL. Send
+        --     random frame with base identifier by Test node. Check that RX
+        --     Buffer still contains four frames, Priority RX Buffer contains
+        --     one frame and INT_STAT[RXPI] and INT_STAT[RPNEI] are set.
+        -----------------------------------------------------------------------
+        info_m("Step 3");
+
+        r_data := (OTHERS => '0');
+        r_data(RPRA_IND) := '1';
+        CAN_write(r_data, RXP_CTRL_ADR, DUT_NODE, chn);
+        CAN_read(r_data, RXP_CTRL_ADR, DUT_NODE, chn);
+        check_m(r_data = x"00000001", "RXP_CTRL routes filter A");
+
+        CAN_generate_frame(frame_prio);
+        frame_prio.ident_type := BASE;
+        frame_prio.identifier := 5;
+        CAN_send_frame(frame_prio, 1, TEST_NODE, chn, frame_sent);
+        CAN_wait_frame_sent(TEST_NODE, chn);
+
+        CAN_wait_bus_idle(DUT_NODE, chn);
+        CAN_wait_bus_idle(TEST_NODE, chn);
+
+        get_rx_buf_state(rx_buf_info, DUT_NODE, chn);
+        check_m(rx_buf_info.rx_frame_count = 4, "RX Buffer not changed");
+        check_rxp_frame_count(1, chn);
+
+        read_int_status(interrupts, DUT_NODE, chn);
+        check_m(interrupts.rx_prio_int, "INT_STAT[RXPI] set");
+        check_m(interrupts.rx_prio_not_empty_int, "INT_STAT[RPNEI] set");
+
+        -----------------------------------------------------------------------
+        -- @4. Read frame from RXP_DATA and compare it with sent frame. Check
+        --     that Priority RX Buffer is empty, clear RXPI and RPNEI and check
+        --     they are not set. Read four frames from RX Buffer and compare
+        --     them with sent frames.
+        -----------------------------------------------------------------------
+        info_m("Step 4");
+
+        read_rxp_frame(frame_rx, chn);
+        CAN_compare_frames(frame_rx, frame_prio, false, outcome);
+        check_m(outcome, "Frame read from Priority RX Buffer");
+        check_rxp_frame_count(0, chn);
+
+        int_clear.rx_prio_int := true;
+        int_clear.rx_prio_not_empty_int := true;
+        clear_int_status(int_clear, DUT_NODE, chn);
+        read_int_status(interrupts, DUT_NODE, chn);
+        check_false_m(interrupts.rx_prio_int, "INT_STAT[RXPI] cleared");
+        check_false_m(interrupts.rx_prio_not_empty_int, "INT_STAT[RPNEI] cleared");
+
+        for i in 1 to 4 loop
+            CAN_read_frame(frame_rx, DUT_NODE, chn);
+            CAN_compare_frames(frame_rx, frames(i), false, outcome);
+            check_m(outcome, "Frame " & integer'image(i) & " read from RX Buffer");
+        end loop;
+
+        -----------------------------------------------------------------------
+        -- @5. Send frame by Test node, check it is in Priority RX Buffer.
+        --     Clear RPNEI, check it is still set. Issue RXP_CTRL[RPRRB] and
+        --     check Priority RX Buffer is empty, whole memory is free and
+        --     routing is not changed.
+        -----------------------------------------------------------------------
+        info_m("Step 5");
+
+        CAN_send_frame(frame_prio, 1, TEST_NODE, chn, frame_sent);
+        CAN_wait_frame_sent(TEST_NODE, chn);
+        CAN_wait_bus_idle(DUT_NODE, chn);
+        check_rxp_frame_count(1, chn);
+
+        int_clear.rx_prio_int := false;
+        clear_int_status(int_clear, DUT_NODE, chn);
+        read_int_status(interrupts, DUT_NODE, chn);
+        check_m(interrupts.rx_prio_not_empty_int,
+                "INT_STAT[RPNEI] set while Priority RX Buffer is not empty");
+
+        r_data := (OTHERS => '0');
+        r_data(RPRA_IND) := '1';
+        r_data(RPRRB_IND) := '1';
+        CAN_write(r_data, RXP_CTRL_ADR, DUT_NODE, chn);
+
+        check_rxp_frame_count(0, chn);
+        CAN_read(r_data, RXP_MEM_INFO_ADR, DUT_NODE, chn);
+        check_m(to_integer(unsigned(r_data(RXP_MEM_FREE_H downto RXP_MEM_FREE_L)))
+                = buf_size, "Whole Priority RX Buffer free after RPRRB");
+        CAN_read(r_data, RXP_CTRL_ADR, DUT_NODE, chn);
+        check_m(r_data = x"00000001", "Routing not changed by RPRRB");
+
+        -----------------------------------------------------------------------
+        -- @6. Disable routing. Send frames by Test node until RX Buffer is
+        --     full, and one more frame. Check RX Buffer is full and
+        --     STATUS[DOR] is set. Route filter A to Priority RX Buffer and
+        --     send frame by Test node. Check it is stored to Priority RX
+        --     Buffer, read it from RXP_DATA and compare it with sent frame.
+        --     Check RX Buffer frame count did not change. Release RX Buffer
+        --     and clear Data overrun flag.
+        -----------------------------------------------------------------------
+        info_m("Step 6");
+
+        r_data := (OTHERS => '0');
+        CAN_write(r_data, RXP_CTRL_ADR, DUT_NODE, chn);
+
+        -- Long frames to reduce number of frames needed to fill RX Buffer
+        CAN_generate_frame(frame_bulk);
+        frame_bulk.ident_type := BASE;
+        frame_bulk.identifier := 6;
+        frame_bulk.frame_format := FD_CAN;
+        frame_bulk.brs := BR_SHIFT;
+        frame_bulk.rtr := NO_RTR_FRAME;
+        frame_bulk.data_length := 64;
+        decode_length(frame_bulk.data_length, frame_bulk.dlc);
+        decode_dlc_rx_buff(frame_bulk.dlc, frame_bulk.rwcnt);
+
+        get_rx_buf_state(rx_buf_info, DUT_NODE, chn);
+        in_rx_buf := 0;
+        while (in_rx_buf + frame_bulk.rwcnt + 1 <= rx_buf_info.rx_buff_size) loop
+            CAN_send_frame(frame_bulk, 1, TEST_NODE, chn, frame_sent);
+            CAN_wait_frame_sent(DUT_NODE, chn);
+            in_rx_buf := in_rx_buf + frame_bulk.rwcnt + 1;
+        end loop;
+
+        -- This one does not fit
+        CAN_send_frame(frame_bulk, 1, TEST_NODE, chn, frame_sent);
+        CAN_wait_frame_sent(DUT_NODE, chn);
+        CAN_wait_bus_idle(DUT_NODE, chn);
+        CAN_wait_bus_idle(TEST_NODE, chn);
+
+        get_controller_status(status, DUT_NODE, chn);
+        check_m(status.data_overrun, "RX Buffer overrun");
+        get_rx_buf_state(rx_buf_info, DUT_NODE, chn);
+        rx_frame_count := rx_buf_info.rx_frame_count;
+        check_m(rx_buf_info.rx_mem_free < frame_bulk.rwcnt + 1,
+                "RX Buffer full");
+
+        r_data := (OTHERS => '0');
+        r_data(RPRA_IND) := '1';
+        CAN_write(r_data, RXP_CTRL_ADR, DUT_NODE, chn);
+
+        frame_prio.identifier := 7;
+        CAN_send_frame(frame_prio, 1, TEST_NODE, chn, frame_sent);
+        CAN_wait_frame_sent(DUT_NODE, chn);
+        CAN_wait_bus_idle(DUT_NODE, chn);
+
+        check_rxp_frame_count(1, chn);
+        read_rxp_frame(frame_rx, chn);
+        CAN_compare_frames(frame_rx, frame_prio, false, outcome);
+        check_m(outcome, "Frame read from Priority RX Buffer during overrun");
+        check_rxp_frame_count(0, chn);
+
+        get_rx_buf_state(rx_buf_info, DUT_NODE, chn);
+        check_m(rx_buf_info.rx_frame_count = rx_frame_count,
+                "Routed frame not stored to RX Buffer");
+
+        command.release_rec_buffer := true;
+        command.clear_data_overrun := true;
+        give_controller_command(command, DUT_NODE, chn);
+
+  end procedure;
+
+end package body;
@@ -0,0 +1,248 @@
+--------------------------------------------------------------------------------
+-- 
+-- CTU CAN FD IP Core 
+-- Copyright (C) 2021-present Ondrej Ille
+-- 
+-- Permission is hereby granted, free of charge, to any person obtaining a copy
+-- of this VHDL component and associated documentation files (the "Component"),
+-- to use, copy, modify, merge, publish, distribute the Component for
+-- educational, research, evaluation, self-interest purposes. Using the
+-- Component for commercial purposes is forbidden unless previously agreed with
+-- Copyright holder.
+-- 
+-- The above copyright notice and this permission notice shall be included in
+-- all copies or substantial portions of the Component.
+-- 
+-- THE COMPONENT IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+-- IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+-- FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+-- AUTHORS OR COPYRIGHTHOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+-- LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+-- FROM, OUT OF OR IN CONNECTION WITH THE COMPONENT OR THE USE OR OTHER DEALINGS
+-- IN THE COMPONENT.
+-- 
+-- The CAN protocol is developed by Robert Bosch GmbH and protected by patents.
+-- Anybody who wants to implement this IP core on silicon has to obtain a CAN
+-- protocol license from Bosch.
+-- 
+-- -------------------------------------------------------------------------------
+-- 
+-- CTU CAN FD IP Core 
+-- Copyright (C) 2015-2020 MIT License
+-- 
+-- Authors:
+--     Ondrej Ille <ondrej.ille@gmail.com>
+--     Martin Jerabek <martin.jerabek01@gmail.com>
+-- 
+-- Project advisors: 
+-- 	Jiri Novak <jnovak@fel.cvut.cz>
+-- 	Pavel Pisa <pisa@cmp.felk.cvut.cz>
+-- 
+-- Department of Measurement         (http://meas.fel.cvut.cz/)
+-- Faculty of Electrical Engineering (http://www.fel.cvut.cz)
+-- Czech Technical University        (http://www.cvut.cz/)
+-- 
+-- Permission is hereby granted, free of charge, to any person obtaining a copy
+-- of this VHDL component and associated documentation files (the "Component"),
+-- to deal in the Component without restriction, including without limitation
+-- the rights to use, copy, modify, merge, publish, distribute, sublicense,
+-- and/or sell copies of the Component, and to permit persons to whom the
+-- Component is furnished to do so, subject to the following conditions:
+-- 
+-- The above copyright notice and this permission notice shall be included in
+-- all copies or substantial portions of the Component.
+-- 
+-- THE COMPONENT IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+-- IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+-- FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+-- AUTHORS OR COPYRIGHTHOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+-- LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+-- FROM, OUT OF OR IN CONNECTION WITH THE COMPONENT OR THE USE OR OTHER DEALINGS
+-- IN THE COMPONENT.
+-- 
+-- The CAN protocol is developed by Robert Bosch GmbH and protected by patents.
+-- Anybody who wants to implement this IP core on silicon has to obtain a CAN
+-- protocol license from Bosch.
+-- 
+--------------------------------------------------------------------------------
+
+--------------------------------------------------------------------------------
+-- @TestInfoStart
+--
+-- @Purpose:
+--  RX Settings Overflow policy feature test.
+--
+-- @Verifies:
+--  @1. When RX_SETTINGS[ROVP] = DROP_OLD, receiving a frame into full RX
+--      Buffer discards the oldest stored frame(s) instead of the new frame.
+--  @2. Data overrun flag is not set when oldest frames are discarded.
+--  @3. RX_DROP_CTR counts discarded frames.
+--  @4. COMMAND[RXDCRST] clears RX_DROP_CTR.
+--
+-- @Test sequence:
+--  @1. Configure RX_SETTINGS[ROVP] = DROP_OLD in DUT and clear RX_DROP_CTR.
+--      Read size of RX Buffer in DUT. Send number of RTR CAN frames (4 words
+--      in RX Buffer) with incrementing identifiers which exactly fill RX
+--      Buffer by Test node.
+--  @2. Check that RX Buffer is full, DOR flag is not set and RX_DROP_CTR is
+--      zero.
+--  @3. Send two more RTR frames by Test node. Check that RX Buffer is still
+--      full, DOR flag is not set, frame count did not change and RX_DROP_CTR
+--      is equal to 2.
+--  @4. Read all frames from RX Buffer and check that identifiers start with
+--      identifier of third sent frame and that they are sequential.
+--  @5. Issue COMMAND[RXDCRST] and check that RX_DROP_CTR is zero. Configure
+--      RX_SETTINGS[ROVP] = DROP_NEW.
+--
+-- @TestInfoEnd
+--------------------------------------------------------------------------------
+-- Revision History:
+--    19.10.2026   Created file
+--------------------------------------------------------------------------------
+
+Library ctu_can_fd_tb;
+context ctu_can_fd_tb.ieee_context;
+context ctu_can_fd_tb.rtl_context;
+context ctu_can_fd_tb.tb_common_context;
+
+use ctu_can_fd_tb.feature_test_agent_pkg.all;
+
+package rx_settings_rovp_ftest is
+    procedure rx_settings_rovp_ftest_exec(
+        signal      chn             : inout  t_com_channel
+    );
+end package;
+
+
+package body rx_settings_rovp_ftest is
+    procedure rx_settings_rovp_ftest_exec(
+        signal      chn             : inout  t_com_channel
+    ) is
+        -- Generated frames
+        variable frame_1            :     SW_CAN_frame_type;
+        variable frame_rx           :     SW_CAN_frame_type;
+
+        -- Node status
+        variable stat_1             :     SW_status;
+
+        variable rx_buf_info        :     SW_RX_Buffer_info;
+        variable rx_options         :     SW_RX_Buffer_options;
+        variable command            :     SW_command := SW_command_rst_val;
+
+        variable num_frames         :     natural;
+        variable frame_count        :     natural;
+        variable r_data             :     std_logic_vector(31 downto 0);
+        variable frame_sent         :     boolean;
+    begin
+
+        -----------------------------------------------------------------------
+        -- @1. Configure RX_SETTINGS[ROVP] = DROP_OLD in DUT and clear
+        --     RX_DROP_CTR. Read size of RX Buffer in DUT. Send number of RTR
+        --     CAN frames (4 words in RX Buffer) with incrementing identifiers
+        --     which exactly fill RX Buffer by Test node.
+        -----------------------------------------------------------------------
+        info_m("Step 1");
+
+        rx_options.rx_time_stamp_options := false;
+        rx_options.rx_drop_oldest := true;
+        set_rx_buf_options(rx_options, DUT_NODE, chn);
+
+        command.rx_drop_ctr_rst := true;
+        give_controller_command(command, DUT_NODE, chn);
+
+        get_rx_buf_state(rx_buf_info, DUT_NODE, chn);
+        num_frames := rx_buf_info.rx_buff_size / 4;
+        info_m("Sending " & integer'image(num_frames + 2) & " RTR frames");
+
+        CAN_generate_frame(frame_1);
+        frame_1.rtr := RTR_FRAME;
+        frame_1.frame_format := NORMAL_CAN;
+        frame_1.ident_type := BASE;
+
+        for i in 0 to num_frames - 1 loop
+            frame_1.identifier := i;
+            CAN_send_frame(frame_1, 1, TEST_NODE, chn, frame_sent);
+            CAN_wait_frame_sent(TEST_NODE, chn);
+        end loop;
+
+        CAN_wait_bus_idle(DUT_NODE, chn);
+        CAN_wait_bus_idle(TEST_NODE, chn);
+
+        -----------------------------------------------------------------------
+        -- @2. Check that RX Buffer is full, DOR flag is not set and
+        --     RX_DROP_CTR is zero.
+        -----------------------------------------------------------------------
+        info_m("Step 2");
+
+        get_rx_buf_state(rx_buf_info, DUT_NODE, chn);
+        check_m(rx_buf_info.rx_full, "RX full set");
+        frame_count := rx_buf_info.rx_frame_count;
+
+        get_controller_status(stat_1, DUT_NODE, chn);
+        check_false_m(stat_1.data_overrun, "DOR flag not set!");
+
+        CAN_read(r_data, RX_DROP_CTR_ADR, DUT_NODE, chn);
+        check_m(unsigned(r_data) = 0, "RX_DROP_CTR = 0");
+
+        -----------------------------------------------------------------------
+        -- @3. Send two more RTR frames by Test node. Check that RX Buffer is
+        --     still full, DOR flag is not set, frame count did not change and
+        --     RX_DROP_CTR is equal to 2.
+        -----------------------------------------------------------------------
+        info_m("Step 3");
+
+        for i in num_frames to num_frames + 1 loop
+            frame_1.identifier := i;
+            CAN_send_frame(frame_1, 1, TEST_NODE, chn, frame_sent);
+            CAN_wait_frame_sent(TEST_NODE, chn);
+        end loop;
+
+        CAN_wait_bus_idle(DUT_NODE, chn);
+        CAN_wait_bus_idle(TEST_NODE, chn);
+
+        get_rx_buf_state(rx_buf_info, DUT_NODE, chn);
+        check_m(rx_buf_info.rx_full, "RX full set");
+        check_m(rx_buf_info.rx_frame_count = frame_count,
+                "RX frame count unchanged");
+
+        get_controller_status(stat_1, DUT_NODE, chn);
+        check_false_m(stat_1.data_overrun, "DOR flag not set!");
+
+        CAN_read(r_data, RX_DROP_CTR_ADR, DUT_NODE, chn);
+        check_m(unsigned(r_data) = 2, "RX_DROP_CTR = 2");
+
+        -----------------------------------------------------------------------
+        -- @4. Read all frames from RX Buffer and check that identifiers start
+        --     with identifier of third sent frame and that they are
+        --     sequential.
+        -----------------------------------------------------------------------
+        info_m("Step 4");
+
+        for i in 0 to frame_count - 1 loop
+            CAN_read_frame(frame_rx, DUT_NODE, chn);
+            check_m(frame_rx.identifier = i + 2,
+                    "Frame " & integer'image(i) & " ID: " &
+                    integer'image(frame_rx.identifier));
+        end loop;
+
+        get_rx_buf_state(rx_buf_info, DUT_NODE, chn);
+        check_m(rx_buf_info.rx_empty, "RX Buffer empty");
+
+        -----------------------------------------------------------------------
+        -- @5. Issue COMMAND[RXDCRST] and check that RX_DROP_CTR is zero.
+        --     Configure RX_SETTINGS[ROVP] = DROP_NEW.
+        -----------------------------------------------------------------------
+        info_m("Step 5");
+
+        command.rx_drop_ctr_rst := true;
+        give_controller_command(command, DUT_NODE, chn);
+
+        CAN_read(r_data, RX_DROP_CTR_ADR, DUT_NODE, chn);
+        check_m(unsigned(r_data) = 0, "RX_DROP_CTR cleared");
+
+        rx_options.rx_drop_oldest := false;
+        set_rx_buf_options(rx_options, DUT_NODE, chn);
+
+  end procedure;
+
+end package body;
@@ -0,0 +1,264 @@
+--------------------------------------------------------------------------------
+-- 
+-- CTU CAN FD IP Core 
+-- Copyright (C) 2021-present Ondrej Ille
+-- 
+-- Permission is hereby granted, free of charge, to any person obtaining a copy
+-- of this VHDL component and associated documentation files (the "Component"),
+-- to use, copy, modify, merge, publish, distribute the Component for
+-- educational, research, evaluation, self-interest purposes. Using the
+-- Component for commercial purposes is forbidden unless previously agreed with
+-- Copyright holder.
+-- 
+-- The above copyright notice and this permission notice shall be included in
+-- all copies or substantial portions of the Component.
+-- 
+-- THE COMPONENT IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+-- IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+-- FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+-- AUTHORS OR COPYRIGHTHOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+-- LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+-- FROM, OUT OF OR IN CONNECTION WITH THE COMPONENT OR THE USE OR OTHER DEALINGS
+-- IN THE COMPONENT.
+-- 
+-- The CAN protocol is developed by Robert Bosch GmbH and protected by patents.
+-- Anybody who wants to implement this IP core on silicon has to obtain a CAN
+-- protocol license from Bosch.
+-- 
+-- -------------------------------------------------------------------------------
+-- 
+-- CTU CAN FD IP Core 
+-- Copyright (C) 2015-2020 MIT License
+-- 
+-- Authors:
+--     Ondrej Ille <ondrej.ille@gmail.com>
+--     Martin Jerabek <martin.jerabek01@gmail.com>
+-- 
+-- Project advisors: 
+-- 	Jiri Novak <jnovak@fel.cvut.cz>
+-- 	Pavel Pisa <pisa@cmp.felk.cvut.cz>
+-- 
+-- Department of Measurement         (http://meas.fel.cvut.cz/)
+-- Faculty of Electrical Engineering (http://www.fel.cvut.cz)
+-- Czech Technical University        (http://www.cvut.cz/)
+-- 
+-- Permission is hereby granted, free of charge, to any person obtaining a copy
+-- of this VHDL component and associated documentation files (the "Component"),
+-- to deal in the Component without restriction, including without limitation
+-- the rights to use, copy, modify, merge, publish, distribute, sublicense,
+-- and/or sell copies of the Component, and to permit persons to whom the
+-- Component is furnished to do so, subject to the following conditions:
+-- 
+-- The above copyright notice and this permission notice shall be included in
+-- all copies or substantial portions of the Component.
+-- 
+-- THE COMPONENT IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+-- IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+-- FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+-- AUTHORS OR COPYRIGHTHOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+-- LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+-- FROM, OUT OF OR IN CONNECTION WITH THE COMPONENT OR THE USE OR OTHER DEALINGS
+-- IN THE COMPONENT.
+-- 
+-- The CAN protocol is developed by Robert Bosch GmbH and protected by patents.
+-- Anybody who wants to implement this IP core on silicon has to obtain a CAN
+-- protocol license from Bosch.
+-- 
+--------------------------------------------------------------------------------
+
+--------------------------------------------------------------------------------
+-- @TestInfoStart
+--
+-- @Purpose:
+--  RX Settings Timestamp at both SOF and EOF feature test.
+--
+-- @Verifies:
+--  @1. RX frame with RX_SETTINGS[RTSB] = 1 contains timestamp captured in
+--      sample point of SOF and EOF.
+--  @2. RWCNT of RX frame with RX_SETTINGS[RTSB] = 1 is increased by two and
+--      FRAME_FORMAT_W[ETS] is set.
+--  @3. TXTB_TS_LOW / TXTB_TS_HIGH contain timestamp at start of transmission
+--      from TXT Buffer selected by TXTB_TS_SEL.
+--
+-- @Test sequence:
+--  @1. Force random timestamp and configure RX_SETTINGS[RTSB] = 1 in DUT.
+--      Generate CAN frame and send it by Test node. Poll until DUT becomes
+--      receiver and capture timestamp. Wait until EOF, and capture timestamp
+--      at its sample point. Wait till bus is idle, read the frame from DUT
+--      and check that both timestamps in the frame match captured ones.
+--      Check that RWCNT is increased by two and FRAME_FORMAT_W[ETS] is set.
+--  @2. Configure RX_SETTINGS[RTSB] = 0. Send frame by Test node, read it by
+--      DUT and check that FRAME_FORMAT_W[ETS] is not set and RWCNT matches
+--      DLC.
+--  @3. If STATUS[STXTS] is set, send frame by DUT from TXT Buffer 1. Capture
+--      timestamp when DUT becomes transmitter, wait till bus is idle and
+--      check that timestamp read via TXTB_TS_LOW / TXTB_TS_HIGH for TXT
+--      Buffer 1 is not higher than captured timestamp.
+--
+-- @TestInfoEnd
+--------------------------------------------------------------------------------
+-- Revision History:
+--    19.10.2026   Created file
+--------------------------------------------------------------------------------
+
+Library ctu_can_fd_tb;
+context ctu_can_fd_tb.ieee_context;
+context ctu_can_fd_tb.rtl_context;
+context ctu_can_fd_tb.tb_common_context;
+
+use ctu_can_fd_tb.feature_test_agent_pkg.all;
+use ctu_can_fd_tb.timestamp_agent_pkg.all;
+
+package rx_settings_rtsb_ftest is
+    procedure rx_settings_rtsb_ftest_exec(
+        signal      chn             : inout  t_com_channel
+    );
+end package;
+
+
+package body rx_settings_rtsb_ftest is
+    procedure rx_settings_rtsb_ftest_exec(
+        signal      chn             : inout  t_com_channel
+    ) is
+        variable CAN_TX_frame       :        SW_CAN_frame_type;
+        variable CAN_RX_frame       :        SW_CAN_frame_type;
+        variable frame_sent         :        boolean := false;
+        variable rx_options         :        SW_RX_Buffer_options;
+        variable diff               :        unsigned(63 downto 0);
+        variable exp_rwcnt          :        natural;
+        variable r_data             :        std_logic_vector(31 downto 0);
+
+        variable rand_ts            :        std_logic_vector(63 downto 0);
+        variable capt_ts_sof        :        std_logic_vector(63 downto 0);
+        variable capt_ts_eof        :        std_logic_vector(63 downto 0);
+        variable capt_ts            :        std_logic_vector(63 downto 0);
+        variable txtb_ts            :        std_logic_vector(63 downto 0);
+    begin
+
+        -----------------------------------------------------------------------
+        -- @1. Force random timestamp and configure RX_SETTINGS[RTSB] = 1 in
+        --     DUT. Generate CAN frame and send it by Test node. Poll until DUT
+        --     becomes receiver and capture timestamp. Wait until EOF, and
+        --     capture timestamp at its sample point. Wait till bus is idle,
+        --     read the frame from DUT and check that both timestamps in the
+        --     frame match captured ones. Check that RWCNT is increased by two
+        --     and FRAME_FORMAT_W[ETS] is set.
+        -----------------------------------------------------------------------
+        info_m("Step 1");
+
+        -- Keep highest bits 0 to avoid overflow during the test!
+        rand_logic_vect_v(rand_ts, 0.5);
+        rand_ts(63) := '0';
+        rand_ts(31) := '0';
+        ftr_tb_set_timestamp(rand_ts, chn);
+        info_m("Forcing start timestamp in DUT to: " & to_hstring(rand_ts));
+
+        rx_options.rx_time_stamp_options := true;
+        rx_options.rx_time_stamp_both := true;
+        set_rx_buf_options(rx_options, DUT_NODE, chn);
+
+        CAN_generate_frame(CAN_TX_frame);
+        CAN_send_frame(CAN_TX_frame, 1, TEST_NODE, chn, frame_sent);
+
+        CAN_wait_tx_rx_start(false, true, DUT_NODE, chn);
+        timestamp_agent_get_timestamp(chn, capt_ts_sof);
+
+        CAN_wait_pc_state(pc_deb_eof, DUT_NODE, chn);
+        for i in 0 to 5 loop
+            CAN_wait_sample_point(DUT_NODE, chn, false);
+        end loop;
+        timestamp_agent_get_timestamp(chn, capt_ts_eof);
+
+        CAN_wait_bus_idle(DUT_NODE, chn);
+        CAN_wait_bus_idle(TEST_NODE, chn);
+
+        CAN_read_frame(CAN_RX_frame, DUT_NODE, chn);
+
+        if (CAN_RX_frame.timestamp > capt_ts_sof) then
+            diff := unsigned(CAN_RX_frame.timestamp) - unsigned(capt_ts_sof);
+        else
+            diff := unsigned(capt_ts_sof) - unsigned(CAN_RX_frame.timestamp);
+        end if;
+        check_m(diff <= 3, "Timestamp at SOF. " &
+                         " Expected: " & to_hstring(capt_ts_sof) &
+                         " Measured: " & to_hstring(CAN_RX_frame.timestamp) &
+                         " Difference: " & to_hstring(diff));
+
+        if (CAN_RX_frame.eof_timestamp > capt_ts_eof) then
+            diff := unsigned(CAN_RX_frame.eof_timestamp) - unsigned(capt_ts_eof);
+        else
+            diff := unsigned(capt_ts_eof) - unsigned(CAN_RX_frame.eof_timestamp);
+        end if;
+        check_m(diff <= 3, "Timestamp at EOF. " &
+                         " Expected: " & to_hstring(capt_ts_eof) &
+                         " Measured: " & to_hstring(CAN_RX_frame.eof_timestamp) &
+                         " Difference: " & to_hstring(diff));
+
+        decode_dlc_rx_buff(CAN_TX_frame.dlc, exp_rwcnt);
+        check_m(CAN_RX_frame.rwcnt = exp_rwcnt + 2,
+                "RWCNT with both timestamps. Expected: " &
+                integer'image(exp_rwcnt + 2) & " Measured: " &
+                integer'image(CAN_RX_frame.rwcnt));
+
+        -----------------------------------------------------------------------
+        -- @2. Configure RX_SETTINGS[RTSB] = 0. Send frame by Test node, read
+        --     it by DUT and check that FRAME_FORMAT_W[ETS] is not set and
+        --     RWCNT matches DLC.
+        -----------------------------------------------------------------------
+        info_m("Step 2");
+
+        rx_options.rx_time_stamp_both := false;
+        set_rx_buf_options(rx_options, DUT_NODE, chn);
+
+        CAN_generate_frame(CAN_TX_frame);
+        CAN_send_frame(CAN_TX_frame, 1, TEST_NODE, chn, frame_sent);
+        CAN_wait_frame_sent(DUT_NODE, chn);
+        CAN_wait_bus_idle(DUT_NODE, chn);
+
+        CAN_read_frame(CAN_RX_frame, DUT_NODE, chn);
+
+        check_m(CAN_RX_frame.eof_timestamp = CAN_RX_frame.timestamp,
+                "No EOF timestamp stored when RTSB = 0");
+        decode_dlc_rx_buff(CAN_TX_frame.dlc, exp_rwcnt);
+        check_m(CAN_RX_frame.rwcnt = exp_rwcnt,
+                "RWCNT without EOF timestamp. Expected: " &
+                integer'image(exp_rwcnt) & " Measured: " &
+                integer'image(CAN_RX_frame.rwcnt));
+
+        -----------------------------------------------------------------------
+        -- @3. If STATUS[STXTS] is set, send frame by DUT from TXT Buffer 1.
+        --     Capture timestamp when DUT becomes transmitter, wait till bus
+        --     is idle and check that timestamp read via TXTB_TS_LOW /
+        --     TXTB_TS_HIGH for TXT Buffer 1 is not higher than captured
+        --     timestamp.
+        -----------------------------------------------------------------------
+        info_m("Step 3");
+
+        CAN_read(r_data, STATUS_ADR, DUT_NODE, chn);
+        if (r_data(STXTS_IND) = '0') then
+            info_m("TXT Buffer timestamps not supported, skipping!");
+            return;
+        end if;
+
+        CAN_generate_frame(CAN_TX_frame);
+        CAN_send_frame(CAN_TX_frame, 1, DUT_NODE, chn, frame_sent);
+        CAN_wait_tx_rx_start(true, false, DUT_NODE, chn);
+        timestamp_agent_get_timestamp(chn, capt_ts);
+
+        CAN_wait_bus_idle(DUT_NODE, chn);
+        CAN_wait_bus_idle(TEST_NODE, chn);
+
+        read_txtb_ts(txtb_ts, 1, DUT_NODE, chn);
+
+        check_m(unsigned(txtb_ts) <= unsigned(capt_ts),
+                "TXT Buffer timestamp not after start of transmission." &
+                " Captured: " & to_hstring(capt_ts) &
+                " Read: " & to_hstring(txtb_ts));
+        check_m(unsigned(txtb_ts) >= unsigned(rand_ts),
+                "TXT Buffer timestamp captured during test." &
+                " Start: " & to_hstring(rand_ts) &
+                " Read: " & to_hstring(txtb_ts));
+
+    end procedure;
+
+end package body;
@@ -74,17 +74,26 @@
 --
 -- @Verifies:
 --  @1. TIMESTAMP_LOW and TIMESTAMP_HIGH registers functionality.
+--  @2. Read of TIMESTAMP_LOW latches TIMESTAMP_HIGH, so that overflow of lower
+--      timestamp word between read of TIMESTAMP_LOW and TIMESTAMP_HIGH does
+--      not corrupt read timestamp.
 --
 -- @Test sequence:
 --  @1. Preset Timestamp value in TB. Read values from TIMESTAMP_LOW and
 --      TIMESTAMP_HIGH registers. Check read value matches value which was
 --      preset.
+--  @2. Preset Timestamp in TB shortly before overflow of its lower word. Read
+--      TIMESTAMP_LOW and TIMESTAMP_HIGH and check read value is consistent
+--      with Timestamp in TB. Repeat with preset moved further from overflow,
+--      so that in some iterations overflow occurs between read of
+--      TIMESTAMP_LOW and TIMESTAMP_HIGH. Check this has occured.
 --
 -- @TestInfoEnd
 --------------------------------------------------------------------------------
 -- Revision History:
 --    29.6.2018     Created file
 --   22.11.2019     Add support for timestamp randomization! 
+--   19.10.2026     Add check of TIMESTAMP_HIGH latching.
 --------------------------------------------------------------------------------
 
 Library ctu_can_fd_tb;
@@ -112,6 +121,8 @@ package body timestamp_low_high_ftest is
         variable ts_read            :        std_logic_vector(63 downto 0);
         
         variable ts_rand            :        std_logic_vector(63 downto 0);
+        variable ts_preset          :        std_logic_vector(63 downto 0);
+        variable overflow_cnt       :        natural := 0;
     begin
 
         -----------------------------------------------------------------------
@@ -167,6 +178,43 @@ package body timestamp_low_high_ftest is
 
         end loop;
 
+        -----------------------------------------------------------------------
+        -- @2. Preset Timestamp in TB shortly before overflow of its lower
+        --     word. Read TIMESTAMP_LOW and TIMESTAMP_HIGH and check read value
+        --     is consistent with Timestamp in TB. Repeat with preset moved
+        --     further from overflow, so that in some iterations overflow
+        --     occurs between read of TIMESTAMP_LOW and TIMESTAMP_HIGH. Check
+        --     this has occured.
+        -----------------------------------------------------------------------
+        info_m("Step 2");
+
+        for i in 0 to 127 loop
+            ts_preset := ts_rand(63 downto 32) & std_logic_vector(
+                            unsigned'(x"FFFFFFFF") - to_unsigned(2 * i, 32));
+            ftr_tb_set_timestamp(ts_preset, chn);
+
+            CAN_read_timestamp(ts_read, DUT_NODE, chn);
+            timestamp_agent_get_timestamp(chn, ts_input);
+
+            -- Without latching, overflow between reads makes read value
+            -- 2^32 bigger than actual timestamp.
+            check_m(unsigned(ts_read) <= unsigned(ts_input) and
+                    unsigned(ts_input) - unsigned(ts_read) < 100,
+                    "Timestamp read: 0x" & to_hstring(ts_read) &
+                    " inconsistent with timestamp input: 0x" &
+                    to_hstring(ts_input));
+
+            if (ts_read(63 downto 32) = ts_preset(63 downto 32) and
+                ts_input(63 downto 32) /= ts_preset(63 downto 32))
+            then
+                overflow_cnt := overflow_cnt + 1;
+            end if;
+        end loop;
+
+        info_m("Overflows during timestamp read: " & integer'image(overflow_cnt));
+        check_m(overflow_cnt > 0,
+                "Overflow between TIMESTAMP_LOW and TIMESTAMP_HIGH read occured");
+
     end procedure;
 
 end package body;
@@ -0,0 +1,278 @@
+--------------------------------------------------------------------------------
+-- 
+-- CTU CAN FD IP Core 
+-- Copyright (C) 2021-present Ondrej Ille
+-- 
+-- Permission is hereby granted, free of charge, to any person obtaining a copy
+-- of this VHDL component and associated documentation files (the "Component"),
+-- to use, copy, modify, merge, publish, distribute the Component for
+-- educational, research, evaluation, self-interest purposes. Using the
+-- Component for commercial purposes is forbidden unless previously agreed with
+-- Copyright holder.
+-- 
+-- The above copyright notice and this permission notice shall be included in
+-- all copies or substantial portions of the Component.
+-- 
+-- THE COMPONENT IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+-- IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+-- FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+-- AUTHORS OR COPYRIGHTHOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+-- LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+-- FROM, OUT OF OR IN CONNECTION WITH THE COMPONENT OR THE USE OR OTHER DEALINGS
+-- IN THE COMPONENT.
+-- 
+-- The CAN protocol is developed by Robert Bosch GmbH and protected by patents.
+-- Anybody who wants to implement this IP core on silicon has to obtain a CAN
+-- protocol license from Bosch.
+-- 
+-- -------------------------------------------------------------------------------
+-- 
+-- CTU CAN FD IP Core 
+-- Copyright (C) 2015-2020 MIT License
+-- 
+-- Authors:
+--     Ondrej Ille <ondrej.ille@gmail.com>
+--     Martin Jerabek <martin.jerabek01@gmail.com>
+-- 
+-- Project advisors: 
+-- 	Jiri Novak <jnovak@fel.cvut.cz>
+-- 	Pavel Pisa <pisa@cmp.felk.cvut.cz>
+-- 
+-- Department of Measurement         (http://meas.fel.cvut.cz/)
+-- Faculty of Electrical Engineering (http://www.fel.cvut.cz)
+-- Czech Technical University        (http://www.cvut.cz/)
+-- 
+-- Permission is hereby granted, free of charge, to any person obtaining a copy
+-- of this VHDL component and associated documentation files (the "Component"),
+-- to deal in the Component without restriction, including without limitation
+-- the rights to use, copy, modify, merge, publish, distribute, sublicense,
+-- and/or sell copies of the Component, and to permit persons to whom the
+-- Component is furnished to do so, subject to the following conditions:
+-- 
+-- The above copyright notice and this permission notice shall be included in
+-- all copies or substantial portions of the Component.
+-- 
+-- THE COMPONENT IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+-- IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+-- FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+-- AUTHORS OR COPYRIGHTHOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+-- LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+-- FROM, OUT OF OR IN CONNECTION WITH THE COMPONENT OR THE USE OR OTHER DEALINGS
+-- IN THE COMPONENT.
+-- 
+-- The CAN protocol is developed by Robert Bosch GmbH and protected by patents.
+-- Anybody who wants to implement this IP core on silicon has to obtain a CAN
+-- protocol license from Bosch.
+-- 
+
+--------------------------------------------------------------------------------
+-- @TestInfoStart
+--
+-- @Purpose:
+--  Timestamp generator feature test.
+--
+-- @Verifies:
+--  @1. TS_INC is 1.0 after reset.
+--  @2. COMMAND[TSSET] loads value of TS_STEP_LOW and TS_STEP_HIGH to
+--      timestamp generator.
+--  @3. Rate of timestamp generator is given by TS_INC including its
+--      fractional part.
+--  @4. COMMAND[TSSTEP] adds value of TS_STEP_LOW and TS_STEP_HIGH (two's
+--      complement) to timestamp generator.
+--  @5. Timestamp of received frame is taken from timestamp generator.
+--
+-- @Test sequence:
+--  @1. Check STATUS[STSG], skip the test if it is not set. Check TS_INC is
+--      1.0.
+--  @2. Set TS_STEP to random value with lower word close to overflow, issue
+--      COMMAND[TSSET]. Read timestamp and check it is slightly above the
+--      value.
+--  @3. Measure timestamp increment over fixed time with TS_INC = 1.0. Set
+--      TS_INC = 2.5 and measure again. Check the second increment is 2.5
+--      times the first one.
+--  @4. Set TS_STEP to 2^32, issue COMMAND[TSSTEP] and check timestamp moved
+--      forward by 2^32. Set TS_STEP to -2^32, issue COMMAND[TSSTEP] and
+--      check timestamp moved back by 2^32.
+--  @5. Read timestamp, send random frame by Test node and read timestamp
+--      again. Read the frame from DUT and check its timestamp is between the
+--      two timestamps. Restore TS_INC to 1.0.
+--
+-- @TestInfoEnd
+--------------------------------------------------------------------------------
+-- Revision History:
+--    19.10.2026   Created file
+--------------------------------------------------------------------------------
+
+Library ctu_can_fd_tb;
+context ctu_can_fd_tb.ieee_context;
+context ctu_can_fd_tb.rtl_context;
+context ctu_can_fd_tb.tb_common_context;
+
+use ctu_can_fd_tb.feature_test_agent_pkg.all;
+
+package ts_gen_ftest is
+    procedure ts_gen_ftest_exec(
+        signal      chn             : inout  t_com_channel
+    );
+end package;
+
+
+package body ts_gen_ftest is
+    procedure ts_gen_ftest_exec(
+        signal      chn             : inout  t_com_channel
+    ) is
+        variable CAN_TX_frame       :     SW_CAN_frame_type;
+        variable CAN_RX_frame       :     SW_CAN_frame_type;
+        variable frame_sent         :     boolean;
+
+        variable r_data             :     std_logic_vector(31 downto 0);
+        variable ts_set             :     std_logic_vector(63 downto 0);
+        variable ts_1               :     std_logic_vector(63 downto 0);
+        variable ts_2               :     std_logic_vector(63 downto 0);
+        variable ts_3               :     std_logic_vector(63 downto 0);
+        variable rand_val           :     natural;
+        variable inc_1              :     natural;
+        variable inc_2              :     natural;
+
+        constant C_TS_INC_1_0       :     std_logic_vector(31 downto 0) :=
+                                          x"01000000";
+        constant C_TS_INC_2_5       :     std_logic_vector(31 downto 0) :=
+                                          x"02800000";
+        constant C_TS_2_POW_32      :     unsigned(63 downto 0) :=
+                                          x"0000000100000000";
+
+        -- Difference of two timestamps (ts_a - ts_b). Returns natural'high
+        -- when the difference is negative or too large.
+        function ts_diff(
+            constant ts_a           :       std_logic_vector(63 downto 0);
+            constant ts_b           :       std_logic_vector(63 downto 0)
+        ) return natural is
+            variable diff           :       unsigned(63 downto 0);
+        begin
+            diff := unsigned(ts_a) - unsigned(ts_b);
+            if (diff(63 downto 30) /= 0) then
+                return natural'high;
+            end if;
+            return to_integer(diff(29 downto 0));
+        end function;
+
+        -- Write value of TS_STEP_LOW and TS_STEP_HIGH and give command
+        procedure ts_gen_command(
+            constant value          : in    std_logic_vector(63 downto 0);
+            constant cmd_ind        : in    natural;
+            signal   chn            : inout t_com_channel
+        ) is
+            variable data           :       std_logic_vector(31 downto 0);
+        begin
+            CAN_write(value(31 downto 0), TS_STEP_LOW_ADR, DUT_NODE, chn);
+            CAN_write(value(63 downto 32), TS_STEP_HIGH_ADR, DUT_NODE, chn);
+            data := (OTHERS => '0');
+            data(cmd_ind) := '1';
+            CAN_write(data, COMMAND_ADR, DUT_NODE, chn);
+        end procedure;
+    begin
+
+        -----------------------------------------------------------------------
+        -- @1. Check STATUS[STSG], skip the test if it is not set. Check
+        --     TS_INC is 1.0.
+        -----------------------------------------------------------------------
+        info_m("Step 1");
+
+        CAN_read(r_data, STATUS_ADR, DUT_NODE, chn);
+        if (r_data(STSG_IND) = '0') then
+            info_m("Timestamp generator not supported, skipping!");
+            return;
+        end if;
+
+        CAN_read(r_data, TS_INC_ADR, DUT_NODE, chn);
+        check_m(r_data = C_TS_INC_1_0, "TS_INC reset value");
+
+        -----------------------------------------------------------------------
+        -- @2. Set TS_STEP to random value with lower word close to overflow,
+        --     issue COMMAND[TSSET]. Read timestamp and check it is slightly
+        --     above the value.
+        -----------------------------------------------------------------------
+        info_m("Step 2");
+
+        rand_int_v(2 ** 30, rand_val);
+        ts_set(63 downto 32) := std_logic_vector(to_unsigned(rand_val, 32));
+        ts_set(31 downto 0) := x"FFFFF000";
+        ts_gen_command(ts_set, TSSET_IND, chn);
+
+        CAN_read_timestamp(ts_1, DUT_NODE, chn);
+        check_m(ts_diff(ts_1, ts_set) < 1000,
+                "Timestamp set by COMMAND[TSSET]");
+
+        -----------------------------------------------------------------------
+        -- @3. Measure timestamp increment over fixed time with TS_INC = 1.0.
+        --     Set TS_INC = 2.5 and measure again. Check the second increment
+        --     is 2.5 times the first one.
+        -----------------------------------------------------------------------
+        info_m("Step 3");
+
+        CAN_read_timestamp(ts_1, DUT_NODE, chn);
+        wait for 10 us;
+        CAN_read_timestamp(ts_2, DUT_NODE, chn);
+        inc_1 := ts_diff(ts_2, ts_1);
+        check_m(inc_1 < 2 ** 20, "Timestamp increments");
+
+        CAN_write(C_TS_INC_2_5, TS_INC_ADR, DUT_NODE, chn);
+
+        CAN_read_timestamp(ts_1, DUT_NODE, chn);
+        wait for 10 us;
+        CAN_read_timestamp(ts_2, DUT_NODE, chn);
+        inc_2 := ts_diff(ts_2, ts_1);
+        check_m(inc_2 < 2 ** 20, "Timestamp increments");
+
+        info_m("Increment with TS_INC = 1.0: " & integer'image(inc_1));
+        info_m("Increment with TS_INC = 2.5: " & integer'image(inc_2));
+        if (inc_1 < 2 ** 20 and inc_2 < 2 ** 20) then
+            check_m(abs(2 * inc_2 - 5 * inc_1) <= 20,
+                    "Timestamp rate given by TS_INC");
+        end if;
+
+        -----------------------------------------------------------------------
+        -- @4. Set TS_STEP to 2^32, issue COMMAND[TSSTEP] and check timestamp
+        --     moved forward by 2^32. Set TS_STEP to -2^32, issue
+        --     COMMAND[TSSTEP] and check timestamp moved back by 2^32.
+        -----------------------------------------------------------------------
+        info_m("Step 4");
+
+        CAN_read_timestamp(ts_1, DUT_NODE, chn);
+        ts_gen_command(std_logic_vector(C_TS_2_POW_32), TSSTEP_IND, chn);
+        CAN_read_timestamp(ts_2, DUT_NODE, chn);
+        check_m(ts_diff(ts_2, std_logic_vector(unsigned(ts_1) +
+                                               C_TS_2_POW_32)) < 1000,
+                "Timestamp stepped forward");
+
+        ts_gen_command(std_logic_vector(0 - C_TS_2_POW_32), TSSTEP_IND, chn);
+        CAN_read_timestamp(ts_3, DUT_NODE, chn);
+        check_m(ts_diff(ts_3, std_logic_vector(unsigned(ts_2) -
+                                               C_TS_2_POW_32)) < 1000,
+                "Timestamp stepped back");
+
+        -----------------------------------------------------------------------
+        -- @5. Read timestamp, send random frame by Test node and read
+        --     timestamp again. Read the frame from DUT and check its
+        --     timestamp is between the two timestamps. Restore TS_INC to 1.0.
+        -----------------------------------------------------------------------
+        info_m("Step 5");
+
+        CAN_generate_frame(CAN_TX_frame);
+        CAN_read_timestamp(ts_1, DUT_NODE, chn);
+        CAN_send_frame(CAN_TX_frame, 1, TEST_NODE, chn, frame_sent);
+        CAN_wait_frame_sent(TEST_NODE, chn);
+        CAN_wait_bus_idle(DUT_NODE, chn);
+        CAN_read_timestamp(ts_2, DUT_NODE, chn);
+
+        CAN_read_frame(CAN_RX_frame, DUT_NODE, chn);
+        check_m(ts_diff(CAN_RX_frame.timestamp, ts_1) < natural'high,
+                "RX frame timestamp after timestamp before transmission");
+        check_m(ts_diff(ts_2, CAN_RX_frame.timestamp) < natural'high,
+                "RX frame timestamp before timestamp after reception");
+
+        CAN_write(C_TS_INC_1_0, TS_INC_ADR, DUT_NODE, chn);
+
+  end procedure;
+
+end package body;
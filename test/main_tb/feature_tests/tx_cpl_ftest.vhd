@@ -0,0 +1,322 @@
+--------------------------------------------------------------------------------
+-- 
+-- CTU CAN FD IP Core 
+-- Copyright (C) 2021-present Ondrej Ille
+-- 
+-- Permission is hereby granted, free of charge, to any person obtaining a copy
+-- of this VHDL component and associated documentation files (the "Component"),
+-- to use, copy, modify, merge, publish, distribute the Component for
+-- educational, research, evaluation, self-interest purposes. Using the
+-- Component for commercial purposes is forbidden unless previously agreed with
+-- Copyright holder.
+-- 
+-- The above copyright notice and this permission notice shall be included in
+-- all copies or substantial portions of the Component.
+-- 
+-- THE COMPONENT IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+-- IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+-- FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+-- AUTHORS OR COPYRIGHTHOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+-- LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+-- FROM, OUT OF OR IN CONNECTION WITH THE COMPONENT OR THE USE OR OTHER DEALINGS
+-- IN THE COMPONENT.
+-- 
+-- The CAN protocol is developed by Robert Bosch GmbH and protected by patents.
+-- Anybody who wants to implement this IP core on silicon has to obtain a CAN
+-- protocol license from Bosch.
+-- 
+-- -------------------------------------------------------------------------------
+-- 
+-- CTU CAN FD IP Core 
+-- Copyright (C) 2015-2020 MIT License
+-- 
+-- Authors:
+--     Ondrej Ille <ondrej.ille@gmail.com>
+--     Martin Jerabek <martin.jerabek01@gmail.com>
+-- 
+-- Project advisors: 
+-- 	Jiri Novak <jnovak@fel.cvut.cz>
+-- 	Pavel Pisa <pisa@cmp.felk.cvut.cz>
+-- 
+-- Department of Measurement         (http://meas.fel.cvut.cz/)
+-- Faculty of Electrical Engineering (http://www.fel.cvut.cz)
+-- Czech Technical University        (http://www.cvut.cz/)
+-- 
+-- Permission is hereby granted, free of charge, to any person obtaining a copy
+-- of this VHDL component and associated documentation files (the "Component"),
+-- to deal in the Component without restriction, including without limitation
+-- the rights to use, copy, modify, merge, publish, distribute, sublicense,
+-- and/or sell copies of the Component, and to permit persons to whom the
+-- Component is furnished to do so, subject to the following conditions:
+-- 
+-- The above copyright notice and this permission notice shall be included in
+-- all copies or substantial portions of the Component.
+-- 
+-- THE COMPONENT IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+-- IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+-- FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+-- AUTHORS OR COPYRIGHTHOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+-- LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+-- FROM, OUT OF OR IN CONNECTION WITH THE COMPONENT OR THE USE OR OTHER DEALINGS
+-- IN THE COMPONENT.
+-- 
+-- The CAN protocol is developed by Robert Bosch GmbH and protected by patents.
+-- Anybody who wants to implement this IP core on silicon has to obtain a CAN
+-- protocol license from Bosch.
+-- 
+
+--------------------------------------------------------------------------------
+-- @TestInfoStart
+--
+-- @Purpose:
+--  TX completion FIFO feature test.
+--
+-- @Verifies:
+--  @1. TX_CPL reads with TCV = 0 when TX completion FIFO is empty, and such
+--      read does not change TX completion FIFO.
+--  @2. Record is stored when TXT Buffer finishes transmission succesfully.
+--      Record contains index of TXT Buffer, TX OK state, zero retransmitt
+--      counter, and timestamp between start of transmission and the time
+--      the record is read. Reading TX_CPL removes the record.
+--  @3. Records of multiple TXT Buffers are read in order of completion and
+--      TCCNT gives number of stored records.
+--  @4. Record is stored when TXT Buffer fails due to retransmitt limit, with
+--      Failed state and non-zero retransmitt counter.
+--  @5. Record is stored when TXT Buffer is aborted.
+--
+-- @Test sequence:
+--  @1. Check STATUS[STCPL], skip the test if not set. Read TX_CPL twice, check
+--      TCV = 0 and TCCNT = 0.
+--  @2. Send frame by DUT from random TXT Buffer. Read TX_CPL_TS and TX_CPL,
+--      check the record. Check TX_CPL is empty afterwards.
+--  @3. Insert frames to all TXT Buffers and set them ready at once. Wait till
+--      all frames are sent. Read TX_CPL records, check TCCNT decrements, each
+--      record is TX OK and each TXT Buffer is reported once. Check order of
+--      records matches order of TX timestamps.
+--  @4. Set retransmitt limit to 1 in DUT and Acknowledge forbidden mode in
+--      Test node. Send frame by DUT, wait till it fails. Read TX_CPL and check
+--      the record is Failed with non-zero retransmitt counter.
+--  @5. Send frame by DUT and abort it. Wait till TXT Buffer is Aborted, read
+--      TX_CPL and check the record is Aborted.
+--
+-- @TestInfoEnd
+--------------------------------------------------------------------------------
+-- Revision History:
+--    19.10.2026   Created file
+--------------------------------------------------------------------------------
+
+Library ctu_can_fd_tb;
+context ctu_can_fd_tb.ieee_context;
+context ctu_can_fd_tb.rtl_context;
+context ctu_can_fd_tb.tb_common_context;
+
+use ctu_can_fd_tb.feature_test_agent_pkg.all;
+use ctu_can_fd_tb.timestamp_agent_pkg.all;
+
+package tx_cpl_ftest is
+    procedure tx_cpl_ftest_exec(
+        signal      chn             : inout  t_com_channel
+    );
+end package;
+
+
+package body tx_cpl_ftest is
+    procedure tx_cpl_ftest_exec(
+        signal      chn             : inout  t_com_channel
+    ) is
+        variable CAN_TX_frame       :        SW_CAN_frame_type;
+        variable frame_sent         :        boolean := false;
+        variable txt_state          :        SW_TXT_Buffer_state_type;
+        variable r_data             :        std_logic_vector(31 downto 0);
+        variable cpl_ts             :        std_logic_vector(31 downto 0);
+        variable ts_start           :        std_logic_vector(63 downto 0);
+        variable ts_now             :        std_logic_vector(63 downto 0);
+        variable prev_ts            :        std_logic_vector(63 downto 0);
+        variable num_buffers        :        natural range 1 to 8;
+        variable txt_buf_nr         :        natural range 1 to 8;
+        variable tmp_int            :        natural;
+        variable buf_vector         :        std_logic_vector(7 downto 0);
+        variable reported           :        std_logic_vector(7 downto 0);
+        variable mode_2             :        SW_mode := SW_mode_rst_val;
+
+        -- Read oldest record (TX_CPL_TS first, since TX_CPL removes it)
+        procedure read_cpl(
+            variable ts             : out   std_logic_vector(31 downto 0);
+            variable cpl            : out   std_logic_vector(31 downto 0);
+            signal   chn            : inout t_com_channel
+        ) is
+        begin
+            CAN_read(ts, TX_CPL_TS_ADR, DUT_NODE, chn);
+            CAN_read(cpl, TX_CPL_ADR, DUT_NODE, chn);
+        end procedure;
+
+        -- Check record is valid and belongs to TXT Buffer with given state
+        procedure check_cpl(
+            constant cpl            : in    std_logic_vector(31 downto 0);
+            constant buf_nr         : in    natural;
+            constant state          : in    std_logic_vector(3 downto 0)
+        ) is
+        begin
+            check_m(cpl(TCV_IND) = '1', "TX_CPL valid");
+            check_m(cpl(TCOF_IND) = '0', "TX_CPL no overflow");
+            check_m(to_integer(unsigned(cpl(TCIDX_H downto TCIDX_L))) = buf_nr - 1,
+                    "TX_CPL index: " &
+                    integer'image(to_integer(unsigned(cpl(TCIDX_H downto TCIDX_L)))) &
+                    " Expected: " & integer'image(buf_nr - 1));
+            check_m(cpl(TCST_H downto TCST_L) = state,
+                    "TX_CPL state: " & to_hstring(cpl(TCST_H downto TCST_L)) &
+                    " Expected: " & to_hstring(state));
+        end procedure;
+    begin
+
+        -----------------------------------------------------------------------
+        -- @1. Check STATUS[STCPL], skip the test if not set. Read TX_CPL twice,
+        --     check TCV = 0 and TCCNT = 0.
+        -----------------------------------------------------------------------
+        info_m("Step 1");
+
+        CAN_read(r_data, STATUS_ADR, DUT_NODE, chn);
+        if (r_data(STCPL_IND) = '0') then
+            info_m("TX completion FIFO not supported, skipping!");
+            return;
+        end if;
+
+        for i in 0 to 1 loop
+            CAN_read(r_data, TX_CPL_ADR, DUT_NODE, chn);
+            check_m(r_data(TCV_IND) = '0', "TX_CPL empty");
+            check_m(r_data(TCCNT_H downto TCCNT_L) = "00000", "TCCNT zero");
+        end loop;
+
+        get_tx_buf_count(num_buffers, DUT_NODE, chn);
+
+        -----------------------------------------------------------------------
+        -- @2. Send frame by DUT from random TXT Buffer. Read TX_CPL_TS and
+        --     TX_CPL, check the record. Check TX_CPL is empty afterwards.
+        -----------------------------------------------------------------------
+        info_m("Step 2");
+
+        rand_int_v(num_buffers, tmp_int);
+        txt_buf_nr := (tmp_int mod num_buffers) + 1;
+
+        CAN_generate_frame(CAN_TX_frame);
+        CAN_send_frame(CAN_TX_frame, txt_buf_nr, DUT_NODE, chn, frame_sent);
+        CAN_wait_frame_sent(DUT_NODE, chn);
+        CAN_wait_bus_idle(DUT_NODE, chn);
+
+        read_txtb_ts(ts_start, txt_buf_nr, DUT_NODE, chn);
+        read_cpl(cpl_ts, r_data, chn);
+        timestamp_agent_get_timestamp(chn, ts_now);
+
+        check_cpl(r_data, txt_buf_nr, TXT_TOK);
+        check_m(r_data(TCRC_H downto TCRC_L) = x"0", "TX_CPL no retransmission");
+        check_m(r_data(TCCNT_H downto TCCNT_L) = "00001", "TCCNT one record");
+        check_m(unsigned(cpl_ts) > unsigned(ts_start(31 downto 0)),
+                "TX_CPL_TS after start of transmission");
+        check_m(unsigned(cpl_ts) < unsigned(ts_now(31 downto 0)),
+                "TX_CPL_TS before read");
+
+        CAN_read(r_data, TX_CPL_ADR, DUT_NODE, chn);
+        check_m(r_data(TCV_IND) = '0', "TX_CPL empty after read");
+
+        -----------------------------------------------------------------------
+        -- @3. Insert frames to all TXT Buffers and set them ready at once. Wait
+        --     till all frames are sent. Read TX_CPL records, check TCCNT
+        --     decrements, each record is TX OK and each TXT Buffer is reported
+        --     once. Check order of records matches order of TX timestamps.
+        -----------------------------------------------------------------------
+        info_m("Step 3");
+
+        buf_vector := (OTHERS => '0');
+        for i in 1 to num_buffers loop
+            CAN_generate_frame(CAN_TX_frame);
+            CAN_insert_TX_frame(CAN_TX_frame, i, DUT_NODE, chn);
+            buf_vector(i - 1) := '1';
+        end loop;
+        send_TXT_buf_cmd(buf_set_ready, buf_vector, DUT_NODE, chn);
+
+        for i in 1 to num_buffers loop
+            CAN_wait_frame_sent(DUT_NODE, chn);
+        end loop;
+        CAN_wait_bus_idle(DUT_NODE, chn);
+
+        reported := (OTHERS => '0');
+        prev_ts := (OTHERS => '0');
+        for i in 0 to num_buffers - 1 loop
+            read_cpl(cpl_ts, r_data, chn);
+            tmp_int := to_integer(unsigned(r_data(TCIDX_H downto TCIDX_L)));
+            check_cpl(r_data, tmp_int + 1, TXT_TOK);
+            check_m(to_integer(unsigned(r_data(TCCNT_H downto TCCNT_L))) =
+                    num_buffers - i, "TCCNT decrements");
+            check_m(reported(tmp_int) = '0', "TXT Buffer reported once");
+            reported(tmp_int) := '1';
+
+            read_txtb_ts(ts_start, tmp_int + 1, DUT_NODE, chn);
+            check_m(unsigned(ts_start) > unsigned(prev_ts),
+                    "Records in order of transmission");
+            prev_ts := ts_start;
+        end loop;
+
+        CAN_read(r_data, TX_CPL_ADR, DUT_NODE, chn);
+        check_m(r_data(TCV_IND) = '0', "TX_CPL empty after all records");
+
+        -----------------------------------------------------------------------
+        -- @4. Set retransmitt limit to 1 in DUT and Acknowledge forbidden mode
+        --     in Test node. Send frame by DUT, wait till it fails. Read TX_CPL
+        --     and check the record is Failed with non-zero retransmitt counter.
+        -----------------------------------------------------------------------
+        info_m("Step 4");
+
+        CAN_enable_retr_limit(true, 1, DUT_NODE, chn);
+        mode_2.acknowledge_forbidden := true;
+        set_core_mode(mode_2, TEST_NODE, chn);
+
+        CAN_generate_frame(CAN_TX_frame);
+        CAN_send_frame(CAN_TX_frame, txt_buf_nr, DUT_NODE, chn, frame_sent);
+        for i in 0 to 1 loop
+            CAN_wait_error_frame(DUT_NODE, chn);
+            CAN_wait_pc_state(pc_deb_intermission, DUT_NODE, chn);
+        end loop;
+        CAN_wait_bus_idle(DUT_NODE, chn);
+
+        get_tx_buf_state(txt_buf_nr, txt_state, DUT_NODE, chn);
+        check_m(txt_state = buf_failed, "TXT Buffer failed");
+
+        read_cpl(cpl_ts, r_data, chn);
+        check_cpl(r_data, txt_buf_nr, TXT_ERR);
+        check_m(r_data(TCRC_H downto TCRC_L) /= x"0",
+                "TX_CPL retransmitt counter non-zero");
+
+        CAN_enable_retr_limit(false, 0, DUT_NODE, chn);
+        mode_2.acknowledge_forbidden := false;
+        set_core_mode(mode_2, TEST_NODE, chn);
+
+        -----------------------------------------------------------------------
+        -- @5. Send frame by DUT and abort it. Wait till TXT Buffer is Aborted,
+        --     read TX_CPL and check the record is Aborted.
+        -----------------------------------------------------------------------
+        info_m("Step 5");
+
+        CAN_generate_frame(CAN_TX_frame);
+        CAN_send_frame(CAN_TX_frame, txt_buf_nr, DUT_NODE, chn, frame_sent);
+        send_TXT_buf_cmd(buf_set_abort, txt_buf_nr, DUT_NODE, chn);
+
+        get_tx_buf_state(txt_buf_nr, txt_state, DUT_NODE, chn);
+        while (txt_state /= buf_aborted and txt_state /= buf_done) loop
+            get_tx_buf_state(txt_buf_nr, txt_state, DUT_NODE, chn);
+        end loop;
+        CAN_wait_bus_idle(DUT_NODE, chn);
+
+        read_cpl(cpl_ts, r_data, chn);
+        if (txt_state = buf_aborted) then
+            check_cpl(r_data, txt_buf_nr, TXT_ABT);
+        else
+            -- Abort came too late, frame was transmitted
+            check_cpl(r_data, txt_buf_nr, TXT_TOK);
+        end if;
+
+        CAN_read(r_data, TX_CPL_ADR, DUT_NODE, chn);
+        check_m(r_data(TCV_IND) = '0', "TX_CPL empty at the end");
+
+  end procedure;
+
+end package body;
@@ -0,0 +1,288 @@
+--------------------------------------------------------------------------------
+-- 
+-- CTU CAN FD IP Core 
+-- Copyright (C) 2021-present Ondrej Ille
+-- 
+-- Permission is hereby granted, free of charge, to any person obtaining a copy
+-- of this VHDL component and associated documentation files (the "Component"),
+-- to use, copy, modify, merge, publish, distribute the Component for
+-- educational, research, evaluation, self-interest purposes. Using the
+-- Component for commercial purposes is forbidden unless previously agreed with
+-- Copyright holder.
+-- 
+-- The above copyright notice and this permission notice shall be included in
+-- all copies or substantial portions of the Component.
+-- 
+-- THE COMPONENT IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+-- IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+-- FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+-- AUTHORS OR COPYRIGHTHOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+-- LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+-- FROM, OUT OF OR IN CONNECTION WITH THE COMPONENT OR THE USE OR OTHER DEALINGS
+-- IN THE COMPONENT.
+-- 
+-- The CAN protocol is developed by Robert Bosch GmbH and protected by patents.
+-- Anybody who wants to implement this IP core on silicon has to obtain a CAN
+-- protocol license from Bosch.
+-- 
+-- -------------------------------------------------------------------------------
+-- 
+-- CTU CAN FD IP Core 
+-- Copyright (C) 2015-2020 MIT License
+-- 
+-- Authors:
+--     Ondrej Ille <ondrej.ille@gmail.com>
+--     Martin Jerabek <martin.jerabek01@gmail.com>
+-- 
+-- Project advisors: 
+-- 	Jiri Novak <jnovak@fel.cvut.cz>
+-- 	Pavel Pisa <pisa@cmp.felk.cvut.cz>
+-- 
+-- Department of Measurement         (http://meas.fel.cvut.cz/)
+-- Faculty of Electrical Engineering (http://www.fel.cvut.cz)
+-- Czech Technical University        (http://www.cvut.cz/)
+-- 
+-- Permission is hereby granted, free of charge, to any person obtaining a copy
+-- of this VHDL component and associated documentation files (the "Component"),
+-- to deal in the Component without restriction, including without limitation
+-- the rights to use, copy, modify, merge, publish, distribute, sublicense,
+-- and/or sell copies of the Component, and to permit persons to whom the
+-- Component is furnished to do so, subject to the following conditions:
+-- 
+-- The above copyright notice and this permission notice shall be included in
+-- all copies or substantial portions of the Component.
+-- 
+-- THE COMPONENT IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+-- IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+-- FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+-- AUTHORS OR COPYRIGHTHOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+-- LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+-- FROM, OUT OF OR IN CONNECTION WITH THE COMPONENT OR THE USE OR OTHER DEALINGS
+-- IN THE COMPONENT.
+-- 
+-- The CAN protocol is developed by Robert Bosch GmbH and protected by patents.
+-- Anybody who wants to implement this IP core on silicon has to obtain a CAN
+-- protocol license from Bosch.
+-- 
+
+--------------------------------------------------------------------------------
+-- @TestInfoStart
+--
+-- @Purpose:
+--  TXT FIFO feature test.
+--
+-- @Verifies:
+--  @1. TX_FIFO_STATUS[TFDEPTH] gives depth of TXT FIFO and TFFL = 0 after
+--      reset.
+--  @2. Each "set_ready" command to the last TXT Buffer inserts frame to TXT
+--      FIFO and increments TX_FIFO_STATUS[TFFL]. TFFULL is set when TXT FIFO
+--      is full, and "set_ready" command is ignored when TXT FIFO is full.
+--  @3. Frames from TXT FIFO are transmitted in order of insertion, TFFL is
+--      decremented after each transmitted frame.
+--  @4. INT_STAT[TFTI] is set when number of frames in TXT FIFO drops to
+--      TX_FIFO_CTRL[TFTH], and it is not set before.
+--  @5. Aborting frame in TXT FIFO flushes all frames and sets INT_STAT[TFTI]
+--      when there were more frames than TFTH.
+--
+-- @Test sequence:
+--  @1. Check STATUS[STXF], skip the test if it is not set. Read TFDEPTH and
+--      check TFFL = 0 and TFFULL is not set. Set TFTH to half of TFDEPTH.
+--      Configure SETTINGS[TBFBO] = 0 in DUT and turn DUT off, so that frames
+--      stay Ready in TXT FIFO.
+--  @2. Insert TFDEPTH random frames with distinct identifiers to the last
+--      TXT Buffer, check TFFL after each insertion. Check TFFULL is set.
+--      Insert one more frame and check TFFL did not change. Check TFTI is
+--      not set.
+--  @3. Turn DUT on. Wait till each frame is sent by DUT, read it from Test
+--      node and check it matches inserted frames in order of insertion.
+--      Check TFFL is decremented after each frame and TFTI is set only when
+--      TFFL dropped to TFTH. Clear TFTI.
+--  @4. Turn DUT off. Insert TFTH + 1 frames to TXT FIFO and abort the last
+--      TXT Buffer. Check the last TXT Buffer is Aborted, TFFL = 0 and TFTI
+--      is set. Clear TFTI, restore SETTINGS[TBFBO] and turn DUT on.
+--
+-- @TestInfoEnd
+--------------------------------------------------------------------------------
+-- Revision History:
+--    19.10.2026   Created file
+--------------------------------------------------------------------------------
+
+Library ctu_can_fd_tb;
+context ctu_can_fd_tb.ieee_context;
+context ctu_can_fd_tb.rtl_context;
+context ctu_can_fd_tb.tb_common_context;
+
+use ctu_can_fd_tb.feature_test_agent_pkg.all;
+
+package tx_fifo_ftest is
+    procedure tx_fifo_ftest_exec(
+        signal      chn             : inout  t_com_channel
+    );
+end package;
+
+
+package body tx_fifo_ftest is
+    procedure tx_fifo_ftest_exec(
+        signal      chn             : inout  t_com_channel
+    ) is
+        -- Frames inserted to TXT FIFO
+        type t_frames is array (0 to 63) of SW_CAN_frame_type;
+        variable frames             :     t_frames;
+        variable frame_rx           :     SW_CAN_frame_type;
+        variable outcome            :     boolean;
+
+        variable mode_1             :     SW_mode := SW_mode_rst_val;
+        variable mode_backup        :     SW_mode := SW_mode_rst_val;
+        variable interrupts         :     SW_interrupts := SW_interrupts_rst_val;
+        variable int_clear          :     SW_interrupts := SW_interrupts_rst_val;
+        variable txt_state          :     SW_TXT_Buffer_state_type;
+
+        variable r_data             :     std_logic_vector(31 downto 0);
+        variable w_data             :     std_logic_vector(15 downto 0);
+        variable fifo_idx           :     natural range 1 to 8;
+        variable depth              :     natural;
+        variable th                 :     natural;
+
+        -- Read TX_FIFO_STATUS and check number of frames in TXT FIFO
+        procedure check_tx_fifo_fill(
+            constant fill           : in    natural;
+            signal   chn            : inout t_com_channel
+        ) is
+            variable status         :       std_logic_vector(31 downto 0);
+        begin
+            CAN_read(status, TX_FIFO_CTRL_ADR, DUT_NODE, chn);
+            check_m(to_integer(unsigned(status(TFFL_H downto TFFL_L))) = fill,
+                    "TX_FIFO_STATUS[TFFL] = " & integer'image(fill));
+            if (fill = depth) then
+                check_m(status(TFFULL_IND) = '1', "TX_FIFO_STATUS[TFFULL] set");
+            else
+                check_m(status(TFFULL_IND) = '0',
+                        "TX_FIFO_STATUS[TFFULL] not set");
+            end if;
+        end procedure;
+    begin
+
+        -----------------------------------------------------------------------
+        -- @1. Check STATUS[STXF], skip the test if it is not set. Read
+        --     TFDEPTH and check TFFL = 0 and TFFULL is not set. Set TFTH to
+        --     half of TFDEPTH. Configure SETTINGS[TBFBO] = 0 in DUT and turn
+        --     DUT off, so that frames stay Ready in TXT FIFO.
+        -----------------------------------------------------------------------
+        info_m("Step 1");
+
+        CAN_read(r_data, STATUS_ADR, DUT_NODE, chn);
+        if (r_data(STXF_IND) = '0') then
+            info_m("TXT FIFO not supported, skipping!");
+            return;
+        end if;
+
+        CAN_read(r_data, TX_FIFO_CTRL_ADR, DUT_NODE, chn);
+        depth := to_integer(unsigned(r_data(TFDEPTH_H downto TFDEPTH_L)));
+        info_m("TXT FIFO depth: " & integer'image(depth));
+        check_tx_fifo_fill(0, chn);
+
+        -- TXT FIFO takes place of the last TXT Buffer
+        get_tx_buf_count(fifo_idx, DUT_NODE, chn);
+
+        th := depth / 2;
+        w_data := (OTHERS => '0');
+        w_data(TFTH_H downto TFTH_L) := std_logic_vector(to_unsigned(th, 7));
+        CAN_write(w_data, TX_FIFO_CTRL_ADR, DUT_NODE, chn);
+
+        get_core_mode(mode_backup, DUT_NODE, chn);
+        mode_1 := mode_backup;
+        mode_1.tx_buf_bus_off_failed := false;
+        set_core_mode(mode_1, DUT_NODE, chn);
+
+        CAN_turn_controller(false, DUT_NODE, chn);
+
+        -----------------------------------------------------------------------
+        -- @2. Insert TFDEPTH random frames with distinct identifiers to the
+        --     last TXT Buffer, check TFFL after each insertion. Check TFFULL
+        --     is set. Insert one more frame and check TFFL did not change.
+        --     Check TFTI is not set.
+        -----------------------------------------------------------------------
+        info_m("Step 2");
+
+        for i in 0 to depth - 1 loop
+            CAN_generate_frame(frames(i));
+            frames(i).ident_type := BASE;
+            frames(i).identifier := i;
+            CAN_insert_TX_frame(frames(i), fifo_idx, DUT_NODE, chn);
+            send_TXT_buf_cmd(buf_set_ready, fifo_idx, DUT_NODE, chn);
+            check_tx_fifo_fill(i + 1, chn);
+        end loop;
+
+        CAN_generate_frame(frame_rx);
+        CAN_insert_TX_frame(frame_rx, fifo_idx, DUT_NODE, chn);
+        send_TXT_buf_cmd(buf_set_ready, fifo_idx, DUT_NODE, chn);
+        check_tx_fifo_fill(depth, chn);
+
+        read_int_status(interrupts, DUT_NODE, chn);
+        check_false_m(interrupts.tx_fifo_int, "INT_STAT[TFTI] not set");
+
+        -----------------------------------------------------------------------
+        -- @3. Turn DUT on. Wait till each frame is sent by DUT, read it from
+        --     Test node and check it matches inserted frames in order of
+        --     insertion. Check TFFL is decremented after each frame and TFTI
+        --     is set only when TFFL dropped to TFTH. Clear TFTI.
+        -----------------------------------------------------------------------
+        info_m("Step 3");
+
+        CAN_turn_controller(true, DUT_NODE, chn);
+
+        for i in 0 to depth - 1 loop
+            CAN_wait_frame_sent(DUT_NODE, chn);
+            check_tx_fifo_fill(depth - i - 1, chn);
+
+            read_int_status(interrupts, DUT_NODE, chn);
+            if (depth - i - 1 > th) then
+                check_false_m(interrupts.tx_fifo_int,
+                    "INT_STAT[TFTI] not set above threshold");
+            else
+                check_m(interrupts.tx_fifo_int,
+                    "INT_STAT[TFTI] set at threshold");
+            end if;
+
+            CAN_read_frame(frame_rx, TEST_NODE, chn);
+            CAN_compare_frames(frame_rx, frames(i), false, outcome);
+            check_m(outcome, "Frame " & integer'image(i) & " sent in order");
+        end loop;
+
+        CAN_wait_bus_idle(DUT_NODE, chn);
+
+        int_clear.tx_fifo_int := true;
+        clear_int_status(int_clear, DUT_NODE, chn);
+
+        -----------------------------------------------------------------------
+        -- @4. Turn DUT off. Insert TFTH + 1 frames to TXT FIFO and abort the
+        --     last TXT Buffer. Check the last TXT Buffer is Aborted, TFFL = 0
+        --     and TFTI is set. Clear TFTI, restore SETTINGS[TBFBO] and turn
+        --     DUT on.
+        -----------------------------------------------------------------------
+        info_m("Step 4");
+
+        CAN_turn_controller(false, DUT_NODE, chn);
+
+        for i in 0 to th loop
+            CAN_insert_TX_frame(frames(i), fifo_idx, DUT_NODE, chn);
+            send_TXT_buf_cmd(buf_set_ready, fifo_idx, DUT_NODE, chn);
+        end loop;
+        check_tx_fifo_fill(th + 1, chn);
+
+        send_TXT_buf_cmd(buf_set_abort, fifo_idx, DUT_NODE, chn);
+
+        get_tx_buf_state(fifo_idx, txt_state, DUT_NODE, chn);
+        check_m(txt_state = buf_aborted, "Last TXT Buffer Aborted");
+        check_tx_fifo_fill(0, chn);
+
+        read_int_status(interrupts, DUT_NODE, chn);
+        check_m(interrupts.tx_fifo_int, "INT_STAT[TFTI] set after flush");
+        clear_int_status(int_clear, DUT_NODE, chn);
+
+        set_core_mode(mode_backup, DUT_NODE, chn);
+        CAN_turn_controller(true, DUT_NODE, chn);
+
+  end procedure;
+
+end package body;
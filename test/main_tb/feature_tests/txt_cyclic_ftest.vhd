@@ -0,0 +1,292 @@
+--------------------------------------------------------------------------------
+-- 
+-- CTU CAN FD IP Core 
+-- Copyright (C) 2021-present Ondrej Ille
+-- 
+-- Permission is hereby granted, free of charge, to any person obtaining a copy
+-- of this VHDL component and associated documentation files (the "Component"),
+-- to use, copy, modify, merge, publish, distribute the Component for
+-- educational, research, evaluation, self-interest purposes. Using the
+-- Component for commercial purposes is forbidden unless previously agreed with
+-- Copyright holder.
+-- 
+-- The above copyright notice and this permission notice shall be included in
+-- all copies or substantial portions of the Component.
+-- 
+-- THE COMPONENT IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+-- IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+-- FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+-- AUTHORS OR COPYRIGHTHOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+-- LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+-- FROM, OUT OF OR IN CONNECTION WITH THE COMPONENT OR THE USE OR OTHER DEALINGS
+-- IN THE COMPONENT.
+-- 
+-- The CAN protocol is developed by Robert Bosch GmbH and protected by patents.
+-- Anybody who wants to implement this IP core on silicon has to obtain a CAN
+-- protocol license from Bosch.
+-- 
+-- -------------------------------------------------------------------------------
+-- 
+-- CTU CAN FD IP Core 
+-- Copyright (C) 2015-2020 MIT License
+-- 
+-- Authors:
+--     Ondrej Ille <ondrej.ille@gmail.com>
+--     Martin Jerabek <martin.jerabek01@gmail.com>
+-- 
+-- Project advisors: 
+-- 	Jiri Novak <jnovak@fel.cvut.cz>
+-- 	Pavel Pisa <pisa@cmp.felk.cvut.cz>
+-- 
+-- Department of Measurement         (http://meas.fel.cvut.cz/)
+-- Faculty of Electrical Engineering (http://www.fel.cvut.cz)
+-- Czech Technical University        (http://www.cvut.cz/)
+-- 
+-- Permission is hereby granted, free of charge, to any person obtaining a copy
+-- of this VHDL component and associated documentation files (the "Component"),
+-- to deal in the Component without restriction, including without limitation
+-- the rights to use, copy, modify, merge, publish, distribute, sublicense,
+-- and/or sell copies of the Component, and to permit persons to whom the
+-- Component is furnished to do so, subject to the following conditions:
+-- 
+-- The above copyright notice and this permission notice shall be included in
+-- all copies or substantial portions of the Component.
+-- 
+-- THE COMPONENT IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+-- IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+-- FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+-- AUTHORS OR COPYRIGHTHOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+-- LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+-- FROM, OUT OF OR IN CONNECTION WITH THE COMPONENT OR THE USE OR OTHER DEALINGS
+-- IN THE COMPONENT.
+-- 
+-- The CAN protocol is developed by Robert Bosch GmbH and protected by patents.
+-- Anybody who wants to implement this IP core on silicon has to obtain a CAN
+-- protocol license from Bosch.
+-- 
+
+--------------------------------------------------------------------------------
+-- @TestInfoStart
+--
+-- @Purpose:
+--  Cyclic transmission from TXT Buffer feature test.
+--
+-- @Verifies:
+--  @1. TXT_CYC_PERIOD of TXT Buffer selected by TXT_CYC_SEL reads back last
+--      written value, TXT_CYC_SKIP is cleared by write of TXT_CYC_PERIOD.
+--  @2. TXT Buffer with non-zero period returns to Ready after successfull
+--      transmission and is transmitted again one period after previous
+--      transmission.
+--  @3. When following slot elapses before transmission in current slot
+--      starts, the slot is skipped and TXT_CYC_SKIP is incremented.
+--  @4. TXT Buffer with zero period ends in TX OK after transmission.
+--  @5. Set abort command ends cyclic transmission.
+--
+-- @Test sequence:
+--  @1. Check STATUS[STCYC] and STATUS[STXTS], skip the test if any of them
+--      is not set. Select TXT Buffer 1 by TXT_CYC_SEL, write random period
+--      and check it reads back. Check TXT_CYC_SKIP is zero. Write zero
+--      period.
+--  @2. Send frame by DUT from TXT Buffer 1. Measure duration of the frame
+--      from TXTB_TS_LOW / TXTB_TS_HIGH till the end of the frame.
+--  @3. Set period to three times frame duration, send frame from TXT Buffer
+--      1. Wait till frame is sent, check TXT Buffer 1 is Ready and read its
+--      TX timestamp. Wait till the frame is sent again and check that its TX
+--      timestamp differs by at least a period and less than period plus
+--      frame duration. Check TXT_CYC_SKIP is zero.
+--  @4. Set period to quarter of frame duration. Wait till two frames are
+--      sent and check TXT_CYC_SKIP is not zero.
+--  @5. Write zero period. Wait till frame is sent and bus is idle. Check
+--      TXT Buffer 1 is in TX OK.
+--  @6. Set period to three times frame duration, send frame from TXT Buffer
+--      1. Wait till frame is sent, check TXT Buffer 1 is Ready and issue Set
+--      abort command. Check TXT Buffer 1 is Aborted.
+--
+-- @TestInfoEnd
+--------------------------------------------------------------------------------
+-- Revision History:
+--    19.10.2026   Created file
+--------------------------------------------------------------------------------
+
+Library ctu_can_fd_tb;
+context ctu_can_fd_tb.ieee_context;
+context ctu_can_fd_tb.rtl_context;
+context ctu_can_fd_tb.tb_common_context;
+
+use ctu_can_fd_tb.feature_test_agent_pkg.all;
+use ctu_can_fd_tb.timestamp_agent_pkg.all;
+
+package txt_cyclic_ftest is
+    procedure txt_cyclic_ftest_exec(
+        signal      chn             : inout  t_com_channel
+    );
+end package;
+
+
+package body txt_cyclic_ftest is
+    procedure txt_cyclic_ftest_exec(
+        signal      chn             : inout  t_com_channel
+    ) is
+        variable CAN_TX_frame       :        SW_CAN_frame_type;
+        variable frame_sent         :        boolean := false;
+        variable txt_state          :        SW_TXT_Buffer_state_type;
+        variable r_data             :        std_logic_vector(31 downto 0);
+        variable w_data             :        std_logic_vector(31 downto 0);
+        variable rand_period        :        std_logic_vector(31 downto 0);
+        variable ts_1               :        std_logic_vector(63 downto 0);
+        variable ts_2               :        std_logic_vector(63 downto 0);
+        variable frame_len          :        unsigned(63 downto 0);
+        variable period             :        unsigned(63 downto 0);
+        variable diff               :        unsigned(63 downto 0);
+
+        -- Write period of cyclic transmission of TXT Buffer 1
+        procedure set_cyc_period(
+            constant period         : in    std_logic_vector(31 downto 0);
+            signal   chn            : inout t_com_channel
+        ) is
+        begin
+            CAN_write(period, TXT_CYC_PERIOD_ADR, DUT_NODE, chn);
+        end procedure;
+    begin
+
+        -----------------------------------------------------------------------
+        -- @1. Check STATUS[STCYC] and STATUS[STXTS], skip the test if any of
+        --     them is not set. Select TXT Buffer 1 by TXT_CYC_SEL, write
+        --     random period and check it reads back. Check TXT_CYC_SKIP is
+        --     zero. Write zero period.
+        -----------------------------------------------------------------------
+        info_m("Step 1");
+
+        CAN_read(r_data, STATUS_ADR, DUT_NODE, chn);
+        if (r_data(STCYC_IND) = '0') then
+            info_m("Cyclic transmission not supported, skipping!");
+            return;
+        end if;
+
+        -- Frame duration is measured via TXT Buffer timestamps
+        if (r_data(STXTS_IND) = '0') then
+            info_m("TXT Buffer timestamps not supported, skipping!");
+            return;
+        end if;
+
+        w_data := (OTHERS => '0');
+        CAN_write(w_data, TXT_CYC_SEL_ADR, DUT_NODE, chn);
+
+        rand_logic_vect_v(rand_period, 0.5);
+        set_cyc_period(rand_period, chn);
+        CAN_read(r_data, TXT_CYC_PERIOD_ADR, DUT_NODE, chn);
+        check_m(r_data = rand_period, "TXT_CYC_PERIOD read back");
+
+        CAN_read(r_data, TXT_CYC_SEL_ADR, DUT_NODE, chn);
+        check_m(r_data(TCSKIP_H downto TCSKIP_L) = x"0000",
+                "TXT_CYC_SKIP zero");
+
+        set_cyc_period(x"00000000", chn);
+
+        -----------------------------------------------------------------------
+        -- @2. Send frame by DUT from TXT Buffer 1. Measure duration of the
+        --     frame from TXTB_TS_LOW / TXTB_TS_HIGH till the end of the frame.
+        -----------------------------------------------------------------------
+        info_m("Step 2");
+
+        CAN_generate_frame(CAN_TX_frame);
+        CAN_TX_frame.frame_format := NORMAL_CAN;
+        CAN_TX_frame.rtr := NO_RTR_FRAME;
+        CAN_TX_frame.dlc := "0001";
+        decode_dlc(CAN_TX_frame.dlc, CAN_TX_frame.data_length);
+
+        CAN_send_frame(CAN_TX_frame, 1, DUT_NODE, chn, frame_sent);
+        CAN_wait_frame_sent(DUT_NODE, chn);
+        timestamp_agent_get_timestamp(chn, ts_2);
+        read_txtb_ts(ts_1, 1, DUT_NODE, chn);
+
+        frame_len := unsigned(ts_2) - unsigned(ts_1);
+        info_m("Frame duration: " & to_hstring(frame_len));
+        CAN_wait_bus_idle(DUT_NODE, chn);
+
+        -----------------------------------------------------------------------
+        -- @3. Set period to three times frame duration, send frame from TXT
+        --     Buffer 1. Wait till frame is sent, check TXT Buffer 1 is Ready
+        --     and read its TX timestamp. Wait till the frame is sent again
+        --     and check that its TX timestamp differs by at least a period
+        --     and less than period plus frame duration. Check TXT_CYC_SKIP
+        --     is zero.
+        -----------------------------------------------------------------------
+        info_m("Step 3");
+
+        period := resize(frame_len * 3, 64);
+        set_cyc_period(std_logic_vector(period(31 downto 0)), chn);
+
+        CAN_send_frame(CAN_TX_frame, 1, DUT_NODE, chn, frame_sent);
+        CAN_wait_frame_sent(DUT_NODE, chn);
+        get_tx_buf_state(1, txt_state, DUT_NODE, chn);
+        check_m(txt_state = buf_ready, "TXT Buffer Ready after transmission");
+        read_txtb_ts(ts_1, 1, DUT_NODE, chn);
+
+        CAN_wait_frame_sent(DUT_NODE, chn);
+        read_txtb_ts(ts_2, 1, DUT_NODE, chn);
+
+        diff := unsigned(ts_2) - unsigned(ts_1);
+        info_m("Distance of transmissions: " & to_hstring(diff));
+        check_m(diff >= period, "Transmission not before next slot");
+        check_m(diff < period + frame_len, "Transmission at next slot");
+
+        CAN_read(r_data, TXT_CYC_SEL_ADR, DUT_NODE, chn);
+        check_m(r_data(TCSKIP_H downto TCSKIP_L) = x"0000",
+                "No slot skipped");
+
+        -----------------------------------------------------------------------
+        -- @4. Set period to quarter of frame duration. Wait till two frames
+        --     are sent and check TXT_CYC_SKIP is not zero.
+        -----------------------------------------------------------------------
+        info_m("Step 4");
+
+        period := shift_right(frame_len, 2);
+        set_cyc_period(std_logic_vector(period(31 downto 0)), chn);
+
+        CAN_wait_frame_sent(DUT_NODE, chn);
+        CAN_wait_frame_sent(DUT_NODE, chn);
+
+        CAN_read(r_data, TXT_CYC_SEL_ADR, DUT_NODE, chn);
+        check_m(r_data(TCSKIP_H downto TCSKIP_L) /= x"0000",
+                "Slots skipped");
+
+        -----------------------------------------------------------------------
+        -- @5. Write zero period. Wait till frame is sent and bus is idle.
+        --     Check TXT Buffer 1 is in TX OK.
+        -----------------------------------------------------------------------
+        info_m("Step 5");
+
+        set_cyc_period(x"00000000", chn);
+        CAN_wait_frame_sent(DUT_NODE, chn);
+        CAN_wait_bus_idle(DUT_NODE, chn);
+
+        get_tx_buf_state(1, txt_state, DUT_NODE, chn);
+        check_m(txt_state = buf_done, "TXT Buffer TX OK with zero period");
+
+        -----------------------------------------------------------------------
+        -- @6. Set period to three times frame duration, send frame from TXT
+        --     Buffer 1. Wait till frame is sent, check TXT Buffer 1 is Ready
+        --     and issue Set abort command. Check TXT Buffer 1 is Aborted.
+        -----------------------------------------------------------------------
+        info_m("Step 6");
+
+        period := resize(frame_len * 3, 64);
+        set_cyc_period(std_logic_vector(period(31 downto 0)), chn);
+
+        CAN_send_frame(CAN_TX_frame, 1, DUT_NODE, chn, frame_sent);
+        CAN_wait_frame_sent(DUT_NODE, chn);
+        get_tx_buf_state(1, txt_state, DUT_NODE, chn);
+        check_m(txt_state = buf_ready, "TXT Buffer Ready after transmission");
+
+        send_TXT_buf_cmd(buf_set_abort, 1, DUT_NODE, chn);
+        get_tx_buf_state(1, txt_state, DUT_NODE, chn);
+        check_m(txt_state = buf_aborted, "TXT Buffer Aborted");
+
+        set_cyc_period(x"00000000", chn);
+        CAN_wait_bus_idle(DUT_NODE, chn);
+        CAN_wait_bus_idle(TEST_NODE, chn);
+
+  end procedure;
+
+end package body;
@@ -86,7 +86,7 @@ package can_fd_tb_register_map is
   -- Register list
   ------------------------------------------------------------------------------
 
-  type t_Control_registers_list is array (0 to 50) of t_memory_reg;
+  type t_Control_registers_list is array (0 to 78) of t_memory_reg;
 
   constant Control_registers_list : t_Control_registers_list :=(
 
@@ -113,38 +113,38 @@ package can_fd_tb_register_map is
     (address   => STATUS_ADR,
      size      => 32,
      reg_type  => reg_read_only,
-     reset_val => "00000000000000000000000010000100",
-     is_implem => "00000000000000110000000111111111"),
+     reset_val => "00000000100000000000000010000100",
+     is_implem => "00000111111111110000000111111111"),
     (address   => COMMAND_ADR,
      size      => 32,
      reg_type  => reg_write_only,
      reset_val => "00000000000000000000000000000000",
-     is_implem => "00000000000000000000000011111110"),
+     is_implem => "00000000000000000001111111111110"),
     (address   => INT_STAT_ADR,
      size      => 16,
      reg_type  => reg_read_write_once,
      reset_val => "00000000000000000000000000000000",
-     is_implem => "00000000000000000000111111111111"),
+     is_implem => "00000000000000001111111111111111"),
     (address   => INT_ENA_SET_ADR,
      size      => 16,
      reg_type  => reg_read_write_once,
      reset_val => "00000000000000000000000000000000",
-     is_implem => "00000000000000000000111111111111"),
+     is_implem => "00000000000000001111111111111111"),
     (address   => INT_ENA_CLR_ADR,
      size      => 16,
      reg_type  => reg_write_only,
      reset_val => "00000000000000000000000000000000",
-     is_implem => "00000000000000000000111111111111"),
+     is_implem => "00000000000000001111111111111111"),
     (address   => INT_MASK_SET_ADR,
      size      => 16,
      reg_type  => reg_read_write_once,
      reset_val => "00000000000000000000000000000000",
-     is_implem => "00000000000000000000111111111111"),
+     is_implem => "00000000000000001111111111111111"),
     (address   => INT_MASK_CLR_ADR,
      size      => 16,
      reg_type  => reg_write_only,
      reset_val => "00000000000000000000000000000000",
-     is_implem => "00000000000000000000111111111111"),
+     is_implem => "00000000000000001111111111111111"),
     (address   => BTR_ADR,
      size      => 32,
      reg_type  => reg_read_write,
@@ -344,7 +344,147 @@ package can_fd_tb_register_map is
      size      => 32,
      reg_type  => reg_read_only,
      reset_val => "00000000000000000000000000000000",
-     is_implem => "11111111111111111111111111111111")
+     is_implem => "11111111111111111111111111111111"),
+    (address   => FILTER_SET_CTRL_ADR,
+     size      => 16,
+     reg_type  => reg_read_write,
+     reset_val => "00000000000000000000000000000000",
+     is_implem => "00000000000000000000000000001111"),
+    (address   => FILTER_SET_INFO_ADR,
+     size      => 16,
+     reg_type  => reg_read_only,
+     reset_val => "00000000000000000000000000000000",
+     is_implem => "00000000000000000000000000000000"),
+    (address   => FILTER_SET_ADDR_ADR,
+     size      => 16,
+     reg_type  => reg_read_write,
+     reset_val => "00000000000000000000000000000000",
+     is_implem => "00000000000000001000001111111111"),
+    (address   => FILTER_SET_DATA_ADR,
+     size      => 32,
+     reg_type  => reg_read_write,
+     reset_val => "00000000000000000000000000000000",
+     is_implem => "11111111111111111111111111111111"),
+    (address   => RX_DROP_CTR_ADR,
+     size      => 32,
+     reg_type  => reg_read_only,
+     reset_val => "00000000000000000000000000000000",
+     is_implem => "11111111111111111111111111111111"),
+    (address   => RX_DMA_CTRL_ADR,
+     size      => 32,
+     reg_type  => reg_read_write,
+     reset_val => "00000000000000000000000000000000",
+     is_implem => "11111111111111111111111111110001"),
+    (address   => RX_DMA_BASE_ADR,
+     size      => 32,
+     reg_type  => reg_read_write,
+     reset_val => "00000000000000000000000000000000",
+     is_implem => "11111111111111111111111110000000"),
+    (address   => RX_DMA_CONS_ADR,
+     size      => 16,
+     reg_type  => reg_read_write,
+     reset_val => "00000000000000000000000000000000",
+     is_implem => "00000000000000000000111111111111"),
+    (address   => RX_DMA_STATUS_ADR,
+     size      => 32,
+     reg_type  => reg_read_only,
+     reset_val => "00000000000000000000000000000000",
+     is_implem => "00000000000000110000111111111111"),
+    (address   => TX_FIFO_CTRL_ADR,
+     size      => 16,
+     reg_type  => reg_read_write,
+     reset_val => "00000000000000000000000000000000",
+     is_implem => "00000000000000000000000001111111"),
+    (address   => TX_FIFO_STATUS_ADR,
+     size      => 16,
+     reg_type  => reg_read_only,
+     reset_val => "00000000000000000000000000000000",
+     is_implem => "00000000000000000000000000000000"),
+    (address   => INT_TS_SEL_ADR,
+     size      => 32,
+     reg_type  => reg_read_write,
+     reset_val => "00000000000000000000000000000000",
+     is_implem => "00000000000000000000000000001111"),
+    (address   => INT_TS_ADR,
+     size      => 32,
+     reg_type  => reg_read_only,
+     reset_val => "00000000000000000000000000000000",
+     is_implem => "00000000000000000000000000000000"),
+    (address   => BUS_STAT_SEL_ADR,
+     size      => 32,
+     reg_type  => reg_read_write,
+     reset_val => "00000000000000000000000000000000",
+     is_implem => "00000000000000000000000000000111"),
+    (address   => BUS_STAT_ADR,
+     size      => 32,
+     reg_type  => reg_read_only,
+     reset_val => "00000000000000000000000000000000",
+     is_implem => "00000000000000000000000000000000"),
+    (address   => TXTB_TS_SEL_ADR,
+     size      => 32,
+     reg_type  => reg_read_write,
+     reset_val => "00000000000000000000000000000000",
+     is_implem => "00000000000000000000000000000111"),
+    (address   => TXTB_TS_LOW_ADR,
+     size      => 32,
+     reg_type  => reg_read_only,
+     reset_val => "00000000000000000000000000000000",
+     is_implem => "00000000000000000000000000000000"),
+    (address   => TXTB_TS_HIGH_ADR,
+     size      => 32,
+     reg_type  => reg_read_only,
+     reset_val => "00000000000000000000000000000000",
+     is_implem => "00000000000000000000000000000000"),
+    (address   => TS_INC_ADR,
+     size      => 32,
+     reg_type  => reg_read_write,
+     reset_val => "00000001000000000000000000000000",
+     is_implem => "00000000000000000000000000000000"),
+    (address   => TS_STEP_LOW_ADR,
+     size      => 32,
+     reg_type  => reg_read_write,
+     reset_val => "00000000000000000000000000000000",
+     is_implem => "00000000000000000000000000000000"),
+    (address   => TS_STEP_HIGH_ADR,
+     size      => 32,
+     reg_type  => reg_read_write,
+     reset_val => "00000000000000000000000000000000",
+     is_implem => "00000000000000000000000000000000"),
+    (address   => RX_PEEK_FFW_ADR,
+     size      => 32,
+     reg_type  => reg_read_only,
+     reset_val => "00000000000000000000000000000000",
+     is_implem => "11111111111111111111111111111111"),
+    (address   => RX_PEEK_IDW_ADR,
+     size      => 32,
+     reg_type  => reg_read_only,
+     reset_val => "00000000000000000000000000000000",
+     is_implem => "11111111111111111111111111111111"),
+    (address   => TXT_CYC_SEL_ADR,
+     size      => 16,
+     reg_type  => reg_read_write,
+     reset_val => "00000000000000000000000000000000",
+     is_implem => "00000000000000000000000000000111"),
+    (address   => TXT_CYC_SKIP_ADR,
+     size      => 16,
+     reg_type  => reg_read_only,
+     reset_val => "00000000000000000000000000000000",
+     is_implem => "00000000000000001111111111111111"),
+    (address   => TXT_CYC_PERIOD_ADR,
+     size      => 32,
+     reg_type  => reg_read_write,
+     reset_val => "00000000000000000000000000000000",
+     is_implem => "11111111111111111111111111111111"),
+    (address   => TX_CPL_TS_ADR,
+     size      => 32,
+     reg_type  => reg_read_only,
+     reset_val => "00000000000000000000000000000000",
+     is_implem => "11111111111111111111111111111111"),
+    (address   => TX_CPL_ADR,
+     size      => 32,
+     reg_type  => reg_read_only,
+     reset_val => "00000000000000000000000000000000",
+     is_implem => "11000000000111110000111111110111")
   );
 
 
@@ -586,4 +726,51 @@ package can_fd_tb_register_map is
      is_implem => "11111111111111111111111111111111")
   );
 
+
+  ------------------------------------------------------------------------------
+  -- Register list
+  ------------------------------------------------------------------------------
+
+  type t_RX_Data_Window_list is array (0 to 0) of t_memory_reg;
+
+  constant RX_Data_Window_list : t_RX_Data_Window_list :=(
+
+    (address   => RX_DATA_WINDOW_ADR,
+     size      => 32,
+     reg_type  => reg_read_only,
+     reset_val => "00000000000000000000000000000000",
+     is_implem => "11111111111111111111111111111111")
+  );
+
+
+  ------------------------------------------------------------------------------
+  -- Register list
+  ------------------------------------------------------------------------------
+
+  type t_RX_Prio_Buffer_list is array (0 to 3) of t_memory_reg;
+
+  constant RX_Prio_Buffer_list : t_RX_Prio_Buffer_list :=(
+
+    (address   => RXP_CTRL_ADR,
+     size      => 16,
+     reg_type  => reg_read_write,
+     reset_val => "00000000000000000000000000000000",
+     is_implem => "00000000000000000000001100011111"),
+    (address   => RXP_MEM_INFO_ADR,
+     size      => 32,
+     reg_type  => reg_read_only,
+     reset_val => "00000000000000000000000000000000",
+     is_implem => "00011111111111110001111111111111"),
+    (address   => RXP_STATUS_ADR,
+     size      => 16,
+     reg_type  => reg_read_only,
+     reset_val => "00000000000000000000000000000001",
+     is_implem => "00000000000000001111111111110111"),
+    (address   => RXP_DATA_ADR,
+     size      => 32,
+     reg_type  => reg_read_only,
+     reset_val => "00000000000000000000000000000000",
+     is_implem => "11111111111111111111111111111111")
+  );
+
 end package;
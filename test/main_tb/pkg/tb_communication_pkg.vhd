@@ -93,6 +93,7 @@ package tb_communication_pkg is
     constant C_INTERRUPT_AGENT_ID       : natural := 5;
     constant C_TIMESTAMP_AGENT_ID       : natural := 6;
     constant C_TEST_PROBE_AGENT_ID      : natural := 7;
+    constant C_DMA_MEMORY_AGENT_ID      : natural := 8;
 
     constant COM_PKG_TAG : string := "Communication PKG: ";
 
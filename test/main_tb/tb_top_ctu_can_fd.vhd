@@ -124,7 +124,18 @@ entity tb_top_ctu_can_fd is
         sup_filtB               : boolean := true;
         sup_filtC               : boolean := true;
         sup_range               : boolean := true;
+        sup_filt_set            : boolean := true;
         sup_traffic_ctrs        : boolean := true;
+        sup_rx_dma              : boolean := true;
+        sup_tx_fifo             : boolean := true;
+        tx_fifo_depth           : natural range 2 to 64 := 16;
+        tx_arb_pipeline         : boolean := true;
+        sup_int_ts              : boolean := true;
+        sup_tx_ts               : boolean := true;
+        sup_ts_gen              : boolean := false;
+        sup_txt_cyclic          : boolean := true;
+        sup_tx_cpl              : boolean := true;
+        sup_rx_prio             : boolean := true;
         target_technology       : natural := C_TECH_ASIC;
 
         -- Seed
@@ -154,6 +165,12 @@ architecture tb of tb_top_ctu_can_fd is
    signal timestamp     : std_logic_vector(63 DOWNTO 0);
    signal test_probe    : t_ctu_can_fd_test_probe;
 
+   signal dma_m_addr    : std_logic_vector(31 DOWNTO 0);
+   signal dma_m_wdata   : std_logic_vector(31 DOWNTO 0);
+   signal dma_m_req     : std_logic;
+   signal dma_m_ack     : std_logic;
+   signal dma_m_err     : std_logic;
+
    -- Test control
    signal test_start    : std_logic := '0';
    signal test_done     : std_logic := '0';
@@ -187,7 +204,10 @@ architecture tb of tb_top_ctu_can_fd is
        seed                    : natural := 0;
        
        -- Reference test iterations
-        reference_iterations   : natural range 1 to 1000 := 1000
+        reference_iterations   : natural range 1 to 1000 := 1000;
+
+       -- Directory with reference data set files
+        reference_data_path    : string := ""
     );
     port(
        -- Test control
@@ -215,7 +235,13 @@ architecture tb of tb_top_ctu_can_fd is
        can_rx              : out   std_logic;          
 
        test_probe          : in    t_ctu_can_fd_test_probe;
-       timestamp           : out   std_logic_vector(63 DOWNTO 0) 
+       timestamp           : out   std_logic_vector(63 DOWNTO 0);
+
+       dma_m_addr          : in    std_logic_vector(31 DOWNTO 0) := (OTHERS => '0');
+       dma_m_wdata         : in    std_logic_vector(31 DOWNTO 0) := (OTHERS => '0');
+       dma_m_req           : in    std_logic := '0';
+       dma_m_ack           : out   std_logic;
+       dma_m_err           : out   std_logic
     );
     end component;
 
@@ -232,7 +258,18 @@ begin
         sup_filtB           => sup_filtB,
         sup_filtC           => sup_filtC,
         sup_range           => sup_range,
+        sup_filt_set        => sup_filt_set,
         sup_traffic_ctrs    => sup_traffic_ctrs,
+        sup_rx_dma          => sup_rx_dma,
+        sup_tx_fifo         => sup_tx_fifo,
+        tx_fifo_depth       => tx_fifo_depth,
+        tx_arb_pipeline     => tx_arb_pipeline,
+        sup_int_ts          => sup_int_ts,
+        sup_tx_ts           => sup_tx_ts,
+        sup_ts_gen          => sup_ts_gen,
+        sup_txt_cyclic      => sup_txt_cyclic,
+        sup_tx_cpl          => sup_tx_cpl,
+        sup_rx_prio         => sup_rx_prio,
         target_technology   => target_technology
     )
     port map(
@@ -255,6 +292,13 @@ begin
         -- Interrupt Interface
         int         => int,
 
+        -- RX DMA bus master interface
+        dma_m_addr  => dma_m_addr,
+        dma_m_wdata => dma_m_wdata,
+        dma_m_req   => dma_m_req,
+        dma_m_ack   => dma_m_ack,
+        dma_m_err   => dma_m_err,
+
         -- CAN Bus Interface
         can_tx      => can_tx,
         can_rx      => can_rx,
@@ -290,7 +334,8 @@ begin
         cfg_sjw_fd              => cfg_sjw_fd,
         
         seed                    => seed,
-        reference_iterations    => reference_iterations
+        reference_iterations    => reference_iterations,
+        reference_data_path     => tb_path(runner_cfg) & "reference_test_data_sets/"
     )
     port map(
         -- Test control
@@ -329,7 +374,14 @@ begin
         test_probe  => test_probe,
         
         -- Timestamp
-        timestamp   => timestamp 
+        timestamp   => timestamp,
+
+        -- RX DMA memory
+        dma_m_addr  => dma_m_addr,
+        dma_m_wdata => dma_m_wdata,
+        dma_m_req   => dma_m_req,
+        dma_m_ack   => dma_m_ack,
+        dma_m_err   => dma_m_err
     );
 
 
@@ -362,7 +414,18 @@ begin
         info("  Filter B: " & boolean'image(sup_filtB));
         info("  Filter C: " & boolean'image(sup_filtC));
         info("  Range filter: " & boolean'image(sup_range));
+        info("  ID set filter: " & boolean'image(sup_filt_set));
         info("  Traffic counters: " & boolean'image(sup_traffic_ctrs));
+        info("  RX DMA: " & boolean'image(sup_rx_dma));
+        info("  TXT FIFO: " & boolean'image(sup_tx_fifo));
+        info("  TXT FIFO depth: " & integer'image(tx_fifo_depth));
+        info("  TX Arbitrator pipeline: " & boolean'image(tx_arb_pipeline));
+        info("  Interrupt timestamps: " & boolean'image(sup_int_ts));
+        info("  TXT Buffer timestamps: " & boolean'image(sup_tx_ts));
+        info("  Timestamp generator: " & boolean'image(sup_ts_gen));
+        info("  Cyclic transmission: " & boolean'image(sup_txt_cyclic));
+        info("  TX completion FIFO: " & boolean'image(sup_tx_cpl));
+        info("  Priority RX Buffer: " & boolean'image(sup_rx_prio));
         info("  Target technology: " & integer'image(target_technology));
         info("");
         info("Bit timing settings (Nominal):");
@@ -126,7 +126,18 @@ entity tb_top_ctu_can_fd is
         sup_filtB               : boolean := true;
         sup_filtC               : boolean := true;
         sup_range               : boolean := true;
+        sup_filt_set            : boolean := true;
         sup_traffic_ctrs        : boolean := true;
+        sup_rx_dma              : boolean := true;
+        sup_tx_fifo             : boolean := true;
+        tx_fifo_depth           : natural range 2 to 64 := 16;
+        tx_arb_pipeline         : boolean := true;
+        sup_int_ts              : boolean := true;
+        sup_tx_ts               : boolean := true;
+        sup_ts_gen              : boolean := false;
+        sup_txt_cyclic          : boolean := true;
+        sup_tx_cpl              : boolean := true;
+        sup_rx_prio             : boolean := true;
         target_technology       : natural := C_TECH_ASIC;
 
         -- Seed
@@ -189,7 +200,10 @@ architecture tb of tb_top_ctu_can_fd is
        seed                    : natural := 0;
        
        -- Reference test iterations
-        reference_iterations   : natural range 1 to 1000 := 1000
+        reference_iterations   : natural range 1 to 1000 := 1000;
+
+       -- Directory with reference data set files
+        reference_data_path    : string := ""
     );
     port(
        -- Test control
@@ -217,7 +231,13 @@ architecture tb of tb_top_ctu_can_fd is
        can_rx              : out   std_logic;          
 
        test_probe          : in    t_ctu_can_fd_test_probe;
-       timestamp           : out   std_logic_vector(63 DOWNTO 0) 
+       timestamp           : out   std_logic_vector(63 DOWNTO 0);
+
+       dma_m_addr          : in    std_logic_vector(31 DOWNTO 0) := (OTHERS => '0');
+       dma_m_wdata         : in    std_logic_vector(31 DOWNTO 0) := (OTHERS => '0');
+       dma_m_req           : in    std_logic := '0';
+       dma_m_ack           : out   std_logic;
+       dma_m_err           : out   std_logic
     );
     end component;
 
@@ -284,7 +304,8 @@ begin
         cfg_sjw_fd              => cfg_sjw_fd,
         
         seed                    => seed,
-        reference_iterations    => reference_iterations
+        reference_iterations    => reference_iterations,
+        reference_data_path     => tb_path(runner_cfg) & "reference_test_data_sets/"
     )
     port map(
         -- Test control
@@ -356,7 +377,18 @@ begin
         info("  Filter B: " & boolean'image(sup_filtB));
         info("  Filter C: " & boolean'image(sup_filtC));
         info("  Range filter: " & boolean'image(sup_range));
+        info("  ID set filter: " & boolean'image(sup_filt_set));
         info("  Traffic counters: " & boolean'image(sup_traffic_ctrs));
+        info("  RX DMA: " & boolean'image(sup_rx_dma));
+        info("  TXT FIFO: " & boolean'image(sup_tx_fifo));
+        info("  TXT FIFO depth: " & integer'image(tx_fifo_depth));
+        info("  TX Arbitrator pipeline: " & boolean'image(tx_arb_pipeline));
+        info("  Interrupt timestamps: " & boolean'image(sup_int_ts));
+        info("  TXT Buffer timestamps: " & boolean'image(sup_tx_ts));
+        info("  Timestamp generator: " & boolean'image(sup_ts_gen));
+        info("  Cyclic transmission: " & boolean'image(sup_txt_cyclic));
+        info("  TX completion FIFO: " & boolean'image(sup_tx_cpl));
+        info("  Priority RX Buffer: " & boolean'image(sup_rx_prio));
         info("  Target technology: " & integer'image(target_technology));
         info("");
         info("Bit timing settings (Nominal):");
@@ -1,3 +1,4 @@
+import argparse
 import yaml
 import logging
 import logging.config
@@ -25,6 +26,7 @@ def setup_logging() -> None:
 setup_logging()
 
 from . import vunit_ifc
+from . import fast_sim
 from vunit.ui import VUnit
 from .test_common import add_rtl_sources, add_post_syn_netlist, unit_configure, add_unit_sources, add_main_tb_sources, main_tb_configure, get_compile_options, dict_merge
 
@@ -71,10 +73,13 @@ def create():
 
 
 @cli.command()
+@click.option('--fast', is_flag=True,
+              help='Elaborate once per set of structural generics and run '
+                   'tests from the snapshots, longest first (GHDL only).')
 @click.argument('config', type=click.Path())
 @click.argument('vunit_args', nargs=-1)
 @click.pass_obj
-def test(obj, *, config, vunit_args):
+def test(obj, *, fast, config, vunit_args):
     """Run the tests. Configuration is passed in YAML config file.
 
     You mas pass arguments directly to VUnit by appending them at the command end.
@@ -93,6 +98,9 @@ def test(obj, *, config, vunit_args):
 
     # run all feature tests (configured in config file)\n
     ./run test tests_fast.yml 'lib.tb_feature.*'
+
+    # run tests from compiled-once snapshots on all cores\n
+    ./run test --fast tests_fast.yml -- -p`nproc`
     """
 
     base = d.parent
@@ -105,7 +113,7 @@ def test(obj, *, config, vunit_args):
     build.mkdir(exist_ok=True)
     os.chdir(str(build))
 
-    ui = create_vunit(obj, vunit_args, out_basename)
+    ui = create_vunit(obj, vunit_args, out_basename, compile_only=fast)
 
     ctu_can_fd_rtl = ui.add_library("ctu_can_fd_rtl")
     ctu_can_fd_tb = ui.add_library("ctu_can_fd_tb")
@@ -126,6 +134,7 @@ def test(obj, *, config, vunit_args):
     #ui.enable_location_preprocessing()  # (additional_subprograms=['log'])
 
     tests = []
+    tb_libs = []
     
     ###########################################################################
     # Main TB
@@ -136,6 +145,7 @@ def test(obj, *, config, vunit_args):
         # Test-bench object is automatically detected on "tb_top" due to "runner_cfg"
         tb = ctu_can_fd_tb.get_test_benches()[0]
         main_tb_configure(tb, config, build)
+        tb_libs.append(ctu_can_fd_tb)
 
     ###########################################################################
     # Unit tests
@@ -143,6 +153,7 @@ def test(obj, *, config, vunit_args):
     if ("unit" in config):
         add_unit_sources(ctu_can_fd_tb_unit, build)
         unit_configure(ctu_can_fd_tb_unit, config, build)
+        tb_libs.append(ctu_can_fd_tb_unit)
 
 
     (func_cov_dir / "html").mkdir(parents=True, exist_ok=True)
@@ -156,7 +167,10 @@ def test(obj, *, config, vunit_args):
         if config["_default"]["gate_level"]:
             ctu_can_fd_gates.set_compile_option(k, v)
 
-    res = vunit_run(ui, build, out_basename)
+    if fast:
+        res = fast_run(ui, build, out_basename, vunit_args, tb_libs)
+    else:
+        res = vunit_run(ui, build, out_basename)
 
     # Move code coverage results to stand-alone directory to avoid overwriting it by runs
     # of other configs
@@ -204,17 +218,37 @@ def test(obj, *, config, vunit_args):
     sys.exit(res)
 
 
-def create_vunit(obj, vunit_args, out_basename):
+def create_vunit(obj, vunit_args, out_basename, compile_only=False):
     # fill vunit arguments
     args = []
     # hack for vunit_compile TCL command
-    if obj['compile']:
+    if obj['compile'] or compile_only:
         args += ['--compile']
     args += ['--xunit-xml', '../{}.xml1'.format(out_basename)] + list(vunit_args)
     ui = VUnit.from_argv(args)
     return ui
 
 
+def fast_run(ui, build, out_basename, vunit_args, tb_libs) -> int:
+    # VUnit only compiles, tests are run by fast_sim. Number of jobs and
+    # test patterns are taken from VUnit arguments.
+    parser = argparse.ArgumentParser(add_help=False)
+    parser.add_argument('-p', '--num-threads', type=int, default=os.cpu_count())
+    args, rest = parser.parse_known_args(list(vunit_args))
+    patterns = [a for a in rest if not a.startswith('-')]
+
+    try:
+        vunit_ifc.run(ui)
+    except SystemExit as e:
+        if e.code:
+            return e.code
+
+    lib_dirs = {lib.name: lib.directory for lib in ui._project.get_libraries()}
+    tests = fast_sim.collect_tests(tb_libs, patterns)
+    return fast_sim.run_tests(tests, lib_dirs, build, out_basename,
+                              max(args.num_threads, 1))
+
+
 def vunit_run(ui, build, out_basename) -> int:
     try:
         vunit_ifc.run(ui)
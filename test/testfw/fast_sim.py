@@ -0,0 +1,282 @@
+"""
+Fast simulation flow for GHDL (LLVM or GCC backend).
+
+VUnit elaborates test bench for each test configuration, which dominates run
+time of short feature tests. Here VUnit is used only to compile the libraries.
+Test bench is then elaborated once per set of structural generics (and
+elaboration flags) into a snapshot executable, and each test runs this
+executable with its remaining generics overridden at run-time.
+
+Tests are scheduled on all cores, longest first, according to wall times
+recorded by previous runs.
+"""
+
+import fnmatch
+import hashlib
+import json
+import logging
+import re
+import subprocess
+import time
+from concurrent.futures import ThreadPoolExecutor, as_completed
+from pathlib import Path
+from typing import Dict, List, Tuple
+from xml.etree import ElementTree as ET
+
+__all__ = ['FastTest', 'collect_tests', 'run_tests', 'STRUCTURAL_GENERICS']
+
+log = logging.getLogger(__name__)
+
+# Generics which change structure of the design. These are fixed in the
+# snapshot, all other generics are set at run-time.
+STRUCTURAL_GENERICS = [
+    'rx_buffer_size', 'txt_buffer_count', 'sup_filtA', 'sup_filtB',
+    'sup_filtC', 'sup_range', 'sup_filt_set', 'sup_traffic_ctrs',
+    'sup_rx_dma', 'sup_tx_fifo', 'tx_fifo_depth', 'tx_arb_pipeline',
+    'sup_int_ts', 'sup_tx_ts', 'sup_ts_gen', 'sup_txt_cyclic', 'sup_tx_cpl',
+    'sup_rx_prio',
+    'target_technology',
+]
+
+TIMING_DB = 'test_wall_time.json'
+
+
+class FastTest:
+    def __init__(self, name, lib, entity, tb_path, generics, sim_options,
+                 pre_config=None, post_check=None):
+        self.name = name
+        self.lib = lib
+        self.entity = entity
+        self.tb_path = tb_path
+        self.generics = generics
+        self.sim_options = sim_options
+        self.pre_config = pre_config
+        self.post_check = post_check
+        self.passed = False
+        self.wall_time = 0.0
+        self.output = ''
+
+    def snapshot_key(self) -> Tuple:
+        struct = tuple(sorted((k, str(v)) for k, v in self.generics.items()
+                              if k in STRUCTURAL_GENERICS))
+        elab_flags = tuple(self.sim_options.get('ghdl.elab_flags', []))
+        return (self.lib, self.entity, struct, elab_flags)
+
+    def runtime_generics(self) -> Dict:
+        return {k: v for k, v in self.generics.items()
+                if k not in STRUCTURAL_GENERICS}
+
+
+def collect_tests(libs, patterns) -> List[FastTest]:
+    """
+    Collect test configurations from VUnit libraries, filtered by patterns
+    (same wildcard syntax as VUnit).
+    """
+    tests = {}
+    for lib in libs:
+        for tb in lib.get_test_benches('*', allow_empty=True):
+            tb_path = str(Path(tb._test_bench.design_unit.file_name).parent)
+            for cfgs in tb._test_bench.get_configuration_dicts():
+                for cfg_name, cfg in cfgs.items():
+                    name = '{}.{}'.format(lib.name, tb.name)
+                    if cfg_name:
+                        name += '.' + cfg_name
+                    if patterns and not any(fnmatch.fnmatch(name, p) for p in patterns):
+                        continue
+                    if name in tests:
+                        continue
+                    tests[name] = FastTest(name, lib.name, tb.name, tb_path,
+                                           dict(cfg.generics), dict(cfg.sim_options),
+                                           cfg.pre_config, cfg.post_check)
+    return list(tests.values())
+
+
+def encode_runner_cfg(output_path, tb_path) -> str:
+    # Same encoding as VUnit uses, "," in values is escaped as ",,"
+    cfg = {
+        'active python runner': 'true',
+        'enabled_test_cases': '__all__',
+        'output path': output_path.replace('\\', '/') + '/',
+        'tb path': tb_path.replace('\\', '/') + '/',
+        'use_color': 'false',
+    }
+    return ', '.join('{} : {}'.format(k, v.replace(',', ',,'))
+                     for k, v in cfg.items())
+
+
+def safe_name(name) -> str:
+    return re.sub(r'[^a-zA-Z0-9_.-]', '_', name)
+
+
+def check_ghdl_backend() -> None:
+    res = subprocess.run(['ghdl', '--version'], stdout=subprocess.PIPE,
+                         stderr=subprocess.STDOUT, check=False)
+    if b'mcode' in res.stdout:
+        raise RuntimeError('Fast simulation flow needs GHDL with LLVM or GCC '
+                           'backend, mcode can not elaborate to executable')
+
+
+def elaborate(key, lib_dirs, snapshot_dir) -> Path:
+    """
+    Elaborate snapshot executable. Elaboration is skipped when the snapshot
+    is newer than all compiled libraries.
+    """
+    lib, entity, struct, elab_flags = key
+    snapshot_dir.mkdir(parents=True, exist_ok=True)
+    exe = snapshot_dir / entity
+
+    newest = max(f.stat().st_mtime for d in lib_dirs.values()
+                 for f in Path(d).rglob('*') if f.is_file())
+    if exe.exists() and exe.stat().st_mtime > newest:
+        log.info('Reusing snapshot {}'.format(exe))
+        return exe
+
+    cmd = ['ghdl', '-e', '--std=08', '--work={}'.format(lib),
+           '--workdir={}'.format(lib_dirs[lib])]
+    cmd += ['-P{}'.format(d) for d in lib_dirs.values()]
+    cmd += list(elab_flags)
+    cmd += ['-g{}={}'.format(k, v) for k, v in struct]
+    cmd += ['-o', str(exe), entity]
+
+    log.info('Elaborating snapshot {}'.format(exe))
+    res = subprocess.run(cmd, cwd=str(snapshot_dir), stdout=subprocess.PIPE,
+                         stderr=subprocess.STDOUT, check=False)
+    if res.returncode != 0:
+        log.error(res.stdout.decode('utf-8', 'replace'))
+        raise RuntimeError('Elaboration of {} failed'.format(exe))
+    return exe
+
+
+def run_one(test, exe, build, out_root) -> FastTest:
+    out_dir = out_root / safe_name(test.name)
+    out_dir.mkdir(parents=True, exist_ok=True)
+    results = out_dir / 'vunit_results'
+    if results.exists():
+        results.unlink()
+
+    generics = test.runtime_generics()
+    generics['runner_cfg'] = encode_runner_cfg(str(out_dir), test.tb_path)
+
+    cmd = [str(exe)]
+    cmd += ['-g{}={}'.format(k, v) for k, v in generics.items()]
+    cmd += ['--assert-level=error']
+    cmd += test.sim_options.get('ghdl.sim_flags', [])
+
+    # Same as VUnit, test fails when its pre_config hook fails
+    if test.pre_config and not test.pre_config(output_path=str(out_dir)):
+        test.output = 'pre_config failed'
+        test.passed = False
+        return test
+
+    start = time.monotonic()
+    res = subprocess.run(cmd, cwd=str(build), stdout=subprocess.PIPE,
+                         stderr=subprocess.STDOUT, check=False)
+    test.wall_time = time.monotonic() - start
+    test.output = res.stdout.decode('utf-8', 'replace')
+    (out_dir / 'output.txt').write_text(test.output, encoding='utf-8')
+
+    # Pass is decided as by VUnit, test suite must report it finished
+    done = results.exists() and \
+        'test_suite_done' in results.read_text(encoding='utf-8')
+    test.passed = (res.returncode == 0) and done
+
+    # Same as VUnit, post_check hook runs after simulation
+    if test.post_check and not test.post_check(output_path=str(out_dir)):
+        test.passed = False
+    return test
+
+
+def load_timing(build) -> Dict[str, float]:
+    f = build / TIMING_DB
+    if f.exists():
+        with f.open('rt', encoding='utf-8') as fd:
+            return json.load(fd)
+    return {}
+
+
+def store_timing(build, timing) -> None:
+    with (build / TIMING_DB).open('wt', encoding='utf-8') as fd:
+        json.dump(timing, fd, indent=1, sort_keys=True)
+
+
+def write_report(tests, report) -> None:
+    tests = sorted(tests, key=lambda t: t.wall_time, reverse=True)
+    with report.open('wt', encoding='utf-8') as f:
+        print('{:>10}  {:4}  {}'.format('wall [s]', '', 'test'), file=f)
+        for t in tests:
+            print('{:10.2f}  {:4}  {}'.format(
+                t.wall_time, 'pass' if t.passed else 'FAIL', t.name), file=f)
+        print('{:10.2f}  {:4}  {}'.format(
+            sum(t.wall_time for t in tests), '', 'total (sum of all tests)'),
+            file=f)
+
+
+def write_xunit(tests, xunit) -> None:
+    suite = ET.Element('testsuite', {
+        'name': '', 'tests': str(len(tests)), 'errors': '0', 'skipped': '0',
+        'failures': str(sum(1 for t in tests if not t.passed))})
+    for t in tests:
+        classname, _, name = t.name.rpartition('.')
+        case = ET.SubElement(suite, 'testcase', {
+            'classname': classname, 'name': name,
+            'time': '{:.1f}'.format(t.wall_time)})
+        if not t.passed:
+            ET.SubElement(case, 'failure', {'message': 'Failed'})
+        ET.SubElement(case, 'system-out').text = t.output
+    with xunit.open('wt', encoding='utf-8') as f:
+        print('<?xml version="1.0" encoding="utf-8"?>', file=f)
+        print('<?xml-stylesheet href="xunit.xsl" type="text/xsl"?>', file=f)
+        f.write(ET.tostring(suite, encoding='unicode'))
+
+
+def run_tests(tests, lib_dirs, build, out_basename, jobs) -> int:
+    """
+    Elaborate snapshots and run tests in parallel. Returns exit code.
+    """
+    check_ghdl_backend()
+
+    out_root = build / 'vunit_out' / 'test_output'
+    snap_root = build / 'vunit_out' / 'snapshots'
+
+    keys = {t.snapshot_key() for t in tests}
+    log.info('{} tests, {} snapshots, {} jobs'.format(len(tests), len(keys), jobs))
+
+    exes = {}
+    with ThreadPoolExecutor(max_workers=jobs) as pool:
+        futures = {}
+        for key in keys:
+            h = hashlib.sha1(repr(key).encode('utf-8')).hexdigest()[:12]
+            futures[pool.submit(elaborate, key, lib_dirs, snap_root / h)] = key
+        for fut in as_completed(futures):
+            exes[futures[fut]] = fut.result()
+
+    # Longest processing time first. Tests without recorded time are expected
+    # to be long, so they are started first too.
+    timing = load_timing(build)
+    default = max(timing.values(), default=0.0)
+    tests = sorted(tests, key=lambda t: timing.get(t.name, default), reverse=True)
+
+    start = time.monotonic()
+    with ThreadPoolExecutor(max_workers=jobs) as pool:
+        futures = [pool.submit(run_one, t, exes[t.snapshot_key()], build, out_root)
+                   for t in tests]
+        for i, fut in enumerate(as_completed(futures)):
+            t = fut.result()
+            timing[t.name] = round(t.wall_time, 2)
+            lvl = logging.INFO if t.passed else logging.ERROR
+            log.log(lvl, '({}/{}) {} ({:.1f} s) {}'.format(
+                i + 1, len(tests), 'pass' if t.passed else 'fail',
+                t.wall_time, t.name))
+    elapsed = time.monotonic() - start
+
+    store_timing(build, timing)
+    write_report(tests, build / '../{}_wall_time.txt'.format(out_basename))
+    write_xunit(tests, build / '../{}.xml'.format(out_basename))
+
+    failed = [t.name for t in tests if not t.passed]
+    log.info('Total wall time {:.1f} s, sum of test wall times {:.1f} s'.format(
+        elapsed, sum(t.wall_time for t in tests)))
+    for name in failed:
+        log.error('Failed: {}'.format(name))
+
+    return 1 if failed else 0
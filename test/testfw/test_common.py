@@ -10,6 +10,9 @@ import random
 from typing import List, Tuple
 import copy
 import re
+import os
+import shlex
+import subprocess
 
 __all__ = ['add_sources', 'add_rtl_sources', 'add_tb_sources',
            'dict_merge', 'vhdl_serialize', 'dump_sim_options',
@@ -153,6 +156,57 @@ def add_psl_cov_sim_opt(name, cfg, build) -> OptionsDict:
     return OptionsDict({"ghdl.sim_flags": sim_flags})
 
 
+def hal_cosim_hooks(cfg, build):
+    """
+    Returns pre_config and post_check hooks of HAL co-simulation test.
+    pre_config creates named pipes and starts HAL program, which connects to
+    the simulation via them (see driver/ctucanfd_cosim.h). post_check reaps
+    the HAL program once simulation is over, so that it does not outlive the
+    test run.
+    """
+    procs = []
+
+    def pre_config(output_path) -> bool:
+        cosim_dir = build / "hal_cosim"
+        cosim_dir.mkdir(exist_ok=True)
+        for fifo in ["req", "resp"]:
+            if (cosim_dir / fifo).exists():
+                (cosim_dir / fifo).unlink()
+            os.mkfifo(str(cosim_dir / fifo))
+
+        cmd = shlex.split(cfg['cosim_client'])
+        cmd[0] = str(d.parent / cmd[0])
+        if not os.access(cmd[0], os.X_OK):
+            log.error('HAL co-simulation program {} not found, build it by '
+                      '"make hal_cosim_client"'.format(cmd[0]))
+            return False
+
+        env = dict(os.environ)
+        env['CTUCANFD_COSIM'] = str(cosim_dir)
+        env['CTUCANFD_COSIM_REPORT'] = str(Path(output_path) / "hal_cosim_report.txt")
+        if 'cosim_budget' in cfg:
+            env['CTUCANFD_COSIM_BUDGET'] = str(d.parent / cfg['cosim_budget'])
+
+        log.info('Starting HAL co-simulation program: {}'.format(' '.join(cmd)))
+        procs.append(subprocess.Popen(cmd, env=env, stdout=subprocess.DEVNULL))
+        return True
+
+    def post_check(output_path) -> bool:
+        while procs:
+            proc = procs.pop()
+            # HAL program exits by itself when simulation closes the pipes,
+            # kill it if it hangs.
+            try:
+                proc.wait(timeout=5)
+            except subprocess.TimeoutExpired:
+                log.warning('HAL co-simulation program did not exit, killing it')
+                proc.kill()
+                proc.wait()
+        return True
+
+    return pre_config, post_check
+
+
 def add_sources(lib, patterns) -> None:
     """
     Adds source files to Vunits lib which are matching pattern (recursively).
@@ -238,6 +292,7 @@ def add_main_tb_sources(lib, config) -> None:
     sources.append('main_tb/agents/interrupt_agent/*.vhd');
     sources.append('main_tb/agents/can_agent/*.vhd');
     sources.append('main_tb/agents/test_probe_agent/*.vhd');
+    sources.append('main_tb/agents/dma_memory_agent/*.vhd');
     sources.append('main_tb/agents/test_controller_agent/*.vhd');
 
     # Test specific agents
@@ -248,9 +303,6 @@ def add_main_tb_sources(lib, config) -> None:
     # Feature test implementations
     sources.append('main_tb/feature_tests/*.vhd');
 
-    # Reference tests
-    sources.append('main_tb/reference_test_data_sets/*.vhd');
-
     # VIP top and TB top
     sources.append('main_tb/ctu_can_fd_vip.vhd');
     #sources.append('main_tb/vunit_manager.vhd');
@@ -310,7 +362,18 @@ def main_tb_configure(tb, config, build) -> None:
                 'sup_filtB'             : loc_cfg['sup_filtB'],
                 'sup_filtC'             : loc_cfg['sup_filtC'],
                 'sup_range'             : loc_cfg['sup_range'],
+                'sup_filt_set'          : loc_cfg['sup_filt_set'],
                 'sup_traffic_ctrs'      : loc_cfg['sup_traffic_ctrs'],
+                'sup_rx_dma'            : loc_cfg['sup_rx_dma'],
+                'sup_tx_fifo'           : loc_cfg['sup_tx_fifo'],
+                'tx_fifo_depth'         : loc_cfg['tx_fifo_depth'],
+                'tx_arb_pipeline'       : loc_cfg['tx_arb_pipeline'],
+                'sup_int_ts'            : loc_cfg['sup_int_ts'],
+                'sup_tx_ts'             : loc_cfg['sup_tx_ts'],
+                'sup_ts_gen'            : loc_cfg['sup_ts_gen'],
+                'sup_txt_cyclic'        : loc_cfg['sup_txt_cyclic'],
+                'sup_tx_cpl'            : loc_cfg['sup_tx_cpl'],
+                'sup_rx_prio'           : loc_cfg['sup_rx_prio'],
                 'target_technology'     : loc_cfg['target_technology'],
 
                 'log_level'             : "verbosity_" + loc_cfg['log_level'],
@@ -327,8 +390,16 @@ def main_tb_configure(tb, config, build) -> None:
                 par_val = list(test_cfg.values())[0]
                 config_name += "@{}_{}".format(par_name, par_val)
 
+            # HAL co-simulation needs HAL program running along simulation
+            pre_config = None
+            post_check = None
+            if ('cosim_client' in loc_cfg):
+                pre_config, post_check = hal_cosim_hooks(loc_cfg, build)
+
             # Check if such test was not added, if yes, add local_config as suffix
-            tb.add_config("{}.{}".format(test_type, config_name), generics=generics, sim_options=loc_opts)
+            tb.add_config("{}.{}".format(test_type, config_name), generics=generics,
+                          sim_options=loc_opts, pre_config=pre_config,
+                          post_check=post_check)
 
 
 def dict_merge(up, *lowers) -> None:
@@ -0,0 +1,550 @@
+--------------------------------------------------------------------------------
+-- 
+-- CTU CAN FD IP Core 
+-- Copyright (C) 2021-present Ondrej Ille
+-- 
+-- Permission is hereby granted, free of charge, to any person obtaining a copy
+-- of this VHDL component and associated documentation files (the "Component"),
+-- to use, copy, modify, merge, publish, distribute the Component for
+-- educational, research, evaluation, self-interest purposes. Using the
+-- Component for commercial purposes is forbidden unless previously agreed with
+-- Copyright holder.
+-- 
+-- The above copyright notice and this permission notice shall be included in
+-- all copies or substantial portions of the Component.
+-- 
+-- THE COMPONENT IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+-- IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+-- FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+-- AUTHORS OR COPYRIGHTHOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+-- LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+-- FROM, OUT OF OR IN CONNECTION WITH THE COMPONENT OR THE USE OR OTHER DEALINGS
+-- IN THE COMPONENT.
+-- 
+-- The CAN protocol is developed by Robert Bosch GmbH and protected by patents.
+-- Anybody who wants to implement this IP core on silicon has to obtain a CAN
+-- protocol license from Bosch.
+-- 
+-- -------------------------------------------------------------------------------
+-- 
+-- CTU CAN FD IP Core 
+-- Copyright (C) 2015-2020 MIT License
+-- 
+-- Authors:
+--     Ondrej Ille <ondrej.ille@gmail.com>
+--     Martin Jerabek <martin.jerabek01@gmail.com>
+-- 
+-- Project advisors: 
+-- 	Jiri Novak <jnovak@fel.cvut.cz>
+-- 	Pavel Pisa <pisa@cmp.felk.cvut.cz>
+-- 
+-- Department of Measurement         (http://meas.fel.cvut.cz/)
+-- Faculty of Electrical Engineering (http://www.fel.cvut.cz)
+-- Czech Technical University        (http://www.cvut.cz/)
+-- 
+-- Permission is hereby granted, free of charge, to any person obtaining a copy
+-- of this VHDL component and associated documentation files (the "Component"),
+-- to deal in the Component without restriction, including without limitation
+-- the rights to use, copy, modify, merge, publish, distribute, sublicense,
+-- and/or sell copies of the Component, and to permit persons to whom the
+-- Component is furnished to do so, subject to the following conditions:
+-- 
+-- The above copyright notice and this permission notice shall be included in
+-- all copies or substantial portions of the Component.
+-- 
+-- THE COMPONENT IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+-- IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+-- FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+-- AUTHORS OR COPYRIGHTHOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+-- LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+-- FROM, OUT OF OR IN CONNECTION WITH THE COMPONENT OR THE USE OR OTHER DEALINGS
+-- IN THE COMPONENT.
+-- 
+-- The CAN protocol is developed by Robert Bosch GmbH and protected by patents.
+-- Anybody who wants to implement this IP core on silicon has to obtain a CAN
+-- protocol license from Bosch.
+-- 
+--------------------------------------------------------------------------------
+--------------------------------------------------------------------------------
+-- @TestInfoStart
+--
+-- @Purpose:
+--  Simple test of can_top_axi, performing register read/write via AXI4.
+--
+-- @Verifies:
+--  @1. 64-bit read transactions return two registers in single beat.
+--  @2. Write transactions with byte strobes, only lanes with strobes set are
+--      written.
+--  @3. 32-bit and 16-bit (narrow) transactions.
+--  @4. INCR burst write to TXT Buffer data area and INCR / WRAP burst reads.
+--  @5. IDs are returned in BID / RID, response is always OKAY.
+--
+-- @Test sequence:
+--  @1. Read DEVICE_ID by 64-bit read, check lower half and compare upper half
+--      with 32-bit read of MODE.
+--  @2. Write BTR by 32-bit and 16-bit writes with various strobes, read it
+--      back. Set all interrupt masks, write BTR by 64-bit write with strobes
+--      of BTR lane only, check that INT_MASK_CLR lane was not written.
+--  @3. Write BTR and BTR_FD, read them by INCR burst of two 64-bit beats and
+--      by WRAP burst which starts in the middle of wrap boundary.
+--  @4. Write TXT Buffer 1 by INCR burst of four 64-bit beats. Enable test mode
+--      and read TXT Buffer memory via test registers, check all words.
+--
+-- @TestInfoEnd
+--------------------------------------------------------------------------------
+
+library ieee;
+use ieee.std_logic_1164.all;
+use ieee.numeric_std.ALL;
+use ieee.math_real.ALL;
+use ieee.std_logic_textio.all;
+use STD.textio.all;
+
+library ctu_can_fd_rtl;
+use ctu_can_fd_rtl.id_transfer_pkg.all;
+use ctu_can_fd_rtl.can_constants_pkg.all;
+
+use ctu_can_fd_rtl.can_types_pkg.all;
+use ctu_can_fd_rtl.drv_stat_pkg.all;
+use ctu_can_fd_rtl.unary_ops_pkg.all;
+use ctu_can_fd_rtl.can_config_pkg.all;
+use ctu_can_fd_rtl.CAN_FD_register_map.all;
+use ctu_can_fd_rtl.CAN_FD_frame_format.all;
+
+library ctu_can_fd_tb_unit;
+use ctu_can_fd_tb_unit.can_unit_test_pkg.all;
+use ctu_can_fd_tb_unit.random_unit_pkg.all;
+
+library vunit_lib;
+context vunit_lib.vunit_context;
+
+
+architecture axi_unit_test of CAN_test is
+
+    constant ID_WIDTH       : natural := 4;
+
+    -- Burst types
+    constant BURST_FIXED    : std_logic_vector(1 downto 0) := "00";
+    constant BURST_INCR     : std_logic_vector(1 downto 0) := "01";
+    constant BURST_WRAP     : std_logic_vector(1 downto 0) := "10";
+
+    -- Beat sizes
+    constant SIZE_16        : std_logic_vector(2 downto 0) := "001";
+    constant SIZE_32        : std_logic_vector(2 downto 0) := "010";
+    constant SIZE_64        : std_logic_vector(2 downto 0) := "011";
+
+    type t_axi_beats is array (0 to 15) of std_logic_vector(63 downto 0);
+
+    signal s_axi_awid       : std_logic_vector(ID_WIDTH - 1 downto 0);
+    signal s_axi_awaddr     : std_logic_vector(31 downto 0);
+    signal s_axi_awlen      : std_logic_vector(7 downto 0);
+    signal s_axi_awsize     : std_logic_vector(2 downto 0);
+    signal s_axi_awburst    : std_logic_vector(1 downto 0);
+    signal s_axi_awvalid    : std_logic;
+    signal s_axi_awready    : std_logic;
+    signal s_axi_wdata      : std_logic_vector(63 downto 0);
+    signal s_axi_wstrb      : std_logic_vector(7 downto 0);
+    signal s_axi_wlast      : std_logic;
+    signal s_axi_wvalid     : std_logic;
+    signal s_axi_wready     : std_logic;
+    signal s_axi_bid        : std_logic_vector(ID_WIDTH - 1 downto 0);
+    signal s_axi_bresp      : std_logic_vector(1 downto 0);
+    signal s_axi_bvalid     : std_logic;
+    signal s_axi_bready     : std_logic;
+    signal s_axi_arid       : std_logic_vector(ID_WIDTH - 1 downto 0);
+    signal s_axi_araddr     : std_logic_vector(31 downto 0);
+    signal s_axi_arlen      : std_logic_vector(7 downto 0);
+    signal s_axi_arsize     : std_logic_vector(2 downto 0);
+    signal s_axi_arburst    : std_logic_vector(1 downto 0);
+    signal s_axi_arvalid    : std_logic;
+    signal s_axi_arready    : std_logic;
+    signal s_axi_rid        : std_logic_vector(ID_WIDTH - 1 downto 0);
+    signal s_axi_rdata      : std_logic_vector(63 downto 0);
+    signal s_axi_rresp      : std_logic_vector(1 downto 0);
+    signal s_axi_rlast      : std_logic;
+    signal s_axi_rvalid     : std_logic;
+    signal s_axi_rready     : std_logic;
+
+    signal aclk : std_logic := '0';
+    signal arstn : std_logic := '0';
+
+begin
+    can_inst : entity ctu_can_fd_rtl.can_top_axi
+        generic map (
+            rx_buffer_size      => 128,
+            txt_buffer_count    => 4,
+            sup_filtA           => false,
+            sup_filtB           => false,
+            sup_filtC           => false,
+            sup_range           => false,
+            sup_test_registers  => true,
+            axi_id_width        => ID_WIDTH
+        )
+        port map (
+            CAN_rx           => '1',
+            timestamp        => (others => '0'),
+            aclk             => aclk,
+            arstn            => arstn,
+
+            scan_enable      => '0',
+
+            -- AXI ports
+            s_axi_awid       => s_axi_awid,
+            s_axi_awaddr     => s_axi_awaddr,
+            s_axi_awlen      => s_axi_awlen,
+            s_axi_awsize     => s_axi_awsize,
+            s_axi_awburst    => s_axi_awburst,
+            s_axi_awlock     => '0',
+            s_axi_awcache    => "0011",
+            s_axi_awprot     => "000",
+            s_axi_awvalid    => s_axi_awvalid,
+            s_axi_awready    => s_axi_awready,
+            s_axi_wdata      => s_axi_wdata,
+            s_axi_wstrb      => s_axi_wstrb,
+            s_axi_wlast      => s_axi_wlast,
+            s_axi_wvalid     => s_axi_wvalid,
+            s_axi_wready     => s_axi_wready,
+            s_axi_bid        => s_axi_bid,
+            s_axi_bresp      => s_axi_bresp,
+            s_axi_bvalid     => s_axi_bvalid,
+            s_axi_bready     => s_axi_bready,
+            s_axi_arid       => s_axi_arid,
+            s_axi_araddr     => s_axi_araddr,
+            s_axi_arlen      => s_axi_arlen,
+            s_axi_arsize     => s_axi_arsize,
+            s_axi_arburst    => s_axi_arburst,
+            s_axi_arlock     => '0',
+            s_axi_arcache    => "0011",
+            s_axi_arprot     => "000",
+            s_axi_arvalid    => s_axi_arvalid,
+            s_axi_arready    => s_axi_arready,
+            s_axi_rid        => s_axi_rid,
+            s_axi_rdata      => s_axi_rdata,
+            s_axi_rresp      => s_axi_rresp,
+            s_axi_rlast      => s_axi_rlast,
+            s_axi_rvalid     => s_axi_rvalid,
+            s_axi_rready     => s_axi_rready
+        );
+
+    aclk <= not aclk after 100 ns;
+
+    main_proc : process
+        variable rd_beats   : t_axi_beats;
+        variable wr_beats   : t_axi_beats;
+        variable data       : std_logic_vector(31 downto 0);
+        variable txn_id     : unsigned(ID_WIDTH - 1 downto 0) := (others => '0');
+
+        -----------------------------------------------------------------------
+        -- Byte strobes of single beat, as generated by master.
+        -----------------------------------------------------------------------
+        function beat_strb(
+            constant addr : std_logic_vector(11 downto 0);
+            constant size : std_logic_vector(2 downto 0)
+        ) return std_logic_vector is
+            variable res  : std_logic_vector(7 downto 0) := (others => '0');
+            variable low  : natural;
+            variable cnt  : natural;
+        begin
+            cnt := 2 ** to_integer(unsigned(size));
+            low := to_integer(unsigned(addr(2 downto 0))) / cnt * cnt;
+            for i in 0 to cnt - 1 loop
+                res(low + i) := '1';
+            end loop;
+            return res;
+        end function;
+
+        -----------------------------------------------------------------------
+        -- Burst write. Data of each beat shall be on lanes given by its
+        -- address. Strobes are generated from address and size and masked by
+        -- 'strb_mask'.
+        -----------------------------------------------------------------------
+        procedure axi_write(
+            constant addr      : std_logic_vector(11 downto 0);
+            constant len       : natural;
+            constant size      : std_logic_vector(2 downto 0);
+            constant burst     : std_logic_vector(1 downto 0);
+            constant beats     : t_axi_beats;
+            constant strb_mask : std_logic_vector(7 downto 0) := x"FF"
+        ) is
+            variable i         : natural := 0;
+            variable beat_addr : unsigned(11 downto 0);
+        begin
+            txn_id := txn_id + 1;
+            s_axi_awid <= std_logic_vector(txn_id);
+            s_axi_awaddr <= (others => '0');
+            s_axi_awaddr(11 downto 0) <= addr;
+            s_axi_awlen <= std_logic_vector(to_unsigned(len - 1, 8));
+            s_axi_awsize <= size;
+            s_axi_awburst <= burst;
+            s_axi_awvalid <= '1';
+            L_AW: loop
+                wait until rising_edge(aclk);
+                exit L_AW when s_axi_awready = '1';
+                i := i + 1;
+                check(i < 5, "Write address not accepted.");
+            end loop;
+            s_axi_awvalid <= '0';
+
+            beat_addr := unsigned(addr);
+            for beat in 0 to len - 1 loop
+                s_axi_wdata <= beats(beat);
+                s_axi_wstrb <= beat_strb(std_logic_vector(beat_addr), size) and
+                               strb_mask;
+                if (beat = len - 1) then
+                    s_axi_wlast <= '1';
+                else
+                    s_axi_wlast <= '0';
+                end if;
+                s_axi_wvalid <= '1';
+                i := 0;
+                L_W: loop
+                    wait until rising_edge(aclk);
+                    exit L_W when s_axi_wready = '1';
+                    i := i + 1;
+                    check(i < 5, "Write data not accepted.");
+                end loop;
+                if (burst /= BURST_FIXED) then
+                    beat_addr := beat_addr + 2 ** to_integer(unsigned(size));
+                end if;
+            end loop;
+            s_axi_wvalid <= '0';
+            s_axi_wlast <= '0';
+
+            s_axi_bready <= '1';
+            i := 0;
+            L_B: loop
+                wait until rising_edge(aclk);
+                exit L_B when s_axi_bvalid = '1';
+                i := i + 1;
+                check(i < 5, "Write response not returned.");
+            end loop;
+            s_axi_bready <= '0';
+            check(s_axi_bid = std_logic_vector(txn_id), "BID mismatch");
+            check(s_axi_bresp = "00", "BRESP not OKAY");
+        end procedure;
+
+        -----------------------------------------------------------------------
+        -- Burst read. Data of beats are stored to 'rd_beats'.
+        -----------------------------------------------------------------------
+        procedure axi_read(
+            constant addr      : std_logic_vector(11 downto 0);
+            constant len       : natural;
+            constant size      : std_logic_vector(2 downto 0);
+            constant burst     : std_logic_vector(1 downto 0)
+        ) is
+            variable i         : natural := 0;
+        begin
+            txn_id := txn_id + 1;
+            s_axi_arid <= std_logic_vector(txn_id);
+            s_axi_araddr <= (others => '0');
+            s_axi_araddr(11 downto 0) <= addr;
+            s_axi_arlen <= std_logic_vector(to_unsigned(len - 1, 8));
+            s_axi_arsize <= size;
+            s_axi_arburst <= burst;
+            s_axi_arvalid <= '1';
+            L_AR: loop
+                wait until rising_edge(aclk);
+                exit L_AR when s_axi_arready = '1';
+                i := i + 1;
+                check(i < 5, "Read address not accepted.");
+            end loop;
+            s_axi_arvalid <= '0';
+
+            s_axi_rready <= '1';
+            for beat in 0 to len - 1 loop
+                i := 0;
+                L_R: loop
+                    wait until rising_edge(aclk);
+                    exit L_R when s_axi_rvalid = '1';
+                    i := i + 1;
+                    check(i < 10, "Read data not returned.");
+                end loop;
+                rd_beats(beat) := s_axi_rdata;
+                check(s_axi_rid = std_logic_vector(txn_id), "RID mismatch");
+                check(s_axi_rresp = "00", "RRESP not OKAY");
+                if (beat = len - 1) then
+                    check(s_axi_rlast = '1', "RLAST not set on last beat");
+                else
+                    check(s_axi_rlast = '0', "RLAST set before last beat");
+                end if;
+            end loop;
+            s_axi_rready <= '0';
+        end procedure;
+
+        -----------------------------------------------------------------------
+        -- Single 32-bit access, data are placed on lane given by address.
+        -----------------------------------------------------------------------
+        procedure axi_write32(
+            constant addr      : std_logic_vector(11 downto 0);
+            constant data      : std_logic_vector(31 downto 0);
+            constant be        : std_logic_vector(3 downto 0)
+        ) is
+            variable beats     : t_axi_beats := (others => (others => '0'));
+        begin
+            beats(0) := data & data;
+            if (addr(2) = '0') then
+                axi_write(addr, 1, SIZE_32, BURST_INCR, beats, x"0" & be);
+            else
+                axi_write(addr, 1, SIZE_32, BURST_INCR, beats, be & x"0");
+            end if;
+        end procedure;
+
+        procedure axi_read32(
+            constant addr      : std_logic_vector(11 downto 0);
+            variable data      : out std_logic_vector(31 downto 0)
+        ) is
+        begin
+            axi_read(addr, 1, SIZE_32, BURST_INCR);
+            if (addr(2) = '0') then
+                data := rd_beats(0)(31 downto 0);
+            else
+                data := rd_beats(0)(63 downto 32);
+            end if;
+        end procedure;
+
+        procedure axi_test_pattern(
+            constant addr      : std_logic_vector(11 downto 0);
+            constant pattern   : std_logic_vector(31 downto 0)
+        ) is
+            variable data      : std_logic_vector(31 downto 0);
+        begin
+            axi_write32(addr, pattern, b"1111");
+            axi_read32(addr, data);
+            check(data = pattern, "pattern " & to_hstring(pattern) &
+                  " mismatch: got " & to_hstring(data));
+        end procedure;
+
+    begin
+        s_axi_awvalid  <= '0';
+        s_axi_wvalid   <= '0';
+        s_axi_wlast    <= '0';
+        s_axi_bready   <= '0';
+        s_axi_arvalid  <= '0';
+        s_axi_rready   <= '0';
+
+        info("Restarting AXI test");
+        status         <= waiting;
+        if not run then wait until run; end if;
+        print_test_info(iterations, log_level, error_beh, error_tol);
+        wait until rising_edge(aclk); -- some time in reset
+        arstn     <= '1';
+        status    <= running;
+        error_ctr <= 0;
+
+        wait until rising_edge(aclk);
+        wait until rising_edge(aclk);
+        wait until rising_edge(aclk);
+
+        -----------------------------------------------------------------------
+        -- @1. Read DEVICE_ID by 64-bit read, check lower half and compare
+        --     upper half with 32-bit read of MODE.
+        -----------------------------------------------------------------------
+        info("Step 1: 64-bit read");
+        axi_read(DEVICE_ID_ADR, 1, SIZE_64, BURST_INCR);
+        check(rd_beats(0)(31 downto 0) = x"0204CAFD",
+              "CAN ID reg mismatch (64-bit read)");
+        axi_read32(MODE_ADR, data);
+        check(rd_beats(0)(63 downto 32) = data,
+              "MODE reg mismatch (64-bit read)");
+
+        -----------------------------------------------------------------------
+        -- @2. Write BTR by 32-bit and 16-bit writes with various strobes, read
+        --     it back. Write BTR by 64-bit write with strobes of BTR lane only.
+        -----------------------------------------------------------------------
+        info("Step 2: Narrow writes and strobes");
+        axi_write32(BTR_ADR, x"FFFFFFFF", b"1111");
+        axi_read32(DEVICE_ID_ADR, data);
+        check(data = x"0204CAFD", "CAN ID reg mismatch");
+        axi_read32(BTR_ADR, data);
+        check(data = x"FFFFFFFF", "readback mismatch");
+
+        axi_write32(BTR_ADR, x"00000000", b"0011");
+        axi_read32(BTR_ADR, data);
+        check(data = x"FFFF0000", "write low word: readback mismatch");
+
+        axi_write32(BTR_ADR, x"FFFFFFFF", b"1111");
+        wr_beats(0) := x"0000ABCD" & x"00000000";
+        axi_write(std_logic_vector(unsigned(BTR_ADR) + 2), 1, SIZE_16,
+                  BURST_INCR, wr_beats);
+        axi_read32(BTR_ADR, data);
+        check(data = x"0000FFFF", "16-bit write high word: readback mismatch");
+
+        axi_test_pattern(BTR_ADR, x"AAAAAAAA");
+        axi_test_pattern(BTR_ADR, x"55555555");
+        axi_test_pattern(BTR_ADR, x"92492492");
+        axi_test_pattern(BTR_ADR, x"49249249");
+        axi_test_pattern(BTR_ADR, x"24924924");
+
+        -- INT_MASK_CLR shares 64-bit word with BTR, only BTR lane is strobed.
+        axi_write32(INT_MASK_SET_ADR, x"0000FFFF", b"1111");
+        wr_beats(0) := x"87654321" & x"FFFFFFFF";
+        axi_write(INT_MASK_CLR_ADR, 1, SIZE_64, BURST_INCR, wr_beats, x"F0");
+        axi_read(INT_MASK_CLR_ADR, 1, SIZE_64, BURST_INCR);
+        check(rd_beats(0)(63 downto 32) = x"87654321",
+              "64-bit write: BTR readback mismatch");
+        axi_read32(INT_MASK_SET_ADR, data);
+        check(data = x"0000FFFF", "64-bit write: INT_MASK_CLR lane written");
+
+        -----------------------------------------------------------------------
+        -- @3. Write BTR and BTR_FD, read them by INCR burst of two 64-bit
+        --     beats and by WRAP burst.
+        -----------------------------------------------------------------------
+        info("Step 3: INCR and WRAP burst reads");
+        axi_write32(BTR_ADR, x"12345678", b"1111");
+        axi_write32(BTR_FD_ADR, x"0A0B0C0D", b"1111");
+        axi_read32(BTR_FD_ADR, data);
+
+        axi_read(INT_MASK_CLR_ADR, 2, SIZE_64, BURST_INCR);
+        check(rd_beats(0)(63 downto 32) = x"12345678",
+              "INCR burst: BTR mismatch");
+        check(rd_beats(1)(31 downto 0) = data,
+              "INCR burst: BTR_FD mismatch");
+
+        axi_read(BTR_FD_ADR, 2, SIZE_64, BURST_WRAP);
+        check(rd_beats(0)(31 downto 0) = data,
+              "WRAP burst: BTR_FD mismatch");
+        check(rd_beats(1)(63 downto 32) = x"12345678",
+              "WRAP burst: BTR mismatch");
+
+        -----------------------------------------------------------------------
+        -- @4. Write TXT Buffer 1 by INCR burst of four 64-bit beats. Read TXT
+        --     Buffer memory via test registers.
+        -----------------------------------------------------------------------
+        info("Step 4: INCR burst write to TXT Buffer");
+        for i in 0 to 3 loop
+            wr_beats(i) := std_logic_vector(to_unsigned(2 * i + 1, 8)) &
+                           x"C0FFEE" &
+                           std_logic_vector(to_unsigned(2 * i, 8)) &
+                           x"C0FFEE";
+        end loop;
+        axi_write(TXTB1_DATA_1_ADR, 4, SIZE_64, BURST_INCR, wr_beats);
+
+        axi_read32(MODE_ADR, data);
+        data(TSTM_IND) := '1';
+        axi_write32(MODE_ADR, data, b"1111");
+        data := (others => '0');
+        data(TMAENA_IND) := '1';
+        axi_write32(TST_CONTROL_ADR, data, b"1111");
+
+        for i in 0 to 7 loop
+            data := (others => '0');
+            data(TST_ADDR_H downto TST_ADDR_L) :=
+                std_logic_vector(to_unsigned(i, 16));
+            data(TST_MTGT_H downto TST_MTGT_L) := TMTGT_TXTBUF1;
+            axi_write32(TST_DEST_ADR, data, b"1111");
+            wait until rising_edge(aclk);
+
+            axi_read32(TST_RDATA_ADR, data);
+            check(data = std_logic_vector(to_unsigned(i, 8)) & x"C0FFEE",
+                  "TXT Buffer word " & integer'image(i) & " mismatch: got " &
+                  to_hstring(data));
+        end loop;
+
+        wait until aclk;
+        wait until aclk;
+        wait until aclk;
+        wait until aclk;
+
+        evaluate_test(error_tol, error_ctr, status);
+    end process;
+end architecture;
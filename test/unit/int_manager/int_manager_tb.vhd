@@ -75,6 +75,8 @@
 -- @Verifies:
 --  @1. Interrupt enable, Interrupt mask and capturing of interrupts by Interrupt
 --      Manager module.
+--  @2. Timestamp is latched when interrupt becomes pending and latched
+--      timestamp selected by INT_TS_SEL is provided on output.
 --
 -- @Test sequence:
 --  @1. Generate random setting of Interrupt manager module (Interrupt enables,
@@ -82,6 +84,8 @@
 --  @2. Generate random inputs to Interrupt manager. Calculate expected results
 --      of Interrupt manager (SW model).
 --  @3. Compare results of Interrupt manager with SW model.
+--  @4. Select random interrupt by INT_TS_SEL and compare its latched
+--      timestamp with SW model.
 --
 -- @Notes:
 --  Random interrupt source signals are generated in the testbench. Periodically
@@ -96,6 +100,7 @@
 --    6.6.2016   Created file
 --   19.4.2018   Modified testbench to be compliant with separation of interrupt
 --               set, Interrupt clear and interrupt mask separation.
+--   19.10.2026  Added check of interrupt pending timestamps.
 --------------------------------------------------------------------------------
 
 library ieee;
@@ -169,6 +174,18 @@ architecture int_manager_unit_test of CAN_test is
     -- Overload frame is being transmitted
     signal is_overload       :   std_logic;
 
+    -- RX DMA finished batch of frames
+    signal rx_dma_int        :   std_logic;
+
+    -- Number of frames in TXT FIFO dropped to threshold
+    signal tx_fifo_int       :   std_logic;
+
+    -- Frame stored to Priority RX Buffer
+    signal rec_valid_p       :   std_logic := '0';
+
+    -- Priority RX Buffer empty
+    signal rxp_empty         :   std_logic := '1';
+
     ----------------------------------------------
     -- Status signals
     ----------------------------------------------
@@ -177,6 +194,7 @@ architecture int_manager_unit_test of CAN_test is
     signal int_mask               :   std_logic_vector(C_INT_COUNT - 1 downto 0);
 
     signal int                :   std_logic;
+    signal int_ts                 :   std_logic_vector(31 downto 0);
 
     ----------------------------------------------
     -- Internal testbench signals
@@ -214,6 +232,19 @@ architecture int_manager_unit_test of CAN_test is
 
     signal int_out_exp            :   std_logic;
 
+    -- Timestamp (counts clock cycles) and expected latched timestamps
+    signal timestamp              :   std_logic_vector(63 downto 0) :=
+                                          (OTHERS => '0');
+
+    type t_int_ts_array is array (0 to C_INT_COUNT - 1) of
+        std_logic_vector(31 downto 0);
+
+    signal int_ts_exp             :   t_int_ts_array :=
+                                          (OTHERS => (OTHERS => '0'));
+
+    signal drv_int_ts_sel         :   std_logic_vector(3 downto 0) :=
+                                          (OTHERS => '0');
+
     ----------------------------------------------------------------------------
     -- Generates random interrupt sources
     ----------------------------------------------------------------------------
@@ -254,7 +285,15 @@ architecture int_manager_unit_test of CAN_test is
         signal txtb_hw_cmd_int        :inout   std_logic_vector(C_TXT_BUFFER_COUNT - 1
                                                                 downto 0);
 
-        signal is_overload            :inout   std_logic 
+        signal is_overload            :inout   std_logic;
+
+        signal rx_dma_int             :inout   std_logic;
+
+        signal tx_fifo_int            :inout   std_logic;
+
+        signal rec_valid_p            :inout   std_logic;
+
+        signal rxp_empty              :inout   std_logic
     )is
         variable tmp                  :        std_logic;
     begin
@@ -324,6 +363,30 @@ architecture int_manager_unit_test of CAN_test is
             rand_logic_s(rand_ctr, is_overload, 0.05);            
         end if;
 
+        if (rx_dma_int = '1') then
+            rand_logic_s(rand_ctr, rx_dma_int, 0.95);
+        else
+            rand_logic_s(rand_ctr, rx_dma_int, 0.05);
+        end if;
+
+        if (tx_fifo_int = '1') then
+            rand_logic_s(rand_ctr, tx_fifo_int, 0.95);
+        else
+            rand_logic_s(rand_ctr, tx_fifo_int, 0.05);
+        end if;
+
+        if (rec_valid_p = '1') then
+            rand_logic_s(rand_ctr, rec_valid_p, 0.95);
+        else
+            rand_logic_s(rand_ctr, rec_valid_p, 0.05);
+        end if;
+
+        if (rxp_empty = '0') then
+            rand_logic_s(rand_ctr, rxp_empty, 0.95);
+        else
+            rand_logic_s(rand_ctr, rxp_empty, 0.05);
+        end if;
+
         for i in 0 to C_TXT_BUFFER_COUNT - 1 loop
             if (txtb_hw_cmd_int(i) = '1') then
                 rand_logic_v(rand_ctr, tmp, 0.95);
@@ -388,7 +451,8 @@ begin
     ----------------------------------------------------------------------------
     int_manager_comp : entity ctu_can_fd_rtl.int_manager
     GENERIC map(
-        G_INT_COUNT           => C_INT_COUNT
+        G_INT_COUNT           => C_INT_COUNT,
+        G_SUP_INT_TS          => true
     )
     PORT map(
         clk_sys               =>   clk_sys,
@@ -405,11 +469,17 @@ begin
         rec_valid             =>   rec_valid ,
         rx_full               =>   rx_full,
         is_overload           =>   is_overload,
+        rx_dma_int            =>   rx_dma_int,
+        tx_fifo_int           =>   tx_fifo_int,
+        rec_valid_p           =>   rec_valid_p,
+        rxp_empty             =>   rxp_empty,
+        timestamp             =>   timestamp,
         drv_bus               =>   drv_bus ,
         int                   =>   int,
         int_vector            =>   int_vector,
         int_mask              =>   int_mask,
-        int_ena               =>   int_ena
+        int_ena               =>   int_ena,
+        int_ts                =>   int_ts
     );
 
     -- Joining interrupt inputs to interrupt status
@@ -424,6 +494,10 @@ begin
     int_input(BSI_IND)            <=  br_shifted;
     int_input(RBNEI_IND)          <=  not rx_empty;
     int_input(OFI_IND)            <=  is_overload;
+    int_input(DMAI_IND)           <=  rx_dma_int;
+    int_input(TFTI_IND)           <=  tx_fifo_int;
+    int_input(RXPI_IND)           <=  rec_valid_p;
+    int_input(RPNEI_IND)          <=  not rxp_empty;
     int_input(TXBHCI_IND)         <=  or_reduce(txtb_hw_cmd_int);
 
 
@@ -449,7 +523,8 @@ begin
             generate_sources(rand_ctr_1, err_detected, fcs_changed ,
                            err_warning_limit , arbitration_lost, tran_valid,
                            br_shifted, rx_data_overrun , rec_valid ,
-                           rx_full , rx_empty, txtb_hw_cmd_int, is_overload);
+                           rx_full , rx_empty, txtb_hw_cmd_int, is_overload,
+                           rx_dma_int, tx_fifo_int, rec_valid_p, rxp_empty);
         end loop;
     end process;
 
@@ -472,6 +547,19 @@ begin
     drv_bus(DRV_INT_MASK_CLR_HIGH downto DRV_INT_MASK_CLR_LOW)
             <= drv_int_mask_clear;
 
+    drv_bus(DRV_INT_TS_SEL_HIGH downto DRV_INT_TS_SEL_LOW)
+            <= drv_int_ts_sel;
+
+
+    ----------------------------------------------------------------------------
+    -- Timestamp generation
+    ----------------------------------------------------------------------------
+    timestamp_gen_proc : process
+    begin
+        wait until rising_edge(clk_sys);
+        timestamp <= std_logic_vector(unsigned(timestamp) + 1);
+    end process;
+
 
     ----------------------------------------------------------------------------
     -- Calculate expected outputs
@@ -506,6 +594,13 @@ begin
                 int_mask_exp(i) <= '0';
             end if;
 
+            -- Timestamp is latched when interrupt becomes pending
+            if (int_input(i) = '1' and int_mask_exp(i) = '0' and
+                (int_status_exp(i) = '0' or drv_int_clear(i) = '1'))
+            then
+                int_ts_exp(i) <= timestamp(31 downto 0);
+            end if;
+
             if (int_input(i) = '1' and int_mask_exp(i) = '0') then
                 int_status_exp(i) <= '1';
             elsif (drv_int_clear(i) = '1') then
@@ -518,6 +613,8 @@ begin
         check(int_ena = int_ena_exp, "Interrupt enable mismatch");
         check(int_mask = int_mask_exp, "Interrupt mask mismatch");
         check(int_vector = int_status_exp, "Interrupt vector mismatch");
+        check(int_ts = int_ts_exp(to_integer(unsigned(drv_int_ts_sel))),
+              "Interrupt timestamp mismatch");
         
         -- Calculating expected interrupt output
         if ((int_vector AND int_ena_exp) = zeroes) then
@@ -550,6 +647,7 @@ begin
     ----------------------------------------------------------------------------
     test_proc : process
         variable outcome : boolean := false;
+        variable ts_sel  : natural;
     begin
         info("Restarting Interrupt test!");
         wait for 5 ns;
@@ -573,6 +671,10 @@ begin
               generate_commands(drv_int_clear, drv_int_ena_set,
                                 drv_int_ena_clear, drv_int_mask_set,
                                 drv_int_mask_clear, rand_ctr);
+
+              -- Select interrupt whose timestamp is checked
+              rand_int_v(rand_ctr, C_INT_COUNT - 1, ts_sel);
+              drv_int_ts_sel <= std_logic_vector(to_unsigned(ts_sel, 4));
               wait for 50 ns;
 
               -- Errors are evaluated in separate process.
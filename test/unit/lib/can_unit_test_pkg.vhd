@@ -197,6 +197,9 @@ package can_unit_test_pkg is
         drv_filter_ran_lo_th    :   std_logic_vector(28 downto 0);
         drv_filter_ran_hi_th    :   std_logic_vector(28 downto 0);
 
+        -- ID set filter control bits
+        drv_filter_set_ctrl     :   std_logic_vector(3 downto 0);
+
         -- Filters are enabled
         drv_filters_ena         :   std_logic;
 
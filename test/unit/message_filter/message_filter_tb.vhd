@@ -75,14 +75,17 @@
 -- @Verifies:
 --  @1. Bit filter functionality (Filter value and filter mask).
 --  @2. Range filter functionality (Low and High thresholds).
+--  @3. ID set filter functionality (Base ID bitmap, Extended ID hash table).
 --
 -- @Test sequence:
---  @1. Generate random bit values, bit masks for bit filters and low-high
+--  @1. Program random Base ID bitmap and insert random Extended identifiers
+--      to hash table of ID set filter. Keep SW model of both memories.
+--  @2. Generate random bit values, bit masks for bit filters and low-high
 --      thresholds for range filter.
---  @2. Generate random CAN ID and frame and identifier type on input of Frame
---      filters.
---  @3. Calculate whether frame shall pass filters (SW model).
---  @4. Check whether output of frame filters equals to output of SW model.
+--  @3. Generate random CAN ID and frame and identifier type on input of Frame
+--      filters. Use identifier stored in hash table in part of iterations.
+--  @4. Calculate whether frame shall pass filters (SW model).
+--  @5. Check whether output of frame filters equals to output of SW model.
 --
 -- @TestInfoEnd
 --------------------------------------------------------------------------------
@@ -142,7 +145,74 @@ architecture message_filter_unit_test of CAN_test is
                         ((OTHERS => '0'), (OTHERS => '0'),(OTHERS => '0'),
                          (OTHERS => '0'), (OTHERS => '0'),(OTHERS => '0'),
                          (OTHERS => '0'), (OTHERS => '0'),(OTHERS => '0'),
-                         (OTHERS => '0'), (OTHERS => '0'),(OTHERS => '0'), '0');
+                         (OTHERS => '0'), (OTHERS => '0'),(OTHERS => '0'),
+                         (OTHERS => '0'), '0');
+
+    -- ID set filter memories (SW model)
+    constant C_SET_HASH_DEPTH : natural := 2 ** C_FILT_SET_HASH_WIDTH;
+
+    type t_set_hash_table is array (0 to C_SET_HASH_DEPTH - 1) of
+        std_logic_vector(31 downto 0);
+
+    type t_set_ext_ids is array (0 to 31) of std_logic_vector(28 downto 0);
+
+    signal set_bitmap         : std_logic_vector(2047 downto 0) :=
+                                    (OTHERS => '0');
+    signal set_hash           : t_set_hash_table := (OTHERS => (OTHERS => '0'));
+
+    -- Extended identifiers inserted to hash table
+    signal set_ext_ids        : t_set_ext_ids := (OTHERS => (OTHERS => '0'));
+    signal set_ext_cnt        : natural := 0;
+
+    -- ID set filter memory write interface
+    signal set_wr             : std_logic := '0';
+    signal set_tsel           : std_logic := '0';
+    signal set_addr           : std_logic_vector(9 downto 0) := (OTHERS => '0');
+    signal set_data           : std_logic_vector(31 downto 0) := (OTHERS => '0');
+
+    ----------------------------------------------------------------------------
+    -- Hash index of identifier (XOR-fold to hash table address width)
+    ----------------------------------------------------------------------------
+    function set_hash_index(
+        ident           :   std_logic_vector(28 downto 0)
+    ) return natural is
+        variable index  :   std_logic_vector(C_FILT_SET_HASH_WIDTH - 1 downto 0);
+    begin
+        index := (OTHERS => '0');
+        for i in 0 to 28 loop
+            index(i mod C_FILT_SET_HASH_WIDTH) :=
+                index(i mod C_FILT_SET_HASH_WIDTH) xor ident(i);
+        end loop;
+        return to_integer(unsigned(index));
+    end function;
+
+    ----------------------------------------------------------------------------
+    -- Identifier is in the set (SW model of ID set filter)
+    ----------------------------------------------------------------------------
+    function set_lookup(
+        frame_info      :   mess_filter_input_type;
+        bitmap          :   std_logic_vector(2047 downto 0);
+        hash_table      :   t_set_hash_table
+    ) return boolean is
+        variable entry  :   std_logic_vector(31 downto 0);
+        variable index  :   natural;
+    begin
+        if (frame_info.ident_type = BASE) then
+            return bitmap(to_integer(unsigned(
+                        frame_info.rec_ident_in(28 downto 18)))) = '1';
+        end if;
+
+        index := set_hash_index(frame_info.rec_ident_in);
+        for k in 0 to C_FILT_SET_PROBE_LEN - 1 loop
+            entry := hash_table((index + k) mod C_SET_HASH_DEPTH);
+            if (entry(31) = '1' and
+                entry(28 downto 0) = frame_info.rec_ident_in)
+            then
+                return true;
+            end if;
+        end loop;
+        return false;
+    end function;
 
     procedure generate_input(
         signal rand_ctr        :inout natural range 0 to RAND_POOL_SIZE;
@@ -176,6 +246,8 @@ architecture message_filter_unit_test of CAN_test is
         rand_logic_vect_s  (rand_ctr, drv_settings.drv_filter_ran_lo_th, 0.40);
         rand_logic_vect_s  (rand_ctr, drv_settings.drv_filter_ran_ctrl,  0.50);
 
+        rand_logic_vect_s  (rand_ctr, drv_settings.drv_filter_set_ctrl,  0.50);
+
         rand_logic_s       (rand_ctr, drv_settings.drv_filters_ena, 0.9);
     end procedure;
 
@@ -183,7 +255,8 @@ architecture message_filter_unit_test of CAN_test is
     impure function validate(
         signal drv_settings   :in     mess_filter_drv_type;
         signal filt_res       :in     std_logic;
-        signal frame_info     :in     mess_filter_input_type)
+        signal frame_info     :in     mess_filter_input_type;
+        constant set_vals     :in     boolean)
     return boolean is
         variable join         :       std_logic_vector(1 downto 0);
         variable ctrl         :       std_logic_vector(3 downto 0);
@@ -191,6 +264,7 @@ architecture message_filter_unit_test of CAN_test is
         variable B_type       :       boolean;
         variable C_type       :       boolean;
         variable ran_type     :       boolean;
+        variable set_type     :       boolean;
         variable A_vals       :       boolean;
         variable B_vals       :       boolean;
         variable C_vals       :       boolean;
@@ -223,6 +297,7 @@ architecture message_filter_unit_test of CAN_test is
         B_type :=  not ((ctrl and drv_settings.drv_filter_B_ctrl) = "0000");
         C_type :=  not ((ctrl and drv_settings.drv_filter_C_ctrl) = "0000");
         ran_type :=  not ((ctrl and drv_settings.drv_filter_ran_ctrl) = "0000");
+        set_type :=  not ((ctrl and drv_settings.drv_filter_set_ctrl) = "0000");
 
         A_vals := ((frame_info.rec_ident_in and
                   drv_settings.drv_filter_A_mask)
@@ -267,6 +342,7 @@ architecture message_filter_unit_test of CAN_test is
               (B_type = true)    or
               (C_type = true)    or
               (ran_type = true)  or
+              (set_type = true)  or
               (filt_res = '0'),
               "No filter should have valid frame type, but output is valid!");
 
@@ -276,7 +352,8 @@ architecture message_filter_unit_test of CAN_test is
         if(((A_type and  A_vals) or
            (B_type and B_vals) or
            (C_type and C_vals) or
-           (ran_type and ran_vals))
+           (ran_type and ran_vals) or
+           (set_type and set_vals))
           and
            (drv_settings.drv_filters_ena = '1')
         ) then
@@ -368,6 +445,14 @@ begin
     drv_bus(DRV_FILTER_RAN_HI_TH_HIGH downto DRV_FILTER_RAN_HI_TH_LOW) <=
         drv_settings.drv_filter_ran_hi_th;
 
+    drv_bus(DRV_FILTER_SET_CTRL_HIGH downto DRV_FILTER_SET_CTRL_LOW) <=
+        drv_settings.drv_filter_set_ctrl;
+
+    drv_bus(DRV_FILTER_SET_WR_INDEX) <= set_wr;
+    drv_bus(DRV_FILTER_SET_TSEL_INDEX) <= set_tsel;
+    drv_bus(DRV_FILTER_SET_ADDR_HIGH downto DRV_FILTER_SET_ADDR_LOW) <= set_addr;
+    drv_bus(DRV_FILTER_SET_DATA_HIGH downto DRV_FILTER_SET_DATA_LOW) <= set_data;
+
     drv_bus(DRV_FILTERS_ENA_INDEX) <=
         drv_settings.drv_filters_ena;
 
@@ -385,6 +470,28 @@ begin
     ----------------------------------------------------------------------------
     ----------------------------------------------------------------------------
     test_proc : process
+        variable hash_v       : t_set_hash_table;
+        variable bmp_word     : std_logic_vector(31 downto 0);
+        variable ext_id       : std_logic_vector(28 downto 0);
+        variable index        : natural;
+        variable pick         : natural;
+        variable hit_ext      : std_logic;
+        variable set_vals     : boolean;
+
+        -- Write word to ID set filter memory
+        procedure write_set_word(
+            constant tsel     : in std_logic;
+            constant addr     : in natural;
+            constant data     : in std_logic_vector(31 downto 0)
+        ) is
+        begin
+            set_tsel <= tsel;
+            set_addr <= std_logic_vector(to_unsigned(addr, 10));
+            set_data <= data;
+            set_wr <= '1';
+            wait until rising_edge(clk_sys);
+            set_wr <= '0';
+        end procedure;
     begin
         info("Restarting Message filter test!");
         wait for 5 ns;
@@ -393,6 +500,39 @@ begin
         info("Restarted Message filter test");
         print_test_info(iterations, log_level, error_beh, error_tol);
 
+        -------------------------------
+        -- Program ID set filter
+        -------------------------------
+        info("Programming ID set filter memories");
+        for i in 0 to 63 loop
+            rand_logic_vect_v(rand_ctr, bmp_word, 0.3);
+            set_bitmap(i * 32 + 31 downto i * 32) <= bmp_word;
+            write_set_word(FSET_TSEL_BITMAP, i, bmp_word);
+        end loop;
+
+        hash_v := (OTHERS => (OTHERS => '0'));
+        for i in 0 to C_SET_HASH_DEPTH - 1 loop
+            write_set_word(FSET_TSEL_HASH, i, x"00000000");
+        end loop;
+
+        for i in 0 to set_ext_ids'length - 1 loop
+            rand_logic_vect_v(rand_ctr, ext_id, 0.5);
+            index := set_hash_index(ext_id);
+            for k in 0 to C_FILT_SET_PROBE_LEN - 1 loop
+                if (hash_v((index + k) mod C_SET_HASH_DEPTH)(31) = '0') then
+                    hash_v((index + k) mod C_SET_HASH_DEPTH) := "100" & ext_id;
+                    write_set_word(FSET_TSEL_HASH,
+                                   (index + k) mod C_SET_HASH_DEPTH,
+                                   "100" & ext_id);
+                    set_ext_ids(set_ext_cnt) <= ext_id;
+                    set_ext_cnt <= set_ext_cnt + 1;
+                    wait for 0 ns;
+                    exit;
+                end if;
+            end loop;
+        end loop;
+        set_hash <= hash_v;
+
         -------------------------------
         -- Main loop of the test
         -------------------------------
@@ -405,9 +545,21 @@ begin
             generate_input    (rand_ctr, frame_info);
             generate_setting  (rand_ctr, drv_settings);
 
-            wait for 10 ns;
+            -- Use identifier from hash table in part of iterations, random
+            -- Extended identifier would hardly ever hit it.
+            rand_logic_v(rand_ctr, hit_ext, 0.3);
+            if (hit_ext = '1' and set_ext_cnt > 0) then
+                rand_int_v(rand_ctr, 31, pick);
+                frame_info.rec_ident_in <= set_ext_ids(pick mod set_ext_cnt);
+                frame_info.ident_type <= EXTENDED;
+            end if;
+
+            -- Wait until ID set filter lookup is finished
+            wait for 100 ns;
 
-            if (validate(drv_settings, out_ident_valid, frame_info) = false)
+            set_vals := set_lookup(frame_info, set_bitmap, set_hash);
+            if (validate(drv_settings, out_ident_valid, frame_info,
+                         set_vals) = false)
             then
                 process_error(error_ctr, error_beh, exit_imm);
             end if;
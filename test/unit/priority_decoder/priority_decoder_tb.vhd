@@ -0,0 +1,290 @@
+--------------------------------------------------------------------------------
+-- 
+-- CTU CAN FD IP Core 
+-- Copyright (C) 2021-present Ondrej Ille
+-- 
+-- Permission is hereby granted, free of charge, to any person obtaining a copy
+-- of this VHDL component and associated documentation files (the "Component"),
+-- to use, copy, modify, merge, publish, distribute the Component for
+-- educational, research, evaluation, self-interest purposes. Using the
+-- Component for commercial purposes is forbidden unless previously agreed with
+-- Copyright holder.
+-- 
+-- The above copyright notice and this permission notice shall be included in
+-- all copies or substantial portions of the Component.
+-- 
+-- THE COMPONENT IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+-- IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+-- FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+-- AUTHORS OR COPYRIGHTHOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+-- LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+-- FROM, OUT OF OR IN CONNECTION WITH THE COMPONENT OR THE USE OR OTHER DEALINGS
+-- IN THE COMPONENT.
+-- 
+-- The CAN protocol is developed by Robert Bosch GmbH and protected by patents.
+-- Anybody who wants to implement this IP core on silicon has to obtain a CAN
+-- protocol license from Bosch.
+-- 
+-- -------------------------------------------------------------------------------
+-- 
+-- CTU CAN FD IP Core 
+-- Copyright (C) 2015-2020 MIT License
+-- 
+-- Authors:
+--     Ondrej Ille <ondrej.ille@gmail.com>
+--     Martin Jerabek <martin.jerabek01@gmail.com>
+-- 
+-- Project advisors: 
+-- 	Jiri Novak <jnovak@fel.cvut.cz>
+-- 	Pavel Pisa <pisa@cmp.felk.cvut.cz>
+-- 
+-- Department of Measurement         (http://meas.fel.cvut.cz/)
+-- Faculty of Electrical Engineering (http://www.fel.cvut.cz)
+-- Czech Technical University        (http://www.cvut.cz/)
+-- 
+-- Permission is hereby granted, free of charge, to any person obtaining a copy
+-- of this VHDL component and associated documentation files (the "Component"),
+-- to deal in the Component without restriction, including without limitation
+-- the rights to use, copy, modify, merge, publish, distribute, sublicense,
+-- and/or sell copies of the Component, and to permit persons to whom the
+-- Component is furnished to do so, subject to the following conditions:
+-- 
+-- The above copyright notice and this permission notice shall be included in
+-- all copies or substantial portions of the Component.
+-- 
+-- THE COMPONENT IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+-- IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+-- FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+-- AUTHORS OR COPYRIGHTHOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+-- LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+-- FROM, OUT OF OR IN CONNECTION WITH THE COMPONENT OR THE USE OR OTHER DEALINGS
+-- IN THE COMPONENT.
+-- 
+-- The CAN protocol is developed by Robert Bosch GmbH and protected by patents.
+-- Anybody who wants to implement this IP core on silicon has to obtain a CAN
+-- protocol license from Bosch.
+-- 
+--------------------------------------------------------------------------------
+
+--------------------------------------------------------------------------------
+-- @TestInfoStart
+--
+-- @Purpose:
+--  Unit test for Priority decoder circuit.
+--
+-- @Verifies:
+--  @1. Priority decoder selects valid TXT Buffer with highest priority. If
+--      more buffers have the same priority, buffer with lowest index is
+--      selected. This is the behavior of former fixed 8-input decoder (4+2+1
+--      comparators), so 8-input configuration is equivalent to it.
+--  @2. Priority decoder selects correct buffer for 2, 8, 16 and 32 buffers,
+--      with and without pipeline.
+--  @3. Pipelined priority decoder never selects buffer which is not valid.
+--
+-- @Test sequence:
+--  @1. Generate random priorities and valid flags (with random probability
+--      of valid buffer). Wait one clock cycle (pipeline latency) and check
+--      output of each configuration against behavioral model.
+--  @2. Invalidate buffer selected by each configuration and check output of
+--      pipelined configuration does not select it in the same clock cycle.
+--
+-- @TestInfoEnd
+--------------------------------------------------------------------------------
+-- Revision History:
+--   19.10.2026   Created file
+--------------------------------------------------------------------------------
+
+library ieee;
+use ieee.std_logic_1164.all;
+use ieee.numeric_std.ALL;
+use ieee.math_real.ALL;
+use ieee.std_logic_textio.all;
+use STD.textio.all;
+
+library ctu_can_fd_rtl;
+use ctu_can_fd_rtl.id_transfer_pkg.all;
+use ctu_can_fd_rtl.can_constants_pkg.all;
+
+use ctu_can_fd_rtl.can_types_pkg.all;
+use ctu_can_fd_rtl.drv_stat_pkg.all;
+use ctu_can_fd_rtl.unary_ops_pkg.all;
+use ctu_can_fd_rtl.can_config_pkg.all;
+use ctu_can_fd_rtl.CAN_FD_register_map.all;
+use ctu_can_fd_rtl.CAN_FD_frame_format.all;
+
+library ctu_can_fd_tb_unit;
+use ctu_can_fd_tb_unit.can_unit_test_pkg.all;
+use ctu_can_fd_tb_unit.random_unit_pkg.all;
+
+library vunit_lib;
+context vunit_lib.vunit_context;
+
+architecture priority_decoder_unit_test of CAN_test is
+
+    -- Maximal number of TXT Buffers
+    constant C_MAX_BUFS             :    natural := 32;
+
+    -- Tested configurations
+    constant C_CFG_COUNT            :    natural := 8;
+
+    type t_cfg_count_array is array (0 to C_CFG_COUNT - 1) of natural;
+    type t_cfg_pipe_array is array (0 to C_CFG_COUNT - 1) of boolean;
+
+    constant C_CFG_BUF_COUNT        :    t_cfg_count_array :=
+        (2, 2, 8, 8, 16, 16, 32, 32);
+    constant C_CFG_PIPELINE         :    t_cfg_pipe_array :=
+        (false, true, false, true, false, true, false, true);
+
+    -- System clock and reset
+    signal clk_sys                  :    std_logic := '0';
+    signal res_n                    :    std_logic := '0';
+
+    -- Inputs (shared by all configurations, each takes lowest buffers)
+    signal prio                     :    t_txt_bufs_priorities(C_MAX_BUFS - 1 downto 0) :=
+                                            (OTHERS => (OTHERS => '0'));
+    signal prio_valid               :    std_logic_vector(C_MAX_BUFS - 1 downto 0) :=
+                                            (OTHERS => '0');
+
+    -- Outputs of each configuration
+    type t_index_array is array (0 to C_CFG_COUNT - 1) of
+        natural range 0 to C_MAX_BUFS - 1;
+
+    signal output_valid             :    std_logic_vector(C_CFG_COUNT - 1 downto 0);
+    signal output_index             :    t_index_array;
+
+    ----------------------------------------------------------------------------
+    -- Behavioral model: valid buffer with highest priority, lowest index wins
+    -- on equal priorities. Returns -1 if no buffer is valid.
+    ----------------------------------------------------------------------------
+    function prio_dec_model(
+        constant prio       : t_txt_bufs_priorities;
+        constant prio_valid : std_logic_vector;
+        constant buf_count  : natural
+    ) return integer is
+        variable sel : integer := -1;
+    begin
+        for i in 0 to buf_count - 1 loop
+            if (prio_valid(i) = '1') then
+                if (sel = -1) then
+                    sel := i;
+                elsif (unsigned(prio(i)) > unsigned(prio(sel))) then
+                    sel := i;
+                end if;
+            end if;
+        end loop;
+        return sel;
+    end function;
+
+begin
+
+    ----------------------------------------------------------------------------
+    -- DUTs
+    ----------------------------------------------------------------------------
+    dut_gen : for i in 0 to C_CFG_COUNT - 1 generate
+        signal index : natural range 0 to C_CFG_BUF_COUNT(i) - 1;
+    begin
+        priority_decoder_inst : entity ctu_can_fd_rtl.priority_decoder
+        generic map(
+            G_TXT_BUFFER_COUNT  => C_CFG_BUF_COUNT(i),
+            G_PIPELINE          => C_CFG_PIPELINE(i)
+        )
+        port map(
+            clk_sys             => clk_sys,
+            res_n               => res_n,
+            prio                => prio(C_CFG_BUF_COUNT(i) - 1 downto 0),
+            prio_valid          => prio_valid(C_CFG_BUF_COUNT(i) - 1 downto 0),
+            output_valid        => output_valid(i),
+            output_index        => index
+        );
+
+        output_index(i) <= index;
+    end generate;
+
+    ----------------------------------------------------------------------------
+    -- Clock generation
+    ----------------------------------------------------------------------------
+    clock_gen_proc(period => f100_Mhz, duty => 50, epsilon_ppm => 0,
+                   out_clk => clk_sys);
+
+    ----------------------------------------------------------------------------
+    -- Main test process
+    ----------------------------------------------------------------------------
+    test_proc : process
+        variable prob       : real;
+        variable tmp_prio   : std_logic_vector(2 downto 0);
+        variable tmp_valid  : std_logic;
+        variable exp_index  : integer;
+    begin
+        info("Restarting Priority decoder test!");
+        wait for 5 ns;
+        reset_test(res_n, status, run, error_ctr);
+        apply_rand_seed(seed, 0, rand_ctr);
+        info("Restarted Priority decoder test");
+        print_test_info(iterations, log_level, error_beh, error_tol);
+
+        while (loop_ctr < iterations or exit_imm)
+        loop
+            info("Starting loop nr " & integer'image(loop_ctr));
+
+            --------------------------------------------------------------------
+            -- @1. Random inputs, check all configurations.
+            --------------------------------------------------------------------
+            info("Step 1");
+            rand_real_v(rand_ctr, prob);
+            wait until falling_edge(clk_sys);
+            for i in 0 to C_MAX_BUFS - 1 loop
+                rand_logic_vect_v(rand_ctr, tmp_prio, 0.5);
+                rand_logic_v(rand_ctr, tmp_valid, prob);
+                prio(i) <= tmp_prio;
+                prio_valid(i) <= tmp_valid;
+            end loop;
+
+            -- Pipeline latency
+            wait until falling_edge(clk_sys);
+
+            for i in 0 to C_CFG_COUNT - 1 loop
+                exp_index := prio_dec_model(prio, prio_valid, C_CFG_BUF_COUNT(i));
+                if (exp_index = -1) then
+                    check(output_valid(i) = '0',
+                          "Config " & integer'image(i) & ": output valid " &
+                          "with no valid buffer!");
+                else
+                    check(output_valid(i) = '1',
+                          "Config " & integer'image(i) & ": output not valid!");
+                    check(output_index(i) = exp_index,
+                          "Config " & integer'image(i) & ": index: " &
+                          integer'image(output_index(i)) & " Expected: " &
+                          integer'image(exp_index));
+                end if;
+            end loop;
+
+            --------------------------------------------------------------------
+            -- @2. Invalidate selected buffers, pipelined decoders must not
+            --     select them in the same cycle.
+            --------------------------------------------------------------------
+            info("Step 2");
+            for i in 0 to C_CFG_COUNT - 1 loop
+                if (output_valid(i) = '1') then
+                    prio_valid(output_index(i)) <= '0';
+                end if;
+            end loop;
+            wait for 1 ns;
+
+            for i in 0 to C_CFG_COUNT - 1 loop
+                if (output_valid(i) = '1') then
+                    check(prio_valid(output_index(i)) = '1',
+                          "Config " & integer'image(i) & ": selected " &
+                          "buffer which is not valid!");
+                end if;
+            end loop;
+
+            loop_ctr <= loop_ctr + 1;
+            wait for 10 ns;
+        end loop;
+
+        evaluate_test(error_tol, error_ctr, status);
+    end process;
+
+    errors <= error_ctr;
+
+end architecture;
@@ -616,6 +616,7 @@ begin
         sof_pulse                => sof_pulse,
         timestamp                => timestamp,
         drv_bus                  => drv_bus,
+        dma_read_start           => '0',
         rx_buf_size              => rx_buf_size,
         rx_full                  => rx_full,
         rx_empty                 => rx_empty,
@@ -0,0 +1,504 @@
+--------------------------------------------------------------------------------
+-- 
+-- CTU CAN FD IP Core 
+-- Copyright (C) 2021-present Ondrej Ille
+-- 
+-- Permission is hereby granted, free of charge, to any person obtaining a copy
+-- of this VHDL component and associated documentation files (the "Component"),
+-- to use, copy, modify, merge, publish, distribute the Component for
+-- educational, research, evaluation, self-interest purposes. Using the
+-- Component for commercial purposes is forbidden unless previously agreed with
+-- Copyright holder.
+-- 
+-- The above copyright notice and this permission notice shall be included in
+-- all copies or substantial portions of the Component.
+-- 
+-- THE COMPONENT IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+-- IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+-- FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+-- AUTHORS OR COPYRIGHTHOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+-- LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+-- FROM, OUT OF OR IN CONNECTION WITH THE COMPONENT OR THE USE OR OTHER DEALINGS
+-- IN THE COMPONENT.
+-- 
+-- The CAN protocol is developed by Robert Bosch GmbH and protected by patents.
+-- Anybody who wants to implement this IP core on silicon has to obtain a CAN
+-- protocol license from Bosch.
+-- 
+-- -------------------------------------------------------------------------------
+-- 
+-- CTU CAN FD IP Core 
+-- Copyright (C) 2015-2020 MIT License
+-- 
+-- Authors:
+--     Ondrej Ille <ondrej.ille@gmail.com>
+--     Martin Jerabek <martin.jerabek01@gmail.com>
+-- 
+-- Project advisors: 
+-- 	Jiri Novak <jnovak@fel.cvut.cz>
+-- 	Pavel Pisa <pisa@cmp.felk.cvut.cz>
+-- 
+-- Department of Measurement         (http://meas.fel.cvut.cz/)
+-- Faculty of Electrical Engineering (http://www.fel.cvut.cz)
+-- Czech Technical University        (http://www.cvut.cz/)
+-- 
+-- Permission is hereby granted, free of charge, to any person obtaining a copy
+-- of this VHDL component and associated documentation files (the "Component"),
+-- to deal in the Component without restriction, including without limitation
+-- the rights to use, copy, modify, merge, publish, distribute, sublicense,
+-- and/or sell copies of the Component, and to permit persons to whom the
+-- Component is furnished to do so, subject to the following conditions:
+-- 
+-- The above copyright notice and this permission notice shall be included in
+-- all copies or substantial portions of the Component.
+-- 
+-- THE COMPONENT IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+-- IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+-- FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+-- AUTHORS OR COPYRIGHTHOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+-- LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+-- FROM, OUT OF OR IN CONNECTION WITH THE COMPONENT OR THE USE OR OTHER DEALINGS
+-- IN THE COMPONENT.
+-- 
+-- The CAN protocol is developed by Robert Bosch GmbH and protected by patents.
+-- Anybody who wants to implement this IP core on silicon has to obtain a CAN
+-- protocol license from Bosch.
+-- 
+--------------------------------------------------------------------------------
+
+--------------------------------------------------------------------------------
+-- @TestInfoStart
+--
+-- @Purpose:
+--  Unit test for the RX DMA circuit.
+--
+-- @Verifies:
+--  @1. Frames are moved from RX Buffer to ring of slots in system memory in
+--      the same format as read from RX_DATA.
+--  @2. Producer index is incremented after frame was written, and RX DMA
+--      does not overwrite slots which were not consumed yet (ring full).
+--  @3. Interrupt is signalled after RX_DMA_CTRL[RDBATCH] frames were moved.
+--  @4. Bus error stops RX DMA, frame is drained from RX Buffer and it is not
+--      committed. Disabling RX DMA clears RDBERR and Producer index.
+--
+-- @Test sequence:
+--  @1. Configure random ring size, base address, batch size and timeout.
+--      Enable RX DMA.
+--  @2. Store random frames to RX Buffer model with random gaps in between.
+--      Memory model acknowledges writes with random latency.
+--  @3. Consume frames from ring with random delays (as SW would do), compare
+--      content of each slot with frame stored to RX Buffer model and increment
+--      Consumer index.
+--  @4. Check number of interrupts when timeout is disabled.
+--  @5. Store one more frame to RX Buffer model, and answer write of its third
+--      word with error. Check RDBERR is set, Producer index did not change, and
+--      frame was read out of RX Buffer model. Disable RX DMA and check that
+--      RDBERR and Producer index were cleared.
+--
+-- @Notes:
+--  RX Buffer is replaced by simple model which holds frames as they are read
+--  from RX_DATA.
+--
+-- @TestInfoEnd
+--------------------------------------------------------------------------------
+-- Revision History:
+--   19.10.2026   Created file
+--------------------------------------------------------------------------------
+
+library ieee;
+use ieee.std_logic_1164.all;
+use ieee.numeric_std.ALL;
+use ieee.math_real.ALL;
+use ieee.std_logic_textio.all;
+use STD.textio.all;
+
+library ctu_can_fd_rtl;
+use ctu_can_fd_rtl.id_transfer_pkg.all;
+use ctu_can_fd_rtl.can_constants_pkg.all;
+
+use ctu_can_fd_rtl.can_types_pkg.all;
+use ctu_can_fd_rtl.drv_stat_pkg.all;
+use ctu_can_fd_rtl.unary_ops_pkg.all;
+use ctu_can_fd_rtl.can_config_pkg.all;
+use ctu_can_fd_rtl.CAN_FD_register_map.all;
+use ctu_can_fd_rtl.CAN_FD_frame_format.all;
+
+library ctu_can_fd_tb_unit;
+use ctu_can_fd_tb_unit.can_unit_test_pkg.all;
+use ctu_can_fd_tb_unit.random_unit_pkg.all;
+
+use ctu_can_fd_rtl.can_registers_pkg.all;
+
+library vunit_lib;
+context vunit_lib.vunit_context;
+
+architecture rx_dma_unit_test of CAN_test is
+
+    -- System clock and reset
+    signal clk_sys                  :    std_logic := '0';
+    signal res_n                    :    std_logic := '0';
+
+    -- Control and status signals to/from SW
+    signal drv_bus                  :    std_logic_vector(1023 downto 0) :=
+                                            (OTHERS => '0');
+    signal rx_dma_prod              :    std_logic_vector(11 downto 0);
+    signal rx_dma_act               :    std_logic;
+    signal rx_dma_berr              :    std_logic;
+    signal rx_dma_int               :    std_logic;
+
+    -- RX Buffer interface
+    signal rx_read_buff             :    std_logic_vector(31 downto 0);
+    signal rx_empty                 :    std_logic;
+    signal dma_read_start           :    std_logic;
+
+    -- Bus master interface
+    signal dma_m_addr               :    std_logic_vector(31 downto 0);
+    signal dma_m_wdata              :    std_logic_vector(31 downto 0);
+    signal dma_m_req                :    std_logic;
+    signal dma_m_ack                :    std_logic := '0';
+    signal dma_m_err                :    std_logic := '0';
+
+    -- Driving bus aliases
+    signal drv_ena                  :    std_logic := '0';
+    signal drv_rs                   :    std_logic_vector(3 downto 0) :=
+                                            (OTHERS => '0');
+    signal drv_batch                :    std_logic_vector(7 downto 0) :=
+                                            (OTHERS => '0');
+    signal drv_tmo                  :    std_logic_vector(15 downto 0) :=
+                                            (OTHERS => '0');
+    signal drv_base                 :    std_logic_vector(24 downto 0) :=
+                                            (OTHERS => '0');
+    signal drv_cons                 :    std_logic_vector(11 downto 0) :=
+                                            (OTHERS => '0');
+
+    ----------------------------------------------------------------------------
+    -- Test specific signals
+    ----------------------------------------------------------------------------
+
+    -- Number of frames moved by RX DMA in one iteration
+    constant C_FRAME_COUNT          :    natural := 32;
+
+    type t_word_mem is array (0 to 1023) of std_logic_vector(31 downto 0);
+    type t_frame_idx is array (0 to C_FRAME_COUNT) of natural;
+
+    -- RX Buffer model. Holds frames as they are read from RX_DATA.
+    signal rxb_mem                  :    t_word_mem :=
+                                            (OTHERS => (OTHERS => '0'));
+    signal rxb_frame_start          :    t_frame_idx := (OTHERS => 0);
+    signal rxb_wr_ptr               :    natural := 0;
+    signal rxb_rd_ptr               :    natural := 0;
+
+    -- System memory model (indexed by word address)
+    signal sys_mem                  :    t_word_mem :=
+                                            (OTHERS => (OTHERS => '0'));
+
+    -- Answer write of third word of frame with bus error
+    signal inject_berr              :    std_logic := '0';
+
+    -- Test flow control
+    signal iter_start               :    boolean := false;
+    signal berr_frame_go            :    boolean := false;
+    signal int_ctr                  :    natural := 0;
+
+    -- Additional random counters
+    signal rand_ctr_2               :    natural range 0 to RAND_POOL_SIZE := 0;
+    signal rand_ctr_3               :    natural range 0 to RAND_POOL_SIZE := 0;
+
+    ----------------------------------------------------------------------------
+    -- Store random frame to RX Buffer model
+    ----------------------------------------------------------------------------
+    procedure store_frame_to_rxb(
+        signal   rand_ctr           :inout  natural range 0 to RAND_POOL_SIZE;
+        signal   rxb_mem            :inout  t_word_mem;
+        signal   rxb_frame_start    :inout  t_frame_idx;
+        signal   rxb_wr_ptr         :inout  natural;
+        constant frame_index        :in     natural
+    ) is
+        variable rwcnt              :       natural;
+        variable word               :       std_logic_vector(31 downto 0);
+    begin
+        -- RX DMA accepts frames from 4 to 20 words long.
+        rand_int_v(rand_ctr, 16, rwcnt);
+        rwcnt := rwcnt + 3;
+
+        rxb_frame_start(frame_index) <= rxb_wr_ptr;
+
+        for i in 0 to rwcnt loop
+            rand_logic_vect_v(rand_ctr, word, 0.5);
+            if (i = 0) then
+                word(RWCNT_H downto RWCNT_L) :=
+                    std_logic_vector(to_unsigned(rwcnt, 5));
+            end if;
+            rxb_mem(rxb_wr_ptr + i) <= word;
+        end loop;
+
+        -- Frame becomes visible after all its words were stored.
+        rxb_wr_ptr <= rxb_wr_ptr + rwcnt + 1;
+        wait for 0 ns;
+    end procedure;
+
+begin
+
+    ----------------------------------------------------------------------------
+    -- DUT
+    ----------------------------------------------------------------------------
+    rx_dma_inst : entity ctu_can_fd_rtl.rx_dma
+    port map(
+        clk_sys              => clk_sys,
+        res_n                => res_n,
+        drv_bus              => drv_bus,
+        rx_dma_prod          => rx_dma_prod,
+        rx_dma_act           => rx_dma_act,
+        rx_dma_berr          => rx_dma_berr,
+        rx_read_buff         => rx_read_buff,
+        rx_empty             => rx_empty,
+        dma_read_start       => dma_read_start,
+        dma_m_addr           => dma_m_addr,
+        dma_m_wdata          => dma_m_wdata,
+        dma_m_req            => dma_m_req,
+        dma_m_ack            => dma_m_ack,
+        dma_m_err            => dma_m_err,
+        rx_dma_int           => rx_dma_int
+    );
+
+    ----------------------------------------------------------------------------
+    -- Clock generation
+    ----------------------------------------------------------------------------
+    clock_gen_proc(period => f100_Mhz, duty => 50, epsilon_ppm => 0,
+                   out_clk => clk_sys);
+
+    drv_bus(DRV_RX_DMA_ENA_INDEX)                           <= drv_ena;
+    drv_bus(DRV_RX_DMA_RS_HIGH downto DRV_RX_DMA_RS_LOW)       <= drv_rs;
+    drv_bus(DRV_RX_DMA_BATCH_HIGH downto DRV_RX_DMA_BATCH_LOW) <= drv_batch;
+    drv_bus(DRV_RX_DMA_TMO_HIGH downto DRV_RX_DMA_TMO_LOW)     <= drv_tmo;
+    drv_bus(DRV_RX_DMA_BASE_HIGH downto DRV_RX_DMA_BASE_LOW)   <= drv_base;
+    drv_bus(DRV_RX_DMA_CONS_HIGH downto DRV_RX_DMA_CONS_LOW)   <= drv_cons;
+
+    ----------------------------------------------------------------------------
+    -- RX Buffer model. Word on read pointer is presented on "rx_read_buff",
+    -- read pointer is moved by "dma_read_start".
+    ----------------------------------------------------------------------------
+    rx_empty <= '1' when (rxb_rd_ptr = rxb_wr_ptr) else
+                '0';
+
+    rx_read_buff <= rxb_mem(rxb_rd_ptr) when (rx_empty = '0') else
+                    (OTHERS => '0');
+
+    rxb_read_proc : process(clk_sys)
+    begin
+        if (rising_edge(clk_sys)) then
+            if (iter_start) then
+                rxb_rd_ptr <= 0;
+            elsif (dma_read_start = '1' and rx_empty = '0') then
+                rxb_rd_ptr <= rxb_rd_ptr + 1;
+            end if;
+        end if;
+    end process;
+
+    ----------------------------------------------------------------------------
+    -- System memory model. Acknowledges writes with random latency.
+    ----------------------------------------------------------------------------
+    mem_model_proc : process
+        variable word_addr  : natural;
+    begin
+        if (res_n = '0') then
+            apply_rand_seed(seed, 3, rand_ctr_3);
+            wait until res_n = '1';
+        end if;
+
+        wait until rising_edge(clk_sys) and dma_m_req = '1';
+        wait_rand_cycles(rand_ctr_3, clk_sys, 0, 3);
+
+        check(dma_m_addr(1 downto 0) = "00",
+              "RX DMA write address is not word aligned!");
+
+        word_addr := to_integer(unsigned(dma_m_addr(11 downto 2)));
+
+        if (inject_berr = '1' and dma_m_addr(6 downto 2) = "00010") then
+            dma_m_err <= '1';
+        else
+            sys_mem(word_addr) <= dma_m_wdata;
+        end if;
+        dma_m_ack <= '1';
+        wait until rising_edge(clk_sys);
+        dma_m_ack <= '0';
+        dma_m_err <= '0';
+    end process;
+
+    ----------------------------------------------------------------------------
+    -- Interrupt counter
+    ----------------------------------------------------------------------------
+    int_ctr_proc : process(clk_sys)
+    begin
+        if (rising_edge(clk_sys)) then
+            if (iter_start) then
+                int_ctr <= 0;
+            elsif (rx_dma_int = '1') then
+                int_ctr <= int_ctr + 1;
+            end if;
+        end if;
+    end process;
+
+    ----------------------------------------------------------------------------
+    -- Stimuli generator - stores frames to RX Buffer model.
+    ----------------------------------------------------------------------------
+    stim_gen_proc : process
+    begin
+        if (res_n = '0') then
+            apply_rand_seed(seed, 2, rand_ctr_2);
+            wait until res_n = '1';
+        end if;
+
+        wait until iter_start;
+        rxb_wr_ptr <= 0;
+        wait until rising_edge(clk_sys);
+
+        for i in 0 to C_FRAME_COUNT - 1 loop
+            wait_rand_cycles(rand_ctr_2, clk_sys, 0, 200);
+            store_frame_to_rxb(rand_ctr_2, rxb_mem, rxb_frame_start,
+                               rxb_wr_ptr, i);
+        end loop;
+
+        -- Frame which ends with bus error
+        wait until berr_frame_go;
+        store_frame_to_rxb(rand_ctr_2, rxb_mem, rxb_frame_start, rxb_wr_ptr,
+                           C_FRAME_COUNT);
+        wait until not berr_frame_go;
+    end process;
+
+    ----------------------------------------------------------------------------
+    -- Main test process - consumes frames from the ring as SW would do.
+    ----------------------------------------------------------------------------
+    test_proc : process
+        variable rs         : natural;
+        variable slots      : natural;
+        variable base       : natural;
+        variable batch      : natural;
+        variable tmo        : natural;
+        variable cons       : natural;
+        variable prod       : natural;
+        variable frame_ctr  : natural;
+        variable slot_addr  : natural;
+        variable start      : natural;
+        variable rwcnt      : natural;
+        variable exp_ints   : natural;
+    begin
+        info("Restarting RX DMA test!");
+        wait for 5 ns;
+        reset_test(res_n, status, run, error_ctr);
+        apply_rand_seed(seed, 0, rand_ctr);
+        info("Restarted RX DMA test");
+        print_test_info(iterations, log_level, error_beh, error_tol);
+
+        while (loop_ctr < iterations or exit_imm)
+        loop
+            info("Starting loop nr " & integer'image(loop_ctr));
+
+            --------------------------------------------------------------------
+            -- Random configuration. Ring is kept small to hit ring full.
+            --------------------------------------------------------------------
+            rand_int_v(rand_ctr, 3, rs);
+            rs := rs + 1;
+            slots := 2 ** rs;
+            rand_int_v(rand_ctr, 15, base);
+            rand_int_v(rand_ctr, 4, batch);
+            rand_int_v(rand_ctr, 3, tmo);
+
+            drv_rs    <= std_logic_vector(to_unsigned(rs, 4));
+            drv_base  <= std_logic_vector(to_unsigned(base, 25));
+            drv_batch <= std_logic_vector(to_unsigned(batch, 8));
+            drv_tmo   <= std_logic_vector(to_unsigned(tmo, 16));
+            drv_cons  <= (OTHERS => '0');
+
+            -- Restart RX Buffer model before RX DMA is enabled.
+            iter_start <= true;
+            wait until rising_edge(clk_sys);
+            iter_start <= false;
+            drv_ena   <= '1';
+
+            --------------------------------------------------------------------
+            -- Consume frames from the ring
+            --------------------------------------------------------------------
+            cons := 0;
+            frame_ctr := 0;
+            while (frame_ctr < C_FRAME_COUNT) loop
+                wait_rand_cycles(rand_ctr, clk_sys, 50, 400);
+                prod := to_integer(unsigned(rx_dma_prod));
+
+                check(prod < slots, "Producer index out of ring!");
+
+                while (cons /= prod and frame_ctr < C_FRAME_COUNT) loop
+                    slot_addr := (base + cons) * 32;
+                    start := rxb_frame_start(frame_ctr);
+                    rwcnt := to_integer(unsigned(
+                                rxb_mem(start)(RWCNT_H downto RWCNT_L)));
+
+                    for i in 0 to rwcnt loop
+                        check(sys_mem(slot_addr + i) = rxb_mem(start + i),
+                              "Frame " & integer'image(frame_ctr) &
+                              " word " & integer'image(i) & " mismatch!");
+                    end loop;
+
+                    cons := (cons + 1) mod slots;
+                    frame_ctr := frame_ctr + 1;
+                end loop;
+
+                drv_cons <= std_logic_vector(to_unsigned(cons, 12));
+            end loop;
+
+            --------------------------------------------------------------------
+            -- Without timeout, interrupt comes after each full batch only.
+            --------------------------------------------------------------------
+            wait_rand_cycles(rand_ctr, clk_sys, 10, 20);
+            if (batch = 0) then
+                exp_ints := C_FRAME_COUNT;
+            else
+                exp_ints := C_FRAME_COUNT / batch;
+            end if;
+
+            if (tmo = 0) then
+                check(int_ctr = exp_ints, "Invalid number of interrupts: " &
+                      integer'image(int_ctr) & " expected: " &
+                      integer'image(exp_ints));
+            else
+                check(int_ctr >= exp_ints, "Too few interrupts: " &
+                      integer'image(int_ctr));
+            end if;
+
+            --------------------------------------------------------------------
+            -- Bus error during frame write
+            --------------------------------------------------------------------
+            prod := to_integer(unsigned(rx_dma_prod));
+            inject_berr <= '1';
+            berr_frame_go <= true;
+
+            wait until rx_dma_berr = '1' for 100 us;
+            check(rx_dma_berr = '1', "RDBERR not set after bus error!");
+
+            if (rx_dma_act = '1') then
+                wait until rx_dma_act = '0' for 10 us;
+            end if;
+            wait until rising_edge(clk_sys);
+            check(rx_empty = '1', "Frame not drained after bus error!");
+            check(to_integer(unsigned(rx_dma_prod)) = prod,
+                  "Frame committed after bus error!");
+
+            inject_berr <= '0';
+            berr_frame_go <= false;
+            drv_ena <= '0';
+            wait until rising_edge(clk_sys);
+            wait until rising_edge(clk_sys);
+            check(rx_dma_berr = '0', "RDBERR not cleared by disable!");
+            check(unsigned(rx_dma_prod) = 0,
+                  "Producer index not cleared by disable!");
+
+            loop_ctr <= loop_ctr + 1;
+            wait for 10 ns;
+        end loop;
+
+        evaluate_test(error_tol, error_ctr, status);
+    end process;
+
+    errors <= error_ctr;
+
+end architecture;
@@ -0,0 +1,267 @@
+--------------------------------------------------------------------------------
+-- 
+-- CTU CAN FD IP Core 
+-- Copyright (C) 2021-present Ondrej Ille
+-- 
+-- Permission is hereby granted, free of charge, to any person obtaining a copy
+-- of this VHDL component and associated documentation files (the "Component"),
+-- to use, copy, modify, merge, publish, distribute the Component for
+-- educational, research, evaluation, self-interest purposes. Using the
+-- Component for commercial purposes is forbidden unless previously agreed with
+-- Copyright holder.
+-- 
+-- The above copyright notice and this permission notice shall be included in
+-- all copies or substantial portions of the Component.
+-- 
+-- THE COMPONENT IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+-- IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+-- FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+-- AUTHORS OR COPYRIGHTHOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+-- LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+-- FROM, OUT OF OR IN CONNECTION WITH THE COMPONENT OR THE USE OR OTHER DEALINGS
+-- IN THE COMPONENT.
+-- 
+-- The CAN protocol is developed by Robert Bosch GmbH and protected by patents.
+-- Anybody who wants to implement this IP core on silicon has to obtain a CAN
+-- protocol license from Bosch.
+-- 
+-- -------------------------------------------------------------------------------
+-- 
+-- CTU CAN FD IP Core 
+-- Copyright (C) 2015-2020 MIT License
+-- 
+-- Authors:
+--     Ondrej Ille <ondrej.ille@gmail.com>
+--     Martin Jerabek <martin.jerabek01@gmail.com>
+-- 
+-- Project advisors: 
+-- 	Jiri Novak <jnovak@fel.cvut.cz>
+-- 	Pavel Pisa <pisa@cmp.felk.cvut.cz>
+-- 
+-- Department of Measurement         (http://meas.fel.cvut.cz/)
+-- Faculty of Electrical Engineering (http://www.fel.cvut.cz)
+-- Czech Technical University        (http://www.cvut.cz/)
+-- 
+-- Permission is hereby granted, free of charge, to any person obtaining a copy
+-- of this VHDL component and associated documentation files (the "Component"),
+-- to deal in the Component without restriction, including without limitation
+-- the rights to use, copy, modify, merge, publish, distribute, sublicense,
+-- and/or sell copies of the Component, and to permit persons to whom the
+-- Component is furnished to do so, subject to the following conditions:
+-- 
+-- The above copyright notice and this permission notice shall be included in
+-- all copies or substantial portions of the Component.
+-- 
+-- THE COMPONENT IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+-- IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+-- FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+-- AUTHORS OR COPYRIGHTHOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+-- LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+-- FROM, OUT OF OR IN CONNECTION WITH THE COMPONENT OR THE USE OR OTHER DEALINGS
+-- IN THE COMPONENT.
+-- 
+-- The CAN protocol is developed by Robert Bosch GmbH and protected by patents.
+-- Anybody who wants to implement this IP core on silicon has to obtain a CAN
+-- protocol license from Bosch.
+-- 
+--------------------------------------------------------------------------------
+
+--------------------------------------------------------------------------------
+-- @TestInfoStart
+--
+-- @Purpose:
+--  Unit test for the Timestamp generator.
+--
+-- @Verifies:
+--  @1. Timestamp is incremented by integer part of increment in each clock
+--      cycle, and by one more when fraction accumulator overflows.
+--  @2. Step command adds two's complement offset to timestamp without loosing
+--      regular increment.
+--  @3. Set command loads timestamp and clears fraction accumulator.
+--
+-- @Test sequence:
+--  @1. Configure random increment. Let timestamp generator run for random
+--      number of clock cycles, and compare timestamp with model in each clock
+--      cycle.
+--  @2. Issue step command with random (positive or negative) offset. Check
+--      timestamp against model.
+--  @3. Issue set command with random value. Check timestamp against model.
+--
+-- @TestInfoEnd
+--------------------------------------------------------------------------------
+-- Revision History:
+--   19.10.2026   Created file
+--------------------------------------------------------------------------------
+
+library ieee;
+use ieee.std_logic_1164.all;
+use ieee.numeric_std.ALL;
+use ieee.math_real.ALL;
+use ieee.std_logic_textio.all;
+use STD.textio.all;
+
+library ctu_can_fd_rtl;
+use ctu_can_fd_rtl.can_constants_pkg.all;
+
+library ctu_can_fd_tb_unit;
+use ctu_can_fd_tb_unit.can_unit_test_pkg.all;
+use ctu_can_fd_tb_unit.random_unit_pkg.all;
+
+library vunit_lib;
+context vunit_lib.vunit_context;
+
+architecture timestamp_gen_unit_test of CAN_test is
+
+    -- System clock and reset
+    signal clk_sys                  :    std_logic := '0';
+    signal res_n                    :    std_logic := '0';
+
+    -- DUT interface
+    signal ts_inc                   :    std_logic_vector(31 downto 0) :=
+                                            x"01000000";
+    signal ts_step                  :    std_logic_vector(63 downto 0) :=
+                                            (OTHERS => '0');
+    signal ts_step_cmd              :    std_logic := '0';
+    signal ts_set_cmd               :    std_logic := '0';
+    signal timestamp                :    std_logic_vector(63 downto 0);
+
+begin
+
+    ----------------------------------------------------------------------------
+    -- DUT
+    ----------------------------------------------------------------------------
+    timestamp_gen_inst : entity ctu_can_fd_rtl.timestamp_gen
+    port map(
+        clk_sys                 => clk_sys,
+        res_n                   => res_n,
+        ts_inc                  => ts_inc,
+        ts_step                 => ts_step,
+        ts_step_cmd             => ts_step_cmd,
+        ts_set_cmd              => ts_set_cmd,
+        timestamp               => timestamp
+    );
+
+    ----------------------------------------------------------------------------
+    -- Clock generation
+    ----------------------------------------------------------------------------
+    clock_gen_proc(period => f100_Mhz, duty => 50, epsilon_ppm => 0,
+                   out_clk => clk_sys);
+
+    ----------------------------------------------------------------------------
+    -- Main test process. Inputs are driven on falling edge. Model of timestamp
+    -- generator is updated on rising edge, and compared with DUT on following
+    -- falling edge.
+    ----------------------------------------------------------------------------
+    test_proc : process
+        variable mdl_ts     : unsigned(63 downto 0);
+        variable mdl_frac   : unsigned(24 downto 0);
+        variable n_cycles   : natural;
+        variable tmp        : natural;
+        variable rand_inc   : std_logic_vector(31 downto 0);
+        variable rand_step  : std_logic_vector(63 downto 0);
+
+        ------------------------------------------------------------------------
+        -- Run one clock cycle with current inputs, update model and compare.
+        ------------------------------------------------------------------------
+        procedure clock_and_check is
+        begin
+            wait until rising_edge(clk_sys);
+            if (ts_set_cmd = '1') then
+                mdl_ts := unsigned(ts_step);
+                mdl_frac := (OTHERS => '0');
+            else
+                mdl_frac := ('0' & mdl_frac(23 downto 0)) +
+                            ('0' & unsigned(ts_inc(23 downto 0)));
+                mdl_ts := mdl_ts +
+                          resize(unsigned(ts_inc(31 downto 24)), 64) +
+                          resize(mdl_frac(24 downto 24), 64);
+                if (ts_step_cmd = '1') then
+                    mdl_ts := mdl_ts + unsigned(ts_step);
+                end if;
+            end if;
+
+            wait until falling_edge(clk_sys);
+            check(unsigned(timestamp) = mdl_ts,
+                  "Timestamp: 0x" & to_hstring(timestamp) &
+                  " Expected: 0x" & to_hstring(std_logic_vector(mdl_ts)));
+        end procedure;
+
+    begin
+        info("Restarting Timestamp generator test!");
+        wait for 5 ns;
+        reset_test(res_n, status, run, error_ctr);
+        apply_rand_seed(seed, 0, rand_ctr);
+        info("Restarted Timestamp generator test");
+        print_test_info(iterations, log_level, error_beh, error_tol);
+
+        -- Synchronize model with DUT (DUT already counts after reset)
+        wait until falling_edge(clk_sys);
+        mdl_ts := (OTHERS => '0');
+        mdl_frac := (OTHERS => '0');
+        ts_set_cmd <= '1';
+        ts_step <= (OTHERS => '0');
+        clock_and_check;
+        ts_set_cmd <= '0';
+
+        while (loop_ctr < iterations or exit_imm)
+        loop
+            info("Starting loop nr " & integer'image(loop_ctr));
+
+            --------------------------------------------------------------------
+            -- @1. Random increment, run for random number of clock cycles.
+            --------------------------------------------------------------------
+            info("Step 1");
+            rand_logic_vect_v(rand_ctr, rand_inc, 0.5);
+            ts_inc <= rand_inc;
+            clock_and_check;
+
+            rand_int_v(rand_ctr, 200, n_cycles);
+            for i in 0 to n_cycles loop
+                clock_and_check;
+            end loop;
+
+            --------------------------------------------------------------------
+            -- @2. Step by random offset.
+            --------------------------------------------------------------------
+            info("Step 2");
+            rand_logic_vect_v(rand_ctr, rand_step, 0.5);
+            rand_int_v(rand_ctr, 1, tmp);
+            if (tmp = 0) then
+                -- Small negative step
+                rand_step(63 downto 20) := (OTHERS => '1');
+            end if;
+            ts_step <= rand_step;
+            ts_step_cmd <= '1';
+            clock_and_check;
+            ts_step_cmd <= '0';
+            for i in 0 to 10 loop
+                clock_and_check;
+            end loop;
+
+            --------------------------------------------------------------------
+            -- @3. Set to random value (set has priority over step).
+            --------------------------------------------------------------------
+            info("Step 3");
+            rand_logic_vect_v(rand_ctr, rand_step, 0.5);
+            ts_step <= rand_step;
+            ts_set_cmd <= '1';
+            rand_int_v(rand_ctr, 1, tmp);
+            if (tmp = 0) then
+                ts_step_cmd <= '1';
+            end if;
+            clock_and_check;
+            ts_set_cmd <= '0';
+            ts_step_cmd <= '0';
+            for i in 0 to 10 loop
+                clock_and_check;
+            end loop;
+
+            loop_ctr <= loop_ctr + 1;
+        end loop;
+
+        evaluate_test(error_tol, error_ctr, status);
+    end process;
+
+    errors <= error_ctr;
+
+end architecture;
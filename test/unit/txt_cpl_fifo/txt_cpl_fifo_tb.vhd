@@ -0,0 +1,428 @@
+--------------------------------------------------------------------------------
+-- 
+-- CTU CAN FD IP Core 
+-- Copyright (C) 2021-present Ondrej Ille
+-- 
+-- Permission is hereby granted, free of charge, to any person obtaining a copy
+-- of this VHDL component and associated documentation files (the "Component"),
+-- to use, copy, modify, merge, publish, distribute the Component for
+-- educational, research, evaluation, self-interest purposes. Using the
+-- Component for commercial purposes is forbidden unless previously agreed with
+-- Copyright holder.
+-- 
+-- The above copyright notice and this permission notice shall be included in
+-- all copies or substantial portions of the Component.
+-- 
+-- THE COMPONENT IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+-- IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+-- FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+-- AUTHORS OR COPYRIGHTHOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+-- LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+-- FROM, OUT OF OR IN CONNECTION WITH THE COMPONENT OR THE USE OR OTHER DEALINGS
+-- IN THE COMPONENT.
+-- 
+-- The CAN protocol is developed by Robert Bosch GmbH and protected by patents.
+-- Anybody who wants to implement this IP core on silicon has to obtain a CAN
+-- protocol license from Bosch.
+-- 
+-- -------------------------------------------------------------------------------
+-- 
+-- CTU CAN FD IP Core 
+-- Copyright (C) 2015-2020 MIT License
+-- 
+-- Authors:
+--     Ondrej Ille <ondrej.ille@gmail.com>
+--     Martin Jerabek <martin.jerabek01@gmail.com>
+-- 
+-- Project advisors: 
+-- 	Jiri Novak <jnovak@fel.cvut.cz>
+-- 	Pavel Pisa <pisa@cmp.felk.cvut.cz>
+-- 
+-- Department of Measurement         (http://meas.fel.cvut.cz/)
+-- Faculty of Electrical Engineering (http://www.fel.cvut.cz)
+-- Czech Technical University        (http://www.cvut.cz/)
+-- 
+-- Permission is hereby granted, free of charge, to any person obtaining a copy
+-- of this VHDL component and associated documentation files (the "Component"),
+-- to deal in the Component without restriction, including without limitation
+-- the rights to use, copy, modify, merge, publish, distribute, sublicense,
+-- and/or sell copies of the Component, and to permit persons to whom the
+-- Component is furnished to do so, subject to the following conditions:
+-- 
+-- The above copyright notice and this permission notice shall be included in
+-- all copies or substantial portions of the Component.
+-- 
+-- THE COMPONENT IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+-- IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+-- FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+-- AUTHORS OR COPYRIGHTHOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+-- LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+-- FROM, OUT OF OR IN CONNECTION WITH THE COMPONENT OR THE USE OR OTHER DEALINGS
+-- IN THE COMPONENT.
+-- 
+-- The CAN protocol is developed by Robert Bosch GmbH and protected by patents.
+-- Anybody who wants to implement this IP core on silicon has to obtain a CAN
+-- protocol license from Bosch.
+-- 
+
+--------------------------------------------------------------------------------
+-- @TestInfoStart
+--
+-- @Purpose:
+--  Unit test for the TX completion FIFO.
+--
+-- @Verifies:
+--  @1. Record is stored for each TXT Buffer which moves to TX OK, Failed or
+--      Aborted. Records are read in order of completion, record contains
+--      index of TXT Buffer, its final state, retransmitt counter and
+--      timestamp.
+--  @2. When multiple TXT Buffers reach final state in the same clock cycle,
+--      records are stored lowest index first, one per clock cycle.
+--  @3. When FIFO is full, new record is dropped and overflow flag is set.
+--      Overflow flag is cleared by read of record.
+--  @4. Read of empty FIFO has no effect.
+--
+-- @Test sequence:
+--  @1. Move random TXT Buffers to random final states one by one, with random
+--      retransmitt counter. Read all records and check them against model.
+--  @2. Move random set of TXT Buffers to final state at once. Read records and
+--      check their order and timestamps.
+--  @3. Store more records than fit into FIFO. Check overflow flag, read all
+--      records and check that the last records were dropped. Check overflow
+--      flag is cleared.
+--  @4. Read empty FIFO. Check it remains empty.
+--
+-- @TestInfoEnd
+--------------------------------------------------------------------------------
+-- Revision History:
+--   19.10.2026   Created file
+--------------------------------------------------------------------------------
+
+library ieee;
+use ieee.std_logic_1164.all;
+use ieee.numeric_std.ALL;
+use ieee.math_real.ALL;
+use ieee.std_logic_textio.all;
+use STD.textio.all;
+
+library ctu_can_fd_rtl;
+use ctu_can_fd_rtl.can_constants_pkg.all;
+
+use ctu_can_fd_rtl.can_types_pkg.all;
+use ctu_can_fd_rtl.unary_ops_pkg.all;
+use ctu_can_fd_rtl.can_config_pkg.all;
+use ctu_can_fd_rtl.CAN_FD_register_map.all;
+
+library ctu_can_fd_tb_unit;
+use ctu_can_fd_tb_unit.can_unit_test_pkg.all;
+use ctu_can_fd_tb_unit.random_unit_pkg.all;
+
+library vunit_lib;
+context vunit_lib.vunit_context;
+
+architecture txt_cpl_fifo_unit_test of CAN_test is
+
+    -- Number of TXT Buffers
+    constant C_TXT_BUFFER_COUNT     :    natural := 4;
+
+    -- Number of records in FIFO. Kept small to hit full FIFO often.
+    constant C_DEPTH                :    natural := 4;
+
+    -- System clock and reset
+    signal clk_sys                  :    std_logic := '0';
+    signal res_n                    :    std_logic := '0';
+
+    -- TXT Buffers and CAN Core interface
+    signal txtb_state               :    t_txt_bufs_state(C_TXT_BUFFER_COUNT - 1 downto 0) :=
+                                            (OTHERS => TXT_ETY);
+    signal retr_ctr                 :    std_logic_vector(3 downto 0) :=
+                                            (OTHERS => '0');
+    signal timestamp                :    std_logic_vector(63 downto 0) :=
+                                            (OTHERS => '0');
+
+    -- Memory registers interface
+    signal tx_cpl_pop               :    std_logic := '0';
+    signal tx_cpl_index             :    std_logic_vector(2 downto 0);
+    signal tx_cpl_state             :    std_logic_vector(3 downto 0);
+    signal tx_cpl_retr_ctr          :    std_logic_vector(3 downto 0);
+    signal tx_cpl_ts                :    std_logic_vector(31 downto 0);
+    signal tx_cpl_count             :    std_logic_vector(4 downto 0);
+    signal tx_cpl_overflow          :    std_logic;
+    signal tx_cpl_valid             :    std_logic;
+
+    ----------------------------------------------------------------------------
+    -- Testbench signals
+    ----------------------------------------------------------------------------
+    -- Model of records in FIFO
+    type t_cpl_rec is record
+        index       : natural;
+        state       : std_logic_vector(3 downto 0);
+        retr_ctr    : std_logic_vector(3 downto 0);
+        ts          : std_logic_vector(31 downto 0);
+    end record;
+
+    type t_cpl_queue is array (0 to 2 * C_TXT_BUFFER_COUNT) of t_cpl_rec;
+
+begin
+
+    ----------------------------------------------------------------------------
+    -- DUT
+    ----------------------------------------------------------------------------
+    txt_cpl_fifo_inst : entity ctu_can_fd_rtl.txt_cpl_fifo
+    generic map(
+        G_TXT_BUFFER_COUNT      => C_TXT_BUFFER_COUNT,
+        G_DEPTH                 => C_DEPTH,
+        G_RETR_LIM_CTR_WIDTH    => 4
+    )
+    port map(
+        clk_sys                 => clk_sys,
+        res_n                   => res_n,
+
+        txtb_state              => txtb_state,
+
+        retr_ctr                => retr_ctr,
+        timestamp               => timestamp,
+
+        tx_cpl_pop              => tx_cpl_pop,
+        tx_cpl_index            => tx_cpl_index,
+        tx_cpl_state            => tx_cpl_state,
+        tx_cpl_retr_ctr         => tx_cpl_retr_ctr,
+        tx_cpl_ts               => tx_cpl_ts,
+        tx_cpl_count            => tx_cpl_count,
+        tx_cpl_overflow         => tx_cpl_overflow,
+        tx_cpl_valid            => tx_cpl_valid
+    );
+
+    ----------------------------------------------------------------------------
+    -- Clock generation
+    ----------------------------------------------------------------------------
+    clock_gen_proc(period => f100_Mhz, duty => 50, epsilon_ppm => 0,
+                   out_clk => clk_sys);
+
+    ----------------------------------------------------------------------------
+    -- Timestamp counts clock cycles
+    ----------------------------------------------------------------------------
+    timestamp_proc : process
+    begin
+        wait until rising_edge(clk_sys);
+        timestamp <= std_logic_vector(unsigned(timestamp) + 1);
+    end process;
+
+    ----------------------------------------------------------------------------
+    -- Main test process. Acts as TXT Buffers and as SW (reads records).
+    ----------------------------------------------------------------------------
+    test_proc : process
+        variable queue      : t_cpl_queue;
+        variable q_fill     : natural;
+        variable n_recs     : natural;
+        variable buf        : natural;
+        variable tmp        : natural;
+        variable final_st   : std_logic_vector(3 downto 0);
+        variable bufs       : std_logic_vector(C_TXT_BUFFER_COUNT - 1 downto 0);
+        variable ts         : unsigned(31 downto 0);
+        variable exp_ovf    : std_logic;
+        variable retr_v     : std_logic_vector(3 downto 0);
+
+        ------------------------------------------------------------------------
+        -- Pick random final state
+        ------------------------------------------------------------------------
+        procedure rand_final_state(
+            variable st     : out std_logic_vector(3 downto 0)
+        ) is
+            variable sel    : natural;
+        begin
+            rand_int_v(rand_ctr, 2, sel);
+            case sel is
+            when 0 => st := TXT_TOK;
+            when 1 => st := TXT_ERR;
+            when others => st := TXT_ABT;
+            end case;
+        end procedure;
+
+        ------------------------------------------------------------------------
+        -- Move TXT Buffers back to non-final state
+        ------------------------------------------------------------------------
+        procedure restart_bufs is
+        begin
+            wait until falling_edge(clk_sys);
+            txtb_state <= (OTHERS => TXT_RDY);
+            wait until falling_edge(clk_sys);
+        end procedure;
+
+        ------------------------------------------------------------------------
+        -- Read record and compare it with model
+        ------------------------------------------------------------------------
+        procedure pop_and_check(
+            constant exp        : in t_cpl_rec;
+            constant exp_count  : in natural;
+            constant exp_ovf    : in std_logic
+        ) is
+        begin
+            check(tx_cpl_valid = '1', "Record not valid!");
+            check(to_integer(unsigned(tx_cpl_count)) = exp_count,
+                  "Record count: " &
+                  integer'image(to_integer(unsigned(tx_cpl_count))) &
+                  " Expected: " & integer'image(exp_count));
+            check(to_integer(unsigned(tx_cpl_index)) = exp.index,
+                  "Record index: " &
+                  integer'image(to_integer(unsigned(tx_cpl_index))) &
+                  " Expected: " & integer'image(exp.index));
+            check(tx_cpl_state = exp.state, "Record state: " &
+                  to_hstring(tx_cpl_state) & " Expected: " &
+                  to_hstring(exp.state));
+            check(tx_cpl_retr_ctr = exp.retr_ctr, "Record retransmitt counter: " &
+                  to_hstring(tx_cpl_retr_ctr) & " Expected: " &
+                  to_hstring(exp.retr_ctr));
+            check(tx_cpl_ts = exp.ts, "Record timestamp: " &
+                  to_hstring(tx_cpl_ts) & " Expected: " & to_hstring(exp.ts));
+            check(tx_cpl_overflow = exp_ovf, "Overflow flag mismatch!");
+
+            tx_cpl_pop <= '1';
+            wait until falling_edge(clk_sys);
+            tx_cpl_pop <= '0';
+        end procedure;
+
+        ------------------------------------------------------------------------
+        -- Read all records in model
+        ------------------------------------------------------------------------
+        procedure pop_all(
+            constant exp_ovf    : in std_logic
+        ) is
+        begin
+            for i in 0 to q_fill - 1 loop
+                if (i = 0) then
+                    pop_and_check(queue(i), q_fill - i, exp_ovf);
+                else
+                    pop_and_check(queue(i), q_fill - i, '0');
+                end if;
+            end loop;
+            q_fill := 0;
+            check(tx_cpl_valid = '0', "FIFO not empty!");
+            check(unsigned(tx_cpl_count) = 0, "FIFO count not zero!");
+            check(tx_cpl_overflow = '0', "Overflow flag not cleared!");
+        end procedure;
+
+    begin
+        info("Restarting TX completion FIFO test!");
+        wait for 5 ns;
+        reset_test(res_n, status, run, error_ctr);
+        apply_rand_seed(seed, 0, rand_ctr);
+        info("Restarted TX completion FIFO test");
+        print_test_info(iterations, log_level, error_beh, error_tol);
+
+        q_fill := 0;
+
+        while (loop_ctr < iterations or exit_imm)
+        loop
+            info("Starting loop nr " & integer'image(loop_ctr));
+
+            --------------------------------------------------------------------
+            -- @1. TXT Buffers reach final state one by one.
+            --------------------------------------------------------------------
+            info("Step 1");
+            rand_int_v(rand_ctr, C_DEPTH - 1, n_recs);
+            n_recs := n_recs + 1;
+            for i in 0 to n_recs - 1 loop
+                rand_int_v(rand_ctr, C_TXT_BUFFER_COUNT - 1, buf);
+                rand_final_state(final_st);
+
+                wait until falling_edge(clk_sys);
+                rand_logic_vect_v(rand_ctr, retr_v, 0.5);
+                retr_ctr <= retr_v;
+                txtb_state(buf) <= final_st;
+
+                queue(q_fill) := (buf, final_st, retr_v, timestamp(31 downto 0));
+                q_fill := q_fill + 1;
+
+                restart_bufs;
+                rand_int_v(rand_ctr, 5, tmp);
+                for j in 1 to tmp loop
+                    wait until falling_edge(clk_sys);
+                end loop;
+            end loop;
+
+            pop_all('0');
+
+            --------------------------------------------------------------------
+            -- @2. Several TXT Buffers reach final state at once.
+            --------------------------------------------------------------------
+            info("Step 2");
+            rand_logic_vect_v(rand_ctr, bufs, 0.5);
+            if (bufs = (bufs'range => '0')) then
+                bufs(0) := '1';
+            end if;
+
+            wait until falling_edge(clk_sys);
+            rand_logic_vect_v(rand_ctr, retr_v, 0.5);
+            retr_ctr <= retr_v;
+            ts := unsigned(timestamp(31 downto 0));
+            for i in 0 to C_TXT_BUFFER_COUNT - 1 loop
+                if (bufs(i) = '1') then
+                    rand_final_state(final_st);
+                    txtb_state(i) <= final_st;
+                    queue(q_fill) := (i, final_st, retr_v,
+                                      std_logic_vector(ts));
+                    q_fill := q_fill + 1;
+                    ts := ts + 1;
+                end if;
+            end loop;
+
+            for i in 0 to C_TXT_BUFFER_COUNT loop
+                wait until falling_edge(clk_sys);
+            end loop;
+            restart_bufs;
+
+            pop_all('0');
+
+            --------------------------------------------------------------------
+            -- @3. Overflow
+            --------------------------------------------------------------------
+            info("Step 3");
+            rand_int_v(rand_ctr, C_TXT_BUFFER_COUNT - 1, n_recs);
+            n_recs := C_DEPTH + n_recs;
+            exp_ovf := '0';
+            for i in 0 to n_recs - 1 loop
+                buf := i mod C_TXT_BUFFER_COUNT;
+                rand_final_state(final_st);
+
+                wait until falling_edge(clk_sys);
+                rand_logic_vect_v(rand_ctr, retr_v, 0.5);
+                retr_ctr <= retr_v;
+                txtb_state(buf) <= final_st;
+
+                if (q_fill < C_DEPTH) then
+                    queue(q_fill) := (buf, final_st, retr_v,
+                                      timestamp(31 downto 0));
+                    q_fill := q_fill + 1;
+                else
+                    exp_ovf := '1';
+                end if;
+
+                restart_bufs;
+            end loop;
+
+            check(to_integer(unsigned(tx_cpl_count)) = C_DEPTH, "FIFO not full!");
+            pop_all(exp_ovf);
+
+            --------------------------------------------------------------------
+            -- @4. Read of empty FIFO
+            --------------------------------------------------------------------
+            info("Step 4");
+            tx_cpl_pop <= '1';
+            wait until falling_edge(clk_sys);
+            tx_cpl_pop <= '0';
+            wait until falling_edge(clk_sys);
+            check(tx_cpl_valid = '0', "Empty FIFO valid after read!");
+            check(unsigned(tx_cpl_count) = 0, "Empty FIFO count after read!");
+            check(unsigned(tx_cpl_ts) = 0, "Empty FIFO timestamp not zero!");
+
+            loop_ctr <= loop_ctr + 1;
+            wait for 10 ns;
+        end loop;
+
+        evaluate_test(error_tol, error_ctr, status);
+    end process;
+
+    errors <= error_ctr;
+
+end architecture;
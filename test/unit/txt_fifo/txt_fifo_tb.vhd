@@ -0,0 +1,479 @@
+--------------------------------------------------------------------------------
+-- 
+-- CTU CAN FD IP Core 
+-- Copyright (C) 2021-present Ondrej Ille
+-- 
+-- Permission is hereby granted, free of charge, to any person obtaining a copy
+-- of this VHDL component and associated documentation files (the "Component"),
+-- to use, copy, modify, merge, publish, distribute the Component for
+-- educational, research, evaluation, self-interest purposes. Using the
+-- Component for commercial purposes is forbidden unless previously agreed with
+-- Copyright holder.
+-- 
+-- The above copyright notice and this permission notice shall be included in
+-- all copies or substantial portions of the Component.
+-- 
+-- THE COMPONENT IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+-- IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+-- FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+-- AUTHORS OR COPYRIGHTHOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+-- LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+-- FROM, OUT OF OR IN CONNECTION WITH THE COMPONENT OR THE USE OR OTHER DEALINGS
+-- IN THE COMPONENT.
+-- 
+-- The CAN protocol is developed by Robert Bosch GmbH and protected by patents.
+-- Anybody who wants to implement this IP core on silicon has to obtain a CAN
+-- protocol license from Bosch.
+-- 
+-- -------------------------------------------------------------------------------
+-- 
+-- CTU CAN FD IP Core 
+-- Copyright (C) 2015-2020 MIT License
+-- 
+-- Authors:
+--     Ondrej Ille <ondrej.ille@gmail.com>
+--     Martin Jerabek <martin.jerabek01@gmail.com>
+-- 
+-- Project advisors: 
+-- 	Jiri Novak <jnovak@fel.cvut.cz>
+-- 	Pavel Pisa <pisa@cmp.felk.cvut.cz>
+-- 
+-- Department of Measurement         (http://meas.fel.cvut.cz/)
+-- Faculty of Electrical Engineering (http://www.fel.cvut.cz)
+-- Czech Technical University        (http://www.cvut.cz/)
+-- 
+-- Permission is hereby granted, free of charge, to any person obtaining a copy
+-- of this VHDL component and associated documentation files (the "Component"),
+-- to deal in the Component without restriction, including without limitation
+-- the rights to use, copy, modify, merge, publish, distribute, sublicense,
+-- and/or sell copies of the Component, and to permit persons to whom the
+-- Component is furnished to do so, subject to the following conditions:
+-- 
+-- The above copyright notice and this permission notice shall be included in
+-- all copies or substantial portions of the Component.
+-- 
+-- THE COMPONENT IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+-- IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+-- FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+-- AUTHORS OR COPYRIGHTHOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+-- LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+-- FROM, OUT OF OR IN CONNECTION WITH THE COMPONENT OR THE USE OR OTHER DEALINGS
+-- IN THE COMPONENT.
+-- 
+-- The CAN protocol is developed by Robert Bosch GmbH and protected by patents.
+-- Anybody who wants to implement this IP core on silicon has to obtain a CAN
+-- protocol license from Bosch.
+-- 
+--------------------------------------------------------------------------------
+
+--------------------------------------------------------------------------------
+-- @TestInfoStart
+--
+-- @Purpose:
+--  Unit test for the TXT FIFO circuit.
+--
+-- @Verifies:
+--  @1. Frames inserted to TXT FIFO are offered to CAN Core in order of
+--      insertion, and each frame is offered until it is transmitted
+--      succesfully.
+--  @2. TXT FIFO does not accept frames when it is full.
+--  @3. Threshold interrupt is signalled when number of frames drops to
+--      threshold.
+--  @4. Failed transmission, or abort flushes TXT FIFO. Frame inserted after
+--      flush is transmitted.
+--
+-- @Test sequence:
+--  @1. Configure random threshold. Insert random number of frames with random
+--      content (more than fits into TXT FIFO in some iterations). Check fill
+--      level and full flag after each insertion.
+--  @2. Transmit all frames like CAN Core would do (lock, read, unlock). Unlock
+--      randomly with error so that frame is retransmitted. Check content of
+--      each frame and number of threshold interrupts.
+--  @3. Insert random number of frames, and unlock first frame with failed
+--      command. Check TXT FIFO is flushed and it stays in Failed. Insert one
+--      frame and transmit it.
+--  @4. Insert random number of frames, abort frame which is ready. Check
+--      TXT FIFO is flushed and it stays in Aborted. Issue set_empty and check
+--      TXT FIFO moves to Empty.
+--
+-- @TestInfoEnd
+--------------------------------------------------------------------------------
+-- Revision History:
+--   19.10.2026   Created file
+--------------------------------------------------------------------------------
+
+library ieee;
+use ieee.std_logic_1164.all;
+use ieee.numeric_std.ALL;
+use ieee.math_real.ALL;
+use ieee.std_logic_textio.all;
+use STD.textio.all;
+
+library ctu_can_fd_rtl;
+use ctu_can_fd_rtl.id_transfer_pkg.all;
+use ctu_can_fd_rtl.can_constants_pkg.all;
+
+use ctu_can_fd_rtl.can_types_pkg.all;
+use ctu_can_fd_rtl.drv_stat_pkg.all;
+use ctu_can_fd_rtl.unary_ops_pkg.all;
+use ctu_can_fd_rtl.can_config_pkg.all;
+use ctu_can_fd_rtl.CAN_FD_register_map.all;
+use ctu_can_fd_rtl.CAN_FD_frame_format.all;
+
+library ctu_can_fd_tb_unit;
+use ctu_can_fd_tb_unit.can_unit_test_pkg.all;
+use ctu_can_fd_tb_unit.random_unit_pkg.all;
+
+use ctu_can_fd_rtl.can_registers_pkg.all;
+
+library vunit_lib;
+context vunit_lib.vunit_context;
+
+architecture txt_fifo_unit_test of CAN_test is
+
+    -- Number of frames in TXT FIFO. Kept small to hit full FIFO often.
+    constant C_DEPTH                :    natural := 4;
+
+    -- System clock and reset
+    signal clk_sys                  :    std_logic := '0';
+    signal res_n                    :    std_logic := '0';
+
+    -- Memory registers interface
+    signal txtb_port_a_data         :    std_logic_vector(31 downto 0) :=
+                                            (OTHERS => '0');
+    signal txtb_port_a_address      :    std_logic_vector(4 downto 0) :=
+                                            (OTHERS => '0');
+    signal txtb_port_a_cs           :    std_logic := '0';
+    signal txtb_sw_cmd              :    t_txtb_sw_cmd := ('0', '0', '0');
+    signal txtb_sw_cmd_index        :    std_logic_vector(1 downto 0) := "10";
+    signal txtb_state               :    std_logic_vector(3 downto 0);
+    signal tx_fifo_th               :    std_logic_vector(6 downto 0) :=
+                                            (OTHERS => '0');
+    signal tx_fifo_fill             :    std_logic_vector(6 downto 0);
+    signal tx_fifo_full             :    std_logic;
+
+    signal test_registers_out       :    test_registers_out_t :=
+        ((OTHERS => '0'), (OTHERS => '0'), (OTHERS => '0'));
+
+    -- Interrupts
+    signal txtb_hw_cmd_int          :    std_logic;
+    signal tx_fifo_int              :    std_logic;
+
+    -- CAN Core and TX Arbitrator interface
+    signal txtb_hw_cmd              :    t_txtb_hw_cmd :=
+                                            ('0', '0', '0', '0', '0', '0');
+    signal txtb_port_b_data         :    std_logic_vector(31 downto 0);
+    signal txtb_port_b_address      :    natural range 0 to 19 := 0;
+    signal txtb_available           :    std_logic;
+
+    ----------------------------------------------------------------------------
+    -- Testbench signals
+    ----------------------------------------------------------------------------
+    -- Model of frames in TXT FIFO
+    type t_frame is array (0 to 19) of std_logic_vector(31 downto 0);
+    type t_frame_queue is array (0 to C_DEPTH - 1) of t_frame;
+
+    -- Number of threshold interrupts
+    signal int_ctr                  :    natural := 0;
+    signal int_ctr_clr              :    boolean := false;
+
+begin
+
+    ----------------------------------------------------------------------------
+    -- DUT
+    ----------------------------------------------------------------------------
+    txt_fifo_inst : entity ctu_can_fd_rtl.txt_fifo
+    generic map(
+        G_TXT_BUFFER_COUNT      => 2,
+        G_ID                    => 1,
+        G_DEPTH                 => C_DEPTH,
+        G_TECHNOLOGY            => C_TECH_FPGA
+    )
+    port map(
+        clk_sys                 => clk_sys,
+        res_n                   => res_n,
+        scan_enable             => '0',
+
+        txtb_port_a_data        => txtb_port_a_data,
+        txtb_port_a_address     => txtb_port_a_address,
+        txtb_port_a_cs          => txtb_port_a_cs,
+        txtb_port_a_be          => "1111",
+        txtb_sw_cmd             => txtb_sw_cmd,
+        txtb_sw_cmd_index       => txtb_sw_cmd_index,
+        txtb_state              => txtb_state,
+        txt_buf_failed_bof      => '1',
+        drv_rom_ena             => '0',
+        drv_bus_mon_ena         => '0',
+        tx_fifo_th              => tx_fifo_th,
+        tx_fifo_fill            => tx_fifo_fill,
+        tx_fifo_full            => tx_fifo_full,
+
+        test_registers_out      => test_registers_out,
+        tst_rdata_txt_buf       => open,
+
+        txtb_hw_cmd_int         => txtb_hw_cmd_int,
+        tx_fifo_int             => tx_fifo_int,
+
+        txtb_hw_cmd             => txtb_hw_cmd,
+        txtb_hw_cmd_index       => 1,
+        txtb_port_b_data        => txtb_port_b_data,
+        txtb_port_b_address     => txtb_port_b_address,
+        txtb_port_b_clk_en      => '1',
+        is_bus_off              => '0',
+        txtb_available          => txtb_available
+    );
+
+    ----------------------------------------------------------------------------
+    -- Clock generation
+    ----------------------------------------------------------------------------
+    clock_gen_proc(period => f100_Mhz, duty => 50, epsilon_ppm => 0,
+                   out_clk => clk_sys);
+
+    ----------------------------------------------------------------------------
+    -- Threshold interrupt counter
+    ----------------------------------------------------------------------------
+    int_ctr_proc : process
+    begin
+        wait until rising_edge(clk_sys);
+        if (int_ctr_clr) then
+            int_ctr <= 0;
+        elsif (tx_fifo_int = '1') then
+            int_ctr <= int_ctr + 1;
+        end if;
+    end process;
+
+    ----------------------------------------------------------------------------
+    -- Main test process. Acts as SW (inserts frames) and as CAN Core
+    -- (transmits frames).
+    ----------------------------------------------------------------------------
+    test_proc : process
+        variable queue      : t_frame_queue;
+        variable q_head     : natural;
+        variable q_tail     : natural;
+        variable q_fill     : natural;
+        variable n_frames   : natural;
+        variable th         : natural;
+        variable tmp        : natural;
+        variable exp_ints   : natural;
+        variable max_fill   : natural;
+
+        ------------------------------------------------------------------------
+        -- Write random frame and insert it to TXT FIFO (set_ready). When
+        -- TXT FIFO is full, frame is not stored to model.
+        ------------------------------------------------------------------------
+        procedure insert_frame is
+            variable frame  : t_frame;
+        begin
+            for i in 0 to 19 loop
+                rand_logic_vect_v(rand_ctr, frame(i), 0.5);
+                wait until falling_edge(clk_sys);
+                txtb_port_a_cs <= '1';
+                txtb_port_a_address <= std_logic_vector(to_unsigned(i, 5));
+                txtb_port_a_data <= frame(i);
+            end loop;
+
+            -- Write beyond frame must not overwrite next slot
+            wait until falling_edge(clk_sys);
+            txtb_port_a_address <= std_logic_vector(to_unsigned(20, 5));
+            txtb_port_a_data <= (OTHERS => '1');
+
+            wait until falling_edge(clk_sys);
+            txtb_port_a_cs <= '0';
+            txtb_sw_cmd.set_rdy <= '1';
+            wait until falling_edge(clk_sys);
+            txtb_sw_cmd.set_rdy <= '0';
+
+            if (q_fill < C_DEPTH) then
+                queue(q_tail) := frame;
+                q_tail := (q_tail + 1) mod C_DEPTH;
+                q_fill := q_fill + 1;
+            end if;
+
+            check(to_integer(unsigned(tx_fifo_fill)) = q_fill,
+                  "TXT FIFO fill level: " &
+                  integer'image(to_integer(unsigned(tx_fifo_fill))) &
+                  " Expected: " & integer'image(q_fill));
+
+            if (q_fill = C_DEPTH) then
+                check(tx_fifo_full = '1', "TXT FIFO not full!");
+            else
+                check(tx_fifo_full = '0', "TXT FIFO full!");
+            end if;
+        end procedure;
+
+        ------------------------------------------------------------------------
+        -- Lock frame at head of TXT FIFO and compare it with model.
+        ------------------------------------------------------------------------
+        procedure lock_and_check is
+        begin
+            if (txtb_available = '0') then
+                wait until txtb_available = '1' for 1 us;
+            end if;
+            check(txtb_available = '1', "TXT FIFO not available!");
+
+            wait until falling_edge(clk_sys);
+            txtb_hw_cmd.lock <= '1';
+            wait until falling_edge(clk_sys);
+            txtb_hw_cmd.lock <= '0';
+            check(txtb_state = TXT_TRAN, "TXT FIFO not in TX in progress!");
+
+            for i in 0 to 19 loop
+                txtb_port_b_address <= i;
+                wait until falling_edge(clk_sys);
+                check(txtb_port_b_data = queue(q_head)(i),
+                      "Frame data mismatch, word: " & integer'image(i));
+            end loop;
+        end procedure;
+
+        ------------------------------------------------------------------------
+        -- Unlock frame with given result
+        ------------------------------------------------------------------------
+        procedure unlock(
+            constant valid  : in std_logic;
+            constant err    : in std_logic;
+            constant failed : in std_logic
+        ) is
+        begin
+            txtb_hw_cmd.unlock <= '1';
+            txtb_hw_cmd.valid <= valid;
+            txtb_hw_cmd.err <= err;
+            txtb_hw_cmd.failed <= failed;
+            wait until falling_edge(clk_sys);
+            txtb_hw_cmd <= ('0', '0', '0', '0', '0', '0');
+        end procedure;
+
+        ------------------------------------------------------------------------
+        -- Wait until TXT FIFO settles (frame at head is made ready)
+        ------------------------------------------------------------------------
+        procedure wait_settle is
+        begin
+            for i in 0 to 2 loop
+                wait until falling_edge(clk_sys);
+            end loop;
+        end procedure;
+
+    begin
+        info("Restarting TXT FIFO test!");
+        wait for 5 ns;
+        reset_test(res_n, status, run, error_ctr);
+        apply_rand_seed(seed, 0, rand_ctr);
+        info("Restarted TXT FIFO test");
+        print_test_info(iterations, log_level, error_beh, error_tol);
+
+        q_head := 0;
+        q_tail := 0;
+        q_fill := 0;
+
+        while (loop_ctr < iterations or exit_imm)
+        loop
+            info("Starting loop nr " & integer'image(loop_ctr));
+
+            --------------------------------------------------------------------
+            -- @1. Random threshold, insert random number of frames.
+            --------------------------------------------------------------------
+            info("Step 1");
+            rand_int_v(rand_ctr, C_DEPTH - 1, th);
+            tx_fifo_th <= std_logic_vector(to_unsigned(th, 7));
+            int_ctr_clr <= true;
+            wait until falling_edge(clk_sys);
+            int_ctr_clr <= false;
+
+            rand_int_v(rand_ctr, C_DEPTH, n_frames);
+            n_frames := n_frames + 1;
+            for i in 1 to n_frames loop
+                insert_frame;
+            end loop;
+
+            --------------------------------------------------------------------
+            -- @2. Transmit all frames, some of them with error.
+            --------------------------------------------------------------------
+            info("Step 2");
+            max_fill := q_fill;
+            while (q_fill > 0) loop
+                lock_and_check;
+                rand_int_v(rand_ctr, 3, tmp);
+                if (tmp = 0) then
+                    unlock('0', '1', '0');
+                else
+                    unlock('1', '0', '0');
+                    q_head := (q_head + 1) mod C_DEPTH;
+                    q_fill := q_fill - 1;
+                end if;
+                wait_settle;
+                check(to_integer(unsigned(tx_fifo_fill)) = q_fill,
+                      "TXT FIFO fill level after transmission!");
+            end loop;
+            check(txtb_state = TXT_TOK, "TXT FIFO not in TX OK!");
+
+            if (th < max_fill) then
+                exp_ints := 1;
+            else
+                exp_ints := 0;
+            end if;
+            check(int_ctr = exp_ints, "Threshold interrupts: " &
+                  integer'image(int_ctr) & " Expected: " &
+                  integer'image(exp_ints));
+
+            --------------------------------------------------------------------
+            -- @3. Failed transmission flushes TXT FIFO.
+            --------------------------------------------------------------------
+            info("Step 3");
+            rand_int_v(rand_ctr, C_DEPTH - 1, n_frames);
+            n_frames := n_frames + 1;
+            for i in 1 to n_frames loop
+                insert_frame;
+            end loop;
+            lock_and_check;
+            unlock('0', '0', '1');
+            wait_settle;
+            check(txtb_state = TXT_ERR, "TXT FIFO not in Failed!");
+            check(unsigned(tx_fifo_fill) = 0, "TXT FIFO not flushed!");
+            check(txtb_available = '0', "Flushed TXT FIFO available!");
+            q_head := q_tail;
+            q_fill := 0;
+
+            insert_frame;
+            lock_and_check;
+            unlock('1', '0', '0');
+            q_head := (q_head + 1) mod C_DEPTH;
+            q_fill := q_fill - 1;
+            wait_settle;
+            check(txtb_state = TXT_TOK, "TXT FIFO not in TX OK!");
+
+            --------------------------------------------------------------------
+            -- @4. Abort flushes TXT FIFO, set_empty moves it to Empty.
+            --------------------------------------------------------------------
+            info("Step 4");
+            rand_int_v(rand_ctr, C_DEPTH - 1, n_frames);
+            n_frames := n_frames + 1;
+            for i in 1 to n_frames loop
+                insert_frame;
+            end loop;
+            check(txtb_state = TXT_RDY, "TXT FIFO not Ready!");
+
+            wait until falling_edge(clk_sys);
+            txtb_sw_cmd.set_abt <= '1';
+            wait until falling_edge(clk_sys);
+            txtb_sw_cmd.set_abt <= '0';
+            wait_settle;
+            check(txtb_state = TXT_ABT, "TXT FIFO not Aborted!");
+            check(unsigned(tx_fifo_fill) = 0, "TXT FIFO not flushed!");
+            q_head := q_tail;
+            q_fill := 0;
+
+            txtb_sw_cmd.set_ety <= '1';
+            wait until falling_edge(clk_sys);
+            txtb_sw_cmd.set_ety <= '0';
+            wait_settle;
+            check(txtb_state = TXT_ETY, "TXT FIFO not Empty!");
+
+            loop_ctr <= loop_ctr + 1;
+            wait for 10 ns;
+        end loop;
+
+        evaluate_test(error_tol, error_ctr, status);
+    end process;
+
+    errors <= error_ctr;
+
+end architecture;
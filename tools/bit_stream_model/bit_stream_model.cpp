@@ -0,0 +1,386 @@
+/*******************************************************************************
+ *
+ * CAN FD bit stream model.
+ *
+ * Module: Bit-exact model of CAN / CAN FD frame as transmitted on the bus.
+ *
+ * Copyright (C) 2021-present Ondrej Ille <ondrej.ille@gmail.com>
+ *
+ * This program is free software; you can redistribute it and/or
+ * modify it under the terms of the GNU General Public License
+ * as published by the Free Software Foundation; either version 2
+ * of the License, or (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program; if not, write to the Free Software
+ * Foundation, Inc., 51 Franklin Street, Fifth Floor, Boston, MA  02110-1301, USA.
+ *
+*******************************************************************************/
+
+#include <string.h>
+
+#include "include/bit_stream_model.h"
+
+namespace can_bsm {
+
+static const unsigned int dlc_len[16] = {
+	0, 1, 2, 3, 4, 5, 6, 7, 8, 12, 16, 20, 24, 32, 48, 64
+};
+
+/* Polynomials without the highest term, same as in "can_crc" */
+static const uint32_t crc_pol[3] = {0x4599, 0x3685B, 0x302899};
+static const unsigned int crc_width[3] = {15, 17, 21};
+
+/* Length of unstuffed SOF - data field, longest for extended FD frame */
+static const unsigned int MAX_RAW_BITS = 1 + 32 + 6 + 64 * 8;
+
+
+unsigned int dlc_to_length(unsigned int dlc)
+{
+	return dlc_len[dlc & 0xF];
+}
+
+
+int length_to_dlc(unsigned int length)
+{
+	for (int dlc = 0; dlc < 16; dlc++)
+		if (dlc_len[dlc] == length)
+			return dlc;
+	return -1;
+}
+
+
+uint32_t crc_calc(enum crc_type type, const uint8_t *bits, unsigned int len,
+		  uint32_t init)
+{
+	const unsigned int w = crc_width[type];
+	const uint32_t pol = crc_pol[type];
+	const uint32_t mask = (1u << w) - 1;
+	uint32_t crc = init;
+
+	/* Branch-less, bit values are random and defeat branch prediction */
+	for (unsigned int i = 0; i < len; i++) {
+		uint32_t nxt = (bits[i] ^ (crc >> (w - 1))) & 1;
+		crc = ((crc << 1) & mask) ^ (pol & (0u - nxt));
+	}
+	return crc;
+}
+
+
+/*
+ * Appends bits to sequence with dynamic bit stuffing. Stuff bit is inserted
+ * before a bit which follows five equal consecutive bits (stuff bits
+ * included), as done by "bit_stuffing" circuit.
+ *
+ * State is kept in locals while appending, stores to byte arrays would
+ * otherwise force reload of it for each bit.
+ */
+struct stuffer {
+	struct bit_seq &seq;
+	unsigned int same;
+	unsigned int count;
+
+	explicit stuffer(struct bit_seq &s) : seq(s), same(0), count(0) {}
+
+	/* Returns index of the last appended bit */
+	unsigned int push(const uint8_t *bits, unsigned int n)
+	{
+		uint8_t *value = seq.value;
+		uint8_t *kind = seq.kind;
+		unsigned int len = seq.len;
+		unsigned int s = same;
+		unsigned int c = count;
+		uint8_t prev = len ? value[len - 1] : RECESSIVE;
+
+		for (unsigned int i = 0; i < n; i++) {
+			if (s == 5) {
+				prev = !prev;
+				value[len] = prev;
+				kind[len++] = BIT_STUFF;
+				s = 1;
+				c++;
+			}
+			s = (bits[i] == prev) ? s + 1 : 1;
+			prev = bits[i];
+			value[len] = prev;
+			kind[len++] = BIT_DATA;
+		}
+
+		seq.len = len;
+		same = s;
+		count = c;
+		return len - 1;
+	}
+
+	/* Insert pending stuff bit */
+	void flush()
+	{
+		if (same == 5) {
+			seq.value[seq.len] = !seq.value[seq.len - 1];
+			seq.kind[seq.len++] = BIT_STUFF;
+			same = 1;
+			count++;
+		}
+	}
+};
+
+
+static inline void raw_field(uint8_t *raw, unsigned int &n, uint32_t val,
+			     unsigned int width)
+{
+	while (width--)
+		raw[n++] = (val >> width) & 1;
+}
+
+
+int encode(const struct can_frame &frame, bool iso, struct bit_seq &seq)
+{
+	uint8_t raw[MAX_RAW_BITS];
+	unsigned int n = 0;
+	int dlc = length_to_dlc(frame.data_length);
+
+	if (dlc < 0 || (!frame.fdf && frame.data_length > 8) ||
+	    (frame.fdf && frame.rtr) || (!frame.fdf && frame.brs))
+		return -1;
+	if (frame.id >= (frame.ide ? (1u << 29) : (1u << 11)))
+		return -1;
+
+	/* Unstuffed SOF - data field */
+	raw[n++] = DOMINANT;
+	if (frame.ide) {
+		raw_field(raw, n, frame.id >> 18, 11);
+		raw[n++] = RECESSIVE;			// SRR
+		raw[n++] = RECESSIVE;			// IDE
+		raw_field(raw, n, frame.id & 0x3FFFF, 18);
+	} else {
+		raw_field(raw, n, frame.id, 11);
+	}
+
+	unsigned int brs_raw = 0;
+	if (frame.fdf) {
+		raw[n++] = DOMINANT;			// RRS
+		if (!frame.ide)
+			raw[n++] = DOMINANT;		// IDE
+		raw[n++] = RECESSIVE;			// FDF
+		raw[n++] = DOMINANT;			// res
+		brs_raw = n;
+		raw[n++] = frame.brs;
+		raw[n++] = frame.esi;
+	} else {
+		raw[n++] = frame.rtr;
+		raw[n++] = DOMINANT;			// IDE or r1
+		raw[n++] = DOMINANT;			// r0
+	}
+	raw_field(raw, n, dlc, 4);
+	if (!frame.rtr)
+		for (unsigned int i = 0; i < frame.data_length; i++)
+			raw_field(raw, n, frame.data[i], 8);
+
+	seq.len = 0;
+	seq.brs_index = 0;
+	stuffer st(seq);
+	if (frame.fdf) {
+		seq.brs_index = st.push(raw, brs_raw + 1);
+		st.push(&raw[brs_raw + 1], n - brs_raw - 1);
+	} else {
+		st.push(raw, n);
+	}
+
+	if (!frame.fdf) {
+		/* CRC15 over unstuffed bits, CRC field is stuffed too */
+		uint8_t crc_bits[15];
+		unsigned int crc_len = 0;
+
+		seq.crc_type = CRC_15;
+		seq.crc = crc_calc(CRC_15, raw, n, 0);
+		seq.crc_index = seq.len;
+		seq.stuff_count = 0;
+		raw_field(crc_bits, crc_len, seq.crc, 15);
+		st.push(crc_bits, crc_len);
+		st.flush();
+	} else {
+		/*
+		 * CRC17 / CRC21 over stuffed bits. Pending dynamic stuff bit is
+		 * replaced by the first fixed stuff bit.
+		 */
+		seq.crc_type = (frame.data_length <= 16) ? CRC_17 : CRC_21;
+		seq.stuff_count = st.count % 8;
+
+		uint8_t crc_bits[MAX_FRAME_BITS];
+		unsigned int crc_len = seq.len;
+		memcpy(crc_bits, seq.value, seq.len);
+
+		uint8_t tail[4 + 21];
+		unsigned int tail_len = 0;
+		if (iso) {
+			uint32_t gray = seq.stuff_count ^ (seq.stuff_count >> 1);
+			uint32_t parity = __builtin_popcount(gray) & 1;
+			raw_field(tail, tail_len, (gray << 1) | parity, 4);
+			memcpy(&crc_bits[crc_len], tail, tail_len);
+			crc_len += tail_len;
+		}
+
+		unsigned int w = crc_width[seq.crc_type];
+		uint32_t init = iso ? (1u << (w - 1)) : 0;
+		seq.crc = crc_calc(seq.crc_type, crc_bits, crc_len, init);
+		raw_field(tail, tail_len, seq.crc, w);
+
+		seq.crc_index = seq.len;
+		for (unsigned int i = 0; i < tail_len; i++) {
+			if (i % 4 == 0) {
+				seq.value[seq.len] = !seq.value[seq.len - 1];
+				seq.kind[seq.len++] = BIT_FIXED_STUFF;
+			}
+			seq.value[seq.len] = tail[i];
+			seq.kind[seq.len++] = BIT_DATA;
+		}
+	}
+
+	/* CRC delimiter, ACK, ACK delimiter, EOF */
+	seq.crc_delim_index = seq.len;
+	seq.value[seq.len] = RECESSIVE;
+	seq.kind[seq.len++] = BIT_DATA;
+	seq.value[seq.len] = DOMINANT;
+	seq.kind[seq.len++] = BIT_DATA;
+	for (int i = 0; i < 8; i++) {
+		seq.value[seq.len] = RECESSIVE;
+		seq.kind[seq.len++] = BIT_DATA;
+	}
+
+	return 0;
+}
+
+
+/*
+ * Appends bits of equal bit time to runs. Run in progress is kept in "len"
+ * and "val". Run in progress is stored on each bit and "n" moves only when
+ * the value changes, so there is no branch on bit value.
+ */
+static inline unsigned int add_runs(const uint8_t *value, unsigned int from,
+				    unsigned int to, unsigned int bt,
+				    struct run *runs, unsigned int n,
+				    unsigned int &len, uint8_t &val)
+{
+	unsigned int l = len;
+	uint8_t v = val;
+
+	for (unsigned int i = from; i < to; i++) {
+		unsigned int chg = (value[i] != v);
+
+		runs[n].length = l;
+		runs[n].value = v;
+		n += chg;
+		l = (l & (chg - 1)) + bt;
+		v = value[i];
+	}
+
+	len = l;
+	val = v;
+	return n;
+}
+
+
+unsigned int to_runs(const struct can_frame &frame, const struct bit_seq &seq,
+		     const struct bit_timing &timing, unsigned int idle_before,
+		     unsigned int idle_after, struct run *runs)
+{
+	unsigned int n = 0;
+	unsigned int len = idle_before * timing.nbt;
+
+	/* Without idle, first run starts by SOF */
+	uint8_t val = len ? RECESSIVE : DOMINANT;
+
+	if (frame.fdf && frame.brs) {
+		/* Bit rate is switched in sample point of BRS / CRC delimiter */
+		const unsigned int brs = seq.brs_index;
+		const unsigned int del = seq.crc_delim_index;
+
+		n = add_runs(seq.value, 0, brs, timing.nbt, runs, n, len, val);
+		n = add_runs(seq.value, brs, brs + 1,
+			     timing.nsp + timing.dbt - timing.dsp,
+			     runs, n, len, val);
+		n = add_runs(seq.value, brs + 1, del, timing.dbt, runs, n,
+			     len, val);
+		n = add_runs(seq.value, del, del + 1,
+			     timing.dsp + timing.nbt - timing.nsp,
+			     runs, n, len, val);
+		n = add_runs(seq.value, del + 1, seq.len, timing.nbt, runs, n,
+			     len, val);
+	} else {
+		n = add_runs(seq.value, 0, seq.len, timing.nbt, runs, n, len,
+			     val);
+	}
+
+	/* Frame always ends with recessive EOF */
+	runs[n].length = len + idle_after * timing.nbt;
+	runs[n++].value = val;
+
+	return n;
+}
+
+
+static inline char *put_uint(char *p, unsigned long val, int width)
+{
+	char tmp[24];
+	int n = 0;
+
+	do {
+		tmp[n++] = '0' + (val % 10);
+		val /= 10;
+	} while (val);
+	while (width-- > n)
+		*p++ = ' ';
+	while (n)
+		*p++ = tmp[--n];
+	return p;
+}
+
+
+static inline char *put_str(char *p, const char *s)
+{
+	while (*s)
+		*p++ = *s++;
+	return p;
+}
+
+
+unsigned int format_logger_line(char *buf, const struct can_frame &frame,
+				const struct run *runs, unsigned int n)
+{
+	static const char hex[] = "0123456789abcdef";
+	char *p = buf;
+
+	p = put_str(p, frame.fdf ? "CAN FD  " : "CAN 2.0 ");
+	p = put_str(p, frame.ide ? "EXTENDED " : "BASE     ");
+	p = put_str(p, frame.rtr ? "RTR " : "    ");
+	p = put_str(p, frame.brs ? "BRS " : "    ");
+
+	p = put_str(p, "Data length: ");
+	p = put_uint(p, frame.data_length, 2);
+	p = put_str(p, " ID: ");
+	p = put_uint(p, frame.id, 9);
+	p = put_str(p, " Data: ");
+	for (int i = 0; i < 64; i++) {
+		*p++ = hex[frame.data[i] >> 4];
+		*p++ = hex[frame.data[i] & 0xF];
+		*p++ = ' ';
+	}
+
+	p = put_str(p, "Bit sequence: ");
+	for (unsigned int i = 0; i < n; i++) {
+		p = put_uint(p, runs[i].length, 0);
+		*p++ = ' ';
+		*p++ = (runs[i].value == DOMINANT) ? '1' : '0';
+		*p++ = ' ';
+	}
+	*p++ = '\n';
+
+	return p - buf;
+}
+
+} // namespace can_bsm
@@ -0,0 +1,321 @@
+/*******************************************************************************
+ *
+ * CAN FD bit stream model.
+ *
+ * Module: Generator of reference data sets and checker of recorded data sets.
+ *
+ * Copyright (C) 2021-present Ondrej Ille <ondrej.ille@gmail.com>
+ *
+ * This program is free software; you can redistribute it and/or
+ * modify it under the terms of the GNU General Public License
+ * as published by the Free Software Foundation; either version 2
+ * of the License, or (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program; if not, write to the Free Software
+ * Foundation, Inc., 51 Franklin Street, Fifth Floor, Boston, MA  02110-1301, USA.
+ *
+*******************************************************************************/
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <unistd.h>
+#include <time.h>
+
+#include "include/bit_stream_model.h"
+
+using namespace can_bsm;
+
+/* Idle before the frame and after EOF, in nominal bits */
+#define IDLE_BEFORE	11
+#define IDLE_AFTER	11
+
+/*
+ * Maximal difference of recorded run from modelled run, in samples.
+ * Covers transceiver asymmetry and ACK sent by other node.
+ */
+#define CHECK_TOLERANCE	15
+
+/* Output is buffered and written in chunks of this size */
+#define OUT_BUF_SIZE	(1 << 20)
+
+
+void print_help(void)
+{
+	fprintf(stdout, "Usage: \n");
+	fprintf(stdout, "	can_bit_gen [-s <seed>] [-n] <frame_count> <out_file>\n");
+	fprintf(stdout, "	can_bit_gen [-s <seed>] [-n] -b <frame_count>\n");
+	fprintf(stdout, "	can_bit_gen [-n] -c <data_set>\n\n");
+	fprintf(stdout, "Generates random frames at 500 Kbit / 2 Mbit and "
+			"writes them in Kvaser logger\n"
+			"format. Output is converted to reference data set by "
+			"scripts/convert_data_set.py.\n\n");
+	fprintf(stdout, "	-s	Seed of random generator (default: time)\n");
+	fprintf(stdout, "	-n	Non-ISO CAN FD\n");
+	fprintf(stdout, "	-b	Benchmark, only encode frames\n");
+	fprintf(stdout, "	-c	Check model against reference data set "
+			"(reference_data_set_*.txt)\n");
+	fprintf(stdout, "\n");
+}
+
+
+/* xorshift64*, "rand" is too slow and too short for large data sets */
+static uint64_t rng_state;
+
+static inline uint32_t rng(void)
+{
+	rng_state ^= rng_state >> 12;
+	rng_state ^= rng_state << 25;
+	rng_state ^= rng_state >> 27;
+	return (rng_state * 0x2545F4914F6CDD1DULL) >> 32;
+}
+
+
+/*
+ * Generate random frame with constraints of "generate_can_frame" from
+ * Kvaser logger.
+ */
+static void generate_frame(struct can_frame &frame)
+{
+	frame.ide = rng() % 2;
+	frame.fdf = rng() % 2;
+	frame.esi = false;
+
+	if (frame.fdf) {
+		frame.brs = rng() % 2;
+		frame.rtr = false;
+	} else {
+		frame.rtr = rng() % 2;
+		frame.brs = false;
+	}
+
+	if (frame.fdf) {
+		if (frame.brs)
+			frame.data_length = dlc_to_length(rng() % 16);
+		else
+			frame.data_length = dlc_to_length(rng() % 11);
+	} else {
+		if (frame.rtr)
+			frame.data_length = 0;
+		else
+			frame.data_length = dlc_to_length(rng() % 9);
+	}
+
+	if (frame.ide)
+		frame.id = rng() % (1u << 29);
+	else
+		frame.id = rng() % (1u << 11);
+
+	memset(frame.data, 0, sizeof(frame.data));
+	if (!frame.rtr)
+		for (unsigned int i = 0; i < frame.data_length; i++)
+			frame.data[i] = rng() & 0xFF;
+}
+
+
+static int generate(unsigned long count, bool iso, const char *path)
+{
+	static struct bit_seq seq;
+	static struct run runs[MAX_RUNS];
+	struct can_frame frame;
+	FILE *out = NULL;
+	char *buf = NULL;
+	size_t pos = 0;
+
+	if (path) {
+		out = fopen(path, "w");
+		if (out == NULL) {
+			fprintf(stderr, "Could not open output file!\n");
+			fprintf(stderr, "Path: %s\n", path);
+			return EXIT_FAILURE;
+		}
+		buf = (char *)malloc(OUT_BUF_SIZE + MAX_LINE_LEN);
+	}
+
+	struct timespec start, end;
+	clock_gettime(CLOCK_MONOTONIC, &start);
+
+	unsigned long bits = 0;
+	for (unsigned long i = 0; i < count; i++) {
+		generate_frame(frame);
+		encode(frame, iso, seq);
+		bits += seq.len;
+		unsigned int n = to_runs(frame, seq, REFERENCE_BIT_TIMING,
+					 IDLE_BEFORE, IDLE_AFTER, runs);
+		if (out) {
+			pos += format_logger_line(&buf[pos], frame, runs, n);
+			if (pos >= OUT_BUF_SIZE) {
+				fwrite(buf, 1, pos, out);
+				pos = 0;
+			}
+		}
+	}
+
+	if (out) {
+		fwrite(buf, 1, pos, out);
+		fclose(out);
+		free(buf);
+	}
+
+	clock_gettime(CLOCK_MONOTONIC, &end);
+	double t = (end.tv_sec - start.tv_sec) + (end.tv_nsec - start.tv_nsec) / 1e9;
+	fprintf(stdout, "Frames: %lu, bits: %lu, time: %.3f s, %.0f frames/s\n",
+		count, bits, t, t > 0 ? count / t : 0.0);
+
+	return EXIT_SUCCESS;
+}
+
+
+/*
+ * Parse one line of reference data set (see convert_data_set.py). Recorded
+ * runs are converted from ns to samples.
+ */
+static int parse_reference_item(char *line, struct can_frame &frame,
+				struct run *runs, unsigned int &n)
+{
+	char *p = line;
+	unsigned long v[6];
+
+	for (int i = 0; i < 6; i++) {
+		v[i] = strtoul(p, &p, 10);
+		if (*p != ' ')
+			return -1;
+	}
+	frame.fdf = v[0];
+	frame.ide = v[1];
+	frame.rtr = v[2];
+	frame.brs = v[3];
+	frame.esi = false;
+	frame.data_length = v[4];
+	frame.id = v[5];
+	if (frame.data_length > 64)
+		return -1;
+
+	memset(frame.data, 0, sizeof(frame.data));
+	for (unsigned int i = 0; i < frame.data_length; i++)
+		frame.data[i] = strtoul(p, &p, 16);
+
+	n = strtoul(p, &p, 10);
+	if (n > MAX_RUNS)
+		return -1;
+	for (unsigned int i = 0; i < n; i++) {
+		runs[i].value = strtoul(p, &p, 10);
+		runs[i].length = strtoul(p, &p, 10) / 10;
+	}
+
+	return 0;
+}
+
+
+static int check(const char *path, bool iso)
+{
+	static struct bit_seq seq;
+	static struct run runs[MAX_RUNS];
+	static struct run ref[MAX_RUNS];
+	static char line[MAX_LINE_LEN];
+	struct can_frame frame;
+	unsigned int n_ref;
+	unsigned int items = 0;
+	unsigned int errors = 0;
+
+	FILE *in = fopen(path, "r");
+	if (in == NULL) {
+		fprintf(stderr, "Could not open data set!\n");
+		fprintf(stderr, "Path: %s\n", path);
+		return EXIT_FAILURE;
+	}
+
+	for (unsigned int line_num = 1; fgets(line, sizeof(line), in); line_num++) {
+		if (line[0] == '#' || line[0] == '\n')
+			continue;
+		items++;
+
+		if (parse_reference_item(line, frame, ref, n_ref) ||
+		    encode(frame, iso, seq)) {
+			fprintf(stderr, "Line %u: Invalid reference item\n", line_num);
+			errors++;
+			continue;
+		}
+
+		/*
+		 * Recorded sequence starts by idle and ends by recessive tail of
+		 * variable length, compare all runs in between.
+		 */
+		unsigned int n = to_runs(frame, seq, REFERENCE_BIT_TIMING, 0, 0, runs);
+		if (n_ref != n + 1) {
+			fprintf(stderr, "Line %u: Number of runs: %u, expected: %u\n",
+				line_num, n, n_ref - 1);
+			errors++;
+			continue;
+		}
+		for (unsigned int i = 0; i + 1 < n; i++) {
+			int diff = (int)runs[i].length - (int)ref[i + 1].length;
+			if (runs[i].value != ref[i + 1].value ||
+			    diff > CHECK_TOLERANCE || diff < -CHECK_TOLERANCE) {
+				fprintf(stderr, "Line %u: Run %u: %u %u, expected: "
+					"%u %u\n", line_num, i, runs[i].value,
+					runs[i].length, ref[i + 1].value,
+					ref[i + 1].length);
+				errors++;
+				break;
+			}
+		}
+	}
+	fclose(in);
+
+	fprintf(stdout, "Checked %u frames, %u mismatches\n", items, errors);
+
+	return errors ? EXIT_FAILURE : EXIT_SUCCESS;
+}
+
+
+int main(int argc, char *argv[])
+{
+	const char *check_path = NULL;
+	bool bench = false;
+	bool iso = true;
+	int opt;
+
+	rng_state = time(NULL);
+
+	while ((opt = getopt(argc, argv, "s:nbc:h")) != -1) {
+		switch (opt) {
+		case 's':
+			rng_state = strtoull(optarg, NULL, 0);
+			break;
+		case 'n':
+			iso = false;
+			break;
+		case 'b':
+			bench = true;
+			break;
+		case 'c':
+			check_path = optarg;
+			break;
+		default:
+			print_help();
+			exit(EXIT_FAILURE);
+		}
+	}
+
+	/* xorshift state must not be zero */
+	if (rng_state == 0)
+		rng_state = 1;
+
+	if (check_path)
+		exit(check(check_path, iso));
+
+	if (argc - optind != (bench ? 1 : 2)) {
+		print_help();
+		exit(EXIT_FAILURE);
+	}
+
+	exit(generate(strtoul(argv[optind], NULL, 0), iso,
+		      bench ? NULL : argv[optind + 1]));
+}
@@ -0,0 +1,202 @@
+/*******************************************************************************
+ *
+ * CAN FD bit stream model.
+ *
+ * Module: Bit-exact model of CAN / CAN FD frame as transmitted on the bus.
+ *
+ * Copyright (C) 2021-present Ondrej Ille <ondrej.ille@gmail.com>
+ *
+ * This program is free software; you can redistribute it and/or
+ * modify it under the terms of the GNU General Public License
+ * as published by the Free Software Foundation; either version 2
+ * of the License, or (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program; if not, write to the Free Software
+ * Foundation, Inc., 51 Franklin Street, Fifth Floor, Boston, MA  02110-1301, USA.
+ *
+*******************************************************************************/
+
+#pragma once
+
+#include <stdint.h>
+#include <stdio.h>
+
+namespace can_bsm {
+
+/*
+ * Longest CAN FD frame (extended identifier, 64 data bytes) has less than
+ * 750 bits including stuff bits.
+ */
+constexpr unsigned MAX_FRAME_BITS = 1024;
+
+/* Idle before frame and recessive tail add two runs at most */
+constexpr unsigned MAX_RUNS = MAX_FRAME_BITS + 2;
+
+/* Bit values as on the bus */
+constexpr uint8_t DOMINANT = 0;
+constexpr uint8_t RECESSIVE = 1;
+
+enum bit_kind : uint8_t {
+	BIT_DATA = 0,		// Bit of frame field (or ACK / EOF)
+	BIT_STUFF,		// Dynamic stuff bit
+	BIT_FIXED_STUFF		// Fixed stuff bit in CRC field of CAN FD
+};
+
+enum crc_type {
+	CRC_15,
+	CRC_17,
+	CRC_21
+};
+
+/*
+ * CAN frame. Fields follow "kvalt_can_frame" of Kvaser logger. For extended
+ * identifier, "id" holds all 29 bits, base identifier being bits 28:18.
+ */
+struct can_frame {
+	unsigned int data_length;
+	uint32_t id;
+	bool ide;		// Identifier type: 0 - BASE, 1 - EXTENDED
+	bool fdf;		// Frame type: 0 - CAN 2.0, 1 - CAN FD
+	bool brs;		// Bit rate shift flag
+	bool rtr;		// Remote transmission request flag
+	bool esi;		// Error state indicator
+	uint8_t data[64];	// Data bytes
+};
+
+/*
+ * Bit timing in samples (one sample is 10 ns in Kvaser logger output).
+ * Sample points are counted from start of the bit.
+ */
+struct bit_timing {
+	unsigned int nbt;	// Nominal bit time
+	unsigned int dbt;	// Data bit time
+	unsigned int nsp;	// Nominal sample point
+	unsigned int dsp;	// Data sample point
+};
+
+/* 500 Kbit / 2 Mbit, 80 % sample point, as used by reference tests */
+constexpr bit_timing REFERENCE_BIT_TIMING = {200, 50, 160, 40};
+
+/*
+ * Frame encoded to bits, from SOF till the last bit of EOF.
+ */
+struct bit_seq {
+	uint8_t value[MAX_FRAME_BITS];
+	uint8_t kind[MAX_FRAME_BITS];
+	unsigned int len;
+
+	unsigned int brs_index;		// Index of BRS bit (FD frames)
+	unsigned int crc_index;		// Index of first bit of CRC field
+	unsigned int crc_delim_index;	// Index of CRC delimiter
+
+	enum crc_type crc_type;
+	uint32_t crc;
+	unsigned int stuff_count;	// Dynamic stuff bits till end of data
+};
+
+/*
+ * Run of equal bus values, used for run-length coding of waveform.
+ */
+struct run {
+	unsigned int length;	// In samples
+	uint8_t value;
+};
+
+
+/*
+ * Convert DLC to data length in bytes.
+ */
+unsigned int dlc_to_length(unsigned int dlc);
+
+
+/*
+ * Convert data length in bytes to DLC.
+ *
+ * Returns:
+ *	DLC, or -1 when data length is not valid CAN FD data length.
+ */
+int length_to_dlc(unsigned int length);
+
+
+/*
+ * Calculate CRC over sequence of bits.
+ *
+ * Arguments:
+ *	type	CRC to calculate.
+ *	bits	Bit values (0 / 1), one per byte.
+ *	len	Number of bits.
+ *	init	Initial value of CRC register.
+ */
+uint32_t crc_calc(enum crc_type type, const uint8_t *bits, unsigned int len,
+		  uint32_t init);
+
+
+/*
+ * Encode frame to bit sequence as transmitted on the bus, including dynamic
+ * and fixed stuff bits. ACK slot is dominant (frame acknowledged).
+ *
+ * Bit stuffing follows CTU CAN FD "bit_stuffing": when the last bits of data
+ * field trigger dynamic stuff bit, only fixed stuff bit at start of CRC field
+ * is inserted, and it is not counted in stuff count.
+ *
+ * Arguments:
+ *	frame	Frame to encode.
+ *	iso	ISO CAN FD (stuff count and non-zero CRC init vector) when
+ *		true, Non-ISO CAN FD otherwise. Not used for CAN 2.0 frames.
+ *	seq	Encoded bit sequence.
+ *
+ * Returns:
+ *	0 on success, -1 on invalid frame (RTR with FDF, BRS without FDF,
+ *	invalid data length or identifier).
+ */
+int encode(const struct can_frame &frame, bool iso, struct bit_seq &seq);
+
+
+/*
+ * Convert bit sequence to run-length coded waveform. Bits between sample
+ * point of BRS and sample point of CRC delimiter are in data bit time when
+ * the frame has BRS set.
+ *
+ * Arguments:
+ *	frame		Encoded frame.
+ *	seq		Encoded bit sequence.
+ *	timing		Bit timing.
+ *	idle_before	Number of recessive nominal bits before SOF.
+ *	idle_after	Number of recessive nominal bits after EOF.
+ *	runs		Output runs, at least MAX_RUNS long.
+ *
+ * Returns:
+ *	Number of runs.
+ */
+unsigned int to_runs(const struct can_frame &frame, const struct bit_seq &seq,
+		     const struct bit_timing &timing, unsigned int idle_before,
+		     unsigned int idle_after, struct run *runs);
+
+
+/*
+ * Format frame and its waveform as one line of Kvaser logger output file
+ * (see "store_frame_info" and "parse_stp_output"). As on Signal TAP II input
+ * of logger, "1" is dominant and "0" is recessive. Unlike logger, run
+ * lengths are exact number of samples.
+ *
+ * Arguments:
+ *	buf	Output buffer, at least MAX_LINE_LEN long.
+ *	frame	Frame.
+ *	runs	Runs of frame waveform.
+ *	n	Number of runs.
+ *
+ * Returns:
+ *	Length of formatted line (including terminating new line).
+ */
+constexpr unsigned MAX_LINE_LEN = 512 + MAX_RUNS * 16;
+
+unsigned int format_logger_line(char *buf, const struct can_frame &frame,
+				const struct run *runs, unsigned int n);
+
+} // namespace can_bsm
@@ -0,0 +1,656 @@
+/*******************************************************************************
+ *
+ * CAN bus simulator.
+ *
+ * Module: Analytical throughput model and RX / TXT Buffer sizing.
+ *
+ * Copyright (C) 2021-present Ondrej Ille <ondrej.ille@gmail.com>
+ *
+ * This program is free software; you can redistribute it and/or
+ * modify it under the terms of the GNU General Public License
+ * as published by the Free Software Foundation; either version 2
+ * of the License, or (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program; if not, write to the Free Software
+ * Foundation, Inc., 51 Franklin Street, Fifth Floor, Boston, MA  02110-1301, USA.
+ *
+*******************************************************************************/
+
+/*
+ * Frame time is bounded by frames without stuff bits and frames with the
+ * worst case number of dynamic stuff bits. Bits from SOF till BRS and after
+ * CRC delimiter are counted in nominal bit time, bits after BRS till CRC
+ * delimiter in data bit time (BRS and CRC delimiter take one nominal and one
+ * data bit together). Worst case stuff bits are placed to arbitration phase
+ * first, as it is slower.
+ *
+ * RX Buffer must hold frames which arrive between the first frame is stored
+ * and the driver reads it out, i.e. during service latency plus read of one
+ * frame. Frames arrive at most once per the shortest frame time.
+ */
+
+#include <err.h>
+#include <math.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <unistd.h>
+#include <vector>
+
+#include "include/can_bus_sim.h"
+
+using namespace can_bus_sim;
+
+/* Limits of RTL generics (can_top_level) */
+#define RX_BUFF_SIZE_MIN	32
+#define RX_BUFF_SIZE_MAX	4096
+#define TXT_BUFF_COUNT_MIN	2
+#define TXT_BUFF_COUNT_MAX	8
+
+/* Frames encoded per mix entry in check of frame length bounds */
+#define CHECK_ENCODE_FRAMES	10000
+
+struct frame_type {
+	bool ide;
+	bool fdf;
+	bool brs;
+	bool rtr;
+	unsigned len;
+	double weight;
+
+	/* Bits from SOF till the end of EOF, nominal and data bit rate */
+	unsigned nom_min, data_min;
+	unsigned nom_max, data_max;
+
+	/* Frame period including intermission, ns */
+	double t_min, t_max;
+
+	/* Words in RX Buffer */
+	unsigned words;
+};
+
+struct config {
+	uint32_t bitrate;
+	uint32_t dbitrate;
+	bool iso;
+	bool ets;
+	double latency;		// Worst case service latency, ns
+	double rx_cost;		// Read of one frame, ns
+	double tx_refill;	// TXT Buffer completion till ready again, ns
+	double rate;		// Offered frames/s on the bus
+};
+
+static struct config cfg = {
+	500000, 2000000, true, false, 100000, 1000, 100000, 0
+};
+
+static std::vector<frame_type> mix;
+
+static uint64_t rng_state = 1;
+
+
+static uint64_t rng(void)
+{
+	rng_state ^= rng_state << 13;
+	rng_state ^= rng_state >> 7;
+	rng_state ^= rng_state << 17;
+	return rng_state;
+}
+
+
+/*
+ * Parse frame type: [b|e][c|r|f|F]:<data length>[:<weight>]
+ */
+static bool parse_type(const char *s, struct frame_type &ft)
+{
+	char *end;
+
+	memset(&ft, 0, sizeof(ft));
+	ft.weight = 1;
+
+	if (s[0] != 'b' && s[0] != 'e')
+		return false;
+	ft.ide = s[0] == 'e';
+
+	switch (s[1]) {
+	case 'c':
+		break;
+	case 'r':
+		ft.rtr = true;
+		break;
+	case 'F':
+		ft.brs = true;
+		/* fall through */
+	case 'f':
+		ft.fdf = true;
+		break;
+	default:
+		return false;
+	}
+
+	if (s[2] != ':')
+		return false;
+	ft.len = strtoul(s + 3, &end, 0);
+	if (end == s + 3 || can_bsm::length_to_dlc(ft.len) < 0 ||
+	    (!ft.fdf && ft.len > 8))
+		return false;
+	if (*end == ':') {
+		ft.weight = strtod(end + 1, &end);
+		if (ft.weight <= 0)
+			return false;
+	}
+	return *end == '\0';
+}
+
+
+static void frame_bits(struct frame_type &ft)
+{
+	unsigned data = ft.rtr ? 0 : 8 * ft.len;
+	unsigned arb, stuffed, crc, tail, stuff_arb, stuff_all;
+
+	/* CRC delimiter, ACK, ACK delimiter, EOF */
+	tail = 1 + 1 + 1 + 7;
+
+	if (!ft.fdf) {
+		/* SOF till the end of CRC is stuffed */
+		stuffed = (ft.ide ? 39 : 19) + data + 15;
+		ft.nom_min = stuffed + tail;
+		ft.nom_max = ft.nom_min + (stuffed - 1) / 4;
+		ft.data_min = 0;
+		ft.data_max = 0;
+		return;
+	}
+
+	/* SOF till BRS and SOF till the end of data field */
+	arb = ft.ide ? 36 : 17;
+	stuffed = arb + 1 + 4 + data;
+
+	/*
+	 * CRC field with fixed stuff bits: (ISO only) stuff count, CRC, stuff
+	 * bit before the field and after each 4 bits.
+	 */
+	crc = (cfg.iso ? 4 : 0) + (ft.len > 16 ? 21 : 17);
+	crc += 1 + (crc - 1) / 4;
+
+	stuff_all = (stuffed - 1) / 4;
+	stuff_arb = (arb - 1) / 4;
+
+	if (ft.brs) {
+		ft.nom_min = arb + tail - 1;
+		ft.data_min = stuffed - arb + crc + 1;
+		ft.nom_max = ft.nom_min + stuff_arb;
+		ft.data_max = ft.data_min + stuff_all - stuff_arb;
+	} else {
+		ft.nom_min = stuffed + crc + tail;
+		ft.nom_max = ft.nom_min + stuff_all;
+		ft.data_min = 0;
+		ft.data_max = 0;
+	}
+}
+
+
+static void frame_analyze(struct frame_type &ft)
+{
+	double nbt = 1e9 / cfg.bitrate;
+	double dbt = 1e9 / cfg.dbitrate;
+
+	frame_bits(ft);
+	ft.t_min = (ft.nom_min + INTERMISSION_BITS) * nbt + ft.data_min * dbt;
+	ft.t_max = (ft.nom_max + INTERMISSION_BITS) * nbt + ft.data_max * dbt;
+	ft.words = 1 + ctucan_hw_rx_frame_rwcnt(ft.rtr ? 0 : ft.len, cfg.ets);
+}
+
+
+static const char *frame_name(const struct frame_type &ft)
+{
+	static char buf[32];
+
+	snprintf(buf, sizeof(buf), "%s %s%s %u", ft.ide ? "ext " : "base",
+		 ft.fdf ? "FD" : (ft.rtr ? "RTR" : "2.0"), ft.brs ? "+BRS" : "",
+		 ft.len);
+	return buf;
+}
+
+
+struct result {
+	double t_avg_min, t_avg_max;	// Average frame period, ns
+	double t_min;			// Shortest frame period, ns
+	unsigned words_max;
+	bool rx_bounded;
+	unsigned rx_peak;		// Words
+	unsigned rx_size;		// Power of 2 generic, 0 if not possible
+	unsigned txt_count;		// 0 if not possible
+};
+
+
+static struct result analyze(void)
+{
+	struct result r;
+	double wsum = 0;
+	unsigned frames;
+
+	memset(&r, 0, sizeof(r));
+	r.t_min = INFINITY;
+	for (auto &ft : mix) {
+		frame_analyze(ft);
+		wsum += ft.weight;
+		r.t_avg_min += ft.weight * ft.t_min;
+		r.t_avg_max += ft.weight * ft.t_max;
+		if (ft.t_min < r.t_min)
+			r.t_min = ft.t_min;
+		if (ft.words > r.words_max)
+			r.words_max = ft.words;
+	}
+	r.t_avg_min /= wsum;
+	r.t_avg_max /= wsum;
+
+	/* Driver must read a frame faster than the shortest frame arrives */
+	r.rx_bounded = cfg.rx_cost < r.t_min;
+	if (r.rx_bounded) {
+		frames = 1 + (unsigned)floor((cfg.latency + cfg.rx_cost) / r.t_min);
+		r.rx_peak = frames * r.words_max;
+		for (r.rx_size = RX_BUFF_SIZE_MIN; r.rx_size < r.rx_peak;
+		     r.rx_size *= 2)
+			;
+		if (r.rx_size > RX_BUFF_SIZE_MAX)
+			r.rx_size = 0;
+	}
+
+	/*
+	 * Back to back transmission: while the driver refills completed
+	 * buffer, the other buffers keep the bus busy.
+	 */
+	r.txt_count = 1 + (unsigned)ceil(cfg.tx_refill / r.t_min);
+	if (r.txt_count < TXT_BUFF_COUNT_MIN)
+		r.txt_count = TXT_BUFF_COUNT_MIN;
+	if (r.txt_count > TXT_BUFF_COUNT_MAX)
+		r.txt_count = 0;
+
+	return r;
+}
+
+
+static void report(const struct result &r)
+{
+	printf("# %u / %u bit/s, %s, %s\n", cfg.bitrate, cfg.dbitrate,
+	       cfg.iso ? "ISO" : "Non-ISO", cfg.ets ? "both timestamps" :
+	       "one timestamp");
+	printf("# frame               weight  nom_bits  data_bits  "
+	       "time[us]          words\n");
+	for (auto &ft : mix)
+		printf("%-20s %6.2f %4u-%-4u %5u-%-4u %8.2f-%-8.2f %5u\n",
+		       frame_name(ft), ft.weight, ft.nom_min, ft.nom_max,
+		       ft.data_min, ft.data_max, ft.t_min / 1e3, ft.t_max / 1e3,
+		       ft.words);
+
+	printf("max frame rate:      %.0f - %.0f frames/s\n",
+	       1e9 / r.t_avg_max, 1e9 / r.t_avg_min);
+	if (cfg.rate)
+		printf("bus utilization:     %.1f - %.1f %% at %.0f frames/s\n",
+		       100 * cfg.rate * r.t_avg_min / 1e9,
+		       100 * cfg.rate * r.t_avg_max / 1e9, cfg.rate);
+
+	if (!r.rx_bounded) {
+		printf("rx_buffer_size:      none, read of frame (%.0f ns) is not "
+		       "faster than the shortest frame (%.0f ns)\n", cfg.rx_cost,
+		       r.t_min);
+	} else {
+		printf("RX occupancy:        %u words (latency %.0f ns)\n",
+		       r.rx_peak, cfg.latency);
+		if (r.rx_size)
+			printf("rx_buffer_size:      %u\n", r.rx_size);
+		else
+			printf("rx_buffer_size:      none, more than %u words "
+			       "needed\n", RX_BUFF_SIZE_MAX);
+	}
+
+	if (r.txt_count)
+		printf("txt_buffer_count:    %u (refill %.0f ns)\n", r.txt_count,
+		       cfg.tx_refill);
+	else
+		printf("txt_buffer_count:    none, more than %u buffers needed "
+		       "(refill %.0f ns)\n", TXT_BUFF_COUNT_MAX, cfg.tx_refill);
+}
+
+
+static void random_frame(const struct frame_type &ft, can_bsm::can_frame &f)
+{
+	memset(&f, 0, sizeof(f));
+	f.ide = ft.ide;
+	f.fdf = ft.fdf;
+	f.brs = ft.brs;
+	f.rtr = ft.rtr;
+	f.data_length = ft.len;
+	f.id = rng() & (ft.ide ? 0x1FFFFFFF : 0x7FF);
+	for (unsigned i = 0; i < ft.len; i++)
+		f.data[i] = rng();
+}
+
+
+/*
+ * Encoded frames must fit bit and time bounds. Data with many equal bits is
+ * mixed in to get close to the worst case stuffing.
+ */
+static unsigned check_bits(void)
+{
+	double nbt = 1e9 / cfg.bitrate;
+	double dbt = 1e9 / cfg.dbitrate;
+	unsigned fails = 0;
+
+	for (auto &ft : mix) {
+		unsigned lo = UINT32_MAX, hi = 0;
+
+		for (unsigned i = 0; i < CHECK_ENCODE_FRAMES; i++) {
+			can_bsm::can_frame f;
+			can_bsm::bit_seq seq;
+			unsigned nom, data;
+			double t;
+
+			random_frame(ft, f);
+			if (i & 1) {
+				memset(f.data, (i & 2) ? 0xFF : 0x00, sizeof(f.data));
+				f.id = (i & 2) ? 0 : f.id | 0x1F;
+			}
+			if (can_bsm::encode(f, cfg.iso, seq))
+				errx(1, "%s: can not encode", frame_name(ft));
+
+			if (ft.brs) {
+				data = seq.crc_delim_index - seq.brs_index;
+				nom = seq.len - data;
+			} else {
+				nom = seq.len;
+				data = 0;
+			}
+			t = (nom + INTERMISSION_BITS) * nbt + data * dbt;
+			if (seq.len < ft.nom_min + ft.data_min ||
+			    seq.len > ft.nom_max + ft.data_max ||
+			    t < ft.t_min - 0.5 || t > ft.t_max + 0.5) {
+				fprintf(stderr, "%s: encoded frame has %u + %u "
+					"bits\n", frame_name(ft), nom, data);
+				fails++;
+				break;
+			}
+			if (seq.len < lo)
+				lo = seq.len;
+			if (seq.len > hi)
+				hi = seq.len;
+		}
+		printf("%-20s encoded %u-%u bits, bounds %u-%u\n",
+		       frame_name(ft), lo, hi, ft.nom_min + ft.data_min,
+		       ft.nom_max + ft.data_max);
+	}
+	return fails;
+}
+
+
+static const struct frame_type *pick_type(void)
+{
+	double wsum = 0, x;
+
+	for (auto &ft : mix)
+		wsum += ft.weight;
+	x = (rng() >> 11) * (1.0 / 9007199254740992.0) * wsum;
+	for (auto &ft : mix) {
+		if (x < ft.weight)
+			return &ft;
+		x -= ft.weight;
+	}
+	return &mix.back();
+}
+
+
+/*
+ * Node 0 transmits back to back, node 1 reads its RX Buffer via HAL
+ * "latency" after the first frame is stored, one frame per "rx_cost". Bus
+ * time must lie within the bounds of transmitted frames and RX Buffer of
+ * recommended size must not overrun nor exceed predicted occupancy.
+ */
+static unsigned check_sim(const struct result &r, double duration)
+{
+	bus b(2, r.rx_size, rng() | 1);
+	struct ctucan_hw_priv *tx = b[0].hw();
+	struct ctucan_hw_priv *rx = b[1].hw();
+	const struct frame_type *slot[TXT_BUFFERS] = {};
+	struct net_device nd;
+	struct can_bittiming nbt, dbt;
+	struct can_ctrlmode mode;
+	double lo = 0, hi = 0;
+	uint64_t end = (uint64_t)duration, read_at = UINT64_MAX;
+	unsigned peak = 0, frames = 0, fails = 0;
+
+	memset(&nd, 0, sizeof(nd));
+	nd.can.clock.freq = 1000000000 / SYS_CLK_NS;
+	memset(&nbt, 0, sizeof(nbt));
+	nbt.bitrate = cfg.bitrate;
+	nbt.sample_point = 800;
+	memset(&dbt, 0, sizeof(dbt));
+	dbt.bitrate = cfg.dbitrate;
+	dbt.sample_point = 800;
+	if (can_get_bittiming(&nd, &nbt, &ctu_can_fd_bit_timing_max, NULL, 0) ||
+	    can_get_bittiming(&nd, &dbt, &ctu_can_fd_bit_timing_data_max, NULL, 0))
+		errx(1, "can_get_bittiming: %u / %u bit/s", cfg.bitrate,
+		     cfg.dbitrate);
+	if (nbt.bitrate != cfg.bitrate || dbt.bitrate != cfg.dbitrate)
+		errx(1, "bit rate is not exact at %u Hz", nd.can.clock.freq);
+
+	mode.flags = CAN_CTRLMODE_FD | (cfg.iso ? 0 : CAN_CTRLMODE_FD_NON_ISO);
+	mode.mask = 0xFFFFFFFF;
+	for (unsigned i = 0; i < 2; i++) {
+		struct ctucan_hw_priv *hw = b[i].hw();
+
+		ctucan_hw_reset(hw);
+		ctucan_hw_set_nom_bittiming(hw, &nbt);
+		ctucan_hw_set_data_bittiming(hw, &dbt);
+		ctucan_hw_set_mode(hw, &mode);
+		ctucan_hw_set_rx_both_ts(hw, cfg.ets);
+		ctucan_hw_enable(hw, true);
+	}
+
+	for (;;) {
+		uint64_t t;
+
+		/* Account finished frames, keep all TXT Buffers of node 0 busy */
+		for (unsigned i = 0; i < TXT_BUFFERS; i++) {
+			enum ctu_can_fd_tx_status_tx1s st;
+			can_bsm::can_frame f;
+			struct canfd_frame cf;
+
+			st = ctucan_hw_get_tx_status(tx, i);
+			if (st == TXT_RDY || st == TXT_TRAN)
+				continue;
+			if (st == TXT_TOK) {
+				lo += slot[i]->t_min;
+				hi += slot[i]->t_max;
+				ctucan_hw_txt_set_empty(tx, i);
+			}
+			if (b.now() >= end)
+				continue;
+
+			slot[i] = pick_type();
+			random_frame(*slot[i], f);
+			memset(&cf, 0, sizeof(cf));
+			cf.can_id = f.id | (f.ide ? CAN_EFF_FLAG : 0) |
+				    (f.rtr ? CAN_RTR_FLAG : 0);
+			cf.len = f.data_length;
+			cf.flags = f.brs ? CANFD_BRS : 0;
+			memcpy(cf.data, f.data, f.data_length);
+			ctucan_hw_insert_frame(tx, &cf, 0, i, f.fdf);
+			ctucan_hw_txt_set_rdy(tx, i);
+		}
+		if (b.now() >= end)
+			break;
+
+		if (read_at == UINT64_MAX && !ctucan_hw_is_rx_fifo_empty(rx))
+			read_at = b.now() + (uint64_t)cfg.latency;
+
+		t = b.next_event();
+		if (read_at < t)
+			t = read_at;
+		if (t > end)
+			t = end;
+		b.advance(t);
+
+		if (r.rx_size - ctucan_hw_get_rx_fifo_mem_free(rx) > peak)
+			peak = r.rx_size - ctucan_hw_get_rx_fifo_mem_free(rx);
+
+		if (b.now() < read_at)
+			continue;
+		if (ctucan_hw_get_rx_frame_count(rx)) {
+			struct canfd_frame cf;
+			u64 ts;
+
+			ctucan_hw_read_rx_frame(rx, &cf, &ts);
+			frames++;
+			read_at = b.now() + (uint64_t)cfg.rx_cost;
+		} else {
+			read_at = UINT64_MAX;
+		}
+	}
+
+	printf("simulated %u frames in %.0f ms, bus busy %.3f ms, bounds "
+	       "%.3f - %.3f ms\n", frames, duration / 1e6,
+	       b.stats().busy_ns / 1e6, lo / 1e6, hi / 1e6);
+	printf("simulated RX occupancy %u words, predicted %u, "
+	       "rx_buffer_size %u\n", peak, r.rx_peak, r.rx_size);
+
+	/* Bounds are rounded to ns by the bus */
+	if (b.stats().busy_ns + b.stats().frames < lo ||
+	    b.stats().busy_ns > hi + b.stats().frames) {
+		fprintf(stderr, "bus time out of bounds\n");
+		fails++;
+	}
+	if (peak > r.rx_peak || b[1].stats().rx_overrun) {
+		fprintf(stderr, "RX Buffer occupancy above prediction\n");
+		fails++;
+	}
+	return fails;
+}
+
+
+static unsigned check(const struct result &r)
+{
+	unsigned fails = check_bits();
+
+	if (!r.rx_bounded || !r.rx_size) {
+		fprintf(stderr, "RX Buffer size not available, simulation "
+			"skipped\n");
+		return fails + 1;
+	}
+	fails += check_sim(r, 200e6);
+
+	printf("%s\n", fails ? "FAILED" : "PASSED");
+	return fails;
+}
+
+
+void print_help(void)
+{
+	fprintf(stdout, "Usage: \n");
+	fprintf(stdout, "	can_bus_calc [options] [-m <frame>]...\n\n");
+	fprintf(stdout, "Computes frame rate, bus utilization, RX Buffer "
+			"occupancy and minimal\n"
+			"rx_buffer_size / txt_buffer_count for a frame mix.\n\n");
+	fprintf(stdout, "	-b	Nominal bit rate (default: 500000)\n");
+	fprintf(stdout, "	-B	Data bit rate (default: 2000000)\n");
+	fprintf(stdout, "	-m	Frame type [b|e][c|r|f|F]:<length>[:<weight>]\n"
+			"		b/e - base/extended identifier, c - CAN 2.0, "
+			"r - RTR,\n"
+			"		f - CAN FD, F - CAN FD with BRS "
+			"(default: bc:8)\n");
+	fprintf(stdout, "	-L	Worst case RX service latency in ns "
+			"(default: 100000)\n");
+	fprintf(stdout, "	-R	Read of one frame in ns (default: 1000)\n");
+	fprintf(stdout, "	-X	TXT Buffer refill latency in ns "
+			"(default: 100000)\n");
+	fprintf(stdout, "	-r	Offered frames/s, for bus utilization\n");
+	fprintf(stdout, "	-n	Non-ISO CAN FD\n");
+	fprintf(stdout, "	-t	Both timestamps stored in RX Buffer\n");
+	fprintf(stdout, "	-c	Check the model against bit stream model and "
+			"simulation\n");
+	fprintf(stdout, "	-s	Seed of random generator for check "
+			"(default: 1)\n");
+}
+
+
+int main(int argc, char *argv[])
+{
+	struct result r;
+	bool do_check = false;
+	int opt;
+
+	while ((opt = getopt(argc, argv, "b:B:m:L:R:X:r:ntcs:h")) != -1) {
+		switch (opt) {
+		case 'b':
+			cfg.bitrate = strtoul(optarg, NULL, 0);
+			break;
+		case 'B':
+			cfg.dbitrate = strtoul(optarg, NULL, 0);
+			break;
+		case 'm': {
+			struct frame_type ft;
+
+			if (!parse_type(optarg, ft))
+				errx(1, "invalid frame type: %s", optarg);
+			mix.push_back(ft);
+			break;
+		}
+		case 'L':
+			cfg.latency = strtod(optarg, NULL);
+			break;
+		case 'R':
+			cfg.rx_cost = strtod(optarg, NULL);
+			break;
+		case 'X':
+			cfg.tx_refill = strtod(optarg, NULL);
+			break;
+		case 'r':
+			cfg.rate = strtod(optarg, NULL);
+			break;
+		case 'n':
+			cfg.iso = false;
+			break;
+		case 't':
+			cfg.ets = true;
+			break;
+		case 'c':
+			do_check = true;
+			break;
+		case 's':
+			rng_state = strtoull(optarg, NULL, 0);
+			break;
+		default:
+			print_help();
+			exit(EXIT_FAILURE);
+		}
+	}
+
+	if (!cfg.bitrate || !cfg.dbitrate || optind != argc) {
+		print_help();
+		exit(EXIT_FAILURE);
+	}
+
+	/* xorshift state must not be zero */
+	if (rng_state == 0)
+		rng_state = 1;
+
+	if (mix.empty()) {
+		struct frame_type ft;
+
+		parse_type("bc:8", ft);
+		mix.push_back(ft);
+	}
+
+	r = analyze();
+	report(r);
+
+	if (do_check)
+		exit(check(r) ? EXIT_FAILURE : EXIT_SUCCESS);
+
+	return EXIT_SUCCESS;
+}
@@ -0,0 +1,1055 @@
+/*******************************************************************************
+ *
+ * CAN bus simulator.
+ *
+ * Module: Virtual CAN bus with register models of CTU CAN FD nodes.
+ *
+ * Copyright (C) 2021-present Ondrej Ille <ondrej.ille@gmail.com>
+ *
+ * This program is free software; you can redistribute it and/or
+ * modify it under the terms of the GNU General Public License
+ * as published by the Free Software Foundation; either version 2
+ * of the License, or (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program; if not, write to the Free Software
+ * Foundation, Inc., 51 Franklin Street, Fifth Floor, Boston, MA  02110-1301, USA.
+ *
+*******************************************************************************/
+
+#include <string.h>
+
+#include "include/can_bus_sim.h"
+
+/* Bit timing limits of the core, as in ctucanfd_base.c */
+const struct can_bittiming_const ctu_can_fd_bit_timing_max = {
+	"ctu_can_fd",
+	2,
+	190,
+	1,
+	63,
+	31,
+	1,
+	8,
+	1
+};
+
+const struct can_bittiming_const ctu_can_fd_bit_timing_data_max = {
+	"ctu_can_fd",
+	2,
+	94,
+	1,
+	31,
+	31,
+	1,
+	2,
+	1
+};
+
+namespace can_bus_sim {
+
+/* INT_STAT bits, order as in union ctu_can_fd_int_stat */
+static const uint32_t INT_RXI = 1 << 0;
+static const uint32_t INT_TXI = 1 << 1;
+static const uint32_t INT_EWLI = 1 << 2;
+static const uint32_t INT_DOI = 1 << 3;
+static const uint32_t INT_FCSI = 1 << 4;
+static const uint32_t INT_ALI = 1 << 5;
+static const uint32_t INT_BEI = 1 << 6;
+static const uint32_t INT_RXFI = 1 << 8;
+static const uint32_t INT_RBNEI = 1 << 10;
+static const uint32_t INT_TXBHCI = 1 << 11;
+
+/* Version reported in DEVICE_ID, same as RTL */
+static const unsigned VERSION_MAJOR = 2;
+static const unsigned VERSION_MINOR = 5;
+
+/* Number of data bits in arbitration field, including SOF and IDE */
+static const unsigned ARB_BITS_BASE = 1 + 11 + 1 + 1;
+static const unsigned ARB_BITS_EXT = 1 + 11 + 1 + 1 + 18 + 1;
+
+
+/*****************************************************************************
+ * Node
+ ****************************************************************************/
+
+node::node(bus &b, unsigned index, unsigned rx_buf_words)
+	: b(b), idx(index), rx_size(rx_buf_words)
+{
+	port.hw.mem_base = NULL;
+	port.hw.read_reg = hw_read;
+	port.hw.write_reg = hw_write;
+	port.hw.ts_high_latch = true;
+	port.n = this;
+	memset(&st, 0, sizeof(st));
+	reset();
+}
+
+
+u32 node::hw_read(struct ctucan_hw_priv *priv,
+		  enum ctu_can_fd_can_registers reg)
+{
+	return reinterpret_cast<hw_port *>(priv)->n->read(reg);
+}
+
+
+void node::hw_write(struct ctucan_hw_priv *priv,
+		    enum ctu_can_fd_can_registers reg, u32 val)
+{
+	reinterpret_cast<hw_port *>(priv)->n->write(reg, val);
+}
+
+
+void node::reset()
+{
+	mode.u32 = 0;
+	mode.s.fde = FDE_ENABLE;
+	int_stat = 0;
+	int_ena = 0;
+	int_mask = 0;
+
+	/* 500 Kbit / 2 Mbit at 100 MHz until driver configures bit timing */
+	btr.u32 = 0;
+	btr.s.brp = 10;
+	btr.s.prop = 7;
+	btr.s.ph1 = 8;
+	btr.s.ph2 = 4;
+	btr.s.sjw = 2;
+	btr_fd.u32 = 0;
+	btr_fd.s.brp_fd = 2;
+	btr_fd.s.prop_fd = 15;
+	btr_fd.s.ph1_fd = 24;
+	btr_fd.s.ph2_fd = 10;
+	btr_fd.s.sjw_fd = 2;
+
+	ewl = 96;
+	erp = 128;
+	rec = 0;
+	tec = 0;
+	fault = FLT_ERR_ACTIVE;
+	ewl_reached = false;
+	err_capt_alc = 0;
+	rx_fr_ctr = 0;
+	tx_fr_ctr = 0;
+	ts_high_latch = 0;
+
+	rx_buf.clear();
+	rx_frame_words.clear();
+	rx_read = 0;
+	rx_settings.u32 = 0;
+	dor = false;
+	rx_drop_ctr = 0;
+
+	for (unsigned i = 0; i < TXT_BUFFERS; i++)
+		txt_state[i] = TXT_ETY;
+	memset(txt_mem, 0, sizeof(txt_mem));
+	tx_priority = 1;
+	tx_buf = -1;
+	retr_ctr = 0;
+	tx_cpl.clear();
+	tx_cpl_ts.clear();
+	tx_cpl_of = false;
+
+	suspend_until = 0;
+	bus_off_until = 0;
+}
+
+
+bool node::irq() const
+{
+	return (int_stat & int_ena) != 0;
+}
+
+
+void node::set_int(uint32_t bits)
+{
+	int_stat |= bits & ~int_mask;
+}
+
+
+/* RBNEI is set as long as RX Buffer is not empty */
+void node::update_rbnei()
+{
+	if (!rx_frame_words.empty())
+		set_int(INT_RBNEI);
+}
+
+
+uint32_t node::rx_pop()
+{
+	uint32_t w;
+
+	if (rx_buf.empty())
+		return 0;
+
+	w = rx_buf.front();
+	rx_buf.pop_front();
+	if (++rx_read == rx_frame_words.front()) {
+		rx_frame_words.pop_front();
+		rx_read = 0;
+	}
+	return w;
+}
+
+
+uint32_t node::tx_cpl_pop()
+{
+	union ctu_can_fd_tx_cpl cpl;
+
+	if (tx_cpl.empty())
+		return 0;
+
+	cpl.u32 = tx_cpl.front();
+	cpl.s.tccnt = tx_cpl.size();
+	cpl.s.tcof = tx_cpl_of;
+	cpl.s.tcv = 1;
+	tx_cpl.pop_front();
+	tx_cpl_ts.pop_front();
+	tx_cpl_of = false;
+	return cpl.u32;
+}
+
+
+uint32_t node::read(uint32_t addr)
+{
+	addr &= 0xFFC;
+
+	/* Every read from RX data window pops a word, regardless of address */
+	if (addr >= CTU_CAN_FD_RX_DATA_WINDOW && addr < CTU_CAN_FD_RX_DATA_WINDOW + 0x100)
+		return rx_pop();
+
+	switch (addr) {
+	case CTU_CAN_FD_DEVICE_ID: {
+		union ctu_can_fd_device_id_version reg;
+
+		reg.u32 = 0;
+		reg.s.device_id = CTU_CAN_FD_ID;
+		reg.s.ver_minor = VERSION_MINOR;
+		reg.s.ver_major = VERSION_MAJOR;
+		return reg.u32;
+	}
+	case CTU_CAN_FD_MODE:
+		return mode.u32;
+	case CTU_CAN_FD_STATUS: {
+		union ctu_can_fd_status reg;
+
+		reg.u32 = 0;
+		reg.s.rxne = !rx_frame_words.empty();
+		reg.s.dor = dor;
+		for (unsigned i = 0; i < TXT_BUFFERS; i++)
+			if (txt_state[i] == TXT_ETY)
+				reg.s.txnf = 1;
+		reg.s.txs = tx_buf >= 0;
+		reg.s.ewl = ewl_reached;
+		reg.s.idle = !enabled() || is_bus_off();
+		reg.s.stcnt = 1;
+		reg.s.srxpk = 1;
+		reg.s.stcpl = 1;
+		return reg.u32;
+	}
+	case CTU_CAN_FD_INT_STAT:
+		return int_stat;
+	case CTU_CAN_FD_INT_ENA_SET:
+		return int_ena;
+	case CTU_CAN_FD_INT_MASK_SET:
+		return int_mask;
+	case CTU_CAN_FD_BTR:
+		return btr.u32;
+	case CTU_CAN_FD_BTR_FD:
+		return btr_fd.u32;
+	case CTU_CAN_FD_EWL: {
+		union ctu_can_fd_ewl_erp_fault_state reg;
+
+		reg.u32 = 0;
+		reg.s.ew_limit = ewl;
+		reg.s.erp_limit = erp;
+		reg.s.era = fault == FLT_ERR_ACTIVE;
+		reg.s.erp = fault == FLT_ERR_PASSIVE;
+		reg.s.bof = fault == FLT_BUS_OFF;
+		return reg.u32;
+	}
+	case CTU_CAN_FD_REC: {
+		union ctu_can_fd_rec_tec reg;
+
+		reg.u32 = 0;
+		reg.s.rec_val = rec;
+		reg.s.tec_val = tec;
+		return reg.u32;
+	}
+	case CTU_CAN_FD_RX_MEM_INFO: {
+		union ctu_can_fd_rx_mem_info reg;
+
+		reg.u32 = 0;
+		reg.s.rx_buff_size = rx_size;
+		reg.s.rx_mem_free = rx_size - rx_buf.size();
+		return reg.u32;
+	}
+	case CTU_CAN_FD_RX_STATUS: {
+		union ctu_can_fd_rx_status_rx_settings reg;
+
+		reg.u32 = rx_settings.u32;
+		reg.s.rxe = rx_frame_words.empty();
+		reg.s.rxf = rx_buf.size() == rx_size;
+		reg.s.rxmof = rx_read > 0;
+		reg.s.rxfrc = rx_frame_words.size();
+		return reg.u32;
+	}
+	case CTU_CAN_FD_RX_DATA:
+		return rx_pop();
+	case CTU_CAN_FD_RX_PEEK_FFW:
+		/* Header fetch latency of the core is not modelled */
+		return (rx_buf.empty() || rx_read) ? 0 : rx_buf[0];
+	case CTU_CAN_FD_RX_PEEK_IDW:
+		return (rx_buf.empty() || rx_read) ? 0 : rx_buf[1];
+	case CTU_CAN_FD_TX_STATUS: {
+		uint32_t val = 0;
+
+		for (unsigned i = 0; i < TXT_BUFFERS; i++)
+			val |= (uint32_t)txt_state[i] << (4 * i);
+		return val;
+	}
+	case CTU_CAN_FD_TX_CPL_TS:
+		return tx_cpl_ts.empty() ? 0 : tx_cpl_ts.front();
+	case CTU_CAN_FD_TX_CPL:
+		return tx_cpl_pop();
+	case CTU_CAN_FD_TX_COMMAND: {
+		union ctu_can_fd_tx_command_txtb_info reg;
+
+		reg.u32 = 0;
+		reg.s.txt_buffer_count = TXT_BUFFERS;
+		return reg.u32;
+	}
+	case CTU_CAN_FD_TX_PRIORITY:
+		return tx_priority;
+	case CTU_CAN_FD_ERR_CAPT:
+		return err_capt_alc | (retr_ctr << 8);
+	case CTU_CAN_FD_RX_FR_CTR:
+		return rx_fr_ctr;
+	case CTU_CAN_FD_TX_FR_CTR:
+		return tx_fr_ctr;
+	case CTU_CAN_FD_TIMESTAMP_LOW: {
+		uint64_t ts = b.now() / SYS_CLK_NS;
+
+		ts_high_latch = ts >> 32;
+		return (uint32_t)ts;
+	}
+	case CTU_CAN_FD_TIMESTAMP_HIGH:
+		return ts_high_latch;
+	case CTU_CAN_FD_RX_DROP_CTR:
+		return rx_drop_ctr;
+	default:
+		return 0;
+	}
+}
+
+
+void node::write(uint32_t addr, uint32_t val)
+{
+	addr &= 0xFFC;
+
+	/* TXT Buffer memory can be written only when not used by protocol */
+	if (addr >= CTU_CAN_FD_TXTB1_DATA_1 &&
+	    addr < CTU_CAN_FD_TXTB1_DATA_1 + 0x100 * TXT_BUFFERS) {
+		unsigned buf = (addr >> 8) - 1;
+		unsigned word = (addr & 0xFF) >> 2;
+
+		if (word < TXT_BUFFER_WORDS && txt_state[buf] != TXT_RDY &&
+		    txt_state[buf] != TXT_TRAN && txt_state[buf] != TXT_ABTP)
+			txt_mem[buf][word] = val;
+		return;
+	}
+
+	switch (addr) {
+	case CTU_CAN_FD_MODE:
+		mode.u32 = val;
+		if (mode.s.rst)
+			reset();
+		break;
+	case CTU_CAN_FD_COMMAND: {
+		union ctu_can_fd_command cmd;
+
+		cmd.u32 = val;
+		if (cmd.s.rrb) {
+			rx_buf.clear();
+			rx_frame_words.clear();
+			rx_read = 0;
+		}
+		if (cmd.s.rxskip && !rx_frame_words.empty()) {
+			unsigned left = rx_frame_words.front() - rx_read;
+
+			while (left--)
+				rx_pop();
+		}
+		if (cmd.s.cdo)
+			dor = false;
+		if (cmd.s.rxfcrst)
+			rx_fr_ctr = 0;
+		if (cmd.s.txfcrst)
+			tx_fr_ctr = 0;
+		if (cmd.s.rxdcrst)
+			rx_drop_ctr = 0;
+		break;
+	}
+	case CTU_CAN_FD_INT_STAT:
+		int_stat &= ~val;
+		break;
+	case CTU_CAN_FD_INT_ENA_SET:
+		int_ena |= val;
+		break;
+	case CTU_CAN_FD_INT_ENA_CLR:
+		int_ena &= ~val;
+		break;
+	case CTU_CAN_FD_INT_MASK_SET:
+		int_mask |= val;
+		break;
+	case CTU_CAN_FD_INT_MASK_CLR:
+		int_mask &= ~val;
+		break;
+	case CTU_CAN_FD_BTR:
+		btr.u32 = val;
+		break;
+	case CTU_CAN_FD_BTR_FD:
+		btr_fd.u32 = val;
+		break;
+	case CTU_CAN_FD_EWL:
+		ewl = val & 0xFF;
+		erp = (val >> 8) & 0xFF;
+		break;
+	case CTU_CAN_FD_RX_STATUS:
+		/* RX_STATUS is read-only, RX_SETTINGS is upper half */
+		rx_settings.u32 = val & 0xFFFF0000;
+		break;
+	case CTU_CAN_FD_TX_COMMAND:
+		tx_command(val);
+		break;
+	case CTU_CAN_FD_TX_PRIORITY:
+		tx_priority = val;
+		break;
+	default:
+		break;
+	}
+
+	update_rbnei();
+}
+
+
+void node::tx_command(uint32_t val)
+{
+	union ctu_can_fd_tx_command_txtb_info cmd;
+
+	cmd.u32 = val;
+	for (unsigned i = 0; i < TXT_BUFFERS; i++) {
+		enum ctu_can_fd_tx_status_tx1s &s = txt_state[i];
+		bool done = s == TXT_ETY || s == TXT_TOK || s == TXT_ERR ||
+			    s == TXT_ABT;
+
+		if (!(val & (1u << (8 + i))))
+			continue;
+
+		if (cmd.s.txce && done) {
+			s = TXT_ETY;
+		} else if (cmd.s.txcr && done) {
+			s = TXT_RDY;
+		} else if (cmd.s.txca) {
+			/* Buffer in transmission is aborted at the end of frame */
+			if (s == TXT_RDY)
+				txt_done(i, TXT_ABT);
+			else if (s == TXT_TRAN)
+				s = TXT_ABTP;
+		}
+	}
+}
+
+
+void node::txt_done(unsigned buf, enum ctu_can_fd_tx_status_tx1s state)
+{
+	union ctu_can_fd_tx_cpl cpl;
+
+	txt_state[buf] = state;
+	set_int(INT_TXBHCI);
+
+	if (tx_cpl.size() == TX_CPL_DEPTH) {
+		tx_cpl_of = true;
+	} else {
+		cpl.u32 = 0;
+		cpl.s.tcidx = buf;
+		cpl.s.tcst = state;
+		cpl.s.tcrc = retr_ctr;
+		tx_cpl.push_back(cpl.u32);
+		tx_cpl_ts.push_back(b.now() / SYS_CLK_NS);
+	}
+	if (state == TXT_ERR)
+		st.tx_failed++;
+}
+
+
+bool node::enabled() const
+{
+	return mode.s.ena == CTU_CAN_ENABLED;
+}
+
+
+uint64_t node::bit_time_ns(bool data) const
+{
+	uint64_t tq, n;
+
+	if (data) {
+		tq = btr_fd.s.brp_fd ? btr_fd.s.brp_fd : 1;
+		n = 1 + btr_fd.s.prop_fd + btr_fd.s.ph1_fd + btr_fd.s.ph2_fd;
+	} else {
+		tq = btr.s.brp ? btr.s.brp : 1;
+		n = 1 + btr.s.prop + btr.s.ph1 + btr.s.ph2;
+	}
+	return tq * n * SYS_CLK_NS;
+}
+
+
+uint64_t node::sample_point_ns(bool data) const
+{
+	uint64_t tq, n;
+
+	if (data) {
+		tq = btr_fd.s.brp_fd ? btr_fd.s.brp_fd : 1;
+		n = 1 + btr_fd.s.prop_fd + btr_fd.s.ph1_fd;
+	} else {
+		tq = btr.s.brp ? btr.s.brp : 1;
+		n = 1 + btr.s.prop + btr.s.ph1;
+	}
+	return tq * n * SYS_CLK_NS;
+}
+
+
+/*
+ * Returns TXT Buffer to transmit, -1 if node does not transmit. Buffer with
+ * the highest priority wins, the lower index wins among equal priorities.
+ */
+int node::tx_candidate(uint64_t now) const
+{
+	int buf = -1;
+	unsigned best = 0;
+
+	if (!enabled() || is_bus_off() || mode.s.bmm || now < suspend_until)
+		return -1;
+
+	for (unsigned i = 0; i < TXT_BUFFERS; i++) {
+		unsigned prio = (tx_priority >> (4 * i)) & 0x7;
+
+		if (txt_state[i] == TXT_RDY && (buf < 0 || prio > best)) {
+			buf = i;
+			best = prio;
+		}
+	}
+	return buf;
+}
+
+
+bool node::get_frame(unsigned buf, can_bsm::can_frame &f) const
+{
+	union ctu_can_fd_frame_format_w ffw;
+	union ctu_can_fd_identifier_w idw;
+
+	ffw.u32 = txt_mem[buf][0];
+	idw.u32 = txt_mem[buf][1];
+
+	f.ide = ffw.s.ide == EXTENDED;
+	f.id = f.ide ? (idw.s.identifier_base << 18) | idw.s.identifier_ext :
+		       idw.s.identifier_base;
+	f.fdf = ffw.s.fdf == FD_CAN && mode.s.fde;
+	f.brs = f.fdf && ffw.s.brs == BR_SHIFT;
+	f.rtr = !f.fdf && ffw.s.rtr == RTR_FRAME;
+	f.esi = f.fdf && fault != FLT_ERR_ACTIVE;
+	f.data_length = can_bsm::dlc_to_length(ffw.s.dlc);
+	if (!f.fdf && f.data_length > 8)
+		f.data_length = 8;
+	memcpy(f.data, &txt_mem[buf][4], sizeof(f.data));
+
+	return true;
+}
+
+
+void node::rx_frame(const can_bsm::can_frame &f, uint64_t sof, uint64_t eof)
+{
+	union ctu_can_fd_frame_format_w ffw;
+	union ctu_can_fd_identifier_w idw;
+	unsigned dw = f.rtr ? 0 : (f.data_length + 3) / 4;
+	unsigned words;
+	uint64_t ts;
+
+	ffw.u32 = 0;
+	ffw.s.dlc = can_bsm::length_to_dlc(f.data_length);
+	ffw.s.rtr = f.rtr ? RTR_FRAME : NO_RTR_FRAME;
+	ffw.s.ide = f.ide ? EXTENDED : BASE;
+	ffw.s.fdf = f.fdf ? FD_CAN : NORMAL_CAN;
+	ffw.s.brs = f.brs ? BR_SHIFT : BR_NO_SHIFT;
+	ffw.s.esi_rsv = f.esi ? ESI_ERR_PASIVE : ESI_ERR_ACTIVE;
+	ffw.s.ets = rx_settings.s.rtsb;
+	ffw.s.rwcnt = ctucan_hw_rx_frame_rwcnt(4 * dw, ffw.s.ets);
+	words = ffw.s.rwcnt + 1;
+
+	idw.u32 = 0;
+	if (f.ide) {
+		idw.s.identifier_base = f.id >> 18;
+		idw.s.identifier_ext = f.id & 0x3FFFF;
+	} else {
+		idw.s.identifier_base = f.id;
+	}
+
+	/* Make room by discarding the oldest frames (not the one being read) */
+	if (rx_settings.s.rovp == ROVP_DROP_OLD) {
+		while (rx_size - rx_buf.size() < words &&
+		       rx_frame_words.size() > (rx_read ? 1u : 0u)) {
+			unsigned first = rx_read ? 1 : 0;
+			unsigned pos = first ? rx_frame_words[0] - rx_read : 0;
+			unsigned n = rx_frame_words[first];
+
+			rx_buf.erase(rx_buf.begin() + pos, rx_buf.begin() + pos + n);
+			rx_frame_words.erase(rx_frame_words.begin() + first);
+			rx_drop_ctr++;
+			st.rx_dropped_old++;
+		}
+	}
+
+	if (rx_size - rx_buf.size() < words) {
+		dor = true;
+		set_int(INT_DOI);
+		st.rx_overrun++;
+		return;
+	}
+
+	ts = (rx_settings.s.rtsop == RTS_BEG || rx_settings.s.rtsb ? sof : eof) /
+	     SYS_CLK_NS;
+	rx_buf.push_back(ffw.u32);
+	rx_buf.push_back(idw.u32);
+	rx_buf.push_back((uint32_t)ts);
+	rx_buf.push_back((uint32_t)(ts >> 32));
+	for (unsigned i = 0; i < dw; i++) {
+		uint32_t w;
+
+		memcpy(&w, &f.data[4 * i], 4);
+		rx_buf.push_back(w);
+	}
+	if (rx_settings.s.rtsb) {
+		rx_buf.push_back((uint32_t)(eof / SYS_CLK_NS));
+		rx_buf.push_back((uint32_t)(eof / SYS_CLK_NS >> 32));
+	}
+	rx_frame_words.push_back(words);
+
+	rx_fr_ctr++;
+	st.rx_stored++;
+	set_int(INT_RXI);
+	if (rx_buf.size() == rx_size)
+		set_int(INT_RXFI);
+	update_rbnei();
+}
+
+
+void node::tx_ok()
+{
+	if (tec)
+		tec--;
+	tx_fr_ctr++;
+	st.tx_ok++;
+	retr_ctr = 0;
+	txt_done(tx_buf, TXT_TOK);
+	set_int(INT_TXI);
+	tx_buf = -1;
+	err_ctrs_changed();
+}
+
+
+/*
+ * Unsuccessful transmission (error or lost arbitration). Buffer returns to
+ * Ready unless retransmit limit is reached or abort was requested.
+ */
+static enum ctu_can_fd_tx_status_tx1s retransmit_state(
+		enum ctu_can_fd_tx_status_tx1s state, bool limit_reached)
+{
+	if (state == TXT_ABTP)
+		return TXT_ABT;
+	if (limit_reached)
+		return TXT_ERR;
+	return TXT_RDY;
+}
+
+
+void node::tx_error(bool ack_error)
+{
+	enum ctu_can_fd_tx_status_tx1s state;
+	bool limit;
+
+	/* Error passive transmitter does not count missing ACK */
+	if (!ack_error || fault != FLT_ERR_PASSIVE)
+		tec += 8;
+	st.errors++;
+	set_int(INT_BEI);
+
+	retr_ctr++;
+	limit = mode.s.rtrle && retr_ctr > mode.s.rtrth;
+	if (limit)
+		retr_ctr = 0;
+	state = retransmit_state(txt_state[tx_buf], limit);
+	if (state == TXT_RDY)
+		txt_state[tx_buf] = state;
+	else
+		txt_done(tx_buf, state);
+	tx_buf = -1;
+	err_ctrs_changed();
+}
+
+
+void node::lost_arbitration(unsigned bit)
+{
+	union ctu_can_fd_err_capt_retr_ctr_alc reg;
+	enum ctu_can_fd_tx_status_tx1s state;
+	bool limit;
+
+	st.arb_lost++;
+	set_int(INT_ALI);
+
+	reg.u32 = err_capt_alc;
+	reg.s.alc_bit = bit;
+	reg.s.alc_id_field = bit < 12 ? ALC_BASE_ID : ALC_SRR_RTR;
+	err_capt_alc = reg.u32;
+
+	retr_ctr++;
+	limit = mode.s.rtrle && retr_ctr > mode.s.rtrth;
+	if (limit)
+		retr_ctr = 0;
+	state = retransmit_state(txt_state[tx_buf], limit);
+	if (state == TXT_RDY)
+		txt_state[tx_buf] = state;
+	else
+		txt_done(tx_buf, state);
+	tx_buf = -1;
+}
+
+
+void node::rx_ok()
+{
+	if (rec > 127)
+		rec = 120;
+	else if (rec)
+		rec--;
+	err_ctrs_changed();
+}
+
+
+void node::rx_error()
+{
+	if (rec < 255)
+		rec++;
+	st.errors++;
+	set_int(INT_BEI);
+	err_ctrs_changed();
+}
+
+
+void node::err_ctrs_changed()
+{
+	enum fault_state prev = fault;
+	bool prev_ewl = ewl_reached;
+
+	if (fault == FLT_BUS_OFF)
+		return;
+
+	if (tec > 255) {
+		fault = FLT_BUS_OFF;
+		st.bus_off++;
+		bus_off_until = b.now() + BUS_OFF_RECOVERY_BITS * bit_time_ns(false);
+
+		/* Frames waiting for transmission fail when node goes bus-off */
+		for (unsigned i = 0; i < TXT_BUFFERS; i++)
+			if (txt_state[i] == TXT_RDY || txt_state[i] == TXT_TRAN)
+				txt_done(i, TXT_ERR);
+		tx_buf = -1;
+	} else if (tec >= erp || rec >= erp) {
+		fault = FLT_ERR_PASSIVE;
+	} else {
+		fault = FLT_ERR_ACTIVE;
+	}
+
+	ewl_reached = tec >= ewl || rec >= ewl;
+	if (fault != prev)
+		set_int(INT_FCSI);
+	if (ewl_reached != prev_ewl)
+		set_int(INT_EWLI);
+}
+
+
+void node::bus_off_recover()
+{
+	tec = 0;
+	rec = 0;
+	fault = FLT_ERR_ACTIVE;
+	ewl_reached = false;
+	bus_off_until = 0;
+	set_int(INT_FCSI);
+}
+
+
+/*****************************************************************************
+ * Bus
+ ****************************************************************************/
+
+bus::bus(unsigned n, unsigned rx_buf_words, uint64_t seed)
+	: t_now(0), rng(seed ? seed : 1), error_rate(0), busy(false),
+	  t_sof(0), t_end(0), t_eof(0), error(false), ack_error(false)
+{
+	memset(&st, 0, sizeof(st));
+	for (unsigned i = 0; i < n; i++)
+		nodes.emplace_back(new node(*this, i, rx_buf_words));
+	cand.reserve(n);
+}
+
+
+double bus::random()
+{
+	rng ^= rng << 13;
+	rng ^= rng >> 7;
+	rng ^= rng << 17;
+	return (rng >> 11) * (1.0 / 9007199254740992.0);
+}
+
+
+/*
+ * Time from SOF till the end of bit "bits - 1". Bit rate is switched in
+ * sample point of BRS and sample point of CRC delimiter, as done by
+ * "to_runs" of bit stream model.
+ */
+uint64_t bus::frame_time(const candidate &c, unsigned bits) const
+{
+	const node &n = *c.n;
+	uint64_t nbt = n.bit_time_ns(false);
+	uint64_t t;
+	unsigned data_end;
+
+	if (!c.f.brs || bits <= c.seq.brs_index)
+		return bits * nbt;
+
+	uint64_t dbt = n.bit_time_ns(true);
+	uint64_t nsp = n.sample_point_ns(false);
+	uint64_t dsp = n.sample_point_ns(true);
+
+	t = c.seq.brs_index * nbt + nsp + dbt - dsp;
+	data_end = bits < c.seq.crc_delim_index ? bits : c.seq.crc_delim_index;
+	t += (data_end - c.seq.brs_index - 1) * dbt;
+	if (bits > c.seq.crc_delim_index)
+		t += dsp + nbt - nsp +
+		     (bits - c.seq.crc_delim_index - 1) * nbt;
+	return t;
+}
+
+
+uint64_t bus::next_event()
+{
+	uint64_t t = UINT64_MAX;
+
+	if (busy)
+		return t_end;
+
+	for (auto &n : nodes) {
+		if (n->is_bus_off()) {
+			if (n->enabled() && n->bus_off_until < t)
+				t = n->bus_off_until;
+			continue;
+		}
+		if (n->tx_candidate(UINT64_MAX) < 0)
+			continue;
+		if (n->suspend_until > t_now) {
+			if (n->suspend_until < t)
+				t = n->suspend_until;
+		} else {
+			return t_now;
+		}
+	}
+	return t;
+}
+
+
+void bus::advance(uint64_t t)
+{
+	while (t_now <= t) {
+		if (!busy) {
+			for (auto &n : nodes)
+				if (n->is_bus_off() && n->bus_off_until <= t_now)
+					n->bus_off_recover();
+
+			start_frame();
+			if (!busy) {
+				uint64_t w = next_event();
+
+				if (w > t || w <= t_now)
+					break;
+				t_now = w;
+				continue;
+			}
+		}
+		if (t_end > t)
+			break;
+		t_now = t_end;
+		end_frame();
+	}
+
+	if (t > t_now)
+		t_now = t;
+}
+
+
+void bus::start_frame()
+{
+	std::vector<candidate *> alive;
+	unsigned k;
+	int err_bit = -1;
+
+	cand.clear();
+	for (auto &n : nodes) {
+		int buf = n->tx_candidate(t_now);
+
+		if (buf < 0)
+			continue;
+
+		cand.emplace_back();
+		candidate &c = cand.back();
+		unsigned arb = 0, data_bits = 0;
+
+		c.n = n.get();
+		c.buf = buf;
+		n->get_frame(buf, c.f);
+		if (can_bsm::encode(c.f, !n->mode.s.nisofd, c.seq)) {
+			/* Invalid frame in TXT Buffer, it is never transmitted */
+			n->txt_done(buf, TXT_ERR);
+			cand.pop_back();
+			continue;
+		}
+
+		while (data_bits < (c.f.ide ? ARB_BITS_EXT : ARB_BITS_BASE))
+			if (c.seq.kind[arb++] == can_bsm::BIT_DATA)
+				data_bits++;
+		c.arb_bits = arb;
+
+		n->tx_buf = buf;
+		n->txt_state[buf] = TXT_TRAN;
+	}
+
+	if (cand.empty())
+		return;
+
+	/*
+	 * Resolve arbitration bit by bit. Node sending recessive bit while
+	 * other sends dominant loses arbitration within arbitration field,
+	 * and detects bit error after it.
+	 */
+	for (auto &c : cand)
+		alive.push_back(&c);
+	for (k = 0; alive.size() > 1; k++) {
+		bool dominant = false, recessive = false;
+
+		for (auto c : alive) {
+			if (k >= c->seq.len)
+				goto identical;
+			if (c->seq.value[k] == can_bsm::DOMINANT)
+				dominant = true;
+			else
+				recessive = true;
+		}
+		if (!dominant || !recessive)
+			continue;
+
+		if (k >= alive[0]->arb_bits) {
+			err_bit = k;
+			st.collisions++;
+			break;
+		}
+		for (auto it = alive.begin(); it != alive.end();) {
+			if ((*it)->seq.value[k] == can_bsm::RECESSIVE) {
+				(*it)->n->lost_arbitration(k);
+				it = alive.erase(it);
+			} else {
+				it++;
+			}
+		}
+	}
+identical:
+	winners = alive;
+
+	const candidate &c = *winners[0];
+	bool acked = c.n->mode.s.stm;
+
+	for (auto &n : nodes) {
+		bool tx = false;
+
+		for (auto w : winners)
+			tx |= w->n == n.get();
+		if (!tx && n->enabled() && !n->is_bus_off() && !n->mode.s.bmm)
+			acked = true;
+	}
+
+	if (err_bit < 0 && error_rate > 0 && random() < error_rate) {
+		err_bit = (int)(random() * (c.seq.crc_delim_index + 1));
+		st.injected_errors++;
+	}
+	ack_error = err_bit < 0 && !acked;
+	if (ack_error)
+		err_bit = c.seq.crc_delim_index + 1;
+
+	error = err_bit >= 0;
+	t_sof = t_now;
+	t_eof = t_sof + frame_time(c, c.seq.len);
+	if (error)
+		t_end = t_sof + frame_time(c, err_bit + 1) +
+			(ERROR_FLAG_BITS + ERROR_DELIM_BITS + INTERMISSION_BITS) *
+			c.n->bit_time_ns(false);
+	else
+		t_end = t_eof + INTERMISSION_BITS * c.n->bit_time_ns(false);
+	busy = true;
+}
+
+
+void bus::end_frame()
+{
+	const candidate &c = *winners[0];
+
+	busy = false;
+	st.busy_ns += t_end - t_sof;
+	if (error)
+		st.error_frames++;
+	else
+		st.frames++;
+
+	for (auto &n : nodes) {
+		bool tx = false;
+
+		for (auto w : winners)
+			tx |= w->n == n.get();
+
+		if (tx) {
+			if (error)
+				n->tx_error(ack_error);
+			else
+				n->tx_ok();
+			if (n->fault == node::FLT_ERR_PASSIVE)
+				n->suspend_until = t_end + SUSPEND_BITS *
+						   n->bit_time_ns(false);
+			if (!error && n->mode.s.ilbp)
+				n->rx_frame(c.f, t_sof, t_eof);
+			continue;
+		}
+
+		if (!n->enabled() || n->is_bus_off())
+			continue;
+		if (error) {
+			n->rx_error();
+		} else {
+			n->rx_frame(c.f, t_sof, t_eof);
+			n->rx_ok();
+		}
+	}
+	winners.clear();
+}
+
+} // namespace can_bus_sim
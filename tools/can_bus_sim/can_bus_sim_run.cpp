@@ -0,0 +1,684 @@
+/*******************************************************************************
+ *
+ * CAN bus simulator.
+ *
+ * Module: Scenario runner, driver throughput on the virtual bus.
+ *
+ * Copyright (C) 2021-present Ondrej Ille <ondrej.ille@gmail.com>
+ *
+ * This program is free software; you can redistribute it and/or
+ * modify it under the terms of the GNU General Public License
+ * as published by the Free Software Foundation; either version 2
+ * of the License, or (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program; if not, write to the Free Software
+ * Foundation, Inc., 51 Franklin Street, Fifth Floor, Boston, MA  02110-1301, USA.
+ *
+*******************************************************************************/
+
+/*
+ * Each node of the bus is served by emulated driver, which mirrors interrupt
+ * handler, NAPI poll and start_xmit of ctucanfd_base.c (FIFO TXT Buffer
+ * order with rotating priorities). All accesses go via HAL (ctucanfd_hw.c)
+ * to register model of the node.
+ *
+ * Each node has its own CPU. Interrupt is serviced "irq_lat" after it is
+ * raised, when the CPU is not busy. Register accesses of a service take
+ * effect at its start, CPU is then busy for the service time:
+ *
+ *	ISR:		isr + tx * <completed TXT Buffers>
+ *	NAPI poll:	rx * <received frames>
+ *	start_xmit:	tx
+ */
+
+#include <algorithm>
+#include <err.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <unistd.h>
+
+#include "include/can_bus_sim.h"
+
+using namespace can_bus_sim;
+
+/* Clock of modelled nodes, as seen by can_get_bittiming */
+#define SYS_CLK_HZ	100000000
+
+#define NEVER		UINT64_MAX
+
+/* Same limit as in ctucan_interrupt */
+#define IRQ_LOOPS_MAX	10000
+
+/* Frame payload: sequence number (4 bytes) and index of sending node */
+#define PAYLOAD_MIN	5
+
+struct scenario {
+	unsigned nodes;
+	uint32_t bitrate;
+	uint32_t dbitrate;
+	bool fd;
+	unsigned data_length;
+	double rate;			// Offered frames/s per node, 0 - saturate
+	uint64_t duration;		// ns
+	uint64_t irq_lat;		// ns
+	uint64_t isr_cost;		// ns
+	uint64_t rx_cost;		// ns per frame
+	uint64_t tx_cost;		// ns per frame
+	unsigned quota;
+	unsigned txqueuelen;
+	unsigned rx_words;
+	double error_rate;
+	bool drop_old;
+	uint64_t seed;
+};
+
+/*
+ * Emulated driver of one node and its CPU.
+ */
+struct host {
+	node *n;
+	struct ctucan_hw_priv *hw;
+	unsigned idx;
+
+	/* Software TX queue (qdisc) in front of the driver */
+	std::deque<uint32_t> txq;
+	std::vector<uint64_t> tx_time;	// Enqueue time by sequence number
+	uint32_t seq;
+	uint64_t next_gen;
+	bool queue_stopped;
+
+	/* Driver state as in struct ctucan_priv */
+	uint32_t txb_head;
+	uint32_t txb_tail;
+	uint32_t txb_prio;
+	uint32_t txb_cpl_done;		// TXT Buffers with popped TX completion record
+	uint8_t txb_cpl_st[TXT_BUFFERS];
+	uint32_t rx_drop_ctr;
+	bool napi_scheduled;
+	bool dead;
+
+	/* CPU */
+	uint64_t cpu_free;
+	uint64_t irq_at;
+	uint64_t cpu_busy;
+
+	/* Statistics as in struct net_device_stats */
+	uint64_t offered;
+	uint64_t qdisc_drop;
+	uint64_t tx_packets;
+	uint64_t tx_dropped;
+	uint64_t rx_packets;
+	uint64_t rx_over_errors;
+	std::vector<uint64_t> latency;
+};
+
+static struct scenario sc = {
+	2, 500000, 2000000, false, 8, 0, 1000000000ULL,
+	5000, 2000, 1000, 1000, 64, 10, 128, 0, false, 1
+};
+
+static std::vector<host> hosts;
+
+
+static void chip_start(struct host &h)
+{
+	struct net_device nd;
+	struct can_bittiming nbt, dbt;
+	struct can_ctrlmode mode;
+	union ctu_can_fd_int_stat int_ena, int_msk;
+
+	ctucan_hw_reset(h.hw);
+	if (!ctucan_hw_check_access(h.hw))
+		errx(1, "node %u: not accessible", h.idx);
+
+	h.txb_prio = 0x01234567;
+	h.txb_head = 0;
+	h.txb_tail = 0;
+	h.txb_cpl_done = 0;
+	h.hw->write_reg(h.hw, CTU_CAN_FD_TX_PRIORITY, h.txb_prio);
+
+	ctucan_hw_set_rx_ovf_policy(h.hw, sc.drop_old ? ROVP_DROP_OLD :
+							  ROVP_DROP_NEW);
+	h.rx_drop_ctr = 0;
+
+	memset(&nd, 0, sizeof(nd));
+	nd.can.clock.freq = SYS_CLK_HZ;
+	memset(&nbt, 0, sizeof(nbt));
+	nbt.bitrate = sc.bitrate;
+	nbt.sample_point = 800;
+	if (can_get_bittiming(&nd, &nbt, &ctu_can_fd_bit_timing_max, NULL, 0))
+		errx(1, "can_get_bittiming: %u bit/s", sc.bitrate);
+	memset(&dbt, 0, sizeof(dbt));
+	dbt.bitrate = sc.dbitrate;
+	dbt.sample_point = 800;
+	if (can_get_bittiming(&nd, &dbt, &ctu_can_fd_bit_timing_data_max, NULL, 0))
+		errx(1, "can_get_bittiming data: %u bit/s", sc.dbitrate);
+	ctucan_hw_set_nom_bittiming(h.hw, &nbt);
+	ctucan_hw_set_data_bittiming(h.hw, &dbt);
+
+	mode.flags = CAN_CTRLMODE_FD;
+	mode.mask = 0xFFFFFFFF;
+	ctucan_hw_set_mode(h.hw, &mode);
+
+	int_ena.u32 = 0;
+	int_ena.s.txbhci = 1;
+	int_ena.s.ewli = 1;
+	int_ena.s.fcsi = 1;
+	int_ena.s.rbnei = 1;
+	int_msk.u32 = ~int_ena.u32;
+	ctucan_hw_int_mask_set(h.hw, int_msk);
+	ctucan_hw_int_ena_set(h.hw, int_ena);
+
+	ctucan_hw_enable(h.hw, true);
+}
+
+
+/*
+ * Mirrors ctucan_start_xmit, FIFO order of TXT Buffers.
+ */
+static void start_xmit(struct host &h)
+{
+	struct canfd_frame cf;
+	uint32_t seq = h.txq.front();
+	unsigned txtb_id;
+
+	if (!CTU_CAN_FD_TXTNF(ctu_can_get_status(h.hw))) {
+		h.queue_stopped = true;
+		warnx("node %u: BUG!, no TXB free when queue awake!", h.idx);
+		return;
+	}
+	h.txq.pop_front();
+
+	memset(&cf, 0, sizeof(cf));
+	cf.can_id = 0x100 + h.idx;
+	cf.len = sc.data_length;
+	cf.flags = sc.fd ? CANFD_BRS : 0;
+	memcpy(cf.data, &seq, 4);
+	cf.data[4] = h.idx;
+
+	txtb_id = h.txb_head % TXT_BUFFERS;
+	if (!ctucan_hw_insert_frame(h.hw, &cf, 0, txtb_id, sc.fd)) {
+		warnx("node %u: BUG! TXNF set but cannot insert frame into "
+		      "TXB#%x!", h.idx, txtb_id);
+		h.tx_dropped++;
+		h.txb_head++;
+		return;
+	}
+	ctucan_hw_txt_set_rdy(h.hw, txtb_id);
+	h.txb_head++;
+
+	if (!CTU_CAN_FD_TXTNF(ctu_can_get_status(h.hw)))
+		h.queue_stopped = true;
+}
+
+
+static void rotate_txb_prio(struct host &h)
+{
+	h.txb_prio = (h.txb_prio << 4) |
+		     ((h.txb_prio >> ((TXT_BUFFERS - 1) * 4)) & 0xF);
+	h.hw->write_reg(h.hw, CTU_CAN_FD_TX_PRIORITY, h.txb_prio);
+}
+
+
+/*
+ * Mirrors ctucan_tx_interrupt with TX completion FIFO, which the model always
+ * has. Overflow is impossible, each buffer has at most one record pending.
+ * Returns number of completed TXT Buffers.
+ */
+static unsigned tx_interrupt(struct host &h)
+{
+	union ctu_can_fd_int_stat icr;
+	bool processed;
+	unsigned done = 0;
+
+	icr.u32 = 0;
+	icr.s.txbhci = 1;
+
+	do {
+		processed = false;
+
+		/* TX completion FIFO, see ctucan_tx_cpl_complete */
+		for (;;) {
+			union ctu_can_fd_tx_cpl cpl = ctucan_hw_tx_cpl_pop(h.hw, NULL);
+
+			if (!cpl.s.tcv)
+				break;
+			if (cpl.s.tcof)
+				errx(1, "node %u: TX completion FIFO overflow", h.idx);
+			h.txb_cpl_done |= 1u << cpl.s.tcidx;
+			h.txb_cpl_st[cpl.s.tcidx] = cpl.s.tcst;
+		}
+
+		while ((int)(h.txb_head - h.txb_tail) > 0) {
+			unsigned txtb_id = h.txb_tail % TXT_BUFFERS;
+
+			if (!(h.txb_cpl_done & (1u << txtb_id)))
+				goto clear;
+			h.txb_cpl_done &= ~(1u << txtb_id);
+
+			switch (h.txb_cpl_st[txtb_id]) {
+			case TXT_TOK:
+				h.tx_packets++;
+				break;
+			case TXT_ERR:
+			case TXT_ABT:
+				h.tx_dropped++;
+				break;
+			default:
+				goto clear;
+			}
+			h.txb_tail++;
+			processed = true;
+			done++;
+			rotate_txb_prio(h);
+			ctucan_hw_txt_set_empty(h.hw, txtb_id);
+		}
+clear:
+		if (processed)
+			ctucan_hw_int_clr(h.hw, icr);
+	} while (processed);
+
+	if (h.queue_stopped && CTU_CAN_FD_TXTNF(ctu_can_get_status(h.hw)))
+		h.queue_stopped = false;
+
+	return done;
+}
+
+
+static void rx_frame(struct host &h, uint64_t now)
+{
+	struct canfd_frame cf;
+	uint32_t seq;
+	u64 ts;
+
+	ctucan_hw_read_rx_frame(h.hw, &cf, &ts);
+	h.rx_packets++;
+
+	if (cf.len < PAYLOAD_MIN || cf.data[4] >= hosts.size())
+		return;
+	memcpy(&seq, cf.data, 4);
+	if (seq < hosts[cf.data[4]].tx_time.size())
+		h.latency.push_back(now - hosts[cf.data[4]].tx_time[seq]);
+}
+
+
+/*
+ * Mirrors ctucan_rx_poll. Returns number of received frames.
+ */
+static unsigned rx_poll(struct host &h, uint64_t now)
+{
+	union ctu_can_fd_int_stat irq_src;
+	unsigned work_done = 0;
+	unsigned framecnt;
+
+	framecnt = ctucan_hw_get_rx_frame_count(h.hw);
+	while (framecnt && work_done < sc.quota) {
+		rx_frame(h, now);
+		work_done++;
+		framecnt = ctucan_hw_get_rx_frame_count(h.hw);
+	}
+
+	if (CTU_CAN_FD_DATA_OVERRUN(ctu_can_get_status(h.hw))) {
+		h.rx_over_errors++;
+		ctucan_hw_clr_overrun_flag(h.hw);
+	}
+
+	if (sc.drop_old) {
+		uint32_t dropctr = ctucan_hw_get_rx_drop_ctr(h.hw);
+
+		h.rx_over_errors += dropctr - h.rx_drop_ctr;
+		h.rx_drop_ctr = dropctr;
+	}
+
+	if (!framecnt) {
+		h.napi_scheduled = false;
+		irq_src.u32 = 0;
+		irq_src.s.rbnei = 1;
+		ctucan_hw_int_clr(h.hw, irq_src);
+		ctucan_hw_int_mask_clr(h.hw, irq_src);
+	}
+
+	return work_done;
+}
+
+
+/*
+ * Mirrors ctucan_interrupt. Returns service time.
+ */
+static uint64_t interrupt(struct host &h)
+{
+	union ctu_can_fd_int_stat isr, icr;
+	unsigned done = 0;
+
+	for (int irq_loops = 0; irq_loops < IRQ_LOOPS_MAX; irq_loops++) {
+		isr.u32 = h.hw->read_reg(h.hw, CTU_CAN_FD_INT_STAT);
+		if (!isr.u32)
+			return sc.isr_cost + done * sc.tx_cost;
+
+		if (isr.s.rbnei) {
+			icr.u32 = 0;
+			icr.s.rbnei = 1;
+			ctucan_hw_int_mask_set(h.hw, icr);
+			ctucan_hw_int_clr(h.hw, icr);
+			h.napi_scheduled = true;
+		}
+
+		if (isr.s.txbhci)
+			done += tx_interrupt(h);
+
+		if (isr.s.ewli || isr.s.fcsi || isr.s.ali) {
+			icr.u32 = 0;
+			icr.s.ewli = isr.s.ewli;
+			icr.s.fcsi = isr.s.fcsi;
+			icr.s.ali = isr.s.ali;
+			ctucan_hw_int_clr(h.hw, icr);
+		}
+	}
+
+	warnx("node %u: stuck interrupt (isr=0x%08x), stopping", h.idx, isr.u32);
+	icr.u32 = 0xFFFFFFFF;
+	ctucan_hw_int_ena_clr(h.hw, icr);
+	ctucan_hw_int_mask_set(h.hw, icr);
+	h.dead = true;
+
+	return sc.isr_cost + done * sc.tx_cost;
+}
+
+
+static bool has_work(const struct host &h)
+{
+	return h.irq_at != NEVER || h.napi_scheduled ||
+	       (!h.txq.empty() && !h.queue_stopped);
+}
+
+
+/* Time when CPU of the host starts next service */
+static uint64_t next_service(const struct host &h, uint64_t now)
+{
+	uint64_t t;
+
+	if (h.dead)
+		return NEVER;
+	if (h.napi_scheduled || (!h.txq.empty() && !h.queue_stopped))
+		t = now;
+	else
+		t = h.irq_at;
+	if (t == NEVER)
+		return NEVER;
+	return max(t, h.cpu_free);
+}
+
+
+/*
+ * Run one service of the host CPU: interrupt (followed by NAPI poll), NAPI
+ * poll re-scheduled after exhausted quota, or transmission of one frame.
+ */
+static void service(struct host &h, uint64_t now)
+{
+	uint64_t cost = 0;
+
+	if (h.irq_at != NEVER && h.irq_at <= now) {
+		cost = interrupt(h);
+		if (h.napi_scheduled)
+			cost += rx_poll(h, now) * sc.rx_cost;
+	} else if (h.napi_scheduled) {
+		cost = rx_poll(h, now) * sc.rx_cost;
+	} else {
+		start_xmit(h);
+		cost = sc.tx_cost;
+	}
+
+	h.cpu_free = now + cost;
+	h.cpu_busy += cost;
+}
+
+
+static void generate(struct host &h, uint64_t now)
+{
+	if (sc.rate == 0) {
+		while (h.txq.size() < sc.txqueuelen) {
+			h.txq.push_back(h.seq++);
+			h.tx_time.push_back(now);
+			h.offered++;
+		}
+		return;
+	}
+
+	while (h.next_gen <= now) {
+		h.offered++;
+		if (h.txq.size() < sc.txqueuelen) {
+			h.txq.push_back(h.seq++);
+			h.tx_time.push_back(h.next_gen);
+		} else {
+			h.qdisc_drop++;
+		}
+		h.next_gen += (uint64_t)(1e9 / sc.rate);
+	}
+}
+
+
+/* Interrupt line is sampled after each change of model state */
+static void update_irq(struct host &h, uint64_t now)
+{
+	if (!h.n->irq())
+		h.irq_at = NEVER;
+	else if (h.irq_at == NEVER)
+		h.irq_at = now + sc.irq_lat;
+}
+
+
+static void run(bus &b)
+{
+	uint64_t now = 0;
+
+	for (auto &h : hosts) {
+		chip_start(h);
+		/* Spread start of periodic traffic over one period */
+		h.next_gen = sc.rate ? h.idx * (uint64_t)(1e9 / sc.rate) /
+				       hosts.size() : 0;
+	}
+
+	while (now <= sc.duration) {
+		uint64_t t = b.next_event();
+
+		for (auto &h : hosts) {
+			generate(h, now);
+			if (sc.rate)
+				t = min(t, h.next_gen);
+			t = min(t, next_service(h, now));
+		}
+		if (t == NEVER || t > sc.duration)
+			break;
+
+		now = max(now, t);
+		b.advance(now);
+		for (auto &h : hosts)
+			update_irq(h, now);
+
+		for (auto &h : hosts) {
+			generate(h, now);
+			if (next_service(h, now) <= now && has_work(h)) {
+				service(h, now);
+				for (auto &o : hosts)
+					update_irq(o, now);
+			}
+		}
+	}
+	b.advance(sc.duration);
+}
+
+
+static uint64_t percentile(std::vector<uint64_t> &v, unsigned p)
+{
+	if (v.empty())
+		return 0;
+	std::sort(v.begin(), v.end());
+	return v[(v.size() - 1) * p / 100];
+}
+
+
+static void report(bus &b)
+{
+	const struct bus_stats &bs = b.stats();
+	double sec = sc.duration / 1e9;
+
+	printf("# %u nodes, %u / %u bit/s, %s, %u bytes, %s, %.3f s\n",
+	       sc.nodes, sc.bitrate, sc.dbitrate, sc.fd ? "CAN FD" : "CAN 2.0",
+	       sc.data_length, sc.rate ? "periodic" : "saturated", sec);
+	printf("# node  offered/s    sent/s  qdisc_drop  tx_drop     rx/s  "
+	       "rx_ovr  lat_avg[us]  lat_p99[us]  lat_max[us]  cpu[%%]\n");
+
+	for (auto &h : hosts) {
+		const struct node_stats &ns = h.n->stats();
+		uint64_t sum = 0, p99, max;
+
+		for (auto l : h.latency)
+			sum += l;
+		p99 = percentile(h.latency, 99);
+		max = percentile(h.latency, 100);
+		printf("%6u %10.0f %9.0f %11llu %8llu %8.0f %7llu %12.1f %12.1f "
+		       "%12.1f %7.1f\n", h.idx, h.offered / sec,
+		       h.tx_packets / sec, (unsigned long long)h.qdisc_drop,
+		       (unsigned long long)h.tx_dropped, h.rx_packets / sec,
+		       (unsigned long long)(ns.rx_overrun + ns.rx_dropped_old),
+		       h.latency.empty() ? 0.0 : sum / 1e3 / h.latency.size(),
+		       p99 / 1e3, max / 1e3,
+		       100.0 * h.cpu_busy / sc.duration);
+	}
+
+	printf("# bus: load %.1f %%, %llu frames, %llu error frames "
+	       "(%llu injected, %llu collisions)\n",
+	       100.0 * bs.busy_ns / sc.duration, (unsigned long long)bs.frames,
+	       (unsigned long long)bs.error_frames,
+	       (unsigned long long)bs.injected_errors,
+	       (unsigned long long)bs.collisions);
+}
+
+
+void print_help(void)
+{
+	fprintf(stdout, "Usage: \n");
+	fprintf(stdout, "	can_bus_sim [options]\n\n");
+	fprintf(stdout, "Runs emulated CTU CAN FD driver on each node of "
+			"virtual CAN bus and reports\n"
+			"throughput, latency and drops.\n\n");
+	fprintf(stdout, "	-n	Number of nodes (default: 2)\n");
+	fprintf(stdout, "	-b	Nominal bit rate (default: 500000)\n");
+	fprintf(stdout, "	-B	Data bit rate (default: 2000000)\n");
+	fprintf(stdout, "	-f	CAN FD frames with bit rate shift\n");
+	fprintf(stdout, "	-d	Data length in bytes (default: 8)\n");
+	fprintf(stdout, "	-r	Offered frames/s per node, 0 - saturate "
+			"(default: 0)\n");
+	fprintf(stdout, "	-t	Duration in ms (default: 1000)\n");
+	fprintf(stdout, "	-L	Interrupt latency in ns (default: 5000)\n");
+	fprintf(stdout, "	-I	Interrupt handler time in ns (default: 2000)\n");
+	fprintf(stdout, "	-R	Time per received frame in ns (default: 1000)\n");
+	fprintf(stdout, "	-X	Time per transmitted frame in ns (default: 1000)\n");
+	fprintf(stdout, "	-q	NAPI quota (default: 64)\n");
+	fprintf(stdout, "	-Q	TX queue length (default: 10)\n");
+	fprintf(stdout, "	-w	RX Buffer size in words (default: 128)\n");
+	fprintf(stdout, "	-e	Probability of error in frame (default: 0)\n");
+	fprintf(stdout, "	-o	Drop oldest frames on RX Buffer overrun\n");
+	fprintf(stdout, "	-s	Seed of random generator (default: 1)\n");
+}
+
+
+int main(int argc, char *argv[])
+{
+	int opt;
+
+	while ((opt = getopt(argc, argv, "n:b:B:fd:r:t:L:I:R:X:q:Q:w:e:os:h")) != -1) {
+		switch (opt) {
+		case 'n':
+			sc.nodes = strtoul(optarg, NULL, 0);
+			break;
+		case 'b':
+			sc.bitrate = strtoul(optarg, NULL, 0);
+			break;
+		case 'B':
+			sc.dbitrate = strtoul(optarg, NULL, 0);
+			break;
+		case 'f':
+			sc.fd = true;
+			break;
+		case 'd':
+			sc.data_length = strtoul(optarg, NULL, 0);
+			break;
+		case 'r':
+			sc.rate = strtod(optarg, NULL);
+			break;
+		case 't':
+			sc.duration = strtoull(optarg, NULL, 0) * 1000000;
+			break;
+		case 'L':
+			sc.irq_lat = strtoull(optarg, NULL, 0);
+			break;
+		case 'I':
+			sc.isr_cost = strtoull(optarg, NULL, 0);
+			break;
+		case 'R':
+			sc.rx_cost = strtoull(optarg, NULL, 0);
+			break;
+		case 'X':
+			sc.tx_cost = strtoull(optarg, NULL, 0);
+			break;
+		case 'q':
+			sc.quota = strtoul(optarg, NULL, 0);
+			break;
+		case 'Q':
+			sc.txqueuelen = strtoul(optarg, NULL, 0);
+			break;
+		case 'w':
+			sc.rx_words = strtoul(optarg, NULL, 0);
+			break;
+		case 'e':
+			sc.error_rate = strtod(optarg, NULL);
+			break;
+		case 'o':
+			sc.drop_old = true;
+			break;
+		case 's':
+			sc.seed = strtoull(optarg, NULL, 0);
+			break;
+		default:
+			print_help();
+			exit(EXIT_FAILURE);
+		}
+	}
+
+	if (sc.nodes < 1 || sc.nodes > 256 || sc.quota < 1 || sc.txqueuelen < 1 ||
+	    sc.rx_words < 32 || sc.rx_words > 8191 ||
+	    can_bsm::length_to_dlc(sc.data_length) < 0 ||
+	    (!sc.fd && sc.data_length > 8)) {
+		print_help();
+		exit(EXIT_FAILURE);
+	}
+	if (sc.data_length < PAYLOAD_MIN)
+		warnx("data length below %u bytes, latency is not measured",
+		      PAYLOAD_MIN);
+
+	bus b(sc.nodes, sc.rx_words, sc.seed);
+	b.set_error_rate(sc.error_rate);
+
+	hosts.resize(sc.nodes);
+	for (unsigned i = 0; i < sc.nodes; i++) {
+		struct host &h = hosts[i];
+
+		h.n = &b[i];
+		h.hw = b[i].hw();
+		h.idx = i;
+		h.irq_at = NEVER;
+	}
+
+	run(b);
+	report(b);
+
+	return EXIT_SUCCESS;
+}
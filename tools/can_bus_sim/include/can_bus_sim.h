@@ -0,0 +1,277 @@
+/*******************************************************************************
+ *
+ * CAN bus simulator.
+ *
+ * Module: Virtual CAN bus with register models of CTU CAN FD nodes.
+ *
+ * Copyright (C) 2021-present Ondrej Ille <ondrej.ille@gmail.com>
+ *
+ * This program is free software; you can redistribute it and/or
+ * modify it under the terms of the GNU General Public License
+ * as published by the Free Software Foundation; either version 2
+ * of the License, or (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program; if not, write to the Free Software
+ * Foundation, Inc., 51 Franklin Street, Fifth Floor, Boston, MA  02110-1301, USA.
+ *
+*******************************************************************************/
+
+#pragma once
+
+#include <stdint.h>
+#include <deque>
+#include <memory>
+#include <vector>
+
+extern "C" {
+#include "ctucanfd_linux_defs.h"
+#include "ctucanfd_hw.h"
+}
+
+#include "bit_stream_model.h"
+
+namespace can_bus_sim {
+
+/* System clock of modelled nodes (100 MHz), timestamp counts its cycles */
+constexpr uint64_t SYS_CLK_NS = 10;
+
+constexpr unsigned TXT_BUFFERS = CTU_CAN_FD_TXT_BUFFER_COUNT;
+
+/* Words of TXT Buffer: FRAME_FORMAT_W, IDENTIFIER_W, 2 timestamp, 16 data */
+constexpr unsigned TXT_BUFFER_WORDS = 20;
+
+/* Records of TX completion FIFO (C_TX_CPL_DEPTH) */
+constexpr unsigned TX_CPL_DEPTH = 16;
+
+/* Fixed parts of frame after error is detected, in nominal bits */
+constexpr unsigned ERROR_FLAG_BITS = 6;
+constexpr unsigned ERROR_DELIM_BITS = 8;
+constexpr unsigned INTERMISSION_BITS = 3;
+constexpr unsigned SUSPEND_BITS = 8;
+
+/* Bus-off node re-integrates after 128 occurrences of 11 recessive bits */
+constexpr unsigned BUS_OFF_RECOVERY_BITS = 128 * 11;
+
+class bus;
+
+/*
+ * Statistics of a node, as seen by the bus (ground truth, independent of
+ * what driver reads from registers).
+ */
+struct node_stats {
+	uint64_t tx_ok;			// Frames transmitted successfully
+	uint64_t tx_failed;		// TXT Buffers which ended in TX Failed
+	uint64_t arb_lost;		// Arbitrations lost
+	uint64_t rx_stored;		// Frames stored to RX Buffer
+	uint64_t rx_overrun;		// Frames lost due to full RX Buffer
+	uint64_t rx_dropped_old;	// Frames discarded with ROVP_DROP_OLD
+	uint64_t errors;		// Error frames node took part in
+	uint64_t bus_off;		// Transitions to bus-off
+};
+
+/*
+ * Register model of CTU CAN FD node. Registers are modelled at the level
+ * which is visible to the driver (ctucanfd_hw.c), protocol is modelled
+ * at frame level by the bus, arbitration at bit level.
+ *
+ * Not modelled: acceptance filters, Priority RX buffer, RX DMA, TX FIFO
+ * mode, time triggered transmission, SSP and test registers. Such registers
+ * read as zero and writes to them are ignored.
+ */
+class node {
+public:
+	node(bus &b, unsigned index, unsigned rx_buf_words);
+
+	/*
+	 * Register access of the driver. Accesses are 32 bit, address is
+	 * aligned down to the 32 bit word.
+	 */
+	uint32_t read(uint32_t addr);
+	void write(uint32_t addr, uint32_t val);
+
+	/*
+	 * Driver-facing register interface, pass it to ctucan_hw_* functions.
+	 */
+	struct ctucan_hw_priv *hw() { return &port.hw; }
+
+	/* Interrupt output */
+	bool irq() const;
+
+	unsigned index() const { return idx; }
+	const node_stats &stats() const { return st; }
+
+private:
+	friend class bus;
+
+	struct hw_port {
+		struct ctucan_hw_priv hw;	// Must be first, see hw_read
+		node *n;
+	};
+
+	static u32 hw_read(struct ctucan_hw_priv *priv,
+			   enum ctu_can_fd_can_registers reg);
+	static void hw_write(struct ctucan_hw_priv *priv,
+			     enum ctu_can_fd_can_registers reg, u32 val);
+
+	void reset();
+	void set_int(uint32_t bits);
+	void update_rbnei();
+	void tx_command(uint32_t val);
+	void txt_done(unsigned buf, enum ctu_can_fd_tx_status_tx1s state);
+	void err_ctrs_changed();
+	uint32_t rx_pop();
+	uint32_t tx_cpl_pop();
+
+	/* Protocol level, called by the bus */
+	bool enabled() const;
+	bool is_bus_off() const { return fault == FLT_BUS_OFF; }
+	int tx_candidate(uint64_t now) const;
+	bool get_frame(unsigned buf, can_bsm::can_frame &f) const;
+	void rx_frame(const can_bsm::can_frame &f, uint64_t sof, uint64_t eof);
+	void tx_ok();
+	void tx_error(bool ack_error);
+	void rx_ok();
+	void rx_error();
+	void lost_arbitration(unsigned bit);
+	void bus_off_recover();
+	uint64_t bit_time_ns(bool data) const;
+	uint64_t sample_point_ns(bool data) const;
+
+	enum fault_state {
+		FLT_ERR_ACTIVE,
+		FLT_ERR_PASSIVE,
+		FLT_BUS_OFF
+	};
+
+	bus &b;
+	unsigned idx;
+	hw_port port;
+	node_stats st;
+
+	union ctu_can_fd_mode_settings mode;
+	uint32_t int_stat;
+	uint32_t int_ena;
+	uint32_t int_mask;
+	union ctu_can_fd_btr btr;
+	union ctu_can_fd_btr_fd btr_fd;
+	uint8_t ewl;
+	uint8_t erp;
+	unsigned rec;
+	unsigned tec;
+	enum fault_state fault;
+	bool ewl_reached;
+	uint32_t err_capt_alc;
+	uint32_t rx_fr_ctr;
+	uint32_t tx_fr_ctr;
+	uint32_t ts_high_latch;
+
+	/* RX Buffer, frame_words holds word count of each stored frame */
+	unsigned rx_size;
+	std::deque<uint32_t> rx_buf;
+	std::deque<unsigned> rx_frame_words;
+	unsigned rx_read;		// Words read from the oldest frame
+	union ctu_can_fd_rx_status_rx_settings rx_settings;
+	bool dor;
+	uint32_t rx_drop_ctr;
+
+	/* TXT Buffers */
+	enum ctu_can_fd_tx_status_tx1s txt_state[TXT_BUFFERS];
+	uint32_t txt_mem[TXT_BUFFERS][TXT_BUFFER_WORDS];
+	uint32_t tx_priority;
+	int tx_buf;			// Buffer being transmitted, -1 if none
+	unsigned retr_ctr;
+
+	/* TX completion FIFO, TCCNT, TCOF and TCV are filled on read */
+	std::deque<uint32_t> tx_cpl;
+	std::deque<uint32_t> tx_cpl_ts;
+	bool tx_cpl_of;
+
+	uint64_t suspend_until;		// Suspend transmission of error passive
+	uint64_t bus_off_until;		// Bus-off recovery
+};
+
+/*
+ * Bus statistics.
+ */
+struct bus_stats {
+	uint64_t frames;		// Frames transmitted without error
+	uint64_t error_frames;		// Frames ended by error frame
+	uint64_t injected_errors;	// Of that, injected by error rate
+	uint64_t collisions;		// Of that, equal arbitration, different frame
+	uint64_t busy_ns;		// Time bus was not idle
+};
+
+/*
+ * Virtual CAN bus. Bus is event driven: when the bus is idle and any node
+ * has a frame to transmit, frames of all such nodes are encoded to bit
+ * sequences and arbitration is resolved bit by bit (stuff bits included).
+ * Transmission takes exact time of the encoded frame at nominal and data
+ * bit rate of the transmitter, followed by intermission.
+ */
+class bus {
+public:
+	bus(unsigned nodes, unsigned rx_buf_words, uint64_t seed);
+
+	node &operator[](unsigned i) { return *nodes[i]; }
+	unsigned size() const { return nodes.size(); }
+
+	/* Current time of the bus in ns */
+	uint64_t now() const { return t_now; }
+
+	/*
+	 * Time of next bus event (end of frame in progress, end of suspend
+	 * or bus-off recovery), or UINT64_MAX when there is nothing to do.
+	 */
+	uint64_t next_event();
+
+	/*
+	 * Run the bus till time "t". Frames ending at "t" are completed.
+	 */
+	void advance(uint64_t t);
+
+	/*
+	 * Probability that a frame is corrupted by an error. Error hits random
+	 * bit of the frame till CRC delimiter.
+	 */
+	void set_error_rate(double p) { error_rate = p; }
+
+	const bus_stats &stats() const { return st; }
+
+private:
+	struct candidate {
+		node *n;
+		unsigned buf;
+		can_bsm::can_frame f;
+		can_bsm::bit_seq seq;
+		unsigned arb_bits;	// Length of arbitration field in bits
+	};
+
+	void start_frame();
+	void end_frame();
+	uint64_t frame_time(const candidate &c, unsigned bits) const;
+	double random();
+
+	std::vector<std::unique_ptr<node>> nodes;
+	uint64_t t_now;
+	uint64_t rng;
+	double error_rate;
+	bus_stats st;
+
+	/* Frame in progress */
+	bool busy;
+	uint64_t t_sof;
+	uint64_t t_end;
+	uint64_t t_eof;
+	std::vector<candidate> cand;
+	std::vector<candidate *> winners;
+	bool error;
+	bool ack_error;
+};
+
+} // namespace can_bus_sim